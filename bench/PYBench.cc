@@ -0,0 +1,465 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Replays key sequences through the phonetic editors without an ibus daemon.
+ *
+ * Each line of a key file is one input session, the editor is reset after
+ * every line. Printable ascii characters are sent as is, and "<name>" sends
+ * the key named by ibus_keyval_from_name, e.g. "nihao<space>". Lines starting
+ * with '#' are comments.
+ */
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <atomic>
+#include <new>
+#include <vector>
+#include <ibus.h>
+#include <glib/gstdio.h>
+#include "PYConfig.h"
+#include "PYText.h"
+#include "PYLookupTable.h"
+#include "PYLibPinyin.h"
+#include "PYPinyinProperties.h"
+#include "PYSimpTradConverter.h"
+#include "PYPFullPinyinEditor.h"
+#include "PYPDoublePinyinEditor.h"
+#include "PYPBopomofoEditor.h"
+#include "PYPTrace.h"
+
+using namespace PY;
+
+/* a Config which never touches GSettings. */
+class BenchConfig : public Config {
+public:
+    BenchConfig (const std::string & name) : Config (name)
+    {
+        m_option = PINYIN_INCOMPLETE | ZHUYIN_INCOMPLETE | PINYIN_CORRECT_ALL;
+        m_option_mask = PINYIN_INCOMPLETE | ZHUYIN_INCOMPLETE | PINYIN_CORRECT_ALL;
+        m_bopomofo_keyboard_mapping = ZHUYIN_DEFAULT;
+    }
+
+    void setPageSize (guint page_size)          { m_page_size = page_size; }
+    void setEmojiCandidate (gboolean emoji)     { m_emoji_candidate = emoji; }
+    void setCoalesceKeys (gboolean coalesce)    { m_coalesce_keys = coalesce; }
+    void setAsyncCandidates (gboolean async)    { m_async_candidates = async; }
+    void setInitSimpChinese (gboolean simp)     { m_init_simp_chinese = simp; }
+    void setDoublePinyin (gboolean double_pinyin) { m_double_pinyin = double_pinyin; }
+};
+
+/* counting sinks for the editor signals. */
+struct SignalCounter {
+    guint64 commit_text;
+    guint64 update_preedit_text;
+    guint64 show_hide_preedit_text;
+    guint64 update_auxiliary_text;
+    guint64 show_hide_auxiliary_text;
+    guint64 update_lookup_table;
+    guint64 update_lookup_table_fast;
+    guint64 show_hide_lookup_table;
+    /* the candidates sent by the full lookup table updates. */
+    guint64 lookup_table_entries;
+
+    SignalCounter ()
+        : commit_text (0),
+          update_preedit_text (0),
+          show_hide_preedit_text (0),
+          update_auxiliary_text (0),
+          show_hide_auxiliary_text (0),
+          update_lookup_table (0),
+          update_lookup_table_fast (0),
+          show_hide_lookup_table (0),
+          lookup_table_entries (0) { }
+
+    guint64 total (void) const
+    {
+        return commit_text +
+            update_preedit_text + show_hide_preedit_text +
+            update_auxiliary_text + show_hide_auxiliary_text +
+            update_lookup_table + update_lookup_table_fast +
+            show_hide_lookup_table;
+    }
+
+    void connect (EditorPtr editor)
+    {
+        editor->signalCommitText ().connect (
+            [this] (Text &) { commit_text ++; });
+
+        editor->signalUpdatePreeditText ().connect (
+            [this] (Text &, guint, gboolean) { update_preedit_text ++; });
+        editor->signalShowPreeditText ().connect (
+            [this] () { show_hide_preedit_text ++; });
+        editor->signalHidePreeditText ().connect (
+            [this] () { show_hide_preedit_text ++; });
+
+        editor->signalUpdateAuxiliaryText ().connect (
+            [this] (Text &, gboolean) { update_auxiliary_text ++; });
+        editor->signalShowAuxiliaryText ().connect (
+            [this] () { show_hide_auxiliary_text ++; });
+        editor->signalHideAuxiliaryText ().connect (
+            [this] () { show_hide_auxiliary_text ++; });
+
+        editor->signalUpdateLookupTable ().connect (
+            [this] (LookupTable & table, gboolean) {
+                update_lookup_table ++;
+                lookup_table_entries += table.size ();
+            });
+        editor->signalUpdateLookupTableFast ().connect (
+            [this] (LookupTable &, gboolean) { update_lookup_table_fast ++; });
+        editor->signalShowLookupTable ().connect (
+            [this] () { show_hide_lookup_table ++; });
+        editor->signalHideLookupTable ().connect (
+            [this] () { show_hide_lookup_table ++; });
+    }
+};
+
+/* counts the heap allocations done with operator new, which covers
+   the std::string and std::vector storage, and with malloc, which also
+   covers g_malloc, so g_strdup, the StringArena blocks and IBusText. */
+static std::atomic<guint64> new_allocations (0);
+static std::atomic<guint64> malloc_allocations (0);
+
+#ifdef __GLIBC__
+#define HAVE_MALLOC_COUNT 1
+
+extern "C" {
+void *__libc_malloc (size_t size);
+void *__libc_calloc (size_t nmemb, size_t size);
+void *__libc_realloc (void *p, size_t size);
+
+/* the definitions in the executable interpose the ones of glibc
+   for the shared libraries too. */
+void *
+malloc (size_t size)
+{
+    malloc_allocations ++;
+    return __libc_malloc (size);
+}
+
+void *
+calloc (size_t nmemb, size_t size)
+{
+    malloc_allocations ++;
+    return __libc_calloc (nmemb, size);
+}
+
+void *
+realloc (void *p, size_t size)
+{
+    malloc_allocations ++;
+    return __libc_realloc (p, size);
+}
+}
+#endif
+
+void *
+operator new (size_t size)
+{
+    new_allocations ++;
+    void *p = malloc (size ? size : 1);
+    if (NULL == p)
+        throw std::bad_alloc ();
+    return p;
+}
+
+void
+operator delete (void *p) noexcept
+{
+    free (p);
+}
+
+typedef std::vector<guint> KeySequence;
+
+static void
+remove_directory (const gchar *path)
+{
+    GDir *dir = g_dir_open (path, 0, NULL);
+    if (dir) {
+        const gchar *name = NULL;
+        while ((name = g_dir_read_name (dir)) != NULL) {
+            gchar *child = g_build_filename (path, name, NULL);
+            if (g_file_test (child, G_FILE_TEST_IS_DIR))
+                remove_directory (child);
+            else
+                g_unlink (child);
+            g_free (child);
+        }
+        g_dir_close (dir);
+    }
+    g_rmdir (path);
+}
+
+static gboolean
+load_key_file (const gchar *filename, std::vector<KeySequence> & sequences)
+{
+    gchar *contents = NULL;
+    GError *error = NULL;
+
+    if (!g_file_get_contents (filename, &contents, NULL, &error)) {
+        g_printerr ("%s\n", error->message);
+        g_error_free (error);
+        return FALSE;
+    }
+
+    gchar **lines = g_strsplit (contents, "\n", -1);
+    g_free (contents);
+
+    for (gchar **line = lines; *line; ++line) {
+        const gchar *p = *line;
+        if ('\0' == *p || '#' == *p)
+            continue;
+
+        KeySequence keys;
+        while (*p) {
+            if ('<' == *p && strchr (p, '>')) {
+                const gchar *end = strchr (p, '>');
+                gchar *name = g_strndup (p + 1, end - p - 1);
+                guint keyval = ibus_keyval_from_name (name);
+                if (IBUS_VoidSymbol == keyval)
+                    g_printerr ("unknown key name: %s\n", name);
+                else
+                    keys.push_back (keyval);
+                g_free (name);
+                p = end + 1;
+                continue;
+            }
+
+            if (g_ascii_isprint (*p))
+                keys.push_back ((guchar) *p);
+            p++;
+        }
+
+        if (!keys.empty ())
+            sequences.push_back (keys);
+    }
+
+    g_strfreev (lines);
+    return TRUE;
+}
+
+static void
+replay (const gchar *name, TraceMode mode, EditorPtr editor,
+        const std::vector<KeySequence> & sequences, guint iterations)
+{
+    SignalCounter counter;
+
+    counter.connect (editor);
+    KeyTrace::instance ().reset ();
+    KeyTrace::instance ().setMode (mode);
+
+    guint64 start_new_allocations = new_allocations;
+    guint64 start_malloc_allocations = malloc_allocations;
+    guint64 start_hits = SimpTradConverter::cacheHits ();
+    guint64 start_misses = SimpTradConverter::cacheMisses ();
+    guint64 start = KeyTrace::now ();
+    for (guint i = 0; i < iterations; ++i) {
+        for (size_t n = 0; n < sequences.size (); ++n) {
+            const KeySequence & keys = sequences[n];
+            for (size_t k = 0; k < keys.size (); ++k) {
+                TraceScope scope (TRACE_STAGE_PROCESS_KEY);
+                editor->processKeyEvent (keys[k], 0, 0);
+            }
+            /* run the pending updates before the next session,
+               reset () waits for a running guess. */
+            while (g_main_context_iteration (NULL, FALSE));
+            editor->reset ();
+        }
+    }
+    gdouble elapsed = (KeyTrace::now () - start) / 1e9;
+    guint64 new_count = new_allocations - start_new_allocations;
+    guint64 malloc_count = malloc_allocations - start_malloc_allocations;
+    guint64 cache_hits = SimpTradConverter::cacheHits () - start_hits;
+    guint64 cache_misses = SimpTradConverter::cacheMisses () - start_misses;
+
+    const LatencyHistogram & latency =
+        KeyTrace::instance ().histogram (mode, TRACE_STAGE_PROCESS_KEY);
+
+    guint64 keys = latency.count ();
+    g_print ("%s: %" G_GUINT64_FORMAT " keys in %.3f s, %.0f keys/s\n",
+             name, keys, elapsed, elapsed > 0 ? keys / elapsed : 0);
+    g_print ("  latency (usec): p50 %.1f, p95 %.1f, p99 %.1f, max %.1f\n",
+             latency.percentile (50) / 1000.0,
+             latency.percentile (95) / 1000.0,
+             latency.percentile (99) / 1000.0,
+             latency.max () / 1000.0);
+
+    if (0 == keys)
+        return;
+
+    g_print ("  signals per key: %.2f (commit %.2f, preedit %.2f/%.2f, "
+             "auxiliary %.2f/%.2f, lookup table %.2f/%.2f/%.2f)\n",
+             counter.total () / (gdouble) keys,
+             counter.commit_text / (gdouble) keys,
+             counter.update_preedit_text / (gdouble) keys,
+             counter.show_hide_preedit_text / (gdouble) keys,
+             counter.update_auxiliary_text / (gdouble) keys,
+             counter.show_hide_auxiliary_text / (gdouble) keys,
+             counter.update_lookup_table / (gdouble) keys,
+             counter.update_lookup_table_fast / (gdouble) keys,
+             counter.show_hide_lookup_table / (gdouble) keys);
+#ifdef HAVE_MALLOC_COUNT
+    /* operator new calls malloc, so it is counted in both. */
+    g_print ("  heap allocations per key: %.1f malloc, %.1f operator new\n",
+             malloc_count / (gdouble) keys, new_count / (gdouble) keys);
+#else
+    (void) malloc_count;
+    g_print ("  heap allocations per key: %.1f operator new\n",
+             new_count / (gdouble) keys);
+#endif
+    if (cache_hits + cache_misses)
+        g_print ("  traditional cache: %" G_GUINT64_FORMAT " hits, %"
+                 G_GUINT64_FORMAT " misses, %.1f%% hit rate\n",
+                 cache_hits, cache_misses,
+                 100.0 * cache_hits / (cache_hits + cache_misses));
+    if (counter.update_lookup_table)
+        g_print ("  candidates per lookup table update: %.1f\n",
+                 counter.lookup_table_entries /
+                 (gdouble) counter.update_lookup_table);
+
+    String stages;
+    KeyTrace::instance ().dump (stages);
+    g_print ("%s", stages.c_str ());
+}
+
+/* options */
+static gchar *mode = NULL;
+static gint iterations = 1;
+static gint page_size = 5;
+static gboolean traditional = FALSE;
+static gboolean no_emoji = FALSE;
+static gboolean coalesce = FALSE;
+static gboolean async = FALSE;
+static gchar *cache_dir = NULL;
+
+static const GOptionEntry entries[] =
+{
+    { "mode", 'm', 0, G_OPTION_ARG_STRING, &mode,
+      "editor to replay with: full, double or bopomofo", "MODE" },
+    { "iterations", 'n', 0, G_OPTION_ARG_INT, &iterations,
+      "replay the key files N times", "N" },
+    { "page-size", 'p', 0, G_OPTION_ARG_INT, &page_size,
+      "lookup table page size", "SIZE" },
+    { "traditional", 't', 0, G_OPTION_ARG_NONE, &traditional,
+      "convert candidates to traditional Chinese", NULL },
+    { "no-emoji", 0, 0, G_OPTION_ARG_NONE, &no_emoji,
+      "disable emoji candidates", NULL },
+    { "coalesce", 'b', 0, G_OPTION_ARG_NONE, &coalesce,
+      "coalesce the keys of each line as one burst", NULL },
+    { "async", 'a', 0, G_OPTION_ARG_NONE, &async,
+      "guess the candidates on the worker thread", NULL },
+    { "cache-dir", 'c', 0, G_OPTION_ARG_FILENAME, &cache_dir,
+      "user data directory, a temporary one by default", "DIR" },
+    { NULL },
+};
+
+int
+main (gint argc, gchar **argv)
+{
+    GError *error = NULL;
+    GOptionContext *context;
+
+    context = g_option_context_new ("KEYFILE... - replay keys through the editors");
+    g_option_context_add_main_entries (context, entries, NULL);
+
+    if (!g_option_context_parse (context, &argc, &argv, &error)) {
+        g_printerr ("Option parsing failed: %s\n", error->message);
+        exit (EXIT_FAILURE);
+    }
+    g_option_context_free (context);
+
+    if (argc < 2) {
+        g_printerr ("no key file is given.\n");
+        exit (EXIT_FAILURE);
+    }
+
+    std::vector<KeySequence> sequences;
+    for (gint i = 1; i < argc; ++i) {
+        if (!load_key_file (argv[i], sequences))
+            exit (EXIT_FAILURE);
+    }
+
+    /* keep the user phrases of the running engine untouched. */
+    gchar *tmpdir = NULL;
+    if (NULL == cache_dir) {
+        tmpdir = g_dir_make_tmp ("ibus-libpinyin-bench-XXXXXX", &error);
+        if (NULL == tmpdir) {
+            g_printerr ("%s\n", error->message);
+            exit (EXIT_FAILURE);
+        }
+        cache_dir = tmpdir;
+    }
+    g_setenv ("XDG_CACHE_HOME", cache_dir, TRUE);
+
+    LibPinyinBackEnd::init ();
+    KeyTrace::init ();
+
+    BenchConfig pinyin_config ("libpinyin");
+    BenchConfig bopomofo_config ("libbopomofo");
+    BenchConfig *configs[] = { &pinyin_config, &bopomofo_config };
+    for (guint i = 0; i < G_N_ELEMENTS (configs); ++i) {
+        configs[i]->setPageSize (page_size);
+        configs[i]->setEmojiCandidate (!no_emoji);
+        configs[i]->setCoalesceKeys (coalesce);
+        configs[i]->setAsyncCandidates (async);
+        configs[i]->setInitSimpChinese (!traditional);
+    }
+
+    PinyinProperties pinyin_props (pinyin_config);
+    PinyinProperties bopomofo_props (bopomofo_config);
+
+    if (NULL == mode || 0 == g_strcmp0 (mode, "full")) {
+        EditorPtr editor (new FullPinyinEditor (pinyin_props, pinyin_config));
+        replay ("full-pinyin", TRACE_MODE_FULL_PINYIN, editor,
+                sequences, iterations);
+    } else if (0 == g_strcmp0 (mode, "double")) {
+        pinyin_config.setDoublePinyin (TRUE);
+        EditorPtr editor (new DoublePinyinEditor (pinyin_props, pinyin_config));
+        replay ("double-pinyin", TRACE_MODE_DOUBLE_PINYIN, editor,
+                sequences, iterations);
+    } else if (0 == g_strcmp0 (mode, "bopomofo")) {
+        EditorPtr editor (new BopomofoEditor (bopomofo_props, bopomofo_config));
+        replay ("bopomofo", TRACE_MODE_BOPOMOFO, editor,
+                sequences, iterations);
+    } else {
+        g_printerr ("unknown mode: %s\n", mode);
+        exit (EXIT_FAILURE);
+    }
+
+    struct rusage usage;
+    getrusage (RUSAGE_SELF, &usage);
+    g_print ("peak rss: %ld KiB\n", usage.ru_maxrss);
+
+    KeyTrace::finalize ();
+    LibPinyinBackEnd::finalize ();
+
+    if (tmpdir) {
+        remove_directory (tmpdir);
+        g_free (tmpdir);
+    }
+
+    return 0;
+}
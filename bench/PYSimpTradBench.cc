@@ -0,0 +1,248 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Converts a corpus with SimpTradConverter and with the binary search
+ * over simp_to_trad which it used before the trie, and compares them.
+ *
+ * Each line of a corpus file is converted as one string, without corpus
+ * files the keys of simp_to_trad are used as the corpus.
+ */
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include <glib.h>
+#include "PYConfig.h"
+#include "PYString.h"
+#include "PYSimpTradConverter.h"
+#include "PYPTrace.h"
+
+using namespace PY;
+
+#include "PYSimpTradConverterTable.h"
+
+/* a Config which never touches GSettings. */
+class BenchConfig : public Config {
+public:
+    BenchConfig (const std::string & name) : Config (name) { }
+};
+
+static gint
+_xcmp (const gchar *p1, const gchar *p2, const gchar *str)
+{
+    for (;;) {
+        // both reach end
+        if (p1 == p2 && *str == '\0')
+            return 0;
+        // p1 reaches end
+        if (p1 == p2)
+            return -1;
+        // str reaches end
+        if (*str == '\0')
+            return 1;
+
+        if (*p1 < *str)
+            return -1;
+        if (*p1 > *str)
+            return 1;
+
+        p1 ++; str ++;
+    };
+}
+
+static gint
+_cmp (gconstpointer p1, gconstpointer p2)
+{
+    const gchar **pp = (const gchar **) p1;
+    const gchar **s2 = (const gchar **) p2;
+
+    return _xcmp (pp[0], pp[1], s2[0]);
+}
+
+/* the binary search path of SimpTradConverter before the trie. */
+static void
+bsearch_simp_to_trad (const gchar *in, String &out)
+{
+    const gchar *pend;
+    const gchar *pp[2];
+    glong len;
+    glong begin;
+
+    begin = 0;
+    pend = in + strlen (in);
+    len = g_utf8_strlen (in, -1);
+    pp[0] = in;
+
+    while (pp[0] != pend) {
+        glong slen  = std::min (len - begin, (glong) SIMP_TO_TRAD_MAX_LEN);
+        pp[1] = g_utf8_offset_to_pointer (pp[0], slen);
+
+        for (;;) {
+            const gchar **result;
+            result = (const gchar **) bsearch (pp, simp_to_trad,
+                                               G_N_ELEMENTS (simp_to_trad),
+                                               sizeof (simp_to_trad[0]),
+                                               _cmp);
+
+            if (result != NULL) {
+                out << result[1];
+                pp[0] = pp[1];
+                begin += slen;
+                break;
+            }
+
+            if (slen == 1) {
+                out.append (pp[0], pp[1] - pp[0]);
+                pp[0] = pp[1];
+                begin += 1;
+                break;
+            }
+
+            pp[1] = g_utf8_prev_char (pp[1]);
+            slen--;
+        }
+    }
+}
+
+static gboolean
+load_corpus (const gchar *filename, std::vector<String> & lines)
+{
+    gchar *contents = NULL;
+    GError *error = NULL;
+
+    if (!g_file_get_contents (filename, &contents, NULL, &error)) {
+        g_printerr ("%s\n", error->message);
+        g_error_free (error);
+        return FALSE;
+    }
+
+    if (!g_utf8_validate (contents, -1, NULL)) {
+        g_printerr ("%s is not an utf8 file.\n", filename);
+        g_free (contents);
+        return FALSE;
+    }
+
+    gchar **strv = g_strsplit (contents, "\n", -1);
+    g_free (contents);
+
+    for (gchar **line = strv; *line; ++line) {
+        if ('\0' != **line)
+            lines.push_back (*line);
+    }
+
+    g_strfreev (strv);
+    return TRUE;
+}
+
+/* options */
+static gint iterations = 10;
+
+static const GOptionEntry entries[] =
+{
+    { "iterations", 'n', 0, G_OPTION_ARG_INT, &iterations,
+      "convert the corpus N times", "N" },
+    { NULL },
+};
+
+int
+main (gint argc, gchar **argv)
+{
+    GError *error = NULL;
+    GOptionContext *context;
+
+    context = g_option_context_new ("[CORPUS...] - benchmark the simplified to traditional conversion");
+    g_option_context_add_main_entries (context, entries, NULL);
+
+    if (!g_option_context_parse (context, &argc, &argv, &error)) {
+        g_printerr ("Option parsing failed: %s\n", error->message);
+        exit (EXIT_FAILURE);
+    }
+    g_option_context_free (context);
+
+    std::vector<String> lines;
+    for (gint i = 1; i < argc; ++i) {
+        if (!load_corpus (argv[i], lines))
+            exit (EXIT_FAILURE);
+    }
+
+    if (lines.empty ()) {
+        for (guint i = 0; i < G_N_ELEMENTS (simp_to_trad); ++i)
+            lines.push_back (simp_to_trad[i][0]);
+    }
+
+    guint64 bytes = 0;
+    for (guint i = 0; i < lines.size (); ++i)
+        bytes += lines[i].length ();
+
+    BenchConfig config ("libpinyin");
+    SimpTradConverter converter (config);
+
+    String trie_out;
+    String bsearch_out;
+    guint64 trie_nsec = 0;
+    guint64 bsearch_nsec = 0;
+    guint mismatches = 0;
+
+    for (gint n = 0; n < iterations; ++n) {
+        for (guint i = 0; i < lines.size (); ++i) {
+            trie_out.truncate (0);
+            bsearch_out.truncate (0);
+
+            guint64 start = KeyTrace::now ();
+            converter.simpToTrad (lines[i], trie_out);
+            guint64 middle = KeyTrace::now ();
+            bsearch_simp_to_trad (lines[i], bsearch_out);
+            guint64 end = KeyTrace::now ();
+
+            trie_nsec += middle - start;
+            bsearch_nsec += end - middle;
+
+            if (0 == n && trie_out != bsearch_out) {
+                if (mismatches < 10)
+                    g_printerr ("mismatch: %s => %s, %s\n",
+                                lines[i].c_str (), trie_out.c_str (),
+                                bsearch_out.c_str ());
+                mismatches ++;
+            }
+        }
+    }
+
+    gdouble megabytes = bytes * iterations / (1024.0 * 1024.0);
+    g_print ("%zu lines, %.1f MiB converted %d times\n",
+             lines.size (), bytes / (1024.0 * 1024.0), iterations);
+    g_print ("  converter: %.3f s, %.1f MiB/s\n",
+             trie_nsec / 1e9, megabytes / (trie_nsec / 1e9));
+    g_print ("  bsearch:   %.3f s, %.1f MiB/s\n",
+             bsearch_nsec / 1e9, megabytes / (bsearch_nsec / 1e9));
+    g_print ("  mismatched lines: %u\n", mismatches);
+
+#ifdef HAVE_OPENCC
+    /* opencc uses its own dictionaries. */
+    return EXIT_SUCCESS;
+#else
+    return mismatches ? EXIT_FAILURE : EXIT_SUCCESS;
+#endif
+}
@@ -38,6 +38,7 @@ void print_interactive_help(){
   printf("g [TRIGGER_STRING] \t\t - tests a trigger string, fire trigger if hit.\n");
   printf("c \t\t\t - lists all converters.\n");
   printf("c [FUNCTION] [STRING] \t tests a converter function. \n");
+  printf("s \t\t\t - lists the call statistics of lua functions.\n");
   printf("quit \t\t\t - quit the shell.\n");
   printf("help \t\t\t - show this message.\n");
 }
@@ -63,6 +64,18 @@ void list_all_converters(IBusEnginePlugin * plugin){
   printf("\n");
 }
 
+void list_function_stats(IBusEnginePlugin * plugin){
+  const GArray * stats = ibus_engine_plugin_get_function_stats(plugin);
+  size_t i;
+  for ( i = 0; i < stats->len; ++i ){
+    lua_function_stat_t * stat = &g_array_index(stats, lua_function_stat_t, i);
+    printf("%s: %u calls, %.3f ms total, %.3f ms max, %u timeouts.\n",
+           stat->lua_function_name, stat->calls,
+           stat->total_usec / 1000.0, stat->max_usec / 1000.0,
+           stat->timeouts);
+  }
+}
+
 int print_lua_call_result(IBusEnginePlugin * plugin, size_t num){
   if ( 1 == num ) {
     const lua_command_candidate_t * result = ibus_engine_plugin_get_retval(plugin);
@@ -103,6 +116,10 @@ int do_lua_call(IBusEnginePlugin * plugin, const char * command_name, const char
 
 int do_simple_lua_call(IBusEnginePlugin * plugin, const char * lua_function_name, const char * string){
   int num = ibus_engine_plugin_call(plugin, lua_function_name, string);
+  if ( 0 == num ){
+    printf("no result.\n");
+    return 1;
+  }
   printf("result: %s.\n", ibus_engine_plugin_get_first_result(plugin));
   return 0;
 }
@@ -146,6 +163,8 @@ int main(int argc, char * argv[]){
         list_all_commands(plugin);
       if ( 0 == strcmp("c", strs[0]) )
         list_all_converters(plugin);
+      if ( 0 == strcmp("s", strs[0]) )
+        list_function_stats(plugin);
       break;
     case 2:
       if ( 0 == strcmp("i", strs[0]))
@@ -302,6 +302,7 @@ static int ime_register_converter(lua_State * L){
   lua_pop(L, 1);
 
   new_converter.description = luaL_checklstring(L, 2, NULL);
+  new_converter.batch = lua_toboolean(L, 3);
 
   gboolean result = ibus_engine_plugin_add_converter
     (lua_plugin_retrieve_plugin(L), &new_converter);
@@ -35,14 +35,40 @@
 
 #endif
 
+/* a glob pattern compiled when its trigger is added. */
+typedef struct _lua_trigger_glob_t{
+  guint trigger_index;
+  GPatternSpec * pattern;
+} lua_trigger_glob_t;
+
+/* the trigger strings of one kind, the exact strings are hashed to
+   the first trigger with them, and the globs are in trigger order. */
+typedef struct _lua_trigger_matcher_t{
+  GHashTable * exact_strings;
+  GArray * glob_patterns; /* Array of lua_trigger_glob_t. */
+} lua_trigger_matcher_t;
+
 struct _IBusEnginePluginPrivate{
   lua_State * L;
   GArray * lua_commands; /* Array of lua_command_t. */
   GArray * lua_triggers; /* Array of lua_trigger_t. */
+  lua_trigger_matcher_t input_matcher;
+  lua_trigger_matcher_t candidate_matcher;
   GArray * lua_converters; /* Array of lua_converter_t. */
   gchar * use_converter;
+
+  guint call_budget; /* in milliseconds. */
+  gint64 call_deadline;
+  gboolean call_timeout;
+  GArray * function_stats; /* Array of lua_function_stat_t. */
+  GHashTable * function_stat_index; /* lua function name to index + 1. */
 };
 
+/* the watchdog checks the clock once per these lua instructions. */
+#define LUA_PLUGIN_WATCHDOG_COUNT 10000
+/* how long a function exceeding the time budget is disabled. */
+#define LUA_PLUGIN_DISABLE_USEC (60 * G_USEC_PER_SEC)
+
 G_DEFINE_TYPE_WITH_CODE (IBusEnginePlugin, ibus_engine_plugin, G_TYPE_OBJECT, G_ADD_PRIVATE (IBusEnginePlugin));
 
 #define IBUS_ENGINE_PLUGIN_GET_PRIVATE(obj) (ibus_engine_plugin_get_instance_private (obj))
@@ -77,9 +103,75 @@ static void lua_trigger_reclaim(lua_trigger_t * trigger){
   g_strfreev((gchar **)trigger->candidate_trigger_strings);
 }
 
+static void lua_trigger_matcher_init(lua_trigger_matcher_t * matcher){
+  /* the keys are owned by the trigger strings of lua_triggers. */
+  matcher->exact_strings = g_hash_table_new(g_str_hash, g_str_equal);
+  matcher->glob_patterns = g_array_new(FALSE, FALSE, sizeof(lua_trigger_glob_t));
+}
+
+static void lua_trigger_matcher_fini(lua_trigger_matcher_t * matcher){
+  size_t i;
+
+  if ( matcher->glob_patterns ){
+    for ( i = 0; i < matcher->glob_patterns->len; ++i){
+      lua_trigger_glob_t * glob = &g_array_index(matcher->glob_patterns, lua_trigger_glob_t, i);
+      g_pattern_spec_free(glob->pattern);
+    }
+    g_array_free(matcher->glob_patterns, TRUE);
+    matcher->glob_patterns = NULL;
+  }
+
+  if ( matcher->exact_strings ){
+    g_hash_table_destroy(matcher->exact_strings);
+    matcher->exact_strings = NULL;
+  }
+}
+
+static void lua_trigger_matcher_add(lua_trigger_matcher_t * matcher, gchar ** patterns, guint trigger_index){
+  gchar ** pattern;
+
+  if ( NULL == patterns )
+    return;
+
+  for (pattern = patterns; *pattern != NULL; ++pattern){
+    /* g_pattern_match_simple only knows '*' and '?'. */
+    if ( NULL == strpbrk(*pattern, "*?") ){
+      /* the first registered trigger wins. */
+      if ( !g_hash_table_contains(matcher->exact_strings, *pattern) )
+        g_hash_table_insert(matcher->exact_strings, *pattern,
+                            GUINT_TO_POINTER(trigger_index + 1));
+      continue;
+    }
+
+    lua_trigger_glob_t glob;
+    glob.trigger_index = trigger_index;
+    glob.pattern = g_pattern_spec_new(*pattern);
+    g_array_append_val(matcher->glob_patterns, glob);
+  }
+}
+
+/* returns the index of the first trigger matching the string, or -1. */
+static gint lua_trigger_matcher_lookup(lua_trigger_matcher_t * matcher, const char * string){
+  guint found = GPOINTER_TO_UINT(g_hash_table_lookup(matcher->exact_strings, string));
+  /* the exact match if any, unless an earlier trigger has a glob. */
+  guint last = found ? found - 1 : G_MAXUINT;
+  size_t i;
+
+  for ( i = 0; i < matcher->glob_patterns->len; ++i){
+    lua_trigger_glob_t * glob = &g_array_index(matcher->glob_patterns, lua_trigger_glob_t, i);
+    if ( glob->trigger_index >= last )
+      break;
+    if ( g_pattern_match_string(glob->pattern, string) )
+      return glob->trigger_index;
+  }
+
+  return G_MAXUINT == last ? -1 : (gint) last;
+}
+
 static void lua_converter_clone(lua_converter_t * converter, lua_converter_t * new_converter){
   new_converter->lua_function_name = g_strdup(converter->lua_function_name);
   new_converter->description = g_strdup(converter->description);
+  new_converter->batch = converter->batch;
 }
 
 static void lua_converter_reclaim(lua_converter_t * converter){
@@ -101,11 +193,18 @@ lua_plugin_init(IBusEnginePluginPrivate * plugin){
 
   g_assert ( NULL == plugin->lua_triggers );
   plugin->lua_triggers = g_array_new(TRUE, TRUE, sizeof(lua_trigger_t));
+  lua_trigger_matcher_init(&plugin->input_matcher);
+  lua_trigger_matcher_init(&plugin->candidate_matcher);
 
   g_assert ( NULL == plugin->lua_converters );
   plugin->lua_converters = g_array_new(TRUE, TRUE, sizeof(lua_converter_t));
   plugin->use_converter = NULL;
 
+  plugin->call_budget = 100;
+  g_assert ( NULL == plugin->function_stats );
+  plugin->function_stats = g_array_new(FALSE, TRUE, sizeof(lua_function_stat_t));
+  plugin->function_stat_index = g_hash_table_new(g_str_hash, g_str_equal);
+
   return 0;
 }
 
@@ -125,6 +224,9 @@ lua_plugin_fini(IBusEnginePluginPrivate * plugin){
     plugin->lua_commands = NULL;
   }
 
+  lua_trigger_matcher_fini(&plugin->input_matcher);
+  lua_trigger_matcher_fini(&plugin->candidate_matcher);
+
   if ( plugin->lua_triggers ){
     for ( i = 0; i < plugin->lua_triggers->len; ++i){
       trigger = &g_array_index(plugin->lua_triggers, lua_trigger_t, i);
@@ -143,6 +245,17 @@ lua_plugin_fini(IBusEnginePluginPrivate * plugin){
     plugin->lua_converters = NULL;
   }
 
+  if ( plugin->function_stats ){
+    g_hash_table_destroy(plugin->function_stat_index);
+    plugin->function_stat_index = NULL;
+    for ( i = 0; i < plugin->function_stats->len; ++i){
+      lua_function_stat_t * stat = &g_array_index(plugin->function_stats, lua_function_stat_t, i);
+      g_free((gpointer)stat->lua_function_name);
+    }
+    g_array_free(plugin->function_stats, TRUE);
+    plugin->function_stats = NULL;
+  }
+
   lua_close(plugin->L);
   plugin->L = NULL;
 
@@ -202,18 +315,140 @@ static void l_message (const char *pname, const char *msg) {
 }
 
 static int report (lua_State *L, int status) {
-  if (status && !lua_isnil(L, -1)) {
-    const char *msg = lua_tostring(L, -1);
-    if (msg == NULL) msg = "(error object is not a string)";
-    l_message(NULL, msg);
+  if (status) {
+    /* a nil error object fails quietly. */
+    if (!lua_isnil(L, -1)) {
+      const char *msg = lua_tostring(L, -1);
+      if (msg == NULL) msg = "(error object is not a string)";
+      l_message(NULL, msg);
+    }
     lua_pop(L, 1);
   }
   return status;
 }
 
+/* the header of a bytecode cache file, followed by the lua_dump output. */
+typedef struct _lua_bytecode_header_t{
+  char magic[8];
+  gint64 lua_version;
+  gint64 size;
+  char source_sha1[48]; /* of the script contents. */
+} lua_bytecode_header_t;
+
+static void lua_bytecode_header_init(lua_bytecode_header_t * header, const gchar * source, gsize size){
+  memset(header, 0, sizeof(lua_bytecode_header_t));
+  memcpy(header->magic, "PYLUAC", 6);
+  header->lua_version = LUA_VERSION_NUM;
+  header->size = size;
+
+  gchar * checksum = g_compute_checksum_for_data(G_CHECKSUM_SHA1, (const guchar *) source, size);
+  g_strlcpy(header->source_sha1, checksum, sizeof(header->source_sha1));
+  g_free(checksum);
+}
+
+/* the cache file is named after the absolute path of the script. */
+static gchar * lua_bytecode_cache_path(const char * filename){
+  gchar * absolute = NULL;
+  if ( g_path_is_absolute(filename) ){
+    absolute = g_strdup(filename);
+  } else {
+    gchar * cwd = g_get_current_dir();
+    absolute = g_build_filename(cwd, filename, NULL);
+    g_free(cwd);
+  }
+
+  gchar * checksum = g_compute_checksum_for_string(G_CHECKSUM_SHA1, absolute, -1);
+  gchar * name = g_strconcat(checksum, ".luac", NULL);
+  gchar * path = g_build_filename(g_get_user_cache_dir(),
+                                  "ibus", "libpinyin", name, NULL);
+
+  g_free(name);
+  g_free(checksum);
+  g_free(absolute);
+  return path;
+}
+
+static int lua_bytecode_writer(lua_State * L, const void * p, size_t sz, void * ud){
+  g_string_append_len((GString *) ud, p, sz);
+  return 0;
+}
+
+/**
+ * like luaL_loadfile, but loads the bytecode cached for the script
+ * when its contents and the lua version are unchanged,
+ * and otherwise refreshes the cache from the source.
+ */
+static int lua_plugin_load_file(lua_State * L, const char * filename){
+  gchar * source = NULL;
+  gsize size = 0;
+  lua_bytecode_header_t header;
+  int status;
+
+  /* hashing the contents is cheaper than parsing them,
+     and unlike the mtime it sees every edit. */
+  if ( !g_file_get_contents(filename, &source, &size, NULL) )
+    return luaL_loadfile(L, filename);
+
+  lua_bytecode_header_init(&header, source, size);
+  g_free(source);
+  gchar * cache = lua_bytecode_cache_path(filename);
+
+  GMappedFile * mapped = g_mapped_file_new(cache, FALSE, NULL);
+  if ( mapped ){
+    const gchar * contents = g_mapped_file_get_contents(mapped);
+    gsize length = g_mapped_file_get_length(mapped);
+
+    if ( length > sizeof(header) &&
+         0 == memcmp(contents, &header, sizeof(header)) ){
+      gchar * chunkname = g_strconcat("@", filename, NULL);
+      status = luaL_loadbuffer(L, contents + sizeof(header),
+                               length - sizeof(header), chunkname);
+      g_free(chunkname);
+
+      if ( 0 == status ){
+        g_mapped_file_unref(mapped);
+        g_free(cache);
+        return status;
+      }
+
+      /* fall back to the source. */
+      lua_pop(L, 1);
+    }
+
+    g_mapped_file_unref(mapped);
+  }
+
+  status = luaL_loadfile(L, filename);
+  if ( status ){
+    g_free(cache);
+    return status;
+  }
+
+  GString * bytecode = g_string_new_len((const gchar *) &header, sizeof(header));
+#if LUA_VERSION_NUM >= 503
+  status = lua_dump(L, lua_bytecode_writer, bytecode, 0);
+#else
+  status = lua_dump(L, lua_bytecode_writer, bytecode);
+#endif
+
+  if ( 0 == status ){
+    gchar * dirname = g_path_get_dirname(cache);
+    g_mkdir_with_parents(dirname, 0700);
+    /* written to a temporary file and renamed. */
+    g_file_set_contents(cache, bytecode->str, bytecode->len, NULL);
+    g_free(dirname);
+  }
+
+  g_string_free(bytecode, TRUE);
+  g_free(cache);
+  return 0;
+}
+
 int ibus_engine_plugin_load_lua_script(IBusEnginePlugin * plugin, const char * filename){
   IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
-  int status = luaL_dofile(priv->L, filename);
+  int status = lua_plugin_load_file(priv->L, filename);
+  if ( 0 == status )
+    status = lua_pcall(priv->L, 0, LUA_MULTRET, 0);
   return report(priv->L, status);
 }
 
@@ -264,6 +499,14 @@ gboolean ibus_engine_plugin_add_trigger(IBusEnginePlugin * plugin, lua_trigger_t
 
   g_array_append_val(lua_triggers, new_trigger);
 
+  /* compile the trigger strings once instead of on every match. */
+  lua_trigger_matcher_add(&priv->input_matcher,
+                          new_trigger.input_trigger_strings,
+                          lua_triggers->len - 1);
+  lua_trigger_matcher_add(&priv->candidate_matcher,
+                          new_trigger.candidate_trigger_strings,
+                          lua_triggers->len - 1);
+
   return TRUE;
 }
 
@@ -276,38 +519,26 @@ gboolean ibus_engine_plugin_match_input(IBusEnginePlugin * plugin, const char *
   IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
   GArray * lua_triggers = priv->lua_triggers;
 
-  gint i; gchar ** pattern;
-  for (i = 0; i < lua_triggers->len; ++i){
-    lua_trigger_t * trigger = &g_array_index(lua_triggers, lua_trigger_t, i);
-
-    for (pattern = trigger->input_trigger_strings; *pattern != NULL; ++pattern){
-      if (g_pattern_match_simple(*pattern, input)){
-        *lua_function_name = trigger->lua_function_name;
-        return TRUE;
-      }
-    }
-  }
+  gint index = lua_trigger_matcher_lookup(&priv->input_matcher, input);
+  if ( index < 0 )
+    return FALSE;
 
-  return FALSE;
+  lua_trigger_t * trigger = &g_array_index(lua_triggers, lua_trigger_t, index);
+  *lua_function_name = trigger->lua_function_name;
+  return TRUE;
 }
 
 gboolean ibus_engine_plugin_match_candidate(IBusEnginePlugin * plugin, const char * candidate, const char ** lua_function_name){
   IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
   GArray * lua_triggers = priv->lua_triggers;
 
-  gint i; gchar ** pattern;
-  for (i = 0; i < lua_triggers->len; ++i){
-    lua_trigger_t * trigger = &g_array_index(lua_triggers, lua_trigger_t, i);
-
-    for (pattern = trigger->candidate_trigger_strings; *pattern != NULL; ++pattern){
-      if (g_pattern_match_simple(*pattern, candidate)){
-        *lua_function_name = trigger->lua_function_name;
-        return TRUE;
-      }
-    }
-  }
+  gint index = lua_trigger_matcher_lookup(&priv->candidate_matcher, candidate);
+  if ( index < 0 )
+    return FALSE;
 
-  return FALSE;
+  lua_trigger_t * trigger = &g_array_index(lua_triggers, lua_trigger_t, index);
+  *lua_function_name = trigger->lua_function_name;
+  return TRUE;
 }
 
 gboolean ibus_engine_plugin_add_converter(IBusEnginePlugin * plugin, lua_converter_t * converter){
@@ -350,6 +581,91 @@ const char * ibus_engine_plugin_get_converter(IBusEnginePlugin * plugin){
   return priv->use_converter;  
 }
 
+void ibus_engine_plugin_set_call_budget(IBusEnginePlugin * plugin, guint msec){
+  IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
+  priv->call_budget = msec;
+}
+
+const GArray * ibus_engine_plugin_get_function_stats(IBusEnginePlugin * plugin){
+  IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
+  return priv->function_stats;
+}
+
+static lua_function_stat_t * lua_plugin_lookup_stat(IBusEnginePluginPrivate * priv, const char * lua_function_name){
+  guint index = GPOINTER_TO_UINT(g_hash_table_lookup(priv->function_stat_index, lua_function_name));
+
+  if ( 0 == index ){
+    lua_function_stat_t stat;
+    memset(&stat, 0, sizeof(stat));
+    stat.lua_function_name = g_strdup(lua_function_name);
+    g_array_append_val(priv->function_stats, stat);
+
+    index = priv->function_stats->len;
+    g_hash_table_insert(priv->function_stat_index,
+                        (gpointer)stat.lua_function_name,
+                        GUINT_TO_POINTER(index));
+  }
+
+  return &g_array_index(priv->function_stats, lua_function_stat_t, index - 1);
+}
+
+static void lua_plugin_watchdog(lua_State * L, lua_Debug * ar){
+  IBusEnginePlugin * plugin = lua_plugin_retrieve_plugin(L);
+  IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
+
+  if ( g_get_monotonic_time() > priv->call_deadline ){
+    priv->call_timeout = TRUE;
+    luaL_error(L, "lua call exceeds the time budget of %d ms.", priv->call_budget);
+  }
+}
+
+/**
+ * lua_pcall under the time budget, which also counts the call.
+ * a disabled function is not called and fails with a nil error object,
+ * the warning is only logged when it is disabled.
+ */
+static int lua_plugin_pcall(IBusEnginePluginPrivate * priv, const char * lua_function_name, int nargs, int nresults){
+  lua_State * L = priv->L;
+  lua_function_stat_t * stat = lua_plugin_lookup_stat(priv, lua_function_name);
+  gint64 start = g_get_monotonic_time();
+  int result;
+
+  if ( stat->disabled_until > start ){
+    lua_pop(L, nargs + 1);
+    lua_pushnil(L);
+    return LUA_ERRRUN;
+  }
+
+  if ( priv->call_budget ){
+    priv->call_deadline = start + priv->call_budget * (gint64) 1000;
+    priv->call_timeout = FALSE;
+    lua_sethook(L, lua_plugin_watchdog, LUA_MASKCOUNT, LUA_PLUGIN_WATCHDOG_COUNT);
+  }
+
+  result = lua_pcall(L, nargs, nresults, 0);
+
+  if ( priv->call_budget )
+    lua_sethook(L, NULL, 0, 0);
+
+  gint64 end = g_get_monotonic_time();
+  guint64 elapsed = end - start;
+
+  stat->calls ++;
+  stat->total_usec += elapsed;
+  if ( elapsed > stat->max_usec )
+    stat->max_usec = elapsed;
+
+  if ( result && priv->call_timeout ){
+    priv->call_timeout = FALSE;
+    stat->timeouts ++;
+    stat->disabled_until = end + LUA_PLUGIN_DISABLE_USEC;
+    g_warning("lua function %s exceeds the time budget, disabled for %d seconds.",
+              lua_function_name, (int) (LUA_PLUGIN_DISABLE_USEC / G_USEC_PER_SEC));
+  }
+
+  return result;
+}
+
 int ibus_engine_plugin_call(IBusEnginePlugin * plugin, const char * lua_function_name, const char * argument /*optional, maybe NULL.*/){
   IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
   int type; int result;
@@ -363,23 +679,115 @@ int ibus_engine_plugin_call(IBusEnginePlugin * plugin, const char * lua_function
   /* check whether lua_function_name exists. */
   lua_getglobal(L, lua_function_name);
   type = lua_type(L, -1);
-  if ( LUA_TFUNCTION != type )
+  if ( LUA_TFUNCTION != type ){
+    lua_pop(L, 1);
     return 0;
+  }
   lua_pushstring(L, argument);
 
-  result = lua_pcall(L, 1, 1, 0);
-  if (result) return 0;
+  result = lua_plugin_pcall(priv, lua_function_name, 1, 1);
+  if (result){
+    report(L, result);
+    return 0;
+  }
 
+  /* no result is left on the stack when returning 0. */
   type = lua_type(L, -1);
   if ( LUA_TTABLE == type ){
-    return lua_objlen(L, -1);
+    result = lua_objlen(L, -1);
+    if ( 0 == result )
+      lua_pop(L, 1);
+    return result;
   } else if (LUA_TNUMBER == type || LUA_TBOOLEAN == type || LUA_TSTRING == type){
     return 1;
   }
 
+  lua_pop(L, 1);
   return 0;
 }
 
+/**
+ * calls the converter of upvalue 1 on each string of the table,
+ * and returns the table of the results.
+ */
+static int lua_plugin_convert_each(lua_State * L){
+  int i; int len = lua_objlen(L, 1);
+
+  lua_createtable(L, len, 0);
+  for ( i = 1; i <= len; ++i){
+    lua_pushvalue(L, lua_upvalueindex(1));
+    lua_rawgeti(L, 1, i);
+    lua_call(L, 1, 1);
+    lua_rawseti(L, 2, i);
+  }
+
+  return 1;
+}
+
+gboolean ibus_engine_plugin_convert(IBusEnginePlugin * plugin, const char ** arguments, int len, gchar ** results){
+  IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
+  GArray * lua_converters = priv->lua_converters;
+  lua_converter_t * converter = NULL;
+  lua_State * L = priv->L;
+  int i; int type;
+
+  memset(results, 0, len * sizeof(gchar *));
+
+  gint j;
+  for (j = 0; j < lua_converters->len; ++j) {
+    lua_converter_t * item = &g_array_index
+      (lua_converters, lua_converter_t, j);
+    if (g_strcmp0 (item->lua_function_name, priv->use_converter) == 0) {
+      converter = item;
+      break;
+    }
+  }
+
+  if ( NULL == converter )
+    return FALSE;
+
+  lua_getglobal(L, converter->lua_function_name);
+  if ( LUA_TFUNCTION != lua_type(L, -1) ){
+    lua_pop(L, 1);
+    return FALSE;
+  }
+
+  if ( !converter->batch )
+    lua_pushcclosure(L, lua_plugin_convert_each, 1);
+
+  lua_createtable(L, len, 0);
+  for ( i = 0; i < len; ++i){
+    lua_pushstring(L, arguments[i] ? arguments[i] : "");
+    lua_rawseti(L, -2, i + 1);
+  }
+
+  if ( lua_plugin_pcall(priv, converter->lua_function_name, 1, 1) ){
+    report(L, LUA_ERRRUN);
+    return FALSE;
+  }
+
+  if ( LUA_TTABLE != lua_type(L, -1) ){
+    lua_pop(L, 1);
+    return FALSE;
+  }
+
+  for ( i = 0; i < len; ++i){
+    lua_rawgeti(L, -1, i + 1);
+    /* like ibus_engine_plugin_get_first_result. */
+    if ( LUA_TTABLE == lua_type(L, -1) ){
+      lua_rawgeti(L, -1, 1);
+      lua_remove(L, -2);
+    }
+    type = lua_type(L, -1);
+    if ( LUA_TNUMBER == type || LUA_TBOOLEAN == type || LUA_TSTRING == type )
+      results[i] = g_strdup(lua_tostring(L, -1));
+    lua_pop(L, 1);
+  }
+
+  lua_pop(L, 1);
+  return TRUE;
+}
+
 /**
  * get a candidate from lua return value.
  */
@@ -62,8 +62,18 @@ typedef struct _lua_trigger_t{
 typedef struct _lua_converter_t{
   const char * lua_function_name;
   const char * description;
+  gboolean batch; /* optional, takes and returns a table of strings. */
 } lua_converter_t;
 
+typedef struct _lua_function_stat_t{
+  const char * lua_function_name;
+  guint calls;
+  guint timeouts; /* calls aborted by the time budget. */
+  guint64 total_usec;
+  guint64 max_usec;
+  gint64 disabled_until; /* g_get_monotonic_time, 0 when never disabled. */
+} lua_function_stat_t;
+
 /*
  * Type macros.
  */
@@ -81,6 +91,7 @@ typedef struct _IBusEnginePluginPrivate IBusEnginePluginPrivate;
 
 void lua_plugin_openlibs (lua_State *L);
 void lua_plugin_store_plugin(lua_State * L, IBusEnginePlugin * plugin);
+IBusEnginePlugin * lua_plugin_retrieve_plugin(lua_State * L);
 
 struct _IBusEnginePlugin
 {
@@ -160,6 +171,25 @@ gboolean ibus_engine_plugin_set_converter(IBusEnginePlugin * plugin, const char
  */
 const char * ibus_engine_plugin_get_converter(IBusEnginePlugin * plugin);
 
+/**
+ * convert the arguments with the current converter in one lua call,
+ * a converter without batch is called for each argument inside it.
+ * results[i] is the copied string of arguments[i], or NULL.
+ */
+gboolean ibus_engine_plugin_convert(IBusEnginePlugin * plugin, const char ** arguments, int len, gchar ** results);
+
+/**
+ * set the time budget of one lua call in milliseconds, 0 for no limit.
+ * a function exceeding it is aborted and disabled for a while.
+ */
+void ibus_engine_plugin_set_call_budget(IBusEnginePlugin * plugin, guint msec);
+
+/**
+ * retrieve the statistics of the called lua functions.
+ * return array of lua_function_stat_t without copies.
+ */
+const GArray * ibus_engine_plugin_get_function_stats(IBusEnginePlugin * plugin);
+
 /**
  * Lookup a special command in ime lua extension.
  * command must be an 2-char long string.
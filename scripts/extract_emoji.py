@@ -1,6 +1,7 @@
 #!/usr/bin/python3
 import os
 import operator
+from collections import deque
 from argparse import ArgumentParser
 
 import xml.etree.ElementTree as ET
@@ -23,10 +24,11 @@ def load_emoji(filename):
         for word in annotation.text.split('|'):
             word = word.strip()
 
-            # only keep the first encountered emoji
-            if not word in emojis:
+            # keep all emojis in the encountered order
+            values = emojis.setdefault(word, [])
+            if not annotation.get('cp') in values:
                 # print(annotation.get('cp'))
-                emojis[word] = annotation.get('cp')
+                values.append(annotation.get('cp'))
 
     return emojis
 
@@ -95,21 +97,192 @@ def prepare_emojis():
     chs_emojis = sorted(chs_emojis, key=compare)
 
 
-def gen_english_emojis():
+# the hash function of lookup_emoji in PYPEmojiCandidates.cc,
+# fnv-1a finished with the fmix32 of murmurhash3.
+
+def emoji_hash(data, seed):
+    mask = 0xffffffff
+    h = 2166136261 ^ seed
+    for b in data:
+        h ^= b
+        h = (h * 16777619) & mask
+    h ^= h >> 16
+    h = (h * 0x85ebca6b) & mask
+    h ^= h >> 13
+    h = (h * 0xc2b2ae35) & mask
+    h ^= h >> 16
+    return h
+
+# hash and displace, a keyword goes to the bucket of seed 0, and
+# each bucket has the seed which moves its keywords to free slots.
+
+def build_perfect_hash(keys):
+    size = len(keys)
+    buckets = [[] for i in range((size + 3) // 4)]
+    for key in keys:
+        buckets[emoji_hash(key, 0) % len(buckets)].append(key)
+
+    seeds = [0] * len(buckets)
+    slots = [None] * size
+    order = sorted(range(len(buckets)), key=lambda b: -len(buckets[b]))
+    for bucket in order:
+        if not buckets[bucket]:
+            break
+        seed = 1
+        while True:
+            positions = [emoji_hash(key, seed) % size for key in buckets[bucket]]
+            if len(set(positions)) == len(positions) and \
+               all(slots[pos] is None for pos in positions):
+                break
+            seed += 1
+        seeds[bucket] = seed
+        for key, pos in zip(buckets[bucket], positions):
+            slots[pos] = key
+
+    return seeds, slots
+
+def escape_string(string):
+    return string.replace('\\', '\\\\').replace('"', '\\"')
+
+# a double-array trie over the English keywords, each node keeps the
+# first emojis of the keywords below it, shorter keywords go first.
+
+EMOJI_TRIE_TOP = 3
+
+def build_emoji_trie(emojis, offsets):
+    # node: [children dict, top emojis]
+    root = [{}, []]
+    for key in sorted(emojis.keys(), key=lambda key: (len(key), key)):
+        node = root
+        nodes = [root]
+        for byte in key:
+            node = node[0].setdefault(byte, [{}, []])
+            nodes.append(node)
+        for node in nodes:
+            for value, offset in zip(emojis[key], offsets[key]):
+                if len(node[1]) >= EMOJI_TRIE_TOP:
+                    break
+                if value not in [top[0] for top in node[1]]:
+                    node[1].append((value, offset))
+
+    # cell: [base, check, top], a free cell has check -1.
+    cells = [[0, -1, []]]
+    used = bytearray(1)
+
+    def ensure(size):
+        while len(cells) < size:
+            cells.append([0, -1, []])
+            used.append(0)
+
+    queue = deque([(root, 0)])
+    while queue:
+        node, state = queue.popleft()
+        children, top = node
+        cells[state][2] = [offset for value, offset in top]
+        if not children:
+            continue
+
+        labels = sorted(children)
+        base = 1
+        while True:
+            ensure(base + labels[-1] + 1)
+            if all(not used[base + label] for label in labels):
+                break
+            base += 1
+
+        cells[state][0] = base
+        for label in labels:
+            child = base + label
+            used[child] = 1
+            cells[child][1] = state
+            queue.append((children[label], child))
+
+    return cells
+
+def gen_emoji_trie(name, emojis, offsets):
+    cells = build_emoji_trie(emojis, offsets)
+
+    results = []
+    lines = []
+    lines.append('static const EmojiTrieCell {0}_emoji_trie[] = {{'.format(name))
+    for i in range(0, len(cells), 4):
+        row = []
+        for base, check, top in cells[i:i + 4]:
+            row.append('{{ {0}, {1}, {2}, {3} }},'.format(
+                base, check, len(results), len(top)))
+            results.extend(str(offset) for offset in top)
+        lines.append('    ' + ' '.join(row))
+    lines.append('};')
+    lines.append('')
+    lines.append('static const guint32 {0}_emoji_trie_results[] = {{'.format(name))
+    for i in range(0, len(results), 8):
+        lines.append('    ' + ', '.join(results[i:i + 8]) + ',')
+    lines.append('};')
+    return '\n'.join(lines)
+
+def gen_emoji_table(name, emojis, with_trie = False):
+    emojis = dict((key.encode('utf8'), values) for key, values in emojis)
+    seeds, slots = build_perfect_hash(sorted(emojis.keys()))
+
+    strings = []
+    offset = 0
     entries = []
-    for match, string in eng_emojis:
-        match = '"{0}"'.format(match)
-        entry = '{0:<10}, "{1}"'.format(match, string)
-        entries.append(entry)
-    return ',\n'.join(entries)
+    results = []
+    offsets = {}
+    for key in slots:
+        # one line per keyword with its emojis
+        line = [key.decode('utf8')]
+        match = offset
+        offset += len(key) + 1
+
+        entries.append('    {{ {0}, {1}, {2} }},'.format(
+            match, len(results), len(emojis[key])))
+        for value in emojis[key]:
+            offsets.setdefault(key, []).append(offset)
+            results.append(str(offset))
+            line.append(value)
+            offset += len(value.encode('utf8')) + 1
+        strings.append(line)
+
+    lines = []
+    lines.append('static const char {0}_emoji_strings[] ='.format(name))
+    for line in strings:
+        lines.append('    ' + ' '.join('"{0}\\0"'.format(escape_string(string))
+                                     for string in line))
+    lines.append('    ;')
+    lines.append('')
+    lines.append('static const EmojiSlot {0}_emoji_slots[] = {{'.format(name))
+    lines.extend(entries)
+    lines.append('};')
+    lines.append('')
+    lines.append('static const guint32 {0}_emoji_results[] = {{'.format(name))
+    for i in range(0, len(results), 8):
+        lines.append('    ' + ', '.join(results[i:i + 8]) + ',')
+    lines.append('};')
+    lines.append('')
+    lines.append('static const guint32 {0}_emoji_seeds[] = {{'.format(name))
+    for i in range(0, len(seeds), 8):
+        lines.append('    ' + ', '.join(str(seed) for seed in seeds[i:i + 8]) + ',')
+    lines.append('};')
+    lines.append('')
+    lines.append('static const EmojiTable {0}_emoji_table = {{'.format(name))
+    lines.append('    {0}_emoji_strings,'.format(name))
+    lines.append('    {0}_emoji_slots, G_N_ELEMENTS ({0}_emoji_slots),'.format(name))
+    lines.append('    {0}_emoji_results,'.format(name))
+    lines.append('    {0}_emoji_seeds, G_N_ELEMENTS ({0}_emoji_seeds),'.format(name))
+    lines.append('};')
+
+    if with_trie:
+        lines.append('')
+        lines.append(gen_emoji_trie(name, emojis, offsets))
+
+    return '\n'.join(lines)
+
+def gen_english_emojis():
+    return gen_emoji_table('english', eng_emojis, True)
 
 def gen_chinese_emojis():
-    entries = []
-    for match, string in chs_emojis:
-        match = '"{0}"'.format(match)
-        entry = '{0:<10}, "{1}"'.format(match, string)
-        entries.append(entry)
-    return ',\n'.join(entries)
+    return gen_emoji_table('chinese', chs_emojis)
 
 
 def get_table_content(tablename):
@@ -1,11 +1,98 @@
-import sctc
-items = sctc.S_2_T.items()
-items.sort()
-print "const gunichar simp_to_trad[][2] = {"
-for s, t in items:
-    print "    { 0x%x, 0x%x },   // %s => %s" % (ord(s), ord(t[0]), s.encode("utf8"), t[0].encode("utf8"))
-print "};"
+#!/usr/bin/env python3
+# generates PYSimpTradConverterTrie.h from PYSimpTradConverterTable.h,
+# a double-array trie over the utf-8 bytes of the simplified phrases.
+#
+# usage: gensimptradtable.py PYSimpTradConverterTable.h > PYSimpTradConverterTrie.h
+import re
+import sys
+from collections import deque
 
-print '#define SIMP_TO_TRAD_NR (sizeof (simp_to_trad) / sizeof (simp_to_trad[0]))'
-print
+def load_keys(filename):
+    pattern = re.compile(r'^\s*\{ "(.*)", "(.*)" \},$')
+    keys = []
+    with open(filename, encoding="utf8") as f:
+        for line in f:
+            m = pattern.match(line)
+            if m:
+                keys.append(m.group(1).encode("utf8"))
+    return keys
 
+def build_trie(keys):
+    # node: [children dict, value], value is the row in simp_to_trad.
+    root = [{}, -1]
+    for index, key in enumerate(keys):
+        node = root
+        for byte in key:
+            node = node[0].setdefault(byte, [{}, -1])
+        assert node[1] == -1, "duplicated key %s" % key.decode("utf8")
+        node[1] = index
+    return root
+
+def build_double_array(root):
+    # cell: [base, check, value], a free cell has check -1.
+    cells = [[0, -1, -1]]
+    used = bytearray(1)
+
+    def ensure(size):
+        while len(cells) < size:
+            cells.append([0, -1, -1])
+            used.append(0)
+
+    first_free = 1
+    queue = deque([(root, 0)])
+    while queue:
+        node, state = queue.popleft()
+        children, value = node
+        cells[state][2] = value
+        if not children:
+            continue
+
+        labels = sorted(children)
+        # try the free cells in order for the first label.
+        start = first_free
+        while True:
+            ensure(start + 1)
+            pos = used.find(0, start)
+            if pos < 0:
+                pos = len(used)
+            base = pos - labels[0]
+            if base >= 1:
+                ensure(base + labels[-1] + 1)
+                if all(not used[base + label] for label in labels):
+                    break
+            start = pos + 1
+
+        cells[state][0] = base
+        for label in labels:
+            child = base + label
+            used[child] = 1
+            cells[child][1] = state
+            queue.append((children[label], child))
+
+        first_free = used.find(0, first_free)
+        if first_free < 0:
+            first_free = len(used)
+
+    return cells
+
+def main():
+    keys = load_keys(sys.argv[1])
+    cells = build_double_array(build_trie(keys))
+
+    print("/* generated by gensimptradtable.py, do not edit. */")
+    print("")
+    print("/* the double-array trie of the utf-8 bytes of the keys of")
+    print("   simp_to_trad, a byte c moves from state s to t = base[s] + c")
+    print("   when check[t] == s, value is the row of the key ending at t. */")
+    print("static const struct {")
+    print("    gint32 base;")
+    print("    gint32 check;")
+    print("    gint32 value;")
+    print("} simp_to_trad_trie[] = {")
+    for i in range(0, len(cells), 6):
+        row = cells[i:i + 6]
+        print("    " + " ".join("{ %d, %d, %d }," % tuple(cell) for cell in row))
+    print("};")
+
+if __name__ == "__main__":
+    main()
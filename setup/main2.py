@@ -148,6 +148,9 @@ class PreferencesDialog:
         self.__remember_every_input = self.__builder.get_object("RememberEveryInput")
         self.__show_suggestion = self.__builder.get_object("ShowSuggestion")
         self.__sort_candidate_option = self.__builder.get_object("SortCandidateOption")
+        self.__emoji_prefix_candidate = self.__builder.get_object("EmojiPrefixCandidate")
+        self.__coalesce_keys = self.__builder.get_object("CoalesceKeys")
+        self.__async_candidates = self.__builder.get_object("AsyncCandidates")
 
         # read values
         self.__init_chinese.set_active(self.__get_value("init-chinese"))
@@ -163,6 +166,9 @@ class PreferencesDialog:
         self.__remember_every_input.set_active(self.__get_value("remember-every-input"))
         self.__show_suggestion.set_active(self.__get_value("show-suggestion"))
         self.__sort_candidate_option.set_active(self.__get_value("sort-candidate-option"))
+        self.__emoji_prefix_candidate.set_active(self.__get_value("emoji-prefix-candidate"))
+        self.__coalesce_keys.set_active(self.__get_value("coalesce-keys"))
+        self.__async_candidates.set_active(self.__get_value("async-candidates"))
         # connect signals
         self.__init_chinese.connect("toggled", self.__toggled_cb, "init-chinese")
         self.__init_full.connect("toggled", self.__toggled_cb, "init-full")
@@ -171,6 +177,9 @@ class PreferencesDialog:
         self.__dynamic_adjust.connect("toggled", self.__toggled_cb, "dynamic-adjust")
         self.__remember_every_input.connect("toggled", self.__toggled_cb, "remember-every-input")
         self.__show_suggestion.connect("toggled", self.__toggled_cb, "show-suggestion")
+        self.__emoji_prefix_candidate.connect("toggled", self.__toggled_cb, "emoji-prefix-candidate")
+        self.__coalesce_keys.connect("toggled", self.__toggled_cb, "coalesce-keys")
+        self.__async_candidates.connect("toggled", self.__toggled_cb, "async-candidates")
 
         def __display_size_changed_cb(widget):
             self.__set_value("display-style", widget.get_active())
@@ -407,6 +416,14 @@ class PreferencesDialog:
         self.__edit_lua = self.__builder.get_object("EditLua")
         self.__edit_lua.connect("clicked", self.__edit_lua_cb)
 
+        self.__lua_call_budget = self.__builder.get_object("LuaCallBudget")
+        self.__lua_call_budget.set_value(self.__get_value("lua-call-budget"))
+
+        def __lua_call_budget_changed_cb(adjustment):
+            self.__set_value("lua-call-budget", int(adjustment.get_value()))
+
+        self.__lua_call_budget.connect("value-changed", __lua_call_budget_changed_cb)
+
         self.__import_dictionary = self.__builder.get_object("ImportDictionary")
         self.__import_dictionary.connect("clicked", self.__import_dictionary_cb)
 
@@ -46,6 +46,9 @@ Config::initDefaultValues (void)
     m_sort_option = SORT_BY_PHRASE_LENGTH_AND_PINYIN_LENGTH_AND_FREQUENCY;
     m_show_suggestion = FALSE;
     m_emoji_candidate = TRUE;
+    m_emoji_prefix_candidate = FALSE;
+    m_coalesce_keys = FALSE;
+    m_async_candidates = FALSE;
 
     m_shift_select_candidate = FALSE;
     m_minus_equal_page = TRUE;
@@ -62,6 +65,7 @@ Config::initDefaultValues (void)
 
     m_dictionaries = "";
     m_lua_converter = "";
+    m_lua_call_budget = 100;
     m_opencc_config = "s2t.json";
 
     m_main_switch = "<Shift>";
@@ -46,6 +46,7 @@ protected:
 public:
     std::string dictionaries (void) const       { return m_dictionaries; }
     std::string luaConverter (void) const       { return m_lua_converter; }
+    guint luaCallBudget (void) const            { return m_lua_call_budget; }
     pinyin_option_t option (void) const         { return m_option & m_option_mask; }
     guint orientation (void) const              { return m_orientation; }
     guint pageSize (void) const                 { return m_page_size; }
@@ -54,6 +55,9 @@ public:
     sort_option_t sortOption (void) const       { return m_sort_option; }
     gboolean showSuggestion (void) const        { return m_show_suggestion; }
     gboolean emojiCandidate (void) const        { return m_emoji_candidate; }
+    gboolean emojiPrefixCandidate (void) const  { return m_emoji_prefix_candidate; }
+    gboolean coalesceKeys (void) const          { return m_coalesce_keys; }
+    gboolean asyncCandidates (void) const       { return m_async_candidates; }
     gboolean shiftSelectCandidate (void) const  { return m_shift_select_candidate; }
     gboolean minusEqualPage (void) const        { return m_minus_equal_page; }
     gboolean commaPeriodPage (void) const       { return m_comma_period_page; }
@@ -98,6 +102,7 @@ protected:
     std::string m_schema_id;
     std::string m_dictionaries;
     std::string m_lua_converter;
+    guint m_lua_call_budget;
     std::string m_opencc_config;
     pinyin_option_t m_option;
     pinyin_option_t m_option_mask;
@@ -109,6 +114,9 @@ protected:
     sort_option_t m_sort_option;
     gboolean m_show_suggestion;
     gboolean m_emoji_candidate;
+    gboolean m_emoji_prefix_candidate;
+    gboolean m_coalesce_keys;
+    gboolean m_async_candidates;
 
     gboolean m_shift_select_candidate;
     gboolean m_minus_equal_page;
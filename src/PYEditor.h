@@ -25,6 +25,7 @@
 #include "PYString.h"
 #include "PYUtil.h"
 #include "PYPEnhancedCandidates.h"
+#include "PYPTrace.h"
 
 namespace PY {
 
@@ -104,6 +105,7 @@ protected:
 
     void updatePreeditText (Text & text, guint cursor, gboolean visible) const
     {
+        TraceScope scope (TRACE_STAGE_EMIT_PREEDIT_TEXT);
         m_signal_update_preedit_text (text, cursor, visible);
     }
 
@@ -119,6 +121,7 @@ protected:
 
     void updateAuxiliaryText (Text & text, gboolean visible) const
     {
+        TraceScope scope (TRACE_STAGE_EMIT_AUXILIARY_TEXT);
         m_signal_update_auxiliary_text (text, visible);
     }
 
@@ -134,11 +137,13 @@ protected:
 
     void updateLookupTable (LookupTable & table, gboolean visible) const
     {
+        TraceScope scope (TRACE_STAGE_EMIT_LOOKUP_TABLE);
         m_signal_update_lookup_table (table, visible);
     }
 
     void updateLookupTableFast (LookupTable & table, gboolean visible) const
     {
+        TraceScope scope (TRACE_STAGE_EMIT_LOOKUP_TABLE);
         m_signal_update_lookup_table_fast (table, visible);
     }
 
@@ -234,11 +234,24 @@ ibus_pinyin_engine_candidate_clicked (IBusEngine *engine,
         ((IBusEngineClass *) ibus_pinyin_engine_parent_class)       \
             ->name (engine);                                        \
     }
-FUNCTION(focus_in,    focusIn)
-FUNCTION(focus_out,   focusOut)
-FUNCTION(reset,       reset)
-FUNCTION(enable,      enable)
-FUNCTION(disable,     disable)
+/* after these the client may show something else than we sent. */
+#define FORGET_FUNCTION(name, Name)                                 \
+    static void                                                     \
+    ibus_pinyin_engine_##name (IBusEngine *engine)                  \
+    {                                                               \
+        IBusPinyinEngine *pinyin = (IBusPinyinEngine *) engine;     \
+        pinyin->engine->forgetUpdates ();                           \
+        pinyin->engine->Name ();                                    \
+        ((IBusEngineClass *) ibus_pinyin_engine_parent_class)       \
+            ->name (engine);                                        \
+    }
+FORGET_FUNCTION(focus_in,    focusIn)
+FORGET_FUNCTION(focus_out,   focusOut)
+FORGET_FUNCTION(reset,       reset)
+FORGET_FUNCTION(enable,      enable)
+FORGET_FUNCTION(disable,     disable)
+#undef FORGET_FUNCTION
+
 FUNCTION(page_up,     pageUp)
 FUNCTION(page_down,   pageDown)
 FUNCTION(cursor_up,   cursorUp)
@@ -250,6 +263,194 @@ Engine::Engine (IBusEngine *engine) : m_engine (engine)
 #if IBUS_CHECK_VERSION (1, 5, 4)
     m_input_purpose = IBUS_INPUT_PURPOSE_FREE_FORM;
 #endif
+    forgetUpdates ();
+}
+
+/* FNV-1a */
+static inline guint64
+hash_bytes (guint64 hash, gconstpointer data, gsize size)
+{
+    const guchar *p = (const guchar *) data;
+    for (gsize i = 0; i < size; ++i) {
+        hash ^= p[i];
+        hash *= G_GUINT64_CONSTANT (0x100000001b3);
+    }
+    return hash;
+}
+
+static inline guint64
+hash_uint (guint64 hash, guint value)
+{
+    return hash_bytes (hash, &value, sizeof (value));
+}
+
+static guint64
+hash_text (guint64 hash, IBusText *text)
+{
+    if (NULL == text)
+        return hash_uint (hash, 0);
+
+    const gchar *str = ibus_text_get_text (text);
+    gsize len = std::strlen (str);
+    hash = hash_uint (hash, len);
+    hash = hash_bytes (hash, str, len);
+
+    IBusAttrList *attrs = ibus_text_get_attributes (text);
+    if (NULL == attrs)
+        return hash;
+
+    IBusAttribute *attr;
+    for (guint i = 0; (attr = ibus_attr_list_get (attrs, i)) != NULL; ++i) {
+        hash = hash_uint (hash, ibus_attribute_get_attr_type (attr));
+        hash = hash_uint (hash, ibus_attribute_get_value (attr));
+        hash = hash_uint (hash, ibus_attribute_get_start_index (attr));
+        hash = hash_uint (hash, ibus_attribute_get_end_index (attr));
+    }
+    return hash;
+}
+
+/* only the page of the cursor is shown by the client. */
+static guint64
+hash_lookup_table (guint64 hash, IBusLookupTable *table)
+{
+    guint page_size = ibus_lookup_table_get_page_size (table);
+    guint cursor_pos = ibus_lookup_table_get_cursor_pos (table);
+    guint size = ibus_lookup_table_get_number_of_candidates (table);
+    guint begin = page_size ? cursor_pos / page_size * page_size : 0;
+    guint end = MIN (begin + page_size, size);
+
+    hash = hash_uint (hash, page_size);
+    hash = hash_uint (hash, cursor_pos);
+    hash = hash_uint (hash, ibus_lookup_table_get_orientation (table));
+    hash = hash_uint (hash, ibus_lookup_table_is_cursor_visible (table));
+    hash = hash_uint (hash, ibus_lookup_table_is_round (table));
+    /* whether there are more pages. */
+    hash = hash_uint (hash, end < size);
+
+    for (guint i = begin; i < end; ++i) {
+        hash = hash_text (hash, ibus_lookup_table_get_candidate (table, i));
+        hash = hash_text (hash, ibus_lookup_table_get_label (table, i - begin));
+    }
+    return hash;
+}
+
+static const guint64 HASH_INIT = G_GUINT64_CONSTANT (0xcbf29ce484222325);
+
+void
+Engine::forgetUpdates (void)
+{
+    for (guint i = 0; i < TRACE_CHANNEL_LAST; ++i) {
+        m_update_states[i].hash = 0;
+        m_update_states[i].visible = -1;
+    }
+}
+
+gboolean
+Engine::suppressUpdate (TraceChannel channel, guint64 hash, gboolean visible)
+{
+    UpdateState & state = m_update_states[channel];
+    gboolean suppressed = (state.visible == (gint) visible &&
+                           state.hash == hash);
+
+    state.hash = hash;
+    state.visible = visible;
+    KeyTrace::instance ().countUpdate (channel, suppressed);
+    return suppressed;
+}
+
+gboolean
+Engine::suppressVisible (TraceChannel channel, gboolean visible)
+{
+    UpdateState & state = m_update_states[channel];
+    gboolean suppressed = (state.visible == (gint) visible);
+
+    state.visible = visible;
+    KeyTrace::instance ().countUpdate (channel, suppressed);
+    return suppressed;
+}
+
+void
+Engine::updatePreeditText (Text & text, guint cursor, gboolean visible)
+{
+    guint64 hash = hash_uint (hash_text (HASH_INIT, text), cursor);
+    if (suppressUpdate (TRACE_CHANNEL_PREEDIT_TEXT, hash, visible))
+        return;
+    ibus_engine_update_preedit_text (m_engine, text, cursor, visible);
+}
+
+void
+Engine::showPreeditText (void)
+{
+    if (suppressVisible (TRACE_CHANNEL_PREEDIT_TEXT, TRUE))
+        return;
+    ibus_engine_show_preedit_text (m_engine);
+}
+
+void
+Engine::hidePreeditText (void)
+{
+    if (suppressVisible (TRACE_CHANNEL_PREEDIT_TEXT, FALSE))
+        return;
+    ibus_engine_hide_preedit_text (m_engine);
+}
+
+void
+Engine::updateAuxiliaryText (Text & text, gboolean visible)
+{
+    guint64 hash = hash_text (HASH_INIT, text);
+    if (suppressUpdate (TRACE_CHANNEL_AUXILIARY_TEXT, hash, visible))
+        return;
+    ibus_engine_update_auxiliary_text (m_engine, text, visible);
+}
+
+void
+Engine::showAuxiliaryText (void)
+{
+    if (suppressVisible (TRACE_CHANNEL_AUXILIARY_TEXT, TRUE))
+        return;
+    ibus_engine_show_auxiliary_text (m_engine);
+}
+
+void
+Engine::hideAuxiliaryText (void)
+{
+    if (suppressVisible (TRACE_CHANNEL_AUXILIARY_TEXT, FALSE))
+        return;
+    ibus_engine_hide_auxiliary_text (m_engine);
+}
+
+void
+Engine::updateLookupTable (LookupTable &table, gboolean visible)
+{
+    guint64 hash = hash_lookup_table (HASH_INIT, table);
+    if (suppressUpdate (TRACE_CHANNEL_LOOKUP_TABLE, hash, visible))
+        return;
+    ibus_engine_update_lookup_table (m_engine, table, visible);
+}
+
+void
+Engine::updateLookupTableFast (LookupTable &table, gboolean visible)
+{
+    guint64 hash = hash_lookup_table (HASH_INIT, table);
+    if (suppressUpdate (TRACE_CHANNEL_LOOKUP_TABLE, hash, visible))
+        return;
+    ibus_engine_update_lookup_table_fast (m_engine, table, visible);
+}
+
+void
+Engine::showLookupTable (void)
+{
+    if (suppressVisible (TRACE_CHANNEL_LOOKUP_TABLE, TRUE))
+        return;
+    ibus_engine_show_lookup_table (m_engine);
+}
+
+void
+Engine::hideLookupTable (void)
+{
+    if (suppressVisible (TRACE_CHANNEL_LOOKUP_TABLE, FALSE))
+        return;
+    ibus_engine_hide_lookup_table (m_engine);
 }
 
 gboolean
@@ -58,61 +58,27 @@ public:
     virtual gboolean propertyActivate (const gchar *prop_name, guint prop_state) = 0;
     virtual void candidateClicked (guint index, guint button, guint state) = 0;
 
+    /* forget what the client shows, the next updates are all sent. */
+    void forgetUpdates (void);
+
 protected:
     void commitText (Text & text) const
     {
         ibus_engine_commit_text (m_engine, text);
     }
 
-    void updatePreeditText (Text & text, guint cursor, gboolean visible) const
-    {
-        ibus_engine_update_preedit_text (m_engine, text, cursor, visible);
-    }
-
-    void showPreeditText (void) const
-    {
-        ibus_engine_show_preedit_text (m_engine);
-    }
-
-    void hidePreeditText (void) const
-    {
-        ibus_engine_hide_preedit_text (m_engine);
-    }
-
-    void updateAuxiliaryText (Text & text, gboolean visible) const
-    {
-        ibus_engine_update_auxiliary_text (m_engine, text, visible);
-    }
-
-    void showAuxiliaryText (void) const
-    {
-        ibus_engine_show_auxiliary_text (m_engine);
-    }
-
-    void hideAuxiliaryText (void) const
-    {
-        ibus_engine_hide_auxiliary_text (m_engine);
-    }
-
-    void updateLookupTable (LookupTable &table, gboolean visible) const
-    {
-        ibus_engine_update_lookup_table (m_engine, table, visible);
-    }
-
-    void updateLookupTableFast (LookupTable &table, gboolean visible) const
-    {
-        ibus_engine_update_lookup_table_fast (m_engine, table, visible);
-    }
-
-    void showLookupTable (void) const
-    {
-        ibus_engine_show_lookup_table (m_engine);
-    }
-
-    void hideLookupTable (void) const
-    {
-        ibus_engine_hide_lookup_table (m_engine);
-    }
+    /* the updates below are not sent
+       when the client already shows the same content. */
+    void updatePreeditText (Text & text, guint cursor, gboolean visible);
+    void showPreeditText (void);
+    void hidePreeditText (void);
+    void updateAuxiliaryText (Text & text, gboolean visible);
+    void showAuxiliaryText (void);
+    void hideAuxiliaryText (void);
+    void updateLookupTable (LookupTable &table, gboolean visible);
+    void updateLookupTableFast (LookupTable &table, gboolean visible);
+    void showLookupTable (void);
+    void hideLookupTable (void);
 
     void registerProperties (PropList & props) const
     {
@@ -124,6 +90,11 @@ protected:
         ibus_engine_update_property (m_engine, prop);
     }
 
+private:
+    gboolean suppressUpdate (TraceChannel channel, guint64 hash,
+                             gboolean visible);
+    gboolean suppressVisible (TraceChannel channel, gboolean visible);
+
 protected:
     Pointer<IBusEngine>  m_engine;      // engine pointer
 
@@ -131,6 +102,14 @@ protected:
     IBusInputPurpose m_input_purpose;
 #endif
 
+private:
+    /* the content hash and the visibility last sent per channel,
+       visible is -1 when unknown. */
+    struct UpdateState {
+        guint64 hash;
+        gint visible;
+    };
+    UpdateState m_update_states[TRACE_CHANNEL_LAST];
 };
 
 gboolean pinyin_accelerator_name(guint keyval, guint modifiers,
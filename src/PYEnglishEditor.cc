@@ -19,7 +19,11 @@
  */
 
 #include "PYEnglishEditor.h"
+#include <errno.h>
+#include <fcntl.h>
 #include <string.h>
+#include <unistd.h>
+#include <map>
 #include <string>
 #include <vector>
 #include <stdio.h>
@@ -29,12 +33,16 @@
 #include <glib/gstdio.h>
 #include "PYConfig.h"
 #include "PYString.h"
+#include "PYEnglishPrefixIndex.h"
 
 #define _(text) (gettext(text))
 
 namespace PY {
 
-#define DB_BACKUP_TIMEOUT   (60)
+/* the journal is synced a second after a change, and folded
+   into the user db when it grows past the size. */
+#define DB_JOURNAL_SYNC_TIMEOUT   (1)
+#define DB_JOURNAL_MAX_SIZE       (256 * 1024)
 
 class EnglishDatabase{
 public:
@@ -43,17 +51,23 @@ public:
         m_sql = "";
         m_user_db = "";
         m_timeout_id = 0;
-        m_timer = g_timer_new ();
+        m_generation = 0;
+        m_in_transaction = FALSE;
+        m_journal_fd = -1;
+        m_journal_size = 0;
+        m_compact_needed = FALSE;
     }
 
     ~EnglishDatabase(){
-        g_timer_destroy (m_timer);
         if (m_timeout_id != 0) {
-            saveUserDB ();
+            flushJournal ();
             g_source_remove (m_timeout_id);
         }
+        closeJournal ();
 
         if (m_sqlite){
+            commitTransaction ();
+            finalizeStatements ();
             sqlite3_close (m_sqlite);
             m_sqlite = NULL;
         }
@@ -151,6 +165,8 @@ public:
         }
         /* cache the user db name. */
         m_user_db = user_db;
+        /* not "-journal", sqlite takes that for its rollback journal. */
+        m_journal = String (user_db) + ".log";
 
         /* do database attach here. :) */
         if (sqlite3_open_v2 (system_db, &m_sqlite,
@@ -169,86 +185,54 @@ public:
         }
         return TRUE;
 #endif
-        return loadUserDB();
-    }
-
-    /* List the words in freq order. */
-    gboolean listWords(const char *prefix, std::vector<std::string> & words){
-        sqlite3_stmt *stmt = NULL;
-        const char *tail = NULL;
-        words.clear ();
-
-        /* list words */
-        const char *SQL_DB_LIST = 
-            "SELECT word FROM ( "
-            "SELECT * FROM english UNION ALL SELECT * FROM userdb.english) "
-            " WHERE word LIKE \"%s%\" GROUP BY word ORDER BY SUM(freq) DESC;";
-        m_sql.printf (SQL_DB_LIST, prefix);
-        int result = sqlite3_prepare_v2 (m_sqlite, m_sql.c_str(), -1, &stmt, &tail);
-        if (result != SQLITE_OK)
+        if (!loadUserDB ())
             return FALSE;
+        return loadIndex ();
+    }
 
-        result = sqlite3_step (stmt);
-        while (result == SQLITE_ROW){
-            /* get the words. */
-            result = sqlite3_column_type (stmt, 0);
-            if (result != SQLITE_TEXT)
-                return FALSE;
-
-            const char *word = (const char *)sqlite3_column_text (stmt, 0);
-            words.push_back (word);
-            result = sqlite3_step (stmt);
-        }
-
-        sqlite3_finalize (stmt);
-        if (result != SQLITE_DONE)
-            return FALSE;
+    /* List at most limit words of the prefix after the cursor in freq
+       order, complete tells whether no word is left after them. */
+    gboolean listWords(const char *prefix,
+                       const EnglishPrefixIndex::Entry *after, guint limit,
+                       std::vector<EnglishPrefixIndex::Entry> & entries,
+                       gboolean & complete){
+        complete = m_index.list (prefix, after, limit, entries);
         return TRUE;
     }
 
-    /* Get the freq of user sqlite db. */
-    gboolean getWordInfo(const char *word, float & freq){
-        sqlite3_stmt *stmt = NULL;
-        const char *tail = NULL;
-        /* get word info. */
-        const char *SQL_DB_SELECT = 
-            "SELECT freq FROM userdb.english WHERE word = \"%s\";";
-        m_sql.printf (SQL_DB_SELECT, word);
-        int result = sqlite3_prepare_v2 (m_sqlite, m_sql.c_str(), -1, &stmt, &tail);
-        g_assert (result == SQLITE_OK);
-        result = sqlite3_step (stmt);
-        if (result != SQLITE_ROW)
-            return FALSE;
-        result = sqlite3_column_type (stmt, 0);
-        if (result != SQLITE_FLOAT)
+
+    /* Add the freq delta to the word in user db and the index,
+       the delta is kept in the journal until the next compaction. */
+    gboolean trainWord(const char *word, float delta){
+        if (!addFreq (word, delta))
             return FALSE;
-        freq = sqlite3_column_double (stmt, 0);
-        result = sqlite3_finalize (stmt);
-        g_assert (result == SQLITE_OK);
+
+        appendJournal (word, delta);
+        m_index.add (word, delta);
+        m_generation ++;
         return TRUE;
     }
 
-    /* Update the freq with delta value. */
-    gboolean updateWord(const char *word, float freq){
-        const char *SQL_DB_UPDATE =
-            "UPDATE userdb.english SET freq = \"%f\" WHERE word = \"%s\";";
-        m_sql.printf (SQL_DB_UPDATE, freq, word);
-        gboolean retval =  executeSQL (m_sqlite);
-        modified ();
-        return retval;
+    /* Bumped when a freq changes, the keyset cursors of the words
+       listed before are stale then. */
+    guint generation(void) const{
+        return m_generation;
     }
 
-    /* Insert the word into user db with the initial freq. */
-    gboolean insertWord(const char *word, float freq){
-        const char *SQL_DB_INSERT =
-            "INSERT INTO userdb.english (word, freq) VALUES (\"%s\", \"%f\");";
-        m_sql.printf (SQL_DB_INSERT, word, freq);
-        gboolean retval = executeSQL (m_sqlite);
-        modified ();
-        return retval;
+private:
+    gboolean addFreq(const char *word, float delta){
+        const char *SQL_DB_TRAIN =
+            "INSERT INTO userdb.english (word, freq) VALUES (?, ?) "
+            "ON CONFLICT (word) DO UPDATE SET freq = freq + excluded.freq;";
+        sqlite3_stmt *stmt = prepareStatement (SQL_DB_TRAIN);
+        if (stmt == NULL)
+            return FALSE;
+
+        sqlite3_bind_text (stmt, 1, word, -1, SQLITE_STATIC);
+        sqlite3_bind_double (stmt, 2, delta);
+        return executeWrite (stmt);
     }
 
-private:
     gboolean executeSQL(sqlite3 *sqlite){
         gchar *errmsg = NULL;
         if (sqlite3_exec (sqlite, m_sql.c_str (), NULL, NULL, &errmsg)
@@ -261,6 +245,113 @@ private:
         return TRUE;
     }
 
+    /* Prepare the SQL once, the statements are kept until close. */
+    sqlite3_stmt *prepareStatement(const char *sql){
+        std::map<std::string, sqlite3_stmt *>::iterator iter =
+            m_statements.find (sql);
+        if (iter != m_statements.end ()) {
+            sqlite3_clear_bindings (iter->second);
+            return iter->second;
+        }
+
+        sqlite3_stmt *stmt = NULL;
+        if (sqlite3_prepare_v2 (m_sqlite, sql, -1, &stmt, NULL) != SQLITE_OK) {
+            g_warning ("%s: %s", sqlite3_errmsg (m_sqlite), sql);
+            return NULL;
+        }
+
+        m_statements[sql] = stmt;
+        return stmt;
+    }
+
+    void finalizeStatements(void){
+        std::map<std::string, sqlite3_stmt *>::iterator iter;
+        for (iter = m_statements.begin (); iter != m_statements.end (); ++iter)
+            sqlite3_finalize (iter->second);
+        m_statements.clear ();
+    }
+
+    /* Step a bound write statement inside the session transaction. */
+    gboolean executeWrite(sqlite3_stmt *stmt){
+        if (!beginTransaction ())
+            return FALSE;
+
+        int result = sqlite3_step (stmt);
+        sqlite3_reset (stmt);
+        if (result != SQLITE_DONE) {
+            g_warning ("%s", sqlite3_errmsg (m_sqlite));
+            return FALSE;
+        }
+
+        return TRUE;
+    }
+
+    /* The writes of a session are committed together before saving. */
+    gboolean beginTransaction(void){
+        if (m_in_transaction)
+            return TRUE;
+
+        sqlite3_stmt *stmt = prepareStatement ("BEGIN TRANSACTION;");
+        if (stmt == NULL)
+            return FALSE;
+
+        int result = sqlite3_step (stmt);
+        sqlite3_reset (stmt);
+        m_in_transaction = (result == SQLITE_DONE);
+        return m_in_transaction;
+    }
+
+    gboolean commitTransaction(void){
+        if (!m_in_transaction)
+            return TRUE;
+
+        sqlite3_stmt *stmt = prepareStatement ("COMMIT;");
+        if (stmt == NULL)
+            return FALSE;
+
+        int result = sqlite3_step (stmt);
+        sqlite3_reset (stmt);
+        if (result != SQLITE_DONE) {
+            g_warning ("%s", sqlite3_errmsg (m_sqlite));
+            return FALSE;
+        }
+
+        m_in_transaction = FALSE;
+        return TRUE;
+    }
+
+    /* Sum the freqs of system and user db into the prefix index. */
+    gboolean loadIndex (void){
+        const char *SQL_DB_WORDS[] = {
+            "SELECT word, freq FROM english;",
+            "SELECT word, freq FROM userdb.english;",
+        };
+
+        m_index.clear ();
+        for (guint i = 0; i < G_N_ELEMENTS (SQL_DB_WORDS); ++i) {
+            sqlite3_stmt *stmt = NULL;
+            const char *tail = NULL;
+            int result = sqlite3_prepare_v2 (m_sqlite, SQL_DB_WORDS[i], -1, &stmt, &tail);
+            if (result != SQLITE_OK)
+                return FALSE;
+
+            result = sqlite3_step (stmt);
+            while (result == SQLITE_ROW){
+                const char *word = (const char *)sqlite3_column_text (stmt, 0);
+                if (word)
+                    m_index.add (word, sqlite3_column_double (stmt, 1));
+                result = sqlite3_step (stmt);
+            }
+
+            sqlite3_finalize (stmt);
+            if (result != SQLITE_DONE)
+                return FALSE;
+        }
+
+        m_index.build ();
+        return TRUE;
+    }
+
     gboolean loadUserDB (void){
         sqlite3 *userdb =  NULL;
         /* Attach user database */
@@ -285,6 +376,13 @@ private:
             }
 
             sqlite3_close (userdb);
+
+            /* the words are still usable without a journal,
+               the changes are then saved by compactions. */
+            if (!loadJournal ()) {
+                g_warning ("can't open the journal %s.", m_journal.c_str ());
+                m_compact_needed = TRUE;
+            }
             return TRUE;
         } while (0);
 
@@ -295,6 +393,9 @@ private:
 
     gboolean saveUserDB (void){
         sqlite3 *userdb = NULL;
+        if (!commitTransaction ())
+            return FALSE;
+
         String tmpfile = String(m_user_db) + "-tmp";
         do {
             /* remove tmpfile if it exist */
@@ -324,14 +425,174 @@ private:
         return FALSE;
     }
 
-    void modified (void){
-        /* Restart the timer */
-        g_timer_start (m_timer);
+    /* The journal starts with the generation of the user db it follows,
+       then one "word\tdelta" line for each training. */
+    gboolean getJournalGeneration (String & generation){
+        const char *SQL_DB_GENERATION =
+            "SELECT value FROM userdb.desc WHERE name = 'journal';";
+        sqlite3_stmt *stmt = prepareStatement (SQL_DB_GENERATION);
+        if (stmt == NULL)
+            return FALSE;
+
+        gboolean retval = FALSE;
+        if (sqlite3_step (stmt) == SQLITE_ROW &&
+            sqlite3_column_type (stmt, 0) == SQLITE_TEXT) {
+            generation = (const char *) sqlite3_column_text (stmt, 0);
+            retval = TRUE;
+        }
+        sqlite3_reset (stmt);
+        return retval;
+    }
+
+    gboolean setJournalGeneration (const String & generation){
+        const char *SQL_DB_GENERATION =
+            "INSERT OR REPLACE INTO userdb.desc (name, value) "
+            "VALUES ('journal', ?);";
+        sqlite3_stmt *stmt = prepareStatement (SQL_DB_GENERATION);
+        if (stmt == NULL)
+            return FALSE;
+
+        sqlite3_bind_text (stmt, 1, generation.c_str (), -1, SQLITE_STATIC);
+        return executeWrite (stmt);
+    }
+
+    /* Replay the journal of the loaded user db. */
+    gboolean loadJournal (void){
+        String generation;
+        gchar *contents = NULL;
+        gsize length = 0;
+
+        if (!getJournalGeneration (generation) ||
+            !g_file_get_contents (m_journal, &contents, &length, NULL))
+            return compactJournal ();
+
+        gchar *end = contents + length;
+        gchar *line = contents;
+        gchar *newline = (gchar *) memchr (line, '\n', end - line);
+
+        /* a journal left from before the last compaction. */
+        if (newline == NULL ||
+            generation != std::string (line, newline - line)) {
+            g_free (contents);
+            return compactJournal ();
+        }
+
+        line = newline + 1;
+        while ((newline = (gchar *) memchr (line, '\n', end - line))) {
+            *newline = '\0';
+            gchar *tab = strchr (line, '\t');
+            if (tab) {
+                *tab = '\0';
+                addFreq (line, g_ascii_strtod (tab + 1, NULL));
+            }
+            line = newline + 1;
+        }
 
+        /* drop the record torn by a crash. */
+        gsize size = line - contents;
+        g_free (contents);
+        if (size < length && truncate (m_journal, size) != 0)
+            return compactJournal ();
+
+        return openJournal (size);
+    }
+
+    gboolean openJournal (gsize size){
+        closeJournal ();
+
+        m_journal_fd = g_open (m_journal, O_WRONLY | O_APPEND, 0600);
+        if (m_journal_fd == -1) {
+            g_warning ("%s: %s", m_journal.c_str (), g_strerror (errno));
+            return FALSE;
+        }
+
+        m_journal_size = size;
+        return TRUE;
+    }
+
+    void closeJournal (void){
+        if (m_journal_fd == -1)
+            return;
+
+        close (m_journal_fd);
+        m_journal_fd = -1;
+    }
+
+    void appendJournal (const char *word, float delta){
+        modified ();
+
+        if (m_journal_fd == -1 || strpbrk (word, "\t\n")) {
+            m_compact_needed = TRUE;
+            return;
+        }
+
+        gchar buffer[G_ASCII_DTOSTR_BUF_SIZE];
+        String record = word;
+        record << '\t' << g_ascii_dtostr (buffer, sizeof (buffer), delta)
+               << '\n';
+
+        const char *data = record.c_str ();
+        gsize left = record.length ();
+        while (left > 0) {
+            ssize_t written = write (m_journal_fd, data, left);
+            if (written == -1 && errno == EINTR)
+                continue;
+            if (written == -1) {
+                /* nothing goes after a torn record, the compaction
+                   starts a new journal. */
+                g_warning ("%s: %s", m_journal.c_str (), g_strerror (errno));
+                closeJournal ();
+                m_compact_needed = TRUE;
+                return;
+            }
+            data += written;
+            left -= written;
+        }
+        m_journal_size += record.length ();
+    }
+
+    /* Save the user db under a new generation and start its journal,
+       the old journal is ignored once the new user db is renamed. */
+    gboolean compactJournal (void){
+        String generation;
+        generation.printf ("%" G_GINT64_FORMAT, g_get_real_time ());
+
+        if (!setJournalGeneration (generation) || !saveUserDB ())
+            return FALSE;
+
+        closeJournal ();
+        String header = generation + "\n";
+        GError *error = NULL;
+        if (!g_file_set_contents (m_journal, header, -1, &error)) {
+            g_warning ("%s", error->message);
+            g_error_free (error);
+            return FALSE;
+        }
+
+        if (!openJournal (header.length ()))
+            return FALSE;
+
+        m_compact_needed = FALSE;
+        return TRUE;
+    }
+
+    /* Returns FALSE when a compaction is still needed. */
+    gboolean flushJournal (void){
+        if (m_journal_fd != -1 && fsync (m_journal_fd) != 0) {
+            g_warning ("%s: %s", m_journal.c_str (), g_strerror (errno));
+            m_compact_needed = TRUE;
+        }
+
+        if (m_compact_needed || m_journal_size >= DB_JOURNAL_MAX_SIZE)
+            return compactJournal ();
+        return TRUE;
+    }
+
+    void modified (void){
         if (m_timeout_id != 0)
             return;
 
-        m_timeout_id = g_timeout_add_seconds (DB_BACKUP_TIMEOUT,
+        m_timeout_id = g_timeout_add_seconds (DB_JOURNAL_SYNC_TIMEOUT,
                                               EnglishDatabase::timeoutCallback,
                                               static_cast<gpointer> (this));
     }
@@ -339,30 +600,44 @@ private:
     static gboolean timeoutCallback (gpointer data){
         EnglishDatabase *self = static_cast<EnglishDatabase *> (data);
 
-        /* Get elapsed time since last modification of database. */
-        guint elapsed = (guint) g_timer_elapsed (self->m_timer, NULL);
-
-        if (elapsed >= DB_BACKUP_TIMEOUT &&
-            self->saveUserDB ()) {
-            self->m_timeout_id = 0;
-            return FALSE;
-        }
+        /* retry a failed compaction. */
+        if (!self->flushJournal ())
+            return TRUE;
 
-        return TRUE;
+        self->m_timeout_id = 0;
+        return FALSE;
     }
 
     sqlite3 *m_sqlite;
     String m_sql;
+    EnglishPrefixIndex m_index;
+    std::map<std::string, sqlite3_stmt *> m_statements;
+    gboolean m_in_transaction;
     const char *m_user_db;
 
+    /* the journal of the trainings since the user db was saved. */
+    String m_journal;
+    int m_journal_fd;
+    gsize m_journal_size;
+    gboolean m_compact_needed;
+
     guint m_timeout_id;
-    GTimer *m_timer;
+    guint m_generation;
 };
 
+/* the English editors of the process share one database, so only one
+   index is kept and only one writer appends to the journal. */
+static EnglishDatabase *english_database = NULL;
+static guint english_database_refs = 0;
+
 EnglishEditor::EnglishEditor (PinyinProperties & props, Config &config)
     : Editor (props, config), m_train_factor (0.1)
 {
-    m_english_database = new EnglishDatabase;
+    m_english_database = english_database;
+    if (english_database_refs++ > 0)
+        return;
+
+    english_database = m_english_database = new EnglishDatabase;
 
     gchar *path = g_build_filename (g_get_user_cache_dir (),
                                      "ibus", "libpinyin", "english-user.db", NULL);
@@ -378,8 +653,12 @@ EnglishEditor::EnglishEditor (PinyinProperties & props, Config &config)
 
 EnglishEditor::~EnglishEditor ()
 {
-    delete m_english_database;
     m_english_database = NULL;
+    if (--english_database_refs > 0)
+        return;
+
+    delete english_database;
+    english_database = NULL;
 }
 
 gboolean
@@ -630,20 +909,124 @@ EnglishEditor::updateStateFromInput (void)
     m_auxiliary_text += prefix;
 
     /* lookup table candidate fill here. */
-    std::vector<std::string> words;
-    gboolean retval = m_english_database->listWords (prefix.c_str (), words);
-    if (!retval)
+    const Completion *completion = lookupCompletion (prefix);
+    if (completion == NULL)
         return FALSE;
 
     clearLookupTable ();
-    std::vector<std::string>::iterator iter;
-    for (iter = words.begin (); iter != words.end (); ++iter){
-        Text text (*iter);
+    return fillLookupTable ();
+}
+
+gboolean
+EnglishEditor::fillLookupTable (void)
+{
+    if (m_completions.empty ())
+        return FALSE;
+
+    /* only the page of the cursor and the next page are filled,
+       the rest is fetched when the cursor moves down. */
+    guint page_size = m_lookup_table.pageSize ();
+    guint cursor = m_lookup_table.cursorPos ();
+    guint end = (cursor / page_size + 2) * page_size;
+
+    Completion & completion = m_completions.back ();
+    std::vector<EnglishPrefixIndex::Entry> & entries = completion.entries;
+
+    /* another editor trained a word, list the prefix again. */
+    gboolean stale =
+        completion.generation != m_english_database->generation ();
+    if (stale) {
+        entries.clear ();
+        completion.fetched = FALSE;
+        completion.complete = FALSE;
+        completion.generation = m_english_database->generation ();
+        clearLookupTable ();
+    }
+
+    if (entries.size () < end && !completion.complete) {
+        /* continue after the last fetched word. */
+        const EnglishPrefixIndex::Entry *after =
+            completion.fetched ? &completion.last : NULL;
+        std::vector<EnglishPrefixIndex::Entry> more;
+        gboolean retval = m_english_database->listWords
+            (completion.prefix.c_str (), after, end - entries.size (),
+             more, completion.complete);
+        if (!retval)
+            return FALSE;
+
+        if (!more.empty ()) {
+            completion.last = more.back ();
+            completion.fetched = TRUE;
+        }
+        entries.insert (entries.end (), more.begin (), more.end ());
+    }
+
+    end = MIN (end, entries.size ());
+    for (guint i = m_lookup_table.size (); i < end; i++) {
+        Text text (entries[i].word);
         m_lookup_table.appendCandidate (text);
     }
+
+    if (stale && end > 0)
+        m_lookup_table.setCursorPos (MIN (cursor, end - 1));
     return TRUE;
 }
 
+const EnglishEditor::Completion *
+EnglishEditor::lookupCompletion (const String & prefix)
+{
+    /* drop the completions listed before a word was trained,
+       they are the first ones. */
+    guint generation = m_english_database->generation ();
+    guint stale = 0;
+    while (stale < m_completions.size () &&
+           m_completions[stale].generation != generation)
+        stale ++;
+    m_completions.erase (m_completions.begin (),
+                         m_completions.begin () + stale);
+
+    /* drop the completions of the prefixes which were edited away,
+       the last one left is a prefix of the new prefix. */
+    while (!m_completions.empty ()) {
+        const String & last = m_completions.back ().prefix;
+        if (prefix.compare (0, last.length (), last) == 0)
+            break;
+        m_completions.pop_back ();
+    }
+
+    /* backspace to an earlier prefix. */
+    if (!m_completions.empty () && m_completions.back ().prefix == prefix)
+        return &m_completions.back ();
+
+    Completion completion;
+    completion.prefix = prefix;
+    completion.fetched = FALSE;
+    completion.complete = FALSE;
+    completion.generation = generation;
+
+    if (!m_completions.empty ()) {
+        /* the words of a longer prefix are among the words of its
+           prefix in the same order, those before the cursor of the
+           prefix are all fetched already. */
+        const Completion & parent = m_completions.back ();
+        std::vector<EnglishPrefixIndex::Entry>::const_iterator iter;
+        for (iter = parent.entries.begin ();
+             iter != parent.entries.end (); ++iter) {
+            if (iter->word.length () >= prefix.length () &&
+                g_ascii_strncasecmp (iter->word.c_str (), prefix.c_str (),
+                                     prefix.length ()) == 0)
+                completion.entries.push_back (*iter);
+        }
+        completion.last = parent.last;
+        completion.fetched = parent.fetched;
+        completion.complete = parent.complete;
+    }
+
+    /* fillLookupTable fetches the words after the cursor. */
+    m_completions.push_back (completion);
+    return &m_completions.back ();
+}
+
 /* Auxiliary Functions */
 
 void
@@ -658,6 +1041,7 @@ void
 EnglishEditor::pageDown (void)
 {
     if (G_LIKELY (m_lookup_table.pageDown ())) {
+        fillLookupTable ();
         update ();
     }
 }
@@ -674,6 +1058,7 @@ void
 EnglishEditor::cursorDown (void)
 {
     if (G_LIKELY (m_lookup_table.cursorDown ())) {
+        fillLookupTable ();
         update ();
     }
 }
@@ -689,6 +1074,7 @@ EnglishEditor::update (void)
 void
 EnglishEditor::reset (void)
 {
+    m_completions.clear ();
     m_text = "";
     updateStateFromInput ();
     update ();
@@ -775,14 +1161,9 @@ EnglishEditor::removeCharAfter (void)
 gboolean
 EnglishEditor::train (const char *word, float delta)
 {
-    float freq = 0;
-    gboolean retval = m_english_database->getWordInfo (word, freq);
-    if (retval) {
-        freq += delta;
-        m_english_database->updateWord (word, freq);
-    } else {
-        m_english_database->insertWord (word, delta);
-    }
+    m_english_database->trainWord (word, delta);
+    /* the freqs of the listed words changed. */
+    m_completions.clear ();
     return TRUE;
 }
 
@@ -799,14 +1180,26 @@ public:
         g_assert (retval);
         retval = db->openDatabase ("english.db", "english-user.db");
         g_assert (retval);
-        float freq = 0;
-        retval = db->getWordInfo ("hello", freq);
-        printf ("word hello:%d, %f.\n", retval, freq);
-        if (retval) {
-            db->updateWord ("hello", 0.1);
-        } else {
-            db->insertWord ("hello", 0.1);
-        }
+        retval = db->trainWord ("hello", 0.1);
+        g_assert (retval);
+
+        std::vector<EnglishPrefixIndex::Entry> trained, replayed;
+        gboolean complete = FALSE;
+        db->listWords ("hello", NULL, 1, trained, complete);
+        g_assert (trained.size () == 1);
+
+        /* the training is replayed from the journal. */
+        delete db;
+        db = new EnglishDatabase ();
+        retval = db->openDatabase ("english.db", "english-user.db");
+        g_assert (retval);
+        db->listWords ("hello", NULL, 1, replayed, complete);
+        g_assert (replayed.size () == 1);
+        g_assert (replayed[0].word == trained[0].word);
+        /* the index sums in float, the db in double. */
+        float diff = replayed[0].freq - trained[0].freq;
+        g_assert (diff < 1e-4 && diff > -1e-4);
+        delete db;
         printf ("english database test ok.\n");
     }
 } test_english_database;
@@ -21,8 +21,11 @@
 #ifndef __PY_ENGLISH_EDITOR_
 #define __PY_ENGLISH_EDITOR_
 
+#include <string>
+#include <vector>
 #include "PYEditor.h"
 #include "PYLookupTable.h"
+#include "PYEnglishPrefixIndex.h"
 
 namespace PY {
 
@@ -48,6 +51,7 @@ private:
     gboolean updateStateFromInput (void);
 
     void clearLookupTable (void);
+    gboolean fillLookupTable (void);
     void updateLookupTable (void);
     void updatePreeditText (void);
     void updateAuxiliaryText (void);
@@ -67,6 +71,22 @@ private:
 
     gboolean train(const char *word, float delta);
 
+    /* the words of a typed prefix fetched so far,
+       complete when no word was left out. */
+    struct Completion {
+        String prefix;
+        std::vector<EnglishPrefixIndex::Entry> entries;
+        /* the keyset cursor, the last word fetched for the prefix
+           or for the shorter prefix it was narrowed from. */
+        EnglishPrefixIndex::Entry last;
+        gboolean fetched;
+        gboolean complete;
+        /* the generation of the database when listed. */
+        guint generation;
+    };
+
+    const Completion *lookupCompletion (const String & prefix);
+
 private:
     /* variables */
     LookupTable m_lookup_table;
@@ -76,6 +96,10 @@ private:
 
     EnglishDatabase *m_english_database;
 
+    /* the completions of the prefixes of the current prefix,
+       the last one is of the longest, see lookupCompletion. */
+    std::vector<Completion> m_completions;
+
     const static int m_aux_text_len = 50;
 };
 
@@ -0,0 +1,229 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PYEnglishPrefixIndex.h"
+#include <algorithm>
+
+using namespace PY;
+
+static const guint32 NO_NODE = G_MAXUINT32;
+
+const guint EnglishPrefixIndex::TOP_K;
+
+EnglishPrefixIndex::EnglishPrefixIndex ()
+    : m_built (FALSE)
+{
+    clear ();
+}
+
+void
+EnglishPrefixIndex::clear (void)
+{
+    m_words.clear ();
+    m_nodes.clear ();
+    /* the root. */
+    m_nodes.push_back (Node ());
+    m_built = FALSE;
+}
+
+bool
+EnglishPrefixIndex::before (guint32 lhs, guint32 rhs) const
+{
+    const Word & left = m_words[lhs];
+    const Word & right = m_words[rhs];
+
+    if (left.freq != right.freq)
+        return left.freq > right.freq;
+    return left.text < right.text;
+}
+
+/* the keyset cursor, whether the word comes after the entry. */
+bool
+EnglishPrefixIndex::follows (guint32 word, const Entry *after) const
+{
+    if (NULL == after)
+        return true;
+
+    const Word & item = m_words[word];
+    if (item.freq != after->freq)
+        return item.freq < after->freq;
+    return item.text > after->word;
+}
+
+guint32
+EnglishPrefixIndex::findChild (guint32 node, gchar letter) const
+{
+    const std::vector<std::pair<gchar, guint32> > & children =
+        m_nodes[node].children;
+
+    std::vector<std::pair<gchar, guint32> >::const_iterator iter =
+        std::lower_bound (children.begin (), children.end (),
+                          std::make_pair (letter, (guint32) 0));
+
+    if (iter == children.end () || iter->first != letter)
+        return NO_NODE;
+    return iter->second;
+}
+
+guint32
+EnglishPrefixIndex::addChild (guint32 node, gchar letter)
+{
+    guint32 child = findChild (node, letter);
+    if (NO_NODE != child)
+        return child;
+
+    child = m_nodes.size ();
+    m_nodes.push_back (Node ());
+
+    std::vector<std::pair<gchar, guint32> > & children =
+        m_nodes[node].children;
+    children.insert (std::lower_bound (children.begin (), children.end (),
+                                       std::make_pair (letter, (guint32) 0)),
+                     std::make_pair (letter, child));
+    return child;
+}
+
+/* the top words of a node are among its own words
+   and the top words of its children. */
+void
+EnglishPrefixIndex::updateTop (guint32 node)
+{
+    m_candidates.assign (m_nodes[node].words.begin (),
+                         m_nodes[node].words.end ());
+
+    const std::vector<std::pair<gchar, guint32> > & children =
+        m_nodes[node].children;
+    for (guint i = 0; i < children.size (); ++i) {
+        const std::vector<guint32> & top = m_nodes[children[i].second].top;
+        m_candidates.insert (m_candidates.end (), top.begin (), top.end ());
+    }
+
+    guint len = std::min ((guint) m_candidates.size (), TOP_K);
+    std::partial_sort (m_candidates.begin (), m_candidates.begin () + len,
+                       m_candidates.end (),
+                       [this] (guint32 lhs, guint32 rhs) {
+                           return before (lhs, rhs);
+                       });
+
+    m_nodes[node].top.assign (m_candidates.begin (),
+                              m_candidates.begin () + len);
+}
+
+void
+EnglishPrefixIndex::add (const char *word, float freq)
+{
+    std::vector<guint32> path;
+    guint32 node = 0;
+
+    path.push_back (node);
+    for (const char *p = word; *p; ++p) {
+        node = addChild (node, g_ascii_tolower (*p));
+        path.push_back (node);
+    }
+
+    std::vector<guint32> & words = m_nodes[node].words;
+    guint i;
+    for (i = 0; i < words.size (); ++i) {
+        if (m_words[words[i]].text == word)
+            break;
+    }
+
+    if (i == words.size ()) {
+        Word item = { word, 0 };
+        words.push_back (m_words.size ());
+        m_words.push_back (item);
+    }
+    m_words[words[i]].freq += freq;
+
+    if (!m_built)
+        return;
+
+    /* only the nodes on the path of the word change. */
+    for (guint j = path.size (); j > 0; --j)
+        updateTop (path[j - 1]);
+}
+
+void
+EnglishPrefixIndex::build (void)
+{
+    /* the children are created after their parents,
+       so a reversed walk visits the children first. */
+    for (guint32 node = m_nodes.size (); node > 0; --node)
+        updateTop (node - 1);
+
+    m_built = TRUE;
+}
+
+gboolean
+EnglishPrefixIndex::list (const char *prefix, const Entry *after,
+                          guint limit, std::vector<Entry> & entries) const
+{
+    entries.clear ();
+
+    guint32 node = 0;
+    for (const char *p = prefix; *p && NO_NODE != node; ++p)
+        node = findChild (node, g_ascii_tolower (*p));
+
+    if (NO_NODE == node)
+        return TRUE;
+
+    /* the top words are the first words of the whole list, serve the
+       page from them when it does not run past a full top. */
+    const std::vector<guint32> & top = m_nodes[node].top;
+    guint start = 0;
+    while (start < top.size () && !follows (top[start], after))
+        ++start;
+
+    if (top.size () < TOP_K || start + limit < top.size ()) {
+        guint end = std::min ((guint) top.size (), start + limit);
+        for (guint i = start; i < end; ++i) {
+            Entry entry = { m_words[top[i]].text, m_words[top[i]].freq };
+            entries.push_back (entry);
+        }
+        return end == top.size () && top.size () < TOP_K;
+    }
+
+    /* past the top words, walk the whole subtree of the prefix. */
+    std::vector<guint32> ids;
+    std::vector<guint32> nodes (1, node);
+    while (!nodes.empty ()) {
+        const Node & current = m_nodes[nodes.back ()];
+        nodes.pop_back ();
+
+        for (guint i = 0; i < current.words.size (); ++i) {
+            if (follows (current.words[i], after))
+                ids.push_back (current.words[i]);
+        }
+        for (guint i = 0; i < current.children.size (); ++i)
+            nodes.push_back (current.children[i].second);
+    }
+
+    guint len = std::min ((guint) ids.size (), limit);
+    std::partial_sort (ids.begin (), ids.begin () + len, ids.end (),
+                       [this] (guint32 lhs, guint32 rhs) {
+                           return before (lhs, rhs);
+                       });
+
+    for (guint i = 0; i < len; ++i) {
+        Entry entry = { m_words[ids[i]].text, m_words[ids[i]].freq };
+        entries.push_back (entry);
+    }
+    return len == ids.size ();
+}
@@ -0,0 +1,91 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PY_ENGLISH_PREFIX_INDEX_H_
+#define __PY_ENGLISH_PREFIX_INDEX_H_
+
+#include <string>
+#include <utility>
+#include <vector>
+#include <glib.h>
+
+namespace PY {
+
+/* the English words in a trie of their lower case letters, each node
+   keeps the top words below it by the sum of the system and user
+   frequencies, so a prefix is listed in the time of its length. */
+class EnglishPrefixIndex {
+public:
+    /* the words kept at each node. */
+    static const guint TOP_K = 64;
+
+    /* a listed word, also the cursor to list the words after it. */
+    struct Entry {
+        std::string word;
+        float freq;
+    };
+
+    EnglishPrefixIndex ();
+
+    /* adds the frequency to the word, call build () after adding
+       the words of the databases, later adds update the index. */
+    void add (const char *word, float freq);
+    void build (void);
+    void clear (void);
+
+    /* at most limit words with the prefix after the cursor in freq
+       order, ignoring the case like LIKE, a NULL cursor lists from the
+       first word, returns TRUE when no word is left after them. */
+    gboolean list (const char *prefix, const Entry *after, guint limit,
+                   std::vector<Entry> & entries) const;
+
+private:
+    struct Word {
+        std::string text;
+        float freq;
+    };
+
+    struct Node {
+        /* sorted by the letter. */
+        std::vector<std::pair<gchar, guint32> > children;
+        /* the words ending here, which differ only in case. */
+        std::vector<guint32> words;
+        /* the ids of the top words, in the order of before (). */
+        std::vector<guint32> top;
+    };
+
+    bool before (guint32 lhs, guint32 rhs) const;
+    bool follows (guint32 word, const Entry *after) const;
+
+    guint32 findChild (guint32 node, gchar letter) const;
+    guint32 addChild (guint32 node, gchar letter);
+    void updateTop (guint32 node);
+
+    std::vector<Word> m_words;
+    std::vector<Node> m_nodes;
+    gboolean m_built;
+
+    /* scratch buffer of updateTop. */
+    std::vector<guint32> m_candidates;
+};
+
+};
+
+#endif
@@ -35,6 +35,7 @@ static LibPinyinBackEnd libpinyin_backend;
 LibPinyinBackEnd::LibPinyinBackEnd () {
     m_timeout_id = 0;
     m_timer = g_timer_new ();
+    g_rec_mutex_init (&m_mutex);
     m_pinyin_context = NULL;
     m_chewing_context = NULL;
 }
@@ -52,6 +53,7 @@ LibPinyinBackEnd::~LibPinyinBackEnd () {
     if (m_chewing_context)
         pinyin_fini(m_chewing_context);
     m_chewing_context = NULL;
+    g_rec_mutex_clear (&m_mutex);
 }
 
 pinyin_context_t *
@@ -83,9 +85,9 @@ LibPinyinBackEnd::initPinyinContext (Config *config)
 }
 
 pinyin_instance_t *
-LibPinyinBackEnd::allocPinyinInstance ()
+LibPinyinBackEnd::allocPinyinInstance (Config *config)
 {
-    Config * config = &PinyinConfig::instance ();
+    Locker locker;
     if (NULL == m_pinyin_context) {
         m_pinyin_context = initPinyinContext (config);
     }
@@ -97,6 +99,7 @@ LibPinyinBackEnd::allocPinyinInstance ()
 void
 LibPinyinBackEnd::freePinyinInstance (pinyin_instance_t *instance)
 {
+    Locker locker;
     pinyin_free_instance (instance);
 }
 
@@ -129,9 +132,9 @@ LibPinyinBackEnd::initChewingContext (Config *config)
 }
 
 pinyin_instance_t *
-LibPinyinBackEnd::allocChewingInstance ()
+LibPinyinBackEnd::allocChewingInstance (Config *config)
 {
-    Config *config = &BopomofoConfig::instance ();
+    Locker locker;
     if (NULL == m_chewing_context) {
         m_chewing_context = initChewingContext (config);
     }
@@ -143,6 +146,7 @@ LibPinyinBackEnd::allocChewingInstance ()
 void
 LibPinyinBackEnd::freeChewingInstance (pinyin_instance_t *instance)
 {
+    Locker locker;
     pinyin_free_instance (instance);
 }
 
@@ -164,12 +168,14 @@ LibPinyinBackEnd::setPinyinOptions (Config *config)
     if (NULL == m_pinyin_context)
         return FALSE;
 
+    lock ();
     DoublePinyinScheme scheme = config->doublePinyinSchema ();
     pinyin_set_double_pinyin_scheme (m_pinyin_context, scheme);
 
     pinyin_option_t options = config->option()
         | USE_RESPLIT_TABLE | USE_DIVIDED_TABLE;
     pinyin_set_options (m_pinyin_context, options);
+    unlock ();
     return TRUE;
 }
 
@@ -179,11 +185,13 @@ LibPinyinBackEnd::setChewingOptions (Config *config)
     if (NULL == m_chewing_context)
         return FALSE;
 
+    lock ();
     ZhuyinScheme scheme = config->bopomofoKeyboardMapping ();
     pinyin_set_zhuyin_scheme (m_chewing_context, scheme);
 
     pinyin_option_t options = config->option() | USE_TONE;
     pinyin_set_options(m_chewing_context, options);
+    unlock ();
     return TRUE;
 }
 
@@ -209,10 +217,12 @@ LibPinyinBackEnd::importPinyinDictionary (const char *filename)
     if (NULL == dictfile)
         return FALSE;
 
+    lock ();
     import_iterator_t * iter = pinyin_begin_add_phrases
         (m_pinyin_context, USER_DICTIONARY);
 
     if (NULL == iter) {
+        unlock ();
         fclose(dictfile);
         return FALSE;
     }
@@ -248,6 +258,7 @@ LibPinyinBackEnd::importPinyinDictionary (const char *filename)
     fclose (dictfile);
 
     pinyin_save (m_pinyin_context);
+    unlock ();
     return TRUE;
 }
 
@@ -259,10 +270,12 @@ LibPinyinBackEnd::exportPinyinDictionary (const char *filename)
     if (NULL == dictfile)
         return FALSE;
 
+    lock ();
     export_iterator_t * iter = pinyin_begin_get_phrases
         (m_pinyin_context, USER_DICTIONARY);
 
     if (NULL == iter) {
+        unlock ();
         fclose(dictfile);
         return FALSE;
     }
@@ -283,6 +296,7 @@ LibPinyinBackEnd::exportPinyinDictionary (const char *filename)
     }
 
     pinyin_end_get_phrases(iter);
+    unlock ();
     fclose (dictfile);
     return TRUE;
 }
@@ -293,6 +307,7 @@ LibPinyinBackEnd::clearPinyinUserData (const char *target)
     if (NULL == m_pinyin_context)
         return FALSE;
 
+    lock ();
     if (0 == strcmp ("all", target)) {
         pinyin_mask_out (m_pinyin_context, 0x0, 0x0);
     } else if (0 == strcmp ("user", target)) {
@@ -307,6 +322,7 @@ LibPinyinBackEnd::clearPinyinUserData (const char *target)
     }
 
     pinyin_save (m_pinyin_context);
+    unlock ();
     return TRUE;
 }
 
@@ -316,6 +332,7 @@ LibPinyinBackEnd::rememberUserInput (pinyin_instance_t *instance,
 {
     /* pre-check the incomplete pinyin keys, prepare pinyin string,
        remember user input. */
+    Locker locker;
     pinyin_remember_user_input (instance, phrase, -1);
 
     /* save later,
@@ -343,9 +360,11 @@ LibPinyinBackEnd::timeoutCallback (gpointer data)
 gboolean
 LibPinyinBackEnd::saveUserDB (void)
 {
+    lock ();
     if (m_pinyin_context)
         pinyin_save (m_pinyin_context);
     if (m_chewing_context)
         pinyin_save (m_chewing_context);
+    unlock ();
     return TRUE;
 }
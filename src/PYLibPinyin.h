@@ -43,9 +43,9 @@ public:
     pinyin_context_t * initPinyinContext (Config *config);
     pinyin_context_t * initChewingContext (Config *config);
 
-    pinyin_instance_t *allocPinyinInstance ();
+    pinyin_instance_t *allocPinyinInstance (Config *config);
     void freePinyinInstance (pinyin_instance_t *instance);
-    pinyin_instance_t *allocChewingInstance ();
+    pinyin_instance_t *allocChewingInstance (Config *config);
     void freeChewingInstance (pinyin_instance_t *instance);
     void modified (void);
 
@@ -55,6 +55,20 @@ public:
 
     gboolean rememberUserInput (pinyin_instance_t *instance, const gchar *phrase);
 
+    /* the libpinyin contexts are not thread safe, every call into
+       libpinyin holds this lock, in the main loop and in the
+       GuessWorker thread alike. it is recursive, the editors nest
+       their locked sections. never wait for the worker with it. */
+    void lock (void) { g_rec_mutex_lock (&m_mutex); }
+    void unlock (void) { g_rec_mutex_unlock (&m_mutex); }
+
+    /* holds the lock in a scope. */
+    class Locker {
+    public:
+        Locker () { instance ().lock (); }
+        ~Locker () { instance ().unlock (); }
+    };
+
     /* use static initializer in C++. */
     static LibPinyinBackEnd & instance (void) { return *m_instance; }
 
@@ -73,6 +87,7 @@ private:
 
     guint m_timeout_id;
     GTimer *m_timer;
+    GRecMutex m_mutex;
 
 private:
     static std::unique_ptr<LibPinyinBackEnd> m_instance;
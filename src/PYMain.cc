@@ -22,6 +22,8 @@
 #  include "config.h"
 #endif
 #include <ibus.h>
+#include <glib-unix.h>
+#include <signal.h>
 #include <stdlib.h>
 #include <locale.h>
 #include <libintl.h>
@@ -31,6 +33,7 @@
 #include "PYConfig.h"
 #include "PYPConfig.h"
 #include "PYLibPinyin.h"
+#include "PYPTrace.h"
 
 using namespace PY;
 
@@ -68,6 +71,23 @@ ibus_disconnected_cb (IBusBus  *bus,
 }
 
 
+/* kill -USR1 dumps the key latency histograms, kill -USR2 resets them. */
+static gboolean
+trace_dump_cb (gpointer user_data)
+{
+    String output;
+    KeyTrace::instance ().dump (output);
+    g_message ("key latency:\n%s", output.c_str ());
+    return TRUE;
+}
+
+static gboolean
+trace_reset_cb (gpointer user_data)
+{
+    KeyTrace::instance ().reset ();
+    return TRUE;
+}
+
 static void
 start_component (void)
 {
@@ -87,11 +107,14 @@ start_component (void)
     }
 
     LibPinyinBackEnd::init ();
+    KeyTrace::init ();
 
     PinyinConfig::init ();
     BopomofoConfig::init ();
 
     g_signal_connect ((IBusBus *)bus, "disconnected", G_CALLBACK (ibus_disconnected_cb), NULL);
+    g_unix_signal_add (SIGUSR1, trace_dump_cb, NULL);
+    g_unix_signal_add (SIGUSR2, trace_reset_cb, NULL);
 
     component = ibus_component_new ("org.freedesktop.IBus.Libpinyin",
                                     N_("Libpinyin input method"),
@@ -141,8 +164,6 @@ start_component (void)
     ibus_main ();
 }
 
-#include <signal.h>
-
 static void
 sigterm_cb (int sig)
 {
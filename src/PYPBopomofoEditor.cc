@@ -45,11 +45,13 @@ BopomofoEditor::BopomofoEditor
     : PhoneticEditor (props, config),
       m_select_mode (FALSE)
 {
-    m_instance = LibPinyinBackEnd::instance ().allocChewingInstance ();
+    m_instance = LibPinyinBackEnd::instance ().allocChewingInstance (&m_config);
+    updateBopomofoKeys ();
 }
 
 BopomofoEditor::~BopomofoEditor (void)
 {
+    cancelGuess ();
     LibPinyinBackEnd::instance ().freeChewingInstance (m_instance);
     m_instance = NULL;
 }
@@ -69,8 +71,7 @@ BopomofoEditor::insert (gint ch)
         return TRUE;
 
     m_text.insert (m_cursor++, ch);
-    updatePinyin ();
-    update ();
+    scheduleUpdate ();
 
     return TRUE;
 }
@@ -163,6 +164,36 @@ BopomofoEditor::processSelectKey (guint keyval, guint keycode,
     return TRUE;
 }
 
+gboolean
+BopomofoEditor::isBopomofoKey (guint keyval)
+{
+    if (keyval >= G_N_ELEMENTS (m_bopomofo_keys))
+        return FALSE;
+
+    if (G_UNLIKELY (m_bopomofo_scheme != m_config.bopomofoKeyboardMapping ()))
+        updateBopomofoKeys ();
+
+    return m_bopomofo_keys[keyval];
+}
+
+void
+BopomofoEditor::updateBopomofoKeys (void)
+{
+    /* the keyboard mapping changed, take m_instance back first. */
+    waitGuess ();
+
+    LibPinyinBackEnd::Locker locker;
+    m_bopomofo_keys[0] = FALSE;
+    for (guint i = 1; i < G_N_ELEMENTS (m_bopomofo_keys); ++i) {
+        gchar ** symbols = NULL;
+        m_bopomofo_keys[i] = pinyin_in_chewing_keyboard
+            (m_instance, i, &symbols);
+        if (m_bopomofo_keys[i])
+            g_strfreev (symbols);
+    }
+    m_bopomofo_scheme = m_config.bopomofoKeyboardMapping ();
+}
+
 gboolean
 BopomofoEditor::processBopomofo (guint keyval, guint keycode,
                                  guint modifiers)
@@ -170,10 +201,8 @@ BopomofoEditor::processBopomofo (guint keyval, guint keycode,
     if (G_UNLIKELY (cmshm_filter (modifiers) != 0))
         return m_text ? TRUE : FALSE;
 
-    gchar ** symbols = NULL;
-    if (!pinyin_in_chewing_keyboard (m_instance, keyval, &symbols))
+    if (!isBopomofoKey (keyval))
         return FALSE;
-    g_strfreev (symbols);
 
     if (keyval == IBUS_space)
         return FALSE;
@@ -195,6 +224,13 @@ BopomofoEditor::processKeyEvent (guint keyval, guint keycode,
                   IBUS_META_MASK |
                   IBUS_LOCK_MASK);
 
+    /* only bopomofo keys and backspace are coalesced,
+       the other keys need the parsed input. */
+    if (m_select_mode || cmshm_filter (modifiers) != 0 ||
+        !(keyval == IBUS_BackSpace ||
+          (keyval != IBUS_space && isBopomofoKey (keyval))))
+        flushUpdate ();
+
     if (G_UNLIKELY (processGuideKey (keyval, keycode, modifiers)))
         return TRUE;
     if (G_UNLIKELY (processSelectKey (keyval, keycode, modifiers)))
@@ -287,20 +323,11 @@ BopomofoEditor::updateLookupTable (void)
     }
 }
 
-void
-BopomofoEditor::updatePinyin (void)
+guint
+BopomofoEditor::parsePinyin (pinyin_instance_t *instance, const String & text)
 {
-    if (G_UNLIKELY (m_text.empty ())) {
-        m_pinyin_len = 0;
-        /* TODO: check whether to replace "" with NULL. */
-        pinyin_parse_more_chewings (m_instance, "");
-        pinyin_guess_sentence (m_instance);
-        return;
-    }
-
-    m_pinyin_len =
-        pinyin_parse_more_chewings (m_instance, m_text.c_str ());
-    pinyin_guess_sentence (m_instance);
+    /* called from the guess worker as well, only use the arguments. */
+    return pinyin_parse_more_chewings (instance, text.c_str ());
 }
 
 void
@@ -314,22 +341,26 @@ BopomofoEditor::commit (const gchar *str)
     /* sentence candidate */
     m_buffer << str;
 
-    /* text after pinyin */
-    const gchar *p = m_text.c_str() + m_pinyin_len;
-    while (*p != '\0') {
-        gchar ** symbols = NULL;
-        if (pinyin_in_chewing_keyboard (m_instance, *p, &symbols)) {
-            g_assert (1 == g_strv_length (symbols));
-            m_buffer << symbols[0];
-            g_strfreev (symbols);
-        } else {
-            if (G_UNLIKELY (m_props.modeFull ())) {
-                m_buffer.appendUnichar (HalfFullConverter::toFull (*p));
+    /* text after pinyin, reset () below waits for the worker,
+       so only hold the lock here. */
+    {
+        LibPinyinBackEnd::Locker locker;
+        const gchar *p = m_text.c_str() + m_pinyin_len;
+        while (*p != '\0') {
+            gchar ** symbols = NULL;
+            if (pinyin_in_chewing_keyboard (m_instance, *p, &symbols)) {
+                g_assert (1 == g_strv_length (symbols));
+                m_buffer << symbols[0];
+                g_strfreev (symbols);
             } else {
-                m_buffer << *p;
+                if (G_UNLIKELY (m_props.modeFull ())) {
+                    m_buffer.appendUnichar (HalfFullConverter::toFull (*p));
+                } else {
+                    m_buffer << *p;
+                }
             }
+            ++p;
         }
-        ++p;
     }
 
     Text text (m_buffer.c_str ());
@@ -344,6 +375,7 @@ BopomofoEditor::updatePreeditText ()
     if (DISPLAY_STYLE_COMPACT == m_config.displayStyle ())
         return;
 
+    LibPinyinBackEnd::Locker locker;
     guint num = 0;
     pinyin_get_n_candidate (m_instance, &num);
 
@@ -361,9 +393,9 @@ BopomofoEditor::updatePreeditText ()
     pinyin_get_candidate (m_instance, 0, &candidate);
     pinyin_get_candidate_type (m_instance, candidate, &type);
 
-    gchar * sentence = NULL;
+    const gchar * sentence = NULL;
     if (NBEST_MATCH_CANDIDATE == type) {
-        pinyin_get_sentence (m_instance, 0, &sentence);
+        sentence = getSentence ().c_str ();
         m_buffer<<m_candidates[0].m_display_string;
     }
 
@@ -393,8 +425,6 @@ BopomofoEditor::updatePreeditText ()
     guint cursor = getPinyinCursor ();
     pinyin_get_character_offset(m_instance, sentence, cursor, &offset);
     Editor::updatePreeditText (preedit_text, offset, TRUE);
-
-    g_free (sentence);
 }
 
 void
@@ -410,10 +440,14 @@ BopomofoEditor::updateAuxiliaryText (void)
 
     m_buffer.clear ();
 
-    gchar * aux_text = NULL;
-    pinyin_get_chewing_auxiliary_text (m_instance, m_cursor, &aux_text);
-    m_buffer << aux_text;
-    g_free(aux_text);
+    if (!m_auxiliary_text.valid (m_revision, m_cursor)) {
+        gchar * aux_text = NULL;
+        LibPinyinBackEnd::Locker locker;
+        pinyin_get_chewing_auxiliary_text (m_instance, m_cursor, &aux_text);
+        m_auxiliary_text.set (m_revision, m_cursor, aux_text ? aux_text : "");
+        g_free (aux_text);
+    }
+    m_buffer << m_auxiliary_text.get ();
 
     /* append rest text */
     const gchar * p = m_text.c_str() + m_pinyin_len;
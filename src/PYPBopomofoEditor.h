@@ -42,6 +42,8 @@ protected:
     gboolean processAuxiliarySelectKey (guint keyval, guint keycode,
                                         guint modifiers);
     gboolean processSelectKey (guint keyval, guint keycode, guint modifiers);
+    gboolean isBopomofoKey (guint keyval);
+    void updateBopomofoKeys (void);
     gboolean processBopomofo (guint keyval, guint keycode, guint modifiers);
     gboolean processKeyEvent (guint keyval, guint keycode, guint modifiers);
 
@@ -50,7 +52,8 @@ protected:
 
     virtual void updatePreeditText ();
     virtual void updateAuxiliaryText ();
-    virtual void updatePinyin (void);
+    virtual guint parsePinyin (pinyin_instance_t *instance,
+                               const String & text);
     virtual void commit (const gchar *str);
     using PhoneticEditor::commit;
 
@@ -58,6 +61,11 @@ protected:
 
     gboolean insert (gint ch);
 
+private:
+    /* the ascii keys on the keyboard of m_bopomofo_scheme, so that
+       isBopomofoKey needs not m_instance while the worker has it. */
+    gboolean m_bopomofo_keys[128];
+    ZhuyinScheme m_bopomofo_scheme;
 };
 
 };
@@ -163,6 +163,8 @@ BopomofoEngine::processKeyEvent (guint keyval, guint keycode, guint modifiers)
     if (modifiers & IBUS_RELEASE_MASK)
         return FALSE;
 
+    TraceScope scope (TRACE_STAGE_PROCESS_KEY);
+
     if (m_props.modeChinese ()) {
         /* return from MODE_SUGGESTION to normal input. */
         if (m_input_mode == MODE_SUGGESTION) {
@@ -175,6 +177,7 @@ BopomofoEngine::processKeyEvent (guint keyval, guint keycode, guint modifiers)
                 return TRUE;
             }
 
+            KeyTrace::instance ().setMode (traceMode ());
             retval = m_editors[m_input_mode]->processKeyEvent (keyval, keycode, modifiers);
 
             if (retval) {
@@ -195,6 +198,7 @@ BopomofoEngine::processKeyEvent (guint keyval, guint keycode, guint modifiers)
                 m_input_mode = MODE_PUNCT;
         }
 
+        KeyTrace::instance ().setMode (traceMode ());
         retval = m_editors[m_input_mode]->processKeyEvent (keyval, keycode, modifiers);
         if (G_UNLIKELY (retval &&
                         m_input_mode != MODE_INIT &&
@@ -332,6 +336,19 @@ BopomofoEngine::commitText (Text & text)
 #endif
 }
 
+TraceMode
+BopomofoEngine::traceMode (void) const
+{
+    switch (m_input_mode) {
+    case MODE_PUNCT:
+        return TRACE_MODE_PUNCT;
+    case MODE_SUGGESTION:
+        return TRACE_MODE_SUGGESTION;
+    default:
+        return TRACE_MODE_BOPOMOFO;
+    }
+}
+
 void
 BopomofoEngine::connectEditorSignals (EditorPtr editor)
 {
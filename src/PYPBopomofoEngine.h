@@ -24,6 +24,7 @@
 
 #include "PYEngine.h"
 #include "PYPinyinProperties.h"
+#include "PYPTrace.h"
 
 namespace PY {
 
@@ -54,6 +55,7 @@ private:
 private:
     void showSetupDialog (void);
     void connectEditorSignals (EditorPtr editor);
+    TraceMode traceMode (void) const;
 
 private:
     void commitText (Text & text);
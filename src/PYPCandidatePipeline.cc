@@ -0,0 +1,113 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PYPCandidatePipeline.h"
+
+using namespace PY;
+
+void
+CandidatePipeline::addStage (TraceStage trace, CandidateWindow window,
+                             EnabledFunc enabled, ProcessFunc process)
+{
+    Stage stage;
+    stage.trace = trace;
+    stage.window = window;
+    stage.enabled = enabled;
+    stage.process = process;
+    stage.active = FALSE;
+    stage.done = 0;
+    m_stages.push_back (stage);
+}
+
+void
+CandidatePipeline::run (std::vector<EnhancedCandidate> & candidates,
+                        guint page_size, guint end)
+{
+    for (guint i = 0; i < m_stages.size (); i++) {
+        Stage & stage = m_stages[i];
+
+        stage.done = 0;
+        stage.active = stage.enabled ? stage.enabled () : TRUE;
+        if (!stage.active)
+            continue;
+
+        TraceScope scope (stage.trace);
+
+        switch (stage.window) {
+        case CANDIDATE_WINDOW_ALL:
+            stage.process (candidates, 0, candidates.size ());
+            break;
+
+        case CANDIDATE_WINDOW_FIRST_PAGE: {
+            guint size = candidates.size ();
+            guint pos = 0;
+            while (pos < size &&
+                   CANDIDATE_NBEST_MATCH == candidates[pos].m_candidate_type)
+                pos++;
+
+            stage.process (candidates, 0, MIN (page_size, size));
+
+            /* the inserted candidates are new to the earlier
+               visible stages, skip them in extend (). */
+            guint inserted = candidates.size () - size;
+            if (0 == inserted)
+                break;
+
+            for (guint j = 0; j < i; j++) {
+                Stage & earlier = m_stages[j];
+                if (earlier.active &&
+                    CANDIDATE_WINDOW_VISIBLE == earlier.window &&
+                    earlier.done >= pos)
+                    earlier.done += inserted;
+            }
+            break;
+        }
+
+        case CANDIDATE_WINDOW_VISIBLE:
+            /* the first page stages read the converted first page. */
+            stage.done = MIN (MAX (end, page_size), candidates.size ());
+            stage.process (candidates, 0, stage.done);
+            break;
+
+        default:
+            g_assert_not_reached ();
+        }
+    }
+}
+
+void
+CandidatePipeline::extend (std::vector<EnhancedCandidate> & candidates,
+                           guint end)
+{
+    end = MIN (end, candidates.size ());
+
+    for (guint i = 0; i < m_stages.size (); i++) {
+        Stage & stage = m_stages[i];
+
+        if (!stage.active || CANDIDATE_WINDOW_VISIBLE != stage.window)
+            continue;
+        if (stage.done >= end)
+            continue;
+
+        TraceScope scope (stage.trace);
+        stage.process (candidates, stage.done, end);
+        stage.done = end;
+    }
+}
@@ -0,0 +1,82 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PY_LIB_PINYIN_CANDIDATE_PIPELINE_H_
+#define __PY_LIB_PINYIN_CANDIDATE_PIPELINE_H_
+
+#include <functional>
+#include <vector>
+#include "PYPEnhancedCandidates.h"
+#include "PYPTrace.h"
+
+namespace PY {
+
+/* the part of the candidates which a stage works on. */
+enum CandidateWindow {
+    /* produces the whole list, runs on every update. */
+    CANDIDATE_WINDOW_ALL = 0,
+    /* reads the first page and may insert candidates after
+       the n-best matches, runs on every update. */
+    CANDIDATE_WINDOW_FIRST_PAGE,
+    /* converts each candidate in place, runs on the candidates
+       just before they are filled into the lookup table. */
+    CANDIDATE_WINDOW_VISIBLE,
+};
+
+/* runs the registered EnhancedCandidates providers in order,
+   each stage is timed into its trace stage. */
+class CandidatePipeline {
+public:
+    /* checked once per update, a disabled stage is skipped
+       until the next update. */
+    typedef std::function<gboolean (void)> EnabledFunc;
+    /* processes the candidates in [begin, end). */
+    typedef std::function<gboolean (std::vector<EnhancedCandidate> &,
+                                    guint, guint)> ProcessFunc;
+
+    void addStage (TraceStage trace, CandidateWindow window,
+                   EnabledFunc enabled, ProcessFunc process);
+
+    /* runs the stages on a new candidate list,
+       the visible stages only up to end. */
+    void run (std::vector<EnhancedCandidate> & candidates,
+              guint page_size, guint end);
+
+    /* runs the visible stages on the candidates up to end. */
+    void extend (std::vector<EnhancedCandidate> & candidates, guint end);
+
+private:
+    struct Stage {
+        TraceStage trace;
+        CandidateWindow window;
+        EnabledFunc enabled;
+        ProcessFunc process;
+
+        gboolean active;
+        /* the visible stage has processed the candidates before. */
+        guint done;
+    };
+
+    std::vector<Stage> m_stages;
+};
+
+};
+
+#endif
@@ -23,6 +23,7 @@
 #include <pinyin.h>
 #include "PYBus.h"
 #include "PYLibPinyin.h"
+#include "PYSimpTradConverter.h"
 
 #define USE_G_SETTINGS_LIST_KEYS 0
 
@@ -37,6 +38,9 @@ const gchar * const CONFIG_REMEMBER_EVERY_INPUT      = "remember-every-input";
 const gchar * const CONFIG_SORT_OPTION               = "sort-candidate-option";
 const gchar * const CONFIG_SHOW_SUGGESTION           = "show-suggestion";
 const gchar * const CONFIG_EMOJI_CANDIDATE           = "emoji-candidate";
+const gchar * const CONFIG_EMOJI_PREFIX_CANDIDATE    = "emoji-prefix-candidate";
+const gchar * const CONFIG_COALESCE_KEYS             = "coalesce-keys";
+const gchar * const CONFIG_ASYNC_CANDIDATES          = "async-candidates";
 const gchar * const CONFIG_SHIFT_SELECT_CANDIDATE    = "shift-select-candidate";
 const gchar * const CONFIG_MINUS_EQUAL_PAGE          = "minus-equal-page";
 const gchar * const CONFIG_COMMA_PERIOD_PAGE         = "comma-period-page";
@@ -49,6 +53,7 @@ const gchar * const CONFIG_INIT_FULL_PUNCT           = "init-full-punct";
 const gchar * const CONFIG_INIT_SIMP_CHINESE         = "init-simplified-chinese";
 const gchar * const CONFIG_DICTIONARIES              = "dictionaries";
 const gchar * const CONFIG_LUA_CONVERTER             = "lua-converter";
+const gchar * const CONFIG_LUA_CALL_BUDGET           = "lua-call-budget";
 const gchar * const CONFIG_OPENCC_CONFIG             = "opencc-config";
 const gchar * const CONFIG_BOPOMOFO_KEYBOARD_MAPPING = "bopomofo-keyboard-mapping";
 const gchar * const CONFIG_SELECT_KEYS               = "select-keys";
@@ -105,6 +110,9 @@ LibPinyinConfig::initDefaultValues (void)
     m_sort_option = SORT_BY_PHRASE_LENGTH_AND_PINYIN_LENGTH_AND_FREQUENCY;
     m_show_suggestion = FALSE;
     m_emoji_candidate = TRUE;
+    m_emoji_prefix_candidate = FALSE;
+    m_coalesce_keys = FALSE;
+    m_async_candidates = FALSE;
 
     m_shift_select_candidate = FALSE;
     m_minus_equal_page = TRUE;
@@ -123,6 +131,7 @@ LibPinyinConfig::initDefaultValues (void)
 
     m_dictionaries = "";
     m_lua_converter = "";
+    m_lua_call_budget = 100;
     m_opencc_config = "s2t.json";
 
     m_main_switch = "<Shift>";
@@ -234,6 +243,9 @@ LibPinyinConfig::readDefaultValues (void)
 
     m_show_suggestion = read (CONFIG_SHOW_SUGGESTION, false);
     m_emoji_candidate = read (CONFIG_EMOJI_CANDIDATE, true);
+    m_emoji_prefix_candidate = read (CONFIG_EMOJI_PREFIX_CANDIDATE, false);
+    m_coalesce_keys = read (CONFIG_COALESCE_KEYS, false);
+    m_async_candidates = read (CONFIG_ASYNC_CANDIDATES, false);
 
     m_dictionaries = read (CONFIG_DICTIONARIES, "");
     m_opencc_config = read (CONFIG_OPENCC_CONFIG, "s2t.json");
@@ -311,10 +323,17 @@ LibPinyinConfig::valueChanged (const std::string &schema_id,
         m_show_suggestion = normalizeGVariant (value, false);
     } else if (CONFIG_EMOJI_CANDIDATE == name) {
         m_emoji_candidate = normalizeGVariant (value, true);
+    } else if (CONFIG_EMOJI_PREFIX_CANDIDATE == name) {
+        m_emoji_prefix_candidate = normalizeGVariant (value, false);
+    } else if (CONFIG_COALESCE_KEYS == name) {
+        m_coalesce_keys = normalizeGVariant (value, false);
+    } else if (CONFIG_ASYNC_CANDIDATES == name) {
+        m_async_candidates = normalizeGVariant (value, false);
     } else if (CONFIG_DICTIONARIES == name) {
         m_dictionaries = normalizeGVariant (value, std::string (""));
     } else if (CONFIG_OPENCC_CONFIG == name) {
         m_opencc_config = normalizeGVariant (value, std::string ("s2t.json"));
+        SimpTradConverter::reload ();
     } else if (CONFIG_MAIN_SWITCH == name) {
         m_main_switch = normalizeGVariant (value, std::string ("<Shift>"));
     } else if (CONFIG_LETTER_SWITCH == name) {
@@ -447,6 +466,12 @@ PinyinConfig::readDefaultValues (void)
 
     /* lua */
     m_lua_converter = read (CONFIG_LUA_CONVERTER, "");
+    m_lua_call_budget = read (CONFIG_LUA_CALL_BUDGET, 100);
+    /* a negative budget turns huge in the guint. */
+    if (m_lua_call_budget > 10000) {
+        m_lua_call_budget = 100;
+        g_warn_if_reached ();
+    }
 
     /* correct pinyin */
     if (read (CONFIG_CORRECT_PINYIN, true))
@@ -508,6 +533,13 @@ PinyinConfig::valueChanged (const std::string &schema_id,
         m_comma_period_page = normalizeGVariant (value, true);
     else if (CONFIG_LUA_CONVERTER == name)
         m_lua_converter = normalizeGVariant (value, std::string (""));
+    else if (CONFIG_LUA_CALL_BUDGET == name) {
+        m_lua_call_budget = normalizeGVariant (value, 100);
+        if (m_lua_call_budget > 10000) {
+            m_lua_call_budget = 100;
+            g_warn_if_reached ();
+        }
+    }
     else if (CONFIG_AUTO_COMMIT == name)
         m_auto_commit = normalizeGVariant (value, false);
     else if (CONFIG_IMPORT_DICTIONARY == name) {
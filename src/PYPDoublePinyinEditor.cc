@@ -40,11 +40,12 @@ DoublePinyinEditor::DoublePinyinEditor
 ( PinyinProperties & props, Config & config)
     : PinyinEditor (props, config)
 {
-    m_instance = LibPinyinBackEnd::instance ().allocPinyinInstance ();
+    m_instance = LibPinyinBackEnd::instance ().allocPinyinInstance (&m_config);
 }
 
 DoublePinyinEditor::~DoublePinyinEditor (void)
 {
+    cancelGuess ();
     LibPinyinBackEnd::instance ().freePinyinInstance (m_instance);
     m_instance = NULL;
 }
@@ -69,8 +70,7 @@ DoublePinyinEditor::insert (gint ch)
 #endif
 
     m_text.insert (m_cursor++, ch);
-    updatePinyin ();
-    update ();
+    scheduleUpdate ();
 
     return TRUE;
 }
@@ -99,20 +99,11 @@ DoublePinyinEditor::processKeyEvent (guint keyval, guint keycode,
     return PinyinEditor::processKeyEvent (keyval, keycode, modifiers);
 }
 
-void
-DoublePinyinEditor::updatePinyin (void)
+guint
+DoublePinyinEditor::parsePinyin (pinyin_instance_t *instance, const String & text)
 {
-    if (G_UNLIKELY (m_text.empty ())) {
-        m_pinyin_len = 0;
-        /* TODO: check whether to replace "" with NULL. */
-        pinyin_parse_more_double_pinyins (m_instance, "");
-        pinyin_guess_sentence(m_instance);
-        return;
-    }
-
-    m_pinyin_len =
-        pinyin_parse_more_double_pinyins (m_instance, m_text.c_str ());
-    pinyin_guess_sentence (m_instance);
+    /* called from the guess worker as well, only use the arguments. */
+    return pinyin_parse_more_double_pinyins (instance, text.c_str ());
 }
 
 
@@ -129,10 +120,14 @@ DoublePinyinEditor::updateAuxiliaryText (void)
 
     m_buffer.clear ();
 
-    gchar * aux_text = NULL;
-    pinyin_get_double_pinyin_auxiliary_text (m_instance, m_cursor, &aux_text);
-    m_buffer << aux_text;
-    g_free(aux_text);
+    if (!m_auxiliary_text.valid (m_revision, m_cursor)) {
+        gchar * aux_text = NULL;
+        LibPinyinBackEnd::Locker locker;
+        pinyin_get_double_pinyin_auxiliary_text (m_instance, m_cursor, &aux_text);
+        m_auxiliary_text.set (m_revision, m_cursor, aux_text ? aux_text : "");
+        g_free (aux_text);
+    }
+    m_buffer << m_auxiliary_text.get ();
 
     /* append rest text */
     const gchar * p = m_text.c_str() + m_pinyin_len;
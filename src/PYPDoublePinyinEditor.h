@@ -39,7 +39,8 @@ public:
 protected:
     /* TODO: to be implemented. */
     virtual void updateAuxiliaryText (void);
-    virtual void updatePinyin (void);
+    virtual guint parsePinyin (pinyin_instance_t *instance,
+                               const String & text);
 
 };
 
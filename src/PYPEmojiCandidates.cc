@@ -34,40 +34,104 @@ EmojiCandidates::EmojiCandidates (Editor *editor)
     m_editor = editor;
 }
 
-static bool compare_match_less_than (const EmojiItem & lhs,
-                                     const EmojiItem & rhs) {
-    return 0 > std::strcmp (lhs.m_emoji_match, rhs.m_emoji_match);
+/* at most these emojis of a keyword go before the other candidates. */
+#define MAX_EMOJI_CANDIDATES 3
+
+/* shorter English prefixes only match whole keywords, the prefixes
+   are off by default as most pinyin is also an English prefix. */
+#define MIN_EMOJI_PREFIX_LEN 3
+
+/* fnv-1a finished by the murmur3 mixer, see scripts/extract_emoji.py. */
+static guint32
+emoji_hash (const char * str, guint32 seed)
+{
+    guint32 hash = 2166136261u ^ seed;
+    for (const unsigned char * p = (const unsigned char *) str; *p; ++p) {
+        hash ^= *p;
+        hash *= 16777619u;
+    }
+
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35u;
+    hash ^= hash >> 16;
+    return hash;
 }
 
-static bool search_emoji (const EmojiItem * emojis,
-                          guint emojis_len,
-                          const char * match,
-                          std::string & emoji) {
-    const EmojiItem item = {match, NULL};
+static const EmojiSlot *
+lookup_emoji (const EmojiTable & table, const char * match)
+{
+    if (0 == table.m_slots_len)
+        return NULL;
 
-    std::pair<const EmojiItem *, const EmojiItem *> range;
-    range = std::equal_range (emojis, emojis + emojis_len,
-                              item, compare_match_less_than);
+    guint32 seed = table.m_seeds[emoji_hash (match, 0) % table.m_seeds_len];
+    const EmojiSlot * slot =
+        &table.m_slots[emoji_hash (match, seed) % table.m_slots_len];
 
-    guint range_len = range.second - range.first;
-    assert(range_len <= 1);
+    /* a miss lands on some other keyword. */
+    if (0 != std::strcmp (table.m_strings + slot->m_match, match))
+        return NULL;
 
-    if (range_len == 1) {
-        const EmojiItem * index = range.first;
+    return slot;
+}
 
-        emoji = index->m_emoji_string;
-        return true;
+/* walks the prefix down english_emoji_trie, one cell per byte. */
+static const EmojiTrieCell *
+lookup_emoji_prefix (const char * prefix)
+{
+    const gint32 cells_len = G_N_ELEMENTS (english_emoji_trie);
+    gint32 state = 0;
+
+    for (const unsigned char * p = (const unsigned char *) prefix; *p; ++p) {
+        gint32 next = english_emoji_trie[state].m_base + *p;
+        if (next >= cells_len || english_emoji_trie[next].m_check != state)
+            return NULL;
+        state = next;
     }
 
-    return false;
+    return &english_emoji_trie[state];
 }
 
 gboolean
 EmojiCandidates::processCandidates (std::vector<EnhancedCandidate> & candidates)
 {
-    EnhancedCandidate enhanced;
-    enhanced.m_candidate_type = CANDIDATE_EMOJI;
-    enhanced.m_candidate_id = 0;
+    const char * strings = NULL;
+    const guint32 * results = NULL;
+    guint32 results_len = 0;
+
+    const EmojiSlot * slot = lookup_emoji (english_emoji_table,
+                                           m_editor->m_text);
+    if (NULL != slot) {
+        strings = english_emoji_table.m_strings;
+        results = english_emoji_table.m_results + slot->m_results_begin;
+        results_len = slot->m_results_len;
+    } else if (m_editor->m_config.emojiPrefixCandidate () &&
+               m_editor->m_text.length () >= MIN_EMOJI_PREFIX_LEN) {
+        const EmojiTrieCell * cell = lookup_emoji_prefix (m_editor->m_text);
+        if (NULL != cell) {
+            strings = english_emoji_table.m_strings;
+            results = english_emoji_trie_results + cell->m_top_begin;
+            results_len = cell->m_top_len;
+        }
+    }
+
+    if (0 == results_len) {
+        guint num = std::min
+            (m_editor->m_config.pageSize (), (guint)candidates.size ());
+        for (guint i = 0; i < num && NULL == slot; ++i)
+            slot = lookup_emoji (chinese_emoji_table,
+                                 candidates[i].m_display_string);
+
+        if (NULL != slot) {
+            strings = chinese_emoji_table.m_strings;
+            results = chinese_emoji_table.m_results + slot->m_results_begin;
+            results_len = slot->m_results_len;
+        }
+    }
+
+    if (0 == results_len)
+        return FALSE;
 
     std::vector<EnhancedCandidate>::iterator pos;
     for (pos = candidates.begin (); pos != candidates.end (); ++pos) {
@@ -75,38 +139,23 @@ EmojiCandidates::processCandidates (std::vector<EnhancedCandidate> & candidates)
             break;
     }
 
-    std::string emoji;
-    if (search_emoji (english_emoji_table,
-                      G_N_ELEMENTS (english_emoji_table),
-                      m_editor->m_text, emoji)) {
-        enhanced.m_display_string = emoji;
-        candidates.insert (pos, enhanced);
-        return TRUE;
-    } else {
-        int num = std::min
-            (m_editor->m_config.pageSize (), (guint)candidates.size ());
-        for (int i = 0; i < num; ++i) {
-            String text = candidates[i].m_display_string;
-
-            if (search_emoji (chinese_emoji_table,
-                              G_N_ELEMENTS (chinese_emoji_table),
-                              text, emoji)) {
-
-                enhanced.m_display_string = emoji;
-                candidates.insert (pos, enhanced);
-                return TRUE;
-            }
-        }
+    guint len = std::min (results_len, (guint32) MAX_EMOJI_CANDIDATES);
+    EnhancedCandidate enhanced;
+    enhanced.m_candidate_type = CANDIDATE_EMOJI;
+    for (guint i = 0; i < len; ++i) {
+        enhanced.m_candidate_id = i;
+        enhanced.m_display_string = strings + results[i];
+        pos = candidates.insert (pos, enhanced) + 1;
     }
 
-    return FALSE;
+    return TRUE;
 }
 
 int
 EmojiCandidates::selectCandidate (EnhancedCandidate & enhanced)
 {
     assert (CANDIDATE_EMOJI == enhanced.m_candidate_type);
-    assert (0 == enhanced.m_candidate_id);
+    assert (enhanced.m_candidate_id < MAX_EMOJI_CANDIDATES);
 
     return SELECT_CANDIDATE_COMMIT;
 }
@@ -115,7 +164,7 @@ gboolean
 EmojiCandidates::removeCandidate (EnhancedCandidate & enhanced)
 {
     assert (CANDIDATE_EMOJI == enhanced.m_candidate_type);
-    assert (0 == enhanced.m_candidate_id);
+    assert (enhanced.m_candidate_id < MAX_EMOJI_CANDIDATES);
 
     return FALSE;
 }
@@ -4,3305 +4,8322 @@
 #ifndef __PY_LIB_PINYIN_EMOJI_TABLE_H
 #define __PY_LIB_PINYIN_EMOJI_TABLE_H
 
+#include <glib.h>
+
 namespace PY{
 
+/* the offsets are into the strings of the table,
+   where each keyword and emoji ends with '\0'. */
+typedef struct {
+    guint32 m_match;
+    /* the emojis of the keyword in the results. */
+    guint32 m_results_begin;
+    guint32 m_results_len;
+} EmojiSlot;
+
+/* a minimal perfect hash of the keywords, see lookup_emoji. */
 typedef struct {
-    const char * m_emoji_match;
-    const char * m_emoji_string;
-} EmojiItem;
+    const char * m_strings;
+    const EmojiSlot * m_slots;
+    guint32 m_slots_len;
+    const guint32 * m_results;
+    const guint32 * m_seeds;
+    guint32 m_seeds_len;
+} EmojiTable;
+
+/* a byte c moves from cell s to t = m_base of s + c when the m_check
+   of t is s, the top emojis of the keywords with the prefix ending at
+   a cell are offsets into the strings, see lookup_emoji_prefix. */
+typedef struct {
+    gint32 m_base;
+    gint32 m_check;
+    guint32 m_top_begin;
+    guint32 m_top_len;
+} EmojiTrieCell;
+
+static const char english_emoji_strings[] =
+    "juice\0" "🥤\0"
+    "tree\0" "🌲\0"
+    "loud\0" "🔊\0"
+    "bottle\0" "🍼\0"
+    "chain\0" "⛓\0"
+    "goal\0" "🥍\0"
+    "banana\0" "🍌\0"
+    "brain\0" "🧠\0"
+    "down\0" "👇\0"
+    "guide\0" "🦮\0"
+    "hook\0" "🪝\0"
+    "coffee\0" "☕\0"
+    "low\0" "🔅\0"
+    "oyster\0" "🦪\0"
+    "clean\0" "🪥\0"
+    "vice\0" "🗜\0"
+    "smile\0" "😃\0"
+    "tuxedo\0" "🤵\0"
+    "cl\0" "🆑\0"
+    "lock\0" "🔓\0"
+    "helmet\0" "🪖\0"
+    "olive\0" "🫒\0"
+    "ox\0" "🐂\0"
+    "face\0" "🥸\0"
+    "blond\0" "👱\0"
+    "speed\0" "🚄\0"
+    "ginger\0" "🦰\0"
+    "banner\0" "🎋\0"
+    "up\0" "👆\0"
+    "teller\0" "🏧\0"
+    "fuel\0" "⛽\0"
+    "spots\0" "🦒\0"
+    "sleigh\0" "🛷\0"
+    "north\0" "⬆\0"
+    "chair\0" "💺\0"
+    "jack\0" "🎃\0"
+    "peanut\0" "🥜\0"
+    "ice\0" "🍦\0"
+    "bird\0" "🪶\0"
+    "limb\0" "🦵\0"
+    "iron\0" "🧇\0"
+    "picket\0" "🪧\0"
+    "veil\0" "👰\0"
+    "pick\0" "⛏\0"
+    "tao\0" "☯\0"
+    "blush\0" "😊\0"
+    "salon\0" "💆\0"
+    "raised\0" "🤚\0"
+    "fruit\0" "🍇\0"
+    "knit\0" "🧶\0"
+    "maize\0" "🌽\0"
+    "night\0" "🌃\0"
+    "plate\0" "🍽\0"
+    "cupid\0" "💘\0"
+    "speech\0" "💬\0"
+    "medium\0" "🔉\0"
+    "clay\0" "🧱\0"
+    "doll\0" "🪆\0"
+    "fever\0" "🦟\0"
+    "poop\0" "💩\0"
+    "picnic\0" "🧺\0"
+    "temple\0" "🛕\0"
+    "hit\0" "🎯\0"
+    "herd\0" "🦬\0"
+    "waning\0" "🌖\0"
+    "proud\0" "🥲\0"
+    "boxing\0" "🥊\0"
+    "clock\0" "⌚\0"
+    "snow\0" "⛷\0"
+    "comic\0" "💢\0"
+    "luck\0" "🤞\0"
+    "mother\0" "🤶\0"
+    "turkey\0" "🦃\0"
+    "heavy\0" "🪨\0"
+    "hut\0" "🛖\0"
+    "step\0" "🪜\0"
+    "moai\0" "🗿\0"
+    "floppy\0" "💾\0"
+    "swords\0" "⚔\0"
+    "label\0" "🏷\0"
+    "staff\0" "⚕\0"
+    "hushed\0" "😯\0"
+    "glove\0" "🥎\0"
+    "poodle\0" "🐩\0"
+    "ufo\0" "👽\0"
+    "twine\0" "🪢\0"
+    "wood\0" "🪵\0"
+    "dance\0" "🕺\0"
+    "safety\0" "🦺\0"
+    "page\0" "📃\0"
+    "not\0" "⛔\0"
+    "scale\0" "⚖\0"
+    "bearer\0" "🐍\0"
+    "slot\0" "🎰\0"
+    "tomato\0" "🍅\0"
+    "knot\0" "🪢\0"
+    "panda\0" "🐼\0"
+    "boat\0" "🚣\0"
+    "seal\0" "🦭\0"
+    "pirate\0" "🦜\0"
+    "field\0" "🏑\0"
+    "store\0" "🏪\0"
+    "horns\0" "😈\0"
+    "fox\0" "🦊\0"
+    "bat\0" "🦇\0"
+    "paddle\0" "🏓\0"
+    "lemon\0" "🍋\0"
+    "stop\0" "🚏\0"
+    "purse\0" "👛\0"
+    "top\0" "🎩\0"
+    "person\0" "🧑\0"
+    "shave\0" "🪒\0"
+    "mail\0" "💌\0"
+    "beach\0" "🏖\0"
+    "brown\0" "🤎\0"
+    "foot\0" "🦶\0"
+    "three\0" "🕒\0"
+    "tea\0" "🧋\0"
+    "bride\0" "👰\0"
+    "woolly\0" "🦣\0"
+    "coder\0" "🧑‍💻\0"
+    "second\0" "🥈\0"
+    "watch\0" "⌚\0"
+    "net\0" "🥅\0"
+    "turtle\0" "🐢\0"
+    "name\0" "📛\0"
+    "berry\0" "🫐\0"
+    "cable\0" "🚠\0"
+    "eyes\0" "🤩\0"
+    "snail\0" "🐌\0"
+    "guard\0" "💂\0"
+    "locker\0" "🛅\0"
+    "cork\0" "🍾\0"
+    "father\0" "🎅\0"
+    "dupe\0" "♟\0"
+    "dvd\0" "📀\0"
+    "food\0" "🫒\0"
+    "bucket\0" "🪣\0"
+    "beads\0" "📿\0"
+    "thanks\0" "🫂\0"
+    "inbox\0" "📥\0"
+    "frame\0" "🪟\0"
+    "flame\0" "🔥\0"
+    "female\0" "🐑\0"
+    "soccer\0" "⚽\0"
+    "board\0" "🛹\0"
+    "stripe\0" "🦓\0"
+    "fire\0" "🚒\0"
+    "mask\0" "😷\0"
+    "egg\0" "🥚\0"
+    "taste\0" "😝\0"
+    "tophat\0" "🎩\0"
+    "paper\0" "📜\0"
+    "gift\0" "🧧\0"
+    "judge\0" "🧑‍⚖\0"
+    "file\0" "📁\0"
+    "upward\0" "📈\0"
+    "pulse\0" "🫀\0"
+    "ocean\0" "🌊\0"
+    "third\0" "🥉\0"
+    "cask\0" "🪣\0"
+    "light\0" "🪶\0"
+    "palm\0" "🤦\0"
+    "joy\0" "😂\0"
+    "art\0" "🎭\0"
+    "dodo\0" "🦤\0"
+    "blue\0" "🫐\0"
+    "groom\0" "🤵\0"
+    "skull\0" "💀\0"
+    "sob\0" "😭\0"
+    "danger\0" "⚡\0"
+    "house\0" "🪴\0"
+    "leg\0" "🦵\0"
+    "paw\0" "🐾\0"
+    "vhs\0" "📼\0"
+    "train\0" "🚂\0"
+    "puck\0" "🏒\0"
+    "polish\0" "💅\0"
+    "candle\0" "🕯\0"
+    "om\0" "🕉\0"
+    "folder\0" "📁\0"
+    "skewer\0" "🍢\0"
+    "nerd\0" "🤓\0"
+    "pump\0" "⛽\0"
+    "scream\0" "😱\0"
+    "fondue\0" "🫕\0"
+    "beat\0" "🪘\0"
+    "silent\0" "😶\0"
+    "fax\0" "📠\0"
+    "patrol\0" "🚓\0"
+    "cookie\0" "🍪\0"
+    "jug\0" "🏺\0"
+    "stomp\0" "🦶\0"
+    "leaf\0" "🌿\0"
+    "spider\0" "🕷\0"
+    "metal\0" "🪙\0"
+    "waving\0" "👋\0"
+    "elf\0" "🧝\0"
+    "ramen\0" "🍜\0"
+    "soda\0" "🥤\0"
+    "skill\0" "🤹\0"
+    "rhythm\0" "🪘\0"
+    "bear\0" "🐻\0"
+    "hike\0" "🚶\0"
+    "joker\0" "🃏\0"
+    "parrot\0" "🦜\0"
+    "pastry\0" "🍥\0"
+    "jiaozi\0" "🥟\0"
+    "wrench\0" "🛠\0"
+    "south\0" "⬇\0"
+    "makeup\0" "💄\0"
+    "punch\0" "✊\0"
+    "ill\0" "🤒\0"
+    "kneel\0" "🧎\0"
+    "pasta\0" "🍝\0"
+    "pan\0" "🍳\0"
+    "versus\0" "🆚\0"
+    "bored\0" "🥱\0"
+    "mouth\0" "😃\0"
+    "six\0" "🕕\0"
+    "plant\0" "🪴\0"
+    "mobile\0" "📱\0"
+    "wry\0" "😼\0"
+    "web\0" "🕸\0"
+    "puzzle\0" "🧩\0"
+    "hello\0" "🫂\0"
+    "cheese\0" "🫕\0"
+    "bike\0" "🚵\0"
+    "insect\0" "🪲\0"
+    "mug\0" "🍺\0"
+    "rice\0" "🌾\0"
+    "crush\0" "🥰\0"
+    "road\0" "🛣\0"
+    "gas\0" "⛽\0"
+    "cop\0" "👮\0"
+    "gear\0" "⚙\0"
+    "lift\0" "🛗\0"
+    "gene\0" "🧬\0"
+    "index\0" "👈\0"
+    "idea\0" "💡\0"
+    "rugby\0" "🏉\0"
+    "chime\0" "🎐\0"
+    "army\0" "🪖\0"
+    "body\0" "👂\0"
+    "wizard\0" "🪄\0"
+    "hear\0" "🙉\0"
+    "trend\0" "📈\0"
+    "sun\0" "😎\0"
+    "bow\0" "🙇\0"
+    "laugh\0" "😆\0"
+    "euro\0" "💶\0"
+    "bath\0" "🛀\0"
+    "horse\0" "🏇\0"
+    "map\0" "🗺\0"
+    "abc\0" "🔤\0"
+    "pilot\0" "🧑‍✈\0"
+    "alarm\0" "⏰\0"
+    "pouch\0" "👝\0"
+    "b\0" "🅱\0"
+    "maple\0" "🍁\0"
+    "search\0" "🔍\0"
+    "naan\0" "🫓\0"
+    "moyai\0" "🗿\0"
+    "home\0" "🏠\0"
+    "wool\0" "🦙\0"
+    "sushi\0" "🍣\0"
+    "taxi\0" "🚕\0"
+    "string\0" "🧵\0"
+    "lie\0" "🤥\0"
+    "abcd\0" "🔡\0"
+    "one\0" "🕐\0"
+    "broken\0" "💔\0"
+    "urn\0" "⚱\0"
+    "drop\0" "☔\0"
+    "glass\0" "🥛\0"
+    "steak\0" "🥩\0"
+    "break\0" "💔\0"
+    "trophy\0" "🏆\0"
+    "joey\0" "🦘\0"
+    "notes\0" "🎶\0"
+    "litter\0" "🚮\0"
+    "cow\0" "🐮\0"
+    "film\0" "🎞\0"
+    "male\0" "🐏\0"
+    "twelve\0" "🕛\0"
+    "mark\0" "❣\0"
+    "pad\0" "🗒\0"
+    "organ\0" "🫀\0"
+    "cup\0" "🍵\0"
+    "pail\0" "🪣\0"
+    "fork\0" "🍽\0"
+    "sled\0" "🛷\0"
+    "outbox\0" "📤\0"
+    "green\0" "💚\0"
+    "hippo\0" "🦛\0"
+    "hurt\0" "🤕\0"
+    "input\0" "🔠\0"
+    "sos\0" "🆘\0"
+    "plane\0" "🧑‍✈\0"
+    "sledge\0" "🛷\0"
+    "fish\0" "🐟\0"
+    "bakery\0" "🥯\0"
+    "view\0" "🪟\0"
+    "shirt\0" "🎽\0"
+    "cherry\0" "🌸\0"
+    "thirty\0" "🕧\0"
+    "pester\0" "🦡\0"
+    "dusk\0" "🌆\0"
+    "reload\0" "🔃\0"
+    "rocket\0" "🧑‍🚀\0"
+    "diesel\0" "⛽\0"
+    "wall\0" "🧱\0"
+    "zap\0" "⚡\0"
+    "carrot\0" "🥕\0"
+    "charm\0" "🧿\0"
+    "kite\0" "🪁\0"
+    "lamp\0" "🪔\0"
+    "tear\0" "🥲\0"
+    "zzz\0" "😴\0"
+    "rung\0" "🪜\0"
+    "suit\0" "🕴\0"
+    "sly\0" "🦝\0"
+    "dagger\0" "🗡\0"
+    "walk\0" "🚶\0"
+    "filing\0" "🗄\0"
+    "left\0" "◀\0"
+    "subway\0" "🚇\0"
+    "bunny\0" "🐰\0"
+    "weary\0" "😩\0"
+    "islam\0" "🕌\0"
+    "crab\0" "🦀\0"
+    "shrimp\0" "🍤\0"
+    "ironic\0" "😼\0"
+    "fast\0" "⏩\0"
+    "hair\0" "👱\0"
+    "death\0" "💀\0"
+    "girl\0" "👧\0"
+    "yum\0" "😋\0"
+    "flight\0" "🪶\0"
+    "pole\0" "💈\0"
+    "eight\0" "🕗\0"
+    "music\0" "🎼\0"
+    "thongs\0" "🩴\0"
+    "rain\0" "⛈\0"
+    "door\0" "🚪\0"
+    "studio\0" "🎙\0"
+    "boar\0" "🐗\0"
+    "hold\0" "🧑‍🤝‍🧑\0"
+    "dove\0" "🕊\0"
+    "cowboy\0" "🤠\0"
+    "crook\0" "🪝\0"
+    "socks\0" "🧦\0"
+    "rose\0" "🌹\0"
+    "yang\0" "☯\0"
+    "frying\0" "🍳\0"
+    "imp\0" "👿\0"
+    "fairy\0" "🧚\0"
+    "prize\0" "🏆\0"
+    "statue\0" "🗽\0"
+    "child\0" "🧒\0"
+    "flex\0" "💪\0"
+    "skis\0" "🎿\0"
+    "grape\0" "🍇\0"
+    "duck\0" "🦆\0"
+    "clink\0" "🍻\0"
+    "man\0" "👨\0"
+    "flag\0" "🏳‍⚧\0"
+    "knife\0" "🍽\0"
+    "gloves\0" "🧤\0"
+    "prayer\0" "🤲\0"
+    "medal\0" "🎖\0"
+    "hooray\0" "🙌\0"
+    "chapel\0" "💒\0"
+    "bag\0" "👜\0"
+    "sweat\0" "😅\0"
+    "yacht\0" "⛵\0"
+    "resort\0" "⛵\0"
+    "pickup\0" "🛻\0"
+    "fly\0" "🪰\0"
+    "bento\0" "🍱\0"
+    "weight\0" "🏋\0"
+    "cog\0" "⚙\0"
+    "lotion\0" "🧴\0"
+    "clown\0" "🤡\0"
+    "biking\0" "🚴\0"
+    "angel\0" "😇\0"
+    "tiger\0" "🐯\0"
+    "eleven\0" "🕚\0"
+    "roach\0" "🪳\0"
+    "water\0" "🤽\0"
+    "bomb\0" "💣\0"
+    "bowl\0" "🍜\0"
+    "wisent\0" "🦬\0"
+    "five\0" "🕔\0"
+    "mango\0" "🥭\0"
+    "bronze\0" "🥉\0"
+    "ng\0" "🆖\0"
+    "off\0" "📴\0"
+    "moon\0" "🌑\0"
+    "hockey\0" "🏑\0"
+    "angry\0" "😡\0"
+    "torch\0" "🔦\0"
+    "maggot\0" "🪰\0"
+    "castle\0" "🏯\0"
+    "full\0" "💯\0"
+    "scroll\0" "📜\0"
+    "beer\0" "🍺\0"
+    "new\0" "🆕\0"
+    "blind\0" "🧑‍🦯\0"
+    "biceps\0" "💪\0"
+    "yen\0" "💴\0"
+    "camera\0" "🤳\0"
+    "old\0" "🧓\0"
+    "bed\0" "🛏\0"
+    "bricks\0" "🧱\0"
+    "vat\0" "🪣\0"
+    "french\0" "🥐\0"
+    "garden\0" "🏡\0"
+    "shorts\0" "🩳\0"
+    "museum\0" "🖼\0"
+    "ashes\0" "⚱\0"
+    "russia\0" "🪆\0"
+    "quench\0" "🧯\0"
+    "hotel\0" "🛌\0"
+    "dazed\0" "😳\0"
+    "santa\0" "🎅\0"
+    "nib\0" "✒\0"
+    "mage\0" "🧙\0"
+    "sleuth\0" "🕵\0"
+    "ski\0" "⛷\0"
+    "kiwi\0" "🥝\0"
+    "cd\0" "💿\0"
+    "jeans\0" "👖\0"
+    "gun\0" "🔫\0"
+    "claim\0" "🛄\0"
+    "rat\0" "🐀\0"
+    "cinema\0" "🎥\0"
+    "lorry\0" "🚛\0"
+    "tray\0" "📤\0"
+    "broom\0" "🧹\0"
+    "yin\0" "☯\0"
+    "divide\0" "➗\0"
+    "die\0" "🎲\0"
+    "ninja\0" "🥷\0"
+    "bisque\0" "🦞\0"
+    "key\0" "🔐\0"
+    "banjo\0" "🪕\0"
+    "roller\0" "🛼\0"
+    "curry\0" "🍛\0"
+    "shrine\0" "⛩\0"
+    "curly\0" "🦱\0"
+    "monkey\0" "🙈\0"
+    "talk\0" "🦜\0"
+    "deer\0" "🦌\0"
+    "zodiac\0" "👧\0"
+    "owl\0" "🦉\0"
+    "eject\0" "⏏\0"
+    "pound\0" "💷\0"
+    "crown\0" "👑\0"
+    "cereal\0" "🥣\0"
+    "pill\0" "💊\0"
+    "dialog\0" "💬\0"
+    "bust\0" "👤\0"
+    "bread\0" "🍞\0"
+    "lifter\0" "🏋\0"
+    "jacket\0" "🧥\0"
+    "sloth\0" "🦥\0"
+    "couch\0" "🛋\0"
+    "inside\0" "💠\0"
+    "paella\0" "🥘\0"
+    "muscle\0" "💪\0"
+    "rushed\0" "😰\0"
+    "joke\0" "😜\0"
+    "grain\0" "🌾\0"
+    "needle\0" "🪡\0"
+    "dharma\0" "☸\0"
+    "latin\0" "🔠\0"
+    "tulip\0" "🌷\0"
+    "shot\0" "🥃\0"
+    "squid\0" "🦑\0"
+    "bug\0" "🪲\0"
+    "snare\0" "🪤\0"
+    "two\0" "🕑\0"
+    "kebab\0" "🥙\0"
+    "seat\0" "💺\0"
+    "nut\0" "🥜\0"
+    "bull\0" "🐂\0"
+    "fried\0" "🍤\0"
+    "gray\0" "🦳\0"
+    "spy\0" "🕵\0"
+    "tipsy\0" "🥴\0"
+    "tusk\0" "🦣\0"
+    "chick\0" "🐣\0"
+    "salad\0" "🥗\0"
+    "gold\0" "🪙\0"
+    "bait\0" "🪤\0"
+    "quiet\0" "🤫\0"
+    "milk\0" "🧋\0"
+    "back\0" "🔙\0"
+    "taco\0" "🌮\0"
+    "swan\0" "🦢\0"
+    "bar\0" "🍫\0"
+    "radio\0" "📻\0"
+    "shower\0" "🚿\0"
+    "secure\0" "🔐\0"
+    "shrug\0" "🤷\0"
+    "canoe\0" "🛶\0"
+    "bulb\0" "💡\0"
+    "dice\0" "🎲\0"
+    "mercy\0" "🥺\0"
+    "magnet\0" "🧲\0"
+    "grow\0" "🪴\0"
+    "cake\0" "🍥\0"
+    "congee\0" "🥣\0"
+    "help\0" "💁\0"
+    "twist\0" "🪢\0"
+    "c\0" "©\0"
+    "sorry\0" "🙇\0"
+    "ballet\0" "🩰\0"
+    "ten\0" "🕙\0"
+    "box\0" "🍱\0"
+    "weapon\0" "🔪\0"
+    "east\0" "➡\0"
+    "score\0" "💯\0"
+    "prawn\0" "🍤\0"
+    "djinn\0" "🧞\0"
+    "diya\0" "🪔\0"
+    "meat\0" "🍖\0"
+    "swirl\0" "🍥\0"
+    "ewe\0" "🐑\0"
+    "brick\0" "🧱\0"
+    "atm\0" "🏧\0"
+    "garlic\0" "🧄\0"
+    "breath\0" "🫁\0"
+    "circle\0" "⏺\0"
+    "brush\0" "🪥\0"
+    "memo\0" "📝\0"
+    "laptop\0" "💻\0"
+    "yawn\0" "🥱\0"
+    "flower\0" "💐\0"
+    "salt\0" "🧂\0"
+    "letter\0" "💌\0"
+    "melon\0" "🍈\0"
+    "zipper\0" "🤐\0"
+    "sand\0" "⌛\0"
+    "comet\0" "☄\0"
+    "print\0" "👣\0"
+    "stew\0" "🍲\0"
+    "plug\0" "🔌\0"
+    "oden\0" "🍢\0"
+    "dark\0" "🌑\0"
+    "wink\0" "😉\0"
+    "dollar\0" "💰\0"
+    "hocho\0" "🔪\0"
+    "ticket\0" "🎟\0"
+    "pepper\0" "🫑\0"
+    "clover\0" "🍀\0"
+    "skier\0" "⛷\0"
+    "bleed\0" "🩸\0"
+    "racing\0" "🏃‍♂\0"
+    "chart\0" "💹\0"
+    "otter\0" "🦦\0"
+    "target\0" "🎯\0"
+    "turban\0" "👳\0"
+    "care\0" "💅\0"
+    "bison\0" "🦬\0"
+    "video\0" "📻\0"
+    "adore\0" "🥰\0"
+    "dragon\0" "🐲\0"
+    "selfie\0" "🤳\0"
+    "spool\0" "🧵\0"
+    "badge\0" "📛\0"
+    "magic\0" "🪄\0"
+    "birdie\0" "🏸\0"
+    "teeth\0" "🪥\0"
+    "blow\0" "🍃\0"
+    "dart\0" "🎯\0"
+    "travel\0" "🧳\0"
+    "king\0" "👑\0"
+    "math\0" "➕\0"
+    "corn\0" "🌽\0"
+    "chess\0" "♟\0"
+    "bubble\0" "🧋\0"
+    "toy\0" "🪀\0"
+    "bill\0" "💴\0"
+    "coffin\0" "⚰\0"
+    "rope\0" "🪢\0"
+    "o\0" "⭕\0"
+    "please\0" "🙏\0"
+    "hijab\0" "🧕\0"
+    "spock\0" "🖖\0"
+    "lavash\0" "🫓\0"
+    "church\0" "⛪\0"
+    "bowing\0" "🙇‍♂\0"
+    "tabs\0" "📑\0"
+    "earbud\0" "🎧\0"
+    "witch\0" "🪄\0"
+    "pear\0" "🍐\0"
+    "signal\0" "🚥\0"
+    "vs\0" "🆚\0"
+    "motor\0" "🛵\0"
+    "fries\0" "🍟\0"
+    "lumber\0" "🪚\0"
+    "atom\0" "⚛\0"
+    "school\0" "🏫\0"
+    "large\0" "🦣\0"
+    "pine\0" "🎍\0"
+    "dog\0" "🐶\0"
+    "hoop\0" "🏀\0"
+    "hole\0" "🕳\0"
+    "screw\0" "🪛\0"
+    "thread\0" "🧵\0"
+    "zombie\0" "🧟\0"
+    "hoist\0" "🛗\0"
+    "won\0" "😤\0"
+    "swim\0" "🏊\0"
+    "dairy\0" "🧈\0"
+    "rewind\0" "⏪\0"
+    "book\0" "📔\0"
+    "white\0" "🤍\0"
+    "anchor\0" "⚓\0"
+    "piece\0" "🧩\0"
+    "dental\0" "🪥\0"
+    "fog\0" "🌁\0"
+    "pie\0" "🥧\0"
+    "boring\0" "🪴\0"
+    "heel\0" "👠\0"
+    "lather\0" "🧼\0"
+    "koala\0" "🐨\0"
+    "note\0" "🎵\0"
+    "glow\0" "🌟\0"
+    "claus\0" "🎅\0"
+    "hand\0" "👋\0"
+    "wicked\0" "🖤\0"
+    "yellow\0" "💛\0"
+    "speak\0" "🙊\0"
+    "pita\0" "🫓\0"
+    "juggle\0" "🤹\0"
+    "peahen\0" "🦚\0"
+    "cooked\0" "🍚\0"
+    "metro\0" "🚇\0"
+    "slow\0" "🦥\0"
+    "jump\0" "🦘\0"
+    "part\0" "〽\0"
+    "bright\0" "😎\0"
+    "boom\0" "💥\0"
+    "oh\0" "🙀\0"
+    "pencil\0" "✏\0"
+    "ship\0" "⚓\0"
+    "party\0" "🪅\0"
+    "piano\0" "🎹\0"
+    "globe\0" "🌍\0"
+    "pink\0" "🏳‍⚧\0"
+    "razor\0" "🪒\0"
+    "spiny\0" "🦔\0"
+    "tichel\0" "🧕\0"
+    "rays\0" "☀\0"
+    "woman\0" "👩\0"
+    "herb\0" "🌿\0"
+    "loop\0" "➰\0"
+    "nine\0" "🕘\0"
+    "porous\0" "🧽\0"
+    "sneeze\0" "🤧\0"
+    "open\0" "😃\0"
+    "injury\0" "🤕\0"
+    "sash\0" "🎽\0"
+    "closet\0" "🚾\0"
+    "butter\0" "🧈\0"
+    "sweet\0" "🍠\0"
+    "timer\0" "⌛\0"
+    "sauna\0" "🧖\0"
+    "arepa\0" "🫓\0"
+    "family\0" "👪\0"
+    "stink\0" "🦨\0"
+    "knobs\0" "🎛\0"
+    "llama\0" "🦙\0"
+    "pistol\0" "🔫\0"
+    "aid\0" "⛑\0"
+    "karate\0" "🥋\0"
+    "hotdog\0" "🌭\0"
+    "wheel\0" "🎡\0"
+    "whisky\0" "🥃\0"
+    "soon\0" "🔜\0"
+    "graph\0" "💹\0"
+    "sign\0" "🪧\0"
+    "hat\0" "🤠\0"
+    "wine\0" "🍷\0"
+    "red\0" "😡\0"
+    "bacon\0" "🥓\0"
+    "virus\0" "🦟\0"
+    "tram\0" "🚃\0"
+    "maze\0" "🌽\0"
+    "minus\0" "➖\0"
+    "kick\0" "🦵\0"
+    "mate\0" "🧉\0"
+    "steam\0" "🚂\0"
+    "mortar\0" "🧱\0"
+    "cloud\0" "☁\0"
+    "ring\0" "💍\0"
+    "sad\0" "😢\0"
+    "access\0" "♿\0"
+    "record\0" "⏺\0"
+    "ball\0" "🏌\0"
+    "news\0" "📰\0"
+    "scuba\0" "🤿\0"
+    "wave\0" "👋\0"
+    "tamale\0" "🫔\0"
+    "climb\0" "🪜\0"
+    "pickle\0" "🥒\0"
+    "men\0" "👯‍♂\0"
+    "unlock\0" "🔓\0"
+    "timber\0" "🪵\0"
+    "pest\0" "🪰\0"
+    "bald\0" "🦲\0"
+    "mosque\0" "🕌\0"
+    "young\0" "👶\0"
+    "mining\0" "⛏\0"
+    "engine\0" "🚂\0"
+    "honey\0" "🍯\0"
+    "set\0" "📐\0"
+    "nail\0" "💅\0"
+    "shield\0" "🛡\0"
+    "crayon\0" "🖍\0"
+    "fencer\0" "🤺\0"
+    "clue\0" "🧩\0"
+    "happy\0" "🙋\0"
+    "dam\0" "🦫\0"
+    "roll\0" "🥐\0"
+    "lips\0" "💋\0"
+    "drum\0" "🪘\0"
+    "cover\0" "📔\0"
+    "mic\0" "🎙\0"
+    "kaaba\0" "🕋\0"
+    "date\0" "📅\0"
+    "dish\0" "📡\0"
+    "pretty\0" "🦋\0"
+    "golf\0" "🏌\0"
+    "call\0" "🤙\0"
+    "demon\0" "👿\0"
+    "west\0" "⬅\0"
+    "teacup\0" "🍵\0"
+    "mirror\0" "🪞\0"
+    "mouse\0" "🐭\0"
+    "catch\0" "🪝\0"
+    "dung\0" "💩\0"
+    "see\0" "🙈\0"
+    "melted\0" "🫕\0"
+    "semi\0" "🚛\0"
+    "alpaca\0" "🦙\0"
+    "spiral\0" "🐚\0"
+    "sandal\0" "👡\0"
+    "pride\0" "🏳‍🌈\0"
+    "mode\0" "📳\0"
+    "feet\0" "🐾\0"
+    "yarn\0" "🧶\0"
+    "small\0" "🤪\0"
+    "chest\0" "🧰\0"
+    "once\0" "🔂\0"
+    "couple\0" "🧑‍🤝‍🧑\0"
+    "id\0" "🆔\0"
+    "farmer\0" "🧑‍🌾\0"
+    "play\0" "▶\0"
+    "tongue\0" "😛\0"
+    "ram\0" "🐏\0"
+    "spoon\0" "🥄\0"
+    "parcel\0" "📦\0"
+    "closed\0" "😚\0"
+    "slider\0" "🎚\0"
+    "hot\0" "🥵\0"
+    "money\0" "🪙\0"
+    "gyro\0" "🥙\0"
+    "shinto\0" "⛩\0"
+    "curve\0" "🪝\0"
+    "plush\0" "🧸\0"
+    "geek\0" "🤓\0"
+    "rabbit\0" "🐰\0"
+    "afro\0" "🦱\0"
+    "apple\0" "🍎\0"
+    "park\0" "🏞\0"
+    "dash\0" "💨\0"
+    "love\0" "😍\0"
+    "tshirt\0" "👕\0"
+    "sit\0" "🪑\0"
+    "merman\0" "🧜\0"
+    "snake\0" "🐍\0"
+    "adult\0" "🧑\0"
+    "dango\0" "🍡\0"
+    "noodle\0" "🍜\0"
+    "singer\0" "🧑‍🎤\0"
+    "ladder\0" "🪜\0"
+    "sassy\0" "💁\0"
+    "plus\0" "➕\0"
+    "yurt\0" "🛖\0"
+    "worm\0" "🪱\0"
+    "right\0" "▶\0"
+    "hug\0" "🫂\0"
+    "cry\0" "😢\0"
+    "aerial\0" "🚡\0"
+    "entry\0" "⛔\0"
+    "lungs\0" "🫁\0"
+    "skate\0" "🛼\0"
+    "pizza\0" "🍕\0"
+    "pig\0" "🐷\0"
+    "cook\0" "🧑‍🍳\0"
+    "trap\0" "🪤\0"
+    "neck\0" "🧣\0"
+    "vest\0" "🦺\0"
+    "whew\0" "😥\0"
+    "flash\0" "📸\0"
+    "car\0" "🚃\0"
+    "onion\0" "🧅\0"
+    "candy\0" "🍬\0"
+    "clamp\0" "🗜\0"
+    "post\0" "🏣\0"
+    "rolled\0" "🗞\0"
+    "ask\0" "🙏\0"
+    "tada\0" "🎉\0"
+    "dna\0" "🧬\0"
+    "diaper\0" "🧷\0"
+    "waffle\0" "🧇\0"
+    "smirk\0" "😏\0"
+    "emblem\0" "🔱\0"
+    "floor\0" "🤣\0"
+    "queen\0" "👑\0"
+    "mute\0" "🔇\0"
+    "bagel\0" "🥯\0"
+    "credit\0" "💳\0"
+    "disk\0" "💽\0"
+    "arctic\0" "🐻‍❄\0"
+    "movie\0" "🎥\0"
+    "gem\0" "💎\0"
+    "judo\0" "🥋\0"
+    "window\0" "🪟\0"
+    "ghost\0" "👻\0"
+    "coin\0" "🪙\0"
+    "claws\0" "🦞\0"
+    "silver\0" "🪙\0"
+    "coat\0" "🧥\0"
+    "i\0" "ℹ\0"
+    "pc\0" "💻\0"
+    "burger\0" "🍔\0"
+    "barber\0" "💇\0"
+    "shush\0" "🤫\0"
+    "heart\0" "🫀\0"
+    "wolf\0" "🐺\0"
+    "free\0" "🆓\0"
+    "circus\0" "🎪\0"
+    "no\0" "⛔\0"
+    "twins\0" "👬\0"
+    "log\0" "🪵\0"
+    "life\0" "🧬\0"
+    "ledger\0" "📒\0"
+    "ferry\0" "⛴\0"
+    "thumb\0" "👍\0"
+    "artist\0" "🧑‍🎨\0"
+    "ribbon\0" "💝\0"
+    "doubt\0" "🤷\0"
+    "lizard\0" "🦎\0"
+    "prince\0" "🤴\0"
+    "space\0" "🛰\0"
+    "beacon\0" "🚨\0"
+    "straw\0" "🧃\0"
+    "goat\0" "🐐\0"
+    "nose\0" "🥸\0"
+    "bank\0" "🏦\0"
+    "world\0" "🌍\0"
+    "black\0" "🖤\0"
+    "peach\0" "🍑\0"
+    "bee\0" "🐝\0"
+    "police\0" "👮\0"
+    "wrap\0" "🌯\0"
+    "wings\0" "💸\0"
+    "grapes\0" "🍇\0"
+    "level\0" "🎚\0"
+    "toilet\0" "🪠\0"
+    "split\0" "🪓\0"
+    "jewel\0" "💎\0"
+    "pearl\0" "🧋\0"
+    "eye\0" "😄\0"
+    "ogre\0" "👹\0"
+    "axe\0" "🪓\0"
+    "diving\0" "🦪\0"
+    "zebra\0" "🦓\0"
+    "wilted\0" "🥀\0"
+    "hearts\0" "🥰\0"
+    "kiss\0" "😘\0"
+    "stone\0" "🪨\0"
+    "ear\0" "👂\0"
+    "cold\0" "😅\0"
+    "tm\0" "™\0"
+    "solid\0" "🪨\0"
+    "bikini\0" "👙\0"
+    "fist\0" "✊\0"
+    "proof\0" "🧾\0"
+    "citrus\0" "🍋\0"
+    "hump\0" "🐪\0"
+    "on\0" "🔛\0"
+    "actor\0" "🧑‍🎤\0"
+    "scales\0" "🧑‍⚖\0"
+    "undead\0" "🧛\0"
+    "fuji\0" "🗻\0"
+    "goblin\0" "👺\0"
+    "favor\0" "🙇‍♂\0"
+    "button\0" "🔼\0"
+    "scarf\0" "🧣\0"
+    "oil\0" "🛢\0"
+    "cat\0" "😺\0"
+    "pray\0" "🙏\0"
+    "tennis\0" "🎾\0"
+    "tv\0" "📺\0"
+    "good\0" "🦸\0"
+    "soap\0" "🧼\0"
+    "devil\0" "👿\0"
+    "lazy\0" "🦥\0"
+    "check\0" "✅\0"
+    "badger\0" "🦡\0"
+    "finger\0" "🖐\0"
+    "stand\0" "🧍\0"
+    "shoe\0" "👞\0"
+    "dizzy\0" "🥴\0"
+    "square\0" "⏹\0"
+    "houses\0" "🏘\0"
+    "pot\0" "🫕\0"
+    "blonde\0" "👱‍♀\0"
+    "marker\0" "📑\0"
+    "amoeba\0" "🦠\0"
+    "sake\0" "🍶\0"
+    "violin\0" "🎻\0"
+    "parlor\0" "💇\0"
+    "hero\0" "🦸\0"
+    "ink\0" "🔏\0"
+    "lion\0" "🦁\0"
+    "pen\0" "✒\0"
+    "phone\0" "🤳\0"
+    "sleep\0" "😪\0"
+    "frown\0" "🙁\0"
+    "evil\0" "🙈\0"
+    "eagle\0" "🦅\0"
+    "baby\0" "👶\0"
+    "hiking\0" "🥾\0"
+    "hidden\0" "🥷\0"
+    "briefs\0" "🩲\0"
+    "write\0" "✍\0"
+    "cancel\0" "✖\0"
+    "worker\0" "🧑‍🏭\0"
+    "saturn\0" "🪐\0"
+    "tape\0" "📼\0"
+    "r\0" "®\0"
+    "scared\0" "😨\0"
+    "ballot\0" "🗳\0"
+    "beauty\0" "💇\0"
+    "locked\0" "🔒\0"
+    "link\0" "🖇\0"
+    "purple\0" "💜\0"
+    "sword\0" "🤺\0"
+    "genie\0" "🧞\0"
+    "carp\0" "🎏\0"
+    "email\0" "✉\0"
+    "popper\0" "🎉\0"
+    "sent\0" "📤\0"
+    "boot\0" "🥾\0"
+    "sari\0" "🥻\0"
+    "stick\0" "🍢\0"
+    "yoga\0" "🧘\0"
+    "four\0" "🍀\0"
+    "whale\0" "🐳\0"
+    "head\0" "🗣\0"
+    "cart\0" "🛒\0"
+    "sharp\0" "🪒\0"
+    "tower\0" "🗼\0"
+    "shaker\0" "🧂\0"
+    "saw\0" "🪚\0"
+    "women\0" "👯‍♀\0"
+    "beaver\0" "🦫\0"
+    "dim\0" "🔅\0"
+    "liquor\0" "🥃\0"
+    "can\0" "🥫\0"
+    "waxing\0" "🌒\0"
+    "bamboo\0" "🎍\0"
+    "kimono\0" "👘\0"
+    "deaf\0" "🧏\0"
+    "conga\0" "🪘\0"
+    "skunk\0" "🦨\0"
+    "chop\0" "🥩\0"
+    "loaf\0" "🍞\0"
+    "breast\0" "🤱\0"
+    "rage\0" "😡\0"
+    "x\0" "✖\0"
+    "cap\0" "👲\0"
+    "dancer\0" "👯\0"
+    "jockey\0" "🏇\0"
+    "dress\0" "👗\0"
+    "polo\0" "🤽\0"
+    "postal\0" "📯\0"
+    "wavy\0" "〰\0"
+    "robot\0" "🤖\0"
+    "end\0" "🔚\0"
+    "chains\0" "⛓\0"
+    "pet\0" "🐶\0"
+    "sheep\0" "🐏\0"
+    "game\0" "🏐\0"
+    "beetle\0" "🪲\0"
+    "cream\0" "🍦\0"
+    "v\0" "✌\0"
+    "pants\0" "👖\0"
+    "pager\0" "📟\0"
+    "vulcan\0" "🖖\0"
+    "lab\0" "🧪\0"
+    "shell\0" "🐚\0"
+    "pause\0" "⏯\0"
+    "cell\0" "📱\0"
+    "cygnet\0" "🦢\0"
+    "pin\0" "📌\0"
+    "whoops\0" "🤭\0"
+    "poo\0" "💩\0"
+    "molusc\0" "🦑\0"
+    "ferris\0" "🎡\0"
+    "grave\0" "🪦\0"
+    "desert\0" "🏜\0"
+    "boy\0" "👦\0"
+    "wc\0" "🚹\0"
+    "peace\0" "🕊\0"
+    "growth\0" "💹\0"
+    "tooth\0" "🦷\0"
+    "tent\0" "⛺\0"
+    "munch\0" "😱\0"
+    "teapot\0" "🫖\0"
+    "slice\0" "🍕\0"
+    "sax\0" "🎷\0"
+    "shaved\0" "🍧\0"
+    "horn\0" "🥳\0"
+    "sunny\0" "☀\0"
+    "bus\0" "🚌\0"
+    "double\0" "⏩\0"
+    "card\0" "♠\0"
+    "cactus\0" "🌵\0"
+    "vomit\0" "🤢\0"
+    "ruler\0" "📏\0"
+    "beard\0" "🧔\0"
+    "autumn\0" "🥮\0"
+    "point\0" "👈\0"
+    "frames\0" "🎞\0"
+    "sponge\0" "🧽\0"
+    "guitar\0" "🎸\0"
+    "drink\0" "🫖\0"
+    "sea\0" "⛵\0"
+    "earth\0" "🌍\0"
+    "bell\0" "🛎\0"
+    "nazar\0" "🧿\0"
+    "goofy\0" "🤪\0"
+    "bridge\0" "🌉\0"
+    "taoist\0" "☯\0"
+    "cool\0" "😎\0"
+    "m\0" "Ⓜ\0"
+    "camel\0" "🐪\0"
+    "sick\0" "😷\0"
+    "orange\0" "🧡\0"
+    "grin\0" "😀\0"
+    "city\0" "🏙\0"
+    "sunset\0" "🌆\0"
+    "star\0" "🤩\0"
+    "first\0" "🥇\0"
+    "potato\0" "🥔\0"
+    "wind\0" "🍃\0"
+    "doctor\0" "😷\0"
+    "nurse\0" "🧑‍⚕\0"
+    "hammer\0" "🔨\0"
+    "foggy\0" "🌁\0"
+    "hindu\0" "🛕\0"
+    "chef\0" "🧑‍🍳\0"
+    "seven\0" "🕖\0"
+    "ant\0" "🐜\0"
+    "bullet\0" "🚅\0"
+    "shaven\0" "🦲\0"
+    "bone\0" "🦴\0"
+    "ab\0" "🆎\0"
+    "halo\0" "😇\0"
+    "clap\0" "👏\0"
+    "tired\0" "😩\0"
+    "repeat\0" "🔁\0"
+    "archer\0" "🏹\0"
+    "kale\0" "🥬\0"
+    "alien\0" "👽\0"
+    "abacus\0" "🧮\0"
+    "bolt\0" "🔩\0"
+    "soft\0" "🍦\0"
+    "stuffy\0" "🧐\0"
+    "a\0" "🅰\0"
+    "wise\0" "🦉\0"
+    "shake\0" "🤝\0"
+    "ape\0" "🦧\0"
+    "tie\0" "🪢\0"
+    "books\0" "📚\0"
+    "rock\0" "🪨\0"
+    "soar\0" "🪁\0"
+    "meh\0" "😐\0"
+    "curl\0" "📃\0"
+    "cross\0" "🤞\0"
+    "hashi\0" "🥢\0"
+    "island\0" "🏝\0"
+    "donut\0" "🍩\0"
+    "arrow\0" "💘\0"
+    "bead\0" "🧿\0"
+    "sewing\0" "🪡\0"
+    "jigsaw\0" "🧩\0"
+    "sow\0" "🐖\0"
+    "frog\0" "🐸\0"
+    "fear\0" "😨\0"
+    "tool\0" "🪚\0"
+    "shark\0" "🦈\0"
+    "truck\0" "🛻\0"
+    "basket\0" "🧺\0"
+    "mad\0" "😡\0"
+    ;
+
+static const EmojiSlot english_emoji_slots[] = {
+    { 0, 0, 1 },
+    { 11, 1, 1 },
+    { 21, 2, 1 },
+    { 31, 3, 1 },
+    { 43, 4, 1 },
+    { 53, 5, 1 },
+    { 63, 6, 1 },
+    { 75, 7, 1 },
+    { 86, 8, 1 },
+    { 96, 9, 1 },
+    { 107, 10, 1 },
+    { 117, 11, 1 },
+    { 128, 12, 1 },
+    { 137, 13, 1 },
+    { 149, 14, 1 },
+    { 160, 15, 1 },
+    { 170, 16, 1 },
+    { 181, 17, 1 },
+    { 193, 18, 1 },
+    { 201, 19, 1 },
+    { 211, 20, 1 },
+    { 223, 21, 1 },
+    { 234, 22, 1 },
+    { 242, 23, 1 },
+    { 252, 24, 1 },
+    { 263, 25, 1 },
+    { 274, 26, 1 },
+    { 286, 27, 1 },
+    { 298, 28, 1 },
+    { 306, 29, 1 },
+    { 318, 30, 1 },
+    { 327, 31, 1 },
+    { 338, 32, 1 },
+    { 350, 33, 1 },
+    { 360, 34, 1 },
+    { 371, 35, 1 },
+    { 381, 36, 1 },
+    { 393, 37, 1 },
+    { 402, 38, 1 },
+    { 412, 39, 1 },
+    { 422, 40, 1 },
+    { 432, 41, 1 },
+    { 444, 42, 1 },
+    { 454, 43, 1 },
+    { 463, 44, 1 },
+    { 471, 45, 1 },
+    { 482, 46, 1 },
+    { 493, 47, 1 },
+    { 505, 48, 1 },
+    { 516, 49, 1 },
+    { 526, 50, 1 },
+    { 537, 51, 1 },
+    { 548, 52, 1 },
+    { 559, 53, 1 },
+    { 570, 54, 1 },
+    { 582, 55, 1 },
+    { 594, 56, 1 },
+    { 604, 57, 1 },
+    { 614, 58, 1 },
+    { 625, 59, 1 },
+    { 635, 60, 1 },
+    { 647, 61, 1 },
+    { 659, 62, 1 },
+    { 668, 63, 1 },
+    { 678, 64, 1 },
+    { 690, 65, 1 },
+    { 701, 66, 1 },
+    { 713, 67, 1 },
+    { 723, 68, 1 },
+    { 732, 69, 1 },
+    { 743, 70, 1 },
+    { 753, 71, 1 },
+    { 765, 72, 1 },
+    { 777, 73, 1 },
+    { 788, 74, 1 },
+    { 797, 75, 1 },
+    { 807, 76, 1 },
+    { 817, 77, 1 },
+    { 829, 78, 1 },
+    { 840, 79, 1 },
+    { 851, 80, 1 },
+    { 861, 81, 1 },
+    { 873, 82, 1 },
+    { 884, 83, 1 },
+    { 896, 84, 1 },
+    { 905, 85, 1 },
+    { 916, 86, 1 },
+    { 926, 87, 1 },
+    { 937, 88, 1 },
+    { 949, 89, 1 },
+    { 959, 90, 1 },
+    { 967, 91, 1 },
+    { 977, 92, 1 },
+    { 989, 93, 1 },
+    { 999, 94, 1 },
+    { 1011, 95, 1 },
+    { 1021, 96, 1 },
+    { 1032, 97, 1 },
+    { 1042, 98, 1 },
+    { 1052, 99, 1 },
+    { 1064, 100, 1 },
+    { 1075, 101, 1 },
+    { 1086, 102, 1 },
+    { 1097, 103, 1 },
+    { 1106, 104, 1 },
+    { 1115, 105, 1 },
+    { 1127, 106, 1 },
+    { 1138, 107, 1 },
+    { 1148, 108, 1 },
+    { 1159, 109, 1 },
+    { 1168, 110, 1 },
+    { 1180, 111, 1 },
+    { 1191, 112, 1 },
+    { 1201, 113, 1 },
+    { 1212, 114, 1 },
+    { 1223, 115, 1 },
+    { 1233, 116, 1 },
+    { 1244, 117, 1 },
+    { 1253, 118, 1 },
+    { 1264, 119, 1 },
+    { 1276, 120, 1 },
+    { 1294, 121, 1 },
+    { 1306, 122, 1 },
+    { 1316, 123, 1 },
+    { 1325, 124, 1 },
+    { 1337, 125, 1 },
+    { 1347, 126, 1 },
+    { 1358, 127, 1 },
+    { 1369, 128, 1 },
+    { 1379, 129, 1 },
+    { 1390, 130, 1 },
+    { 1401, 131, 1 },
+    { 1413, 132, 1 },
+    { 1423, 133, 1 },
+    { 1435, 134, 1 },
+    { 1444, 135, 1 },
+    { 1453, 136, 1 },
+    { 1463, 137, 1 },
+    { 1475, 138, 1 },
+    { 1486, 139, 1 },
+    { 1498, 140, 1 },
+    { 1509, 141, 1 },
+    { 1520, 142, 1 },
+    { 1531, 143, 1 },
+    { 1543, 144, 1 },
+    { 1554, 145, 1 },
+    { 1565, 146, 1 },
+    { 1577, 147, 1 },
+    { 1587, 148, 1 },
+    { 1597, 149, 1 },
+    { 1606, 150, 1 },
+    { 1617, 151, 1 },
+    { 1629, 152, 1 },
+    { 1640, 153, 1 },
+    { 1650, 154, 1 },
+    { 1667, 155, 1 },
+    { 1677, 156, 1 },
+    { 1689, 157, 1 },
+    { 1700, 158, 1 },
+    { 1711, 159, 1 },
+    { 1722, 160, 1 },
+    { 1732, 161, 1 },
+    { 1743, 162, 1 },
+    { 1753, 163, 1 },
+    { 1762, 164, 1 },
+    { 1771, 165, 1 },
+    { 1781, 166, 1 },
+    { 1791, 167, 1 },
+    { 1802, 168, 1 },
+    { 1813, 169, 1 },
+    { 1822, 170, 1 },
+    { 1833, 171, 1 },
+    { 1844, 172, 1 },
+    { 1853, 173, 1 },
+    { 1862, 174, 1 },
+    { 1871, 175, 1 },
+    { 1882, 176, 1 },
+    { 1892, 177, 1 },
+    { 1904, 178, 1 },
+    { 1916, 179, 1 },
+    { 1924, 180, 1 },
+    { 1936, 181, 1 },
+    { 1948, 182, 1 },
+    { 1958, 183, 1 },
+    { 1967, 184, 1 },
+    { 1979, 185, 1 },
+    { 1991, 186, 1 },
+    { 2001, 187, 1 },
+    { 2013, 188, 1 },
+    { 2022, 189, 1 },
+    { 2034, 190, 1 },
+    { 2046, 191, 1 },
+    { 2055, 192, 1 },
+    { 2066, 193, 1 },
+    { 2076, 194, 1 },
+    { 2088, 195, 1 },
+    { 2099, 196, 1 },
+    { 2111, 197, 1 },
+    { 2120, 198, 1 },
+    { 2131, 199, 1 },
+    { 2141, 200, 1 },
+    { 2152, 201, 1 },
+    { 2164, 202, 1 },
+    { 2174, 203, 1 },
+    { 2184, 204, 1 },
+    { 2195, 205, 1 },
+    { 2207, 206, 1 },
+    { 2219, 207, 1 },
+    { 2231, 208, 1 },
+    { 2243, 209, 1 },
+    { 2253, 210, 1 },
+    { 2265, 211, 1 },
+    { 2275, 212, 1 },
+    { 2284, 213, 1 },
+    { 2295, 214, 1 },
+    { 2306, 215, 1 },
+    { 2315, 216, 1 },
+    { 2327, 217, 1 },
+    { 2338, 218, 1 },
+    { 2349, 219, 1 },
+    { 2358, 220, 1 },
+    { 2369, 221, 1 },
+    { 2381, 222, 1 },
+    { 2390, 223, 1 },
+    { 2399, 224, 1 },
+    { 2411, 225, 1 },
+    { 2422, 226, 1 },
+    { 2434, 227, 1 },
+    { 2444, 228, 1 },
+    { 2456, 229, 1 },
+    { 2465, 230, 1 },
+    { 2475, 231, 1 },
+    { 2486, 232, 1 },
+    { 2496, 233, 1 },
+    { 2504, 234, 1 },
+    { 2513, 235, 1 },
+    { 2522, 236, 1 },
+    { 2532, 237, 1 },
+    { 2542, 238, 1 },
+    { 2553, 239, 1 },
+    { 2563, 240, 1 },
+    { 2574, 241, 1 },
+    { 2585, 242, 1 },
+    { 2595, 243, 1 },
+    { 2605, 244, 1 },
+    { 2617, 245, 1 },
+    { 2627, 246, 1 },
+    { 2638, 247, 1 },
+    { 2647, 248, 1 },
+    { 2656, 249, 1 },
+    { 2667, 250, 1 },
+    { 2677, 251, 1 },
+    { 2687, 252, 1 },
+    { 2698, 253, 1 },
+    { 2707, 254, 1 },
+    { 2716, 255, 1 },
+    { 2733, 256, 1 },
+    { 2743, 257, 1 },
+    { 2754, 258, 1 },
+    { 2761, 259, 1 },
+    { 2772, 260, 1 },
+    { 2784, 261, 1 },
+    { 2794, 262, 1 },
+    { 2805, 263, 1 },
+    { 2815, 264, 1 },
+    { 2825, 265, 1 },
+    { 2836, 266, 1 },
+    { 2846, 267, 1 },
+    { 2858, 268, 1 },
+    { 2867, 269, 1 },
+    { 2877, 270, 1 },
+    { 2886, 271, 1 },
+    { 2898, 272, 1 },
+    { 2906, 273, 1 },
+    { 2915, 274, 1 },
+    { 2926, 275, 1 },
+    { 2937, 276, 1 },
+    { 2948, 277, 1 },
+    { 2960, 278, 1 },
+    { 2970, 279, 1 },
+    { 2981, 280, 1 },
+    { 2993, 281, 1 },
+    { 3002, 282, 1 },
+    { 3012, 283, 1 },
+    { 3022, 284, 1 },
+    { 3034, 285, 1 },
+    { 3043, 286, 1 },
+    { 3052, 287, 1 },
+    { 3063, 288, 1 },
+    { 3072, 289, 1 },
+    { 3082, 290, 1 },
+    { 3092, 291, 1 },
+    { 3102, 292, 1 },
+    { 3114, 293, 1 },
+    { 3125, 294, 1 },
+    { 3136, 295, 1 },
+    { 3146, 296, 1 },
+    { 3157, 297, 1 },
+    { 3166, 298, 1 },
+    { 3183, 299, 1 },
+    { 3195, 300, 1 },
+    { 3205, 301, 1 },
+    { 3217, 302, 1 },
+    { 3227, 303, 1 },
+    { 3238, 304, 1 },
+    { 3250, 305, 1 },
+    { 3262, 306, 1 },
+    { 3274, 307, 1 },
+    { 3284, 308, 1 },
+    { 3296, 309, 1 },
+    { 3315, 310, 1 },
+    { 3326, 311, 1 },
+    { 3336, 312, 1 },
+    { 3344, 313, 1 },
+    { 3356, 314, 1 },
+    { 3367, 315, 1 },
+    { 3377, 316, 1 },
+    { 3387, 317, 1 },
+    { 3397, 318, 1 },
+    { 3406, 319, 1 },
+    { 3416, 320, 1 },
+    { 3426, 321, 1 },
+    { 3435, 322, 1 },
+    { 3447, 323, 1 },
+    { 3457, 324, 1 },
+    { 3469, 325, 1 },
+    { 3478, 326, 1 },
+    { 3490, 327, 1 },
+    { 3501, 328, 1 },
+    { 3512, 329, 1 },
+    { 3523, 330, 1 },
+    { 3533, 331, 1 },
+    { 3545, 332, 1 },
+    { 3557, 333, 1 },
+    { 3566, 334, 1 },
+    { 3576, 335, 1 },
+    { 3587, 336, 1 },
+    { 3597, 337, 1 },
+    { 3606, 338, 1 },
+    { 3618, 339, 1 },
+    { 3628, 340, 1 },
+    { 3639, 341, 1 },
+    { 3650, 342, 1 },
+    { 3662, 343, 1 },
+    { 3671, 344, 1 },
+    { 3681, 345, 1 },
+    { 3693, 346, 1 },
+    { 3703, 347, 1 },
+    { 3727, 348, 1 },
+    { 3737, 349, 1 },
+    { 3749, 350, 1 },
+    { 3760, 351, 1 },
+    { 3771, 352, 1 },
+    { 3781, 353, 1 },
+    { 3790, 354, 1 },
+    { 3802, 355, 1 },
+    { 3811, 356, 1 },
+    { 3822, 357, 1 },
+    { 3833, 358, 1 },
+    { 3845, 359, 1 },
+    { 3856, 360, 1 },
+    { 3866, 361, 1 },
+    { 3876, 362, 1 },
+    { 3887, 363, 1 },
+    { 3897, 364, 1 },
+    { 3908, 365, 1 },
+    { 3917, 366, 1 },
+    { 3933, 367, 1 },
+    { 3944, 368, 1 },
+    { 3956, 369, 1 },
+    { 3968, 370, 1 },
+    { 3979, 371, 1 },
+    { 3991, 372, 1 },
+    { 4003, 373, 1 },
+    { 4012, 374, 1 },
+    { 4023, 375, 1 },
+    { 4033, 376, 1 },
+    { 4044, 377, 1 },
+    { 4056, 378, 1 },
+    { 4065, 379, 1 },
+    { 4076, 380, 1 },
+    { 4088, 381, 1 },
+    { 4096, 382, 1 },
+    { 4108, 383, 1 },
+    { 4119, 384, 1 },
+    { 4131, 385, 1 },
+    { 4142, 386, 1 },
+    { 4153, 387, 1 },
+    { 4165, 388, 1 },
+    { 4176, 389, 1 },
+    { 4187, 390, 1 },
+    { 4197, 391, 1 },
+    { 4207, 392, 1 },
+    { 4219, 393, 1 },
+    { 4229, 394, 1 },
+    { 4240, 395, 1 },
+    { 4252, 396, 1 },
+    { 4260, 397, 1 },
+    { 4269, 398, 1 },
+    { 4279, 399, 1 },
+    { 4291, 400, 1 },
+    { 4302, 401, 1 },
+    { 4313, 402, 1 },
+    { 4325, 403, 1 },
+    { 4337, 404, 1 },
+    { 4347, 405, 1 },
+    { 4359, 406, 1 },
+    { 4369, 407, 1 },
+    { 4378, 408, 1 },
+    { 4396, 409, 1 },
+    { 4408, 410, 1 },
+    { 4417, 411, 1 },
+    { 4429, 412, 1 },
+    { 4438, 413, 1 },
+    { 4447, 414, 1 },
+    { 4459, 415, 1 },
+    { 4468, 416, 1 },
+    { 4480, 417, 1 },
+    { 4492, 418, 1 },
+    { 4504, 419, 1 },
+    { 4516, 420, 1 },
+    { 4526, 421, 1 },
+    { 4538, 422, 1 },
+    { 4550, 423, 1 },
+    { 4561, 424, 1 },
+    { 4572, 425, 1 },
+    { 4583, 426, 1 },
+    { 4591, 427, 1 },
+    { 4601, 428, 1 },
+    { 4613, 429, 1 },
+    { 4621, 430, 1 },
+    { 4631, 431, 1 },
+    { 4639, 432, 1 },
+    { 4650, 433, 1 },
+    { 4659, 434, 1 },
+    { 4670, 435, 1 },
+    { 4679, 436, 1 },
+    { 4691, 437, 1 },
+    { 4702, 438, 1 },
+    { 4712, 439, 1 },
+    { 4723, 440, 1 },
+    { 4731, 441, 1 },
+    { 4742, 442, 1 },
+    { 4751, 443, 1 },
+    { 4762, 444, 1 },
+    { 4774, 445, 1 },
+    { 4783, 446, 1 },
+    { 4794, 447, 1 },
+    { 4806, 448, 1 },
+    { 4817, 449, 1 },
+    { 4828, 450, 1 },
+    { 4839, 451, 1 },
+    { 4851, 452, 1 },
+    { 4861, 453, 1 },
+    { 4871, 454, 1 },
+    { 4883, 455, 1 },
+    { 4892, 456, 1 },
+    { 4902, 457, 1 },
+    { 4913, 458, 1 },
+    { 4924, 459, 1 },
+    { 4936, 460, 1 },
+    { 4946, 461, 1 },
+    { 4958, 462, 1 },
+    { 4968, 463, 1 },
+    { 4979, 464, 1 },
+    { 4991, 465, 1 },
+    { 5003, 466, 1 },
+    { 5014, 467, 1 },
+    { 5025, 468, 1 },
+    { 5037, 469, 1 },
+    { 5049, 470, 1 },
+    { 5061, 471, 1 },
+    { 5073, 472, 1 },
+    { 5083, 473, 1 },
+    { 5094, 474, 1 },
+    { 5106, 475, 1 },
+    { 5117, 476, 1 },
+    { 5128, 477, 1 },
+    { 5139, 478, 1 },
+    { 5149, 479, 1 },
+    { 5160, 480, 1 },
+    { 5169, 481, 1 },
+    { 5180, 482, 1 },
+    { 5189, 483, 1 },
+    { 5200, 484, 1 },
+    { 5210, 485, 1 },
+    { 5219, 486, 1 },
+    { 5229, 487, 1 },
+    { 5240, 488, 1 },
+    { 5250, 489, 1 },
+    { 5259, 490, 1 },
+    { 5270, 491, 1 },
+    { 5280, 492, 1 },
+    { 5291, 493, 1 },
+    { 5302, 494, 1 },
+    { 5312, 495, 1 },
+    { 5322, 496, 1 },
+    { 5333, 497, 1 },
+    { 5343, 498, 1 },
+    { 5353, 499, 1 },
+    { 5363, 500, 1 },
+    { 5373, 501, 1 },
+    { 5382, 502, 1 },
+    { 5393, 503, 1 },
+    { 5405, 504, 1 },
+    { 5417, 505, 1 },
+    { 5428, 506, 1 },
+    { 5439, 507, 1 },
+    { 5449, 508, 1 },
+    { 5459, 509, 1 },
+    { 5470, 510, 1 },
+    { 5482, 511, 1 },
+    { 5492, 512, 1 },
+    { 5502, 513, 1 },
+    { 5514, 514, 1 },
+    { 5524, 515, 1 },
+    { 5535, 516, 1 },
+    { 5540, 517, 1 },
+    { 5551, 518, 1 },
+    { 5563, 519, 1 },
+    { 5572, 520, 1 },
+    { 5581, 521, 1 },
+    { 5593, 522, 1 },
+    { 5602, 523, 1 },
+    { 5613, 524, 1 },
+    { 5624, 525, 1 },
+    { 5635, 526, 1 },
+    { 5645, 527, 1 },
+    { 5655, 528, 1 },
+    { 5666, 529, 1 },
+    { 5675, 530, 1 },
+    { 5686, 531, 1 },
+    { 5695, 532, 1 },
+    { 5707, 533, 1 },
+    { 5719, 534, 1 },
+    { 5730, 535, 1 },
+    { 5741, 536, 1 },
+    { 5751, 537, 1 },
+    { 5763, 538, 1 },
+    { 5773, 539, 1 },
+    { 5785, 540, 1 },
+    { 5795, 541, 1 },
+    { 5807, 542, 1 },
+    { 5818, 543, 1 },
+    { 5830, 544, 1 },
+    { 5839, 545, 1 },
+    { 5849, 546, 1 },
+    { 5860, 547, 1 },
+    { 5870, 548, 1 },
+    { 5880, 549, 1 },
+    { 5890, 550, 1 },
+    { 5900, 551, 1 },
+    { 5910, 552, 1 },
+    { 5922, 553, 1 },
+    { 5933, 554, 1 },
+    { 5945, 555, 1 },
+    { 5957, 556, 1 },
+    { 5969, 557, 1 },
+    { 5979, 558, 1 },
+    { 5990, 559, 1 },
+    { 6008, 560, 1 },
+    { 6019, 561, 1 },
+    { 6030, 562, 1 },
+    { 6042, 563, 1 },
+    { 6054, 564, 1 },
+    { 6064, 565, 1 },
+    { 6075, 566, 1 },
+    { 6086, 567, 1 },
+    { 6097, 568, 1 },
+    { 6109, 569, 1 },
+    { 6121, 570, 1 },
+    { 6132, 571, 1 },
+    { 6143, 572, 1 },
+    { 6154, 573, 1 },
+    { 6166, 574, 1 },
+    { 6177, 575, 1 },
+    { 6187, 576, 1 },
+    { 6197, 577, 1 },
+    { 6209, 578, 1 },
+    { 6219, 579, 1 },
+    { 6228, 580, 1 },
+    { 6238, 581, 1 },
+    { 6248, 582, 1 },
+    { 6260, 583, 1 },
+    { 6269, 584, 1 },
+    { 6279, 585, 1 },
+    { 6290, 586, 1 },
+    { 6300, 587, 1 },
+    { 6306, 588, 1 },
+    { 6318, 589, 1 },
+    { 6329, 590, 1 },
+    { 6340, 591, 1 },
+    { 6352, 592, 1 },
+    { 6363, 593, 1 },
+    { 6381, 594, 1 },
+    { 6391, 595, 1 },
+    { 6403, 596, 1 },
+    { 6414, 597, 1 },
+    { 6424, 598, 1 },
+    { 6436, 599, 1 },
+    { 6444, 600, 1 },
+    { 6455, 601, 1 },
+    { 6466, 602, 1 },
+    { 6478, 603, 1 },
+    { 6487, 604, 1 },
+    { 6499, 605, 1 },
+    { 6510, 606, 1 },
+    { 6520, 607, 1 },
+    { 6529, 608, 1 },
+    { 6539, 609, 1 },
+    { 6549, 610, 1 },
+    { 6560, 611, 1 },
+    { 6572, 612, 1 },
+    { 6584, 613, 1 },
+    { 6595, 614, 1 },
+    { 6604, 615, 1 },
+    { 6614, 616, 1 },
+    { 6625, 617, 1 },
+    { 6636, 618, 1 },
+    { 6646, 619, 1 },
+    { 6657, 620, 1 },
+    { 6668, 621, 1 },
+    { 6679, 622, 1 },
+    { 6691, 623, 1 },
+    { 6700, 624, 1 },
+    { 6709, 625, 1 },
+    { 6721, 626, 1 },
+    { 6731, 627, 1 },
+    { 6743, 628, 1 },
+    { 6754, 629, 1 },
+    { 6764, 630, 1 },
+    { 6774, 631, 1 },
+    { 6785, 632, 1 },
+    { 6795, 633, 1 },
+    { 6807, 634, 1 },
+    { 6819, 635, 1 },
+    { 6830, 636, 1 },
+    { 6840, 637, 1 },
+    { 6852, 638, 1 },
+    { 6864, 639, 1 },
+    { 6876, 640, 1 },
+    { 6887, 641, 1 },
+    { 6897, 642, 1 },
+    { 6907, 643, 1 },
+    { 6916, 644, 1 },
+    { 6928, 645, 1 },
+    { 6938, 646, 1 },
+    { 6946, 647, 1 },
+    { 6957, 648, 1 },
+    { 6966, 649, 1 },
+    { 6977, 650, 1 },
+    { 6988, 651, 1 },
+    { 6999, 652, 1 },
+    { 7015, 653, 1 },
+    { 7026, 654, 1 },
+    { 7037, 655, 1 },
+    { 7049, 656, 1 },
+    { 7058, 657, 1 },
+    { 7069, 658, 1 },
+    { 7079, 659, 1 },
+    { 7088, 660, 1 },
+    { 7098, 661, 1 },
+    { 7110, 662, 1 },
+    { 7122, 663, 1 },
+    { 7132, 664, 1 },
+    { 7144, 665, 1 },
+    { 7154, 666, 1 },
+    { 7166, 667, 1 },
+    { 7178, 668, 1 },
+    { 7189, 669, 1 },
+    { 7199, 670, 1 },
+    { 7210, 671, 1 },
+    { 7221, 672, 1 },
+    { 7233, 673, 1 },
+    { 7244, 674, 1 },
+    { 7255, 675, 1 },
+    { 7266, 676, 1 },
+    { 7278, 677, 1 },
+    { 7286, 678, 1 },
+    { 7298, 679, 1 },
+    { 7310, 680, 1 },
+    { 7321, 681, 1 },
+    { 7333, 682, 1 },
+    { 7343, 683, 1 },
+    { 7354, 684, 1 },
+    { 7364, 685, 1 },
+    { 7373, 686, 1 },
+    { 7383, 687, 1 },
+    { 7392, 688, 1 },
+    { 7403, 689, 1 },
+    { 7414, 690, 1 },
+    { 7424, 691, 1 },
+    { 7434, 692, 1 },
+    { 7444, 693, 1 },
+    { 7454, 694, 1 },
+    { 7464, 695, 1 },
+    { 7475, 696, 1 },
+    { 7487, 697, 1 },
+    { 7497, 698, 1 },
+    { 7507, 699, 1 },
+    { 7516, 700, 1 },
+    { 7527, 701, 1 },
+    { 7538, 702, 1 },
+    { 7548, 703, 1 },
+    { 7558, 704, 1 },
+    { 7569, 705, 1 },
+    { 7579, 706, 1 },
+    { 7591, 707, 1 },
+    { 7602, 708, 1 },
+    { 7614, 709, 1 },
+    { 7629, 710, 1 },
+    { 7641, 711, 1 },
+    { 7653, 712, 1 },
+    { 7663, 713, 1 },
+    { 7673, 714, 1 },
+    { 7685, 715, 1 },
+    { 7696, 716, 1 },
+    { 7707, 717, 1 },
+    { 7719, 718, 1 },
+    { 7730, 719, 1 },
+    { 7739, 720, 1 },
+    { 7749, 721, 1 },
+    { 7761, 722, 1 },
+    { 7773, 723, 1 },
+    { 7785, 724, 1 },
+    { 7795, 725, 1 },
+    { 7806, 726, 1 },
+    { 7815, 727, 1 },
+    { 7825, 728, 1 },
+    { 7835, 729, 1 },
+    { 7845, 730, 1 },
+    { 7856, 731, 1 },
+    { 7865, 732, 1 },
+    { 7876, 733, 1 },
+    { 7886, 734, 1 },
+    { 7896, 735, 1 },
+    { 7908, 736, 1 },
+    { 7918, 737, 1 },
+    { 7928, 738, 1 },
+    { 7939, 739, 1 },
+    { 7948, 740, 1 },
+    { 7960, 741, 1 },
+    { 7972, 742, 1 },
+    { 7983, 743, 1 },
+    { 7994, 744, 1 },
+    { 8004, 745, 1 },
+    { 8013, 746, 1 },
+    { 8025, 747, 1 },
+    { 8035, 748, 1 },
+    { 8047, 749, 1 },
+    { 8059, 750, 1 },
+    { 8071, 751, 1 },
+    { 8089, 752, 1 },
+    { 8099, 753, 1 },
+    { 8109, 754, 1 },
+    { 8119, 755, 1 },
+    { 8130, 756, 1 },
+    { 8141, 757, 1 },
+    { 8151, 758, 1 },
+    { 8177, 759, 1 },
+    { 8185, 760, 1 },
+    { 8204, 761, 1 },
+    { 8213, 762, 1 },
+    { 8225, 763, 1 },
+    { 8234, 764, 1 },
+    { 8245, 765, 1 },
+    { 8257, 766, 1 },
+    { 8269, 767, 1 },
+    { 8281, 768, 1 },
+    { 8290, 769, 1 },
+    { 8301, 770, 1 },
+    { 8311, 771, 1 },
+    { 8322, 772, 1 },
+    { 8333, 773, 1 },
+    { 8344, 774, 1 },
+    { 8354, 775, 1 },
+    { 8366, 776, 1 },
+    { 8376, 777, 1 },
+    { 8387, 778, 1 },
+    { 8397, 779, 1 },
+    { 8407, 780, 1 },
+    { 8417, 781, 1 },
+    { 8429, 782, 1 },
+    { 8438, 783, 1 },
+    { 8450, 784, 1 },
+    { 8461, 785, 1 },
+    { 8472, 786, 1 },
+    { 8483, 787, 1 },
+    { 8495, 788, 1 },
+    { 8514, 789, 1 },
+    { 8526, 790, 1 },
+    { 8537, 791, 1 },
+    { 8546, 792, 1 },
+    { 8556, 793, 1 },
+    { 8566, 794, 1 },
+    { 8576, 795, 1 },
+    { 8585, 796, 1 },
+    { 8594, 797, 1 },
+    { 8606, 798, 1 },
+    { 8616, 799, 1 },
+    { 8627, 800, 1 },
+    { 8638, 801, 1 },
+    { 8649, 802, 1 },
+    { 8658, 803, 1 },
+    { 8675, 804, 1 },
+    { 8685, 805, 1 },
+    { 8695, 806, 1 },
+    { 8705, 807, 1 },
+    { 8715, 808, 1 },
+    { 8726, 809, 1 },
+    { 8735, 810, 1 },
+    { 8746, 811, 1 },
+    { 8757, 812, 1 },
+    { 8768, 813, 1 },
+    { 8778, 814, 1 },
+    { 8790, 815, 1 },
+    { 8799, 816, 1 },
+    { 8809, 817, 1 },
+    { 8818, 818, 1 },
+    { 8830, 819, 1 },
+    { 8842, 820, 1 },
+    { 8853, 821, 1 },
+    { 8865, 822, 1 },
+    { 8876, 823, 1 },
+    { 8887, 824, 1 },
+    { 8897, 825, 1 },
+    { 8908, 826, 1 },
+    { 8920, 827, 1 },
+    { 8930, 828, 1 },
+    { 8948, 829, 1 },
+    { 8959, 830, 1 },
+    { 8968, 831, 1 },
+    { 8978, 832, 1 },
+    { 8990, 833, 1 },
+    { 9001, 834, 1 },
+    { 9011, 835, 1 },
+    { 9022, 836, 1 },
+    { 9034, 837, 1 },
+    { 9044, 838, 1 },
+    { 9050, 839, 1 },
+    { 9058, 840, 1 },
+    { 9070, 841, 1 },
+    { 9082, 842, 1 },
+    { 9093, 843, 1 },
+    { 9104, 844, 1 },
+    { 9114, 845, 1 },
+    { 9124, 846, 1 },
+    { 9136, 847, 1 },
+    { 9143, 848, 1 },
+    { 9154, 849, 1 },
+    { 9163, 850, 1 },
+    { 9173, 851, 1 },
+    { 9185, 852, 1 },
+    { 9195, 853, 1 },
+    { 9206, 854, 1 },
+    { 9225, 855, 1 },
+    { 9237, 856, 1 },
+    { 9248, 857, 1 },
+    { 9260, 858, 1 },
+    { 9272, 859, 1 },
+    { 9283, 860, 1 },
+    { 9295, 861, 1 },
+    { 9306, 862, 1 },
+    { 9316, 863, 1 },
+    { 9326, 864, 1 },
+    { 9336, 865, 1 },
+    { 9347, 866, 1 },
+    { 9358, 867, 1 },
+    { 9369, 868, 1 },
+    { 9378, 869, 1 },
+    { 9390, 870, 1 },
+    { 9400, 871, 1 },
+    { 9411, 872, 1 },
+    { 9423, 873, 1 },
+    { 9434, 874, 1 },
+    { 9446, 875, 1 },
+    { 9457, 876, 1 },
+    { 9468, 877, 1 },
+    { 9479, 878, 1 },
+    { 9488, 879, 1 },
+    { 9498, 880, 1 },
+    { 9507, 881, 1 },
+    { 9519, 882, 1 },
+    { 9530, 883, 1 },
+    { 9542, 884, 1 },
+    { 9554, 885, 1 },
+    { 9564, 886, 1 },
+    { 9575, 887, 1 },
+    { 9584, 888, 1 },
+    { 9594, 889, 1 },
+    { 9601, 890, 1 },
+    { 9612, 891, 1 },
+    { 9624, 892, 1 },
+    { 9633, 893, 1 },
+    { 9644, 894, 1 },
+    { 9656, 895, 1 },
+    { 9666, 896, 1 },
+    { 9674, 897, 1 },
+    { 9692, 898, 1 },
+    { 9710, 899, 1 },
+    { 9722, 900, 1 },
+    { 9732, 901, 1 },
+    { 9744, 902, 1 },
+    { 9761, 903, 1 },
+    { 9773, 904, 1 },
+    { 9784, 905, 1 },
+    { 9793, 906, 1 },
+    { 9802, 907, 1 },
+    { 9812, 908, 1 },
+    { 9824, 909, 1 },
+    { 9832, 910, 1 },
+    { 9842, 911, 1 },
+    { 9852, 912, 1 },
+    { 9863, 913, 1 },
+    { 9873, 914, 1 },
+    { 9883, 915, 1 },
+    { 9895, 916, 1 },
+    { 9907, 917, 1 },
+    { 9918, 918, 1 },
+    { 9928, 919, 1 },
+    { 9939, 920, 1 },
+    { 9950, 921, 1 },
+    { 9962, 922, 1 },
+    { 9971, 923, 1 },
+    { 9989, 924, 1 },
+    { 10001, 925, 1 },
+    { 10013, 926, 1 },
+    { 10023, 927, 1 },
+    { 10035, 928, 1 },
+    { 10047, 929, 1 },
+    { 10057, 930, 1 },
+    { 10066, 931, 1 },
+    { 10076, 932, 1 },
+    { 10084, 933, 1 },
+    { 10095, 934, 1 },
+    { 10106, 935, 1 },
+    { 10117, 936, 1 },
+    { 10127, 937, 1 },
+    { 10138, 938, 1 },
+    { 10148, 939, 1 },
+    { 10160, 940, 1 },
+    { 10172, 941, 1 },
+    { 10184, 942, 1 },
+    { 10194, 943, 1 },
+    { 10205, 944, 1 },
+    { 10224, 945, 1 },
+    { 10236, 946, 1 },
+    { 10246, 947, 1 },
+    { 10251, 948, 1 },
+    { 10263, 949, 1 },
+    { 10275, 950, 1 },
+    { 10287, 951, 1 },
+    { 10299, 952, 1 },
+    { 10309, 953, 1 },
+    { 10321, 954, 1 },
+    { 10332, 955, 1 },
+    { 10343, 956, 1 },
+    { 10353, 957, 1 },
+    { 10363, 958, 1 },
+    { 10375, 959, 1 },
+    { 10385, 960, 1 },
+    { 10395, 961, 1 },
+    { 10405, 962, 1 },
+    { 10416, 963, 1 },
+    { 10426, 964, 1 },
+    { 10436, 965, 1 },
+    { 10447, 966, 1 },
+    { 10457, 967, 1 },
+    { 10467, 968, 1 },
+    { 10478, 969, 1 },
+    { 10489, 970, 1 },
+    { 10501, 971, 1 },
+    { 10510, 972, 1 },
+    { 10527, 973, 1 },
+    { 10539, 974, 1 },
+    { 10548, 975, 1 },
+    { 10560, 976, 1 },
+    { 10569, 977, 1 },
+    { 10581, 978, 1 },
+    { 10593, 979, 1 },
+    { 10605, 980, 1 },
+    { 10615, 981, 1 },
+    { 10626, 982, 1 },
+    { 10637, 983, 1 },
+    { 10647, 984, 1 },
+    { 10657, 985, 1 },
+    { 10669, 986, 1 },
+    { 10679, 987, 1 },
+    { 10685, 988, 1 },
+    { 10694, 989, 1 },
+    { 10706, 990, 1 },
+    { 10718, 991, 1 },
+    { 10729, 992, 1 },
+    { 10739, 993, 1 },
+    { 10751, 994, 1 },
+    { 10760, 995, 1 },
+    { 10771, 996, 1 },
+    { 10780, 997, 1 },
+    { 10791, 998, 1 },
+    { 10800, 999, 1 },
+    { 10811, 1000, 1 },
+    { 10821, 1001, 1 },
+    { 10833, 1002, 1 },
+    { 10844, 1003, 1 },
+    { 10850, 1004, 1 },
+    { 10861, 1005, 1 },
+    { 10872, 1006, 1 },
+    { 10884, 1007, 1 },
+    { 10893, 1008, 1 },
+    { 10904, 1009, 1 },
+    { 10914, 1010, 1 },
+    { 10924, 1011, 1 },
+    { 10936, 1012, 1 },
+    { 10945, 1013, 1 },
+    { 10957, 1014, 1 },
+    { 10966, 1015, 1 },
+    { 10978, 1016, 1 },
+    { 10990, 1017, 1 },
+    { 11001, 1018, 1 },
+    { 11013, 1019, 1 },
+    { 11022, 1020, 1 },
+    { 11030, 1021, 1 },
+    { 11041, 1022, 1 },
+    { 11053, 1023, 1 },
+    { 11064, 1024, 1 },
+    { 11073, 1025, 1 },
+    { 11084, 1026, 1 },
+    { 11096, 1027, 1 },
+    { 11107, 1028, 1 },
+    { 11116, 1029, 1 },
+    { 11128, 1030, 1 },
+    { 11138, 1031, 1 },
+    { 11148, 1032, 1 },
+    { 11157, 1033, 1 },
+    { 11168, 1034, 1 },
+    { 11177, 1035, 1 },
+    { 11189, 1036, 1 },
+    { 11200, 1037, 1 },
+    { 11211, 1038, 1 },
+    { 11222, 1039, 1 },
+    { 11234, 1040, 1 },
+    { 11245, 1041, 1 },
+    { 11257, 1042, 1 },
+    { 11269, 1043, 1 },
+    { 11281, 1044, 1 },
+    { 11292, 1045, 1 },
+    { 11300, 1046, 1 },
+    { 11311, 1047, 1 },
+    { 11321, 1048, 1 },
+    { 11332, 1049, 1 },
+    { 11343, 1050, 1 },
+    { 11355, 1051, 1 },
+    { 11366, 1052, 1 },
+    { 11376, 1053, 1 },
+    { 11382, 1054, 1 },
+    { 11393, 1055, 1 },
+    { 11403, 1056, 1 },
+    { 11415, 1057, 1 },
+    { 11425, 1058, 1 },
+    { 11435, 1059, 1 },
+    { 11447, 1060, 1 },
+    { 11457, 1061, 1 },
+    { 11468, 1062, 1 },
+    { 11480, 1063, 1 },
+    { 11490, 1064, 1 },
+    { 11502, 1065, 1 },
+    { 11519, 1066, 1 },
+    { 11531, 1067, 1 },
+    { 11542, 1068, 1 },
+    { 11553, 1069, 1 },
+    { 11570, 1070, 1 },
+    { 11581, 1071, 1 },
+    { 11590, 1072, 1 },
+    { 11602, 1073, 1 },
+    { 11614, 1074, 1 },
+    { 11624, 1075, 1 },
+    { 11632, 1076, 1 },
+    { 11642, 1077, 1 },
+    { 11652, 1078, 1 },
+    { 11663, 1079, 1 },
+    { 11675, 1080, 1 },
+    { 11687, 1081, 1 },
+    { 11697, 1082, 1 },
+    { 11708, 1083, 1 },
+    { 11720, 1084, 1 },
+    { 11730, 1085, 1 },
+    { 11740, 1086, 1 },
+    { 11752, 1087, 1 },
+    { 11759, 1088, 1 },
+    { 11769, 1089, 1 },
+    { 11780, 1090, 1 },
+    { 11789, 1091, 1 },
+    { 11798, 1092, 1 },
+    { 11809, 1093, 1 },
+    { 11819, 1094, 1 },
+    { 11829, 1095, 1 },
+    { 11838, 1096, 1 },
+    { 11848, 1097, 1 },
+    { 11859, 1098, 1 },
+    { 11870, 1099, 1 },
+    { 11882, 1100, 1 },
+    { 11893, 1101, 1 },
+    { 11904, 1102, 1 },
+    { 11914, 1103, 1 },
+    { 11926, 1104, 1 },
+    { 11938, 1105, 1 },
+    { 11947, 1106, 1 },
+    { 11957, 1107, 1 },
+    { 11967, 1108, 1 },
+    { 11977, 1109, 1 },
+    { 11988, 1110, 1 },
+    { 11999, 1111, 1 },
+    { 12011, 1112, 1 },
+};
+
+static const guint32 english_emoji_results[] = {
+    6, 16, 26, 38, 49, 58, 70, 81,
+    91, 102, 112, 124, 132, 144, 155, 165,
+    176, 188, 196, 206, 218, 229, 237, 247,
+    258, 269, 281, 293, 301, 313, 323, 333,
+    345, 356, 366, 376, 388, 397, 407, 417,
+    427, 439, 449, 459, 467, 477, 488, 500,
+    511, 521, 532, 543, 554, 565, 577, 589,
+    599, 609, 620, 630, 642, 654, 663, 673,
+    685, 696, 708, 719, 728, 738, 748, 760,
+    772, 783, 792, 802, 812, 824, 836, 846,
+    857, 868, 879, 891, 900, 911, 921, 932,
+    944, 954, 963, 973, 984, 994, 1006, 1016,
+    1027, 1037, 1047, 1059, 1070, 1081, 1092, 1101,
+    1110, 1122, 1133, 1143, 1154, 1163, 1175, 1186,
+    1196, 1207, 1218, 1228, 1239, 1248, 1259, 1271,
+    1282, 1301, 1312, 1320, 1332, 1342, 1353, 1364,
+    1374, 1385, 1396, 1408, 1418, 1430, 1440, 1448,
+    1458, 1470, 1481, 1493, 1504, 1515, 1526, 1538,
+    1550, 1560, 1572, 1582, 1592, 1601, 1612, 1624,
+    1635, 1645, 1656, 1672, 1684, 1695, 1706, 1717,
+    1727, 1738, 1748, 1757, 1766, 1776, 1786, 1797,
+    1808, 1817, 1829, 1839, 1848, 1857, 1866, 1877,
+    1887, 1899, 1911, 1919, 1931, 1943, 1953, 1963,
+    1974, 1986, 1996, 2008, 2017, 2029, 2041, 2050,
+    2061, 2071, 2083, 2094, 2106, 2115, 2126, 2136,
+    2147, 2159, 2169, 2179, 2190, 2202, 2214, 2226,
+    2238, 2249, 2260, 2271, 2279, 2290, 2301, 2310,
+    2322, 2333, 2344, 2353, 2364, 2376, 2385, 2394,
+    2406, 2417, 2429, 2439, 2451, 2460, 2470, 2481,
+    2491, 2500, 2508, 2518, 2527, 2537, 2548, 2558,
+    2569, 2580, 2590, 2600, 2612, 2622, 2633, 2642,
+    2651, 2662, 2672, 2682, 2693, 2702, 2711, 2722,
+    2739, 2749, 2756, 2767, 2779, 2789, 2800, 2810,
+    2820, 2831, 2841, 2853, 2862, 2872, 2881, 2893,
+    2902, 2911, 2921, 2932, 2943, 2955, 2965, 2976,
+    2988, 2997, 3007, 3017, 3029, 3039, 3047, 3058,
+    3067, 3077, 3087, 3097, 3109, 3120, 3131, 3141,
+    3152, 3161, 3172, 3190, 3200, 3212, 3222, 3233,
+    3245, 3257, 3269, 3279, 3291, 3303, 3322, 3331,
+    3340, 3351, 3362, 3372, 3382, 3392, 3401, 3411,
+    3421, 3430, 3442, 3452, 3464, 3474, 3485, 3496,
+    3507, 3518, 3528, 3540, 3552, 3562, 3571, 3582,
+    3592, 3601, 3613, 3623, 3634, 3645, 3657, 3667,
+    3676, 3688, 3698, 3708, 3732, 3744, 3755, 3766,
+    3776, 3786, 3797, 3806, 3817, 3828, 3840, 3851,
+    3861, 3871, 3882, 3892, 3903, 3912, 3922, 3939,
+    3951, 3963, 3974, 3986, 3998, 4007, 4018, 4029,
+    4040, 4051, 4060, 4071, 4083, 4092, 4103, 4114,
+    4126, 4137, 4148, 4160, 4171, 4182, 4192, 4202,
+    4214, 4224, 4235, 4247, 4255, 4264, 4274, 4286,
+    4297, 4308, 4320, 4332, 4342, 4354, 4364, 4373,
+    4384, 4403, 4412, 4424, 4433, 4442, 4454, 4463,
+    4475, 4487, 4499, 4511, 4522, 4533, 4545, 4556,
+    4567, 4578, 4587, 4596, 4608, 4617, 4626, 4634,
+    4645, 4654, 4665, 4674, 4686, 4697, 4707, 4718,
+    4727, 4738, 4746, 4757, 4769, 4778, 4789, 4801,
+    4812, 4824, 4834, 4846, 4856, 4866, 4878, 4887,
+    4898, 4908, 4919, 4931, 4941, 4953, 4963, 4974,
+    4986, 4998, 5009, 5020, 5032, 5044, 5056, 5068,
+    5078, 5089, 5101, 5113, 5123, 5134, 5144, 5155,
+    5164, 5175, 5184, 5195, 5205, 5214, 5224, 5235,
+    5245, 5254, 5265, 5275, 5286, 5297, 5307, 5317,
+    5328, 5338, 5348, 5358, 5368, 5377, 5388, 5400,
+    5412, 5423, 5434, 5444, 5454, 5465, 5477, 5487,
+    5497, 5509, 5519, 5530, 5537, 5546, 5558, 5567,
+    5576, 5588, 5598, 5608, 5619, 5630, 5640, 5650,
+    5661, 5670, 5681, 5690, 5702, 5714, 5726, 5736,
+    5746, 5758, 5768, 5780, 5790, 5802, 5813, 5825,
+    5835, 5845, 5855, 5865, 5875, 5885, 5895, 5905,
+    5917, 5928, 5940, 5952, 5964, 5975, 5985, 5997,
+    6014, 6025, 6037, 6049, 6059, 6070, 6081, 6092,
+    6104, 6116, 6127, 6138, 6149, 6161, 6172, 6182,
+    6192, 6204, 6214, 6224, 6233, 6244, 6255, 6264,
+    6274, 6286, 6295, 6302, 6313, 6324, 6335, 6347,
+    6359, 6370, 6386, 6398, 6409, 6419, 6431, 6439,
+    6450, 6461, 6473, 6483, 6494, 6505, 6515, 6524,
+    6534, 6544, 6555, 6567, 6579, 6590, 6599, 6609,
+    6620, 6632, 6641, 6652, 6664, 6674, 6686, 6695,
+    6704, 6716, 6726, 6738, 6749, 6759, 6769, 6780,
+    6790, 6802, 6814, 6825, 6835, 6847, 6859, 6871,
+    6882, 6892, 6902, 6912, 6923, 6933, 6941, 6953,
+    6962, 6972, 6983, 6994, 7004, 7021, 7032, 7044,
+    7054, 7064, 7074, 7084, 7093, 7105, 7117, 7127,
+    7139, 7149, 7161, 7173, 7184, 7195, 7205, 7216,
+    7228, 7239, 7250, 7261, 7273, 7282, 7293, 7305,
+    7316, 7328, 7338, 7349, 7359, 7368, 7378, 7387,
+    7398, 7409, 7419, 7429, 7440, 7449, 7459, 7470,
+    7482, 7493, 7502, 7511, 7523, 7534, 7543, 7553,
+    7564, 7574, 7586, 7597, 7609, 7618, 7636, 7648,
+    7658, 7668, 7680, 7691, 7703, 7714, 7725, 7734,
+    7744, 7756, 7768, 7780, 7790, 7801, 7810, 7820,
+    7830, 7840, 7851, 7860, 7871, 7881, 7891, 7903,
+    7913, 7923, 7934, 7944, 7955, 7967, 7978, 7989,
+    7999, 8008, 8020, 8030, 8042, 8054, 8066, 8077,
+    8094, 8104, 8114, 8125, 8136, 8146, 8158, 8180,
+    8192, 8209, 8220, 8229, 8240, 8252, 8264, 8276,
+    8285, 8296, 8306, 8318, 8328, 8339, 8349, 8361,
+    8371, 8382, 8392, 8402, 8412, 8424, 8433, 8445,
+    8456, 8467, 8478, 8490, 8502, 8521, 8532, 8542,
+    8551, 8561, 8572, 8580, 8589, 8601, 8612, 8622,
+    8633, 8644, 8653, 8663, 8680, 8690, 8700, 8710,
+    8721, 8730, 8741, 8752, 8763, 8773, 8785, 8794,
+    8804, 8813, 8825, 8837, 8848, 8860, 8871, 8882,
+    8892, 8903, 8915, 8925, 8937, 8954, 8963, 8973,
+    8985, 8996, 9006, 9017, 9029, 9039, 9046, 9053,
+    9065, 9077, 9088, 9099, 9109, 9119, 9131, 9139,
+    9149, 9158, 9168, 9180, 9191, 9201, 9213, 9232,
+    9243, 9255, 9267, 9278, 9290, 9301, 9311, 9321,
+    9331, 9342, 9353, 9364, 9373, 9385, 9395, 9406,
+    9418, 9429, 9441, 9452, 9463, 9474, 9483, 9493,
+    9502, 9514, 9525, 9537, 9549, 9559, 9570, 9579,
+    9589, 9597, 9607, 9619, 9629, 9639, 9651, 9661,
+    9669, 9680, 9699, 9717, 9727, 9739, 9750, 9768,
+    9779, 9788, 9797, 9807, 9819, 9827, 9837, 9847,
+    9858, 9868, 9879, 9890, 9902, 9913, 9923, 9934,
+    9946, 9957, 9966, 9978, 9996, 10008, 10018, 10030,
+    10042, 10052, 10061, 10071, 10080, 10090, 10101, 10112,
+    10122, 10133, 10143, 10155, 10167, 10179, 10190, 10201,
+    10212, 10231, 10241, 10248, 10258, 10270, 10282, 10294,
+    10304, 10316, 10327, 10338, 10348, 10359, 10370, 10380,
+    10390, 10400, 10411, 10421, 10431, 10442, 10452, 10462,
+    10473, 10484, 10496, 10505, 10516, 10534, 10543, 10555,
+    10564, 10576, 10588, 10600, 10610, 10621, 10632, 10642,
+    10652, 10664, 10674, 10681, 10689, 10701, 10713, 10724,
+    10734, 10746, 10756, 10766, 10775, 10787, 10795, 10806,
+    10816, 10828, 10839, 10846, 10856, 10867, 10879, 10888,
+    10899, 10910, 10919, 10931, 10940, 10952, 10961, 10973,
+    10985, 10996, 11008, 11017, 11025, 11036, 11048, 11059,
+    11069, 11079, 11091, 11102, 11111, 11123, 11133, 11144,
+    11152, 11164, 11173, 11184, 11195, 11206, 11217, 11229,
+    11240, 11252, 11264, 11276, 11287, 11296, 11306, 11316,
+    11327, 11338, 11350, 11362, 11371, 11378, 11388, 11398,
+    11410, 11420, 11430, 11442, 11452, 11463, 11475, 11485,
+    11497, 11508, 11526, 11537, 11548, 11558, 11576, 11585,
+    11597, 11609, 11619, 11627, 11637, 11647, 11658, 11670,
+    11682, 11692, 11703, 11715, 11725, 11735, 11747, 11754,
+    11764, 11775, 11784, 11793, 11804, 11814, 11824, 11833,
+    11843, 11854, 11865, 11877, 11888, 11899, 11909, 11921,
+    11933, 11942, 11952, 11962, 11972, 11983, 11994, 12006,
+    12015,
+};
+
+static const guint32 english_emoji_seeds[] = {
+    6, 1, 171, 2, 5, 28, 3, 1,
+    28, 22, 17, 23, 1, 4, 9, 1,
+    13, 8, 2, 48, 75, 7, 55, 8,
+    8, 30, 6, 77, 8, 244, 46, 2,
+    3, 23, 71, 4, 3, 12, 1, 0,
+    1, 25, 156, 347, 258, 62, 6, 1,
+    1, 20, 2, 3, 1, 40, 10, 4,
+    14, 31, 1, 9, 15, 81, 7, 8,
+    6, 2, 42, 358, 932, 47, 146, 8,
+    542, 119, 7, 335, 73, 21, 1, 4,
+    2, 51, 3, 153, 304, 28, 1, 17,
+    382, 15, 140, 30, 336, 0, 1, 49,
+    1, 33, 1, 25, 243, 62, 16, 105,
+    541, 3, 34, 12, 76, 595, 909, 76,
+    131, 36, 1, 75, 343, 9, 13, 1,
+    92, 5, 16, 3, 4, 341, 80, 526,
+    63, 1, 1, 153, 263, 11, 128, 10,
+    453, 16, 18, 456, 6, 7, 13, 758,
+    559, 18, 88, 3, 59, 219, 62, 255,
+    530, 2, 178, 119, 8, 19, 201, 7,
+    524, 22, 7, 146, 57, 29, 10, 30,
+    8, 443, 779, 81, 34, 420, 5, 102,
+    152, 51, 27, 5, 21, 12, 122, 538,
+    21, 1, 13, 426, 33, 285, 74, 171,
+    177, 3, 19, 1053, 75, 3, 138, 131,
+    79, 2, 167, 12, 57, 564, 394, 21,
+    15, 127, 69, 115, 28, 11, 431, 12,
+    359, 171, 162, 419, 416, 64, 1, 14,
+    57, 2, 3762, 237, 286, 55, 4, 550,
+    77, 38, 2059, 1719, 46, 1046, 92, 386,
+    1147, 276, 154, 758, 5831, 2, 598, 403,
+    7, 2494, 27, 1422, 298, 258, 14, 34,
+    603, 9412, 1544, 2, 0, 5, 374, 97,
+    388, 8, 69, 595, 84, 251, 669, 1,
+    106, 146, 1078, 23, 1316, 4266, 228,
+};
+
+static const EmojiTable english_emoji_table = {
+    english_emoji_strings,
+    english_emoji_slots, G_N_ELEMENTS (english_emoji_slots),
+    english_emoji_results,
+    english_emoji_seeds, G_N_ELEMENTS (english_emoji_seeds),
+};
+
+static const EmojiTrieCell english_emoji_trie[] = {
+    { 1, -1, 0, 3 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 0, -1, 3, 0 },
+    { 0, -1, 3, 0 }, { 0, -1, 3, 0 }, { 26, 0, 3, 3 }, { 47, 0, 6, 3 },
+    { 62, 0, 9, 3 }, { 80, 0, 12, 3 }, { 96, 0, 15, 3 }, { 111, 0, 18, 3 },
+    { 126, 0, 21, 3 }, { 141, 0, 24, 3 }, { 145, 0, 27, 3 }, { 160, 0, 30, 3 },
+    { 77, 0, 33, 3 }, { 165, 0, 36, 3 }, { 167, 0, 39, 3 }, { 178, 0, 42, 3 },
+    { 188, 0, 45, 3 }, { 213, 0, 48, 3 }, { 12, 0, 51, 3 }, { 218, 0, 54, 3 },
+    { 235, 0, 57, 3 }, { 252, 0, 60, 3 }, { 35, 0, 63, 3 }, { 271, 0, 66, 3 },
+    { 280, 0, 69, 3 }, { 0, 0, 72, 1 }, { 292, 0, 73, 3 }, { 295, 0, 76, 3 },
+    { 33, 98, 79, 3 }, { 34, 98, 82, 2 }, { 40, 98, 84, 2 }, { 25, 98, 86, 1 },
+    { 39, 98, 87, 1 }, { 460, 114, 88, 3 }, { 630, 124, 91, 1 }, { 54, 98, 92, 1 },
+    { 631, 124, 93, 2 }, { 640, 125, 95, 1 }, { 63, 98, 96, 3 }, { 45, 98, 99, 1 },
+    { 93, 98, 100, 3 }, { 414, 118, 103, 1 }, { 68, 98, 104, 2 }, { 659, 127, 106, 1 },
+    { 306, 98, 107, 3 }, { 96, 98, 110, 2 }, { 109, 98, 112, 2 }, { 49, 98, 114, 1 },
+    { 325, 99, 115, 3 }, { 490, 118, 118, 2 }, { 70, 98, 120, 1 }, { 434, 118, 121, 2 },
+    { 345, 99, 123, 3 }, { 445, 118, 126, 1 }, { 631, 125, 127, 1 }, { 646, 126, 128, 1 },
+    { 349, 99, 129, 3 }, { 656, 128, 132, 1 }, { 0, 131, 133, 1 }, { 357, 99, 134, 3 },
+    { 682, 135, 137, 1 }, { 653, 126, 138, 1 }, { 369, 99, 139, 3 }, { 406, 100, 142, 3 },
+    { 659, 134, 145, 1 }, { 370, 99, 146, 3 }, { 0, 100, 149, 1 }, { 81, 100, 150, 2 },
+    { 393, 99, 152, 3 }, { 708, 143, 155, 1 }, { 422, 100, 156, 3 }, { 119, 100, 159, 3 },
+    { 673, 134, 162, 1 }, { 0, 138, 163, 1 }, { 427, 100, 164, 3 }, { 0, 146, 167, 1 },
+    { 1095, 183, 168, 1 }, { 440, 100, 169, 3 }, { 403, 108, 172, 3 }, { 679, 134, 175, 1 },
+    { 459, 100, 176, 3 }, { 459, 101, 179, 3 }, { 262, 108, 182, 2 }, { 112, 100, 184, 3 },
+    { 688, 138, 187, 1 }, { 301, 101, 188, 3 }, { 602, 108, 191, 3 }, { 69, 100, 194, 1 },
+    { 110, 101, 195, 1 }, { 485, 101, 196, 3 }, { 105, 101, 199, 1 }, { 488, 108, 200, 3 },
+    { 281, 108, 203, 1 }, { 1034, 163, 204, 1 }, { 114, 101, 205, 1 }, { 502, 101, 206, 3 },
+    { 689, 136, 209, 1 }, { 136, 102, 210, 3 }, { 466, 101, 213, 3 }, { 1042, 163, 216, 1 },
+    { 747, 136, 217, 2 }, { 337, 101, 219, 3 }, { 121, 101, 222, 1 }, { 129, 102, 223, 1 },
+    { 720, 141, 224, 1 }, { 133, 102, 225, 1 }, { 140, 102, 226, 1 }, { 0, 141, 227, 1 },
+    { 147, 102, 228, 2 }, { 188, 102, 230, 2 }, { 225, 102, 232, 3 }, { 1111, 184, 235, 1 },
+    { 509, 103, 236, 3 }, { 0, 136, 239, 1 }, { 1126, 186, 240, 1 }, { 0, 190, 241, 1 },
+    { 525, 103, 242, 3 }, { 142, 102, 245, 1 }, { 158, 102, 246, 1 }, { 166, 102, 247, 1 },
+    { 477, 103, 248, 3 }, { 168, 102, 251, 2 }, { 0, 142, 253, 1 }, { 531, 103, 254, 3 },
+    { 713, 142, 257, 1 }, { 0, 198, 258, 1 }, { 530, 103, 259, 3 }, { 250, 104, 262, 3 },
+    { 1097, 179, 265, 2 }, { 548, 103, 267, 3 }, { 1096, 179, 270, 3 }, { 317, 104, 273, 3 },
+    { 193, 103, 276, 3 }, { 1047, 167, 279, 1 }, { 163, 104, 280, 1 }, { 248, 104, 281, 3 },
+    { 0, 199, 284, 1 }, { 1051, 167, 285, 2 }, { 209, 104, 287, 3 }, { 1047, 167, 290, 2 },
+    { 1153, 201, 292, 1 }, { 559, 104, 293, 3 }, { 563, 105, 296, 3 }, { 1146, 193, 299, 1 },
+    { 401, 104, 300, 3 }, { 1159, 202, 303, 1 }, { 385, 105, 304, 3 }, { 206, 104, 307, 3 },
+    { 212, 106, 310, 1 }, { 225, 106, 311, 2 }, { 548, 105, 313, 3 }, { 166, 104, 316, 1 },
+    { 1141, 204, 317, 1 }, { 0, 204, 318, 1 }, { 1157, 193, 319, 3 }, { 1140, 193, 322, 1 },
+    { 575, 105, 323, 3 }, { 223, 106, 326, 1 }, { 221, 106, 327, 1 }, { 598, 106, 328, 3 },
+    { 1153, 213, 331, 1 }, { 256, 107, 332, 2 }, { 579, 105, 334, 3 }, { 226, 106, 337, 2 },
+    { 230, 106, 339, 2 }, { 276, 107, 341, 2 }, { 616, 109, 343, 3 }, { 1157, 214, 346, 1 },
+    { 672, 110, 347, 3 }, { 277, 107, 350, 2 }, { 606, 109, 352, 3 }, { 0, 215, 355, 1 },
+    { 681, 110, 356, 3 }, { 1151, 217, 359, 2 }, { 634, 109, 361, 3 }, { 330, 107, 364, 3 },
+    { 693, 110, 367, 3 }, { 290, 109, 370, 1 }, { 1205, 230, 371, 1 }, { 643, 111, 372, 3 },
+    { 652, 109, 375, 3 }, { 426, 107, 378, 3 }, { 702, 110, 381, 3 }, { 710, 111, 384, 3 },
+    { 1232, 247, 387, 1 }, { 0, 111, 388, 1 }, { 351, 109, 389, 3 }, { 506, 111, 392, 3 },
+    { 431, 110, 395, 3 }, { 1155, 205, 398, 1 }, { 1153, 205, 399, 1 }, { 289, 112, 400, 1 },
+    { 303, 112, 401, 1 }, { 643, 111, 402, 3 }, { 306, 112, 405, 1 }, { 298, 112, 406, 1 },
+    { 0, 112, 407, 1 }, { 305, 112, 408, 1 }, { 1203, 228, 409, 1 }, { 285, 111, 410, 2 },
+    { 338, 112, 412, 2 }, { 0, 112, 414, 1 }, { 371, 112, 415, 3 }, { 1207, 228, 418, 1 },
+    { 320, 112, 419, 1 }, { 1205, 228, 420, 1 }, { 433, 112, 421, 2 }, { 1227, 243, 423, 1 },
+    { 328, 112, 424, 1 }, { 349, 112, 425, 1 }, { 1213, 234, 426, 1 }, { 365, 112, 427, 1 },
+    { 0, 112, 428, 1 }, { 369, 112, 429, 1 }, { 727, 113, 430, 3 }, { 1242, 243, 433, 2 },
+    { 0, 113, 435, 1 }, { 0, 244, 436, 1 }, { 737, 113, 437, 3 }, { 797, 115, 440, 3 },
+    { 0, 243, 443, 1 }, { 383, 113, 444, 1 }, { 757, 113, 445, 3 }, { 808, 115, 448, 3 },
+    { 1231, 234, 451, 3 }, { 514, 113, 454, 3 }, { 374, 115, 457, 1 }, { 800, 115, 458, 3 },
+    { 769, 113, 461, 3 }, { 0, 206, 464, 1 }, { 1294, 245, 465, 1 }, { 758, 113, 466, 3 },
+    { 1157, 206, 469, 1 }, { 827, 115, 470, 3 }, { 779, 113, 473, 3 }, { 0, 253, 476, 1 },
+    { 830, 116, 477, 3 }, { 0, 254, 480, 1 }, { 817, 116, 481, 3 }, { 730, 115, 484, 3 },
+    { 854, 116, 487, 3 }, { 1287, 259, 490, 2 }, { 1301, 260, 492, 2 }, { 860, 116, 494, 3 },
+    { 876, 116, 497, 3 }, { 1149, 206, 500, 1 }, { 622, 116, 501, 3 }, { 576, 116, 504, 3 },
+    { 491, 116, 507, 3 }, { 565, 116, 510, 3 }, { 883, 116, 513, 3 }, { 898, 116, 516, 3 },
+    { 380, 116, 519, 2 }, { 917, 117, 521, 3 }, { 1206, 231, 524, 1 }, { 907, 116, 525, 3 },
+    { 807, 116, 528, 3 }, { 859, 117, 531, 3 }, { 765, 116, 534, 3 }, { 1292, 257, 537, 2 },
+    { 896, 117, 539, 3 }, { 935, 117, 542, 3 }, { 1220, 231, 545, 1 }, { 1213, 223, 546, 1 },
+    { 1318, 178, 547, 1 }, { 0, 117, 548, 1 }, { 1219, 231, 549, 1 }, { 941, 117, 550, 3 },
+    { 1218, 223, 553, 2 }, { 0, 223, 555, 1 }, { 957, 117, 556, 3 }, { 406, 117, 559, 1 },
+    { 450, 119, 560, 1 }, { 925, 117, 561, 3 }, { 0, 117, 564, 1 }, { 703, 117, 565, 3 },
+    { 585, 119, 568, 3 }, { 1291, 261, 571, 1 }, { 1292, 265, 572, 1 }, { 457, 119, 573, 1 },
+    { 964, 119, 574, 3 }, { 969, 120, 577, 3 }, { 1318, 188, 580, 1 }, { 0, 120, 581, 1 },
+    { 1289, 265, 582, 1 }, { 861, 120, 583, 3 }, { 470, 119, 586, 1 }, { 0, 178, 587, 1 },
+    { 975, 120, 588, 3 }, { 982, 120, 591, 3 }, { 0, 119, 594, 1 }, { 1345, 273, 595, 1 },
+    { 489, 119, 596, 1 }, { 992, 122, 597, 3 }, { 1434, 287, 600, 1 }, { 985, 120, 601, 3 },
+    { 518, 123, 604, 1 }, { 553, 122, 605, 2 }, { 1004, 120, 607, 3 }, { 1301, 261, 610, 1 },
+    { 548, 123, 611, 1 }, { 507, 122, 612, 1 }, { 1115, 181, 613, 2 }, { 1415, 295, 615, 1 },
+    { 608, 123, 616, 1 }, { 0, 295, 617, 1 }, { 1104, 181, 618, 1 }, { 534, 122, 619, 2 },
+    { 1422, 288, 621, 1 }, { 778, 140, 622, 2 }, { 653, 123, 624, 2 }, { 686, 140, 626, 1 },
+    { 0, 290, 627, 1 }, { 593, 122, 628, 2 }, { 1108, 181, 630, 1 }, { 1106, 181, 631, 1 },
+    { 1432, 291, 632, 1 }, { 0, 293, 633, 1 }, { 1202, 227, 634, 1 }, { 684, 140, 635, 1 },
+    { 1122, 181, 636, 1 }, { 604, 123, 637, 1 }, { 1212, 227, 638, 1 }, { 1119, 181, 639, 1 },
+    { 695, 140, 640, 1 }, { 1427, 300, 641, 1 }, { 710, 140, 642, 2 }, { 710, 144, 644, 1 },
+    { 757, 144, 645, 2 }, { 733, 144, 647, 2 }, { 0, 227, 649, 1 }, { 1220, 227, 650, 2 },
+    { 749, 144, 652, 2 }, { 1298, 271, 654, 1 }, { 741, 144, 655, 1 }, { 1285, 271, 656, 1 },
+    { 774, 144, 657, 1 }, { 833, 144, 658, 3 }, { 792, 144, 661, 1 }, { 960, 144, 662, 3 },
+    { 1143, 197, 665, 1 }, { 1306, 271, 666, 2 }, { 0, 296, 668, 1 }, { 793, 144, 669, 2 },
+    { 785, 144, 671, 1 }, { 800, 144, 672, 2 }, { 1013, 148, 674, 3 }, { 1416, 296, 677, 1 },
+    { 1439, 304, 678, 1 }, { 0, 148, 679, 1 }, { 795, 148, 680, 3 }, { 1148, 197, 683, 1 },
+    { 842, 152, 684, 1 }, { 1151, 197, 685, 1 }, { 1356, 282, 686, 1 }, { 0, 271, 687, 1 },
+    { 1146, 197, 688, 1 }, { 807, 148, 689, 1 }, { 889, 155, 690, 1 }, { 813, 148, 691, 1 },
+    { 847, 152, 692, 3 }, { 846, 152, 695, 1 }, { 889, 155, 696, 1 }, { 822, 148, 697, 1 },
+    { 1366, 282, 698, 1 }, { 1362, 282, 699, 1 }, { 895, 155, 700, 1 }, { 878, 152, 701, 2 },
+    { 876, 152, 703, 2 }, { 1443, 305, 705, 1 }, { 945, 158, 706, 3 }, { 938, 161, 709, 1 },
+    { 901, 155, 710, 3 }, { 893, 158, 713, 1 }, { 1434, 298, 714, 1 }, { 951, 161, 715, 3 },
+    { 0, 298, 718, 1 }, { 0, 307, 719, 1 }, { 926, 155, 720, 2 }, { 1015, 161, 722, 3 },
+    { 1425, 298, 725, 1 }, { 906, 158, 726, 1 }, { 925, 158, 727, 1 }, { 929, 158, 728, 1 },
+    { 1001, 158, 729, 3 }, { 1013, 161, 732, 3 }, { 1256, 242, 735, 3 }, { 968, 158, 738, 2 },
+    { 1426, 309, 740, 1 }, { 919, 158, 741, 1 }, { 1249, 242, 742, 1 }, { 941, 161, 743, 1 },
+    { 995, 158, 744, 3 }, { 937, 158, 747, 2 }, { 0, 158, 749, 1 }, { 984, 164, 750, 1 },
+    { 976, 164, 751, 1 }, { 1251, 242, 752, 3 }, { 1452, 317, 755, 1 }, { 1514, 322, 756, 1 },
+    { 0, 164, 757, 1 }, { 1640, 348, 758, 2 }, { 1234, 240, 760, 3 }, { 1264, 242, 763, 3 },
+    { 1314, 174, 766, 1 }, { 1028, 164, 767, 3 }, { 1235, 240, 770, 1 }, { 974, 164, 771, 1 },
+    { 1013, 159, 772, 1 }, { 1006, 159, 773, 1 }, { 1227, 240, 774, 1 }, { 985, 164, 775, 1 },
+    { 991, 164, 776, 2 }, { 1003, 164, 778, 2 }, { 1709, 367, 780, 1 }, { 1312, 174, 781, 1 },
+    { 1229, 240, 782, 3 }, { 1027, 159, 785, 1 }, { 1025, 159, 786, 1 }, { 1033, 159, 787, 2 },
+    { 1038, 159, 789, 3 }, { 1317, 174, 792, 1 }, { 0, 159, 793, 1 }, { 1040, 166, 794, 3 },
+    { 1039, 159, 797, 3 }, { 1028, 159, 800, 2 }, { 1042, 159, 802, 2 }, { 1057, 166, 804, 3 },
+    { 1064, 170, 807, 3 }, { 0, 137, 810, 1 }, { 1305, 277, 811, 2 }, { 1058, 166, 813, 3 },
+    { 1063, 170, 816, 1 }, { 1306, 277, 817, 2 }, { 1428, 302, 819, 1 }, { 1311, 277, 820, 1 },
+    { 1053, 170, 821, 2 }, { 1034, 166, 823, 1 }, { 0, 284, 824, 1 }, { 1299, 277, 825, 1 },
+    { 1442, 302, 826, 1 }, { 1049, 173, 827, 1 }, { 1071, 170, 828, 3 }, { 1033, 166, 831, 1 },
+    { 1073, 173, 832, 1 }, { 1411, 284, 833, 1 }, { 1073, 173, 834, 2 }, { 0, 173, 836, 1 },
+    { 1063, 170, 837, 1 }, { 1067, 173, 838, 1 }, { 1412, 284, 839, 3 }, { 1411, 284, 842, 1 },
+    { 1078, 173, 843, 1 }, { 1079, 173, 844, 2 }, { 1076, 173, 846, 2 }, { 1084, 173, 848, 3 },
+    { 0, 173, 851, 1 }, { 1732, 147, 852, 1 }, { 1086, 173, 853, 2 }, { 0, 149, 855, 1 },
+    { 1099, 176, 856, 2 }, { 1083, 173, 858, 2 }, { 1086, 173, 860, 1 }, { 1096, 173, 861, 2 },
+    { 1101, 176, 863, 2 }, { 1511, 129, 865, 2 }, { 1103, 177, 867, 1 }, { 1142, 194, 868, 1 },
+    { 1094, 177, 869, 1 }, { 1512, 129, 870, 1 }, { 0, 368, 871, 1 }, { 1131, 194, 872, 1 },
+    { 0, 177, 873, 1 }, { 1110, 177, 874, 3 }, { 1088, 176, 877, 3 }, { 1137, 194, 880, 1 },
+    { 0, 375, 881, 1 }, { 1105, 177, 882, 2 }, { 1107, 177, 884, 1 }, { 1114, 177, 885, 1 },
+    { 1085, 176, 886, 1 }, { 1136, 194, 887, 1 }, { 1173, 216, 888, 1 }, { 1734, 382, 889, 1 },
+    { 0, 176, 890, 1 }, { 1115, 177, 891, 1 }, { 1118, 185, 892, 2 }, { 1140, 194, 894, 1 },
+    { 1126, 185, 895, 1 }, { 1181, 216, 896, 3 }, { 1113, 185, 899, 2 }, { 1180, 216, 901, 1 },
+    { 1592, 344, 902, 1 }, { 1322, 187, 903, 1 }, { 1723, 145, 904, 1 }, { 1183, 216, 905, 2 },
+    { 1181, 216, 907, 2 }, { 1322, 187, 909, 2 }, { 0, 185, 911, 1 }, { 1186, 216, 912, 1 },
+    { 1606, 344, 913, 2 }, { 1741, 388, 915, 1 }, { 1715, 145, 916, 1 }, { 1327, 187, 917, 2 },
+    { 1125, 185, 919, 2 }, { 1121, 191, 921, 1 }, { 1127, 191, 922, 1 }, { 1128, 185, 923, 2 },
+    { 0, 283, 925, 1 }, { 0, 191, 926, 1 }, { 1137, 185, 927, 1 }, { 1113, 185, 928, 1 },
+    { 1166, 208, 929, 1 }, { 1419, 283, 930, 1 }, { 1131, 191, 931, 2 }, { 1470, 321, 933, 3 },
+    { 1123, 191, 936, 1 }, { 1127, 191, 937, 1 }, { 1154, 208, 938, 1 }, { 1484, 321, 939, 1 },
+    { 1423, 283, 940, 2 }, { 0, 397, 942, 1 }, { 1164, 208, 943, 1 }, { 1144, 191, 944, 2 },
+    { 1142, 191, 946, 1 }, { 1134, 191, 947, 1 }, { 1161, 212, 948, 1 }, { 1161, 208, 949, 1 },
+    { 1155, 208, 950, 1 }, { 1168, 208, 951, 1 }, { 1160, 212, 952, 1 }, { 1163, 208, 953, 1 },
+    { 1185, 219, 954, 3 }, { 0, 208, 957, 1 }, { 0, 392, 958, 1 }, { 1479, 321, 959, 3 },
+    { 1169, 219, 962, 1 }, { 1189, 222, 963, 1 }, { 1180, 212, 964, 1 }, { 1179, 212, 965, 1 },
+    { 1188, 219, 966, 1 }, { 1789, 403, 967, 1 }, { 1193, 222, 968, 1 }, { 1165, 212, 969, 2 },
+    { 1199, 222, 971, 1 }, { 1201, 222, 972, 2 }, { 1184, 219, 974, 3 }, { 1179, 212, 977, 1 },
+    { 1195, 222, 978, 1 }, { 1196, 225, 979, 2 }, { 1775, 396, 981, 1 }, { 1190, 222, 982, 1 },
+    { 1261, 246, 983, 1 }, { 1205, 225, 984, 2 }, { 0, 222, 986, 1 }, { 1777, 403, 987, 1 },
+    { 0, 219, 988, 1 }, { 1206, 225, 989, 2 }, { 1268, 246, 991, 1 }, { 1266, 246, 992, 2 },
+    { 1222, 237, 994, 2 }, { 1223, 237, 996, 1 }, { 1266, 246, 997, 1 }, { 1205, 225, 998, 2 },
+    { 1256, 246, 1000, 1 }, { 1777, 393, 1001, 1 }, { 1610, 345, 1002, 3 }, { 0, 393, 1005, 1 },
+    { 0, 246, 1006, 1 }, { 1204, 225, 1007, 1 }, { 1601, 345, 1008, 1 }, { 1232, 237, 1009, 2 },
+    { 1230, 238, 1011, 1 }, { 1205, 225, 1012, 1 }, { 1233, 237, 1013, 2 }, { 1234, 238, 1015, 1 },
+    { 1238, 238, 1016, 1 }, { 1251, 238, 1017, 1 }, { 1265, 252, 1018, 2 }, { 1241, 238, 1020, 1 },
+    { 1585, 345, 1021, 1 }, { 1606, 343, 1022, 3 }, { 1250, 238, 1025, 1 }, { 0, 238, 1026, 1 },
+    { 1258, 252, 1027, 1 }, { 1609, 343, 1028, 2 }, { 0, 258, 1030, 1 }, { 1276, 252, 1031, 2 },
+    { 1277, 252, 1033, 1 }, { 1278, 252, 1034, 1 }, { 1273, 252, 1035, 3 }, { 1594, 343, 1038, 2 },
+    { 1276, 258, 1040, 1 }, { 1271, 252, 1041, 3 }, { 1722, 372, 1044, 1 }, { 1282, 252, 1045, 3 },
+    { 1269, 252, 1048, 2 }, { 1273, 258, 1050, 1 }, { 1286, 258, 1051, 1 }, { 0, 258, 1052, 1 },
+    { 1281, 255, 1053, 1 }, { 0, 343, 1054, 1 }, { 1292, 255, 1055, 1 }, { 1716, 372, 1056, 1 },
+    { 1716, 372, 1057, 1 }, { 1310, 182, 1058, 1 }, { 0, 409, 1059, 1 }, { 1335, 266, 1060, 1 },
+    { 1277, 255, 1061, 1 }, { 0, 255, 1062, 1 }, { 1336, 266, 1063, 1 }, { 1772, 409, 1064, 1 },
+    { 1324, 266, 1065, 1 }, { 0, 266, 1066, 1 }, { 1278, 255, 1067, 1 }, { 1307, 182, 1068, 1 },
+    { 1316, 182, 1069, 1 }, { 1295, 255, 1070, 2 }, { 1326, 262, 1072, 2 }, { 1330, 266, 1074, 1 },
+    { 1328, 262, 1075, 1 }, { 1305, 182, 1076, 1 }, { 1320, 182, 1077, 1 }, { 1579, 342, 1078, 1 },
+    { 1778, 400, 1079, 1 }, { 1317, 182, 1080, 1 }, { 1326, 266, 1081, 1 }, { 1578, 342, 1082, 1 },
+    { 1343, 266, 1083, 1 }, { 1317, 262, 1084, 1 }, { 0, 417, 1085, 1 }, { 1597, 342, 1086, 3 },
+    { 1314, 262, 1089, 1 }, { 1776, 130, 1090, 1 }, { 1328, 262, 1091, 1 }, { 0, 132, 1092, 1 },
+    { 1328, 262, 1093, 2 }, { 1331, 262, 1095, 1 }, { 1338, 262, 1096, 1 }, { 0, 270, 1097, 1 },
+    { 1344, 270, 1098, 3 }, { 1342, 270, 1101, 1 }, { 1315, 262, 1102, 1 }, { 1591, 342, 1103, 2 },
+    { 1404, 275, 1105, 1 }, { 1779, 133, 1106, 1 }, { 1781, 150, 1107, 1 }, { 1349, 270, 1108, 1 },
+    { 1341, 270, 1109, 1 }, { 1339, 270, 1110, 1 }, { 1335, 270, 1111, 1 }, { 1334, 270, 1112, 1 },
+    { 1407, 275, 1113, 1 }, { 1353, 276, 1114, 1 }, { 1336, 270, 1115, 1 }, { 1349, 276, 1116, 3 },
+    { 1415, 275, 1119, 1 }, { 1786, 406, 1120, 1 }, { 1425, 289, 1121, 1 }, { 0, 276, 1122, 1 },
+    { 1356, 270, 1123, 1 }, { 1410, 289, 1124, 1 }, { 1426, 289, 1125, 1 }, { 1427, 289, 1126, 3 },
+    { 1795, 151, 1129, 1 }, { 1781, 157, 1130, 1 }, { 1794, 406, 1131, 1 }, { 1345, 276, 1132, 1 },
+    { 1801, 139, 1133, 1 }, { 1421, 275, 1134, 1 }, { 1344, 276, 1135, 1 }, { 0, 153, 1136, 1 },
+    { 1354, 276, 1137, 1 }, { 1361, 276, 1138, 1 }, { 1361, 276, 1139, 1 }, { 0, 276, 1140, 1 },
+    { 0, 264, 1141, 1 }, { 1790, 160, 1142, 1 }, { 1790, 168, 1143, 1 }, { 1365, 264, 1144, 3 },
+    { 1802, 175, 1147, 1 }, { 1359, 264, 1148, 2 }, { 1363, 268, 1150, 1 }, { 1368, 264, 1151, 1 },
+    { 1370, 264, 1152, 1 }, { 1385, 268, 1153, 2 }, { 1369, 264, 1155, 2 }, { 1804, 156, 1157, 1 },
+    { 1365, 264, 1158, 2 }, { 0, 268, 1160, 1 }, { 1367, 264, 1161, 2 }, { 1369, 264, 1163, 1 },
+    { 1376, 264, 1164, 2 }, { 1372, 268, 1166, 2 }, { 1373, 268, 1168, 1 }, { 0, 268, 1169, 1 },
+    { 0, 272, 1170, 1 }, { 1792, 192, 1171, 1 }, { 1377, 264, 1172, 1 }, { 1386, 268, 1173, 2 },
+    { 1805, 180, 1175, 1 }, { 1389, 268, 1176, 2 }, { 1812, 407, 1178, 1 }, { 1387, 278, 1179, 1 },
+    { 1388, 278, 1180, 1 }, { 1380, 272, 1181, 1 }, { 1393, 278, 1182, 1 }, { 1384, 272, 1183, 2 },
+    { 1713, 371, 1185, 1 }, { 0, 415, 1186, 1 }, { 1791, 420, 1187, 1 }, { 1377, 272, 1188, 1 },
+    { 1713, 371, 1189, 2 }, { 1412, 279, 1191, 1 }, { 1379, 278, 1192, 1 }, { 1420, 279, 1193, 1 },
+    { 1397, 278, 1194, 2 }, { 1387, 278, 1196, 1 }, { 0, 371, 1197, 1 }, { 1796, 422, 1198, 1 },
+    { 1383, 278, 1199, 1 }, { 1387, 278, 1200, 1 }, { 1398, 278, 1201, 2 }, { 1390, 278, 1203, 2 },
+    { 1402, 278, 1205, 1 }, { 1797, 200, 1206, 1 }, { 0, 220, 1207, 1 }, { 1411, 278, 1208, 1 },
+    { 1421, 279, 1209, 1 }, { 1804, 165, 1210, 1 }, { 0, 279, 1211, 1 }, { 1443, 310, 1212, 2 },
+    { 1436, 310, 1214, 1 }, { 1407, 279, 1215, 2 }, { 1444, 310, 1217, 2 }, { 0, 423, 1219, 1 },
+    { 1438, 310, 1220, 1 }, { 1544, 335, 1221, 1 }, { 1456, 314, 1222, 3 }, { 1438, 310, 1225, 1 },
+    { 1814, 425, 1226, 2 }, { 1448, 310, 1228, 3 }, { 1542, 335, 1231, 1 }, { 1448, 310, 1232, 1 },
+    { 1541, 335, 1233, 1 }, { 1451, 310, 1234, 3 }, { 1435, 310, 1237, 2 }, { 1438, 310, 1239, 1 },
+    { 1438, 310, 1240, 1 }, { 1541, 335, 1241, 2 }, { 0, 310, 1243, 1 }, { 1455, 314, 1244, 2 },
+    { 1796, 196, 1246, 1 }, { 1444, 314, 1247, 1 }, { 1808, 428, 1248, 1 }, { 1442, 314, 1249, 1 },
+    { 1445, 314, 1250, 2 }, { 0, 314, 1252, 1 }, { 1453, 318, 1253, 1 }, { 1478, 327, 1254, 3 },
+    { 1461, 318, 1257, 3 }, { 0, 430, 1260, 1 }, { 1470, 318, 1261, 2 }, { 1482, 327, 1263, 1 },
+    { 0, 318, 1264, 1 }, { 1784, 196, 1265, 1 }, { 1654, 354, 1266, 1 }, { 1500, 327, 1267, 3 },
+    { 0, 424, 1270, 1 }, { 1464, 318, 1271, 2 }, { 1669, 354, 1273, 2 }, { 1472, 318, 1275, 3 },
+    { 1804, 424, 1278, 1 }, { 1490, 327, 1279, 2 }, { 1658, 354, 1281, 2 }, { 1477, 318, 1283, 1 },
+    { 1460, 318, 1284, 1 }, { 1480, 318, 1285, 1 }, { 1473, 324, 1286, 1 }, { 1803, 432, 1287, 1 },
+    { 1654, 354, 1288, 2 }, { 1484, 324, 1290, 3 }, { 1495, 330, 1293, 1 }, { 1456, 318, 1294, 1 },
+    { 1484, 324, 1295, 2 }, { 1475, 324, 1297, 1 }, { 1806, 405, 1298, 1 }, { 1477, 324, 1299, 1 },
+    { 1474, 324, 1300, 2 }, { 1495, 324, 1302, 2 }, { 1494, 324, 1304, 2 }, { 1488, 330, 1306, 1 },
+    { 1493, 330, 1307, 1 }, { 1507, 330, 1308, 1 }, { 1808, 434, 1309, 1 }, { 1822, 439, 1310, 1 },
+    { 1823, 440, 1311, 1 }, { 1496, 330, 1312, 2 }, { 1803, 405, 1314, 1 }, { 1516, 315, 1315, 1 },
+    { 1510, 315, 1316, 1 }, { 1511, 315, 1317, 1 }, { 1533, 323, 1318, 1 }, { 1531, 323, 1319, 1 },
+    { 1516, 315, 1320, 1 }, { 1487, 330, 1321, 1 }, { 1508, 315, 1322, 2 }, { 1529, 323, 1324, 1 },
+    { 0, 441, 1325, 1 }, { 1622, 352, 1326, 1 }, { 1518, 315, 1327, 2 }, { 1514, 319, 1329, 1 },
+    { 0, 319, 1330, 1 }, { 0, 446, 1331, 1 }, { 1531, 323, 1332, 1 }, { 1825, 446, 1333, 1 },
+    { 1638, 352, 1334, 1 }, { 0, 315, 1335, 1 }, { 1546, 334, 1336, 3 }, { 0, 453, 1339, 1 },
+    { 1515, 319, 1340, 1 }, { 1650, 352, 1341, 3 }, { 1505, 315, 1344, 1 }, { 1513, 315, 1345, 1 },
+    { 1526, 319, 1346, 1 }, { 1544, 334, 1347, 1 }, { 1658, 352, 1348, 1 }, { 1517, 319, 1349, 1 },
+    { 1536, 329, 1350, 2 }, { 1526, 329, 1352, 1 }, { 1531, 329, 1353, 2 }, { 1524, 319, 1355, 1 },
+    { 1543, 334, 1356, 1 }, { 1823, 455, 1357, 1 }, { 0, 332, 1358, 1 }, { 1557, 334, 1359, 3 },
+    { 1545, 332, 1362, 1 }, { 0, 433, 1363, 1 }, { 1561, 334, 1364, 1 }, { 1531, 329, 1365, 3 },
+    { 1814, 459, 1368, 1 }, { 1546, 332, 1369, 1 }, { 1551, 332, 1370, 3 }, { 1539, 329, 1373, 1 },
+    { 1549, 332, 1374, 3 }, { 1817, 433, 1377, 3 }, { 1540, 329, 1380, 1 }, { 1824, 448, 1381, 1 },
+    { 1545, 332, 1382, 1 }, { 1548, 332, 1383, 2 }, { 1534, 332, 1385, 1 }, { 1543, 332, 1386, 1 },
+    { 0, 456, 1387, 1 }, { 0, 332, 1388, 1 }, { 0, 332, 1389, 1 }, { 1556, 336, 1390, 3 },
+    { 1827, 456, 1393, 2 }, { 1558, 336, 1395, 2 }, { 0, 457, 1397, 1 }, { 0, 336, 1398, 1 },
+    { 1682, 353, 1399, 3 }, { 1569, 339, 1402, 3 }, { 1737, 381, 1405, 2 }, { 0, 381, 1407, 1 },
+    { 1666, 353, 1408, 1 }, { 1576, 339, 1409, 2 }, { 1559, 336, 1411, 1 }, { 1561, 336, 1412, 1 },
+    { 1555, 336, 1413, 1 }, { 1578, 339, 1414, 3 }, { 1749, 381, 1417, 1 }, { 1675, 353, 1418, 1 },
+    { 1672, 353, 1419, 1 }, { 1675, 353, 1420, 3 }, { 0, 336, 1423, 1 }, { 1577, 339, 1424, 3 },
+    { 1572, 336, 1427, 1 }, { 1569, 336, 1428, 1 }, { 1577, 339, 1429, 3 }, { 1574, 340, 1432, 1 },
+    { 1737, 381, 1433, 1 }, { 1565, 339, 1434, 1 }, { 1833, 463, 1435, 2 }, { 1575, 340, 1437, 2 },
+    { 1604, 346, 1439, 2 }, { 0, 346, 1441, 1 }, { 1620, 346, 1442, 2 }, { 1624, 346, 1444, 1 },
+    { 1585, 340, 1445, 2 }, { 1606, 346, 1447, 1 }, { 1586, 340, 1448, 1 }, { 1829, 464, 1449, 1 },
+    { 1834, 454, 1450, 1 }, { 1823, 464, 1451, 1 }, { 1842, 458, 1452, 1 }, { 1620, 346, 1453, 1 },
+    { 0, 340, 1454, 1 }, { 1676, 356, 1455, 1 }, { 1616, 346, 1456, 1 }, { 1631, 347, 1457, 1 },
+    { 0, 340, 1458, 1 }, { 1614, 346, 1459, 1 }, { 0, 346, 1460, 1 }, { 1634, 347, 1461, 3 },
+    { 1613, 346, 1464, 1 }, { 1673, 356, 1465, 2 }, { 0, 346, 1467, 1 }, { 1632, 347, 1468, 3 },
+    { 1641, 351, 1471, 3 }, { 1843, 462, 1474, 1 }, { 1628, 347, 1475, 1 }, { 1678, 356, 1476, 1 },
+    { 1637, 351, 1477, 3 }, { 1637, 347, 1480, 3 }, { 1688, 356, 1483, 2 }, { 1844, 468, 1485, 2 },
+    { 1640, 351, 1487, 2 }, { 1681, 356, 1489, 1 }, { 0, 469, 1490, 1 }, { 1654, 349, 1491, 1 },
+    { 1660, 349, 1492, 1 }, { 1676, 349, 1493, 1 }, { 1649, 351, 1494, 3 }, { 0, 347, 1497, 1 },
+    { 0, 468, 1498, 1 }, { 1647, 351, 1499, 3 }, { 0, 477, 1502, 1 }, { 0, 478, 1503, 1 },
+    { 1638, 351, 1504, 2 }, { 1667, 349, 1506, 1 }, { 1678, 349, 1507, 1 }, { 0, 474, 1508, 1 },
+    { 1671, 349, 1509, 1 }, { 1676, 349, 1510, 1 }, { 0, 479, 1511, 1 }, { 1675, 349, 1512, 1 },
+    { 1663, 349, 1513, 1 }, { 1710, 369, 1514, 1 }, { 1688, 357, 1515, 2 }, { 1842, 485, 1517, 1 },
+    { 0, 357, 1518, 1 }, { 1675, 349, 1519, 1 }, { 1692, 357, 1520, 1 }, { 1720, 369, 1521, 3 },
+    { 1712, 369, 1524, 1 }, { 1841, 474, 1525, 1 }, { 1842, 489, 1526, 1 }, { 1843, 467, 1527, 1 },
+    { 1699, 357, 1528, 2 }, { 1719, 369, 1530, 1 }, { 1693, 363, 1531, 1 }, { 1683, 357, 1532, 1 },
+    { 1854, 471, 1533, 3 }, { 1698, 357, 1536, 1 }, { 1705, 363, 1537, 1 }, { 1700, 363, 1538, 1 },
+    { 1696, 363, 1539, 2 }, { 1701, 363, 1541, 1 }, { 1704, 366, 1542, 3 }, { 1707, 363, 1545, 1 },
+    { 1861, 487, 1546, 1 }, { 1810, 435, 1547, 1 }, { 1707, 366, 1548, 2 }, { 1846, 466, 1550, 2 },
+    { 1706, 363, 1552, 1 }, { 0, 466, 1553, 1 }, { 0, 363, 1554, 1 }, { 1732, 376, 1555, 1 },
+    { 1733, 376, 1556, 1 }, { 1716, 376, 1557, 1 }, { 1810, 435, 1558, 1 }, { 0, 435, 1559, 1 },
+    { 1698, 366, 1560, 1 }, { 1848, 483, 1561, 1 }, { 1821, 435, 1562, 1 }, { 1739, 377, 1563, 1 },
+    { 1746, 384, 1564, 1 }, { 1839, 483, 1565, 1 }, { 1712, 366, 1566, 1 }, { 1729, 376, 1567, 1 },
+    { 1754, 384, 1568, 2 }, { 1735, 377, 1570, 2 }, { 1721, 376, 1572, 1 }, { 1739, 377, 1573, 1 },
+    { 1741, 384, 1574, 2 }, { 1752, 385, 1576, 1 }, { 1858, 491, 1577, 1 }, { 1866, 492, 1578, 1 },
+    { 1850, 503, 1579, 1 }, { 1746, 377, 1580, 2 }, { 1747, 384, 1582, 1 }, { 1745, 377, 1583, 2 },
+    { 1871, 507, 1585, 1 }, { 1743, 377, 1586, 1 }, { 1744, 385, 1587, 1 }, { 1777, 389, 1588, 1 },
+    { 1761, 385, 1589, 3 }, { 1767, 391, 1592, 1 }, { 1773, 391, 1593, 2 }, { 0, 391, 1595, 1 },
+    { 1771, 391, 1596, 3 }, { 1762, 385, 1599, 2 }, { 1766, 385, 1601, 1 }, { 1768, 391, 1602, 3 },
+    { 1841, 488, 1605, 1 }, { 1760, 394, 1606, 1 }, { 1779, 389, 1607, 1 }, { 0, 488, 1608, 1 },
+    { 1770, 385, 1609, 1 }, { 1768, 394, 1610, 1 }, { 1773, 389, 1611, 1 }, { 0, 508, 1612, 1 },
+    { 1832, 480, 1613, 2 }, { 1764, 394, 1615, 1 }, { 0, 480, 1616, 1 }, { 1774, 389, 1617, 1 },
+    { 1821, 442, 1618, 2 }, { 1811, 442, 1620, 2 }, { 1848, 475, 1622, 1 }, { 1855, 475, 1623, 2 },
+    { 1855, 475, 1625, 1 }, { 0, 480, 1626, 1 }, { 1855, 475, 1627, 1 }, { 1872, 509, 1628, 2 },
+    { 1859, 481, 1630, 1 }, { 1873, 504, 1631, 1 }, { 1858, 505, 1632, 1 }, { 1840, 481, 1633, 1 },
+    { 1854, 481, 1634, 1 }, { 0, 394, 1635, 1 }, { 0, 501, 1636, 1 }, { 1829, 442, 1637, 3 },
+    { 0, 513, 1640, 1 }, { 0, 442, 1641, 1 }, { 1811, 442, 1642, 1 }, { 1830, 442, 1643, 1 },
+    { 1854, 481, 1644, 1 }, { 0, 514, 1645, 1 }, { 1868, 515, 1646, 2 }, { 0, 521, 1648, 1 },
+    { 1867, 501, 1649, 2 }, { 1876, 516, 1651, 1 }, { 1870, 516, 1652, 2 }, { 0, 520, 1654, 1 },
+    { 0, 520, 1655, 1 }, { 1880, 522, 1656, 1 }, { 0, 189, 1657, 1 }, { 1888, 195, 1658, 1 },
+    { 1873, 521, 1659, 1 }, { 1876, 519, 1660, 2 }, { 0, 533, 1662, 1 }, { 1901, 539, 1663, 1 },
+    { 1892, 229, 1664, 1 }, { 1878, 516, 1665, 1 }, { 1894, 233, 1666, 2 }, { 0, 520, 1668, 1 },
+    { 1886, 519, 1669, 1 }, { 1869, 520, 1670, 1 }, { 1879, 519, 1671, 2 }, { 0, 520, 1673, 1 },
+    { 1882, 523, 1674, 1 }, { 1887, 527, 1675, 1 }, { 1877, 523, 1676, 1 }, { 0, 523, 1677, 1 },
+    { 1898, 528, 1678, 1 }, { 1886, 235, 1679, 1 }, { 1911, 532, 1680, 1 }, { 1903, 532, 1681, 1 },
+    { 0, 544, 1682, 1 }, { 0, 537, 1683, 1 }, { 1898, 527, 1684, 1 }, { 1898, 527, 1685, 1 },
+    { 0, 235, 1686, 1 }, { 1895, 524, 1687, 1 }, { 1905, 538, 1688, 1 }, { 1879, 523, 1689, 1 },
+    { 1881, 523, 1690, 2 }, { 1893, 524, 1692, 1 }, { 1903, 540, 1693, 1 }, { 1917, 542, 1694, 2 },
+    { 0, 524, 1696, 1 }, { 0, 545, 1697, 1 }, { 0, 548, 1698, 1 }, { 1924, 550, 1699, 2 },
+    { 1903, 549, 1701, 1 }, { 1891, 524, 1702, 1 }, { 1920, 557, 1703, 1 }, { 1892, 524, 1704, 1 },
+    { 1921, 549, 1705, 1 }, { 0, 524, 1706, 1 }, { 1912, 538, 1707, 2 }, { 1914, 558, 1709, 1 },
+    { 1914, 538, 1710, 1 }, { 1914, 538, 1711, 1 }, { 1906, 538, 1712, 1 }, { 1922, 551, 1713, 3 },
+    { 0, 551, 1716, 1 }, { 0, 554, 1717, 1 }, { 1918, 559, 1718, 1 }, { 1918, 557, 1719, 1 },
+    { 0, 554, 1720, 1 }, { 0, 556, 1721, 1 }, { 1922, 560, 1722, 1 }, { 1926, 570, 1723, 1 },
+    { 1932, 576, 1724, 1 }, { 1927, 560, 1725, 1 }, { 1937, 224, 1726, 1 }, { 1919, 570, 1727, 1 },
+    { 1917, 226, 1728, 2 }, { 1940, 172, 1730, 1 }, { 1941, 562, 1731, 1 }, { 1925, 570, 1732, 1 },
+    { 1922, 564, 1733, 1 }, { 1943, 569, 1734, 2 }, { 1918, 226, 1736, 1 }, { 0, 574, 1737, 1 },
+    { 0, 573, 1738, 1 }, { 1944, 569, 1739, 2 }, { 1939, 226, 1741, 1 }, { 0, 575, 1742, 1 },
+    { 1946, 581, 1743, 1 }, { 0, 398, 1744, 1 }, { 0, 402, 1745, 1 }, { 1938, 410, 1746, 1 },
+    { 1919, 556, 1747, 1 }, { 0, 573, 1748, 1 }, { 1952, 411, 1749, 1 }, { 1936, 416, 1750, 1 },
+    { 1943, 419, 1751, 1 }, { 1943, 207, 1752, 1 }, { 1942, 582, 1753, 1 }, { 0, 584, 1754, 1 },
+    { 1955, 586, 1755, 1 }, { 0, 600, 1756, 1 }, { 1953, 582, 1757, 1 }, { 1943, 398, 1758, 1 },
+    { 0, 600, 1759, 1 }, { 1957, 603, 1760, 2 }, { 0, 606, 1762, 1 }, { 1937, 607, 1763, 1 },
+    { 1949, 210, 1764, 1 }, { 1949, 601, 1765, 1 }, { 0, 602, 1766, 1 }, { 1964, 610, 1767, 2 },
+    { 1946, 612, 1769, 1 }, { 0, 613, 1770, 1 }, { 1955, 619, 1771, 2 }, { 0, 620, 1773, 1 },
+    { 0, 621, 1774, 1 }, { 1953, 563, 1775, 1 }, { 1950, 567, 1776, 1 }, { 1959, 571, 1777, 1 },
+    { 0, 577, 1778, 1 }, { 0, 583, 1779, 1 }, { 0, 436, 1780, 1 }, { 0, 447, 1781, 1 },
+    { 0, 449, 1782, 1 }, { 0, 452, 1783, 1 }, { 1967, 239, 1784, 1 }, { 1952, 250, 1785, 1 },
+    { 0, 251, 1786, 1 }, { 1956, 236, 1787, 1 }, { 1957, 241, 1788, 1 }, { 1973, 248, 1789, 1 },
+    { 1967, 285, 1790, 1 }, { 1975, 286, 1791, 1 }, { 1967, 328, 1792, 1 }, { 1957, 341, 1793, 1 },
+    { 0, 256, 1794, 1 }, { 0, 263, 1795, 1 }, { 0, 269, 1796, 1 }, { 0, 608, 1797, 1 },
+    { 1958, 614, 1798, 1 }, { 1972, 618, 1799, 1 }, { 1980, 623, 1800, 1 }, { 0, 624, 1801, 1 },
+    { 1981, 625, 1802, 1 }, { 1966, 250, 1803, 1 }, { 1969, 627, 1804, 1 }, { 0, 622, 1805, 1 },
+    { 0, 626, 1806, 1 }, { 1976, 634, 1807, 1 }, { 1984, 635, 1808, 1 }, { 1981, 639, 1809, 2 },
+    { 1973, 643, 1811, 1 }, { 1988, 578, 1812, 1 }, { 0, 585, 1813, 1 }, { 1989, 587, 1814, 1 },
+    { 0, 591, 1815, 1 }, { 0, 592, 1816, 1 }, { 1979, 585, 1817, 1 }, { 0, 595, 1818, 1 },
+    { 0, 628, 1819, 1 }, { 0, 632, 1820, 1 }, { 0, 585, 1821, 1 }, { 1990, 636, 1822, 1 },
+    { 1977, 633, 1823, 1 }, { 1998, 638, 1824, 1 }, { 1991, 628, 1825, 1 }, { 1981, 642, 1826, 1 },
+    { 1984, 642, 1827, 1 }, { 0, 592, 1828, 1 }, { 1975, 591, 1829, 1 }, { 1983, 640, 1830, 1 },
+    { 1989, 628, 1831, 1 }, { 0, 641, 1832, 1 }, { 0, 644, 1833, 1 }, { 1996, 642, 1834, 1 },
+    { 0, 647, 1835, 1 }, { 2000, 645, 1836, 2 }, { 0, 649, 1838, 1 }, { 2004, 653, 1839, 2 },
+    { 0, 659, 1841, 1 }, { 1990, 665, 1842, 1 }, { 1997, 669, 1843, 1 }, { 0, 294, 1844, 1 },
+    { 0, 299, 1845, 1 }, { 0, 301, 1846, 1 }, { 0, 359, 1847, 1 }, { 2004, 649, 1848, 1 },
+    { 0, 414, 1849, 1 }, { 0, 641, 1850, 1 }, { 2007, 364, 1851, 1 }, { 0, 418, 1852, 1 },
+    { 1995, 274, 1853, 1 }, { 0, 427, 1854, 1 }, { 0, 350, 1855, 1 }, { 2011, 358, 1856, 1 },
+    { 1995, 659, 1857, 1 }, { 2009, 427, 1858, 1 }, { 2004, 364, 1859, 1 }, { 0, 362, 1860, 1 },
+    { 1998, 306, 1861, 1 }, { 2013, 320, 1862, 1 }, { 0, 656, 1863, 1 }, { 2011, 657, 1864, 1 },
+    { 0, 667, 1865, 1 }, { 0, 670, 1866, 1 }, { 0, 667, 1867, 1 }, { 1996, 670, 1868, 1 },
+    { 2012, 502, 1869, 1 }, { 0, 506, 1870, 1 }, { 0, 656, 1871, 1 }, { 2008, 498, 1872, 1 },
+    { 2015, 512, 1873, 1 }, { 2026, 303, 1874, 1 }, { 2026, 311, 1875, 1 }, { 0, 280, 1876, 1 },
+    { 0, 668, 1877, 1 }, { 0, 671, 1878, 1 }, { 2019, 498, 1879, 2 }, { 2028, 672, 1881, 1 },
+    { 2009, 512, 1882, 2 }, { 2014, 320, 1884, 2 }, { 0, 320, 1886, 1 }, { 0, 673, 1887, 1 },
+    { 2020, 498, 1888, 1 }, { 2009, 675, 1889, 1 }, { 2026, 678, 1890, 1 }, { 0, 498, 1891, 1 },
+    { 0, 482, 1892, 1 }, { 0, 486, 1893, 1 }, { 2031, 311, 1894, 1 }, { 2023, 493, 1895, 1 },
+    { 2034, 493, 1896, 1 }, { 2035, 648, 1897, 1 }, { 0, 499, 1898, 1 }, { 0, 493, 1899, 1 },
+    { 0, 499, 1900, 1 }, { 2039, 654, 1901, 1 }, { 2022, 658, 1902, 1 }, { 0, 655, 1903, 1 },
+    { 2029, 660, 1904, 1 }, { 2030, 674, 1905, 1 }, { 2016, 482, 1906, 3 }, { 2028, 655, 1909, 1 },
+    { 2041, 674, 1910, 1 }, { 2027, 680, 1911, 1 }, { 2012, 482, 1912, 1 }, { 0, 499, 1913, 1 },
+    { 0, 683, 1914, 1 }, { 0, 683, 1915, 1 }, { 0, 684, 1916, 1 }, { 2023, 685, 1917, 1 },
+    { 0, 686, 1918, 1 }, { 2031, 689, 1919, 2 }, { 2037, 691, 1921, 1 }, { 2041, 691, 1922, 1 },
+    { 2049, 692, 1923, 2 }, { 0, 686, 1925, 1 }, { 2046, 689, 1926, 1 }, { 2048, 686, 1927, 1 },
+    { 0, 688, 1928, 1 }, { 0, 693, 1929, 1 }, { 2050, 694, 1930, 1 }, { 0, 326, 1931, 1 },
+    { 2032, 696, 1932, 1 }, { 2033, 698, 1933, 1 }, { 2040, 704, 1934, 1 }, { 2039, 710, 1935, 1 },
+    { 2057, 713, 1936, 1 }, { 2053, 337, 1937, 2 }, { 2050, 338, 1939, 2 }, { 2060, 355, 1941, 2 },
+    { 2057, 713, 1943, 1 }, { 2047, 373, 1944, 1 }, { 2055, 395, 1945, 1 }, { 2042, 374, 1946, 1 },
+    { 2068, 380, 1947, 1 }, { 2065, 429, 1948, 1 }, { 0, 431, 1949, 1 }, { 2053, 437, 1950, 2 },
+    { 2067, 526, 1952, 1 }, { 2061, 529, 1953, 1 }, { 2069, 531, 1954, 1 }, { 0, 535, 1955, 1 },
+    { 2074, 500, 1956, 1 }, { 0, 511, 1957, 1 }, { 2056, 517, 1958, 1 }, { 2075, 360, 1959, 1 },
+    { 0, 526, 1960, 1 }, { 0, 701, 1961, 1 }, { 2064, 711, 1962, 1 }, { 0, 712, 1963, 1 },
+    { 0, 717, 1964, 1 }, { 0, 718, 1965, 1 }, { 0, 721, 1966, 1 }, { 2067, 589, 1967, 1 },
+    { 2075, 593, 1968, 1 }, { 2062, 599, 1969, 1 }, { 2081, 378, 1970, 1 }, { 2071, 714, 1971, 1 },
+    { 2079, 716, 1972, 1 }, { 0, 725, 1973, 1 }, { 2070, 728, 1974, 1 }, { 2081, 730, 1975, 1 },
+    { 2082, 732, 1976, 1 }, { 2074, 732, 1977, 1 }, { 2081, 733, 1978, 1 }, { 2071, 734, 1979, 1 },
+    { 0, 738, 1980, 1 }, { 0, 703, 1981, 1 }, { 0, 593, 1982, 1 }, { 2086, 706, 1983, 1 },
+    { 0, 708, 1984, 1 }, { 2078, 715, 1985, 1 }, { 2088, 722, 1986, 1 }, { 0, 599, 1987, 1 },
+    { 2082, 724, 1988, 1 }, { 0, 736, 1989, 1 }, { 2076, 737, 1990, 1 }, { 0, 743, 1991, 1 },
+    { 0, 744, 1992, 1 }, { 0, 745, 1993, 1 }, { 0, 746, 1994, 1 }, { 2082, 747, 1995, 1 },
+    { 2093, 750, 1996, 1 }, { 2081, 756, 1997, 1 }, { 2099, 387, 1998, 1 }, { 0, 749, 1999, 1 },
+    { 2096, 751, 2000, 3 }, { 0, 763, 2003, 1 }, { 2077, 766, 2004, 1 }, { 2088, 768, 2005, 1 },
+    { 2090, 736, 2006, 2 }, { 0, 769, 2008, 1 }, { 0, 770, 2009, 1 }, { 0, 450, 2010, 1 },
+    { 2099, 460, 2011, 1 }, { 2086, 461, 2012, 1 }, { 0, 775, 2013, 1 }, { 0, 777, 2014, 1 },
+    { 2091, 775, 2015, 1 }, { 2089, 779, 2016, 1 }, { 2104, 775, 2017, 1 }, { 0, 780, 2018, 1 },
+    { 2096, 782, 2019, 1 }, { 2107, 784, 2020, 1 }, { 2108, 786, 2021, 2 }, { 2103, 775, 2023, 1 },
+    { 0, 787, 2024, 1 }, { 0, 788, 2025, 1 }, { 0, 794, 2026, 1 }, { 0, 778, 2027, 1 },
+    { 0, 788, 2028, 1 }, { 2104, 777, 2029, 1 }, { 2102, 781, 2030, 1 }, { 2102, 789, 2031, 1 },
+    { 0, 790, 2032, 1 }, { 2093, 795, 2033, 1 }, { 2108, 797, 2034, 1 }, { 0, 801, 2035, 1 },
+    { 2112, 789, 2036, 1 }, { 2108, 803, 2037, 1 }, { 2094, 781, 2038, 1 }, { 2109, 807, 2039, 1 },
+    { 0, 799, 2040, 1 }, { 2113, 800, 2041, 1 }, { 0, 802, 2042, 1 }, { 2118, 795, 2043, 1 },
+    { 2107, 810, 2044, 1 }, { 0, 813, 2045, 1 }, { 2102, 812, 2046, 1 }, { 2128, 816, 2047, 1 },
+    { 2109, 817, 2048, 1 }, { 2104, 803, 2049, 1 }, { 2126, 818, 2050, 1 }, { 2106, 797, 2051, 1 },
+    { 2123, 812, 2052, 1 }, { 2128, 819, 2053, 1 }, { 2126, 819, 2054, 1 }, { 2130, 820, 2055, 1 },
+    { 2127, 823, 2056, 1 }, { 2114, 818, 2057, 1 }, { 2129, 541, 2058, 1 }, { 2126, 546, 2059, 1 },
+    { 0, 547, 2060, 1 }, { 2118, 546, 2061, 1 }, { 0, 740, 2062, 1 }, { 0, 748, 2063, 1 },
+    { 0, 752, 2064, 1 }, { 2137, 546, 2065, 1 }, { 2123, 765, 2066, 1 }, { 0, 809, 2067, 1 },
+    { 2130, 811, 2068, 1 }, { 0, 824, 2069, 1 }, { 0, 829, 2070, 1 }, { 2123, 609, 2071, 1 },
+    { 0, 616, 2072, 1 }, { 2133, 754, 2073, 1 }, { 2138, 757, 2074, 1 }, { 0, 758, 2075, 1 },
+    { 2128, 759, 2076, 2 }, { 2143, 616, 2078, 1 }, { 2143, 399, 2079, 1 }, { 2135, 390, 2080, 1 },
+    { 0, 404, 2081, 1 }, { 0, 412, 2082, 1 }, { 2145, 443, 2083, 1 }, { 0, 470, 2084, 1 },
+    { 2137, 476, 2085, 1 }, { 0, 421, 2086, 1 }, { 2145, 530, 2087, 1 }, { 2139, 536, 2088, 1 },
+    { 2136, 444, 2089, 1 }, { 2140, 465, 2090, 1 }, { 2151, 484, 2091, 1 }, { 2145, 827, 2092, 1 },
+    { 2146, 828, 2093, 1 }, { 2141, 830, 2094, 2 }, { 0, 832, 2096, 1 }, { 0, 835, 2097, 1 },
+    { 2159, 837, 2098, 1 }, { 2144, 839, 2099, 1 }, { 2158, 841, 2100, 1 }, { 2166, 842, 2101, 2 },
+    { 2153, 843, 2103, 1 }, { 2164, 844, 2104, 1 }, { 2166, 847, 2105, 1 }, { 2165, 834, 2106, 2 },
+    { 2171, 849, 2108, 1 }, { 2162, 851, 2109, 1 }, { 0, 841, 2110, 1 }, { 2149, 841, 2111, 1 },
+    { 2166, 834, 2112, 1 }, { 2173, 852, 2113, 2 }, { 2174, 494, 2115, 1 }, { 2165, 854, 2116, 1 },
+    { 2142, 837, 2117, 1 }, { 2150, 841, 2118, 1 }, { 2151, 834, 2119, 1 }, { 2141, 841, 2120, 2 },
+    { 2176, 856, 2122, 3 }, { 2178, 858, 2125, 1 }, { 2162, 834, 2126, 2 }, { 2173, 856, 2128, 1 },
+    { 0, 865, 2129, 1 }, { 0, 867, 2130, 1 }, { 2166, 871, 2131, 1 }, { 2165, 865, 2132, 1 },
+    { 2172, 872, 2133, 1 }, { 0, 873, 2134, 1 }, { 2188, 879, 2135, 1 }, { 0, 867, 2136, 1 },
+    { 2185, 611, 2137, 2 }, { 2173, 615, 2139, 1 }, { 0, 631, 2140, 1 }, { 2174, 874, 2141, 1 },
+    { 2184, 880, 2142, 1 }, { 0, 877, 2143, 1 }, { 2186, 611, 2144, 1 }, { 2193, 881, 2145, 1 },
+    { 2178, 883, 2146, 1 }, { 2192, 877, 2147, 2 }, { 2199, 884, 2149, 2 }, { 0, 611, 2151, 1 },
+    { 2181, 885, 2152, 1 }, { 2194, 886, 2153, 1 }, { 2185, 631, 2154, 2 }, { 0, 877, 2156, 1 },
+    { 0, 880, 2157, 1 }, { 2190, 855, 2158, 1 }, { 2187, 859, 2159, 1 }, { 2201, 855, 2160, 2 },
+    { 2203, 863, 2162, 1 }, { 2206, 869, 2163, 1 }, { 0, 878, 2164, 1 }, { 2209, 887, 2165, 1 },
+    { 2199, 886, 2166, 1 }, { 0, 888, 2167, 1 }, { 2207, 889, 2168, 1 }, { 2209, 869, 2169, 1 },
+    { 2204, 893, 2170, 1 }, { 2206, 901, 2171, 1 }, { 2206, 863, 2172, 2 }, { 2212, 893, 2174, 1 },
+    { 2205, 561, 2175, 1 }, { 2201, 565, 2176, 1 }, { 2213, 895, 2177, 1 }, { 2209, 896, 2178, 1 },
+    { 2209, 897, 2179, 1 }, { 0, 900, 2180, 1 }, { 0, 902, 2181, 1 }, { 2213, 906, 2182, 1 },
+    { 0, 918, 2183, 1 }, { 2217, 561, 2184, 1 }, { 2205, 863, 2185, 1 }, { 2220, 902, 2186, 1 },
+    { 2210, 919, 2187, 1 }, { 2211, 907, 2188, 1 }, { 2229, 916, 2189, 1 }, { 2230, 920, 2190, 1 },
+    { 2214, 923, 2191, 1 }, { 2219, 927, 2192, 1 }, { 2226, 495, 2193, 1 }, { 2220, 898, 2194, 1 },
+    { 0, 899, 2195, 1 }, { 2216, 903, 2196, 1 }, { 0, 910, 2197, 1 }, { 2229, 924, 2198, 1 },
+    { 0, 924, 2199, 1 }, { 2218, 925, 2200, 1 }, { 2234, 926, 2201, 2 }, { 2235, 935, 2203, 3 },
+    { 0, 939, 2206, 1 }, { 0, 942, 2207, 1 }, { 2216, 833, 2208, 1 }, { 2224, 838, 2209, 1 },
+    { 0, 840, 2210, 1 }, { 2238, 845, 2211, 1 }, { 2225, 932, 2212, 1 }, { 0, 937, 2213, 1 },
+    { 2242, 938, 2214, 1 }, { 2247, 940, 2215, 2 }, { 0, 944, 2217, 1 }, { 2233, 946, 2218, 1 },
+    { 0, 945, 2219, 1 }, { 2251, 947, 2220, 1 }, { 2248, 914, 2221, 2 }, { 2241, 921, 2223, 1 },
+    { 2235, 845, 2224, 1 }, { 2252, 928, 2225, 1 }, { 2257, 931, 2226, 2 }, { 2259, 934, 2228, 1 },
+    { 2249, 914, 2229, 2 }, { 2255, 962, 2231, 1 }, { 2233, 938, 2232, 1 }, { 2225, 945, 2233, 1 },
+    { 0, 951, 2234, 1 }, { 2248, 940, 2235, 1 }, { 0, 963, 2236, 1 }, { 0, 938, 2237, 1 },
+    { 2247, 931, 2238, 1 }, { 2248, 953, 2239, 1 }, { 2258, 951, 2240, 1 }, { 0, 964, 2241, 1 },
+    { 0, 951, 2242, 1 }, { 2251, 972, 2243, 1 }, { 2252, 973, 2244, 1 }, { 2245, 953, 2245, 1 },
+    { 2262, 957, 2246, 2 }, { 2254, 961, 2248, 1 }, { 0, 971, 2249, 1 }, { 2260, 965, 2250, 1 },
+    { 2274, 977, 2251, 1 }, { 0, 975, 2252, 1 }, { 2265, 974, 2253, 2 }, { 2257, 957, 2255, 2 },
+    { 2259, 961, 2257, 1 }, { 2282, 979, 2258, 2 }, { 2270, 984, 2260, 1 }, { 2264, 957, 2261, 3 },
+    { 2254, 965, 2264, 1 }, { 2281, 986, 2265, 1 }, { 0, 965, 2266, 1 }, { 2256, 971, 2267, 1 },
+    { 2255, 965, 2268, 1 }, { 0, 971, 2269, 1 }, { 2274, 974, 2270, 1 }, { 2282, 719, 2271, 1 },
+    { 2272, 971, 2272, 1 }, { 2283, 723, 2273, 1 }, { 2271, 727, 2274, 1 }, { 2279, 739, 2275, 1 },
+    { 2288, 588, 2276, 1 }, { 2281, 739, 2277, 1 }, { 2280, 666, 2278, 1 }, { 2280, 984, 2279, 1 },
+    { 0, 676, 2280, 1 }, { 2278, 727, 2281, 1 }, { 2286, 677, 2282, 1 }, { 2278, 677, 2283, 1 },
+    { 2292, 681, 2284, 1 }, { 2293, 681, 2285, 1 }, { 2291, 687, 2286, 2 }, { 2288, 677, 2288, 1 },
+    { 0, 727, 2289, 1 }, { 0, 687, 2290, 1 }, { 2296, 596, 2291, 1 }, { 2291, 662, 2292, 1 },
+    { 0, 980, 2293, 1 }, { 2299, 662, 2294, 1 }, { 0, 980, 2295, 1 }, { 2302, 982, 2296, 1 },
+    { 2291, 596, 2297, 1 }, { 0, 983, 2298, 1 }, { 0, 985, 2299, 1 }, { 2276, 677, 2300, 1 },
+    { 2300, 662, 2301, 1 }, { 2305, 991, 2302, 1 }, { 0, 994, 2303, 1 }, { 2289, 982, 2304, 1 },
+    { 2285, 997, 2305, 1 }, { 2303, 1000, 2306, 1 }, { 2307, 995, 2307, 1 }, { 2302, 999, 2308, 1 },
+    { 2311, 1003, 2309, 1 }, { 2299, 1006, 2310, 1 }, { 2319, 1008, 2311, 2 }, { 2311, 999, 2313, 2 },
+    { 2309, 1009, 2315, 1 }, { 2307, 497, 2316, 1 }, { 2330, 1024, 2317, 1 }, { 2320, 1012, 2318, 1 },
+    { 2335, 1024, 2319, 1 }, { 2341, 905, 2320, 1 }, { 2292, 1003, 2321, 1 }, { 2321, 1004, 2322, 1 },
+    { 2314, 1021, 2323, 1 }, { 2322, 497, 2324, 1 }, { 2317, 1003, 2325, 1 }, { 2314, 1009, 2326, 1 },
+    { 2310, 1009, 2327, 2 }, { 0, 1008, 2329, 1 }, { 2322, 1012, 2330, 1 }, { 2324, 1004, 2331, 1 },
+    { 2324, 1021, 2332, 2 }, { 2304, 1009, 2334, 1 }, { 0, 912, 2335, 1 }, { 0, 1004, 2336, 1 },
+    { 0, 1008, 2337, 1 }, { 2308, 1004, 2338, 1 }, { 2318, 1018, 2339, 1 }, { 2330, 1018, 2340, 1 },
+    { 2318, 917, 2341, 1 }, { 0, 1018, 2342, 1 }, { 2336, 922, 2343, 1 }, { 2331, 1018, 2344, 1 },
+    { 0, 862, 2345, 1 }, { 2339, 917, 2346, 1 }, { 2326, 866, 2347, 1 }, { 0, 870, 2348, 1 },
+    { 2345, 876, 2349, 2 }, { 0, 1015, 2351, 1 }, { 2327, 866, 2352, 1 }, { 0, 1016, 2353, 1 },
+    { 2336, 870, 2354, 1 }, { 0, 1017, 2355, 1 }, { 0, 1025, 2356, 1 }, { 2338, 1026, 2357, 1 },
+    { 2332, 1028, 2358, 1 }, { 0, 1029, 2359, 1 }, { 2347, 1031, 2360, 1 }, { 2348, 1032, 2361, 1 },
+    { 0, 1037, 2362, 1 }, { 2333, 956, 2363, 1 }, { 2348, 960, 2364, 1 }, { 2352, 967, 2365, 1 },
+    { 2346, 968, 2366, 1 }, { 2350, 969, 2367, 1 }, { 2349, 993, 2368, 1 }, { 2357, 1001, 2369, 2 },
+    { 2355, 1007, 2371, 1 }, { 2362, 1010, 2372, 2 }, { 2362, 1013, 2374, 1 }, { 0, 969, 2375, 1 },
+    { 2360, 1034, 2376, 1 }, { 2350, 1038, 2377, 1 }, { 2340, 956, 2378, 1 }, { 2361, 1034, 2379, 1 },
+    { 0, 956, 2380, 1 }, { 2364, 1044, 2381, 1 }, { 2346, 1047, 2382, 1 }, { 2368, 1049, 2383, 1 },
+    { 2352, 1044, 2384, 1 }, { 2368, 1046, 2385, 1 }, { 2354, 1050, 2386, 1 }, { 2354, 1051, 2387, 1 },
+    { 0, 1052, 2388, 1 }, { 2377, 1053, 2389, 1 }, { 2371, 1055, 2390, 1 }, { 2362, 1060, 2391, 1 },
+    { 0, 1058, 2392, 1 }, { 2367, 1054, 2393, 1 }, { 2376, 1068, 2394, 1 }, { 2374, 1074, 2395, 1 },
+    { 2368, 1052, 2396, 1 }, { 0, 1054, 2397, 1 }, { 2368, 510, 2398, 1 }, { 2371, 1033, 2399, 1 },
+    { 0, 1054, 2400, 1 }, { 2379, 1058, 2401, 1 }, { 2387, 1039, 2402, 1 }, { 0, 1040, 2403, 1 },
+    { 2387, 1045, 2404, 1 }, { 2370, 804, 2405, 1 }, { 2377, 1054, 2406, 1 }, { 2388, 808, 2407, 2 },
+    { 2394, 590, 2409, 1 }, { 0, 1054, 2410, 1 }, { 2393, 598, 2411, 1 }, { 2384, 1039, 2412, 1 },
+    { 2374, 808, 2413, 1 }, { 2379, 553, 2414, 1 }, { 0, 690, 2415, 1 }, { 2377, 699, 2416, 1 },
+    { 0, 700, 2417, 1 }, { 0, 1063, 2418, 1 }, { 2384, 1064, 2419, 1 }, { 0, 1065, 2420, 1 },
+    { 2378, 1039, 2421, 1 }, { 2391, 1075, 2422, 1 }, { 2382, 1078, 2423, 1 }, { 2382, 579, 2424, 1 },
+    { 2402, 597, 2425, 1 }, { 2392, 1071, 2426, 1 }, { 0, 1077, 2427, 1 }, { 0, 1077, 2428, 1 },
+    { 2391, 1079, 2429, 1 }, { 2398, 1085, 2430, 1 }, { 0, 1087, 2431, 1 }, { 2390, 1085, 2432, 1 },
+    { 2396, 1089, 2433, 1 }, { 2396, 958, 2434, 1 }, { 2395, 1087, 2435, 1 }, { 2387, 958, 2436, 1 },
+    { 2405, 966, 2437, 1 }, { 0, 976, 2438, 1 }, { 2409, 1072, 2439, 1 }, { 2403, 1076, 2440, 1 },
+    { 2405, 1080, 2441, 1 }, { 2412, 1080, 2442, 1 }, { 2402, 1086, 2443, 1 }, { 2414, 1081, 2444, 1 },
+    { 2415, 1090, 2445, 1 }, { 2406, 1092, 2446, 2 }, { 0, 1092, 2448, 1 }, { 2409, 1097, 2449, 2 },
+    { 2403, 1092, 2451, 1 }, { 2416, 1098, 2452, 1 }, { 0, 1087, 2453, 1 }, { 2407, 1104, 2454, 1 },
+    { 0, 1092, 2455, 1 }, { 0, 1093, 2456, 1 }, { 2412, 1094, 2457, 1 }, { 0, 1096, 2458, 1 },
+    { 0, 1101, 2459, 1 }, { 0, 1076, 2460, 1 }, { 2413, 1094, 2461, 1 }, { 2424, 1099, 2462, 1 },
+    { 2426, 1099, 2463, 1 }, { 0, 1099, 2464, 1 }, { 2428, 1105, 2465, 1 }, { 2416, 1096, 2466, 2 },
+    { 2427, 1109, 2468, 1 }, { 2413, 1091, 2469, 1 }, { 0, 1102, 2470, 1 }, { 0, 1106, 2471, 1 },
+    { 0, 1111, 2472, 1 }, { 2419, 661, 2473, 1 }, { 0, 637, 2474, 1 }, { 2428, 651, 2475, 1 },
+    { 0, 707, 2476, 1 }, { 2435, 646, 2477, 1 }, { 2432, 720, 2478, 1 }, { 2437, 753, 2479, 1 },
+    { 2430, 762, 2480, 1 }, { 2421, 729, 2481, 1 }, { 2422, 741, 2482, 1 }, { 0, 742, 2483, 1 },
+    { 0, 760, 2484, 1 }, { 0, 761, 2485, 1 }, { 2430, 764, 2486, 1 }, { 0, 773, 2487, 1 },
+    { 0, 774, 2488, 1 }, { 2442, 776, 2489, 1 }, { 2443, 783, 2490, 1 }, { 2427, 793, 2491, 1 },
+    { 0, 848, 2492, 1 }, { 0, 861, 2493, 1 }, { 0, 796, 2494, 1 }, { 2428, 882, 2495, 1 },
+    { 2444, 894, 2496, 1 }, { 0, 798, 2497, 1 }, { 0, 806, 2498, 1 }, { 2428, 815, 2499, 1 },
+    { 0, 821, 2500, 1 }, { 2435, 825, 2501, 1 }, { 0, 868, 2502, 1 }, { 2432, 836, 2503, 2 },
+    { 0, 850, 2505, 1 }, { 2426, 875, 2506, 1 }, { 2432, 941, 2507, 1 }, { 2439, 890, 2508, 1 },
+    { 2454, 1057, 2509, 1 }, { 0, 1066, 2510, 1 }, { 2438, 1070, 2511, 1 }, { 2439, 891, 2512, 1 },
+    { 2438, 892, 2513, 1 }, { 0, 1112, 2514, 1 }, { 0, 1113, 2515, 1 }, { 2436, 1130, 2516, 1 },
+    { 2433, 941, 2517, 1 }, { 0, 1127, 2518, 1 }, { 2442, 1127, 2519, 1 }, { 2444, 1131, 2520, 1 },
+    { 2445, 1112, 2521, 1 }, { 2458, 911, 2522, 1 }, { 0, 929, 2523, 1 }, { 0, 936, 2524, 1 },
+    { 2445, 943, 2525, 1 }, { 2458, 952, 2526, 2 }, { 2461, 978, 2528, 1 }, { 0, 987, 2529, 1 },
+    { 2463, 989, 2530, 1 }, { 0, 988, 2531, 1 }, { 0, 990, 2532, 1 }, { 0, 1005, 2533, 1 },
+    { 2464, 1011, 2534, 2 }, { 0, 1041, 2536, 1 }, { 0, 1059, 2537, 1 }, { 0, 1108, 2538, 1 },
+    { 0, 1069, 2539, 1 }, { 2463, 1073, 2540, 1 }, { 2466, 1035, 2541, 1 }, { 2465, 1100, 2542, 1 },
+    { 2466, 1042, 2543, 1 }, { 0, 1043, 2544, 1 }, { 0, 1048, 2545, 1 }, { 2457, 1114, 2546, 1 },
+    { 0, 1115, 2547, 1 }, { 2459, 1116, 2548, 1 }, { 2472, 1115, 2549, 1 }, { 2459, 1118, 2550, 1 },
+    { 2466, 1120, 2551, 1 }, { 0, 1048, 2552, 1 }, { 2476, 1123, 2553, 1 }, { 0, 1124, 2554, 1 },
+    { 0, 1132, 2555, 1 }, { 0, 1056, 2556, 1 }, { 2477, 1082, 2557, 1 }, { 2463, 1083, 2558, 1 },
+    { 2464, 1136, 2559, 1 }, { 2454, 1048, 2560, 1 }, { 2467, 1048, 2561, 1 }, { 0, 1084, 2562, 1 },
+    { 2467, 1088, 2563, 1 }, { 2468, 1119, 2564, 1 }, { 0, 1121, 2565, 1 }, { 2469, 1122, 2566, 1 },
+    { 0, 1134, 2567, 1 }, { 2478, 1137, 2568, 1 }, { 2486, 1138, 2569, 1 }, { 0, 1149, 2570, 1 },
+    { 2472, 1153, 2571, 1 }, { 2488, 1144, 2572, 1 }, { 2488, 1134, 2573, 1 }, { 2473, 1119, 2574, 1 },
+    { 0, 1141, 2575, 1 }, { 2482, 1143, 2576, 1 }, { 2476, 1145, 2577, 1 }, { 2484, 1152, 2578, 1 },
+    { 0, 1154, 2579, 1 }, { 0, 1156, 2580, 1 }, { 0, 1145, 2581, 1 }, { 0, 1138, 2582, 1 },
+    { 2492, 1158, 2583, 1 }, { 2473, 1171, 2584, 1 }, { 0, 1157, 2585, 1 }, { 0, 1154, 2586, 1 },
+    { 0, 1172, 2587, 1 }, { 0, 1172, 2588, 1 }, { 0, 1166, 2589, 1 }, { 0, 1167, 2590, 1 },
+    { 2491, 1147, 2591, 1 }, { 2499, 1148, 2592, 1 }, { 2496, 1150, 2593, 1 }, { 2484, 1161, 2594, 1 },
+    { 0, 1169, 2595, 1 }, { 0, 1173, 2596, 1 }, { 0, 1181, 2597, 1 }, { 0, 1183, 2598, 1 },
+    { 0, 1160, 2599, 1 }, { 0, 1162, 2600, 1 }, { 0, 1163, 2601, 1 }, { 2483, 1150, 2602, 1 },
+    { 0, 1170, 2603, 1 }, { 2500, 1186, 2604, 2 }, { 0, 1188, 2606, 1 }, { 2487, 1189, 2607, 1 },
+    { 0, 1190, 2608, 1 }, { 0, 1174, 2609, 1 }, { 2501, 1175, 2610, 1 }, { 0, 1180, 2611, 1 },
+    { 0, 1184, 2612, 1 }, { 0, 1179, 2613, 1 }, { 2493, 1175, 2614, 1 }, { 2505, 1191, 2615, 1 },
+    { 0, 1182, 2616, 1 }, { 2503, 1179, 2617, 1 }, { 2506, 1195, 2618, 1 }, { 2505, 1191, 2619, 1 },
+    { 0, 1187, 2620, 1 }, { 2487, 1194, 2621, 1 }, { 2499, 1220, 2622, 1 }, { 0, 1198, 2623, 1 },
+    { 2494, 1201, 2624, 1 }, { 0, 1199, 2625, 1 }, { 0, 1203, 2626, 1 }, { 0, 1207, 2627, 1 },
+    { 0, 1200, 2628, 1 }, { 0, 1202, 2629, 1 }, { 0, 1204, 2630, 1 }, { 0, 1210, 2631, 1 },
+    { 0, 1214, 2632, 1 }, { 2495, 1205, 2633, 1 }, { 2498, 1206, 2634, 1 }, { 0, 1208, 2635, 1 },
+    { 2499, 1209, 2636, 2 }, { 2500, 1213, 2638, 1 }, { 0, 1216, 2639, 1 }, { 0, 1231, 2640, 1 },
+    { 0, 1219, 2641, 1 }, { 2507, 1222, 2642, 1 }, { 2501, 1223, 2643, 1 }, { 0, 1224, 2644, 1 },
+    { 2521, 1225, 2645, 1 }, { 2516, 1226, 2646, 1 }, { 2506, 1230, 2647, 1 }, { 0, 1213, 2648, 1 },
+    { 2513, 1228, 2649, 1 }, { 2521, 1233, 2650, 1 }, { 0, 1235, 2651, 1 }, { 0, 1236, 2652, 1 },
+    { 2510, 1237, 2653, 1 }, { 2511, 1239, 2654, 1 }, { 0, 1240, 2655, 1 }, { 2525, 1242, 2656, 1 },
+    { 2517, 1245, 2657, 1 }, { 0, 1246, 2658, 1 }, { 0, 1247, 2659, 1 }, { 2520, 1233, 2660, 1 },
+    { 0, 1254, 2661, 1 }, { 2528, 1255, 2662, 1 }, { 0, 1273, 2663, 1 }, { 0, 1242, 2664, 1 },
+    { 0, 1257, 2665, 1 }, { 0, 1258, 2666, 1 }, { 2519, 1259, 2667, 1 }, { 0, 1260, 2668, 1 },
+    { 2521, 1261, 2669, 1 }, { 2530, 1262, 2670, 1 }, { 0, 1263, 2671, 1 }, { 0, 1268, 2672, 1 },
+    { 2511, 1269, 2673, 1 }, { 2519, 1270, 2674, 1 }, { 2520, 1272, 2675, 1 }, { 0, 1274, 2676, 1 },
+    { 2534, 1277, 2677, 1 }, { 2522, 1278, 2678, 1 }, { 2522, 1279, 2679, 1 }, { 0, 1280, 2680, 1 },
+    { 0, 1281, 2681, 1 }, { 2535, 1286, 2682, 1 }, { 2525, 1283, 2683, 1 }, { 0, 1298, 2684, 1 },
+    { 0, 1294, 2685, 1 }, { 0, 1300, 2686, 1 }, { 2524, 1291, 2687, 1 }, { 0, 1295, 2688, 1 },
+    { 2520, 1296, 2689, 1 }, { 2528, 1303, 2690, 1 }, { 0, 1292, 2691, 1 }, { 2529, 1293, 2692, 1 },
+    { 2543, 1299, 2693, 1 }, { 2530, 1305, 2694, 2 }, { 0, 1279, 2696, 1 }, { 2542, 1315, 2697, 1 },
+    { 0, 1307, 2698, 1 }, { 0, 1324, 2699, 1 }, { 0, 1309, 2700, 1 }, { 2544, 1310, 2701, 1 },
+    { 2538, 1318, 2702, 1 }, { 2550, 1326, 2703, 1 }, { 0, 1325, 2704, 1 }, { 0, 1320, 2705, 1 },
+    { 2536, 1323, 2706, 1 }, { 0, 1328, 2707, 1 }, { 0, 1329, 2708, 1 }, { 2536, 1349, 2709, 2 },
+    { 2542, 1331, 2711, 1 }, { 0, 1335, 2712, 1 }, { 0, 1339, 2713, 1 }, { 0, 1307, 2714, 1 },
+    { 2538, 1346, 2715, 1 }, { 0, 1352, 2716, 1 }, { 0, 1336, 2717, 1 }, { 0, 1346, 2718, 1 },
+    { 0, 1340, 2719, 1 }, { 2550, 1348, 2720, 1 }, { 0, 1341, 2721, 1 }, { 0, 1342, 2722, 1 },
+    { 2541, 1358, 2723, 1 }, { 2542, 1347, 2724, 1 }, { 0, 1353, 2725, 1 }, { 0, 1354, 2726, 1 },
+    { 2542, 1370, 2727, 2 }, { 0, 1374, 2729, 1 }, { 0, 1359, 2730, 1 }, { 2542, 1360, 2731, 1 },
+    { 2549, 1361, 2732, 1 }, { 0, 1365, 2733, 1 }, { 2557, 1371, 2734, 1 }, { 0, 1366, 2735, 1 },
+    { 0, 1368, 2736, 1 }, { 0, 1369, 2737, 1 }, { 2540, 1372, 2738, 1 }, { 0, 1373, 2739, 1 },
+    { 0, 1379, 2740, 1 }, { 2541, 1387, 2741, 1 }, { 0, 1381, 2742, 1 }, { 0, 1386, 2743, 1 },
+    { 2560, 1382, 2744, 1 }, { 0, 1383, 2745, 1 }, { 2549, 1384, 2746, 2 }, { 2565, 1390, 2748, 1 },
+    { 0, 1392, 2749, 1 }, { 0, 1393, 2750, 1 }, { 2545, 1394, 2751, 1 }, { 0, 1395, 2752, 1 },
+    { 2551, 1396, 2753, 1 }, { 2567, 1400, 2754, 1 }, { 2570, 1397, 2755, 1 }, { 0, 1398, 2756, 1 },
+    { 2570, 1398, 2757, 1 }, { 2555, 1399, 2758, 1 }, { 0, 1401, 2759, 1 }, { 0, 1402, 2760, 1 },
+    { 2567, 1403, 2761, 1 }, { 2554, 1404, 2762, 1 }, { 2553, 1405, 2763, 1 }, { 0, 1407, 2764, 1 },
+    { 0, 1408, 2765, 1 }, { 2574, 1409, 2766, 1 }, { 0, 1410, 2767, 1 }, { 0, 1412, 2768, 1 },
+    { 2575, 1414, 2769, 1 }, { 0, 1415, 2770, 1 }, { 2566, 1418, 2771, 1 }, { 0, 1423, 2772, 1 },
+    { 0, 1424, 2773, 1 }, { 0, 1425, 2774, 1 }, { 0, 1426, 2775, 1 }, { 0, 1427, 2776, 1 },
+    { 2564, 1428, 2777, 1 }, { 2567, 1430, 2778, 1 }, { 0, 1431, 2779, 1 }, { 2566, 1432, 2780, 1 },
+    { 0, 1433, 2781, 1 }, { 0, 1434, 2782, 1 }, { 2577, 1435, 2783, 1 }, { 2568, 1439, 2784, 1 },
+    { 0, 1441, 2785, 1 }, { 2569, 1442, 2786, 1 }, { 0, 1444, 2787, 1 }, { 2570, 1460, 2788, 1 },
+    { 0, 1446, 2789, 1 }, { 2571, 1451, 2790, 1 }, { 2572, 1452, 2791, 1 }, { 2587, 1453, 2792, 1 },
+    { 0, 1454, 2793, 1 }, { 2588, 1456, 2794, 2 }, { 0, 1458, 2796, 1 }, { 2579, 1459, 2797, 1 },
+    { 2576, 1464, 2798, 1 }, { 0, 1465, 2799, 1 }, { 2575, 1468, 2800, 1 }, { 0, 1470, 2801, 1 },
+    { 2576, 1475, 2802, 1 }, { 0, 1481, 2803, 1 }, { 2581, 1469, 2804, 1 }, { 0, 1472, 2805, 1 },
+    { 0, 1473, 2806, 1 }, { 2580, 1474, 2807, 1 }, { 0, 1482, 2808, 1 }, { 2586, 1490, 2809, 1 },
+    { 0, 1483, 2810, 1 }, { 2596, 1488, 2811, 1 }, { 0, 1485, 2812, 1 }, { 2587, 1495, 2813, 1 },
+    { 0, 1486, 2814, 1 }, { 0, 1503, 2815, 1 }, { 2595, 1489, 2816, 1 }, { 0, 1501, 2817, 1 },
+    { 2585, 1491, 2818, 1 }, { 2599, 1493, 2819, 1 }, { 2602, 1496, 2820, 1 }, { 0, 1498, 2821, 1 },
+    { 2582, 1504, 2822, 1 }, { 2590, 1499, 2823, 1 }, { 2604, 1500, 2824, 1 }, { 2592, 1502, 2825, 1 },
+    { 0, 1509, 2826, 1 }, { 0, 1505, 2827, 1 }, { 0, 1506, 2828, 1 }, { 0, 1507, 2829, 1 },
+    { 0, 1508, 2830, 1 }, { 0, 1510, 2831, 1 }, { 2606, 1511, 2832, 1 }, { 2599, 1513, 2833, 1 },
+    { 0, 1517, 2834, 1 }, { 0, 1518, 2835, 1 }, { 2608, 1520, 2836, 1 }, { 0, 1523, 2837, 1 },
+    { 0, 1529, 2838, 1 }, { 2609, 1525, 2839, 1 }, { 0, 1526, 2840, 1 }, { 0, 1528, 2841, 1 },
+    { 0, 1530, 2842, 1 }, { 0, 1531, 2843, 1 }, { 0, 1534, 2844, 1 }, { 0, 1536, 2845, 1 },
+    { 2610, 1538, 2846, 1 }, { 0, 1539, 2847, 1 }, { 0, 1540, 2848, 1 }, { 2592, 1541, 2849, 1 },
+    { 2599, 1542, 2850, 1 }, { 2613, 1543, 2851, 1 }, { 2618, 1544, 2852, 1 }, { 0, 1545, 2853, 1 },
+    { 0, 1548, 2854, 1 }, { 0, 1564, 2855, 1 }, { 0, 1549, 2856, 1 }, { 2608, 1550, 2857, 1 },
+    { 2603, 1559, 2858, 1 }, { 2602, 1565, 2859, 1 }, { 0, 1567, 2860, 1 }, { 0, 1551, 2861, 1 },
+    { 2612, 1552, 2862, 1 }, { 0, 1553, 2863, 1 }, { 0, 1555, 2864, 1 }, { 2611, 1560, 2865, 1 },
+    { 2606, 1566, 2866, 1 }, { 0, 1555, 2867, 1 }, { 0, 1570, 2868, 1 }, { 2615, 1554, 2869, 1 },
+    { 2610, 1556, 2870, 1 }, { 2615, 1557, 2871, 1 }, { 2612, 1561, 2872, 1 }, { 0, 1562, 2873, 1 },
+    { 0, 1563, 2874, 1 }, { 2611, 1568, 2875, 1 }, { 2631, 1571, 2876, 1 }, { 0, 1569, 2877, 1 },
+    { 2598, 1551, 2878, 1 }, { 0, 1575, 2879, 1 }, { 2630, 1574, 2880, 1 }, { 2624, 1576, 2881, 1 },
+    { 2627, 1568, 2882, 1 }, { 0, 1578, 2883, 1 }, { 0, 1580, 2884, 1 }, { 0, 1586, 2885, 1 },
+    { 2632, 1581, 2886, 1 }, { 0, 1594, 2887, 1 }, { 0, 1583, 2888, 1 }, { 2633, 1589, 2889, 1 },
+    { 2635, 1584, 2890, 1 }, { 2617, 1568, 2891, 1 }, { 2623, 1587, 2892, 1 }, { 2623, 1588, 2893, 1 },
+    { 2631, 1590, 2894, 1 }, { 2629, 1592, 2895, 1 }, { 0, 1593, 2896, 1 }, { 0, 1604, 2897, 1 },
+    { 0, 1597, 2898, 1 }, { 0, 1580, 2899, 1 }, { 2627, 1599, 2900, 1 }, { 2621, 1598, 2901, 1 },
+    { 0, 1600, 2902, 1 }, { 2642, 1610, 2903, 1 }, { 0, 1622, 2904, 1 }, { 2631, 1589, 2905, 1 },
+    { 0, 1601, 2906, 1 }, { 0, 1607, 2907, 1 }, { 0, 1603, 2908, 1 }, { 0, 1606, 2909, 1 },
+    { 2643, 1608, 2910, 1 }, { 0, 1611, 2911, 1 }, { 2644, 1609, 2912, 1 }, { 0, 1612, 2913, 1 },
+    { 2642, 1621, 2914, 1 }, { 0, 1613, 2915, 1 }, { 2631, 1614, 2916, 1 }, { 2645, 1615, 2917, 1 },
+    { 0, 1616, 2918, 1 }, { 2649, 1623, 2919, 1 }, { 0, 1610, 2920, 1 }, { 0, 1619, 2921, 1 },
+    { 0, 1624, 2922, 1 }, { 2650, 1625, 2923, 1 }, { 2651, 1626, 2924, 1 }, { 2636, 1627, 2925, 1 },
+    { 2637, 1628, 2926, 1 }, { 2654, 1629, 2927, 1 }, { 2646, 1630, 2928, 1 }, { 2646, 1631, 2929, 1 },
+    { 0, 1633, 2930, 1 }, { 0, 1635, 2931, 1 }, { 0, 1637, 2932, 1 }, { 2641, 1638, 2933, 1 },
+    { 2658, 1639, 2934, 2 }, { 0, 1642, 2936, 1 }, { 0, 1643, 2937, 1 }, { 2659, 1645, 2938, 1 },
+    { 2663, 1656, 2939, 1 }, { 2640, 1646, 2940, 1 }, { 0, 1648, 2941, 1 }, { 0, 1662, 2942, 1 },
+    { 2654, 1649, 2943, 1 }, { 0, 1665, 2944, 1 }, { 0, 1663, 2945, 1 }, { 2653, 1651, 2946, 1 },
+    { 0, 1653, 2947, 1 }, { 2649, 1654, 2948, 2 }, { 2665, 1660, 2950, 1 }, { 0, 1660, 2951, 1 },
+    { 2658, 1655, 2952, 1 }, { 0, 1657, 2953, 1 }, { 2658, 1658, 2954, 1 }, { 2660, 1668, 2955, 1 },
+    { 0, 1659, 2956, 1 }, { 2665, 1670, 2957, 1 }, { 2670, 1669, 2958, 1 }, { 2670, 1675, 2959, 1 },
+    { 2672, 1661, 2960, 1 }, { 0, 1673, 2961, 1 }, { 2671, 1674, 2962, 1 }, { 2661, 1676, 2963, 2 },
+    { 0, 1683, 2965, 1 }, { 2676, 1687, 2966, 3 }, { 0, 1677, 2969, 1 }, { 0, 1684, 2970, 1 },
+    { 2677, 1679, 2971, 1 }, { 0, 1683, 2972, 1 }, { 2667, 1688, 2973, 1 }, { 0, 1692, 2974, 1 },
+    { 2664, 1691, 2975, 1 }, { 2666, 1696, 2976, 1 }, { 2669, 1682, 2977, 1 }, { 2681, 1682, 2978, 1 },
+    { 0, 1658, 2979, 1 }, { 0, 1694, 2980, 1 }, { 0, 1680, 2981, 1 }, { 2675, 1685, 2982, 1 },
+    { 2668, 1686, 2983, 1 }, { 2671, 1703, 2984, 1 }, { 2673, 1689, 2985, 1 }, { 0, 1695, 2986, 1 },
+    { 2674, 1697, 2987, 1 }, { 0, 1698, 2988, 1 }, { 0, 1705, 2989, 1 }, { 0, 1699, 2990, 1 },
+    { 0, 1701, 2991, 1 }, { 2688, 1706, 2992, 1 }, { 0, 1707, 2993, 1 }, { 2686, 1711, 2994, 1 },
+    { 2687, 1723, 2995, 1 }, { 0, 1708, 2996, 1 }, { 2678, 1709, 2997, 1 }, { 0, 1710, 2998, 1 },
+    { 0, 1700, 2999, 1 }, { 0, 1714, 3000, 1 }, { 0, 1720, 3001, 1 }, { 0, 1715, 3002, 1 },
+    { 0, 1717, 3003, 1 }, { 0, 1724, 3004, 1 }, { 2692, 1702, 3005, 1 }, { 2680, 1719, 3006, 1 },
+    { 0, 1727, 3007, 1 }, { 0, 1725, 3008, 1 }, { 0, 1728, 3009, 1 }, { 0, 1729, 3010, 1 },
+    { 0, 1730, 3011, 1 }, { 0, 1731, 3012, 1 }, { 2691, 1735, 3013, 1 }, { 0, 1735, 3014, 1 },
+    { 2682, 1732, 3015, 1 }, { 0, 1742, 3016, 1 }, { 2689, 1746, 3017, 1 }, { 0, 1733, 3018, 1 },
+    { 0, 1736, 3019, 1 }, { 2697, 1747, 3020, 1 }, { 0, 1748, 3021, 1 }, { 0, 1753, 3022, 1 },
+    { 0, 1748, 3023, 1 }, { 2698, 1737, 3024, 1 }, { 0, 1745, 3025, 1 }, { 0, 1743, 3026, 1 },
+    { 0, 1751, 3027, 1 }, { 2699, 1757, 3028, 1 }, { 0, 1734, 3029, 1 }, { 0, 1739, 3030, 1 },
+    { 0, 1734, 3031, 1 }, { 0, 1750, 3032, 1 }, { 0, 1758, 3033, 1 }, { 0, 1759, 3034, 1 },
+    { 0, 1763, 3035, 1 }, { 0, 1744, 3036, 1 }, { 2698, 1752, 3037, 1 }, { 2692, 1738, 3038, 1 },
+    { 2701, 1752, 3039, 1 }, { 2683, 1740, 3040, 1 }, { 2684, 1741, 3041, 1 }, { 0, 1760, 3042, 1 },
+    { 2690, 1765, 3043, 1 }, { 0, 1762, 3044, 1 }, { 0, 1766, 3045, 1 }, { 0, 1770, 3046, 1 },
+    { 0, 1772, 3047, 1 }, { 2692, 1768, 3048, 2 }, { 2707, 1775, 3050, 1 }, { 2693, 1776, 3051, 1 },
+    { 2694, 1778, 3052, 1 }, { 0, 1779, 3053, 1 }, { 2699, 1781, 3054, 1 }, { 2696, 1794, 3055, 1 },
+    { 0, 1782, 3056, 1 }, { 2699, 1783, 3057, 1 }, { 2713, 1784, 3058, 1 }, { 2700, 1785, 3059, 1 },
+    { 2701, 1786, 3060, 1 }, { 0, 1787, 3061, 1 }, { 2703, 1788, 3062, 1 }, { 2719, 1789, 3063, 1 },
+    { 0, 1790, 3064, 1 }, { 2712, 1792, 3065, 1 }, { 2705, 1795, 3066, 1 }, { 0, 1789, 3067, 1 },
+    { 0, 1793, 3068, 1 }, { 2708, 1797, 3069, 1 }, { 0, 1800, 3070, 1 }, { 0, 1798, 3071, 1 },
+    { 0, 1799, 3072, 1 }, { 2707, 1801, 3073, 1 }, { 2713, 1802, 3074, 1 }, { 2724, 1803, 3075, 1 },
+    { 0, 1812, 3076, 1 }, { 2696, 1787, 3077, 1 }, { 2710, 1805, 3078, 1 }, { 0, 1806, 3079, 1 },
+    { 0, 1807, 3080, 1 }, { 0, 1809, 3081, 1 }, { 2719, 1822, 3082, 1 }, { 0, 1817, 3083, 1 },
+    { 2707, 1810, 3084, 1 }, { 0, 1811, 3085, 1 }, { 2713, 1814, 3086, 1 }, { 0, 1815, 3087, 1 },
+    { 2720, 1818, 3088, 1 }, { 2710, 1827, 3089, 1 }, { 2731, 1836, 3090, 1 }, { 2722, 1820, 3091, 1 },
+    { 2733, 1821, 3092, 1 }, { 0, 1823, 3093, 1 }, { 0, 1828, 3094, 1 }, { 2735, 1824, 3095, 1 },
+    { 2729, 1826, 3096, 1 }, { 2737, 1829, 3097, 1 }, { 2723, 1831, 3098, 1 }, { 0, 1834, 3099, 1 },
+    { 2729, 1837, 3100, 1 }, { 0, 1838, 3101, 1 }, { 0, 1839, 3102, 1 }, { 2730, 1840, 3103, 1 },
+    { 2740, 1841, 3104, 1 }, { 2739, 1844, 3105, 1 }, { 0, 1845, 3106, 1 }, { 0, 1823, 3107, 1 },
+    { 0, 1847, 3108, 1 }, { 2740, 1850, 3109, 1 }, { 2741, 1848, 3110, 1 }, { 2735, 1849, 3111, 1 },
+    { 0, 1851, 3112, 1 }, { 2730, 1852, 3113, 1 }, { 0, 1854, 3114, 1 }, { 0, 1855, 3115, 1 },
+    { 2726, 1856, 3116, 1 }, { 0, 1857, 3117, 1 }, { 2733, 1858, 3118, 1 }, { 2749, 1859, 3119, 1 },
+    { 2750, 1860, 3120, 1 }, { 2732, 1861, 3121, 1 }, { 0, 1864, 3122, 1 }, { 2736, 1863, 3123, 1 },
+    { 0, 1865, 3124, 1 }, { 2753, 1867, 3125, 1 }, { 0, 1870, 3126, 1 }, { 0, 1874, 3127, 1 },
+    { 2733, 1879, 3128, 1 }, { 2741, 1875, 3129, 1 }, { 0, 1876, 3130, 1 }, { 2752, 1878, 3131, 1 },
+    { 0, 1880, 3132, 1 }, { 0, 1881, 3133, 1 }, { 2738, 1885, 3134, 1 }, { 0, 1887, 3135, 1 },
+    { 0, 1889, 3136, 1 }, { 2744, 1890, 3137, 1 }, { 2760, 1891, 3138, 1 }, { 2759, 1892, 3139, 1 },
+    { 0, 1893, 3140, 1 }, { 0, 1894, 3141, 1 }, { 0, 1898, 3142, 1 }, { 0, 1901, 3143, 1 },
+    { 0, 1902, 3144, 1 }, { 0, 1903, 3145, 1 }, { 0, 1907, 3146, 1 }, { 0, 1908, 3147, 1 },
+    { 0, 1911, 3148, 1 }, { 0, 1913, 3149, 1 }, { 0, 1915, 3150, 1 }, { 0, 1917, 3151, 1 },
+    { 0, 1918, 3152, 1 }, { 0, 1928, 3153, 1 }, { 0, 1919, 3154, 1 }, { 0, 1920, 3155, 1 },
+    { 0, 1922, 3156, 1 }, { 0, 1923, 3157, 1 }, { 0, 1924, 3158, 1 }, { 0, 1932, 3159, 1 },
+    { 0, 1930, 3160, 1 }, { 0, 1927, 3161, 1 }, { 0, 1931, 3162, 1 }, { 0, 1933, 3163, 1 },
+    { 0, 1936, 3164, 1 }, { 0, 1937, 3165, 1 }, { 0, 1938, 3166, 1 }, { 0, 1937, 3167, 1 },
+    { 0, 1940, 3168, 1 }, { 0, 1944, 3169, 1 }, { 0, 1949, 3170, 1 }, { 0, 1950, 3171, 1 },
+    { 0, 1951, 3172, 1 }, { 0, 1952, 3173, 1 }, { 0, 1969, 3174, 1 }, { 0, 1970, 3175, 1 },
+    { 0, 1955, 3176, 1 }, { 0, 1958, 3177, 1 }, { 0, 1957, 3178, 1 }, { 0, 1959, 3179, 1 },
+    { 0, 1960, 3180, 1 }, { 0, 1962, 3181, 1 }, { 0, 1966, 3182, 1 }, { 0, 1967, 3183, 1 },
+    { 0, 1968, 3184, 1 }, { 0, 1972, 3185, 1 }, { 0, 1973, 3186, 1 }, { 0, 1983, 3187, 1 },
+    { 0, 1975, 3188, 1 }, { 0, 1982, 3189, 1 }, { 0, 1977, 3190, 1 }, { 0, 1978, 3191, 1 },
+    { 0, 1980, 3192, 1 }, { 0, 1981, 3193, 1 }, { 0, 1985, 3194, 1 }, { 0, 1986, 3195, 1 },
+    { 0, 1987, 3196, 1 }, { 0, 1992, 3197, 1 }, { 0, 1993, 3198, 1 }, { 0, 2000, 3199, 1 },
+    { 0, 2001, 3200, 1 }, { 0, 2002, 3201, 1 }, { 0, 2011, 3202, 1 }, { 0, 2003, 3203, 1 },
+    { 0, 2013, 3204, 1 }, { 0, 2015, 3205, 1 }, { 0, 2018, 3206, 1 }, { 0, 2022, 3207, 1 },
+    { 0, 2025, 3208, 1 }, { 0, 2023, 3209, 1 }, { 0, 2027, 3210, 1 }, { 0, 2026, 3211, 1 },
+    { 0, 2029, 3212, 1 }, { 0, 2030, 3213, 1 }, { 0, 2032, 3214, 1 }, { 0, 2041, 3215, 1 },
+    { 0, 2042, 3216, 1 }, { 0, 2044, 3217, 1 }, { 0, 2045, 3218, 1 }, { 0, 2049, 3219, 1 },
+    { 0, 2013, 3220, 1 }, { 0, 2050, 3221, 1 }, { 0, 2052, 3222, 1 }, { 0, 2053, 3223, 1 },
+    { 0, 2054, 3224, 1 }, { 0, 2056, 3225, 1 }, { 0, 2057, 3226, 1 }, { 0, 2067, 3227, 1 },
+    { 0, 2060, 3228, 1 }, { 0, 2061, 3229, 1 }, { 0, 2063, 3230, 1 }, { 0, 2064, 3231, 1 },
+    { 0, 2069, 3232, 1 }, { 0, 2074, 3233, 1 }, { 0, 2076, 3234, 1 }, { 0, 2077, 3235, 1 },
+    { 0, 2080, 3236, 1 }, { 0, 2081, 3237, 1 }, { 0, 2082, 3238, 1 }, { 0, 2084, 3239, 1 },
+    { 0, 2085, 3240, 1 }, { 0, 2086, 3241, 1 }, { 0, 2089, 3242, 1 }, { 0, 2090, 3243, 1 },
+    { 0, 2094, 3244, 1 }, { 0, 2096, 3245, 1 }, { 0, 2097, 3246, 1 }, { 0, 2099, 3247, 1 },
+    { 0, 2100, 3248, 1 }, { 0, 2101, 3249, 1 }, { 0, 2103, 3250, 1 }, { 0, 2107, 3251, 1 },
+    { 0, 2108, 3252, 1 }, { 0, 2109, 3253, 1 }, { 0, 2112, 3254, 1 }, { 0, 2115, 3255, 1 },
+    { 0, 2116, 3256, 1 }, { 0, 2120, 3257, 1 }, { 0, 2125, 3258, 1 }, { 0, 2128, 3259, 1 },
+    { 0, 2129, 3260, 1 }, { 0, 2132, 3261, 1 }, { 0, 2135, 3262, 1 }, { 0, 2136, 3263, 1 },
+    { 0, 2138, 3264, 1 }, { 0, 2142, 3265, 1 }, { 0, 2145, 3266, 1 }, { 0, 2148, 3267, 1 },
+    { 0, 2150, 3268, 1 }, { 0, 2151, 3269, 1 }, { 0, 2154, 3270, 1 }, { 0, 2156, 3271, 1 },
+    { 0, 2157, 3272, 1 }, { 0, 2158, 3273, 1 }, { 0, 2160, 3274, 1 }, { 0, 2161, 3275, 1 },
+    { 0, 2164, 3276, 1 }, { 0, 2165, 3277, 1 }, { 0, 2166, 3278, 1 }, { 0, 2169, 3279, 1 },
+    { 0, 2172, 3280, 1 }, { 0, 2174, 3281, 1 }, { 0, 2180, 3282, 1 }, { 0, 2181, 3283, 1 },
+    { 0, 2183, 3284, 1 }, { 0, 2186, 3285, 1 }, { 0, 2187, 3286, 1 }, { 0, 2189, 3287, 1 },
+    { 0, 2191, 3288, 1 }, { 0, 2193, 3289, 1 }, { 0, 2194, 3290, 1 }, { 0, 2195, 3291, 1 },
+    { 0, 2197, 3292, 1 }, { 0, 2199, 3293, 1 }, { 0, 2200, 3294, 1 }, { 0, 2202, 3295, 1 },
+    { 0, 2204, 3296, 1 }, { 0, 2206, 3297, 1 }, { 0, 2209, 3298, 1 }, { 0, 2211, 3299, 1 },
+    { 0, 2213, 3300, 1 }, { 0, 2215, 3301, 1 }, { 0, 2218, 3302, 1 }, { 0, 2220, 3303, 1 },
+    { 0, 2221, 3304, 1 }, { 0, 2222, 3305, 1 }, { 0, 2197, 3306, 1 }, { 0, 2224, 3307, 1 },
+    { 0, 2225, 3308, 1 }, { 0, 2226, 3309, 1 }, { 0, 2227, 3310, 1 }, { 0, 2234, 3311, 1 },
+    { 0, 2235, 3312, 1 }, { 0, 2238, 3313, 1 }, { 0, 2241, 3314, 1 }, { 0, 2248, 3315, 1 },
+    { 0, 2251, 3316, 1 }, { 0, 2252, 3317, 1 }, { 0, 2253, 3318, 1 }, { 0, 2254, 3319, 1 },
+    { 0, 2259, 3320, 1 }, { 0, 2260, 3321, 1 }, { 0, 2261, 3322, 1 }, { 0, 2280, 3323, 1 },
+    { 0, 2264, 3324, 1 }, { 0, 2267, 3325, 1 }, { 0, 2268, 3326, 1 }, { 0, 2271, 3327, 1 },
+    { 0, 2272, 3328, 1 }, { 0, 2273, 3329, 1 }, { 0, 2274, 3330, 1 }, { 0, 2277, 3331, 1 },
+    { 0, 2284, 3332, 1 }, { 0, 2293, 3333, 1 }, { 0, 2278, 3334, 1 }, { 0, 2282, 3335, 1 },
+    { 0, 2283, 3336, 1 }, { 0, 2288, 3337, 1 }, { 0, 2291, 3338, 1 }, { 0, 2307, 3339, 1 },
+    { 0, 2292, 3340, 1 }, { 0, 2294, 3341, 1 }, { 0, 2295, 3342, 1 }, { 0, 2296, 3343, 1 },
+    { 0, 2297, 3344, 1 }, { 0, 2302, 3345, 1 }, { 0, 2303, 3346, 1 }, { 0, 2305, 3347, 1 },
+    { 0, 2312, 3348, 1 }, { 0, 2314, 3349, 1 }, { 0, 2316, 3350, 1 }, { 0, 2318, 3351, 1 },
+    { 0, 2319, 3352, 1 }, { 0, 2321, 3353, 1 }, { 0, 2325, 3354, 1 }, { 0, 2326, 3355, 1 },
+    { 0, 2327, 3356, 1 }, { 0, 2328, 3357, 1 }, { 0, 2329, 3358, 1 }, { 0, 2330, 3359, 1 },
+    { 0, 2331, 3360, 1 }, { 0, 2335, 3361, 1 }, { 0, 2336, 3362, 1 }, { 0, 2339, 3363, 1 },
+    { 0, 2340, 3364, 1 }, { 0, 2341, 3365, 1 }, { 0, 2344, 3366, 1 }, { 0, 2347, 3367, 1 },
+    { 0, 2349, 3368, 1 }, { 0, 2350, 3369, 1 }, { 0, 2352, 3370, 1 }, { 0, 2354, 3371, 1 },
+    { 0, 2355, 3372, 1 }, { 0, 2357, 3373, 1 }, { 0, 2358, 3374, 1 }, { 0, 2359, 3375, 1 },
+    { 0, 2336, 3376, 1 }, { 0, 2360, 3377, 1 }, { 0, 2362, 3378, 1 }, { 0, 2363, 3379, 1 },
+    { 0, 2365, 3380, 1 }, { 0, 2368, 3381, 1 }, { 0, 2370, 3382, 1 }, { 0, 2372, 3383, 1 },
+    { 0, 2373, 3384, 1 }, { 0, 2374, 3385, 1 }, { 0, 2375, 3386, 1 }, { 0, 2379, 3387, 1 },
+    { 0, 2380, 3388, 1 }, { 0, 2381, 3389, 1 }, { 0, 2365, 3390, 1 }, { 0, 2382, 3391, 1 },
+    { 0, 2384, 3392, 1 }, { 0, 2389, 3393, 1 }, { 0, 2391, 3394, 1 }, { 0, 2392, 3395, 1 },
+    { 0, 2394, 3396, 1 }, { 0, 2402, 3397, 1 }, { 0, 2403, 3398, 1 }, { 0, 2410, 3399, 1 },
+    { 0, 2412, 3400, 1 }, { 0, 2414, 3401, 1 }, { 0, 2417, 3402, 1 }, { 0, 2421, 3403, 1 },
+    { 0, 2425, 3404, 1 }, { 0, 2434, 3405, 1 }, { 0, 2436, 3406, 1 }, { 0, 2435, 3407, 1 },
+    { 0, 2437, 3408, 1 }, { 0, 2438, 3409, 1 }, { 0, 2440, 3410, 1 }, { 0, 2445, 3411, 1 },
+    { 0, 2446, 3412, 1 }, { 0, 2447, 3413, 1 }, { 0, 2448, 3414, 1 }, { 0, 2450, 3415, 1 },
+    { 0, 2451, 3416, 1 }, { 0, 2453, 3417, 1 }, { 0, 2454, 3418, 1 }, { 0, 2455, 3419, 1 },
+    { 0, 2456, 3420, 1 }, { 0, 2473, 3421, 1 }, { 0, 2458, 3422, 1 }, { 0, 2459, 3423, 1 },
+    { 0, 2461, 3424, 1 }, { 0, 2462, 3425, 1 }, { 0, 2465, 3426, 1 }, { 0, 2469, 3427, 1 },
+    { 0, 2470, 3428, 1 }, { 0, 2471, 3429, 1 }, { 0, 2474, 3430, 1 }, { 0, 2478, 3431, 1 },
+    { 0, 2480, 3432, 1 }, { 0, 2482, 3433, 1 }, { 0, 2484, 3434, 1 }, { 0, 2485, 3435, 1 },
+    { 0, 2486, 3436, 1 }, { 0, 2487, 3437, 1 }, { 0, 2488, 3438, 1 }, { 0, 2491, 3439, 1 },
+    { 0, 2492, 3440, 1 }, { 0, 2493, 3441, 1 }, { 0, 2494, 3442, 1 }, { 0, 2496, 3443, 1 },
+    { 0, 2499, 3444, 1 }, { 0, 2500, 3445, 1 }, { 0, 2501, 3446, 1 }, { 0, 2505, 3447, 1 },
+    { 0, 2506, 3448, 1 }, { 0, 2507, 3449, 1 }, { 0, 2509, 3450, 1 }, { 0, 2512, 3451, 1 },
+    { 0, 2514, 3452, 1 }, { 0, 2515, 3453, 1 }, { 0, 2516, 3454, 1 }, { 0, 2517, 3455, 1 },
+    { 0, 2519, 3456, 1 }, { 0, 2521, 3457, 1 }, { 0, 2524, 3458, 1 }, { 0, 2525, 3459, 1 },
+    { 0, 2527, 3460, 1 }, { 0, 2530, 3461, 1 }, { 0, 2533, 3462, 1 }, { 0, 2534, 3463, 1 },
+    { 0, 2535, 3464, 1 },
+};
+
+static const guint32 english_emoji_trie_results[] = {
+    11754, 2756, 5537, 11754, 11627, 2711, 2756, 4007,
+    5377, 5537, 4634, 196, 7810, 4746, 10543, 9579,
+    1601, 2115, 2017, 4060, 6695, 2500, 8963, 4654,
+    7368, 663, 8285, 9046, 8180, 397, 1757, 2050,
+    376, 4778, 11692, 7449, 10888, 1848, 2862, 11378,
+    12015, 3912, 4255, 9139, 1320, 6302, 6941, 1919,
+    9053, 3047, 2310, 8882, 5328, 4545, 10248, 8229,
+    4674, 7511, 10505, 11111, 9597, 9827, 467, 301,
+    900, 2902, 10846, 6439, 4463, 11025, 2394, 6599,
+    10681, 4412, 4727, 3601, 3340, 3401, 9525, 11627,
+    2711, 2872, 9680, 7523, 6092, 8467, 8601, 8371,
+    8882, 5328, 4545, 11715, 7282, 2711, 2872, 7523,
+    2739, 11703, 8042, 10008, 11585, 4137, 4297, 900,
+    11784, 8382, 8601, 1766, 2590, 7216, 8794, 4522,
+    5690, 6483, 11229, 4007, 5377, 1110, 9717, 7636,
+    9502, 301, 1684, 4442, 9373, 11909, 2902, 9680,
+    6092, 2439, 6274, 407, 8371, 7282, 6182, 1786,
+    9353, 10008, 8467, 2651, 5576, 11017, 10564, 10689,
+    8730, 2739, 81, 4974, 2943, 4634, 10919, 4931,
+    5164, 11152, 5444, 11229, 11558, 10642, 49, 11430,
+    4686, 5726, 11703, 11784, 196, 11647, 599, 9502,
+    10931, 4092, 2508, 2997, 11692, 7871, 7293, 8042,
+    8589, 3528, 10839, 7810, 5895, 6192, 4778, 5195,
+    3067, 11843, 565, 8382, 10610, 4866, 3582, 7449,
+    6214, 9559, 10931, 5113, 4746, 10543, 7891, 5630,
+    521, 1016, 2290, 6749, 10919, 8813, 6524, 1776,
+    609, 6664, 9579, 5598, 10133, 2911, 7840, 10724,
+    4931, 4137, 4297, 3892, 7999, 1440, 1448, 1601,
+    4522, 3634, 4898, 8794, 2115, 4160, 10359, 8860,
+    10775, 8612, 7714, 5113, 2017, 247, 3562, 11585,
+    5630, 8813, 11962, 8104, 9191, 2672, 10122, 5670,
+    1672, 3007, 1582, 9483, 1374, 5690, 4060, 3922,
+    3861, 6483, 1448, 6695, 1101, 1458, 2500, 10816,
+    4487, 3067, 565, 9119, 11952, 1515, 11843, 4834,
+    4812, 8963, 2518, 8349, 323, 9727, 4342, 4686,
+    8996, 1645, 3592, 281, 1601, 5726, 9131, 6769,
+    2921, 6994, 11430, 9651, 3634, 58, 9311, 5307,
+    7368, 3571, 11637, 10133, 5245, 11420, 5487, 4898,
+    10452, 2622, 6726, 4654, 1396, 102, 397, 8180,
+    2558, 663, 2179, 6324, 8306, 4160, 2115, 9579,
+    11306, 6398, 5598, 8285, 3708, 6544, 2279, 3806,
+    10061, 1504, 2548, 2672, 376, 4998, 8580, 792,
+    9661, 427, 3552, 3518, 11877, 4645, 9463, 10888,
+    3382, 9868, 10122, 12015, 3912, 2702, 2226, 11933,
+    1848, 2071, 3474, 5670, 11833, 7618, 5650, 9483,
+    1374, 2862, 9168, 2527, 1757, 2965, 5078, 7860,
+    5338, 7440, 7261, 8996, 2789, 7744, 1342, 9158,
+    132, 10652, 2050, 8973, 6902, 812, 8094, 4274,
+    1320, 4373, 8690, 8306, 4255, 748, 8622, 6473,
+    4587, 7093, 543, 2460, 8892, 11079, 10359, 8860,
+    1706, 5885, 9139, 9321, 6759, 4264, 9493, 6941,
+    9788, 323, 5214, 11508, 4433, 229, 1919, 9669,
+    2881, 8146, 9727, 7127, 4342, 3058, 11410, 1396,
+    6025, 3109, 2921, 4887, 237, 144, 3047, 2310,
+    1857, 102, 11276, 9053, 397, 10080, 10795, 6419,
+    8229, 4674, 10674, 4654, 10090, 6704, 8653, 10940,
+    7387, 7534, 3291, 6769, 6994, 879, 8209, 5875,
+    8542, 2159, 2470, 7502, 8572, 10961, 9966, 3623,
+    10775, 2558, 9807, 5619, 8077, 7714, 2491, 11814,
+    7820, 1887, 1963, 1695, 2279, 7511, 10505, 11111,
+    3806, 973, 9779, 5608, 3411, 2569, 11206, 11296,
+    8008, 7734, 427, 3552, 3518, 11877, 6962, 9923,
+    5144, 8433, 2353, 11398, 8612, 4617, 3871, 8633,
+    3430, 3097, 994, 8125, 176, 8848, 728, 1385,
+    8456, 1817, 3161, 11942, 5254, 9278, 6825, 5155,
+    9946, 467, 6386, 5358, 1645, 11452, 802, 5865,
+    2642, 3421, 11144, 1248, 5567, 3392, 5368, 6609,
+    4018, 376, 4998, 1717, 1239, 9201, 11793, 4148,
+    7195, 281, 10816, 5195, 9597, 3592, 1163, 6264,
+    11972, 4487, 5702, 2500, 7419, 8680, 4707, 8424,
+    4463, 5275, 5134, 6049, 9827, 5184, 911, 9149,
+    449, 8700, 2322, 4645, 2226, 1866, 165, 3222,
+    6081, 3452, 3331, 7574, 6749, 11025, 11933, 2394,
+    7944, 3507, 11195, 4778, 8710, 10442, 7316, 11485,
+    7378, 5905, 6439, 7261, 10879, 3786, 8114, 5768,
+    1706, 6599, 9109, 921, 3340, 4412, 6814, 2385,
+    9395, 10190, 9463, 9525, 4727, 10610, 3582, 11508,
+    5825, 5214, 4866, 10421, 7691, 5885, 11682, 8937,
+    4878, 6579, 7216, 4264, 3601, 8551, 7934, 6686,
+    9493, 9788, 2518, 2590, 11008, 3401, 8349, 9858,
+    11899, 7127, 1766, 9213, 10143, 5348, 7398, 6138,
+    9890, 8963, 2537, 10338, 4007, 8903, 10713, 5317,
+    2965, 3212, 7668, 7543, 5558, 10588, 9331, 4789,
+    70, 3892, 5078, 2190, 4433, 5377, 9077, 12006,
+    1110, 2682, 11909, 2169, 1996, 229, 6025, 4442,
+    9373, 4364, 10828, 7999, 4403, 1440, 748, 1757,
+    3279, 11316, 9353, 4071, 2439, 4126, 9619, 6274,
+    5985, 1353, 6473, 8622, 4384, 407, 6161, 6070,
+    4769, 3109, 3698, 1037, 1560, 81, 6182, 258,
+    9978, 2600, 8146, 4974, 2943, 10664, 2881, 4887,
+    1786, 477, 5681, 1259, 11350, 8741, 11725, 4192,
+    11619, 6641, 6933, 10390, 4718, 1218, 2893, 10452,
+    2622, 9099, 2333, 6716, 144, 38, 6726, 5736,
+    2651, 4202, 6370, 5576, 708, 11017, 6255, 1470,
+    5519, 2417, 218, 10090, 2159, 5164, 5155, 9946,
+    5245, 5089, 3882, 7074, 673, 10052, 7871, 5444,
+    5224, 11597, 3120, 3496, 1364, 11184, 11420, 9065,
+    11152, 4963, 7173, 9768, 8424, 11692, 5487, 1797,
+    11048, 5497, 7923, 11388, 4424, 10564, 8752, 5434,
+    7293, 10689, 49, 366, 3362, 8730, 11173, 6059,
+    1727, 4332, 9797, 7989, 11558, 9879, 6244, 11647,
+    599, 4665, 900, 8973, 1656, 5286, 3851, 2580,
+    155, 2050, 6847, 11410, 6, 7597, 3903, 10642,
+    2460, 6902, 3058, 9039, 719, 7493, 4114, 6359,
+    1282, 11079, 124, 6286, 4092, 7790, 9006, 3645,
+    5056, 4511, 8892, 9589, 5845, 738, 10621, 5509,
+    8663, 11371, 6871, 2508, 1684, 1418, 6233, 2902,
+    3528, 7768, 5020, 8158, 7851, 2997, 3744, 10839,
+    8915, 8882, 4545, 3442, 6104, 6620, 5328, 4463,
+    10724, 7810, 932, 8478, 10701, 3755, 11854, 4919,
+    11287, 1866, 5895, 6192, 8402, 7881, 2481, 2911,
+    1070, 11195, 8589, 4567, 4953, 8825, 7840, 5454,
+    1672, 3007, 3464, 4746, 3322, 9902, 8125, 2290,
+    9717, 1582, 11463, 3200, 9629, 521, 3939, 10543,
+    4224, 176, 8848, 10879, 7636, 1016, 7250, 7891,
+    8925, 11497, 1776, 4738, 9514, 4587, 6524, 5640,
+    9934, 247, 543, 609, 5917, 8209, 3172, 2364,
+    11888, 3676, 3817, 6313, 7093, 4757, 4727, 7228,
+    9243, 11164, 3732, 91, 11962, 8192, 3562, 1430,
+    8104, 9750, 3922, 1526, 8721, 2017, 3340, 5875,
+    8542, 8339, 3861, 6695, 1538, 7780, 3613, 10421,
+    1931, 9191, 10985, 1986, 1458, 1228, 8871, 824,
+    5780, 620, 3087, 1515, 11252, 9525, 10431, 10167,
+    9119, 4475, 1101, 7691, 4060, 5235, 6461, 6324,
+    2179, 10155, 58, 9311, 9739, 11548, 11952, 10112,
+    3131, 6814, 1385, 8456, 5175, 4412, 663, 511,
+    7117, 5307, 7913, 3571, 3797, 9837, 11338, 11637,
+    11526, 6790, 5928, 4286, 7801, 728, 3097, 10101,
+    4608, 11865, 7368, 6590, 11102, 8276, 8580, 3708,
+    6544, 2810, 7725, 112, 6534, 3986, 994, 6892,
+    9661, 11133, 1092, 2693, 449, 8285, 4556, 7305,
+    1839, 9957, 3141, 868, 792, 1504, 3430, 2548,
+    2322, 8700, 7449, 3601, 2071, 7139, 10061, 9180,
+    8551, 3474, 1848, 3152, 10600, 6214, 2451, 5032,
+    10888, 846, 1133, 8521, 9559, 3372, 8633, 5825,
+    4626, 5802, 1943, 9429, 3382, 3401, 4617, 3871,
+    2147, 5758, 11715, 6505, 2872, 5123, 6738, 2662,
+    6347, 2862, 9168, 2527, 4986, 1738, 9868, 1808,
+    10632, 2789, 7523, 9680, 417, 10304, 10071, 7830,
+    10555, 7744, 10652, 2988, 206, 10294, 1408, 1342,
+    4878, 8490, 9158, 9255, 356, 9321, 963, 6759,
+    2976, 6092, 8467, 6579, 7084, 8601, 11327, 4697,
+    8371, 4103, 26, 8412, 132, 12015, 2739, 11703,
+    4596, 6149, 4320, 8042, 1196, 532, 5650, 2260,
+    3017, 3974, 589, 3912, 4235, 10008, 2702, 2767,
+    11833, 3039, 9996, 1592, 7459, 6224, 5813, 8020,
+    5746, 7618, 7860, 6664, 7429, 5465, 8445, 8382,
+    2094, 6882, 7216, 812, 2376, 5338, 8094, 7440,
+    7703, 3029, 2590, 11899, 7967, 911, 9149, 8690,
+    10973, 5101, 8296, 4846, 4274, 5184, 9213, 7482,
+    7680, 6450, 760, 7978, 2344, 8954, 4522, 6483,
+    2800, 1953, 11229, 1320, 3047, 1122, 5044, 4373,
+    7553, 954, 10867, 10143, 3077, 2569, 6419, 11036,
+    9364, 1748, 6138, 9890, 2310, 1027, 10856, 11206,
+    1635, 3411, 8392, 6912, 6972, 2301, 2214, 2029,
+    10910, 5068, 4533, 1857, 10080, 6953, 4137, 5952,
+    8903, 1175, 7658, 3269, 10795, 6983, 9807, 5619,
+    3963, 459, 439, 7609, 5317, 6704, 6674, 7903,
+    8653, 4297, 5368, 8077, 5855, 3828, 5348, 4941,
+    2722, 4018, 7184, 10940, 6515, 7004, 7398, 9639,
+    696, 6609, 5661, 1059, 7273, 6835, 11240, 3212,
+    10327, 836, 3623, 10734, 9385, 1887, 8644, 10961,
+    891, 10370, 11682, 7105, 8773, 10746, 9966, 11475,
+    2749, 4908, 1695, 1963, 2271, 10588, 9077, 12006,
+    1154, 10316, 8937, 8361, 5997, 5388, 9232, 2470,
+    10674, 2406, 3667, 500, 8572, 2682, 3485, 8229,
+    2126, 7534, 7387, 4364, 7502, 10828, 3421, 4674,
+    973, 9779, 9699, 11316, 3291, 2642, 11144, 11442,
+    7054, 7021, 11670, 6494, 2831, 4040, 2491, 4171,
+    10766, 11814, 3303, 6632, 5608, 4071, 7511, 6555,
+    1974, 4354, 944, 7668, 7564, 7820, 8785, 4801,
+    1353, 10018, 5790, 5297, 488, 6295, 5835, 4578,
+    8066, 7543, 5558, 10270, 3776, 4403, 10400, 7149,
+    8532, 10231, 7205, 2439, 10505, 11111, 11296, 1047,
+    5205, 4126, 9619, 1301, 5412, 6274, 8008, 1248,
+    3392, 7955, 11775, 11983, 10473, 3507, 5588, 2394,
+    6172, 10806, 10899, 6116, 8030, 10380, 6962, 3233,
+    7756, 4083, 313, 654, 5567, 11069, 9819, 7734,
+    9923, 5144, 4499, 11576, 11921, 5423, 3540, 4824,
+    11398, 7944, 9088, 407, 6161, 7359, 6431, 9847,
+    11824, 1817, 3766, 1550, 2136, 2008, 9029, 11735,
+    8502, 6070, 9353, 4769, 5985, 9607, 8433, 1493,
+    7338, 9278, 2353, 5546, 3161, 6825, 269, 577,
+    2249, 1717, 3257, 11942, 7032, 2083, 8054, 11452,
+    857, 9913, 4384, 9452, 3657, 802, 5865, 2932,
+    6335, 6127, 8240, 1239, 6567, 258, 9978, 10411,
+    7239, 9201, 2600, 6386, 5358, 8804, 1143, 2061,
+    9570, 5254, 6182, 9301, 2853, 1572, 11725, 4192,
+    3688, 11747, 4856, 7586, 1786, 467, 10241, 11619,
+    6037, 1612, 5134, 7044, 5940, 38, 11793, 2841,
+    4148, 6049, 772, 1332, 5275, 477, 708, 81,
+    7195, 7648, 188, 9441, 5265, 4974, 2943, 10664,
+    11658, 1006, 8220, 11972, 11059, 1163, 7419, 8680,
+    4707, 4308, 5736, 70, 16, 2633, 3698, 1560,
+    10484, 1037, 6264, 165, 6081, 3222, 4789, 9331,
+    2955, 2333, 293, 8837, 10442, 6716, 11994, 10030,
+    8710, 7316, 3452, 3331, 7409, 685, 6652, 7328,
+    6802, 6255, 1470, 3496, 1312, 4182, 10952, 7574,
+    10756, 9065, 10576, 9537, 4029, 11485, 7378, 5905,
+    9109, 7064, 10516, 6599, 921, 2820, 1271, 11764,
+    4214, 6409, 8561, 9342, 10212, 6370, 9395, 3786,
+    4202, 2612, 2238, 8114, 4963, 6641, 11804, 10190,
+    6933, 5768, 1207, 9290, 11909, 1481, 5681, 1259,
+    11350, 10179, 10390, 6923, 7173, 9768, 2893, 1364,
+    11184, 4247, 4718, 2385, 5444, 2169, 11217, 984,
+    5497, 1996, 10282, 10534, 1218, 7923, 11388, 4424,
+    1727, 5224, 11597, 10201, 8752, 1911, 11173, 6059,
+    7989, 10919, 4931, 4332, 49, 366, 10642, 6359,
+    4686, 5434, 5726, 9131, 10348, 3998, 3351, 3362,
+    6014, 10462, 9879, 5286, 2429, 11558, 155, 9651,
+    7597, 3903, 7790, 9039, 3851, 2580, 11430, 4665,
+    719, 3245, 6244, 8136, 8763, 1282, 124, 6286,
+    11647, 9006, 9589, 10621, 5509, 5845, 6780, 5020,
+    9017, 738, 599, 8264, 7161, 7851, 7493, 5964,
+    4114, 8663, 6871, 2041, 11371, 1418, 3744, 8158,
+    6233, 3528, 10839, 3755, 2481, 8915, 565, 11854,
+    11843, 4834, 10931, 3442, 4919, 6620, 932, 10701,
+    4812, 8402, 5895, 8478, 1829, 8328, 7881, 4567,
+    10610, 4866, 7934, 7768, 6192, 6686, 11008, 9858,
+    5113, 4953, 5454, 3322, 7891, 8825, 3582, 8925,
+    4738, 9514, 5640, 9934, 5630, 11497, 1776, 609,
+    5917, 11888, 3676, 9243, 11164, 3732, 91, 6104,
+    10724, 11287, 2911, 7840, 3892, 7999, 1440, 3279,
+    10133, 6398, 5598, 3634, 4898, 4160, 10359, 8860,
+    7714, 8612, 2672, 10122, 1374, 247, 3817, 7228,
+    8192, 3562, 1430, 11306, 9750, 11962, 8104, 1538,
+    7780, 9191, 10985, 620, 1070, 1672, 9902, 1582,
+    3200, 3464, 4224, 3922, 3861, 3007, 3613, 11537,
+    1931, 1526, 8871, 824, 9629, 11463, 1986, 8721,
+    1458, 3087, 5780, 10431, 1515, 11252, 9119, 5235,
+    6461, 11952, 511, 3797, 323, 9727, 4342, 10816,
+    4475, 2518, 1228, 4487, 8349, 8996, 2537, 1645,
+    281, 10112, 10338, 5702, 3592, 2921, 6994, 58,
+    9739, 5307, 9837, 7913, 11338, 3120, 11420, 9311,
+    5089, 1797, 1396, 102, 8306, 3571, 11637, 3882,
+    7349, 11526, 5487, 11048, 879, 3951, 6769, 6790,
+    10996, 7801, 11865, 5245, 10452, 6726, 11276, 2417,
+    218, 10167, 7074, 5519, 673, 6324, 11548, 2179,
+    3131, 5928, 2622, 9099, 9549, 10155, 4286, 6590,
+    783, 10052, 3708, 6544, 2810, 7725, 112, 11133,
+    1092, 7305, 4556, 1839, 9957, 6534, 2693, 3986,
+    9661, 3141, 868, 2558, 1504, 2548, 7139, 3152,
+    2451, 427, 3552, 3518, 11877, 376, 4998, 5032,
+    4645, 9463, 2226, 11933, 10713, 2965, 5078, 2190,
+    1656, 6847, 6, 6902, 7871, 11692, 7293, 5195,
+    8973, 7449, 10600, 6214, 9559, 3372, 4626, 2290,
+    3939, 7250, 6749, 846, 8521, 3382, 5758, 6505,
+    6738, 5123, 2662, 6347, 9868, 2071, 521, 9180,
+    3474, 1133, 5802, 1016, 9429, 9168, 1738, 417,
+    10304, 10071, 7830, 10555, 2988, 9255, 7261, 10652,
+    206, 10294, 1408, 7084, 4697, 4103, 2527, 4986,
+    26, 8412, 748, 6473, 8622, 4596, 1196, 4320,
+    2260, 6149, 3017, 4235, 2767, 3039, 9996, 5477,
+    1592, 7459, 7429, 5650, 6224, 532, 3974, 5813,
+    5746, 5465, 2094, 5338, 8020, 7703, 589, 7967,
+    812, 2376, 8094, 8445, 10973, 4274, 8296, 7482,
+    7680, 7440, 760, 6882, 4846, 7978, 2344, 8954,
+    2800, 6450, 11079, 5056, 8892, 4511, 2789, 7744,
+    1342, 3645, 11327, 8690, 5101, 1953, 7553, 543,
+    7093, 8490, 356, 9321, 6759, 2976, 4757, 11508,
+    1706, 5885, 9493, 229, 8146, 8741, 7127, 11410,
+    3058, 6025, 3109, 144, 1122, 5044, 954, 10867,
+    3077, 1748, 1027, 1635, 8252, 2301, 2214, 2029,
+    10910, 6953, 11036, 9364, 5952, 1175, 8392, 10042,
+    6859, 7658, 3269, 10090, 6983, 10856, 2202, 388,
+    6912, 6972, 459, 439, 7609, 6674, 6419, 9474,
+    642, 4941, 6515, 1059, 2722, 7273, 6835, 8644,
+    7004, 3172, 2364, 6313, 5875, 11240, 891, 3623,
+    554, 10370, 7105, 9385, 1899, 8773, 10746, 8209,
+    11475, 2749, 8542, 8339, 10734, 630, 5619, 7903,
+    9807, 3963, 8077, 9639, 1887, 1695, 4908, 1963,
+    2271, 696, 10316, 2406, 5855, 9267, 1154, 8882,
+    5328, 8361, 5997, 5388, 10674, 3667, 2126, 7054,
+    4545, 3828, 500, 7021, 7534, 3291, 11670, 4040,
+    6632, 2159, 9232, 2470, 8572, 7502, 4171, 2491,
+    10766, 11814, 3303, 7820, 8785, 4801, 6295, 3776,
+    2569, 11206, 3411, 5068, 944, 10018, 5297, 5835,
+    8066, 10400, 10231, 7149, 7205, 973, 9699, 6494,
+    4533, 5608, 6555, 1974, 7564, 9779, 10258, 6116,
+    488, 8532, 1047, 4578, 8030, 5790, 4354, 1301,
+    2779, 10380, 5205, 11576, 11921, 5412, 11775, 10496,
+    10806, 9923, 7756, 9088, 11398, 3540, 4824, 11983,
+    10473, 10899, 7359, 6431, 2008, 1186, 11123, 11609,
+    8318, 8502, 6962, 4499, 3233, 5144, 5423, 8633,
+    5400, 1943, 5975, 1808, 8125, 10632, 7117, 9029,
+    728, 2147, 3097, 10101, 11102, 8276, 994, 5009,
+    345, 3871, 6892, 176, 1385, 9847, 8456, 11824,
+    1550, 8848, 2136, 11735, 4608, 5175, 9607, 7338,
+    3766, 5546, 2249, 9278, 6825, 2083, 9452, 2932,
+    7470, 269, 577, 6335, 9946, 3688, 10411, 11747,
+    3485, 7032, 857, 9301, 5155, 8054, 11264, 6127,
+    8240, 802, 7239, 9913, 2853, 1572, 333, 3421,
+    11452, 5865, 3840, 2061, 9570, 11144, 1143, 2831,
+    1081, 5368, 11442, 4018, 6609, 10327, 836, 6386,
+    7184, 5358, 5661, 8804, 4856, 7586, 11362, 10241,
+    6037, 1612, 2841, 7955, 6172, 313, 654, 9819,
+    1493, 1717, 3257, 3657, 1239, 6567, 9201, 11069,
+    7044, 4148, 11091, 5940, 3392, 7648, 5265, 11658,
+    7195, 9441, 1006, 8220, 11972, 1624, 4308, 10484,
+    16, 1877, 2955, 11994, 11059, 7419, 8424, 5134,
+    8680, 2633, 6049, 5275, 188, 3029, 6204, 911,
+    9149, 9717, 4707, 7636, 772, 5530, 1684, 449,
+    2322, 8700, 165, 6081, 3222, 1332, 10030, 7409,
+    11195, 10879, 8837, 3452, 3331, 685, 1312, 7574,
+    4182, 10576, 5588, 2106, 3507, 4083, 7944, 10442,
+    7316, 7328, 6652, 10952, 6802, 9537, 11485, 8985,
+    7378, 11764, 4214, 9406, 6409, 10756, 2612, 5905,
+    9109, 7064, 921, 9395, 8710, 10516, 10212, 9342,
+    8561, 2238, 2820, 1271, 10190, 4029, 3786, 8114,
+    5768, 6814, 10421, 7691, 8551, 9525, 5825, 4878,
+    6579, 11715, 7523, 9680, 6092, 8467, 8601, 2739,
+    11703, 8042, 10008, 6664, 4137, 4297, 8382, 11682,
+    8937, 7216, 11899, 9213, 4522, 11229, 7398, 6138,
+    9890, 8903, 3212, 5558, 10588, 70, 4789, 293,
+    9077, 12006, 1207, 1481, 10282, 10270, 11217, 984,
+    10534, 9290, 10828, 4071, 1353, 4403, 4126, 9619,
+    6161, 6070, 4769, 9353, 5985, 4384, 258, 9978,
+    477, 1560, 11804, 2333, 6716, 38, 6370, 708,
+    81, 4974, 5681, 1259, 10179, 11350, 6923, 2893,
+    2943, 4247, 4718, 1218, 5736, 6255, 1470, 11597,
+    10664, 5714, 3496, 9065, 7173, 1364, 11184, 11388,
+    10201, 1911, 5434, 3351, 4332, 4424, 9768, 7989,
+    4931, 49, 3998, 3362, 9879, 366, 8752, 2429,
+    3245, 5286, 6014, 6244, 8136, 3851, 2580, 6359,
+    4686, 5726, 9651, 4665, 8763, 6780, 9017, 155,
+    7597, 3903, 9131, 719, 8264, 7161, 7493, 5964,
+    4114, 1282, 124, 5845, 738, 10621, 6286, 6871,
+    5020, 5509, 8158, 2041, 7851, 3744, 7768, 10839,
+    8915, 3755, 11854, 4919, 2481, 565, 4834, 4812,
+    8328, 10931, 3442, 6620, 932, 10701, 1829, 4567,
+    3582, 7934, 6686, 11008, 9858, 5113, 4953, 8825,
+    8478, 3322, 4738, 9934, 5630, 11497, 5917, 11888,
+    11164, 6104, 10724, 11287, 9514, 10133, 6398, 11306,
+    9243, 3634, 4898, 4160, 10359, 8860, 7714, 8612,
+    3817, 7228, 8192, 1430, 9750, 1538, 7780, 10985,
+    620, 1070, 3464, 9902, 11463, 1526, 8721, 3613,
+    8871, 824, 5780, 11537, 1931, 1986, 1515, 11252,
+    9191, 4475, 5235, 10112, 511, 3797, 4487, 5702,
+    10338, 8996, 281, 2921, 6994, 879, 3951, 9739,
+    11338, 5089, 6461, 3882, 10996, 3120, 7349, 1797,
+    11048, 1396, 102, 11276, 11526, 7801, 11865, 9099,
+    9549, 783, 2417, 218, 10167, 6324, 10155, 11548,
+    3131, 5928, 4286, 6590, 7725, 3986, 1092, 2693,
+    7305, 4556, 1839, 9957, 868, 1504, 2548, 7139,
+    3152, 2451, 5032, 3552, 3518, 11877, 4998, 4645,
+    9463, 2226, 11933, 10713, 2190, 1656, 6847, 6,
+    7871, 7293, 5195, 10600, 2290, 3939, 7250, 6749,
+    846, 8521, 5758, 6505, 6738, 5123, 2662, 6347,
+    9180, 1133, 5802, 9429, 4986, 1738, 10555, 2988,
+    9255, 7261, 10294, 1408, 4697, 4103, 6473, 8622,
+    4320, 6149, 5477, 532, 2260, 4235, 2767, 9996,
+    3974, 589, 5813, 8020, 5465, 8445, 2094, 6882,
+    7703, 7440, 7967, 2376, 10973, 8296, 4846, 7482,
+    7680, 760, 6450, 7978, 2344, 8954, 2800, 11079,
+    5056, 4511, 3645, 11327, 5101, 543, 4757, 8490,
+    356, 2976, 11508, 1706, 229, 8741, 11410, 3058,
+    6025, 3109, 144, 1122, 5044, 10867, 1027, 10856,
+    1635, 8252, 10042, 2202, 6972, 2301, 2029, 10910,
+    11036, 6859, 388, 9364, 9474, 6953, 5952, 1175,
+    3269, 10090, 6983, 439, 642, 6674, 2214, 2722,
+    1059, 7273, 7609, 8644, 3172, 554, 6313, 8339,
+    11240, 9385, 891, 4051, 10370, 7105, 10746, 11475,
+    2749, 4908, 5619, 2364, 3963, 7903, 8077, 9267,
+    3828, 1899, 9639, 696, 1695, 2271, 10316, 1154,
+    2406, 8882, 4545, 5328, 8361, 5997, 5388, 500,
+    5855, 2126, 7021, 7534, 3291, 11670, 4040, 6632,
+    2159, 9232, 8572, 4171, 10766, 3303, 8785, 4801,
+    2569, 11206, 5068, 4533, 944, 5297, 488, 8066,
+    4578, 8532, 10231, 7205, 973, 9699, 10258, 9779,
+    6494, 5608, 1974, 4354, 7564, 2779, 1301, 5412,
+    6116, 11576, 11921, 11775, 10496, 11983, 1186, 11123,
+    11609, 10806, 10899, 7756, 10473, 8318, 3233, 4499,
+    5400, 3540, 4824, 6555, 5423, 9088, 6431, 2008,
+    9029, 8502, 8633, 1943, 5975, 2147, 1808, 10632,
+    3190, 10101, 345, 4608, 11102, 8276, 5009, 8125,
+    176, 8848, 1385, 8456, 5175, 7117, 1550, 3766,
+    9607, 5546, 2249, 9278, 6825, 577, 269, 2083,
+    7032, 8054, 9452, 6335, 11264, 6127, 333, 8240,
+    9946, 5155, 857, 9913, 3840, 2932, 10411, 7470,
+    7239, 2061, 9570, 1081, 9301, 2853, 3688, 1572,
+    11747, 3485, 11144, 11442, 2831, 4018, 7184, 5661,
+    10327, 836, 7586, 11362, 6037, 1612, 7955, 11091,
+    6172, 313, 654, 9819, 1493, 1717, 3657, 6567,
+    9201, 7044, 5940, 1239, 4148, 7648, 7195, 5265,
+    11658, 9441, 1006, 8220, 11059, 3257, 1624, 4308,
+    10484, 1877, 6204, 2633, 2955, 11994, 8424, 5134,
+    6049, 772, 1332, 188, 3029, 911, 5530, 9717,
+    7636, 1684, 2322, 6081, 10030, 7409, 11195, 10879,
+    8837, 685, 1312, 9149, 4182, 2106, 10576, 5588,
+    3507, 4083, 10442, 7316, 7328, 6652, 10952, 6802,
+    9537, 8985, 9406, 4214, 6409, 2612, 7064, 10516,
+    1271, 10212, 9342, 2238, 10190, 4029, 6814, 7691,
+    9525, 5825, 4878, 6579, 11715, 7523, 8601, 8042,
+    10008, 6664, 11682, 8937, 9213, 11229, 9890, 3212,
+    5558, 10270, 10588, 70, 293, 9077, 12006, 9290,
+    984, 10282, 10534, 10828, 4403, 4126, 6161, 9619,
+    4769, 9978, 6716, 38, 6370, 708, 10664, 5714,
+    4454, 11350, 10179, 6923, 2893, 4247, 6255, 1470,
+    11597, 9065, 7173, 9768, 11184, 4424, 10201, 1911,
+    3351, 4332, 4931, 10787, 3998, 2429, 3245, 6359,
+    4686, 5726, 9131, 9651, 8264, 5964, 124, 6286,
+    5509, 6871, 2041, 8158, 3744, 7768, 8915, 10931,
+    3442, 10701, 1829, 6686, 7161, 11008, 5113, 4953,
+    8825, 3322, 4738, 9514, 11497, 5917, 11164, 6104,
+    6398, 4160, 8860, 7714, 7228, 8192, 1430, 1538,
+    7780, 10985, 3464, 9902, 3613, 824, 5780, 1931,
+    1986, 11252, 4475, 3797, 4487, 5702, 281, 3951,
+    9739, 9418, 11048, 11276, 11526, 9549, 218, 10167,
+    10155, 4286, 3986, 7305, 9957, 868, 7139, 2451,
+    5032, 3552, 11877, 4998, 2226, 11933, 10713, 6847,
+    7293, 10600, 8521, 5758, 6738, 6347, 9180, 5802,
+    4986, 10555, 2988, 9255, 10294, 4103, 6473, 4320,
+    5477, 2260, 9996, 589, 8020, 8445, 7703, 7967,
+    2376, 10973, 1408, 4846, 7482, 7680, 760, 5056,
+    4511, 5101, 8490, 11410, 3109, 144, 1122, 5044,
+    8252, 10042, 2202, 2214, 2029, 6859, 388, 6953,
+    5952, 1175, 3269, 439, 7609, 4051, 642, 1059,
+    7273, 6313, 9385, 1899, 891, 10370, 7105, 10746,
+    11475, 3963, 7903, 9267, 10316, 2406, 4545, 8361,
+    5997, 500, 7534, 3291, 11670, 4040, 6632, 2159,
+    9232, 3303, 8785, 5068, 4533, 944, 8066, 10231,
+    9699, 10258, 6494, 1974, 4354, 2779, 1301, 5412,
+    4801, 6116, 11921, 10496, 11123, 7756, 8318, 4499,
+    5400, 3540, 4824, 6431, 2008, 9029, 11609, 8502,
+    1943, 3190, 345, 4608, 8276, 7117, 1550, 577,
+    2083, 8054, 11264, 9946, 3840, 2853, 1572, 3688,
+    11747, 3485, 11442, 836, 7586, 11362, 6037, 7955,
+    11091, 313, 654, 9819, 1493, 3257, 3657, 6567,
+    7044, 5940, 7648, 9441, 1006, 8220, 1624, 6204,
+    2955, 8424, 6049, 772, 1332, 188, 3029, 9717,
+    7636, 1684, 2322, 10030, 10879, 8837, 685, 2106,
+    10576, 5588, 4083, 7328, 10952, 6802, 9537, 8985,
+    4214, 2612, 1271, 10212, 2238, 6814, 5825, 4878,
+    6579,
+};
+
+static const char chinese_emoji_strings[] =
+    "口罩\0" "😷\0"
+    "乞讨\0" "🥺\0"
+    "河马\0" "🦛\0"
+    "瑞士\0" "🫕\0"
+    "呼气\0" "🫁\0"
+    "网球\0" "🎾\0"
+    "圣诞树\0" "🎄\0"
+    "饮\0" "🫖\0"
+    "隐私\0" "🔏\0"
+    "弦线\0" "🪕\0"
+    "抗议\0" "🪧\0"
+    "和平\0" "🕊\0"
+    "锁匙\0" "🔐\0"
+    "忧心\0" "😔\0"
+    "子弹\0" "🚅\0"
+    "兔耳\0" "👯\0"
+    "吊钟\0" "🔔\0"
+    "海绵\0" "🧽\0"
+    "羽毛\0" "🪶\0"
+    "实验室\0" "🧪\0"
+    "货船\0" "🎢\0"
+    "天线棒\0" "📶\0"
+    "呼吸\0" "🫁\0"
+    "光碟\0" "💽\0"
+    "举起\0" "🤚\0"
+    "甲虫\0" "🪲\0"
+    "米\0" "🌾\0"
+    "卒手指\0" "🤌\0"
+    "祷告\0" "📿\0"
+    "万岁\0" "🙌\0"
+    "印度教\0" "🕉\0"
+    "商人\0" "👨‍🔧\0"
+    "返回\0" "🔙\0"
+    "好奇\0" "🦝\0"
+    "呼叫\0" "🤭\0"
+    "蛆\0" "🪰\0"
+    "雪\0" "⛷\0"
+    "天房\0" "🕋\0"
+    "黄昏\0" "🌆\0"
+    "闷\0" "🪴\0"
+    "海豚\0" "🐬\0"
+    "男侦探\0" "🕵‍♂\0"
+    "庆祝\0" "🪅\0"
+    "滑雪\0" "⛷\0"
+    "巨蟹座\0" "🦀\0"
+    "熊脸\0" "🐻\0"
+    "脚掌\0" "🦶\0"
+    "猿\0" "🦧\0"
+    "漫画\0" "💩\0"
+    "交叉骨\0" "☠\0"
+    "逆时针\0" "🔄\0"
+    "钓鱼\0" "🦦\0"
+    "蜂蜜獾\0" "🦡\0"
+    "饼\0" "🍘\0"
+    "中心\0" "🫀\0"
+    "绵羊\0" "🐏\0"
+    "秒表\0" "⏱\0"
+    "中国帽\0" "👲\0"
+    "可\0" "🉑\0"
+    "科学家\0" "🧑‍🔬\0"
+    "兔\0" "🐰\0"
+    "墨水\0" "🔏\0"
+    "破折号\0" "〰\0"
+    "芭蕾舞\0" "🩰\0"
+    "三角尺\0" "📐\0"
+    "指\0" "👈\0"
+    "西瓜\0" "🍉\0"
+    "植物\0" "🪴\0"
+    "海豹\0" "🦭\0"
+    "旧锁匙\0" "🗝\0"
+    "香烟\0" "🚬\0"
+    "生病\0" "🤒\0"
+    "火山\0" "🌋\0"
+    "电力\0" "⚡\0"
+    "接收\0" "📨\0"
+    "礼物\0" "🧧\0"
+    "公事包\0" "💼\0"
+    "雌性\0" "🐑\0"
+    "碗\0" "🍜\0"
+    "遮\0" "🏖\0"
+    "小教堂\0" "💒\0"
+    "纳扎尔\0" "🧿\0"
+    "渡船\0" "⛴\0"
+    "大烛台\0" "🕎\0"
+    "第二\0" "🥈\0"
+    "月经\0" "🩸\0"
+    "露营\0" "🏕\0"
+    "项链\0" "📿\0"
+    "跳伞\0" "🪂\0"
+    "非洲\0" "🦱\0"
+    "绳\0" "🪢\0"
+    "滑浪\0" "🏄\0"
+    "燃油泵\0" "⛽\0"
+    "比坚尼\0" "👙\0"
+    "工人\0" "🧑‍🏭\0"
+    "日期\0" "📅\0"
+    "餐具\0" "🥄\0"
+    "六\0" "🕕\0"
+    "墓地\0" "🪦\0"
+    "房屋\0" "🏚\0"
+    "批\0" "🥧\0"
+    "丑小鸭\0" "🦢\0"
+    "荒废\0" "🏚\0"
+    "捐血\0" "🩸\0"
+    "童话\0" "👼\0"
+    "注册\0" "®\0"
+    "武器\0" "🔪\0"
+    "缆车\0" "🚠\0"
+    "雨云\0" "🌧\0"
+    "美人鱼\0" "🧜\0"
+    "女\0" "👱‍♀\0"
+    "成长\0" "🪴\0"
+    "时髦\0" "💁\0"
+    "呕吐\0" "🤢\0"
+    "您好\0" "🫂\0"
+    "市场\0" "💹\0"
+    "按摩\0" "💆\0"
+    "牛脸\0" "🐮\0"
+    "幻想\0" "😇\0"
+    "女装靴\0" "👢\0"
+    "蛇\0" "🐍\0"
+    "便条\0" "📝\0"
+    "小妖精\0" "👺\0"
+    "直尺\0" "📏\0"
+    "一杯奶\0" "🥛\0"
+    "疾病\0" "🪰\0"
+    "玛黛茶\0" "🧉\0"
+    "新月\0" "🌑\0"
+    "小水滴\0" "💧\0"
+    "十点半\0" "🕥\0"
+    "按钮\0" "🔼\0"
+    "虫\0" "🪱\0"
+    "祈祷\0" "🤲\0"
+    "写字\0" "✍\0"
+    "大阶\0" "🔠\0"
+    "生物\0" "👹\0"
+    "帕克\0" "🧚\0"
+    "银\0" "🪙\0"
+    "基点\0" "⬆\0"
+    "南\0" "⬇\0"
+    "拜拜\0" "🫂\0"
+    "匆忙\0" "😰\0"
+    "菜\0" "🥬\0"
+    "婴儿\0" "👶\0"
+    "天父\0" "🎅\0"
+    "串\0" "🍡\0"
+    "摧毁\0" "⚡\0"
+    "燕尾服\0" "🤵‍♀\0"
+    "长牙\0" "🦣\0"
+    "三角旗\0" "🚩\0"
+    "泉\0" "♨\0"
+    "奖牌\0" "🎖\0"
+    "警员\0" "👮\0"
+    "降落伞\0" "🪂\0"
+    "注释\0" "🗒\0"
+    "上升\0" "💹\0"
+    "爬\0" "🪜\0"
+    "蜘蛛网\0" "🕸\0"
+    "寒冷的\0" "🏔\0"
+    "射箭\0" "🏹\0"
+    "摩艾\0" "🗿\0"
+    "穗\0" "🌾\0"
+    "玻璃\0" "🥃\0"
+    "领呔\0" "🪢\0"
+    "客厅\0" "💇\0"
+    "注射\0" "💉\0"
+    "九点\0" "🕘\0"
+    "碟\0" "🍽\0"
+    "跪\0" "🧎\0"
+    "壶\0" "🫖\0"
+    "呼\0" "😥\0"
+    "手鼓\0" "🪘\0"
+    "实验袍\0" "🥼\0"
+    "乳房\0" "🤱\0"
+    "东\0" "➡\0"
+    "棒型图\0" "📊\0"
+    "派对枪\0" "🎉\0"
+    "不可\0" "⛔\0"
+    "纸屑球\0" "🎊\0"
+    "螺旋\0" "🗒\0"
+    "独木舟\0" "🛶\0"
+    "号角\0" "🥳\0"
+    "油桶\0" "🛢\0"
+    "雪山\0" "🏔\0"
+    "烈酒㷴\0" "🥃\0"
+    "棍\0" "🥍\0"
+    "挥紧手\0" "👋\0"
+    "风\0" "🍃\0"
+    "番枧盒\0" "🧼\0"
+    "吓亲\0" "😲\0"
+    "两点半\0" "🕝\0"
+    "胡椒粉\0" "🫑\0"
+    "秘密\0" "㊙\0"
+    "老人\0" "🧓\0"
+    "身份\0" "🆔\0"
+    "六点\0" "🕕\0"
+    "煮熟\0" "🍚\0"
+    "拳头\0" "✊\0"
+    "工具\0" "🪚\0"
+    "圈\0" "➰\0"
+    "员工\0" "⚕\0"
+    "电话\0" "📱\0"
+    "柔软\0" "🔈\0"
+    "米饼\0" "🍘\0"
+    "独角兽\0" "🦄\0"
+    "护士\0" "🧑‍⚕\0"
+    "十二点\0" "🕛\0"
+    "妖\0" "👿\0"
+    "篮\0" "🧺\0"
+    "眼睛\0" "🤩\0"
+    "高飞\0" "🪁\0"
+    "蜜糖罐\0" "🍯\0"
+    "和服\0" "👘\0"
+    "跪嘅人\0" "🧎\0"
+    "惊慌\0" "😨\0"
+    "消闲\0" "♟\0"
+    "侦探\0" "🕵\0"
+    "赶上\0" "🪝\0"
+    "卷起\0" "🗞\0"
+    "新闻\0" "📰\0"
+    "多谢\0" "🫂\0"
+    "震惊\0" "🤯\0"
+    "装配\0" "👨‍🏭\0"
+    "招牌\0" "💈\0"
+    "跳\0" "🦘\0"
+    "莫伊\0" "🗿\0"
+    "幼苗\0" "🌱\0"
+    "卷\0" "🧵\0"
+    "宝石\0" "💎\0"
+    "入场\0" "🎟\0"
+    "船\0" "⚓\0"
+    "士巴拿\0" "🛠\0"
+    "圈套\0" "🪝\0"
+    "平底镬\0" "🍳\0"
+    "吸血鬼\0" "🧛\0"
+    "发烧\0" "🦟\0"
+    "商业\0" "🧑‍💼\0"
+    "怀孕\0" "🤰\0"
+    "棕榈树\0" "🌴\0"
+    "钢笔\0" "🖋\0"
+    "蟹\0" "🦀\0"
+    "碰撞\0" "💥\0"
+    "男精灵\0" "🧝‍♂\0"
+    "腐烂\0" "🪰\0"
+    "脚\0" "🦵\0"
+    "爆炸\0" "🧨\0"
+    "拳套\0" "🥊\0"
+    "好运\0" "🧧\0"
+    "肢\0" "🦵\0"
+    "天秤\0" "⚖\0"
+    "两个心\0" "💕\0"
+    "相机\0" "🤳\0"
+    "大象\0" "🐘\0"
+    "钳\0" "🗜\0"
+    "吓惊\0" "😯\0"
+    "缝纫\0" "🧵\0"
+    "电工\0" "🧑‍🔧\0"
+    "深肤色\0" "🏿\0"
+    "企鹅\0" "🐧\0"
+    "苹果\0" "🍎\0"
+    "三十\0" "🕧\0"
+    "螺旋形\0" "🐚\0"
+    "厨师\0" "🧑‍🍳\0"
+    "血液\0" "🩸\0"
+    "骆马\0" "🦙\0"
+    "櫈\0" "💺\0"
+    "柠檬\0" "🍋\0"
+    "传真\0" "📠\0"
+    "梨\0" "🍐\0"
+    "客船\0" "🛳\0"
+    "香肠\0" "🌭\0"
+    "警官\0" "👮\0"
+    "文化\0" "🧫\0"
+    "算盘\0" "🧮\0"
+    "档案柜\0" "🗄\0"
+    "日历\0" "📅\0"
+    "高根鞋\0" "👠\0"
+    "魅力\0" "🧿\0"
+    "双子座\0" "👬\0"
+    "公路\0" "🛣\0"
+    "菱形\0" "🔶\0"
+    "五\0" "🕔\0"
+    "电视机\0" "📺\0"
+    "牧人\0" "👨‍🌾\0"
+    "早餐\0" "🥣\0"
+    "踢\0" "🦵\0"
+    "满月面\0" "🌝\0"
+    "浮潜\0" "🤿\0"
+    "海盗旗\0" "🏴‍☠\0"
+    "原子\0" "⚛\0"
+    "啧水\0" "🐳\0"
+    "舞蹈员\0" "👯\0"
+    "月\0" "🌒\0"
+    "髪型屋\0" "💈\0"
+    "歌记号\0" "〽\0"
+    "鹿\0" "🦌\0"
+    "男农夫\0" "👨‍🌾\0"
+    "旧\0" "🗝\0"
+    "鸡泡鱼\0" "🐡\0"
+    "寒冷\0" "🌨\0"
+    "点\0" "🕛\0"
+    "烟花\0" "🎆\0"
+    "东南\0" "↘\0"
+    "货币\0" "💴\0"
+    "马脸\0" "🐴\0"
+    "狮子狗\0" "🐩\0"
+    "懒\0" "🦥\0"
+    "轮\0" "🎡\0"
+    "商标\0" "™\0"
+    "美元\0" "💵\0"
+    "台风\0" "🌀\0"
+    "闪闪\0" "❇\0"
+    "书包\0" "🎒\0"
+    "担心\0" "😟\0"
+    "索引\0" "🗂\0"
+    "眨眼\0" "😉\0"
+    "蚝桶\0" "🥡\0"
+    "寄生虫\0" "🪱\0"
+    "踩单车\0" "🚴\0"
+    "北极熊\0" "🐻‍❄\0"
+    "结束\0" "🔚\0"
+    "换片\0" "🚼\0"
+    "砂锅\0" "🥘\0"
+    "男人\0" "👨\0"
+    "禁止\0" "🙈\0"
+    "园丁\0" "🧑‍🌾\0"
+    "钱袋\0" "💰\0"
+    "闪光\0" "📸\0"
+    "水\0" "🤽\0"
+    "发动机\0" "🚂\0"
+    "果仁\0" "🥜\0"
+    "嗯\0" "😋\0"
+    "愤怒\0" "😡\0"
+    "步\0" "🪜\0"
+    "盈\0" "🌒\0"
+    "飞机师\0" "🧑‍✈\0"
+    "护符\0" "🧿\0"
+    "晚礼服\0" "🤵\0"
+    "战士\0" "🪖\0"
+    "剪\0" "✂\0"
+    "羽毛球\0" "🏸\0"
+    "信箱\0" "📫\0"
+    "龙门\0" "🥅\0"
+    "乒乓\0" "🏓\0"
+    "垫\0" "🗒\0"
+    "中等\0" "🔉\0"
+    "中指\0" "🖕\0"
+    "刨冰\0" "🍧\0"
+    "心脏\0" "🫀\0"
+    "上\0" "👆\0"
+    "八\0" "🕗\0"
+    "开会\0" "🤝\0"
+    "反手\0" "🤚\0"
+    "朱古力\0" "🫕\0"
+    "钩针\0" "🧶\0"
+    "指向\0" "👈\0"
+    "抵达\0" "🛬\0"
+    "狸\0" "🦝\0"
+    "亡灵\0" "🧛\0"
+    "帽\0" "🤠\0"
+    "咖啡\0" "☕\0"
+    "咖哩饭\0" "🍛\0"
+    "磁性\0" "🧲\0"
+    "戏\0" "🎞\0"
+    "眼镜\0" "🥸\0"
+    "嘴\0" "😃\0"
+    "颈\0" "🧣\0"
+    "收音机\0" "📻\0"
+    "空中\0" "🚡\0"
+    "光头\0" "🦲\0"
+    "卫生\0" "🪥\0"
+    "袜\0" "🧦\0"
+    "温度计\0" "🌡\0"
+    "红心\0" "♥\0"
+    "男巫师\0" "🧙‍♂\0"
+    "古典\0" "🏛\0"
+    "钻石\0" "💍\0"
+    "男技工\0" "👨‍🔧\0"
+    "蚊\0" "🦟\0"
+    "一件头\0" "🩲\0"
+    "丸子\0" "🍡\0"
+    "请\0" "🙏\0"
+    "卡车\0" "🚒\0"
+    "盒\0" "🍱\0"
+    "停\0" "🚏\0"
+    "草蜢\0" "🦗\0"
+    "绳球\0" "🪢\0"
+    "拖鞋\0" "🥿\0"
+    "星星\0" "🌃\0"
+    "牛油\0" "🧈\0"
+    "晴朗\0" "☀\0"
+    "拳击\0" "🥊\0"
+    "年青\0" "👶\0"
+    "飞碟\0" "👽\0"
+    "火焰\0" "🔥\0"
+    "升降机\0" "🛗\0"
+    "岗位\0" "🚩\0"
+    "生肖\0" "⛎\0"
+    "狮子\0" "🦁\0"
+    "粗加号\0" "➕\0"
+    "笔记簿\0" "📔\0"
+    "满分\0" "💯\0"
+    "减\0" "➖\0"
+    "太阳\0" "😎\0"
+    "针\0" "🪡\0"
+    "手卷\0" "🫔\0"
+    "分开\0" "🪓\0"
+    "发癫\0" "😠\0"
+    "无声\0" "😶\0"
+    "老伯伯\0" "👴\0"
+    "竖起\0" "👍\0"
+    "小天鹅\0" "🦢\0"
+    "行人\0" "🚸\0"
+    "领取\0" "🛄\0"
+    "赢\0" "😤\0"
+    "成人\0" "🧑\0"
+    "咪高峰\0" "🎙\0"
+    "收件盘\0" "📥\0"
+    "侧手翻\0" "🤸\0"
+    "亏\0" "🌖\0"
+    "蝙蝠\0" "🦇\0"
+    "番薯\0" "🍠\0"
+    "用笔锁\0" "🔏\0"
+    "滑板\0" "🛹\0"
+    "粟米\0" "🌽\0"
+    "水点\0" "☔\0"
+    "骨\0" "🍖\0"
+    "水坝\0" "🦫\0"
+    "拖\0" "👭\0"
+    "收据\0" "🧾\0"
+    "铁路车\0" "🚃\0"
+    "鱼\0" "🐟\0"
+    "羊扒\0" "🥩\0"
+    "烤饼\0" "🫓\0"
+    "放映机\0" "📽\0"
+    "卷发\0" "🦱\0"
+    "剑\0" "🤺\0"
+    "方格旗\0" "🏁\0"
+    "烘焙\0" "🥯\0"
+    "菠萝\0" "🍍\0"
+    "清真寺\0" "🕌\0"
+    "六点半\0" "🕡\0"
+    "丝带\0" "🎗\0"
+    "玩\0" "🎴\0"
+    "日式\0" "🏣\0"
+    "靶心\0" "🎯\0"
+    "月饼\0" "🥮\0"
+    "来\0" "📨\0"
+    "海关\0" "🛃\0"
+    "标语\0" "🪧\0"
+    "发誓\0" "🤬\0"
+    "马\0" "🏇\0"
+    "薄班戟\0" "🥞\0"
+    "桃\0" "🍑\0"
+    "阿米巴\0" "🦠\0"
+    "鸽\0" "🕊\0"
+    "祝\0" "㊗\0"
+    "喊\0" "😢\0"
+    "沉默\0" "😯\0"
+    "情侣\0" "🧑‍🤝‍🧑\0"
+    "预订\0" "🈯\0"
+    "毕业\0" "🧑‍🎓\0"
+    "女殭尸\0" "🧟‍♀\0"
+    "画画\0" "🖌\0"
+    "沙漏\0" "⏳\0"
+    "血型\0" "🅰\0"
+    "长条\0" "🏮\0"
+    "玉米\0" "🌽\0"
+    "细菌\0" "🦠\0"
+    "鞠躬\0" "🙏\0"
+    "录像机\0" "📹\0"
+    "闪嘅心\0" "💖\0"
+    "野餐\0" "🧺\0"
+    "塔\0" "🗼\0"
+    "脑\0" "🧠\0"
+    "燃油\0" "⛽\0"
+    "三点半\0" "🕞\0"
+    "耳机\0" "🎧\0"
+    "怜悯\0" "🥺\0"
+    "铁\0" "🧇\0"
+    "日圆\0" "💴\0"
+    "软\0" "🧇\0"
+    "饮水\0" "🚰\0"
+    "兴奋\0" "💖\0"
+    "书呆子\0" "🤓\0"
+    "犯罪\0" "🦹\0"
+    "白菜\0" "🥬\0"
+    "绿色书\0" "📗\0"
+    "谷物\0" "🌾\0"
+    "望远镜\0" "🔭\0"
+    "念珠\0" "📿\0"
+    "化妆品\0" "💅\0"
+    "水晶\0" "🔮\0"
+    "营业\0" "🈺\0"
+    "幸运\0" "🤞\0"
+    "重覆\0" "🔁\0"
+    "城堡\0" "🏯\0"
+    "五点半\0" "🕠\0"
+    "教授\0" "🧑‍🏫\0"
+    "炸药\0" "🧨\0"
+    "车\0" "🚃\0"
+    "天蝎座\0" "🦂\0"
+    "化妆\0" "💄\0"
+    "学生\0" "🧑‍🎓\0"
+    "登山者\0" "🧗\0"
+    "仓鼠脸\0" "🐹\0"
+    "三叉戟\0" "🔱\0"
+    "薯条\0" "🍟\0"
+    "绝种\0" "🦣\0"
+    "流动\0" "📱\0"
+    "账簿\0" "📒\0"
+    "卖点\0" "🪝\0"
+    "弓箭\0" "🏹\0"
+    "乒乓球\0" "🏓\0"
+    "美容\0" "💇\0"
+    "爆发\0" "🌋\0"
+    "叉\0" "🍽\0"
+    "饮管杯\0" "🥤\0"
+    "过路\0" "🚸\0"
+    "讲价\0" "🉐\0"
+    "闪电\0" "🌩\0"
+    "向左\0" "🤛\0"
+    "蝴蝶\0" "🦋\0"
+    "风铃\0" "🎐\0"
+    "面包\0" "🍞\0"
+    "猫脸\0" "🐱\0"
+    "牌\0" "📛\0"
+    "红色\0" "🍎\0"
+    "女装帽\0" "👒\0"
+    "乳液樽\0" "🧴\0"
+    "秋天\0" "🥮\0"
+    "姓名\0" "📛\0"
+    "裇衫\0" "👕\0"
+    "跑鞋\0" "👟\0"
+    "对唔住\0" "🙇\0"
+    "唔开心\0" "😒\0"
+    "嘲笑\0" "🤌\0"
+    "花栗鼠\0" "🐿\0"
+    "服务\0" "🐕‍🦺\0"
+    "巫婆\0" "🧙\0"
+    "松树\0" "🎍\0"
+    "大雾\0" "🌁\0"
+    "训觉\0" "😪\0"
+    "头\0" "🗣\0"
+    "电压\0" "⚡\0"
+    "蛋\0" "🥚\0"
+    "基因\0" "🧬\0"
+    "澳洲\0" "🪃\0"
+    "宝藏\0" "🪙\0"
+    "榄球\0" "🏉\0"
+    "门\0" "🚪\0"
+    "热饮\0" "☕\0"
+    "食物\0" "🫒\0"
+    "连结\0" "🔗\0"
+    "申请\0" "🈸\0"
+    "小巴\0" "🚐\0"
+    "斑点\0" "🦒\0"
+    "八点\0" "🕗\0"
+    "红苹果\0" "🍎\0"
+    "密码\0" "🔑\0"
+    "犹太教\0" "🕍\0"
+    "耕种\0" "🧺\0"
+    "企\0" "🧍\0"
+    "橄榄\0" "🫒\0"
+    "北\0" "⬆\0"
+    "一百分\0" "💯\0"
+    "军事\0" "🪖\0"
+    "正义\0" "👨‍⚖\0"
+    "投币口\0" "🎰\0"
+    "衫\0" "🎽\0"
+    "粥\0" "🥣\0"
+    "洗手间\0" "🚹\0"
+    "鸢尾花\0" "⚜\0"
+    "惊恐\0" "😨\0"
+    "老鼠\0" "🐭\0"
+    "粗剔号\0" "✔\0"
+    "酒\0" "🍷\0"
+    "蜜糖\0" "🍯\0"
+    "原子笔\0" "🖊\0"
+    "摔交手\0" "🤼\0"
+    "扣针\0" "🧷\0"
+    "艺术家\0" "👨‍🎨\0"
+    "金牛座\0" "🐂\0"
+    "饵\0" "🪤\0"
+    "双\0" "⏸\0"
+    "粟米饼\0" "🫓\0"
+    "障碍物\0" "🚧\0"
+    "高尔夫\0" "🏌\0"
+    "大卫\0" "✡\0"
+    "修甲\0" "💅\0"
+    "老年\0" "🧓\0"
+    "艇\0" "🚣\0"
+    "第一\0" "🥇\0"
+    "泊车\0" "🅿\0"
+    "女巫师\0" "🧙‍♀\0"
+    "射手\0" "🏹\0"
+    "控制\0" "🎛\0"
+    "揽\0" "🤗\0"
+    "墙\0" "🧱\0"
+    "座灯\0" "🛋\0"
+    "直边\0" "📏\0"
+    "温泉\0" "♨\0"
+    "蓝莓\0" "🫐\0"
+    "文件夹\0" "📁\0"
+    "孕妇\0" "🤰\0"
+    "邮局\0" "🏤\0"
+    "佛法\0" "☸\0"
+    "风筝\0" "🪁\0"
+    "剔号\0" "✅\0"
+    "勾\0" "🪝\0"
+    "猫\0" "😺\0"
+    "百撘卡\0" "🃏\0"
+    "割\0" "🈹\0"
+    "入场券\0" "🎟\0"
+    "足球\0" "⚽\0"
+    "垒球\0" "🥎\0"
+    "小鸡\0" "🐣\0"
+    "枫树\0" "🍁\0"
+    "徽章\0" "🔱\0"
+    "超人\0" "🦸\0"
+    "眼泪\0" "🥲\0"
+    "装饰\0" "📔\0"
+    "吸烟\0" "🚬\0"
+    "行李\0" "🧳\0"
+    "铅笔\0" "✏\0"
+    "冲凉\0" "🛀\0"
+    "袋\0" "👝\0"
+    "便利店\0" "🏪\0"
+    "蜥蜴\0" "🦎\0"
+    "举重者\0" "🏋\0"
+    "长大\0" "💗\0"
+    "调查员\0" "🕵\0"
+    "送货车\0" "🚚\0"
+    "虾\0" "🍤\0"
+    "女巫\0" "🪄\0"
+    "损伤\0" "🤕\0"
+    "富士山\0" "🗻\0"
+    "传呼机\0" "📟\0"
+    "赢咗\0" "😤\0"
+    "匕首\0" "🗡\0"
+    "垃圾桶\0" "🚮\0"
+    "插头\0" "🔌\0"
+    "乘\0" "✖\0"
+    "冰川\0" "🐻‍❄\0"
+    "笃笃\0" "🛺\0"
+    "有\0" "🈶\0"
+    "斑马\0" "🦓\0"
+    "比高包\0" "🥯\0"
+    "蜡烛\0" "🕯\0"
+    "锤同挑\0" "⚒\0"
+    "铜牌\0" "🥉\0"
+    "头发\0" "🦳\0"
+    "摩天轮\0" "🎡\0"
+    "拍板\0" "🎬\0"
+    "举重\0" "🏋\0"
+    "老虎机\0" "🎰\0"
+    "盒子\0" "📥\0"
+    "软雪糕\0" "🍦\0"
+    "音符\0" "🎵\0"
+    "吸水\0" "🧽\0"
+    "屋\0" "🪴\0"
+    "仙人掌\0" "🌵\0"
+    "外卖盒\0" "🥡\0"
+    "八角星\0" "✳\0"
+    "卡片\0" "🗂\0"
+    "山羊座\0" "🐐\0"
+    "趋势\0" "💹\0"
+    "四点\0" "🕓\0"
+    "白色心\0" "🤍\0"
+    "缝补\0" "🪡\0"
+    "垂直\0" "⏸\0"
+    "七点\0" "🕖\0"
+    "刺猬\0" "🦔\0"
+    "数学\0" "➕\0"
+    "曲奇\0" "🍪\0"
+    "游艇\0" "⛵\0"
+    "热香饼\0" "🥞\0"
+    "派对\0" "🪅\0"
+    "胶布\0" "🩹\0"
+    "八角形\0" "🛑\0"
+    "炸虾\0" "🍤\0"
+    "头巾\0" "👳\0"
+    "输入\0" "🔠\0"
+    "骄傲\0" "🦚\0"
+    "绷带\0" "🤕\0"
+    "哺育\0" "🧑‍🍼\0"
+    "狼\0" "🐺\0"
+    "缆\0" "🚠\0"
+    "厌倦\0" "🙀\0"
+    "沙发\0" "🛋\0"
+    "运动鞋\0" "👟\0"
+    "内\0" "💠\0"
+    "木材\0" "🪚\0"
+    "刺绣\0" "🪡\0"
+    "掌印\0" "🐾\0"
+    "鸡\0" "🐔\0"
+    "德古拉\0" "🧛\0"
+    "蝴蝶酥\0" "🥨\0"
+    "经理\0" "🧑‍💼\0"
+    "唵\0" "🕉\0"
+    "向上\0" "💹\0"
+    "光环\0" "😇\0"
+    "握手\0" "🤝\0"
+    "牛角\0" "😈\0"
+    "吸力\0" "🧲\0"
+    "公\0" "🐏\0"
+    "螺\0" "🐚\0"
+    "沙律\0" "🥗\0"
+    "扫把\0" "🧹\0"
+    "盾\0" "🛡\0"
+    "鳄鱼\0" "🐊\0"
+    "番茄\0" "🍅\0"
+    "烈酒\0" "🥃\0"
+    "柑橘\0" "🍋\0"
+    "射线\0" "☀\0"
+    "回带\0" "◀\0"
+    "博物馆\0" "🖼\0"
+    "陆龟\0" "🐢\0"
+    "棒\0" "🍢\0"
+    "发明家\0" "🧑‍💻\0"
+    "卫星\0" "🛰\0"
+    "剃头\0" "🦲\0"
+    "呜咽\0" "😭\0"
+    "康加鼓\0" "🪘\0"
+    "计数\0" "🧮\0"
+    "磁力\0" "🧭\0"
+    "想法\0" "💡\0"
+    "信用卡\0" "💳\0"
+    "黑色旗\0" "🏴\0"
+    "双胞胎\0" "👬\0"
+    "邮件\0" "📧\0"
+    "刨\0" "🍧\0"
+    "阳\0" "☯\0"
+    "顺时针\0" "🔃\0"
+    "阴沉\0" "🪐\0"
+    "正方形\0" "⏹\0"
+    "快进\0" "⏩\0"
+    "排球\0" "🏐\0"
+    "冻\0" "😅\0"
+    "地图\0" "🗺\0"
+    "干净\0" "🪥\0"
+    "指甲\0" "💅\0"
+    "橙色书\0" "📙\0"
+    "肉菜饭\0" "🥘\0"
+    "警示灯\0" "🚨\0"
+    "水果\0" "🥭\0"
+    "快艇\0" "🚤\0"
+    "碌地\0" "🤣\0"
+    "摔交\0" "🤼\0"
+    "实验\0" "🥼\0"
+    "感动\0" "🥲\0"
+    "缸\0" "🪣\0"
+    "墨西哥\0" "🫔\0"
+    "沙\0" "⌛\0"
+    "四\0" "🍀\0"
+    "一次\0" "🔂\0"
+    "女学生\0" "👩‍🎓\0"
+    "小阶\0" "🔡\0"
+    "手套\0" "🥎\0"
+    "木工\0" "🪚\0"
+    "机械脚\0" "🦿\0"
+    "行路\0" "🚶\0"
+    "粱龙\0" "🦕\0"
+    "三角形\0" "📐\0"
+    "饮用\0" "🚰\0"
+    "英雄\0" "🦸\0"
+    "滚筒\0" "🎢\0"
+    "蜜瓜\0" "🍈\0"
+    "盲人\0" "🧑‍🦯\0"
+    "取消\0" "✖\0"
+    "打喊露\0" "🥱\0"
+    "方位\0" "🧭\0"
+    "墓碑\0" "🪦\0"
+    "泳衣\0" "🩱\0"
+    "磁石\0" "🧲\0"
+    "手指\0" "🤌\0"
+    "滑板车\0" "🛵\0"
+    "碎\0" "💔\0"
+    "技术\0" "🤹\0"
+    "啡色\0" "🤎\0"
+    "卡\0" "💳\0"
+    "篮球\0" "🏀\0"
+    "建筑\0" "👷\0"
+    "牛扒\0" "🥩\0"
+    "巨灵\0" "🧞\0"
+    "工程师\0" "🧑‍🔬\0"
+    "栗子\0" "🌰\0"
+    "图片\0" "🖼\0"
+    "男歌手\0" "👨‍🎤\0"
+    "板球\0" "🏏\0"
+    "明星脸\0" "🤩\0"
+    "傍晚\0" "🌆\0"
+    "组合\0" "📐\0"
+    "骰子\0" "🎲\0"
+    "慢\0" "🦥\0"
+    "孵化\0" "🐣\0"
+    "扭\0" "🪢\0"
+    "生姜\0" "🦰\0"
+    "中肤色\0" "🏽\0"
+    "笔记板\0" "📋\0"
+    "九\0" "🕘\0"
+    "危险\0" "⚡\0"
+    "熊猫\0" "🐼\0"
+    "水狸\0" "🦫\0"
+    "狮子脸\0" "🦁\0"
+    "框架\0" "🪟\0"
+    "飞机\0" "🧑‍✈\0"
+    "块\0" "🧩\0"
+    "小提琴\0" "🎻\0"
+    "女歌手\0" "👩‍🎤\0"
+    "申\0" "🈸\0"
+    "发出\0" "📩\0"
+    "石头\0" "🪨\0"
+    "九点半\0" "🕤\0"
+    "咪\0" "🎙\0"
+    "求助\0" "🆘\0"
+    "糕点\0" "🍥\0"
+    "讲师\0" "👨‍🏫\0"
+    "牙齿\0" "🦷\0"
+    "烩番薯\0" "🍠\0"
+    "时钟\0" "⌚\0"
+    "报纸\0" "📰\0"
+    "刀\0" "🍽\0"
+    "货车\0" "🛻\0"
+    "番枧\0" "🧼\0"
+    "一点\0" "🕐\0"
+    "蚯蚓\0" "🪱\0"
+    "老婆婆\0" "👵\0"
+    "聋人\0" "🧏\0"
+    "跑步\0" "🏃\0"
+    "夏日\0" "🍹\0"
+    "书签\0" "📑\0"
+    "打\0" "✊\0"
+    "突起\0" "🌔\0"
+    "狗脸\0" "🐶\0"
+    "樽\0" "🍼\0"
+    "天真\0" "😇\0"
+    "珠宝\0" "💎\0"
+    "惧怕\0" "😱\0"
+    "协助\0" "🐕‍🦺\0"
+    "溜冰\0" "⛸\0"
+    "黎紧\0" "🚍\0"
+    "锤\0" "🔨\0"
+    "加\0" "➕\0"
+    "赛车\0" "🏎\0"
+    "击中\0" "🎯\0"
+    "投票\0" "🗳\0"
+    "鸡肶\0" "🍗\0"
+    "蒙古包\0" "🛖\0"
+    "㵴火\0" "🧯\0"
+    "冻伤\0" "🥶\0"
+    "皱眉\0" "☹\0"
+    "轨迹球\0" "🖲\0"
+    "网球拍\0" "🎾\0"
+    "地球仪\0" "🌍\0"
+    "海浪\0" "🌊\0"
+    "炖\0" "🍲\0"
+    "冰块\0" "🧊\0"
+    "水桶\0" "🪣\0"
+    "外星\0" "👽\0"
+    "老鼠夹\0" "🪤\0"
+    "蚂蚁\0" "🐜\0"
+    "熊猫脸\0" "🐼\0"
+    "折扣\0" "🈹\0"
+    "商店\0" "🏪\0"
+    "鼓棍\0" "🥁\0"
+    "数学家\0" "👨‍🔬\0"
+    "医院\0" "🏥\0"
+    "秘\0" "㊙\0"
+    "常青树\0" "🌲\0"
+    "踏\0" "🦶\0"
+    "仙子\0" "🧚\0"
+    "猩猩\0" "🦧\0"
+    "流口水\0" "🤤\0"
+    "青蛙脸\0" "🐸\0"
+    "汽球\0" "🎈\0"
+    "日落\0" "🌆\0"
+    "蒜头\0" "🧄\0"
+    "气体\0" "⛽\0"
+    "持有人\0" "🐍\0"
+    "羊毛\0" "🦣\0"
+    "抢\0" "🏴‍☠\0"
+    "笑\0" "😆\0"
+    "一群\0" "🦬\0"
+    "名牌\0" "📛\0"
+    "乳液\0" "🧴\0"
+    "草\0" "🍀\0"
+    "指南针\0" "🧭\0"
+    "熊\0" "🐻\0"
+    "花\0" "💐\0"
+    "百\0" "💯\0"
+    "茶\0" "🧋\0"
+    "电车\0" "🚃\0"
+    "噢\0" "🙀\0"
+    "鸡仔\0" "🐤\0"
+    "守卫员\0" "💂\0"
+    "惊叫\0" "😱\0"
+    "飘动\0" "🍃\0"
+    "治疗犬\0" "🐕‍🦺\0"
+    "脉动\0" "💗\0"
+    "邋遢\0" "🧐\0"
+    "控制器\0" "🎮\0"
+    "桌面\0" "🖥\0"
+    "游戏\0" "🥌\0"
+    "红面\0" "🥵\0"
+    "香蕉\0" "🍌\0"
+    "建筑师\0" "🧑‍💼\0"
+    "灰烬\0" "⚱\0"
+    "寄存\0" "🛅\0"
+    "页\0" "📃\0"
+    "电单车\0" "🏍\0"
+    "爆炸头\0" "🤯\0"
+    "黑色心\0" "🖤\0"
+    "狐狸脸\0" "🦊\0"
+    "佛教\0" "☸\0"
+    "卷心菜\0" "🥬\0"
+    "男警察\0" "👮‍♂\0"
+    "蒸气\0" "🍜\0"
+    "龙脸\0" "🐲\0"
+    "美容店\0" "💆\0"
+    "燕麦\0" "🥣\0"
+    "印\0" "👣\0"
+    "灯笼\0" "🎃\0"
+    "比赛\0" "🏐\0"
+    "炸\0" "🍤\0"
+    "两点\0" "🕑\0"
+    "遗传学\0" "🧬\0"
+    "蒸汽\0" "🚂\0"
+    "青瓜\0" "🥒\0"
+    "厕纸\0" "🧻\0"
+    "讲\0" "🙊\0"
+    "苦恼\0" "😧\0"
+    "洋葱\0" "🧅\0"
+    "酒吧\0" "🍶\0"
+    "刷\0" "🪥\0"
+    "溜冰鞋\0" "🛼\0"
+    "灯笼椒\0" "🫑\0"
+    "士兵\0" "🪖\0"
+    "空\0" "🈳\0"
+    "理发\0" "💇\0"
+    "王子\0" "🤴\0"
+    "橙色\0" "🧡\0"
+    "小丑\0" "🤡\0"
+    "紧张\0" "💗\0"
+    "星\0" "💫\0"
+    "窝夫\0" "🧇\0"
+    "东北\0" "↗\0"
+    "嘭嘭\0" "‼\0"
+    "喂哺\0" "🧑‍🍼\0"
+    "组装\0" "🪆\0"
+    "赏月\0" "🎑\0"
+    "晚上\0" "🌉\0"
+    "自由\0" "🗽\0"
+    "狐狸\0" "🦊\0"
+    "钮\0" "🎛\0"
+    "饮品\0" "🍼\0"
+    "冰冷\0" "😓\0"
+    "嘘\0" "🤫\0"
+    "回力镖\0" "🪃\0"
+    "老虎脸\0" "🐯\0"
+    "紫色\0" "💜\0"
+    "乘客\0" "🛳\0"
+    "牙刷\0" "🪥\0"
+    "调色板\0" "🧑‍🎨\0"
+    "车辆\0" "🚝\0"
+    "心跳\0" "🫀\0"
+    "肉\0" "🍖\0"
+    "女人\0" "👩\0"
+    "肩带\0" "🎽\0"
+    "摇\0" "🪀\0"
+    "农夫\0" "🧑‍🌾\0"
+    "上弦月\0" "🌓\0"
+    "自动化\0" "🏧\0"
+    "兔脸\0" "🐰\0"
+    "亮度\0" "🔅\0"
+    "簿记\0" "🧾\0"
+    "哺乳\0" "👨‍🍼\0"
+    "雀仔\0" "🐦\0"
+    "巨石\0" "🪨\0"
+    "对话\0" "💬\0"
+    "西装\0" "🕴\0"
+    "流星\0" "🌠\0"
+    "信封\0" "✉\0"
+    "道\0" "☯\0"
+    "旗\0" "🎏\0"
+    "傻笑脸\0" "😏\0"
+    "跆拳道\0" "🥋\0"
+    "低手\0" "🥎\0"
+    "拖拉机\0" "🚜\0"
+    "冰\0" "🥶\0"
+    "乳制品\0" "🧈\0"
+    "退出\0" "⏏\0"
+    "睇\0" "🙈\0"
+    "女超人\0" "🦸‍♀\0"
+    "颈巾\0" "🧣\0"
+    "馅料\0" "🥧\0"
+    "封面\0" "📔\0"
+    "曲棍球\0" "🏑\0"
+    "探热针\0" "🤒\0"
+    "酒店\0" "🛌\0"
+    "烟肉\0" "🥓\0"
+    "杯\0" "🥛\0"
+    "崇拜\0" "🥰\0"
+    "珍珠\0" "🧋\0"
+    "烛台\0" "🕎\0"
+    "收件箱\0" "📥\0"
+    "月费\0" "🈷\0"
+    "女技工\0" "👩‍🔧\0"
+    "天使\0" "😇\0"
+    "壳\0" "🐚\0"
+    "水晶球\0" "🔮\0"
+    "义肢\0" "🦾\0"
+    "缝针\0" "🪡\0"
+    "闩埋\0" "📕\0"
+    "男\0" "👱‍♂\0"
+    "三文治\0" "🥪\0"
+    "带\0" "📼\0"
+    "乞嚏\0" "🤧\0"
+    "培育\0" "🪴\0"
+    "老虎\0" "🐯\0"
+    "木\0" "🪓\0"
+    "医生\0" "😷\0"
+    "魔鬼\0" "👿\0"
+    "醒\0" "😎\0"
+    "轰\0" "💥\0"
+    "治疗师\0" "🧑‍⚕\0"
+    "保健员\0" "🧑‍⚕\0"
+    "鲸鱼\0" "🐳\0"
+    "符号\0" "❣\0"
+    "无限\0" "♾\0"
+    "戏院\0" "🎥\0"
+    "隐形\0" "🥷\0"
+    "目标\0" "🥍\0"
+    "购物\0" "🛍\0"
+    "多窿\0" "🧽\0"
+    "长裤\0" "👖\0"
+    "雪云\0" "🌨\0"
+    "啤酒杯\0" "🍺\0"
+    "技工\0" "🧑‍🔧\0"
+    "初学者\0" "🔰\0"
+    "狮子座\0" "🦁\0"
+    "十\0" "🕙\0"
+    "手提袋\0" "👝\0"
+    "选框\0" "☑\0"
+    "服务费\0" "🈂\0"
+    "旅行\0" "🧳\0"
+    "牛仔裤\0" "👖\0"
+    "降落\0" "🛬\0"
+    "粪便\0" "💩\0"
+    "蓝色书\0" "📘\0"
+    "下\0" "👇\0"
+    "石\0" "🥌\0"
+    "木桶\0" "🪣\0"
+    "传真机\0" "📠\0"
+    "闪\0" "💖\0"
+    "厕所\0" "🚽\0"
+    "茄子\0" "🍆\0"
+    "背囊\0" "🥾\0"
+    "箱\0" "🧰\0"
+    "键盘\0" "🎹\0"
+    "鲤鱼\0" "🎏\0"
+    "棕榈\0" "🌴\0"
+    "间尺\0" "📏\0"
+    "炮丈\0" "🧨\0"
+    "弯\0" "🪝\0"
+    "电\0" "🚃\0"
+    "橙色心\0" "🧡\0"
+    "饭\0" "🍙\0"
+    "潜水\0" "🦪\0"
+    "盲\0" "👨‍🦯\0"
+    "猪\0" "🐷\0"
+    "须\0" "🧔\0"
+    "唔准\0" "🙈\0"
+    "快走\0" "💨\0"
+    "煮食\0" "🍳\0"
+    "伤心\0" "😢\0"
+    "送货\0" "🚚\0"
+    "度假村\0" "⛵\0"
+    "服务员\0" "🛎\0"
+    "中暑\0" "🥵\0"
+    "独峰驼\0" "🐪\0"
+    "火\0" "🚒\0"
+    "暴龙\0" "🦖\0"
+    "梯\0" "🪜\0"
+    "砖\0" "🧱\0"
+    "法国\0" "🥐\0"
+    "到达\0" "🛬\0"
+    "生命\0" "🧬\0"
+    "雪糕\0" "🍦\0"
+    "游戏杆\0" "🕹\0"
+    "柑桔\0" "🍊\0"
+    "圣诞节\0" "🎅\0"
+    "八点半\0" "🕣\0"
+    "同情\0" "😮\0"
+    "笑脸\0" "😀\0"
+    "轻铁\0" "🚈\0"
+    "润肤霜\0" "🧴\0"
+    "工业\0" "🧑‍🏭\0"
+    "砌图\0" "🧩\0"
+    "自豪\0" "🥲\0"
+    "嬲\0" "😡\0"
+    "柜\0" "🗄\0"
+    "水牛\0" "🦬\0"
+    "鸭\0" "🦆\0"
+    "三叶草\0" "☘\0"
+    "雕像\0" "🗽\0"
+    "轮廓\0" "☺\0"
+    "厕所泵\0" "🪠\0"
+    "螺丝\0" "🪛\0"
+    "女精灵\0" "🧝‍♀\0"
+    "警告\0" "⚠\0"
+    "快\0" "⏩\0"
+    "水瓶座\0" "🏺\0"
+    "十一\0" "🕦\0"
+    "剧场\0" "🎭\0"
+    "马骝\0" "🙈\0"
+    "机械人\0" "🤖\0"
+    "马拉松\0" "🏃\0"
+    "鞋\0" "👞\0"
+    "人鱼\0" "🧜\0"
+    "唔好\0" "🙈\0"
+    "白色旗\0" "🏳\0"
+    "打电话\0" "🤙\0"
+    "万字夹\0" "📎\0"
+    "药丸\0" "💊\0"
+    "帮助\0" "💁\0"
+    "融\0" "🫕\0"
+    "坟墓\0" "🪦\0"
+    "听障\0" "🦻\0"
+    "钓鱼竿\0" "🎣\0"
+    "武术\0" "🥋\0"
+    "一\0" "🕐\0"
+    "三点\0" "🕒\0"
+    "尺度\0" "🧑‍⚖\0"
+    "青蛙\0" "🐸\0"
+    "原驼\0" "🦙\0"
+    "脚印\0" "👣\0"
+    "无表达\0" "😑\0"
+    "忌廉\0" "🍦\0"
+    "腮红\0" "😊\0"
+    "珠\0" "🧿\0"
+    "日出\0" "🌄\0"
+    "学校\0" "🏫\0"
+    "禾束\0" "🌾\0"
+    "天秤座\0" "⚖\0"
+    "解锁\0" "🔓\0"
+    "好\0" "🦸\0"
+    "罐\0" "🍯\0"
+    "花纸牌\0" "🎴\0"
+    "天气\0" "🌡\0"
+    "不久\0" "🔜\0"
+    "老鼠脸\0" "🐭\0"
+    "女厨师\0" "👩‍🍳\0"
+    "子午线\0" "🌐\0"
+    "冬甩\0" "🍩\0"
+    "鼠\0" "🐀\0"
+    "红色心\0" "❤\0"
+    "手瓜\0" "💪\0"
+    "门券\0" "🎫\0"
+    "酒塞\0" "🍾\0"
+    "录音室\0" "🎙\0"
+    "木屐\0" "🩴\0"
+    "尿片\0" "🧷\0"
+    "红鹤\0" "🦩\0"
+    "狼脸\0" "🐺\0"
+    "无头发\0" "🦲\0"
+    "死亡\0" "☠\0"
+    "水泥\0" "🧱\0"
+    "雷电\0" "⛈\0"
+    "半\0" "🚛\0"
+    "梯级\0" "🪜\0"
+    "美式\0" "🏈\0"
+    "煲\0" "🫕\0"
+    "十字架\0" "⛪\0"
+    "资讯\0" "💁\0"
+    "剃须\0" "🪒\0"
+    "夜晚\0" "🌃\0"
+    "水球\0" "🤽\0"
+    "耳仔\0" "👂\0"
+    "收集\0" "🛻\0"
+    "警车\0" "🚓\0"
+    "阴阳\0" "☯\0"
+    "抱抱\0" "🫂\0"
+    "戒指\0" "💍\0"
+    "震动\0" "📳\0"
+    "放射性\0" "☢\0"
+    "鼓\0" "🪘\0"
+    "莓\0" "🫐\0"
+    "婚礼\0" "👰\0"
+    "外套\0" "🧥\0"
+    "收到\0" "📲\0"
+    "长颈鹿\0" "🦒\0"
+    "瑜伽\0" "🧘\0"
+    "天线\0" "📡\0"
+    "富士\0" "🗻\0"
+    "纸\0" "📜\0"
+    "猪脸\0" "🐷\0"
+    "敬礼\0" "🖖\0"
+    "蜗牛\0" "🐌\0"
+    "节日\0" "🥮\0"
+    "葬礼\0" "⚱\0"
+    "方便\0" "🏪\0"
+    "山羊\0" "🐐\0"
+    "叶\0" "🌿\0"
+    "山\0" "🏔\0"
+    "提子\0" "🍇\0"
+    "女装\0" "👚\0"
+    "波浪\0" "🌊\0"
+    "发型师\0" "💇\0"
+    "树熊\0" "🐨\0"
+    "皮纳塔\0" "🪅\0"
+    "标志\0" "🪧\0"
+    "脱落\0" "🌳\0"
+    "基督徒\0" "⛪\0"
+    "耸肩\0" "🤷\0"
+    "谂野\0" "🤔\0"
+    "工具箱\0" "🧰\0"
+    "安静\0" "🔇\0"
+    "大头针\0" "📌\0"
+    "欧洲\0" "🌍\0"
+    "毕业帽\0" "🎓\0"
+    "工厂\0" "🧑‍🏭\0"
+    "阴\0" "☯\0"
+    "火鸡\0" "🦃\0"
+    "铜\0" "🥉\0"
+    "唔客气\0" "😑\0"
+    "雨\0" "⛈\0"
+    "乐谱\0" "🎼\0"
+    "胸像\0" "👤\0"
+    "纸币\0" "💴\0"
+    "盐\0" "🧂\0"
+    "肉块\0" "🥩\0"
+    "办公室\0" "👨‍💼\0"
+    "绿色\0" "💚\0"
+    "红\0" "😡\0"
+    "恶魔\0" "👿\0"
+    "奖\0" "🏆\0"
+    "果汁酒\0" "🥥\0"
+    "禁钉\0" "📌\0"
+    "洗衫\0" "🧺\0"
+    "甜\0" "🍡\0"
+    "东京\0" "🗼\0"
+    "演员\0" "🧑‍🎤\0"
+    "弯曲\0" "🪝\0"
+    "的士\0" "🚕\0"
+    "分量\0" "🥃\0"
+    "猪鼻\0" "🐽\0"
+    "盐樽\0" "🧂\0"
+    "蜘蛛\0" "🕷\0"
+    "档案\0" "📁\0"
+    "海鲜\0" "🍢\0"
+    "艺术\0" "🎭\0"
+    "滚动\0" "📜\0"
+    "机动船\0" "🛥\0"
+    "剪头发\0" "💇‍♂\0"
+    "交通\0" "🚥\0"
+    "犀牛\0" "🦏\0"
+    "狡猾\0" "🦝\0"
+    "护镜\0" "🥽\0"
+    "沮丧\0" "😔\0"
+    "脸\0" "😀\0"
+    "小量\0" "🤏\0"
+    "人\0" "🧑‍🍼\0"
+    "冷球\0" "🧶\0"
+    "画面\0" "🎞\0"
+    "葵扇\0" "♠\0"
+    "多动作\0" "🤹\0"
+    "战斗机\0" "🥷\0"
+    "十一点\0" "🕚\0"
+    "景观\0" "🪟\0"
+    "结他\0" "🎸\0"
+    "臭\0" "💩\0"
+    "高压\0" "⚡\0"
+    "咧嘴笑\0" "😁\0"
+    "俄罗斯\0" "🪆\0"
+    "超级\0" "🦸\0"
+    "傻笑\0" "😏\0"
+    "间谍\0" "🕵\0"
+    "紧急\0" "🦺\0"
+    "卡片盒\0" "📇\0"
+    "三\0" "🕒\0"
+    "地球\0" "🌍\0"
+    "离境\0" "🛫\0"
+    "大厨\0" "👨‍🍳\0"
+    "化学\0" "⚗\0"
+    "洞\0" "⛳\0"
+    "死\0" "💀\0"
+    "花环\0" "🏵\0"
+    "划艇\0" "🚣\0"
+    "牛女\0" "🤠\0"
+    "灯\0" "🚨\0"
+    "线\0" "🧵\0"
+    "雪橇\0" "🛷\0"
+    "宠物\0" "🐶\0"
+    "指甲油\0" "💅\0"
+    "十八岁\0" "🔞\0"
+    "压\0" "🗜\0"
+    "快乐\0" "😂\0"
+    "忍者\0" "🥷\0"
+    "牙\0" "🪥\0"
+    "板手\0" "🔧\0"
+    "医药\0" "💉\0"
+    "娱乐\0" "🚙\0"
+    "利是\0" "🧧\0"
+    "农夫车\0" "🛻\0"
+    "男仔\0" "👦\0"
+    "建造\0" "🏗\0"
+    "浅肤色\0" "🏻\0"
+    "肉丸\0" "🧆\0"
+    "合格\0" "🈴\0"
+    "女警察\0" "👮‍♀\0"
+    "爆谷\0" "🍿\0"
+    "玫瑰\0" "🌹\0"
+    "纸牌\0" "♠\0"
+    "无用\0" "🪴\0"
+    "佛法轮\0" "☸\0"
+    "防晒\0" "🧴\0"
+    "闹钟\0" "⏰\0"
+    "泡菜\0" "🥒\0"
+    "筷子\0" "🥢\0"
+    "手枪\0" "🔫\0"
+    "竿\0" "🎣\0"
+    "肉连⻣\0" "🍖\0"
+    "火车\0" "🚂\0"
+    "坚硬\0" "🪨\0"
+    "得\0" "🉐\0"
+    "手风琴\0" "🪗\0"
+    "骆驼\0" "🐪\0"
+    "空手道\0" "🥋\0"
+    "脸红\0" "😳\0"
+    "爱情\0" "💌\0"
+    "感激\0" "🥲\0"
+    "吸气\0" "🫁\0"
+    "护照\0" "🛂\0"
+    "女侦探\0" "🕵‍♀\0"
+    "手掌\0" "🤦\0"
+    "冰球\0" "🏒\0"
+    "行山\0" "🥾\0"
+    "药\0" "😷\0"
+    "在\0" "🔛\0"
+    "圆禁钉\0" "📍\0"
+    "热带\0" "🦩\0"
+    "迪亚\0" "🪔\0"
+    "手球\0" "🤾\0"
+    "冻结\0" "🥶\0"
+    "早上\0" "🌄\0"
+    "滑雪板\0" "🏂\0"
+    "泡泡\0" "💬\0"
+    "体育场\0" "🏟\0"
+    "条纹\0" "🦓\0"
+    "心\0" "💌\0"
+    "靴\0" "🥾\0"
+    "闩\0" "📴\0"
+    "英镑\0" "💷\0"
+    "海\0" "⛵\0"
+    "透明\0" "🪟\0"
+    "饭团\0" "🍙\0"
+    "调皮\0" "🦦\0"
+    "西北\0" "↖\0"
+    "笔尖\0" "✒\0"
+    "卷纸\0" "🧻\0"
+    "公羊\0" "🐏\0"
+    "男士\0" "👞\0"
+    "双眼\0" "👀\0"
+    "溅\0" "💦\0"
+    "茶杯\0" "🍵\0"
+    "显微镜\0" "🔬\0"
+    "骨头\0" "🦴\0"
+    "片\0" "🍕\0"
+    "地铁\0" "🚇\0"
+    "暗\0" "🔅\0"
+    "信号\0" "🚥\0"
+    "满\0" "🌕\0"
+    "扩音器\0" "📣\0"
+    "落雨\0" "🌈\0"
+    "行尸\0" "🧟\0"
+    "男厕\0" "🚹\0"
+    "身体\0" "👂\0"
+    "熄\0" "🧯\0"
+    "背心\0" "🦺\0"
+    "臭鼬\0" "🦨\0"
+    "新郎\0" "🤵\0"
+    "券\0" "🎟\0"
+    "滚轴\0" "🛼\0"
+    "绿色心\0" "💚\0"
+    "痢\0" "😛\0"
+    "男法官\0" "👨‍⚖\0"
+    "分数\0" "💯\0"
+    "合\0" "🈴\0"
+    "问号\0" "❓\0"
+    "螺丝批\0" "🪛\0"
+    "爱\0" "😍\0"
+    "落叶树\0" "🌳\0"
+    "导盲\0" "🦮\0"
+    "讲野\0" "💬\0"
+    "海盗\0" "🦜\0"
+    "过山车\0" "🎢\0"
+    "链\0" "⛓\0"
+    "健康\0" "🤧\0"
+    "向右\0" "🤜\0"
+    "女法官\0" "👩‍⚖\0"
+    "瓮\0" "⚱\0"
+    "杂耍\0" "🤹\0"
+    "乌蝇\0" "🪰\0"
+    "好食\0" "😋\0"
+    "神社\0" "⛩\0"
+    "粗除号\0" "➗\0"
+    "陶醉\0" "🥴\0"
+    "浓汤\0" "🦞\0"
+    "摇摇\0" "🪀\0"
+    "翼\0" "💸\0"
+    "辣\0" "🌶\0"
+    "赛跑\0" "🏃‍♂\0"
+    "旋转\0" "💞\0"
+    "拉链\0" "🤐\0"
+    "雀\0" "🦃\0"
+    "会计\0" "🧾\0"
+    "浴室\0" "🪥\0"
+    "利\0" "🪒\0"
+    "娥眉月\0" "🌒\0"
+    "小丑脸\0" "🤡\0"
+    "金\0" "🪙\0"
+    "女王\0" "👑\0"
+    "煎\0" "🍳\0"
+    "基点间\0" "↗\0"
+    "手指公\0" "👍\0"
+    "牛油果\0" "🥑\0"
+    "头盔\0" "🪖\0"
+    "斩\0" "🪓\0"
+    "发疯\0" "😡\0"
+    "营\0" "🈺\0"
+    "手机\0" "🤳\0"
+    "收费\0" "🈶\0"
+    "明星\0" "🤩\0"
+    "树\0" "🌲\0"
+    "满月\0" "🌕\0"
+    "亚洲\0" "🌏\0"
+    "跳动\0" "💓\0"
+    "弦月\0" "🌒\0"
+    "圆形\0" "⏺\0"
+    "无障碍\0" "🛗\0"
+    "罐头\0" "🥫\0"
+    "基督教\0" "✝\0"
+    "散子包\0" "👛\0"
+    "醉嘅脸\0" "🥴\0"
+    "法官\0" "🧑‍⚖\0"
+    "公鸡\0" "🐓\0"
+    "棺材\0" "⚰\0"
+    "二头肌\0" "💪\0"
+    "教堂\0" "⛪\0"
+    "蘑菇\0" "🍄\0"
+    "家\0" "🏠\0"
+    "赛马\0" "🏇\0"
+    "讲大话\0" "🤥\0"
+    "粉碎\0" "🥰\0"
+    "锁\0" "🔓\0"
+    "分类\0" "🗂\0"
+    "低\0" "🔅\0"
+    "单车\0" "🚴\0"
+    "肌肉\0" "💪\0"
+    "双子\0" "♊\0"
+    "残月\0" "🌘\0"
+    "蒸馏器\0" "⚗\0"
+    "板\0" "🛹\0"
+    "电邮\0" "✉\0"
+    "砂浆\0" "🧱\0"
+    "泳裤\0" "🩲\0"
+    "酷\0" "😎\0"
+    "笔\0" "✒\0"
+    "送礼\0" "🎁\0"
+    "牛仔\0" "🤠\0"
+    "双鱼座\0" "🐟\0"
+    "魔术\0" "🪄\0"
+    "牙科\0" "🪥\0"
+    "竹\0" "🎍\0"
+    "女厕\0" "🚺\0"
+    "世界\0" "🌍\0"
+    "斧头\0" "🪓\0"
+    "寺庙\0" "🛕\0"
+    "面\0" "🥸\0"
+    "啡色心\0" "🤎\0"
+    "男厨师\0" "👨‍🍳\0"
+    "毒菌\0" "🍄\0"
+    "坏人\0" "🦹\0"
+    "拍子\0" "🪘\0"
+    "出发\0" "🛫\0"
+    "灰色\0" "🦳\0"
+    "掌\0" "🐾\0"
+    "自行车\0" "🚳\0"
+    "奥布朗\0" "🧚\0"
+    "顶帽\0" "🎩\0"
+    "导盲犬\0" "🦮\0"
+    "生果\0" "🍇\0"
+    "包装\0" "🎁\0"
+    "片装\0" "🍰\0"
+    "布甸\0" "🍮\0"
+    "十二\0" "🕛\0"
+    "增长\0" "💹\0"
+    "训紧觉\0" "😴\0"
+    "吹\0" "🍃\0"
+    "科学\0" "🧪\0"
+    "开\0" "🔓\0"
+    "醉\0" "🥴\0"
+    "我爱您\0" "🤟\0"
+    "垃圾\0" "🚮\0"
+    "凋谢\0" "🥀\0"
+    "累嘅脸\0" "😫\0"
+    "夫妇\0" "👭\0"
+    "试食\0" "😋\0"
+    "脉冲\0" "🫀\0"
+    "箭靶\0" "🎯\0"
+    "帆船\0" "⛵\0"
+    "受伤\0" "🤕\0"
+    "马戏团\0" "🎪\0"
+    "镜片\0" "🔍\0"
+    "版权\0" "©\0"
+    "甜品\0" "🍡\0"
+    "卷曲\0" "🦱\0"
+    "靓\0" "🦩\0"
+    "捏手\0" "🤏\0"
+    "小屋\0" "🛖\0"
+    "直升机\0" "🚁\0"
+    "孔雀\0" "🦚\0"
+    "雪花\0" "❄\0"
+    "薯仔\0" "🥔\0"
+    "满意\0" "😆\0"
+    "反射器\0" "🪞\0"
+    "果汁盒\0" "🧃\0"
+    "雪人\0" "☃\0"
+    "起重机\0" "🛗\0"
+    "托盘\0" "📤\0"
+    "丘比特\0" "💘\0"
+    "永远\0" "♾\0"
+    "白领\0" "🧑‍💼\0"
+    "星座\0" "👧\0"
+    "着上\0" "🥿\0"
+    "一点半\0" "🕜\0"
+    "花洒\0" "🚿\0"
+    "开发者\0" "🧑‍💻\0"
+    "枪\0" "🎉\0"
+    "害怕\0" "😨\0"
+    "男教师\0" "👨‍🏫\0"
+    "拍手\0" "👏\0"
+    "浪漫\0" "💒\0"
+    "驼峰\0" "🐪\0"
+    "殡仪馆\0" "⚱\0"
+    "车站\0" "🚉\0"
+    "停止\0" "🛑\0"
+    "问题\0" "⁉\0"
+    "安全\0" "🦺\0"
+    "道教\0" "☯\0"
+    "狂热\0" "🥵\0"
+    "个人\0" "💻\0"
+    "啄木鸟\0" "🦜\0"
+    "手势\0" "🤌\0"
+    "暂停\0" "⏯\0"
+    "飞\0" "🕊\0"
+    "坠落\0" "🌠\0"
+    "云\0" "☁\0"
+    "仪器\0" "🎷\0"
+    "枫叶\0" "🍁\0"
+    "保龄球\0" "🎳\0"
+    "邪眼\0" "🧿\0"
+    "提示\0" "💁\0"
+    "粗乘号\0" "✖\0"
+    "救生衣\0" "🦺\0"
+    "麻雀\0" "🀄\0"
+    "欧陆式\0" "🏰\0"
+    "邮箱\0" "📫\0"
+    "女仙子\0" "🧚‍♀\0"
+    "手\0" "👋\0"
+    "屎\0" "💩\0"
+    "连住\0" "🖇\0"
+    "啤酒\0" "🍺\0"
+    "标记\0" "📑\0"
+    "假扮\0" "🥸\0"
+    "殭尸\0" "🧟\0"
+    "手表\0" "⌚\0"
+    "一堆屎\0" "💩\0"
+    "结\0" "🪢\0"
+    "槿\0" "🌺\0"
+    "法式\0" "🥖\0"
+    "蜜蜂\0" "🐝\0"
+    "电影\0" "🎥\0"
+    "阶砖\0" "♦\0"
+    "纠缠\0" "🦡\0"
+    "螺栓\0" "🔩\0"
+    "豹\0" "🐆\0"
+    "平行\0" "🤹\0"
+    "怪物\0" "💀\0"
+    "风脸\0" "🌬\0"
+    "消防车\0" "🧑‍🚒\0"
+    "鲨鱼\0" "🦈\0"
+    "歌手\0" "🧑‍🎤\0"
+    "打扮\0" "🧑‍🎄\0"
+    "重量\0" "⚖\0"
+    "短裤\0" "🩳\0"
+    "完全\0" "😲\0"
+    "糖果\0" "🍬\0"
+    "鸣门卷\0" "🍥\0"
+    "乘法\0" "✖\0"
+    "牛角包\0" "🥐\0"
+    "清酒\0" "🍶\0"
+    "失望\0" "😥\0"
+    "静\0" "🤫\0"
+    "蒸气房\0" "🧖\0"
+    "交叉\0" "🤞\0"
+    "岛\0" "🏝\0"
+    "无表情\0" "😐\0"
+    "海滩\0" "🏖\0"
+    "外星人\0" "👽\0"
+    "证据\0" "🧾\0"
+    "獾\0" "🦡\0"
+    "蛇夫座\0" "🐍\0"
+    "小\0" "🦐\0"
+    "自拍\0" "🤳\0"
+    "快速\0" "💨\0"
+    "五点\0" "🕔\0"
+    "打气\0" "📣\0"
+    "手袋\0" "👜\0"
+    "自来水\0" "🚰\0"
+    "救护车\0" "🚑\0"
+    "星夜\0" "🌃\0"
+    "白花\0" "💮\0"
+    "班戟\0" "🥞\0"
+    "日元\0" "💹\0"
+    "牙医\0" "🦷\0"
+    "薄饼\0" "🫓\0"
+    "银牌\0" "🥈\0"
+    "运动场\0" "🎽\0"
+    "威士忌\0" "🥃\0"
+    "赛跑衫\0" "🎽\0"
+    "头晕\0" "😵\0"
+    "虎头钳\0" "🗜\0"
+    "智慧\0" "🦉\0"
+    "公主\0" "👸\0"
+    "呕心\0" "🤢\0"
+    "联锁\0" "🧩\0"
+    "新月面\0" "🌚\0"
+    "蜡笔\0" "🖍\0"
+    "女农夫\0" "👩‍🌾\0"
+    "棒球\0" "⚾\0"
+    "女仔\0" "👧\0"
+    "公仔\0" "🪆\0"
+    "针织\0" "🧶\0"
+    "国王\0" "👑\0"
+    "反弹\0" "🪃\0"
+    "镜\0" "🪞\0"
+    "卷曲圈\0" "➰\0"
+    "卒\0" "🤌\0"
+    "光\0" "🪶\0"
+    "大羊驼\0" "🦙\0"
+    "迷茫\0" "😕\0"
+    "银纸\0" "💴\0"
+    "紫色心\0" "💜\0"
+    "第三\0" "🥉\0"
+    "汉堡包\0" "🍔\0"
+    "军队\0" "🪖\0"
+    "四点半\0" "🕟\0"
+    "护理\0" "💅\0"
+    "锯\0" "🪚\0"
+    "举手\0" "✋\0"
+    "幼小\0" "🌱\0"
+    "梅花\0" "♣\0"
+    "证明\0" "🧾\0"
+    "家庭\0" "👪\0"
+    "挑\0" "⛏\0"
+    "凉鞋\0" "🩴\0"
+    "导航\0" "🧭\0"
+    "远足\0" "🚶\0"
+    "纱丽\0" "🥻\0"
+    "剑击\0" "🤺\0"
+    "桶\0" "🛢\0"
+    "十点\0" "🕙\0"
+    "狗\0" "🐶\0"
+    "奖杯\0" "🏆\0"
+    "娃娃\0" "🎎\0"
+    "放松\0" "☺\0"
+    "电脑\0" "💻\0"
+    "圆碌碌\0" "🙄\0"
+    "野牛\0" "🦬\0"
+    "喇叭\0" "🔇\0"
+    "锚\0" "⚓\0"
+    "圆屋\0" "🛖\0"
+    "环虫\0" "🪱\0"
+    "奇怪\0" "🤓\0"
+    "龙虾\0" "🦞\0"
+    "鹰嘴豆\0" "🧆\0"
+    "男超人\0" "🦸‍♂\0"
+    "框画\0" "🖼\0"
+    "扭纹\0" "🥨\0"
+    "处女座\0" "♍\0"
+    "公园\0" "🏞\0"
+    "丹参树\0" "🎋\0"
+    "行山鞋\0" "🥾\0"
+    "白色\0" "🤍\0"
+    "卷饼\0" "🌯\0"
+    "宗教\0" "⛪\0"
+    "图\0" "💹\0"
+    "警报\0" "⏰\0"
+    "射击\0" "🌠\0"
+    "预言\0" "🥠\0"
+    "齿轮\0" "⚙\0"
+    "关闭\0" "📫\0"
+    "同意\0" "🤝\0"
+    "信\0" "💌\0"
+    "甲壳虫\0" "🪲\0"
+    "下跌\0" "📉\0"
+    "树獭\0" "🦥\0"
+    "飞镖\0" "🎯\0"
+    "玩具\0" "🪀\0"
+    "裤\0" "👖\0"
+    "饺子\0" "🥟\0"
+    "牛奶\0" "🧋\0"
+    "缝纫针\0" "🪡\0"
+    "病毒\0" "🦟\0"
+    "巴士\0" "🚌\0"
+    "香草\0" "🌿\0"
+    "迪亚灯\0" "🪔\0"
+    "累\0" "😩\0"
+    "男仙子\0" "🧚‍♂\0"
+    "书\0" "📔\0"
+    "进入\0" "⛔\0"
+    "数字\0" "🔢\0"
+    "太空人\0" "🧑‍🚀\0"
+    "印度寺\0" "🛕\0"
+    "情信\0" "💌\0"
+    "鲤鱼旗\0" "🎏\0"
+    "智力\0" "🧠\0"
+    "茶壶\0" "🫖\0"
+    "公牛\0" "🐂\0"
+    "魔法棒\0" "🪄\0"
+    "体操\0" "🤸\0"
+    "无限制\0" "♾\0"
+    "仪式\0" "🎑\0"
+    "发件箱\0" "📤\0"
+    "海龟\0" "🐢\0"
+    "青苹果\0" "🍏\0"
+    "破碎\0" "💔\0"
+    "信用\0" "💳\0"
+    "烩\0" "🍠\0"
+    "花生\0" "🥜\0"
+    "土星\0" "🪐\0"
+    "火箭\0" "🧑‍🚀\0"
+    "球棒\0" "🏏\0"
+    "聋\0" "🧏\0"
+    "通渠\0" "🪠\0"
+    "马骝脸\0" "🐵\0"
+    "钱\0" "🪙\0"
+    "日本\0" "🍙\0"
+    "大声公\0" "📢\0"
+    "路\0" "🛣\0"
+    "巨蛇\0" "🐍\0"
+    "搜寻\0" "🔍\0"
+    "钟\0" "🛎\0"
+    "教师\0" "👨‍🏫\0"
+    "气球\0" "💬\0"
+    "仓鼠\0" "🐹\0"
+    "清洁\0" "🧹\0"
+    "细\0" "🤪\0"
+    "双重\0" "⏩\0"
+    "恋爱\0" "🥰\0"
+    "挥手\0" "👋\0"
+    "曱甴\0" "🪳\0"
+    "怀疑\0" "🤨\0"
+    "跳舞\0" "💃\0"
+    "眼\0" "😄\0"
+    "娱乐家\0" "🧑‍🎤\0"
+    "曲发\0" "🦱\0"
+    "窿\0" "🕳\0"
+    "弓\0" "🏹\0"
+    "汽车\0" "🚞\0"
+    "木锯\0" "🪚\0"
+    "表情\0" "🙍\0"
+    "化疗\0" "🦲\0"
+    "波\0" "🏌\0"
+    "张开\0" "🖐\0"
+    "开屏\0" "🦚\0"
+    "利是封\0" "🧧\0"
+    "生蚝\0" "🦪\0"
+    "线索\0" "🧩\0"
+    "呢度\0" "🈁\0"
+    "洗头水\0" "🧴\0"
+    "长毛象\0" "🦣\0"
+    "裙\0" "👗\0"
+    "摇滚\0" "🤘\0"
+    "荒岛\0" "🏝\0"
+    "雾\0" "🌫\0"
+    "神教\0" "⛩\0"
+    "旋风\0" "🌪\0"
+    "电池\0" "🔋\0"
+    "酱\0" "🥯\0"
+    "不准\0" "⛔\0"
+    "黑猫\0" "🐈‍⬛\0"
+    "波板糖\0" "🍭\0"
+    "黄色心\0" "💛\0"
+    "铁路\0" "🚂\0"
+    "交叉旗\0" "🎌\0"
+    "录制\0" "⏺\0"
+    "条\0" "🍫\0"
+    "标签\0" "📑\0"
+    "欧元\0" "💶\0"
+    "寄信\0" "💌\0"
+    "银行\0" "🏦\0"
+    "男殭尸\0" "🧟‍♂\0"
+    "开花\0" "🌸\0"
+    "拉丁\0" "🔠\0"
+    "西\0" "⬅\0"
+    "神奇\0" "🧝\0"
+    "拖头车\0" "🚛\0"
+    "画笔\0" "🖌\0"
+    "蔬菜\0" "🫑\0"
+    "美洲\0" "🌎\0"
+    "讯号\0" "📶\0"
+    "警察\0" "👮\0"
+    "黑色\0" "🖤\0"
+    "匿名\0" "🥸\0"
+    "购物袋\0" "🛍\0"
+    "困惑\0" "😖\0"
+    "球场\0" "🏑\0"
+    "箭咀\0" "📲\0"
+    "陷阱\0" "🪤\0"
+    "嬲嘅脸\0" "😠\0"
+    "运动\0" "👟\0"
+    "道歉\0" "🙇\0"
+    "感谢\0" "🙇‍♂\0"
+    "免费\0" "🈚\0"
+    "冥想\0" "🧘\0"
+    "包头\0" "🧕\0"
+    "袋鼠\0" "🦘\0"
+    "大\0" "🦣\0"
+    "场所\0" "🛐\0"
+    "坐\0" "🪑\0"
+    "灯胆\0" "💡\0"
+    "静音\0" "🔇\0"
+    "除\0" "➗\0"
+    "爪\0" "🦞\0"
+    "龙卷风\0" "🌀\0"
+    "烧焊\0" "🥽\0"
+    "大虾\0" "🍤\0"
+    "彗星\0" "☄\0"
+    "木头\0" "🪵\0"
+    "滑块\0" "🎚\0"
+    "鬼\0" "👻\0"
+    "泵\0" "⛽\0"
+    "海洋\0" "🌊\0"
+    "部门\0" "🏬\0"
+    "月亮\0" "🌑\0"
+    "男学生\0" "👨‍🎓\0"
+    "跑\0" "💨\0"
+    "行紧路\0" "🚶\0"
+    "拥抱\0" "🫂\0"
+    "播放\0" "▶\0"
+    "生物学\0" "🧫\0"
+    "吻\0" "😘\0"
+    "天妇罗\0" "🍤\0"
+    "恭喜\0" "㊗\0"
+    "喷水池\0" "⛲\0"
+    "纠察\0" "🪧\0"
+    "无知\0" "🤷\0"
+    "螺母\0" "🔩\0"
+    "地下\0" "🤣\0"
+    "厨房刀\0" "🔪\0"
+    "男巫\0" "🧙\0"
+    "梳打\0" "🥤\0"
+    "音乐\0" "🎼\0"
+    "快到\0" "🚔\0"
+    "熊仔\0" "🧸\0"
+    "钢琴\0" "🎹\0"
+    "鳍\0" "🐬\0"
+    "硬币\0" "🪙\0"
+    "骑单车\0" "🚵‍♀\0"
+    "球拍\0" "🏓\0"
+    "袋棍球\0" "🥍\0"
+    "包裹\0" "📦\0"
+    "泡\0" "🧋\0"
+    "软件\0" "🧑‍💻\0"
+    "箭\0" "💘\0"
+    "箭头\0" "🏹\0"
+    "人马座\0" "♐\0"
+    "小童\0" "🧒\0"
+    "银河\0" "🌌\0"
+    "制服\0" "🥋\0"
+    "桑拿\0" "🧖\0"
+    "口震\0" "😱\0"
+    "牛角卷\0" "🥐\0"
+    "猪扒\0" "🥩\0"
+    "采矿\0" "⛏\0"
+    "小精灵\0" "🧝\0"
+    "红包\0" "🧧\0"
+    "握紧\0" "✊\0"
+    "废纸篓\0" "🗑\0"
+    "轮椅\0" "🧑‍🦼\0"
+    "格子\0" "🏁\0"
+    "橙\0" "🍊\0"
+    "问\0" "🙏\0"
+    "感叹号\0" "‼\0"
+    "录影机\0" "📼\0"
+    "器官\0" "🫀\0"
+    "猪公\0" "🐗\0"
+    "几何\0" "🔴\0"
+    "黑暗\0" "🌑\0"
+    "雌性猪\0" "🐖\0"
+    "接受\0" "🉑\0"
+    "反射\0" "🪃\0"
+    "白羊座\0" "🐏\0"
+    "瓦肯式\0" "🖖\0"
+    "热腾腾\0" "♨\0"
+    "电筒\0" "🔦\0"
+    "闪耀\0" "🌟\0"
+    "昆虫\0" "🪲\0"
+    "彩虹\0" "🌈\0"
+    "搞笑\0" "💢\0"
+    "警车灯\0" "🚨\0"
+    "中性\0" "🧒\0"
+    "对\0" "🆚\0"
+    "见证\0" "👁‍🗨\0"
+    "龙\0" "🐲\0"
+    "卫生间\0" "🚹\0"
+    "刺\0" "🦔\0"
+    "蓝色心\0" "💙\0"
+    "业务\0" "👨‍💼\0"
+    "果汁\0" "🥤\0"
+    "奇异果\0" "🥝\0"
+    "惊讶\0" "😯\0"
+    "化学家\0" "🧑‍🔬\0"
+    "油\0" "🛢\0"
+    "打开\0" "🪟\0"
+    "面纱\0" "🧕\0"
+    "绘画\0" "🖼\0"
+    "游乐场\0" "🎡\0"
+    "芒果\0" "🥭\0"
+    "唔相信\0" "🤦\0"
+    "微生物\0" "🦠\0"
+    "芝士\0" "🫕\0"
+    "打印机\0" "🖨\0"
+    "感叹嘅\0" "❣\0"
+    "唇印\0" "💋\0"
+    "女教师\0" "👩‍🏫\0"
+    "导师\0" "🧑‍🏫\0"
+    "城市\0" "🏙\0"
+    "速度\0" "🚄\0"
+    "辅助\0" "🦾\0"
+    "蛋糕\0" "🎂\0"
+    "试味\0" "😝\0"
+    "红萝卜\0" "🥕\0"
+    "调味料\0" "🧂\0"
+    "秤\0" "👨‍⚖\0"
+    "汗\0" "😅\0"
+    "拉面\0" "🍜\0"
+    "病\0" "😷\0"
+    "郁金香\0" "🌷\0"
+    "扳手\0" "🛠\0"
+    "花园\0" "🏡\0"
+    "医疗\0" "🩸\0"
+    "纸屑\0" "🎊\0"
+    "辣椒\0" "🫑\0"
+    "鸡尾酒\0" "🍸\0"
+    "盆栽\0" "🪴\0"
+    "七\0" "🕖\0"
+    "安息\0" "🪦\0"
+    "合手\0" "🙏\0"
+    "卷页\0" "📃\0"
+    "彩虹旗\0" "🏳‍🌈\0"
+    "章鱼\0" "🐙\0"
+    "兑换\0" "💱\0"
+    "单轨\0" "🚝\0"
+    "匙羮\0" "🥄\0"
+    "外框\0" "❔\0"
+    "进化\0" "🧬\0"
+    "花束\0" "💐\0"
+    "靶\0" "🎯\0"
+    "拖住\0" "🧑‍🤝‍🧑\0"
+    "痛苦\0" "😬\0"
+    "漩涡\0" "🍥\0"
+    "服装\0" "👣\0"
+    "獭\0" "🦦\0"
+    "嘟嘟鸟\0" "🦤\0"
+    "向下\0" "⬇\0"
+    "沙漠\0" "🏜\0"
+    "黄色\0" "💛\0"
+    "天鹅\0" "🦢\0"
+    "蝎子\0" "🦂\0"
+    "团\0" "🍙\0"
+    "图表\0" "💹\0"
+    "纪念\0" "🎗\0"
+    "滑翔伞\0" "🪂\0"
+    "色士风\0" "🎷\0"
+    "二\0" "🕑\0"
+    "潜水镜\0" "🤿\0"
+    "肺\0" "🫁\0"
+    "禁\0" "🈲\0"
+    "光学\0" "💽\0"
+    "肤色\0" "🏻\0"
+    "金牌\0" "🥇\0"
+    "山地\0" "🚵\0"
+    "穆斯林\0" "🕌\0"
+    "灯泡\0" "💡\0"
+    "唇膏\0" "💄\0"
+    "火花\0" "🎇\0"
+    "车厘子\0" "🍒\0"
+    "浴缸\0" "🛀\0"
+    "放低\0" "📪\0"
+    "顶部\0" "🔝\0"
+    "出汗\0" "🥵\0"
+    "四叶草\0" "🍀\0"
+    "椰子\0" "🥥\0"
+    "窗\0" "🪟\0"
+    "录影带\0" "📼\0"
+    "烤肉串\0" "🥙\0"
+    "大猩猩\0" "🦍\0"
+    "大声\0" "🔊\0"
+    "靴子\0" "👢\0"
+    "家禽\0" "🍗\0"
+    "机械臂\0" "🦾\0"
+    "横额\0" "🎋\0"
+    "㵴火筒\0" "🧯\0"
+    "发送\0" "📩\0"
+    "骷髅头\0" "💀\0"
+    "蓝光\0" "📀\0"
+    "有雾\0" "🌁\0"
+    "试管\0" "🧪\0"
+    "扫\0" "🧹\0"
+    "西南\0" "↙\0"
+    "老\0" "🦳\0"
+    "雷龙\0" "🦕\0"
+    "太空\0" "🛰\0"
+    "情人\0" "💝\0"
+    "好累\0" "😩\0"
+    "棒球帽\0" "🧢\0"
+    "航班\0" "🪶\0"
+    "太阳花\0" "🌻\0"
+    "男装鞋\0" "👞\0"
+    "篮圈\0" "🏀\0"
+    "撅嘴\0" "😡\0"
+    "咀唇\0" "💋\0"
+    "计时器\0" "⌛\0"
+    "开玩笑\0" "😜\0"
+    "蝴蝶结\0" "💝\0"
+    "落叶\0" "🍁\0"
+    "讽刺\0" "😼\0"
+    "七点半\0" "🕢\0"
+    "串烧\0" "🍢\0"
+    "级别\0" "🎚\0"
+    "放大\0" "🔍\0"
+    "巡逻\0" "🚓\0"
+    "嘘嘅脸\0" "🤫\0"
+    "热\0" "🥵\0"
+    "散子\0" "👛\0"
+    "握\0" "🤝\0"
+    "红酒杯\0" "🍷\0"
+    "邪恶\0" "🙈\0"
+    "未成年\0" "🔞\0"
+    "纸巾\0" "🧻\0"
+    "玻璃杯\0" "🍸\0"
+    "牛\0" "🐮\0"
+    "金属\0" "🪙\0"
+    "处女\0" "👧\0"
+    "巫师\0" "🪄\0"
+    "缝线\0" "🪡\0"
+    "恐布\0" "😝\0"
+    "腕龙\0" "🦕\0"
+    "便当\0" "🍱\0"
+    "猫头鹰\0" "🦉\0"
+    "打开手\0" "👐\0"
+    "皇冠\0" "👑\0"
+    "模式\0" "📳\0"
+    "表演\0" "🎭\0"
+    "光亮\0" "☀\0"
+    "奶\0" "🍼\0"
+    "浅\0" "🥘\0"
+    "喊嘅脸\0" "😢\0"
+    "盈凸月\0" "🌔\0"
+    "检查\0" "🛂\0"
+    "听\0" "🙉\0"
+    "大厦\0" "🏢\0"
+    "终极\0" "🥏\0"
+    "调味\0" "🧄\0"
+    "扭歪\0" "😼\0"
+    "海狮\0" "🦭\0"
+    "下弦月\0" "🌗\0"
+    "非饮用\0" "🚱\0"
+    "闪电云\0" "🌩\0"
+    "邮政\0" "🏣\0"
+    "扒\0" "🥩\0"
+    "唔吉利\0" "🐈‍⬛\0"
+    "反射镜\0" "🪞\0"
+    "床\0" "🛏\0"
+    "外送盘\0" "📤\0"
+    "馅饼\0" "🫓\0"
+    "水龟\0" "🐢\0"
+    "合埋\0" "😚\0"
+    "大桥\0" "🌉\0"
+    "平底鞋\0" "🥿\0"
+    "开酒塞\0" "🍾\0"
+    "生菜\0" "🥬\0"
+    "铃\0" "🎐\0"
+    "影片\0" "📻\0"
+    "帐篷\0" "⛺\0"
+    "射手座\0" "🏹\0"
+    "新娘\0" "👰\0"
+    "班卓琴\0" "🪕\0"
+    "女士\0" "👠\0"
+    "节奏\0" "🪘\0"
+    "内衣\0" "🩲\0"
+    "剪影\0" "🗣\0"
+    "热狗\0" "🌭\0"
+    "座位\0" "💺\0"
+    "妈妈\0" "🤶\0"
+    "购物车\0" "🛒\0"
+    "万圣节\0" "🎃\0"
+    "蓝色\0" "🫐\0"
+    "球\0" "🤾\0"
+    "热带鱼\0" "🐠\0"
+    "上锁\0" "🔒\0"
+    "白兔\0" "🐰\0"
+    "文件\0" "📃\0"
+    "帐单\0" "💴\0"
+    "培养皿\0" "🧫\0"
+    "鱿鱼\0" "🦑\0"
+    "羊驼\0" "🦙\0"
+    "鼻\0" "🥸\0"
+    "南瓜\0" "🎃\0"
+    "字母\0" "🔠\0"
+    "面具\0" "🥸\0"
+    "方向\0" "⬆\0"
+    "重\0" "🪨\0"
+    "新干线\0" "🚄\0"
+    "胜利\0" "✌\0"
+    "长鼓\0" "🪘\0"
+    "锅\0" "🍲\0"
+    "消防员\0" "🧑‍🚒\0"
+    "叉同刀\0" "🍴\0"
+    "艺人\0" "👨‍🎤\0"
+    "滴汗\0" "💦\0"
+    "双耳瓶\0" "🏺\0"
+    "磁碟\0" "💾\0"
+    "巴士站\0" "🚏\0"
+    "网\0" "🕸\0"
+    "骑师\0" "🏇\0"
+    "老师\0" "🧑‍🏫\0"
+    "亏凸月\0" "🌖\0"
+    "悬架\0" "🚟\0"
+    "无\0" "🈚\0"
+    "自然\0" "😐\0"
+    "饮酒\0" "🍶\0"
+    "咖哩\0" "🍛\0"
+    "晕\0" "🥴\0"
+    "鹰\0" "🦅\0"
+    "冇位\0" "🈵\0"
+    "听筒\0" "🩺\0"
+    "犹太人\0" "✡\0"
+    "疟疾\0" "🦟\0"
+    "毛绒\0" "🧸\0"
+    "粗减号\0" "➖\0"
+    "游水\0" "🏊\0"
+    "炸弹\0" "💣\0"
+    "微笑\0" "🥲\0"
+    "樱花\0" "🌸\0"
+    "较剪\0" "✂\0"
+    "西兰花\0" "🥦\0"
+    "不关心\0" "🤷\0"
+    "桌球\0" "🎱\0"
+    "寿司\0" "🍣\0"
+    "发光\0" "🌟\0"
+    "裁剪\0" "🪡\0"
+    "针筒\0" "💉\0"
+    "踫杯\0" "🍻\0"
+    "马蹄铁\0" "🧲\0"
+    "姿势\0" "🙇\0"
+    "柔道\0" "🥋\0"
+    "质问\0" "🤌\0"
+    "青色\0" "🍏\0"
+    "不\0" "🙈\0"
+    "剃刀\0" "🪒\0"
+    ;
+
+static const EmojiSlot chinese_emoji_slots[] = {
+    { 0, 0, 1 },
+    { 12, 1, 1 },
+    { 24, 2, 1 },
+    { 36, 3, 1 },
+    { 48, 4, 1 },
+    { 60, 5, 1 },
+    { 72, 6, 1 },
+    { 87, 7, 1 },
+    { 96, 8, 1 },
+    { 108, 9, 1 },
+    { 120, 10, 1 },
+    { 132, 11, 1 },
+    { 144, 12, 1 },
+    { 156, 13, 1 },
+    { 168, 14, 1 },
+    { 180, 15, 1 },
+    { 192, 16, 1 },
+    { 204, 17, 1 },
+    { 216, 18, 1 },
+    { 228, 19, 1 },
+    { 243, 20, 1 },
+    { 255, 21, 1 },
+    { 270, 22, 1 },
+    { 282, 23, 1 },
+    { 294, 24, 1 },
+    { 306, 25, 1 },
+    { 318, 26, 1 },
+    { 327, 27, 1 },
+    { 342, 28, 1 },
+    { 354, 29, 1 },
+    { 366, 30, 1 },
+    { 381, 31, 1 },
+    { 400, 32, 1 },
+    { 412, 33, 1 },
+    { 424, 34, 1 },
+    { 436, 35, 1 },
+    { 445, 36, 1 },
+    { 453, 37, 1 },
+    { 465, 38, 1 },
+    { 477, 39, 1 },
+    { 486, 40, 1 },
+    { 498, 41, 1 },
+    { 519, 42, 1 },
+    { 531, 43, 1 },
+    { 542, 44, 1 },
+    { 557, 45, 1 },
+    { 569, 46, 1 },
+    { 581, 47, 1 },
+    { 590, 48, 1 },
+    { 602, 49, 1 },
+    { 616, 50, 1 },
+    { 631, 51, 1 },
+    { 643, 52, 1 },
+    { 658, 53, 1 },
+    { 667, 54, 1 },
+    { 679, 55, 1 },
+    { 691, 56, 1 },
+    { 702, 57, 1 },
+    { 717, 58, 1 },
+    { 726, 59, 1 },
+    { 748, 60, 1 },
+    { 757, 61, 1 },
+    { 769, 62, 1 },
+    { 783, 63, 1 },
+    { 798, 64, 1 },
+    { 813, 65, 1 },
+    { 822, 66, 1 },
+    { 834, 67, 1 },
+    { 846, 68, 1 },
+    { 858, 69, 1 },
+    { 873, 70, 1 },
+    { 885, 71, 1 },
+    { 897, 72, 1 },
+    { 909, 73, 1 },
+    { 920, 74, 1 },
+    { 932, 75, 1 },
+    { 944, 76, 1 },
+    { 959, 77, 1 },
+    { 971, 78, 1 },
+    { 980, 79, 1 },
+    { 989, 80, 1 },
+    { 1004, 81, 1 },
+    { 1019, 82, 1 },
+    { 1030, 83, 1 },
+    { 1045, 84, 1 },
+    { 1057, 85, 1 },
+    { 1069, 86, 1 },
+    { 1081, 87, 1 },
+    { 1093, 88, 1 },
+    { 1105, 89, 1 },
+    { 1117, 90, 1 },
+    { 1126, 91, 1 },
+    { 1138, 92, 1 },
+    { 1152, 93, 1 },
+    { 1167, 94, 1 },
+    { 1186, 95, 1 },
+    { 1198, 96, 1 },
+    { 1210, 97, 1 },
+    { 1219, 98, 1 },
+    { 1231, 99, 1 },
+    { 1243, 100, 1 },
+    { 1252, 101, 1 },
+    { 1267, 102, 1 },
+    { 1279, 103, 1 },
+    { 1291, 104, 1 },
+    { 1303, 105, 1 },
+    { 1313, 106, 1 },
+    { 1325, 107, 1 },
+    { 1337, 108, 1 },
+    { 1349, 109, 1 },
+    { 1364, 110, 1 },
+    { 1379, 111, 1 },
+    { 1391, 112, 1 },
+    { 1403, 113, 1 },
+    { 1415, 114, 1 },
+    { 1427, 115, 1 },
+    { 1439, 116, 1 },
+    { 1451, 117, 1 },
+    { 1463, 118, 1 },
+    { 1475, 119, 1 },
+    { 1490, 120, 1 },
+    { 1499, 121, 1 },
+    { 1511, 122, 1 },
+    { 1526, 123, 1 },
+    { 1538, 124, 1 },
+    { 1553, 125, 1 },
+    { 1565, 126, 1 },
+    { 1580, 127, 1 },
+    { 1592, 128, 1 },
+    { 1607, 129, 1 },
+    { 1622, 130, 1 },
+    { 1634, 131, 1 },
+    { 1643, 132, 1 },
+    { 1655, 133, 1 },
+    { 1666, 134, 1 },
+    { 1678, 135, 1 },
+    { 1690, 136, 1 },
+    { 1702, 137, 1 },
+    { 1711, 138, 1 },
+    { 1722, 139, 1 },
+    { 1730, 140, 1 },
+    { 1742, 141, 1 },
+    { 1754, 142, 1 },
+    { 1763, 143, 1 },
+    { 1775, 144, 1 },
+    { 1787, 145, 1 },
+    { 1796, 146, 1 },
+    { 1807, 147, 1 },
+    { 1828, 148, 1 },
+    { 1840, 149, 1 },
+    { 1855, 150, 1 },
+    { 1863, 151, 1 },
+    { 1875, 152, 1 },
+    { 1887, 153, 1 },
+    { 1902, 154, 1 },
+    { 1914, 155, 1 },
+    { 1926, 156, 1 },
+    { 1935, 157, 1 },
+    { 1950, 158, 1 },
+    { 1965, 159, 1 },
+    { 1977, 160, 1 },
+    { 1989, 161, 1 },
+    { 1998, 162, 1 },
+    { 2010, 163, 1 },
+    { 2022, 164, 1 },
+    { 2034, 165, 1 },
+    { 2046, 166, 1 },
+    { 2058, 167, 1 },
+    { 2067, 168, 1 },
+    { 2076, 169, 1 },
+    { 2085, 170, 1 },
+    { 2094, 171, 1 },
+    { 2106, 172, 1 },
+    { 2121, 173, 1 },
+    { 2133, 174, 1 },
+    { 2141, 175, 1 },
+    { 2156, 176, 1 },
+    { 2171, 177, 1 },
+    { 2182, 178, 1 },
+    { 2197, 179, 1 },
+    { 2209, 180, 1 },
+    { 2224, 181, 1 },
+    { 2236, 182, 1 },
+    { 2248, 183, 1 },
+    { 2260, 184, 1 },
+    { 2275, 185, 1 },
+    { 2284, 186, 1 },
+    { 2299, 187, 1 },
+    { 2308, 188, 1 },
+    { 2323, 189, 1 },
+    { 2335, 190, 1 },
+    { 2350, 191, 1 },
+    { 2365, 192, 1 },
+    { 2376, 193, 1 },
+    { 2388, 194, 1 },
+    { 2400, 195, 1 },
+    { 2412, 196, 1 },
+    { 2424, 197, 1 },
+    { 2435, 198, 1 },
+    { 2447, 199, 1 },
+    { 2455, 200, 1 },
+    { 2466, 201, 1 },
+    { 2478, 202, 1 },
+    { 2490, 203, 1 },
+    { 2502, 204, 1 },
+    { 2517, 205, 1 },
+    { 2535, 206, 1 },
+    { 2550, 207, 1 },
+    { 2559, 208, 1 },
+    { 2568, 209, 1 },
+    { 2580, 210, 1 },
+    { 2592, 211, 1 },
+    { 2607, 212, 1 },
+    { 2619, 213, 1 },
+    { 2634, 214, 1 },
+    { 2646, 215, 1 },
+    { 2657, 216, 1 },
+    { 2669, 217, 1 },
+    { 2681, 218, 1 },
+    { 2693, 219, 1 },
+    { 2705, 220, 1 },
+    { 2717, 221, 1 },
+    { 2729, 222, 1 },
+    { 2748, 223, 1 },
+    { 2760, 224, 1 },
+    { 2769, 225, 1 },
+    { 2781, 226, 1 },
+    { 2793, 227, 1 },
+    { 2802, 228, 1 },
+    { 2814, 229, 1 },
+    { 2826, 230, 1 },
+    { 2834, 231, 1 },
+    { 2849, 232, 1 },
+    { 2861, 233, 1 },
+    { 2876, 234, 1 },
+    { 2891, 235, 1 },
+    { 2903, 236, 1 },
+    { 2922, 237, 1 },
+    { 2934, 238, 1 },
+    { 2949, 239, 1 },
+    { 2961, 240, 1 },
+    { 2970, 241, 1 },
+    { 2982, 242, 1 },
+    { 3003, 243, 1 },
+    { 3015, 244, 1 },
+    { 3024, 245, 1 },
+    { 3036, 246, 1 },
+    { 3048, 247, 1 },
+    { 3060, 248, 1 },
+    { 3069, 249, 1 },
+    { 3080, 250, 1 },
+    { 3095, 251, 1 },
+    { 3107, 252, 1 },
+    { 3119, 253, 1 },
+    { 3128, 254, 1 },
+    { 3140, 255, 1 },
+    { 3152, 256, 1 },
+    { 3171, 257, 1 },
+    { 3186, 258, 1 },
+    { 3198, 259, 1 },
+    { 3210, 260, 1 },
+    { 3222, 261, 1 },
+    { 3237, 262, 1 },
+    { 3256, 263, 1 },
+    { 3268, 264, 1 },
+    { 3280, 265, 1 },
+    { 3289, 266, 1 },
+    { 3301, 267, 1 },
+    { 3313, 268, 1 },
+    { 3322, 269, 1 },
+    { 3334, 270, 1 },
+    { 3346, 271, 1 },
+    { 3358, 272, 1 },
+    { 3370, 273, 1 },
+    { 3382, 274, 1 },
+    { 3397, 275, 1 },
+    { 3409, 276, 1 },
+    { 3424, 277, 1 },
+    { 3436, 278, 1 },
+    { 3451, 279, 1 },
+    { 3463, 280, 1 },
+    { 3475, 281, 1 },
+    { 3484, 282, 1 },
+    { 3499, 283, 1 },
+    { 3518, 284, 1 },
+    { 3530, 285, 1 },
+    { 3539, 286, 1 },
+    { 3554, 287, 1 },
+    { 3566, 288, 1 },
+    { 3587, 289, 1 },
+    { 3598, 290, 1 },
+    { 3610, 291, 1 },
+    { 3625, 292, 1 },
+    { 3634, 293, 1 },
+    { 3649, 294, 1 },
+    { 3663, 295, 1 },
+    { 3672, 296, 1 },
+    { 3694, 297, 1 },
+    { 3703, 298, 1 },
+    { 3718, 299, 1 },
+    { 3730, 300, 1 },
+    { 3739, 301, 1 },
+    { 3751, 302, 1 },
+    { 3762, 303, 1 },
+    { 3774, 304, 1 },
+    { 3786, 305, 1 },
+    { 3801, 306, 1 },
+    { 3810, 307, 1 },
+    { 3819, 308, 1 },
+    { 3830, 309, 1 },
+    { 3842, 310, 1 },
+    { 3854, 311, 1 },
+    { 3865, 312, 1 },
+    { 3877, 313, 1 },
+    { 3889, 314, 1 },
+    { 3901, 315, 1 },
+    { 3913, 316, 1 },
+    { 3925, 317, 1 },
+    { 3940, 318, 1 },
+    { 3955, 319, 1 },
+    { 3976, 320, 1 },
+    { 3988, 321, 1 },
+    { 4000, 322, 1 },
+    { 4012, 323, 1 },
+    { 4024, 324, 1 },
+    { 4036, 325, 1 },
+    { 4055, 326, 1 },
+    { 4067, 327, 1 },
+    { 4079, 328, 1 },
+    { 4088, 329, 1 },
+    { 4103, 330, 1 },
+    { 4115, 331, 1 },
+    { 4124, 332, 1 },
+    { 4136, 333, 1 },
+    { 4145, 334, 1 },
+    { 4154, 335, 1 },
+    { 4175, 336, 1 },
+    { 4187, 337, 1 },
+    { 4202, 338, 1 },
+    { 4214, 339, 1 },
+    { 4222, 340, 1 },
+    { 4237, 341, 1 },
+    { 4249, 342, 1 },
+    { 4261, 343, 1 },
+    { 4273, 344, 1 },
+    { 4282, 345, 1 },
+    { 4294, 346, 1 },
+    { 4306, 347, 1 },
+    { 4318, 348, 1 },
+    { 4330, 349, 1 },
+    { 4339, 350, 1 },
+    { 4348, 351, 1 },
+    { 4360, 352, 1 },
+    { 4372, 353, 1 },
+    { 4387, 354, 1 },
+    { 4399, 355, 1 },
+    { 4411, 356, 1 },
+    { 4423, 357, 1 },
+    { 4432, 358, 1 },
+    { 4444, 359, 1 },
+    { 4453, 360, 1 },
+    { 4464, 361, 1 },
+    { 4479, 362, 1 },
+    { 4491, 363, 1 },
+    { 4500, 364, 1 },
+    { 4512, 365, 1 },
+    { 4521, 366, 1 },
+    { 4530, 367, 1 },
+    { 4545, 368, 1 },
+    { 4557, 369, 1 },
+    { 4569, 370, 1 },
+    { 4581, 371, 1 },
+    { 4590, 372, 1 },
+    { 4605, 373, 1 },
+    { 4616, 374, 1 },
+    { 4637, 375, 1 },
+    { 4649, 376, 1 },
+    { 4661, 377, 1 },
+    { 4683, 378, 1 },
+    { 4692, 379, 1 },
+    { 4707, 380, 1 },
+    { 4719, 381, 1 },
+    { 4728, 382, 1 },
+    { 4740, 383, 1 },
+    { 4749, 384, 1 },
+    { 4758, 385, 1 },
+    { 4770, 386, 1 },
+    { 4782, 387, 1 },
+    { 4794, 388, 1 },
+    { 4806, 389, 1 },
+    { 4818, 390, 1 },
+    { 4829, 391, 1 },
+    { 4841, 392, 1 },
+    { 4853, 393, 1 },
+    { 4865, 394, 1 },
+    { 4877, 395, 1 },
+    { 4892, 396, 1 },
+    { 4904, 397, 1 },
+    { 4915, 398, 1 },
+    { 4927, 399, 1 },
+    { 4941, 400, 1 },
+    { 4956, 401, 1 },
+    { 4968, 402, 1 },
+    { 4976, 403, 1 },
+    { 4988, 404, 1 },
+    { 4997, 405, 1 },
+    { 5009, 406, 1 },
+    { 5021, 407, 1 },
+    { 5033, 408, 1 },
+    { 5045, 409, 1 },
+    { 5060, 410, 1 },
+    { 5072, 411, 1 },
+    { 5087, 412, 1 },
+    { 5099, 413, 1 },
+    { 5111, 414, 1 },
+    { 5120, 415, 1 },
+    { 5132, 416, 1 },
+    { 5147, 417, 1 },
+    { 5162, 418, 1 },
+    { 5177, 419, 1 },
+    { 5186, 420, 1 },
+    { 5198, 421, 1 },
+    { 5210, 422, 1 },
+    { 5225, 423, 1 },
+    { 5237, 424, 1 },
+    { 5249, 425, 1 },
+    { 5260, 426, 1 },
+    { 5269, 427, 1 },
+    { 5281, 428, 1 },
+    { 5290, 429, 1 },
+    { 5302, 430, 1 },
+    { 5317, 431, 1 },
+    { 5326, 432, 1 },
+    { 5338, 433, 1 },
+    { 5350, 434, 1 },
+    { 5365, 435, 1 },
+    { 5377, 436, 1 },
+    { 5386, 437, 1 },
+    { 5401, 438, 1 },
+    { 5413, 439, 1 },
+    { 5425, 440, 1 },
+    { 5440, 441, 1 },
+    { 5455, 442, 1 },
+    { 5467, 443, 1 },
+    { 5476, 444, 1 },
+    { 5488, 445, 1 },
+    { 5500, 446, 1 },
+    { 5512, 447, 1 },
+    { 5521, 448, 1 },
+    { 5533, 449, 1 },
+    { 5545, 450, 1 },
+    { 5557, 451, 1 },
+    { 5566, 452, 1 },
+    { 5581, 453, 1 },
+    { 5590, 454, 1 },
+    { 5605, 455, 1 },
+    { 5614, 456, 1 },
+    { 5622, 457, 1 },
+    { 5631, 458, 1 },
+    { 5643, 459, 1 },
+    { 5669, 460, 1 },
+    { 5681, 461, 1 },
+    { 5700, 462, 1 },
+    { 5721, 463, 1 },
+    { 5733, 464, 1 },
+    { 5744, 465, 1 },
+    { 5756, 466, 1 },
+    { 5768, 467, 1 },
+    { 5780, 468, 1 },
+    { 5792, 469, 1 },
+    { 5804, 470, 1 },
+    { 5819, 471, 1 },
+    { 5834, 472, 1 },
+    { 5846, 473, 1 },
+    { 5855, 474, 1 },
+    { 5864, 475, 1 },
+    { 5875, 476, 1 },
+    { 5890, 477, 1 },
+    { 5902, 478, 1 },
+    { 5914, 479, 1 },
+    { 5923, 480, 1 },
+    { 5935, 481, 1 },
+    { 5944, 482, 1 },
+    { 5956, 483, 1 },
+    { 5968, 484, 1 },
+    { 5983, 485, 1 },
+    { 5995, 486, 1 },
+    { 6007, 487, 1 },
+    { 6022, 488, 1 },
+    { 6034, 489, 1 },
+    { 6049, 490, 1 },
+    { 6061, 491, 1 },
+    { 6076, 492, 1 },
+    { 6088, 493, 1 },
+    { 6100, 494, 1 },
+    { 6112, 495, 1 },
+    { 6124, 496, 1 },
+    { 6136, 497, 1 },
+    { 6151, 498, 1 },
+    { 6170, 499, 1 },
+    { 6182, 500, 1 },
+    { 6191, 501, 1 },
+    { 6206, 502, 1 },
+    { 6218, 503, 1 },
+    { 6237, 504, 1 },
+    { 6252, 505, 1 },
+    { 6267, 506, 1 },
+    { 6282, 507, 1 },
+    { 6294, 508, 1 },
+    { 6306, 509, 1 },
+    { 6318, 510, 1 },
+    { 6330, 511, 1 },
+    { 6342, 512, 1 },
+    { 6354, 513, 1 },
+    { 6369, 514, 1 },
+    { 6381, 515, 1 },
+    { 6393, 516, 1 },
+    { 6402, 517, 1 },
+    { 6417, 518, 1 },
+    { 6429, 519, 1 },
+    { 6441, 520, 1 },
+    { 6453, 521, 1 },
+    { 6465, 522, 1 },
+    { 6477, 523, 1 },
+    { 6489, 524, 1 },
+    { 6501, 525, 1 },
+    { 6513, 526, 1 },
+    { 6522, 527, 1 },
+    { 6534, 528, 1 },
+    { 6549, 529, 1 },
+    { 6564, 530, 1 },
+    { 6576, 531, 1 },
+    { 6588, 532, 1 },
+    { 6600, 533, 1 },
+    { 6612, 534, 1 },
+    { 6627, 535, 1 },
+    { 6642, 536, 1 },
+    { 6654, 537, 1 },
+    { 6669, 538, 1 },
+    { 6688, 539, 1 },
+    { 6700, 540, 1 },
+    { 6712, 541, 1 },
+    { 6724, 542, 1 },
+    { 6736, 543, 1 },
+    { 6745, 544, 1 },
+    { 6756, 545, 1 },
+    { 6765, 546, 1 },
+    { 6777, 547, 1 },
+    { 6789, 548, 1 },
+    { 6801, 549, 1 },
+    { 6813, 550, 1 },
+    { 6822, 551, 1 },
+    { 6833, 552, 1 },
+    { 6845, 553, 1 },
+    { 6857, 554, 1 },
+    { 6869, 555, 1 },
+    { 6881, 556, 1 },
+    { 6893, 557, 1 },
+    { 6905, 558, 1 },
+    { 6920, 559, 1 },
+    { 6932, 560, 1 },
+    { 6947, 561, 1 },
+    { 6959, 562, 1 },
+    { 6968, 563, 1 },
+    { 6980, 564, 1 },
+    { 6988, 565, 1 },
+    { 7003, 566, 1 },
+    { 7015, 567, 1 },
+    { 7033, 568, 1 },
+    { 7048, 569, 1 },
+    { 7057, 570, 1 },
+    { 7066, 571, 1 },
+    { 7081, 572, 1 },
+    { 7095, 573, 1 },
+    { 7107, 574, 1 },
+    { 7119, 575, 1 },
+    { 7133, 576, 1 },
+    { 7142, 577, 1 },
+    { 7154, 578, 1 },
+    { 7169, 579, 1 },
+    { 7184, 580, 1 },
+    { 7196, 581, 1 },
+    { 7218, 582, 1 },
+    { 7233, 583, 1 },
+    { 7242, 584, 1 },
+    { 7250, 585, 1 },
+    { 7265, 586, 1 },
+    { 7280, 587, 1 },
+    { 7295, 588, 1 },
+    { 7306, 589, 1 },
+    { 7318, 590, 1 },
+    { 7330, 591, 1 },
+    { 7339, 592, 1 },
+    { 7351, 593, 1 },
+    { 7363, 594, 1 },
+    { 7384, 595, 1 },
+    { 7396, 596, 1 },
+    { 7408, 597, 1 },
+    { 7417, 598, 1 },
+    { 7426, 599, 1 },
+    { 7438, 600, 1 },
+    { 7450, 601, 1 },
+    { 7461, 602, 1 },
+    { 7473, 603, 1 },
+    { 7488, 604, 1 },
+    { 7500, 605, 1 },
+    { 7512, 606, 1 },
+    { 7523, 607, 1 },
+    { 7535, 608, 1 },
+    { 7546, 609, 1 },
+    { 7555, 610, 1 },
+    { 7564, 611, 1 },
+    { 7579, 612, 1 },
+    { 7588, 613, 1 },
+    { 7603, 614, 1 },
+    { 7614, 615, 1 },
+    { 7626, 616, 1 },
+    { 7638, 617, 1 },
+    { 7650, 618, 1 },
+    { 7662, 619, 1 },
+    { 7674, 620, 1 },
+    { 7686, 621, 1 },
+    { 7698, 622, 1 },
+    { 7710, 623, 1 },
+    { 7722, 624, 1 },
+    { 7733, 625, 1 },
+    { 7745, 626, 1 },
+    { 7754, 627, 1 },
+    { 7769, 628, 1 },
+    { 7781, 629, 1 },
+    { 7796, 630, 1 },
+    { 7808, 631, 1 },
+    { 7823, 632, 1 },
+    { 7838, 633, 1 },
+    { 7847, 634, 1 },
+    { 7859, 635, 1 },
+    { 7871, 636, 1 },
+    { 7886, 637, 1 },
+    { 7901, 638, 1 },
+    { 7913, 639, 1 },
+    { 7925, 640, 1 },
+    { 7940, 641, 1 },
+    { 7952, 642, 1 },
+    { 7960, 643, 1 },
+    { 7978, 644, 1 },
+    { 7990, 645, 1 },
+    { 7999, 646, 1 },
+    { 8011, 647, 1 },
+    { 8026, 648, 1 },
+    { 8038, 649, 1 },
+    { 8052, 650, 1 },
+    { 8064, 651, 1 },
+    { 8076, 652, 1 },
+    { 8091, 653, 1 },
+    { 8103, 654, 1 },
+    { 8115, 655, 1 },
+    { 8130, 656, 1 },
+    { 8142, 657, 1 },
+    { 8157, 658, 1 },
+    { 8169, 659, 1 },
+    { 8181, 660, 1 },
+    { 8190, 661, 1 },
+    { 8205, 662, 1 },
+    { 8220, 663, 1 },
+    { 8234, 664, 1 },
+    { 8246, 665, 1 },
+    { 8261, 666, 1 },
+    { 8273, 667, 1 },
+    { 8285, 668, 1 },
+    { 8300, 669, 1 },
+    { 8312, 670, 1 },
+    { 8323, 671, 1 },
+    { 8335, 672, 1 },
+    { 8347, 673, 1 },
+    { 8358, 674, 1 },
+    { 8370, 675, 1 },
+    { 8381, 676, 1 },
+    { 8396, 677, 1 },
+    { 8408, 678, 1 },
+    { 8420, 679, 1 },
+    { 8435, 680, 1 },
+    { 8447, 681, 1 },
+    { 8459, 682, 1 },
+    { 8471, 683, 1 },
+    { 8483, 684, 1 },
+    { 8495, 685, 1 },
+    { 8514, 686, 1 },
+    { 8523, 687, 1 },
+    { 8532, 688, 1 },
+    { 8544, 689, 1 },
+    { 8556, 690, 1 },
+    { 8571, 691, 1 },
+    { 8580, 692, 1 },
+    { 8592, 693, 1 },
+    { 8604, 694, 1 },
+    { 8616, 695, 1 },
+    { 8625, 696, 1 },
+    { 8640, 697, 1 },
+    { 8655, 698, 1 },
+    { 8674, 699, 1 },
+    { 8683, 700, 1 },
+    { 8695, 701, 1 },
+    { 8707, 702, 1 },
+    { 8719, 703, 1 },
+    { 8731, 704, 1 },
+    { 8743, 705, 1 },
+    { 8752, 706, 1 },
+    { 8761, 707, 1 },
+    { 8773, 708, 1 },
+    { 8785, 709, 1 },
+    { 8794, 710, 1 },
+    { 8806, 711, 1 },
+    { 8818, 712, 1 },
+    { 8830, 713, 1 },
+    { 8842, 714, 1 },
+    { 8853, 715, 1 },
+    { 8864, 716, 1 },
+    { 8879, 717, 1 },
+    { 8891, 718, 1 },
+    { 8900, 719, 1 },
+    { 8922, 720, 1 },
+    { 8934, 721, 1 },
+    { 8946, 722, 1 },
+    { 8958, 723, 1 },
+    { 8973, 724, 1 },
+    { 8985, 725, 1 },
+    { 8997, 726, 1 },
+    { 9009, 727, 1 },
+    { 9024, 728, 1 },
+    { 9039, 729, 1 },
+    { 9054, 730, 1 },
+    { 9066, 731, 1 },
+    { 9075, 732, 1 },
+    { 9083, 733, 1 },
+    { 9098, 734, 1 },
+    { 9110, 735, 1 },
+    { 9124, 736, 1 },
+    { 9135, 737, 1 },
+    { 9147, 738, 1 },
+    { 9156, 739, 1 },
+    { 9168, 740, 1 },
+    { 9180, 741, 1 },
+    { 9192, 742, 1 },
+    { 9207, 743, 1 },
+    { 9222, 744, 1 },
+    { 9237, 745, 1 },
+    { 9249, 746, 1 },
+    { 9261, 747, 1 },
+    { 9273, 748, 1 },
+    { 9285, 749, 1 },
+    { 9297, 750, 1 },
+    { 9309, 751, 1 },
+    { 9318, 752, 1 },
+    { 9333, 753, 1 },
+    { 9341, 754, 1 },
+    { 9350, 755, 1 },
+    { 9362, 756, 1 },
+    { 9384, 757, 1 },
+    { 9396, 758, 1 },
+    { 9408, 759, 1 },
+    { 9420, 760, 1 },
+    { 9435, 761, 1 },
+    { 9447, 762, 1 },
+    { 9459, 763, 1 },
+    { 9474, 764, 1 },
+    { 9486, 765, 1 },
+    { 9498, 766, 1 },
+    { 9510, 767, 1 },
+    { 9522, 768, 1 },
+    { 9541, 769, 1 },
+    { 9552, 770, 1 },
+    { 9567, 771, 1 },
+    { 9579, 772, 1 },
+    { 9591, 773, 1 },
+    { 9603, 774, 1 },
+    { 9615, 775, 1 },
+    { 9627, 776, 1 },
+    { 9642, 777, 1 },
+    { 9651, 778, 1 },
+    { 9663, 779, 1 },
+    { 9675, 780, 1 },
+    { 9684, 781, 1 },
+    { 9696, 782, 1 },
+    { 9708, 783, 1 },
+    { 9720, 784, 1 },
+    { 9732, 785, 1 },
+    { 9754, 786, 1 },
+    { 9766, 787, 1 },
+    { 9778, 788, 1 },
+    { 9800, 789, 1 },
+    { 9812, 790, 1 },
+    { 9827, 791, 1 },
+    { 9839, 792, 1 },
+    { 9851, 793, 1 },
+    { 9863, 794, 1 },
+    { 9872, 795, 1 },
+    { 9884, 796, 1 },
+    { 9893, 797, 1 },
+    { 9905, 798, 1 },
+    { 9920, 799, 1 },
+    { 9935, 800, 1 },
+    { 9944, 801, 1 },
+    { 9955, 802, 1 },
+    { 9967, 803, 1 },
+    { 9979, 804, 1 },
+    { 9994, 805, 1 },
+    { 10006, 806, 1 },
+    { 10024, 807, 1 },
+    { 10033, 808, 1 },
+    { 10048, 809, 1 },
+    { 10070, 810, 1 },
+    { 10079, 811, 1 },
+    { 10091, 812, 1 },
+    { 10103, 813, 1 },
+    { 10118, 814, 1 },
+    { 10127, 815, 1 },
+    { 10139, 816, 1 },
+    { 10151, 817, 1 },
+    { 10170, 818, 1 },
+    { 10182, 819, 1 },
+    { 10197, 820, 1 },
+    { 10208, 821, 1 },
+    { 10220, 822, 1 },
+    { 10229, 823, 1 },
+    { 10241, 824, 1 },
+    { 10253, 825, 1 },
+    { 10265, 826, 1 },
+    { 10277, 827, 1 },
+    { 10292, 828, 1 },
+    { 10304, 829, 1 },
+    { 10316, 830, 1 },
+    { 10328, 831, 1 },
+    { 10340, 832, 1 },
+    { 10348, 833, 1 },
+    { 10360, 834, 1 },
+    { 10372, 835, 1 },
+    { 10381, 836, 1 },
+    { 10393, 837, 1 },
+    { 10405, 838, 1 },
+    { 10417, 839, 1 },
+    { 10436, 840, 1 },
+    { 10447, 841, 1 },
+    { 10459, 842, 1 },
+    { 10468, 843, 1 },
+    { 10476, 844, 1 },
+    { 10488, 845, 1 },
+    { 10500, 846, 1 },
+    { 10512, 847, 1 },
+    { 10524, 848, 1 },
+    { 10539, 849, 1 },
+    { 10551, 850, 1 },
+    { 10563, 851, 1 },
+    { 10574, 852, 1 },
+    { 10589, 853, 1 },
+    { 10604, 854, 1 },
+    { 10619, 855, 1 },
+    { 10631, 856, 1 },
+    { 10640, 857, 1 },
+    { 10652, 858, 1 },
+    { 10664, 859, 1 },
+    { 10676, 860, 1 },
+    { 10691, 861, 1 },
+    { 10703, 862, 1 },
+    { 10718, 863, 1 },
+    { 10730, 864, 1 },
+    { 10742, 865, 1 },
+    { 10754, 866, 1 },
+    { 10776, 867, 1 },
+    { 10788, 868, 1 },
+    { 10796, 869, 1 },
+    { 10811, 870, 1 },
+    { 10820, 871, 1 },
+    { 10832, 872, 1 },
+    { 10844, 873, 1 },
+    { 10859, 874, 1 },
+    { 10874, 875, 1 },
+    { 10886, 876, 1 },
+    { 10898, 877, 1 },
+    { 10910, 878, 1 },
+    { 10921, 879, 1 },
+    { 10936, 880, 1 },
+    { 10948, 881, 1 },
+    { 10963, 882, 1 },
+    { 10972, 883, 1 },
+    { 10984, 884, 1 },
+    { 10996, 885, 1 },
+    { 11008, 886, 1 },
+    { 11017, 887, 1 },
+    { 11032, 888, 1 },
+    { 11041, 889, 1 },
+    { 11050, 890, 1 },
+    { 11059, 891, 1 },
+    { 11068, 892, 1 },
+    { 11080, 893, 1 },
+    { 11089, 894, 1 },
+    { 11101, 895, 1 },
+    { 11116, 896, 1 },
+    { 11128, 897, 1 },
+    { 11140, 898, 1 },
+    { 11162, 899, 1 },
+    { 11174, 900, 1 },
+    { 11186, 901, 1 },
+    { 11201, 902, 1 },
+    { 11213, 903, 1 },
+    { 11225, 904, 1 },
+    { 11237, 905, 1 },
+    { 11249, 906, 1 },
+    { 11271, 907, 1 },
+    { 11282, 908, 1 },
+    { 11294, 909, 1 },
+    { 11303, 910, 1 },
+    { 11318, 911, 1 },
+    { 11333, 912, 1 },
+    { 11348, 913, 1 },
+    { 11363, 914, 1 },
+    { 11374, 915, 1 },
+    { 11389, 916, 1 },
+    { 11410, 917, 1 },
+    { 11422, 918, 1 },
+    { 11434, 919, 1 },
+    { 11449, 920, 1 },
+    { 11461, 921, 1 },
+    { 11470, 922, 1 },
+    { 11482, 923, 1 },
+    { 11494, 924, 1 },
+    { 11503, 925, 1 },
+    { 11515, 926, 1 },
+    { 11530, 927, 1 },
+    { 11542, 928, 1 },
+    { 11554, 929, 1 },
+    { 11566, 930, 1 },
+    { 11575, 931, 1 },
+    { 11587, 932, 1 },
+    { 11599, 933, 1 },
+    { 11611, 934, 1 },
+    { 11620, 935, 1 },
+    { 11635, 936, 1 },
+    { 11650, 937, 1 },
+    { 11662, 938, 1 },
+    { 11671, 939, 1 },
+    { 11683, 940, 1 },
+    { 11695, 941, 1 },
+    { 11707, 942, 1 },
+    { 11719, 943, 1 },
+    { 11731, 944, 1 },
+    { 11740, 945, 1 },
+    { 11752, 946, 1 },
+    { 11763, 947, 1 },
+    { 11774, 948, 1 },
+    { 11793, 949, 1 },
+    { 11805, 950, 1 },
+    { 11817, 951, 1 },
+    { 11829, 952, 1 },
+    { 11841, 953, 1 },
+    { 11853, 954, 1 },
+    { 11862, 955, 1 },
+    { 11874, 956, 1 },
+    { 11886, 957, 1 },
+    { 11895, 958, 1 },
+    { 11910, 959, 1 },
+    { 11925, 960, 1 },
+    { 11937, 961, 1 },
+    { 11949, 962, 1 },
+    { 11961, 963, 1 },
+    { 11983, 964, 1 },
+    { 11995, 965, 1 },
+    { 12007, 966, 1 },
+    { 12016, 967, 1 },
+    { 12028, 968, 1 },
+    { 12040, 969, 1 },
+    { 12049, 970, 1 },
+    { 12068, 971, 1 },
+    { 12083, 972, 1 },
+    { 12098, 973, 1 },
+    { 12110, 974, 1 },
+    { 12122, 975, 1 },
+    { 12134, 976, 1 },
+    { 12153, 977, 1 },
+    { 12165, 978, 1 },
+    { 12177, 979, 1 },
+    { 12189, 980, 1 },
+    { 12201, 981, 1 },
+    { 12213, 982, 1 },
+    { 12224, 983, 1 },
+    { 12232, 984, 1 },
+    { 12241, 985, 1 },
+    { 12256, 986, 1 },
+    { 12271, 987, 1 },
+    { 12283, 988, 1 },
+    { 12298, 989, 1 },
+    { 12307, 990, 1 },
+    { 12322, 991, 1 },
+    { 12333, 992, 1 },
+    { 12342, 993, 1 },
+    { 12363, 994, 1 },
+    { 12375, 995, 1 },
+    { 12387, 996, 1 },
+    { 12399, 997, 1 },
+    { 12414, 998, 1 },
+    { 12429, 999, 1 },
+    { 12441, 1000, 1 },
+    { 12453, 1001, 1 },
+    { 12462, 1002, 1 },
+    { 12474, 1003, 1 },
+    { 12486, 1004, 1 },
+    { 12498, 1005, 1 },
+    { 12513, 1006, 1 },
+    { 12525, 1007, 1 },
+    { 12547, 1008, 1 },
+    { 12559, 1009, 1 },
+    { 12568, 1010, 1 },
+    { 12583, 1011, 1 },
+    { 12595, 1012, 1 },
+    { 12607, 1013, 1 },
+    { 12619, 1014, 1 },
+    { 12634, 1015, 1 },
+    { 12649, 1016, 1 },
+    { 12658, 1017, 1 },
+    { 12670, 1018, 1 },
+    { 12682, 1019, 1 },
+    { 12694, 1020, 1 },
+    { 12703, 1021, 1 },
+    { 12715, 1022, 1 },
+    { 12727, 1023, 1 },
+    { 12736, 1024, 1 },
+    { 12745, 1025, 1 },
+    { 12766, 1026, 1 },
+    { 12787, 1027, 1 },
+    { 12799, 1028, 1 },
+    { 12810, 1029, 1 },
+    { 12821, 1030, 1 },
+    { 12833, 1031, 1 },
+    { 12845, 1032, 1 },
+    { 12857, 1033, 1 },
+    { 12869, 1034, 1 },
+    { 12881, 1035, 1 },
+    { 12893, 1036, 1 },
+    { 12905, 1037, 1 },
+    { 12920, 1038, 1 },
+    { 12939, 1039, 1 },
+    { 12954, 1040, 1 },
+    { 12969, 1041, 1 },
+    { 12978, 1042, 1 },
+    { 12993, 1043, 1 },
+    { 13004, 1044, 1 },
+    { 13019, 1045, 1 },
+    { 13031, 1046, 1 },
+    { 13046, 1047, 1 },
+    { 13058, 1048, 1 },
+    { 13070, 1049, 1 },
+    { 13085, 1050, 1 },
+    { 13094, 1051, 1 },
+    { 13103, 1052, 1 },
+    { 13115, 1053, 1 },
+    { 13130, 1054, 1 },
+    { 13139, 1055, 1 },
+    { 13151, 1056, 1 },
+    { 13163, 1057, 1 },
+    { 13175, 1058, 1 },
+    { 13184, 1059, 1 },
+    { 13196, 1060, 1 },
+    { 13208, 1061, 1 },
+    { 13220, 1062, 1 },
+    { 13232, 1063, 1 },
+    { 13244, 1064, 1 },
+    { 13253, 1065, 1 },
+    { 13262, 1066, 1 },
+    { 13277, 1067, 1 },
+    { 13286, 1068, 1 },
+    { 13298, 1069, 1 },
+    { 13314, 1070, 1 },
+    { 13323, 1071, 1 },
+    { 13332, 1072, 1 },
+    { 13344, 1073, 1 },
+    { 13356, 1074, 1 },
+    { 13368, 1075, 1 },
+    { 13380, 1076, 1 },
+    { 13392, 1077, 1 },
+    { 13406, 1078, 1 },
+    { 13421, 1079, 1 },
+    { 13433, 1080, 1 },
+    { 13448, 1081, 1 },
+    { 13457, 1082, 1 },
+    { 13469, 1083, 1 },
+    { 13478, 1084, 1 },
+    { 13487, 1085, 1 },
+    { 13499, 1086, 1 },
+    { 13511, 1087, 1 },
+    { 13523, 1088, 1 },
+    { 13535, 1089, 1 },
+    { 13550, 1090, 1 },
+    { 13562, 1091, 1 },
+    { 13577, 1092, 1 },
+    { 13592, 1093, 1 },
+    { 13604, 1094, 1 },
+    { 13616, 1095, 1 },
+    { 13628, 1096, 1 },
+    { 13643, 1097, 1 },
+    { 13662, 1098, 1 },
+    { 13674, 1099, 1 },
+    { 13686, 1100, 1 },
+    { 13695, 1101, 1 },
+    { 13704, 1102, 1 },
+    { 13716, 1103, 1 },
+    { 13725, 1104, 1 },
+    { 13739, 1105, 1 },
+    { 13751, 1106, 1 },
+    { 13762, 1107, 1 },
+    { 13777, 1108, 1 },
+    { 13789, 1109, 1 },
+    { 13810, 1110, 1 },
+    { 13821, 1111, 1 },
+    { 13829, 1112, 1 },
+    { 13844, 1113, 1 },
+    { 13856, 1114, 1 },
+    { 13868, 1115, 1 },
+    { 13880, 1116, 1 },
+    { 13895, 1117, 1 },
+    { 13910, 1118, 1 },
+    { 13919, 1119, 1 },
+    { 13931, 1120, 1 },
+    { 13943, 1121, 1 },
+    { 13958, 1122, 1 },
+    { 13973, 1123, 1 },
+    { 13988, 1124, 1 },
+    { 14000, 1125, 1 },
+    { 14012, 1126, 1 },
+    { 14021, 1127, 1 },
+    { 14033, 1128, 1 },
+    { 14045, 1129, 1 },
+    { 14060, 1130, 1 },
+    { 14072, 1131, 1 },
+    { 14081, 1132, 1 },
+    { 14093, 1133, 1 },
+    { 14111, 1134, 1 },
+    { 14123, 1135, 1 },
+    { 14135, 1136, 1 },
+    { 14147, 1137, 1 },
+    { 14162, 1138, 1 },
+    { 14174, 1139, 1 },
+    { 14186, 1140, 1 },
+    { 14195, 1141, 1 },
+    { 14207, 1142, 1 },
+    { 14219, 1143, 1 },
+    { 14231, 1144, 1 },
+    { 14245, 1145, 1 },
+    { 14257, 1146, 1 },
+    { 14266, 1147, 1 },
+    { 14275, 1148, 1 },
+    { 14290, 1149, 1 },
+    { 14302, 1150, 1 },
+    { 14314, 1151, 1 },
+    { 14329, 1152, 1 },
+    { 14351, 1153, 1 },
+    { 14366, 1154, 1 },
+    { 14378, 1155, 1 },
+    { 14387, 1156, 1 },
+    { 14401, 1157, 1 },
+    { 14413, 1158, 1 },
+    { 14425, 1159, 1 },
+    { 14437, 1160, 1 },
+    { 14452, 1161, 1 },
+    { 14464, 1162, 1 },
+    { 14476, 1163, 1 },
+    { 14488, 1164, 1 },
+    { 14500, 1165, 1 },
+    { 14515, 1166, 1 },
+    { 14526, 1167, 1 },
+    { 14538, 1168, 1 },
+    { 14549, 1169, 1 },
+    { 14558, 1170, 1 },
+    { 14570, 1171, 1 },
+    { 14582, 1172, 1 },
+    { 14591, 1173, 1 },
+    { 14605, 1174, 1 },
+    { 14617, 1175, 1 },
+    { 14629, 1176, 1 },
+    { 14641, 1177, 1 },
+    { 14653, 1178, 1 },
+    { 14665, 1179, 1 },
+    { 14677, 1180, 1 },
+    { 14689, 1181, 1 },
+    { 14700, 1182, 1 },
+    { 14712, 1183, 1 },
+    { 14724, 1184, 1 },
+    { 14736, 1185, 1 },
+    { 14750, 1186, 1 },
+    { 14759, 1187, 1 },
+    { 14768, 1188, 1 },
+    { 14780, 1189, 1 },
+    { 14792, 1190, 1 },
+    { 14804, 1191, 1 },
+    { 14819, 1192, 1 },
+    { 14831, 1193, 1 },
+    { 14843, 1194, 1 },
+    { 14855, 1195, 1 },
+    { 14864, 1196, 1 },
+    { 14876, 1197, 1 },
+    { 14888, 1198, 1 },
+    { 14900, 1199, 1 },
+    { 14912, 1200, 1 },
+    { 14923, 1201, 1 },
+    { 14935, 1202, 1 },
+    { 14947, 1203, 1 },
+    { 14956, 1204, 1 },
+    { 14965, 1205, 1 },
+    { 14977, 1206, 1 },
+    { 14989, 1207, 1 },
+    { 15001, 1208, 1 },
+    { 15016, 1209, 1 },
+    { 15028, 1210, 1 },
+    { 15043, 1211, 1 },
+    { 15055, 1212, 1 },
+    { 15067, 1213, 1 },
+    { 15081, 1214, 1 },
+    { 15093, 1215, 1 },
+    { 15105, 1216, 1 },
+    { 15120, 1217, 1 },
+    { 15132, 1218, 1 },
+    { 15147, 1219, 1 },
+    { 15159, 1220, 1 },
+    { 15174, 1221, 1 },
+    { 15193, 1222, 1 },
+    { 15201, 1223, 1 },
+    { 15213, 1224, 1 },
+    { 15222, 1225, 1 },
+    { 15237, 1226, 1 },
+    { 15245, 1227, 1 },
+    { 15257, 1228, 1 },
+    { 15269, 1229, 1 },
+    { 15281, 1230, 1 },
+    { 15290, 1231, 1 },
+    { 15302, 1232, 1 },
+    { 15324, 1233, 1 },
+    { 15336, 1234, 1 },
+    { 15345, 1235, 1 },
+    { 15357, 1236, 1 },
+    { 15366, 1237, 1 },
+    { 15381, 1238, 1 },
+    { 15393, 1239, 1 },
+    { 15405, 1240, 1 },
+    { 15414, 1241, 1 },
+    { 15426, 1242, 1 },
+    { 15445, 1243, 1 },
+    { 15457, 1244, 1 },
+    { 15469, 1245, 1 },
+    { 15481, 1246, 1 },
+    { 15493, 1247, 1 },
+    { 15505, 1248, 1 },
+    { 15517, 1249, 1 },
+    { 15529, 1250, 1 },
+    { 15541, 1251, 1 },
+    { 15553, 1252, 1 },
+    { 15565, 1253, 1 },
+    { 15580, 1254, 1 },
+    { 15601, 1255, 1 },
+    { 15613, 1256, 1 },
+    { 15625, 1257, 1 },
+    { 15637, 1258, 1 },
+    { 15649, 1259, 1 },
+    { 15661, 1260, 1 },
+    { 15670, 1261, 1 },
+    { 15682, 1262, 1 },
+    { 15698, 1263, 1 },
+    { 15710, 1264, 1 },
+    { 15722, 1265, 1 },
+    { 15733, 1266, 1 },
+    { 15748, 1267, 1 },
+    { 15763, 1268, 1 },
+    { 15778, 1269, 1 },
+    { 15790, 1270, 1 },
+    { 15802, 1271, 1 },
+    { 15811, 1272, 1 },
+    { 15822, 1273, 1 },
+    { 15837, 1274, 1 },
+    { 15852, 1275, 1 },
+    { 15864, 1276, 1 },
+    { 15876, 1277, 1 },
+    { 15888, 1278, 1 },
+    { 15900, 1279, 1 },
+    { 15915, 1280, 1 },
+    { 15924, 1281, 1 },
+    { 15936, 1282, 1 },
+    { 15948, 1283, 1 },
+    { 15967, 1284, 1 },
+    { 15978, 1285, 1 },
+    { 15986, 1286, 1 },
+    { 15995, 1287, 1 },
+    { 16007, 1288, 1 },
+    { 16019, 1289, 1 },
+    { 16031, 1290, 1 },
+    { 16040, 1291, 1 },
+    { 16049, 1292, 1 },
+    { 16061, 1293, 1 },
+    { 16073, 1294, 1 },
+    { 16088, 1295, 1 },
+    { 16103, 1296, 1 },
+    { 16112, 1297, 1 },
+    { 16124, 1298, 1 },
+    { 16136, 1299, 1 },
+    { 16145, 1300, 1 },
+    { 16157, 1301, 1 },
+    { 16169, 1302, 1 },
+    { 16181, 1303, 1 },
+    { 16193, 1304, 1 },
+    { 16208, 1305, 1 },
+    { 16220, 1306, 1 },
+    { 16232, 1307, 1 },
+    { 16247, 1308, 1 },
+    { 16259, 1309, 1 },
+    { 16271, 1310, 1 },
+    { 16292, 1311, 1 },
+    { 16304, 1312, 1 },
+    { 16316, 1313, 1 },
+    { 16327, 1314, 1 },
+    { 16339, 1315, 1 },
+    { 16353, 1316, 1 },
+    { 16365, 1317, 1 },
+    { 16376, 1318, 1 },
+    { 16388, 1319, 1 },
+    { 16400, 1320, 1 },
+    { 16412, 1321, 1 },
+    { 16421, 1322, 1 },
+    { 16436, 1323, 1 },
+    { 16448, 1324, 1 },
+    { 16460, 1325, 1 },
+    { 16469, 1326, 1 },
+    { 16484, 1327, 1 },
+    { 16496, 1328, 1 },
+    { 16511, 1329, 1 },
+    { 16523, 1330, 1 },
+    { 16535, 1331, 1 },
+    { 16547, 1332, 1 },
+    { 16559, 1333, 1 },
+    { 16571, 1334, 1 },
+    { 16592, 1335, 1 },
+    { 16604, 1336, 1 },
+    { 16616, 1337, 1 },
+    { 16628, 1338, 1 },
+    { 16637, 1339, 1 },
+    { 16646, 1340, 1 },
+    { 16661, 1341, 1 },
+    { 16673, 1342, 1 },
+    { 16685, 1343, 1 },
+    { 16697, 1344, 1 },
+    { 16709, 1345, 1 },
+    { 16721, 1346, 1 },
+    { 16736, 1347, 1 },
+    { 16748, 1348, 1 },
+    { 16763, 1349, 1 },
+    { 16775, 1350, 1 },
+    { 16784, 1351, 1 },
+    { 16793, 1352, 1 },
+    { 16802, 1353, 1 },
+    { 16814, 1354, 1 },
+    { 16822, 1355, 1 },
+    { 16834, 1356, 1 },
+    { 16846, 1357, 1 },
+    { 16858, 1358, 1 },
+    { 16869, 1359, 1 },
+    { 16880, 1360, 1 },
+    { 16892, 1361, 1 },
+    { 16904, 1362, 1 },
+    { 16916, 1363, 1 },
+    { 16928, 1364, 1 },
+    { 16937, 1365, 1 },
+    { 16949, 1366, 1 },
+    { 16964, 1367, 1 },
+    { 16976, 1368, 1 },
+    { 16985, 1369, 1 },
+    { 16997, 1370, 1 },
+    { 17006, 1371, 1 },
+    { 17018, 1372, 1 },
+    { 17027, 1373, 1 },
+    { 17042, 1374, 1 },
+    { 17054, 1375, 1 },
+    { 17066, 1376, 1 },
+    { 17078, 1377, 1 },
+    { 17090, 1378, 1 },
+    { 17099, 1379, 1 },
+    { 17111, 1380, 1 },
+    { 17123, 1381, 1 },
+    { 17135, 1382, 1 },
+    { 17144, 1383, 1 },
+    { 17156, 1384, 1 },
+    { 17171, 1385, 1 },
+    { 17180, 1386, 1 },
+    { 17201, 1387, 1 },
+    { 17213, 1388, 1 },
+    { 17222, 1389, 1 },
+    { 17233, 1390, 1 },
+    { 17248, 1391, 1 },
+    { 17257, 1392, 1 },
+    { 17272, 1393, 1 },
+    { 17284, 1394, 1 },
+    { 17296, 1395, 1 },
+    { 17308, 1396, 1 },
+    { 17323, 1397, 1 },
+    { 17331, 1398, 1 },
+    { 17343, 1399, 1 },
+    { 17355, 1400, 1 },
+    { 17376, 1401, 1 },
+    { 17384, 1402, 1 },
+    { 17396, 1403, 1 },
+    { 17408, 1404, 1 },
+    { 17420, 1405, 1 },
+    { 17431, 1406, 1 },
+    { 17445, 1407, 1 },
+    { 17457, 1408, 1 },
+    { 17469, 1409, 1 },
+    { 17481, 1410, 1 },
+    { 17490, 1411, 1 },
+    { 17499, 1412, 1 },
+    { 17517, 1413, 1 },
+    { 17529, 1414, 1 },
+    { 17541, 1415, 1 },
+    { 17550, 1416, 1 },
+    { 17562, 1417, 1 },
+    { 17574, 1418, 1 },
+    { 17583, 1419, 1 },
+    { 17598, 1420, 1 },
+    { 17613, 1421, 1 },
+    { 17622, 1422, 1 },
+    { 17634, 1423, 1 },
+    { 17643, 1424, 1 },
+    { 17657, 1425, 1 },
+    { 17672, 1426, 1 },
+    { 17687, 1427, 1 },
+    { 17699, 1428, 1 },
+    { 17708, 1429, 1 },
+    { 17720, 1430, 1 },
+    { 17729, 1431, 1 },
+    { 17741, 1432, 1 },
+    { 17753, 1433, 1 },
+    { 17765, 1434, 1 },
+    { 17774, 1435, 1 },
+    { 17786, 1436, 1 },
+    { 17798, 1437, 1 },
+    { 17810, 1438, 1 },
+    { 17822, 1439, 1 },
+    { 17833, 1440, 1 },
+    { 17848, 1441, 1 },
+    { 17860, 1442, 1 },
+    { 17874, 1443, 1 },
+    { 17889, 1444, 1 },
+    { 17904, 1445, 1 },
+    { 17922, 1446, 1 },
+    { 17934, 1447, 1 },
+    { 17945, 1448, 1 },
+    { 17960, 1449, 1 },
+    { 17971, 1450, 1 },
+    { 17983, 1451, 1 },
+    { 17992, 1452, 1 },
+    { 18004, 1453, 1 },
+    { 18019, 1454, 1 },
+    { 18031, 1455, 1 },
+    { 18040, 1456, 1 },
+    { 18052, 1457, 1 },
+    { 18061, 1458, 1 },
+    { 18073, 1459, 1 },
+    { 18085, 1460, 1 },
+    { 18096, 1461, 1 },
+    { 18108, 1462, 1 },
+    { 18122, 1463, 1 },
+    { 18131, 1464, 1 },
+    { 18142, 1465, 1 },
+    { 18154, 1466, 1 },
+    { 18166, 1467, 1 },
+    { 18175, 1468, 1 },
+    { 18183, 1469, 1 },
+    { 18195, 1470, 1 },
+    { 18207, 1471, 1 },
+    { 18222, 1472, 1 },
+    { 18234, 1473, 1 },
+    { 18246, 1474, 1 },
+    { 18255, 1475, 1 },
+    { 18267, 1476, 1 },
+    { 18279, 1477, 1 },
+    { 18291, 1478, 1 },
+    { 18303, 1479, 1 },
+    { 18312, 1480, 1 },
+    { 18327, 1481, 1 },
+    { 18349, 1482, 1 },
+    { 18361, 1483, 1 },
+    { 18373, 1484, 1 },
+    { 18385, 1485, 1 },
+    { 18397, 1486, 1 },
+    { 18409, 1487, 1 },
+    { 18418, 1488, 1 },
+    { 18433, 1489, 1 },
+    { 18448, 1490, 1 },
+    { 18460, 1491, 1 },
+    { 18475, 1492, 1 },
+    { 18487, 1493, 1 },
+    { 18499, 1494, 1 },
+    { 18511, 1495, 1 },
+    { 18523, 1496, 1 },
+    { 18535, 1497, 1 },
+    { 18547, 1498, 1 },
+    { 18562, 1499, 1 },
+    { 18571, 1500, 1 },
+    { 18583, 1501, 1 },
+    { 18592, 1502, 1 },
+    { 18601, 1503, 1 },
+    { 18616, 1504, 1 },
+    { 18628, 1505, 1 },
+    { 18640, 1506, 1 },
+    { 18655, 1507, 1 },
+    { 18667, 1508, 1 },
+    { 18679, 1509, 1 },
+    { 18691, 1510, 1 },
+    { 18703, 1511, 1 },
+    { 18714, 1512, 1 },
+    { 18726, 1513, 1 },
+    { 18741, 1514, 1 },
+    { 18753, 1515, 1 },
+    { 18763, 1516, 1 },
+    { 18775, 1517, 1 },
+    { 18787, 1518, 1 },
+    { 18796, 1519, 1 },
+    { 18808, 1520, 1 },
+    { 18820, 1521, 1 },
+    { 18835, 1522, 1 },
+    { 18847, 1523, 1 },
+    { 18858, 1524, 1 },
+    { 18870, 1525, 1 },
+    { 18882, 1526, 1 },
+    { 18897, 1527, 1 },
+    { 18912, 1528, 1 },
+    { 18923, 1529, 1 },
+    { 18938, 1530, 1 },
+    { 18950, 1531, 1 },
+    { 18965, 1532, 1 },
+    { 18976, 1533, 1 },
+    { 18995, 1534, 1 },
+    { 19007, 1535, 1 },
+    { 19019, 1536, 1 },
+    { 19034, 1537, 1 },
+    { 19046, 1538, 1 },
+    { 19068, 1539, 1 },
+    { 19077, 1540, 1 },
+    { 19089, 1541, 1 },
+    { 19111, 1542, 1 },
+    { 19123, 1543, 1 },
+    { 19135, 1544, 1 },
+    { 19147, 1545, 1 },
+    { 19161, 1546, 1 },
+    { 19173, 1547, 1 },
+    { 19185, 1548, 1 },
+    { 19196, 1549, 1 },
+    { 19208, 1550, 1 },
+    { 19219, 1551, 1 },
+    { 19231, 1552, 1 },
+    { 19243, 1553, 1 },
+    { 19258, 1554, 1 },
+    { 19270, 1555, 1 },
+    { 19281, 1556, 1 },
+    { 19290, 1557, 1 },
+    { 19302, 1558, 1 },
+    { 19310, 1559, 1 },
+    { 19322, 1560, 1 },
+    { 19334, 1561, 1 },
+    { 19349, 1562, 1 },
+    { 19361, 1563, 1 },
+    { 19373, 1564, 1 },
+    { 19387, 1565, 1 },
+    { 19402, 1566, 1 },
+    { 19414, 1567, 1 },
+    { 19429, 1568, 1 },
+    { 19441, 1569, 1 },
+    { 19462, 1570, 1 },
+    { 19471, 1571, 1 },
+    { 19480, 1572, 1 },
+    { 19492, 1573, 1 },
+    { 19504, 1574, 1 },
+    { 19516, 1575, 1 },
+    { 19528, 1576, 1 },
+    { 19540, 1577, 1 },
+    { 19551, 1578, 1 },
+    { 19566, 1579, 1 },
+    { 19575, 1580, 1 },
+    { 19584, 1581, 1 },
+    { 19596, 1582, 1 },
+    { 19608, 1583, 1 },
+    { 19620, 1584, 1 },
+    { 19631, 1585, 1 },
+    { 19643, 1586, 1 },
+    { 19655, 1587, 1 },
+    { 19664, 1588, 1 },
+    { 19676, 1589, 1 },
+    { 19688, 1590, 1 },
+    { 19700, 1591, 1 },
+    { 19722, 1592, 1 },
+    { 19734, 1593, 1 },
+    { 19753, 1594, 1 },
+    { 19772, 1595, 1 },
+    { 19783, 1596, 1 },
+    { 19795, 1597, 1 },
+    { 19807, 1598, 1 },
+    { 19819, 1599, 1 },
+    { 19834, 1600, 1 },
+    { 19845, 1601, 1 },
+    { 19860, 1602, 1 },
+    { 19872, 1603, 1 },
+    { 19884, 1604, 1 },
+    { 19893, 1605, 1 },
+    { 19908, 1606, 1 },
+    { 19920, 1607, 1 },
+    { 19929, 1608, 1 },
+    { 19944, 1609, 1 },
+    { 19956, 1610, 1 },
+    { 19971, 1611, 1 },
+    { 19983, 1612, 1 },
+    { 19992, 1613, 1 },
+    { 20007, 1614, 1 },
+    { 20016, 1615, 1 },
+    { 20028, 1616, 1 },
+    { 20040, 1617, 1 },
+    { 20052, 1618, 1 },
+    { 20064, 1619, 1 },
+    { 20076, 1620, 1 },
+    { 20091, 1621, 1 },
+    { 20106, 1622, 1 },
+    { 20118, 1623, 1 },
+    { 20130, 1624, 1 },
+    { 20142, 1625, 1 },
+    { 20154, 1626, 1 },
+    { 20166, 1627, 1 },
+    { 20178, 1628, 1 },
+    { 20190, 1629, 1 },
+    { 20205, 1630, 1 },
+    { 20220, 1631, 1 },
+    { 20235, 1632, 1 },
+    { 20247, 1633, 1 },
+    { 20262, 1634, 1 },
+    { 20274, 1635, 1 },
+    { 20286, 1636, 1 },
+    { 20298, 1637, 1 },
+    { 20310, 1638, 1 },
+    { 20325, 1639, 1 },
+    { 20337, 1640, 1 },
+    { 20359, 1641, 1 },
+    { 20370, 1642, 1 },
+    { 20382, 1643, 1 },
+    { 20394, 1644, 1 },
+    { 20406, 1645, 1 },
+    { 20418, 1646, 1 },
+    { 20430, 1647, 1 },
+    { 20439, 1648, 1 },
+    { 20453, 1649, 1 },
+    { 20462, 1650, 1 },
+    { 20471, 1651, 1 },
+    { 20486, 1652, 1 },
+    { 20498, 1653, 1 },
+    { 20510, 1654, 1 },
+    { 20525, 1655, 1 },
+    { 20537, 1656, 1 },
+    { 20552, 1657, 1 },
+    { 20564, 1658, 1 },
+    { 20579, 1659, 1 },
+    { 20591, 1660, 1 },
+    { 20600, 1661, 1 },
+    { 20611, 1662, 1 },
+    { 20623, 1663, 1 },
+    { 20634, 1664, 1 },
+    { 20646, 1665, 1 },
+    { 20658, 1666, 1 },
+    { 20666, 1667, 1 },
+    { 20678, 1668, 1 },
+    { 20690, 1669, 1 },
+    { 20702, 1670, 1 },
+    { 20714, 1671, 1 },
+    { 20726, 1672, 1 },
+    { 20735, 1673, 1 },
+    { 20747, 1674, 1 },
+    { 20756, 1675, 1 },
+    { 20768, 1676, 1 },
+    { 20780, 1677, 1 },
+    { 20791, 1678, 1 },
+    { 20803, 1679, 1 },
+    { 20818, 1680, 1 },
+    { 20830, 1681, 1 },
+    { 20842, 1682, 1 },
+    { 20850, 1683, 1 },
+    { 20862, 1684, 1 },
+    { 20874, 1685, 1 },
+    { 20886, 1686, 1 },
+    { 20898, 1687, 1 },
+    { 20913, 1688, 1 },
+    { 20934, 1689, 1 },
+    { 20946, 1690, 1 },
+    { 20958, 1691, 1 },
+    { 20972, 1692, 1 },
+    { 20984, 1693, 1 },
+    { 20999, 1694, 1 },
+    { 21014, 1695, 1 },
+    { 21026, 1696, 1 },
+    { 21038, 1697, 1 },
+    { 21049, 1698, 1 },
+    { 21058, 1699, 1 },
+    { 21069, 1700, 1 },
+    { 21081, 1701, 1 },
+    { 21093, 1702, 1 },
+    { 21104, 1703, 1 },
+    { 21116, 1704, 1 },
+    { 21128, 1705, 1 },
+    { 21137, 1706, 1 },
+    { 21152, 1707, 1 },
+    { 21164, 1708, 1 },
+    { 21176, 1709, 1 },
+    { 21188, 1710, 1 },
+    { 21200, 1711, 1 },
+    { 21209, 1712, 1 },
+    { 21221, 1713, 1 },
+    { 21233, 1714, 1 },
+    { 21248, 1715, 1 },
+    { 21260, 1716, 1 },
+    { 21272, 1717, 1 },
+    { 21284, 1718, 1 },
+    { 21299, 1719, 1 },
+    { 21308, 1720, 1 },
+    { 21329, 1721, 1 },
+    { 21338, 1722, 1 },
+    { 21349, 1723, 1 },
+    { 21361, 1724, 1 },
+    { 21383, 1725, 1 },
+    { 21398, 1726, 1 },
+    { 21410, 1727, 1 },
+    { 21425, 1728, 1 },
+    { 21437, 1729, 1 },
+    { 21449, 1730, 1 },
+    { 21461, 1731, 1 },
+    { 21476, 1732, 1 },
+    { 21488, 1733, 1 },
+    { 21502, 1734, 1 },
+    { 21514, 1735, 1 },
+    { 21529, 1736, 1 },
+    { 21541, 1737, 1 },
+    { 21556, 1738, 1 },
+    { 21568, 1739, 1 },
+    { 21580, 1740, 1 },
+    { 21589, 1741, 1 },
+    { 21601, 1742, 1 },
+    { 21613, 1743, 1 },
+    { 21632, 1744, 1 },
+    { 21644, 1745, 1 },
+    { 21653, 1746, 1 },
+    { 21665, 1747, 1 },
+    { 21680, 1748, 1 },
+    { 21689, 1749, 1 },
+    { 21701, 1750, 1 },
+    { 21716, 1751, 1 },
+    { 21725, 1752, 1 },
+    { 21737, 1753, 1 },
+    { 21749, 1754, 1 },
+    { 21758, 1755, 1 },
+    { 21777, 1756, 1 },
+    { 21789, 1757, 1 },
+    { 21801, 1758, 1 },
+    { 21813, 1759, 1 },
+    { 21822, 1760, 1 },
+    { 21833, 1761, 1 },
+    { 21845, 1762, 1 },
+    { 21857, 1763, 1 },
+    { 21869, 1764, 1 },
+    { 21881, 1765, 1 },
+    { 21893, 1766, 1 },
+    { 21902, 1767, 1 },
+    { 21924, 1768, 1 },
+    { 21936, 1769, 1 },
+    { 21945, 1770, 1 },
+    { 21954, 1771, 1 },
+    { 21966, 1772, 1 },
+    { 21978, 1773, 1 },
+    { 21990, 1774, 1 },
+    { 22002, 1775, 1 },
+    { 22011, 1776, 1 },
+    { 22023, 1777, 1 },
+    { 22035, 1778, 1 },
+    { 22050, 1779, 1 },
+    { 22062, 1780, 1 },
+    { 22074, 1781, 1 },
+    { 22086, 1782, 1 },
+    { 22101, 1783, 1 },
+    { 22116, 1784, 1 },
+    { 22125, 1785, 1 },
+    { 22137, 1786, 1 },
+    { 22149, 1787, 1 },
+    { 22158, 1788, 1 },
+    { 22169, 1789, 1 },
+    { 22181, 1790, 1 },
+    { 22193, 1791, 1 },
+    { 22202, 1792, 1 },
+    { 22213, 1793, 1 },
+    { 22231, 1794, 1 },
+    { 22246, 1795, 1 },
+    { 22261, 1796, 1 },
+    { 22273, 1797, 1 },
+    { 22288, 1798, 1 },
+    { 22299, 1799, 1 },
+    { 22308, 1800, 1 },
+    { 22320, 1801, 1 },
+    { 22332, 1802, 1 },
+    { 22344, 1803, 1 },
+    { 22356, 1804, 1 },
+    { 22377, 1805, 1 },
+    { 22389, 1806, 1 },
+    { 22401, 1807, 1 },
+    { 22409, 1808, 1 },
+    { 22421, 1809, 1 },
+    { 22436, 1810, 1 },
+    { 22448, 1811, 1 },
+    { 22460, 1812, 1 },
+    { 22472, 1813, 1 },
+    { 22484, 1814, 1 },
+    { 22496, 1815, 1 },
+    { 22508, 1816, 1 },
+    { 22520, 1817, 1 },
+    { 22535, 1818, 1 },
+    { 22547, 1819, 1 },
+    { 22559, 1820, 1 },
+    { 22571, 1821, 1 },
+    { 22583, 1822, 1 },
+    { 22598, 1823, 1 },
+    { 22610, 1824, 1 },
+    { 22622, 1825, 1 },
+    { 22640, 1826, 1 },
+    { 22652, 1827, 1 },
+    { 22664, 1828, 1 },
+    { 22676, 1829, 1 },
+    { 22688, 1830, 1 },
+    { 22697, 1831, 1 },
+    { 22709, 1832, 1 },
+    { 22718, 1833, 1 },
+    { 22730, 1834, 1 },
+    { 22742, 1835, 1 },
+    { 22750, 1836, 1 },
+    { 22759, 1837, 1 },
+    { 22774, 1838, 1 },
+    { 22786, 1839, 1 },
+    { 22798, 1840, 1 },
+    { 22809, 1841, 1 },
+    { 22821, 1842, 1 },
+    { 22833, 1843, 1 },
+    { 22842, 1844, 1 },
+    { 22850, 1845, 1 },
+    { 22862, 1846, 1 },
+    { 22874, 1847, 1 },
+    { 22886, 1848, 1 },
+    { 22908, 1849, 1 },
+    { 22917, 1850, 1 },
+    { 22932, 1851, 1 },
+    { 22944, 1852, 1 },
+    { 22955, 1853, 1 },
+    { 22970, 1854, 1 },
+    { 22979, 1855, 1 },
+    { 22994, 1856, 1 },
+    { 23005, 1857, 1 },
+    { 23019, 1858, 1 },
+    { 23031, 1859, 1 },
+    { 23043, 1860, 1 },
+    { 23055, 1861, 1 },
+    { 23067, 1862, 1 },
+    { 23082, 1863, 1 },
+    { 23094, 1864, 1 },
+    { 23106, 1865, 1 },
+    { 23118, 1866, 1 },
+    { 23130, 1867, 1 },
+    { 23142, 1868, 1 },
+    { 23154, 1869, 1 },
+    { 23163, 1870, 1 },
+    { 23175, 1871, 1 },
+    { 23196, 1872, 1 },
+    { 23208, 1873, 1 },
+    { 23223, 1874, 1 },
+    { 23235, 1875, 1 },
+    { 23244, 1876, 1 },
+    { 23263, 1877, 1 },
+    { 23272, 1878, 1 },
+    { 23284, 1879, 1 },
+    { 23298, 1880, 1 },
+    { 23310, 1881, 1 },
+    { 23322, 1882, 1 },
+    { 23334, 1883, 1 },
+    { 23346, 1884, 1 },
+    { 23358, 1885, 1 },
+    { 23373, 1886, 1 },
+    { 23385, 1887, 1 },
+    { 23396, 1888, 1 },
+    { 23411, 1889, 1 },
+    { 23423, 1890, 1 },
+    { 23434, 1891, 1 },
+    { 23449, 1892, 1 },
+    { 23468, 1893, 1 },
+    { 23480, 1894, 1 },
+    { 23489, 1895, 1 },
+    { 23498, 1896, 1 },
+    { 23512, 1897, 1 },
+    { 23527, 1898, 1 },
+    { 23539, 1899, 1 },
+    { 23551, 1900, 1 },
+    { 23563, 1901, 1 },
+    { 23575, 1902, 1 },
+    { 23590, 1903, 1 },
+    { 23602, 1904, 1 },
+    { 23614, 1905, 1 },
+    { 23629, 1906, 1 },
+    { 23644, 1907, 1 },
+    { 23658, 1908, 1 },
+    { 23670, 1909, 1 },
+    { 23682, 1910, 1 },
+    { 23694, 1911, 1 },
+    { 23706, 1912, 1 },
+    { 23718, 1913, 1 },
+    { 23733, 1914, 1 },
+    { 23745, 1915, 1 },
+    { 23754, 1916, 1 },
+    { 23773, 1917, 1 },
+    { 23782, 1918, 1 },
+    { 23797, 1919, 1 },
+    { 23806, 1920, 1 },
+    { 23821, 1921, 1 },
+    { 23840, 1922, 1 },
+    { 23852, 1923, 1 },
+    { 23867, 1924, 1 },
+    { 23879, 1925, 1 },
+    { 23901, 1926, 1 },
+    { 23910, 1927, 1 },
+    { 23922, 1928, 1 },
+    { 23934, 1929, 1 },
+    { 23946, 1930, 1 },
+    { 23961, 1931, 1 },
+    { 23973, 1932, 1 },
+    { 23988, 1933, 1 },
+    { 24003, 1934, 1 },
+    { 24015, 1935, 1 },
+    { 24030, 1936, 1 },
+    { 24044, 1937, 1 },
+    { 24056, 1938, 1 },
+    { 24078, 1939, 1 },
+    { 24097, 1940, 1 },
+    { 24109, 1941, 1 },
+    { 24121, 1942, 1 },
+    { 24133, 1943, 1 },
+    { 24145, 1944, 1 },
+    { 24157, 1945, 1 },
+    { 24172, 1946, 1 },
+    { 24187, 1947, 1 },
+    { 24202, 1948, 1 },
+    { 24211, 1949, 1 },
+    { 24223, 1950, 1 },
+    { 24232, 1951, 1 },
+    { 24247, 1952, 1 },
+    { 24259, 1953, 1 },
+    { 24271, 1954, 1 },
+    { 24283, 1955, 1 },
+    { 24295, 1956, 1 },
+    { 24307, 1957, 1 },
+    { 24322, 1958, 1 },
+    { 24334, 1959, 1 },
+    { 24343, 1960, 1 },
+    { 24355, 1961, 1 },
+    { 24367, 1962, 1 },
+    { 24379, 1963, 1 },
+    { 24401, 1964, 1 },
+    { 24413, 1965, 1 },
+    { 24425, 1966, 1 },
+    { 24437, 1967, 1 },
+    { 24449, 1968, 1 },
+    { 24460, 1969, 1 },
+    { 24472, 1970, 1 },
+    { 24484, 1971, 1 },
+    { 24493, 1972, 1 },
+    { 24519, 1973, 1 },
+    { 24531, 1974, 1 },
+    { 24543, 1975, 1 },
+    { 24555, 1976, 1 },
+    { 24564, 1977, 1 },
+    { 24579, 1978, 1 },
+    { 24590, 1979, 1 },
+    { 24602, 1980, 1 },
+    { 24614, 1981, 1 },
+    { 24626, 1982, 1 },
+    { 24638, 1983, 1 },
+    { 24647, 1984, 1 },
+    { 24659, 1985, 1 },
+    { 24671, 1986, 1 },
+    { 24686, 1987, 1 },
+    { 24701, 1988, 1 },
+    { 24710, 1989, 1 },
+    { 24725, 1990, 1 },
+    { 24734, 1991, 1 },
+    { 24743, 1992, 1 },
+    { 24755, 1993, 1 },
+    { 24767, 1994, 1 },
+    { 24779, 1995, 1 },
+    { 24791, 1996, 1 },
+    { 24806, 1997, 1 },
+    { 24818, 1998, 1 },
+    { 24830, 1999, 1 },
+    { 24842, 2000, 1 },
+    { 24857, 2001, 1 },
+    { 24869, 2002, 1 },
+    { 24881, 2003, 1 },
+    { 24893, 2004, 1 },
+    { 24905, 2005, 1 },
+    { 24920, 2006, 1 },
+    { 24932, 2007, 1 },
+    { 24941, 2008, 1 },
+    { 24956, 2009, 1 },
+    { 24971, 2010, 1 },
+    { 24986, 2011, 1 },
+    { 24998, 2012, 1 },
+    { 25010, 2013, 1 },
+    { 25022, 2014, 1 },
+    { 25037, 2015, 1 },
+    { 25049, 2016, 1 },
+    { 25064, 2017, 1 },
+    { 25076, 2018, 1 },
+    { 25091, 2019, 1 },
+    { 25103, 2020, 1 },
+    { 25115, 2021, 1 },
+    { 25127, 2022, 1 },
+    { 25136, 2023, 1 },
+    { 25147, 2024, 1 },
+    { 25156, 2025, 1 },
+    { 25168, 2026, 1 },
+    { 25180, 2027, 1 },
+    { 25192, 2028, 1 },
+    { 25204, 2029, 1 },
+    { 25219, 2030, 1 },
+    { 25231, 2031, 1 },
+    { 25246, 2032, 1 },
+    { 25261, 2033, 1 },
+    { 25273, 2034, 1 },
+    { 25285, 2035, 1 },
+    { 25297, 2036, 1 },
+    { 25311, 2037, 1 },
+    { 25326, 2038, 1 },
+    { 25341, 2039, 1 },
+    { 25353, 2040, 1 },
+    { 25365, 2041, 1 },
+    { 25380, 2042, 1 },
+    { 25392, 2043, 1 },
+    { 25404, 2044, 1 },
+    { 25416, 2045, 1 },
+    { 25428, 2046, 1 },
+    { 25443, 2047, 1 },
+    { 25452, 2048, 1 },
+    { 25464, 2049, 1 },
+    { 25473, 2050, 1 },
+    { 25488, 2051, 1 },
+    { 25500, 2052, 1 },
+    { 25515, 2053, 1 },
+    { 25527, 2054, 1 },
+    { 25542, 2055, 1 },
+    { 25551, 2056, 1 },
+    { 25563, 2057, 1 },
+    { 25575, 2058, 1 },
+    { 25587, 2059, 1 },
+    { 25599, 2060, 1 },
+    { 25611, 2061, 1 },
+    { 25623, 2062, 1 },
+    { 25635, 2063, 1 },
+    { 25650, 2064, 1 },
+    { 25665, 2065, 1 },
+    { 25677, 2066, 1 },
+    { 25689, 2067, 1 },
+    { 25701, 2068, 1 },
+    { 25712, 2069, 1 },
+    { 25721, 2070, 1 },
+    { 25730, 2071, 1 },
+    { 25745, 2072, 1 },
+    { 25760, 2073, 1 },
+    { 25772, 2074, 1 },
+    { 25781, 2075, 1 },
+    { 25793, 2076, 1 },
+    { 25805, 2077, 1 },
+    { 25817, 2078, 1 },
+    { 25829, 2079, 1 },
+    { 25841, 2080, 1 },
+    { 25856, 2081, 1 },
+    { 25871, 2082, 1 },
+    { 25886, 2083, 1 },
+    { 25898, 2084, 1 },
+    { 25907, 2085, 1 },
+    { 25928, 2086, 1 },
+    { 25943, 2087, 1 },
+    { 25952, 2088, 1 },
+    { 25967, 2089, 1 },
+    { 25979, 2090, 1 },
+    { 25991, 2091, 1 },
+    { 26003, 2092, 1 },
+    { 26015, 2093, 1 },
+    { 26030, 2094, 1 },
+    { 26045, 2095, 1 },
+    { 26057, 2096, 1 },
+    { 26066, 2097, 1 },
+    { 26078, 2098, 1 },
+    { 26089, 2099, 1 },
+    { 26104, 2100, 1 },
+    { 26116, 2101, 1 },
+    { 26131, 2102, 1 },
+    { 26143, 2103, 1 },
+    { 26155, 2104, 1 },
+    { 26167, 2105, 1 },
+    { 26179, 2106, 1 },
+    { 26191, 2107, 1 },
+    { 26203, 2108, 1 },
+    { 26215, 2109, 1 },
+    { 26230, 2110, 1 },
+    { 26245, 2111, 1 },
+    { 26257, 2112, 1 },
+    { 26266, 2113, 1 },
+    { 26281, 2114, 1 },
+    { 26293, 2115, 1 },
+    { 26305, 2116, 1 },
+    { 26317, 2117, 1 },
+    { 26329, 2118, 1 },
+    { 26344, 2119, 1 },
+    { 26356, 2120, 1 },
+    { 26368, 2121, 1 },
+    { 26377, 2122, 1 },
+    { 26389, 2123, 1 },
+    { 26401, 2124, 1 },
+    { 26413, 2125, 1 },
+    { 26424, 2126, 1 },
+    { 26433, 2127, 1 },
+    { 26448, 2128, 1 },
+    { 26459, 2129, 1 },
+    { 26471, 2130, 1 },
+    { 26480, 2131, 1 },
+    { 26502, 2132, 1 },
+    { 26517, 2133, 1 },
+    { 26536, 2134, 1 },
+    { 26548, 2135, 1 },
+    { 26563, 2136, 1 },
+    { 26575, 2137, 1 },
+    { 26590, 2138, 1 },
+    { 26599, 2139, 1 },
+    { 26611, 2140, 1 },
+    { 26630, 2141, 1 },
+    { 26645, 2142, 1 },
+    { 26657, 2143, 1 },
+    { 26666, 2144, 1 },
+    { 26678, 2145, 1 },
+    { 26690, 2146, 1 },
+    { 26702, 2147, 1 },
+    { 26711, 2148, 1 },
+    { 26720, 2149, 1 },
+    { 26732, 2150, 1 },
+    { 26744, 2151, 1 },
+    { 26758, 2152, 1 },
+    { 26770, 2153, 1 },
+    { 26782, 2154, 1 },
+    { 26796, 2155, 1 },
+    { 26808, 2156, 1 },
+    { 26820, 2157, 1 },
+    { 26832, 2158, 1 },
+    { 26844, 2159, 1 },
+    { 26855, 2160, 1 },
+    { 26870, 2161, 1 },
+    { 26885, 2162, 1 },
+    { 26897, 2163, 1 },
+    { 26909, 2164, 1 },
+    { 26921, 2165, 1 },
+    { 26933, 2166, 1 },
+    { 26945, 2167, 1 },
+    { 26957, 2168, 1 },
+    { 26972, 2169, 1 },
+    { 26984, 2170, 1 },
+    { 26996, 2171, 1 },
+    { 27008, 2172, 1 },
+    { 27020, 2173, 1 },
+    { 27029, 2174, 1 },
+};
+
+static const guint32 chinese_emoji_results[] = {
+    7, 19, 31, 43, 55, 67, 82, 91,
+    103, 115, 127, 139, 151, 163, 175, 187,
+    199, 211, 223, 238, 250, 265, 277, 289,
+    301, 313, 322, 337, 349, 361, 376, 388,
+    407, 419, 431, 440, 449, 460, 472, 481,
+    493, 508, 526, 538, 552, 564, 576, 585,
+    597, 612, 626, 638, 653, 662, 674, 686,
+    698, 712, 721, 736, 752, 764, 779, 793,
+    808, 817, 829, 841, 853, 868, 880, 892,
+    904, 916, 927, 939, 954, 966, 975, 984,
+    999, 1014, 1026, 1040, 1052, 1064, 1076, 1088,
+    1100, 1112, 1121, 1133, 1148, 1162, 1174, 1193,
+    1205, 1214, 1226, 1238, 1247, 1262, 1274, 1286,
+    1298, 1310, 1320, 1332, 1344, 1359, 1368, 1386,
+    1398, 1410, 1422, 1434, 1446, 1458, 1470, 1485,
+    1494, 1506, 1521, 1533, 1548, 1560, 1575, 1587,
+    1602, 1617, 1629, 1638, 1650, 1662, 1673, 1685,
+    1697, 1706, 1718, 1726, 1737, 1749, 1758, 1770,
+    1782, 1791, 1803, 1817, 1835, 1850, 1859, 1870,
+    1882, 1897, 1909, 1921, 1930, 1945, 1960, 1972,
+    1984, 1993, 2005, 2017, 2029, 2041, 2053, 2062,
+    2071, 2080, 2089, 2101, 2116, 2128, 2137, 2151,
+    2166, 2178, 2192, 2204, 2219, 2231, 2243, 2255,
+    2270, 2279, 2294, 2303, 2318, 2330, 2345, 2360,
+    2372, 2383, 2395, 2407, 2419, 2431, 2442, 2451,
+    2462, 2473, 2485, 2497, 2512, 2524, 2545, 2554,
+    2563, 2575, 2587, 2602, 2614, 2629, 2641, 2653,
+    2664, 2676, 2688, 2700, 2712, 2724, 2736, 2755,
+    2764, 2776, 2788, 2797, 2809, 2821, 2830, 2844,
+    2856, 2871, 2886, 2898, 2910, 2929, 2944, 2956,
+    2965, 2977, 2992, 3010, 3019, 3031, 3043, 3055,
+    3064, 3076, 3090, 3102, 3114, 3123, 3135, 3147,
+    3159, 3181, 3193, 3205, 3217, 3232, 3244, 3263,
+    3275, 3284, 3296, 3308, 3317, 3329, 3341, 3353,
+    3365, 3377, 3392, 3404, 3419, 3431, 3446, 3458,
+    3470, 3479, 3494, 3506, 3525, 3534, 3549, 3561,
+    3576, 3594, 3605, 3620, 3629, 3644, 3659, 3667,
+    3682, 3698, 3713, 3725, 3734, 3746, 3758, 3769,
+    3781, 3796, 3805, 3814, 3826, 3837, 3849, 3861,
+    3872, 3884, 3896, 3908, 3920, 3935, 3950, 3965,
+    3983, 3995, 4007, 4019, 4031, 4043, 4062, 4074,
+    4083, 4098, 4110, 4119, 4131, 4140, 4149, 4164,
+    4182, 4197, 4209, 4218, 4232, 4244, 4256, 4268,
+    4277, 4289, 4301, 4313, 4325, 4334, 4343, 4355,
+    4367, 4382, 4394, 4406, 4418, 4427, 4439, 4448,
+    4460, 4474, 4486, 4495, 4507, 4516, 4525, 4540,
+    4552, 4564, 4576, 4585, 4600, 4612, 4626, 4644,
+    4656, 4671, 4687, 4702, 4714, 4723, 4735, 4744,
+    4753, 4765, 4777, 4789, 4801, 4813, 4825, 4836,
+    4848, 4860, 4872, 4887, 4899, 4911, 4922, 4937,
+    4951, 4963, 4972, 4983, 4992, 5004, 5016, 5028,
+    5040, 5055, 5067, 5082, 5094, 5106, 5115, 5127,
+    5142, 5157, 5172, 5181, 5193, 5205, 5220, 5232,
+    5244, 5256, 5264, 5276, 5285, 5297, 5312, 5321,
+    5333, 5345, 5360, 5372, 5381, 5396, 5408, 5420,
+    5435, 5450, 5462, 5471, 5483, 5495, 5507, 5516,
+    5528, 5540, 5552, 5561, 5576, 5585, 5600, 5609,
+    5618, 5626, 5638, 5650, 5676, 5688, 5710, 5728,
+    5740, 5751, 5763, 5775, 5787, 5799, 5814, 5829,
+    5841, 5850, 5859, 5871, 5885, 5897, 5909, 5918,
+    5930, 5939, 5951, 5963, 5978, 5990, 6002, 6017,
+    6029, 6044, 6056, 6071, 6083, 6095, 6107, 6119,
+    6131, 6146, 6158, 6177, 6186, 6201, 6213, 6225,
+    6247, 6262, 6277, 6289, 6301, 6313, 6325, 6337,
+    6349, 6364, 6376, 6388, 6397, 6412, 6424, 6436,
+    6448, 6460, 6472, 6484, 6496, 6508, 6517, 6529,
+    6544, 6559, 6571, 6583, 6595, 6607, 6622, 6637,
+    6649, 6664, 6676, 6695, 6707, 6719, 6731, 6740,
+    6752, 6760, 6772, 6784, 6796, 6808, 6817, 6829,
+    6840, 6852, 6864, 6876, 6888, 6900, 6915, 6927,
+    6942, 6954, 6963, 6975, 6984, 6998, 7010, 7022,
+    7043, 7052, 7061, 7076, 7091, 7102, 7114, 7129,
+    7137, 7149, 7164, 7179, 7191, 7206, 7228, 7237,
+    7246, 7260, 7275, 7290, 7302, 7313, 7325, 7334,
+    7346, 7358, 7373, 7391, 7403, 7412, 7421, 7433,
+    7445, 7457, 7468, 7483, 7495, 7507, 7519, 7530,
+    7542, 7550, 7559, 7574, 7583, 7598, 7610, 7621,
+    7633, 7645, 7657, 7669, 7681, 7693, 7705, 7717,
+    7729, 7740, 7749, 7764, 7776, 7791, 7803, 7818,
+    7833, 7842, 7854, 7866, 7881, 7896, 7908, 7920,
+    7935, 7947, 7956, 7967, 7985, 7994, 8006, 8021,
+    8033, 8048, 8059, 8071, 8086, 8098, 8110, 8125,
+    8137, 8152, 8164, 8176, 8185, 8200, 8215, 8230,
+    8241, 8256, 8268, 8280, 8295, 8307, 8319, 8330,
+    8342, 8354, 8365, 8377, 8391, 8403, 8415, 8430,
+    8442, 8454, 8466, 8478, 8490, 8502, 8518, 8527,
+    8539, 8551, 8566, 8575, 8587, 8599, 8611, 8620,
+    8635, 8650, 8662, 8678, 8690, 8702, 8714, 8726,
+    8738, 8747, 8756, 8768, 8780, 8789, 8801, 8813,
+    8825, 8837, 8849, 8860, 8874, 8886, 8895, 8910,
+    8929, 8941, 8953, 8968, 8980, 8992, 9004, 9019,
+    9034, 9049, 9061, 9070, 9079, 9093, 9105, 9120,
+    9131, 9142, 9151, 9163, 9175, 9187, 9202, 9217,
+    9232, 9244, 9256, 9268, 9280, 9292, 9304, 9313,
+    9328, 9337, 9345, 9357, 9372, 9391, 9403, 9415,
+    9430, 9442, 9454, 9469, 9481, 9493, 9505, 9517,
+    9529, 9548, 9562, 9574, 9586, 9598, 9610, 9622,
+    9637, 9646, 9658, 9670, 9679, 9691, 9703, 9715,
+    9727, 9742, 9761, 9773, 9788, 9807, 9822, 9834,
+    9846, 9858, 9867, 9879, 9888, 9900, 9915, 9930,
+    9939, 9951, 9962, 9974, 9989, 10001, 10013, 10028,
+    10043, 10058, 10074, 10086, 10098, 10113, 10122, 10134,
+    10146, 10158, 10177, 10192, 10204, 10215, 10224, 10236,
+    10248, 10260, 10272, 10287, 10299, 10311, 10323, 10335,
+    10344, 10355, 10367, 10376, 10388, 10400, 10412, 10424,
+    10443, 10454, 10463, 10472, 10483, 10495, 10507, 10519,
+    10534, 10546, 10558, 10570, 10584, 10599, 10614, 10626,
+    10635, 10647, 10659, 10671, 10686, 10698, 10713, 10725,
+    10737, 10749, 10764, 10783, 10792, 10806, 10815, 10827,
+    10839, 10854, 10869, 10881, 10893, 10905, 10917, 10931,
+    10943, 10952, 10967, 10979, 10991, 11003, 11012, 11027,
+    11036, 11045, 11054, 11063, 11075, 11084, 11096, 11111,
+    11123, 11135, 11150, 11169, 11181, 11196, 11208, 11220,
+    11232, 11244, 11259, 11278, 11289, 11298, 11313, 11328,
+    11343, 11358, 11370, 11384, 11399, 11417, 11429, 11444,
+    11456, 11465, 11477, 11489, 11498, 11510, 11525, 11537,
+    11549, 11561, 11570, 11582, 11594, 11606, 11615, 11630,
+    11645, 11657, 11666, 11678, 11690, 11702, 11714, 11726,
+    11735, 11747, 11759, 11770, 11781, 11800, 11812, 11824,
+    11836, 11848, 11857, 11869, 11881, 11890, 11905, 11920,
+    11932, 11944, 11956, 11971, 11990, 12002, 12011, 12023,
+    12035, 12044, 12056, 12078, 12093, 12105, 12117, 12129,
+    12141, 12160, 12172, 12184, 12196, 12208, 12220, 12228,
+    12236, 12251, 12266, 12278, 12293, 12302, 12317, 12329,
+    12337, 12352, 12370, 12382, 12394, 12409, 12424, 12436,
+    12448, 12457, 12469, 12481, 12493, 12508, 12520, 12535,
+    12554, 12563, 12578, 12590, 12602, 12614, 12623, 12644,
+    12653, 12665, 12677, 12689, 12698, 12710, 12722, 12731,
+    12740, 12755, 12776, 12794, 12806, 12817, 12828, 12840,
+    12852, 12864, 12876, 12888, 12900, 12915, 12927, 12949,
+    12964, 12973, 12988, 13000, 13014, 13026, 13041, 13053,
+    13065, 13080, 13089, 13098, 13110, 13125, 13134, 13146,
+    13158, 13170, 13179, 13191, 13203, 13215, 13227, 13239,
+    13248, 13257, 13272, 13281, 13293, 13302, 13318, 13327,
+    13339, 13351, 13363, 13375, 13387, 13402, 13416, 13428,
+    13443, 13452, 13464, 13473, 13482, 13494, 13506, 13518,
+    13530, 13545, 13557, 13572, 13587, 13599, 13611, 13623,
+    13638, 13650, 13669, 13681, 13690, 13699, 13711, 13720,
+    13735, 13746, 13758, 13772, 13784, 13799, 13817, 13825,
+    13839, 13851, 13863, 13875, 13890, 13905, 13914, 13926,
+    13938, 13953, 13968, 13983, 13995, 14007, 14016, 14028,
+    14040, 14055, 14067, 14076, 14088, 14100, 14118, 14130,
+    14142, 14157, 14169, 14181, 14190, 14202, 14214, 14226,
+    14241, 14252, 14261, 14270, 14285, 14297, 14309, 14324,
+    14339, 14361, 14373, 14382, 14397, 14408, 14420, 14432,
+    14447, 14459, 14471, 14483, 14495, 14510, 14522, 14533,
+    14545, 14553, 14565, 14577, 14586, 14601, 14612, 14624,
+    14636, 14648, 14660, 14672, 14684, 14696, 14707, 14719,
+    14731, 14746, 14754, 14763, 14775, 14787, 14799, 14814,
+    14826, 14838, 14850, 14859, 14871, 14883, 14895, 14907,
+    14919, 14930, 14942, 14951, 14960, 14972, 14984, 14996,
+    15011, 15023, 15038, 15050, 15062, 15077, 15088, 15100,
+    15115, 15127, 15142, 15154, 15169, 15181, 15197, 15208,
+    15217, 15232, 15241, 15252, 15264, 15276, 15285, 15297,
+    15312, 15331, 15340, 15352, 15361, 15376, 15388, 15400,
+    15409, 15421, 15433, 15452, 15464, 15476, 15488, 15500,
+    15512, 15524, 15536, 15548, 15560, 15575, 15590, 15608,
+    15620, 15632, 15644, 15656, 15665, 15677, 15686, 15705,
+    15717, 15729, 15743, 15758, 15773, 15785, 15797, 15806,
+    15818, 15832, 15847, 15859, 15871, 15883, 15895, 15910,
+    15919, 15931, 15943, 15955, 15974, 15982, 15990, 16002,
+    16014, 16026, 16035, 16044, 16056, 16068, 16083, 16098,
+    16107, 16119, 16131, 16140, 16152, 16164, 16176, 16188,
+    16203, 16215, 16227, 16242, 16254, 16266, 16281, 16299,
+    16311, 16323, 16334, 16349, 16360, 16372, 16383, 16395,
+    16407, 16416, 16431, 16443, 16455, 16464, 16479, 16491,
+    16506, 16518, 16530, 16542, 16554, 16566, 16581, 16599,
+    16611, 16623, 16632, 16641, 16656, 16668, 16680, 16692,
+    16704, 16716, 16731, 16743, 16758, 16770, 16779, 16788,
+    16797, 16809, 16818, 16829, 16841, 16853, 16865, 16876,
+    16887, 16899, 16911, 16923, 16932, 16944, 16959, 16971,
+    16980, 16992, 17001, 17013, 17022, 17037, 17049, 17061,
+    17073, 17085, 17094, 17106, 17118, 17130, 17139, 17151,
+    17166, 17175, 17190, 17208, 17217, 17229, 17243, 17252,
+    17267, 17279, 17291, 17303, 17318, 17327, 17338, 17350,
+    17365, 17380, 17391, 17403, 17415, 17427, 17441, 17452,
+    17464, 17476, 17485, 17494, 17506, 17524, 17536, 17545,
+    17557, 17569, 17578, 17593, 17608, 17617, 17629, 17638,
+    17653, 17667, 17682, 17694, 17703, 17715, 17724, 17736,
+    17748, 17760, 17769, 17781, 17793, 17805, 17817, 17829,
+    17843, 17855, 17870, 17884, 17899, 17911, 17929, 17941,
+    17955, 17967, 17978, 17987, 17999, 18014, 18026, 18035,
+    18047, 18056, 18068, 18080, 18092, 18103, 18118, 18126,
+    18138, 18149, 18161, 18170, 18179, 18190, 18202, 18217,
+    18229, 18241, 18250, 18262, 18274, 18286, 18298, 18307,
+    18322, 18337, 18356, 18368, 18380, 18392, 18404, 18413,
+    18428, 18443, 18455, 18470, 18482, 18494, 18506, 18518,
+    18530, 18542, 18557, 18566, 18578, 18587, 18596, 18611,
+    18623, 18635, 18650, 18662, 18674, 18686, 18698, 18710,
+    18721, 18736, 18748, 18760, 18770, 18782, 18791, 18803,
+    18815, 18830, 18842, 18854, 18865, 18877, 18892, 18907,
+    18919, 18933, 18945, 18960, 18972, 18983, 19002, 19014,
+    19029, 19041, 19056, 19072, 19084, 19099, 19118, 19130,
+    19142, 19157, 19168, 19180, 19192, 19203, 19215, 19226,
+    19238, 19253, 19265, 19277, 19285, 19297, 19306, 19317,
+    19329, 19344, 19356, 19368, 19383, 19397, 19409, 19424,
+    19436, 19451, 19466, 19475, 19487, 19499, 19511, 19523,
+    19535, 19547, 19561, 19570, 19579, 19591, 19603, 19615,
+    19627, 19638, 19650, 19659, 19671, 19683, 19695, 19710,
+    19729, 19741, 19760, 19779, 19790, 19802, 19814, 19829,
+    19841, 19855, 19867, 19879, 19888, 19903, 19915, 19924,
+    19939, 19951, 19966, 19978, 19987, 20002, 20011, 20023,
+    20035, 20047, 20059, 20071, 20086, 20101, 20113, 20125,
+    20137, 20149, 20161, 20173, 20185, 20200, 20215, 20230,
+    20242, 20257, 20269, 20281, 20293, 20305, 20320, 20332,
+    20347, 20366, 20377, 20389, 20401, 20413, 20425, 20434,
+    20449, 20457, 20466, 20481, 20493, 20505, 20520, 20532,
+    20547, 20559, 20574, 20586, 20595, 20607, 20618, 20630,
+    20641, 20653, 20662, 20673, 20685, 20697, 20709, 20721,
+    20730, 20742, 20751, 20763, 20775, 20787, 20798, 20813,
+    20825, 20837, 20846, 20857, 20869, 20881, 20893, 20908,
+    20923, 20941, 20953, 20968, 20979, 20994, 21009, 21021,
+    21033, 21045, 21053, 21065, 21076, 21088, 21100, 21111,
+    21123, 21132, 21147, 21159, 21171, 21183, 21195, 21204,
+    21216, 21228, 21243, 21255, 21267, 21279, 21294, 21303,
+    21318, 21333, 21345, 21356, 21371, 21393, 21405, 21420,
+    21432, 21444, 21456, 21471, 21483, 21498, 21509, 21524,
+    21536, 21551, 21563, 21575, 21584, 21596, 21608, 21620,
+    21639, 21648, 21660, 21675, 21684, 21696, 21711, 21720,
+    21732, 21744, 21753, 21765, 21784, 21796, 21808, 21817,
+    21829, 21840, 21852, 21864, 21876, 21888, 21897, 21912,
+    21931, 21940, 21949, 21961, 21973, 21985, 21997, 22006,
+    22018, 22030, 22045, 22057, 22069, 22081, 22096, 22111,
+    22120, 22132, 22144, 22153, 22165, 22176, 22188, 22197,
+    22209, 22220, 22241, 22256, 22268, 22283, 22295, 22303,
+    22315, 22327, 22339, 22351, 22366, 22384, 22396, 22405,
+    22416, 22431, 22443, 22455, 22467, 22479, 22491, 22503,
+    22515, 22530, 22542, 22554, 22566, 22578, 22593, 22605,
+    22617, 22629, 22647, 22659, 22671, 22683, 22692, 22704,
+    22713, 22725, 22737, 22746, 22754, 22769, 22781, 22793,
+    22805, 22816, 22828, 22837, 22846, 22857, 22869, 22881,
+    22896, 22912, 22927, 22939, 22951, 22965, 22974, 22989,
+    23001, 23015, 23026, 23038, 23050, 23062, 23077, 23089,
+    23101, 23113, 23125, 23137, 23149, 23158, 23170, 23185,
+    23203, 23218, 23230, 23239, 23251, 23267, 23279, 23294,
+    23305, 23317, 23329, 23341, 23353, 23368, 23380, 23392,
+    23406, 23418, 23430, 23444, 23456, 23475, 23484, 23493,
+    23508, 23522, 23534, 23546, 23558, 23570, 23585, 23597,
+    23609, 23624, 23639, 23654, 23665, 23677, 23689, 23701,
+    23713, 23728, 23740, 23749, 23761, 23777, 23792, 23801,
+    23816, 23828, 23847, 23862, 23874, 23889, 23905, 23917,
+    23929, 23941, 23956, 23968, 23983, 23998, 24010, 24025,
+    24040, 24051, 24066, 24085, 24104, 24116, 24128, 24140,
+    24152, 24167, 24182, 24191, 24206, 24218, 24227, 24242,
+    24254, 24266, 24278, 24290, 24302, 24317, 24329, 24338,
+    24350, 24362, 24374, 24389, 24408, 24420, 24432, 24444,
+    24456, 24467, 24479, 24488, 24500, 24526, 24538, 24550,
+    24559, 24574, 24586, 24597, 24609, 24621, 24633, 24642,
+    24654, 24666, 24681, 24696, 24705, 24720, 24729, 24738,
+    24750, 24762, 24774, 24786, 24801, 24813, 24825, 24837,
+    24852, 24864, 24876, 24888, 24900, 24915, 24927, 24936,
+    24951, 24966, 24981, 24993, 25005, 25017, 25032, 25044,
+    25059, 25071, 25086, 25098, 25110, 25122, 25131, 25143,
+    25151, 25163, 25175, 25187, 25199, 25214, 25226, 25241,
+    25256, 25268, 25280, 25292, 25307, 25321, 25336, 25348,
+    25360, 25375, 25387, 25399, 25411, 25423, 25438, 25447,
+    25459, 25468, 25483, 25495, 25510, 25522, 25537, 25546,
+    25558, 25570, 25582, 25594, 25606, 25618, 25630, 25645,
+    25660, 25672, 25684, 25696, 25708, 25716, 25725, 25740,
+    25755, 25767, 25776, 25788, 25800, 25812, 25824, 25836,
+    25851, 25866, 25881, 25893, 25902, 25917, 25938, 25947,
+    25962, 25974, 25986, 25998, 26010, 26025, 26040, 26052,
+    26061, 26073, 26085, 26099, 26111, 26126, 26138, 26150,
+    26162, 26174, 26186, 26198, 26210, 26225, 26240, 26252,
+    26261, 26276, 26288, 26300, 26312, 26324, 26339, 26351,
+    26363, 26372, 26384, 26396, 26408, 26420, 26428, 26443,
+    26455, 26466, 26475, 26490, 26512, 26524, 26543, 26558,
+    26570, 26585, 26594, 26606, 26618, 26640, 26652, 26661,
+    26673, 26685, 26697, 26706, 26715, 26727, 26739, 26754,
+    26765, 26777, 26792, 26803, 26815, 26827, 26839, 26851,
+    26865, 26880, 26892, 26904, 26916, 26928, 26940, 26952,
+    26967, 26979, 26991, 27003, 27015, 27024, 27036,
+};
 
-const EmojiItem english_emoji_table[] = {
-"a"       , "🅰",
-"ab"      , "🆎",
-"abacus"  , "🧮",
-"abc"     , "🔤",
-"abcd"    , "🔡",
-"access"  , "♿",
-"actor"   , "🧑‍🎤",
-"adore"   , "🥰",
-"adult"   , "🧑",
-"aerial"  , "🚡",
-"afro"    , "🦱",
-"aid"     , "⛑",
-"alarm"   , "⏰",
-"alien"   , "👽",
-"alpaca"  , "🦙",
-"amoeba"  , "🦠",
-"anchor"  , "⚓",
-"angel"   , "😇",
-"angry"   , "😡",
-"ant"     , "🐜",
-"ape"     , "🦧",
-"apple"   , "🍎",
-"archer"  , "🏹",
-"arctic"  , "🐻‍❄",
-"arepa"   , "🫓",
-"army"    , "🪖",
-"arrow"   , "💘",
-"art"     , "🎭",
-"artist"  , "🧑‍🎨",
-"ashes"   , "⚱",
-"ask"     , "🙏",
-"atm"     , "🏧",
-"atom"    , "⚛",
-"autumn"  , "🥮",
-"axe"     , "🪓",
-"b"       , "🅱",
-"baby"    , "👶",
-"back"    , "🔙",
-"bacon"   , "🥓",
-"badge"   , "📛",
-"badger"  , "🦡",
-"bag"     , "👜",
-"bagel"   , "🥯",
-"bait"    , "🪤",
-"bakery"  , "🥯",
-"bald"    , "🦲",
-"ball"    , "🏌",
-"ballet"  , "🩰",
-"ballot"  , "🗳",
-"bamboo"  , "🎍",
-"banana"  , "🍌",
-"banjo"   , "🪕",
-"bank"    , "🏦",
-"banner"  , "🎋",
-"bar"     , "🍫",
-"barber"  , "💇",
-"basket"  , "🧺",
-"bat"     , "🦇",
-"bath"    , "🛀",
-"beach"   , "🏖",
-"beacon"  , "🚨",
-"bead"    , "🧿",
-"beads"   , "📿",
-"bear"    , "🐻",
-"beard"   , "🧔",
-"bearer"  , "🐍",
-"beat"    , "🪘",
-"beauty"  , "💇",
-"beaver"  , "🦫",
-"bed"     , "🛏",
-"bee"     , "🐝",
-"beer"    , "🍺",
-"beetle"  , "🪲",
-"bell"    , "🛎",
-"bento"   , "🍱",
-"berry"   , "🫐",
-"biceps"  , "💪",
-"bike"    , "🚵",
-"biking"  , "🚴",
-"bikini"  , "👙",
-"bill"    , "💴",
-"bird"    , "🪶",
-"birdie"  , "🏸",
-"bison"   , "🦬",
-"bisque"  , "🦞",
-"black"   , "🖤",
-"bleed"   , "🩸",
-"blind"   , "🧑‍🦯",
-"blond"   , "👱",
-"blonde"  , "👱‍♀",
-"blow"    , "🍃",
-"blue"    , "🫐",
-"blush"   , "😊",
-"boar"    , "🐗",
-"board"   , "🛹",
-"boat"    , "🚣",
-"body"    , "👂",
-"bolt"    , "🔩",
-"bomb"    , "💣",
-"bone"    , "🦴",
-"book"    , "📔",
-"books"   , "📚",
-"boom"    , "💥",
-"boot"    , "🥾",
-"bored"   , "🥱",
-"boring"  , "🪴",
-"bottle"  , "🍼",
-"bow"     , "🙇",
-"bowing"  , "🙇‍♂",
-"bowl"    , "🍜",
-"box"     , "🍱",
-"boxing"  , "🥊",
-"boy"     , "👦",
-"brain"   , "🧠",
-"bread"   , "🍞",
-"break"   , "💔",
-"breast"  , "🤱",
-"breath"  , "🫁",
-"brick"   , "🧱",
-"bricks"  , "🧱",
-"bride"   , "👰",
-"bridge"  , "🌉",
-"briefs"  , "🩲",
-"bright"  , "😎",
-"broken"  , "💔",
-"bronze"  , "🥉",
-"broom"   , "🧹",
-"brown"   , "🤎",
-"brush"   , "🪥",
-"bubble"  , "🧋",
-"bucket"  , "🪣",
-"bug"     , "🪲",
-"bulb"    , "💡",
-"bull"    , "🐂",
-"bullet"  , "🚅",
-"bunny"   , "🐰",
-"burger"  , "🍔",
-"bus"     , "🚌",
-"bust"    , "👤",
-"butter"  , "🧈",
-"button"  , "🔼",
-"c"       , "©",
-"cable"   , "🚠",
-"cactus"  , "🌵",
-"cake"    , "🍥",
-"call"    , "🤙",
-"camel"   , "🐪",
-"camera"  , "🤳",
-"can"     , "🥫",
-"cancel"  , "✖",
-"candle"  , "🕯",
-"candy"   , "🍬",
-"canoe"   , "🛶",
-"cap"     , "👲",
-"car"     , "🚃",
-"card"    , "♠",
-"care"    , "💅",
-"carp"    , "🎏",
-"carrot"  , "🥕",
-"cart"    , "🛒",
-"cask"    , "🪣",
-"castle"  , "🏯",
-"cat"     , "😺",
-"catch"   , "🪝",
-"cd"      , "💿",
-"cell"    , "📱",
-"cereal"  , "🥣",
-"chain"   , "⛓",
-"chains"  , "⛓",
-"chair"   , "💺",
-"chapel"  , "💒",
-"charm"   , "🧿",
-"chart"   , "💹",
-"check"   , "✅",
-"cheese"  , "🫕",
-"chef"    , "🧑‍🍳",
-"cherry"  , "🌸",
-"chess"   , "♟",
-"chest"   , "🧰",
-"chick"   , "🐣",
-"child"   , "🧒",
-"chime"   , "🎐",
-"chop"    , "🥩",
-"church"  , "⛪",
-"cinema"  , "🎥",
-"circle"  , "⏺",
-"circus"  , "🎪",
-"citrus"  , "🍋",
-"city"    , "🏙",
-"cl"      , "🆑",
-"claim"   , "🛄",
-"clamp"   , "🗜",
-"clap"    , "👏",
-"claus"   , "🎅",
-"claws"   , "🦞",
-"clay"    , "🧱",
-"clean"   , "🪥",
-"climb"   , "🪜",
-"clink"   , "🍻",
-"clock"   , "⌚",
-"closed"  , "😚",
-"closet"  , "🚾",
-"cloud"   , "☁",
-"clover"  , "🍀",
-"clown"   , "🤡",
-"clue"    , "🧩",
-"coat"    , "🧥",
-"coder"   , "🧑‍💻",
-"coffee"  , "☕",
-"coffin"  , "⚰",
-"cog"     , "⚙",
-"coin"    , "🪙",
-"cold"    , "😅",
-"comet"   , "☄",
-"comic"   , "💢",
-"conga"   , "🪘",
-"congee"  , "🥣",
-"cook"    , "🧑‍🍳",
-"cooked"  , "🍚",
-"cookie"  , "🍪",
-"cool"    , "😎",
-"cop"     , "👮",
-"cork"    , "🍾",
-"corn"    , "🌽",
-"couch"   , "🛋",
-"couple"  , "🧑‍🤝‍🧑",
-"cover"   , "📔",
-"cow"     , "🐮",
-"cowboy"  , "🤠",
-"crab"    , "🦀",
-"crayon"  , "🖍",
-"cream"   , "🍦",
-"credit"  , "💳",
-"crook"   , "🪝",
-"cross"   , "🤞",
-"crown"   , "👑",
-"crush"   , "🥰",
-"cry"     , "😢",
-"cup"     , "🍵",
-"cupid"   , "💘",
-"curl"    , "📃",
-"curly"   , "🦱",
-"curry"   , "🍛",
-"curve"   , "🪝",
-"cygnet"  , "🦢",
-"dagger"  , "🗡",
-"dairy"   , "🧈",
-"dam"     , "🦫",
-"dance"   , "🕺",
-"dancer"  , "👯",
-"danger"  , "⚡",
-"dango"   , "🍡",
-"dark"    , "🌑",
-"dart"    , "🎯",
-"dash"    , "💨",
-"date"    , "📅",
-"dazed"   , "😳",
-"deaf"    , "🧏",
-"death"   , "💀",
-"deer"    , "🦌",
-"demon"   , "👿",
-"dental"  , "🪥",
-"desert"  , "🏜",
-"devil"   , "👿",
-"dharma"  , "☸",
-"dialog"  , "💬",
-"diaper"  , "🧷",
-"dice"    , "🎲",
-"die"     , "🎲",
-"diesel"  , "⛽",
-"dim"     , "🔅",
-"dish"    , "📡",
-"disk"    , "💽",
-"divide"  , "➗",
-"diving"  , "🦪",
-"diya"    , "🪔",
-"dizzy"   , "🥴",
-"djinn"   , "🧞",
-"dna"     , "🧬",
-"doctor"  , "😷",
-"dodo"    , "🦤",
-"dog"     , "🐶",
-"doll"    , "🪆",
-"dollar"  , "💰",
-"donut"   , "🍩",
-"door"    , "🚪",
-"double"  , "⏩",
-"doubt"   , "🤷",
-"dove"    , "🕊",
-"down"    , "👇",
-"dragon"  , "🐲",
-"dress"   , "👗",
-"drink"   , "🫖",
-"drop"    , "☔",
-"drum"    , "🪘",
-"duck"    , "🦆",
-"dung"    , "💩",
-"dupe"    , "♟",
-"dusk"    , "🌆",
-"dvd"     , "📀",
-"eagle"   , "🦅",
-"ear"     , "👂",
-"earbud"  , "🎧",
-"earth"   , "🌍",
-"east"    , "➡",
-"egg"     , "🥚",
-"eight"   , "🕗",
-"eject"   , "⏏",
-"eleven"  , "🕚",
-"elf"     , "🧝",
-"email"   , "✉",
-"emblem"  , "🔱",
-"end"     , "🔚",
-"engine"  , "🚂",
-"entry"   , "⛔",
-"euro"    , "💶",
-"evil"    , "🙈",
-"ewe"     , "🐑",
-"eye"     , "😄",
-"eyes"    , "🤩",
-"face"    , "🥸",
-"fairy"   , "🧚",
-"family"  , "👪",
-"farmer"  , "🧑‍🌾",
-"fast"    , "⏩",
-"father"  , "🎅",
-"favor"   , "🙇‍♂",
-"fax"     , "📠",
-"fear"    , "😨",
-"feet"    , "🐾",
-"female"  , "🐑",
-"fencer"  , "🤺",
-"ferris"  , "🎡",
-"ferry"   , "⛴",
-"fever"   , "🦟",
-"field"   , "🏑",
-"file"    , "📁",
-"filing"  , "🗄",
-"film"    , "🎞",
-"finger"  , "🖐",
-"fire"    , "🚒",
-"first"   , "🥇",
-"fish"    , "🐟",
-"fist"    , "✊",
-"five"    , "🕔",
-"flag"    , "🏳‍⚧",
-"flame"   , "🔥",
-"flash"   , "📸",
-"flex"    , "💪",
-"flight"  , "🪶",
-"floor"   , "🤣",
-"floppy"  , "💾",
-"flower"  , "💐",
-"fly"     , "🪰",
-"fog"     , "🌁",
-"foggy"   , "🌁",
-"folder"  , "📁",
-"fondue"  , "🫕",
-"food"    , "🫒",
-"foot"    , "🦶",
-"fork"    , "🍽",
-"four"    , "🍀",
-"fox"     , "🦊",
-"frame"   , "🪟",
-"frames"  , "🎞",
-"free"    , "🆓",
-"french"  , "🥐",
-"fried"   , "🍤",
-"fries"   , "🍟",
-"frog"    , "🐸",
-"frown"   , "🙁",
-"fruit"   , "🍇",
-"frying"  , "🍳",
-"fuel"    , "⛽",
-"fuji"    , "🗻",
-"full"    , "💯",
-"game"    , "🏐",
-"garden"  , "🏡",
-"garlic"  , "🧄",
-"gas"     , "⛽",
-"gear"    , "⚙",
-"geek"    , "🤓",
-"gem"     , "💎",
-"gene"    , "🧬",
-"genie"   , "🧞",
-"ghost"   , "👻",
-"gift"    , "🧧",
-"ginger"  , "🦰",
-"girl"    , "👧",
-"glass"   , "🥛",
-"globe"   , "🌍",
-"glove"   , "🥎",
-"gloves"  , "🧤",
-"glow"    , "🌟",
-"goal"    , "🥍",
-"goat"    , "🐐",
-"goblin"  , "👺",
-"gold"    , "🪙",
-"golf"    , "🏌",
-"good"    , "🦸",
-"goofy"   , "🤪",
-"grain"   , "🌾",
-"grape"   , "🍇",
-"grapes"  , "🍇",
-"graph"   , "💹",
-"grave"   , "🪦",
-"gray"    , "🦳",
-"green"   , "💚",
-"grin"    , "😀",
-"groom"   , "🤵",
-"grow"    , "🪴",
-"growth"  , "💹",
-"guard"   , "💂",
-"guide"   , "🦮",
-"guitar"  , "🎸",
-"gun"     , "🔫",
-"gyro"    , "🥙",
-"hair"    , "👱",
-"halo"    , "😇",
-"hammer"  , "🔨",
-"hand"    , "👋",
-"happy"   , "🙋",
-"hashi"   , "🥢",
-"hat"     , "🤠",
-"head"    , "🗣",
-"hear"    , "🙉",
-"heart"   , "🫀",
-"hearts"  , "🥰",
-"heavy"   , "🪨",
-"heel"    , "👠",
-"hello"   , "🫂",
-"helmet"  , "🪖",
-"help"    , "💁",
-"herb"    , "🌿",
-"herd"    , "🦬",
-"hero"    , "🦸",
-"hidden"  , "🥷",
-"hijab"   , "🧕",
-"hike"    , "🚶",
-"hiking"  , "🥾",
-"hindu"   , "🛕",
-"hippo"   , "🦛",
-"hit"     , "🎯",
-"hocho"   , "🔪",
-"hockey"  , "🏑",
-"hoist"   , "🛗",
-"hold"    , "🧑‍🤝‍🧑",
-"hole"    , "🕳",
-"home"    , "🏠",
-"honey"   , "🍯",
-"hook"    , "🪝",
-"hoop"    , "🏀",
-"hooray"  , "🙌",
-"horn"    , "🥳",
-"horns"   , "😈",
-"horse"   , "🏇",
-"hot"     , "🥵",
-"hotdog"  , "🌭",
-"hotel"   , "🛌",
-"house"   , "🪴",
-"houses"  , "🏘",
-"hug"     , "🫂",
-"hump"    , "🐪",
-"hurt"    , "🤕",
-"hushed"  , "😯",
-"hut"     , "🛖",
-"i"       , "ℹ",
-"ice"     , "🍦",
-"id"      , "🆔",
-"idea"    , "💡",
-"ill"     , "🤒",
-"imp"     , "👿",
-"inbox"   , "📥",
-"index"   , "👈",
-"injury"  , "🤕",
-"ink"     , "🔏",
-"input"   , "🔠",
-"insect"  , "🪲",
-"inside"  , "💠",
-"iron"    , "🧇",
-"ironic"  , "😼",
-"islam"   , "🕌",
-"island"  , "🏝",
-"jack"    , "🎃",
-"jacket"  , "🧥",
-"jeans"   , "👖",
-"jewel"   , "💎",
-"jiaozi"  , "🥟",
-"jigsaw"  , "🧩",
-"jockey"  , "🏇",
-"joey"    , "🦘",
-"joke"    , "😜",
-"joker"   , "🃏",
-"joy"     , "😂",
-"judge"   , "🧑‍⚖",
-"judo"    , "🥋",
-"jug"     , "🏺",
-"juggle"  , "🤹",
-"juice"   , "🥤",
-"jump"    , "🦘",
-"kaaba"   , "🕋",
-"kale"    , "🥬",
-"karate"  , "🥋",
-"kebab"   , "🥙",
-"key"     , "🔐",
-"kick"    , "🦵",
-"kimono"  , "👘",
-"king"    , "👑",
-"kiss"    , "😘",
-"kite"    , "🪁",
-"kiwi"    , "🥝",
-"kneel"   , "🧎",
-"knife"   , "🍽",
-"knit"    , "🧶",
-"knobs"   , "🎛",
-"knot"    , "🪢",
-"koala"   , "🐨",
-"lab"     , "🧪",
-"label"   , "🏷",
-"ladder"  , "🪜",
-"lamp"    , "🪔",
-"laptop"  , "💻",
-"large"   , "🦣",
-"lather"  , "🧼",
-"latin"   , "🔠",
-"laugh"   , "😆",
-"lavash"  , "🫓",
-"lazy"    , "🦥",
-"leaf"    , "🌿",
-"ledger"  , "📒",
-"left"    , "◀",
-"leg"     , "🦵",
-"lemon"   , "🍋",
-"letter"  , "💌",
-"level"   , "🎚",
-"lie"     , "🤥",
-"life"    , "🧬",
-"lift"    , "🛗",
-"lifter"  , "🏋",
-"light"   , "🪶",
-"limb"    , "🦵",
-"link"    , "🖇",
-"lion"    , "🦁",
-"lips"    , "💋",
-"liquor"  , "🥃",
-"litter"  , "🚮",
-"lizard"  , "🦎",
-"llama"   , "🦙",
-"loaf"    , "🍞",
-"lock"    , "🔓",
-"locked"  , "🔒",
-"locker"  , "🛅",
-"log"     , "🪵",
-"loop"    , "➰",
-"lorry"   , "🚛",
-"lotion"  , "🧴",
-"loud"    , "🔊",
-"love"    , "😍",
-"low"     , "🔅",
-"luck"    , "🤞",
-"lumber"  , "🪚",
-"lungs"   , "🫁",
-"m"       , "Ⓜ",
-"mad"     , "😡",
-"mage"    , "🧙",
-"maggot"  , "🪰",
-"magic"   , "🪄",
-"magnet"  , "🧲",
-"mail"    , "💌",
-"maize"   , "🌽",
-"makeup"  , "💄",
-"male"    , "🐏",
-"man"     , "👨",
-"mango"   , "🥭",
-"map"     , "🗺",
-"maple"   , "🍁",
-"mark"    , "❣",
-"marker"  , "📑",
-"mask"    , "😷",
-"mate"    , "🧉",
-"math"    , "➕",
-"maze"    , "🌽",
-"meat"    , "🍖",
-"medal"   , "🎖",
-"medium"  , "🔉",
-"meh"     , "😐",
-"melon"   , "🍈",
-"melted"  , "🫕",
-"memo"    , "📝",
-"men"     , "👯‍♂",
-"mercy"   , "🥺",
-"merman"  , "🧜",
-"metal"   , "🪙",
-"metro"   , "🚇",
-"mic"     , "🎙",
-"milk"    , "🧋",
-"mining"  , "⛏",
-"minus"   , "➖",
-"mirror"  , "🪞",
-"moai"    , "🗿",
-"mobile"  , "📱",
-"mode"    , "📳",
-"molusc"  , "🦑",
-"money"   , "🪙",
-"monkey"  , "🙈",
-"moon"    , "🌑",
-"mortar"  , "🧱",
-"mosque"  , "🕌",
-"mother"  , "🤶",
-"motor"   , "🛵",
-"mouse"   , "🐭",
-"mouth"   , "😃",
-"movie"   , "🎥",
-"moyai"   , "🗿",
-"mug"     , "🍺",
-"munch"   , "😱",
-"muscle"  , "💪",
-"museum"  , "🖼",
-"music"   , "🎼",
-"mute"    , "🔇",
-"naan"    , "🫓",
-"nail"    , "💅",
-"name"    , "📛",
-"nazar"   , "🧿",
-"neck"    , "🧣",
-"needle"  , "🪡",
-"nerd"    , "🤓",
-"net"     , "🥅",
-"new"     , "🆕",
-"news"    , "📰",
-"ng"      , "🆖",
-"nib"     , "✒",
-"night"   , "🌃",
-"nine"    , "🕘",
-"ninja"   , "🥷",
-"no"      , "⛔",
-"noodle"  , "🍜",
-"north"   , "⬆",
-"nose"    , "🥸",
-"not"     , "⛔",
-"note"    , "🎵",
-"notes"   , "🎶",
-"nurse"   , "🧑‍⚕",
-"nut"     , "🥜",
-"o"       , "⭕",
-"ocean"   , "🌊",
-"oden"    , "🍢",
-"off"     , "📴",
-"ogre"    , "👹",
-"oh"      , "🙀",
-"oil"     , "🛢",
-"old"     , "🧓",
-"olive"   , "🫒",
-"om"      , "🕉",
-"on"      , "🔛",
-"once"    , "🔂",
-"one"     , "🕐",
-"onion"   , "🧅",
-"open"    , "😃",
-"orange"  , "🧡",
-"organ"   , "🫀",
-"otter"   , "🦦",
-"outbox"  , "📤",
-"owl"     , "🦉",
-"ox"      , "🐂",
-"oyster"  , "🦪",
-"pad"     , "🗒",
-"paddle"  , "🏓",
-"paella"  , "🥘",
-"page"    , "📃",
-"pager"   , "📟",
-"pail"    , "🪣",
-"palm"    , "🤦",
-"pan"     , "🍳",
-"panda"   , "🐼",
-"pants"   , "👖",
-"paper"   , "📜",
-"parcel"  , "📦",
-"park"    , "🏞",
-"parlor"  , "💇",
-"parrot"  , "🦜",
-"part"    , "〽",
-"party"   , "🪅",
-"pasta"   , "🍝",
-"pastry"  , "🍥",
-"patrol"  , "🚓",
-"pause"   , "⏯",
-"paw"     , "🐾",
-"pc"      , "💻",
-"peace"   , "🕊",
-"peach"   , "🍑",
-"peahen"  , "🦚",
-"peanut"  , "🥜",
-"pear"    , "🍐",
-"pearl"   , "🧋",
-"pen"     , "✒",
-"pencil"  , "✏",
-"pepper"  , "🫑",
-"person"  , "🧑",
-"pest"    , "🪰",
-"pester"  , "🦡",
-"pet"     , "🐶",
-"phone"   , "🤳",
-"piano"   , "🎹",
-"pick"    , "⛏",
-"picket"  , "🪧",
-"pickle"  , "🥒",
-"pickup"  , "🛻",
-"picnic"  , "🧺",
-"pie"     , "🥧",
-"piece"   , "🧩",
-"pig"     , "🐷",
-"pill"    , "💊",
-"pilot"   , "🧑‍✈",
-"pin"     , "📌",
-"pine"    , "🎍",
-"pink"    , "🏳‍⚧",
-"pirate"  , "🦜",
-"pistol"  , "🔫",
-"pita"    , "🫓",
-"pizza"   , "🍕",
-"plane"   , "🧑‍✈",
-"plant"   , "🪴",
-"plate"   , "🍽",
-"play"    , "▶",
-"please"  , "🙏",
-"plug"    , "🔌",
-"plus"    , "➕",
-"plush"   , "🧸",
-"point"   , "👈",
-"pole"    , "💈",
-"police"  , "👮",
-"polish"  , "💅",
-"polo"    , "🤽",
-"poo"     , "💩",
-"poodle"  , "🐩",
-"poop"    , "💩",
-"popper"  , "🎉",
-"porous"  , "🧽",
-"post"    , "🏣",
-"postal"  , "📯",
-"pot"     , "🫕",
-"potato"  , "🥔",
-"pouch"   , "👝",
-"pound"   , "💷",
-"prawn"   , "🍤",
-"pray"    , "🙏",
-"prayer"  , "🤲",
-"pretty"  , "🦋",
-"pride"   , "🏳‍🌈",
-"prince"  , "🤴",
-"print"   , "👣",
-"prize"   , "🏆",
-"proof"   , "🧾",
-"proud"   , "🥲",
-"puck"    , "🏒",
-"pulse"   , "🫀",
-"pump"    , "⛽",
-"punch"   , "✊",
-"purple"  , "💜",
-"purse"   , "👛",
-"puzzle"  , "🧩",
-"queen"   , "👑",
-"quench"  , "🧯",
-"quiet"   , "🤫",
-"r"       , "®",
-"rabbit"  , "🐰",
-"racing"  , "🏃‍♂",
-"radio"   , "📻",
-"rage"    , "😡",
-"rain"    , "⛈",
-"raised"  , "🤚",
-"ram"     , "🐏",
-"ramen"   , "🍜",
-"rat"     , "🐀",
-"rays"    , "☀",
-"razor"   , "🪒",
-"record"  , "⏺",
-"red"     , "😡",
-"reload"  , "🔃",
-"repeat"  , "🔁",
-"resort"  , "⛵",
-"rewind"  , "⏪",
-"rhythm"  , "🪘",
-"ribbon"  , "💝",
-"rice"    , "🌾",
-"right"   , "▶",
-"ring"    , "💍",
-"roach"   , "🪳",
-"road"    , "🛣",
-"robot"   , "🤖",
-"rock"    , "🪨",
-"rocket"  , "🧑‍🚀",
-"roll"    , "🥐",
-"rolled"  , "🗞",
-"roller"  , "🛼",
-"rope"    , "🪢",
-"rose"    , "🌹",
-"rugby"   , "🏉",
-"ruler"   , "📏",
-"rung"    , "🪜",
-"rushed"  , "😰",
-"russia"  , "🪆",
-"sad"     , "😢",
-"safety"  , "🦺",
-"sake"    , "🍶",
-"salad"   , "🥗",
-"salon"   , "💆",
-"salt"    , "🧂",
-"sand"    , "⌛",
-"sandal"  , "👡",
-"santa"   , "🎅",
-"sari"    , "🥻",
-"sash"    , "🎽",
-"sassy"   , "💁",
-"saturn"  , "🪐",
-"sauna"   , "🧖",
-"saw"     , "🪚",
-"sax"     , "🎷",
-"scale"   , "⚖",
-"scales"  , "🧑‍⚖",
-"scared"  , "😨",
-"scarf"   , "🧣",
-"school"  , "🏫",
-"score"   , "💯",
-"scream"  , "😱",
-"screw"   , "🪛",
-"scroll"  , "📜",
-"scuba"   , "🤿",
-"sea"     , "⛵",
-"seal"    , "🦭",
-"search"  , "🔍",
-"seat"    , "💺",
-"second"  , "🥈",
-"secure"  , "🔐",
-"see"     , "🙈",
-"selfie"  , "🤳",
-"semi"    , "🚛",
-"sent"    , "📤",
-"set"     , "📐",
-"seven"   , "🕖",
-"sewing"  , "🪡",
-"shake"   , "🤝",
-"shaker"  , "🧂",
-"shark"   , "🦈",
-"sharp"   , "🪒",
-"shave"   , "🪒",
-"shaved"  , "🍧",
-"shaven"  , "🦲",
-"sheep"   , "🐏",
-"shell"   , "🐚",
-"shield"  , "🛡",
-"shinto"  , "⛩",
-"ship"    , "⚓",
-"shirt"   , "🎽",
-"shoe"    , "👞",
-"shorts"  , "🩳",
-"shot"    , "🥃",
-"shower"  , "🚿",
-"shrimp"  , "🍤",
-"shrine"  , "⛩",
-"shrug"   , "🤷",
-"shush"   , "🤫",
-"sick"    , "😷",
-"sign"    , "🪧",
-"signal"  , "🚥",
-"silent"  , "😶",
-"silver"  , "🪙",
-"singer"  , "🧑‍🎤",
-"sit"     , "🪑",
-"six"     , "🕕",
-"skate"   , "🛼",
-"skewer"  , "🍢",
-"ski"     , "⛷",
-"skier"   , "⛷",
-"skill"   , "🤹",
-"skis"    , "🎿",
-"skull"   , "💀",
-"skunk"   , "🦨",
-"sled"    , "🛷",
-"sledge"  , "🛷",
-"sleep"   , "😪",
-"sleigh"  , "🛷",
-"sleuth"  , "🕵",
-"slice"   , "🍕",
-"slider"  , "🎚",
-"slot"    , "🎰",
-"sloth"   , "🦥",
-"slow"    , "🦥",
-"sly"     , "🦝",
-"small"   , "🤪",
-"smile"   , "😃",
-"smirk"   , "😏",
-"snail"   , "🐌",
-"snake"   , "🐍",
-"snare"   , "🪤",
-"sneeze"  , "🤧",
-"snow"    , "⛷",
-"soap"    , "🧼",
-"soar"    , "🪁",
-"sob"     , "😭",
-"soccer"  , "⚽",
-"socks"   , "🧦",
-"soda"    , "🥤",
-"soft"    , "🍦",
-"solid"   , "🪨",
-"soon"    , "🔜",
-"sorry"   , "🙇",
-"sos"     , "🆘",
-"south"   , "⬇",
-"sow"     , "🐖",
-"space"   , "🛰",
-"speak"   , "🙊",
-"speech"  , "💬",
-"speed"   , "🚄",
-"spider"  , "🕷",
-"spiny"   , "🦔",
-"spiral"  , "🐚",
-"split"   , "🪓",
-"spock"   , "🖖",
-"sponge"  , "🧽",
-"spool"   , "🧵",
-"spoon"   , "🥄",
-"spots"   , "🦒",
-"spy"     , "🕵",
-"square"  , "⏹",
-"squid"   , "🦑",
-"staff"   , "⚕",
-"stand"   , "🧍",
-"star"    , "🤩",
-"statue"  , "🗽",
-"steak"   , "🥩",
-"steam"   , "🚂",
-"step"    , "🪜",
-"stew"    , "🍲",
-"stick"   , "🍢",
-"stink"   , "🦨",
-"stomp"   , "🦶",
-"stone"   , "🪨",
-"stop"    , "🚏",
-"store"   , "🏪",
-"straw"   , "🧃",
-"string"  , "🧵",
-"stripe"  , "🦓",
-"studio"  , "🎙",
-"stuffy"  , "🧐",
-"subway"  , "🚇",
-"suit"    , "🕴",
-"sun"     , "😎",
-"sunny"   , "☀",
-"sunset"  , "🌆",
-"sushi"   , "🍣",
-"swan"    , "🦢",
-"sweat"   , "😅",
-"sweet"   , "🍠",
-"swim"    , "🏊",
-"swirl"   , "🍥",
-"sword"   , "🤺",
-"swords"  , "⚔",
-"tabs"    , "📑",
-"taco"    , "🌮",
-"tada"    , "🎉",
-"talk"    , "🦜",
-"tamale"  , "🫔",
-"tao"     , "☯",
-"taoist"  , "☯",
-"tape"    , "📼",
-"target"  , "🎯",
-"taste"   , "😝",
-"taxi"    , "🚕",
-"tea"     , "🧋",
-"teacup"  , "🍵",
-"teapot"  , "🫖",
-"tear"    , "🥲",
-"teeth"   , "🪥",
-"teller"  , "🏧",
-"temple"  , "🛕",
-"ten"     , "🕙",
-"tennis"  , "🎾",
-"tent"    , "⛺",
-"thanks"  , "🫂",
-"third"   , "🥉",
-"thirty"  , "🕧",
-"thongs"  , "🩴",
-"thread"  , "🧵",
-"three"   , "🕒",
-"thumb"   , "👍",
-"tichel"  , "🧕",
-"ticket"  , "🎟",
-"tie"     , "🪢",
-"tiger"   , "🐯",
-"timber"  , "🪵",
-"timer"   , "⌛",
-"tipsy"   , "🥴",
-"tired"   , "😩",
-"tm"      , "™",
-"toilet"  , "🪠",
-"tomato"  , "🍅",
-"tongue"  , "😛",
-"tool"    , "🪚",
-"tooth"   , "🦷",
-"top"     , "🎩",
-"tophat"  , "🎩",
-"torch"   , "🔦",
-"tower"   , "🗼",
-"toy"     , "🪀",
-"train"   , "🚂",
-"tram"    , "🚃",
-"trap"    , "🪤",
-"travel"  , "🧳",
-"tray"    , "📤",
-"tree"    , "🌲",
-"trend"   , "📈",
-"trophy"  , "🏆",
-"truck"   , "🛻",
-"tshirt"  , "👕",
-"tulip"   , "🌷",
-"turban"  , "👳",
-"turkey"  , "🦃",
-"turtle"  , "🐢",
-"tusk"    , "🦣",
-"tuxedo"  , "🤵",
-"tv"      , "📺",
-"twelve"  , "🕛",
-"twine"   , "🪢",
-"twins"   , "👬",
-"twist"   , "🪢",
-"two"     , "🕑",
-"ufo"     , "👽",
-"undead"  , "🧛",
-"unlock"  , "🔓",
-"up"      , "👆",
-"upward"  , "📈",
-"urn"     , "⚱",
-"v"       , "✌",
-"vat"     , "🪣",
-"veil"    , "👰",
-"versus"  , "🆚",
-"vest"    , "🦺",
-"vhs"     , "📼",
-"vice"    , "🗜",
-"video"   , "📻",
-"view"    , "🪟",
-"violin"  , "🎻",
-"virus"   , "🦟",
-"vomit"   , "🤢",
-"vs"      , "🆚",
-"vulcan"  , "🖖",
-"waffle"  , "🧇",
-"walk"    , "🚶",
-"wall"    , "🧱",
-"waning"  , "🌖",
-"watch"   , "⌚",
-"water"   , "🤽",
-"wave"    , "👋",
-"waving"  , "👋",
-"wavy"    , "〰",
-"waxing"  , "🌒",
-"wc"      , "🚹",
-"weapon"  , "🔪",
-"weary"   , "😩",
-"web"     , "🕸",
-"weight"  , "🏋",
-"west"    , "⬅",
-"whale"   , "🐳",
-"wheel"   , "🎡",
-"whew"    , "😥",
-"whisky"  , "🥃",
-"white"   , "🤍",
-"whoops"  , "🤭",
-"wicked"  , "🖤",
-"wilted"  , "🥀",
-"wind"    , "🍃",
-"window"  , "🪟",
-"wine"    , "🍷",
-"wings"   , "💸",
-"wink"    , "😉",
-"wise"    , "🦉",
-"wisent"  , "🦬",
-"witch"   , "🪄",
-"wizard"  , "🪄",
-"wolf"    , "🐺",
-"woman"   , "👩",
-"women"   , "👯‍♀",
-"won"     , "😤",
-"wood"    , "🪵",
-"wool"    , "🦙",
-"woolly"  , "🦣",
-"worker"  , "🧑‍🏭",
-"world"   , "🌍",
-"worm"    , "🪱",
-"wrap"    , "🌯",
-"wrench"  , "🛠",
-"write"   , "✍",
-"wry"     , "😼",
-"x"       , "✖",
-"yacht"   , "⛵",
-"yang"    , "☯",
-"yarn"    , "🧶",
-"yawn"    , "🥱",
-"yellow"  , "💛",
-"yen"     , "💴",
-"yin"     , "☯",
-"yoga"    , "🧘",
-"young"   , "👶",
-"yum"     , "😋",
-"yurt"    , "🛖",
-"zap"     , "⚡",
-"zebra"   , "🦓",
-"zipper"  , "🤐",
-"zodiac"  , "👧",
-"zombie"  , "🧟",
-"zzz"     , "😴"
+static const guint32 chinese_emoji_seeds[] = {
+    2, 84, 212, 116, 36, 10, 2, 9,
+    3, 277, 344, 3, 2, 2, 1, 5,
+    1, 4, 7, 28, 488, 85, 41, 12,
+    81, 7, 23, 31, 4, 227, 31, 35,
+    12, 49, 9, 19, 3, 4, 69, 14,
+    41, 13, 23, 105, 68, 2, 5, 10,
+    42, 124, 93, 12, 66, 1, 0, 343,
+    111, 6, 3, 118, 1, 0, 272, 9,
+    4, 342, 7, 76, 15, 8, 12, 67,
+    166, 3, 26, 4, 534, 3, 25, 5,
+    12, 92, 220, 1, 189, 46, 4, 13,
+    73, 12, 6, 28, 1, 32, 13, 7,
+    0, 3, 10, 77, 7, 47, 2, 167,
+    14, 1, 4, 4, 41, 4, 4, 28,
+    11, 31, 98, 4, 0, 53, 2, 6,
+    10, 517, 20, 26, 473, 1, 137, 0,
+    135, 7, 85, 1, 89, 1, 2, 72,
+    2, 91, 1, 1, 22, 68, 1, 37,
+    5, 24, 37, 79, 24, 820, 2, 3,
+    4, 33, 26, 6, 19, 76, 211, 102,
+    3, 62, 2, 12, 70, 469, 2, 2,
+    215, 4, 20, 3, 147, 520, 45, 6,
+    1, 3, 82, 5, 41, 34, 67, 375,
+    99, 11, 1, 206, 5, 25, 134, 7,
+    4, 52, 11, 203, 6, 482, 337, 150,
+    3, 113, 17, 33, 36, 104, 36, 65,
+    149, 4, 284, 109, 8, 96, 49, 234,
+    25, 0, 78, 242, 54, 959, 83, 494,
+    276, 188, 2, 13, 79, 100, 19, 1247,
+    317, 567, 318, 19, 1, 201, 2, 87,
+    36, 131, 29, 185, 113, 1, 191, 27,
+    2, 36, 138, 166, 362, 2, 15, 13,
+    28, 152, 4, 37, 2, 2, 1, 152,
+    52, 24, 244, 15, 1894, 1, 128, 107,
+    25, 54, 25, 64, 10, 117, 87, 25,
+    42, 3, 69, 2, 336, 52, 10, 466,
+    68, 10, 84, 369, 855, 143, 63, 0,
+    19, 81, 149, 118, 475, 389, 7, 25,
+    11, 87, 5, 428, 189, 3, 37, 68,
+    19, 194, 3, 4, 15, 5, 13, 57,
+    36, 209, 11, 122, 29, 181, 1, 318,
+    1, 12, 11, 154, 16, 30, 14, 115,
+    163, 1, 297, 531, 30, 0, 338, 24,
+    16, 517, 806, 942, 119, 6, 34, 8,
+    57, 28, 485, 9, 535, 54, 26, 185,
+    518, 9, 28, 1949, 144, 549, 19, 1,
+    206, 2, 222, 113, 135, 65, 16, 32,
+    761, 129, 18, 2, 34, 86, 22, 12,
+    945, 24, 9, 183, 1, 267, 67, 144,
+    2, 0, 354, 365, 229, 794, 3, 370,
+    43, 65, 276, 1, 2, 61, 2721, 132,
+    63, 11, 16, 1, 123, 40, 4, 59,
+    90, 1, 114, 15, 142, 148, 46, 156,
+    12, 66, 29, 155, 1, 10, 1, 58,
+    39, 4, 376, 8, 4, 1785, 162, 486,
+    19, 121, 1, 74, 2479, 65, 1, 1,
+    1, 337, 44, 427, 1, 81, 3, 1195,
+    177, 1379, 60, 2, 11, 13, 489, 2489,
+    105, 156, 791, 344, 7, 1102, 361, 617,
+    915, 267, 31, 1, 713, 1961, 7, 10,
+    325, 99, 1, 1312, 11, 176, 566, 704,
+    10, 1711, 38, 1946, 932, 408, 2, 2,
+    825, 22, 113, 1127, 12, 1053, 173, 6,
+    524, 1083, 59, 174, 321, 82, 3224, 3,
+    1, 2, 1, 265, 623, 1261, 184, 28,
+    1, 3152, 17, 1, 280, 189, 4950, 392,
+    850, 842, 77, 294, 13, 3, 4887, 2896,
+    3270, 204, 4, 2500, 81, 51, 112, 729,
 };
 
-const EmojiItem chinese_emoji_table[] = {
-"㵴火"      , "🧯",
-"㵴火筒"     , "🧯",
-"一"       , "🕐",
-"一件头"     , "🩲",
-"一堆屎"     , "💩",
-"一杯奶"     , "🥛",
-"一次"      , "🔂",
-"一点"      , "🕐",
-"一点半"     , "🕜",
-"一百分"     , "💯",
-"一群"      , "🦬",
-"七"       , "🕖",
-"七点"      , "🕖",
-"七点半"     , "🕢",
-"万圣节"     , "🎃",
-"万字夹"     , "📎",
-"万岁"      , "🙌",
-"三"       , "🕒",
-"三十"      , "🕧",
-"三叉戟"     , "🔱",
-"三叶草"     , "☘",
-"三文治"     , "🥪",
-"三点"      , "🕒",
-"三点半"     , "🕞",
-"三角尺"     , "📐",
-"三角形"     , "📐",
-"三角旗"     , "🚩",
-"上"       , "👆",
-"上升"      , "💹",
-"上弦月"     , "🌓",
-"上锁"      , "🔒",
-"下"       , "👇",
-"下弦月"     , "🌗",
-"下跌"      , "📉",
-"不"       , "🙈",
-"不久"      , "🔜",
-"不关心"     , "🤷",
-"不准"      , "⛔",
-"不可"      , "⛔",
-"丑小鸭"     , "🦢",
-"世界"      , "🌍",
-"丘比特"     , "💘",
-"业务"      , "👨‍💼",
-"东"       , "➡",
-"东京"      , "🗼",
-"东北"      , "↗",
-"东南"      , "↘",
-"丝带"      , "🎗",
-"两个心"     , "💕",
-"两点"      , "🕑",
-"两点半"     , "🕝",
-"个人"      , "💻",
-"中国帽"     , "👲",
-"中心"      , "🫀",
-"中性"      , "🧒",
-"中指"      , "🖕",
-"中暑"      , "🥵",
-"中等"      , "🔉",
-"中肤色"     , "🏽",
-"串"       , "🍡",
-"串烧"      , "🍢",
-"丸子"      , "🍡",
-"丹参树"     , "🎋",
-"举手"      , "✋",
-"举起"      , "🤚",
-"举重"      , "🏋",
-"举重者"     , "🏋",
-"义肢"      , "🦾",
-"乌蝇"      , "🪰",
-"乐谱"      , "🎼",
-"乒乓"      , "🏓",
-"乒乓球"     , "🏓",
-"乘"       , "✖",
-"乘客"      , "🛳",
-"乘法"      , "✖",
-"九"       , "🕘",
-"九点"      , "🕘",
-"九点半"     , "🕤",
-"乞嚏"      , "🤧",
-"乞讨"      , "🥺",
-"书"       , "📔",
-"书包"      , "🎒",
-"书呆子"     , "🤓",
-"书签"      , "📑",
-"乳制品"     , "🧈",
-"乳房"      , "🤱",
-"乳液"      , "🧴",
-"乳液樽"     , "🧴",
-"二"       , "🕑",
-"二头肌"     , "💪",
-"亏"       , "🌖",
-"亏凸月"     , "🌖",
-"云"       , "☁",
-"五"       , "🕔",
-"五点"      , "🕔",
-"五点半"     , "🕠",
-"亚洲"      , "🌏",
-"亡灵"      , "🧛",
-"交叉"      , "🤞",
-"交叉旗"     , "🎌",
-"交叉骨"     , "☠",
-"交通"      , "🚥",
-"亮度"      , "🔅",
-"人"       , "🧑‍🍼",
-"人马座"     , "♐",
-"人鱼"      , "🧜",
-"仓鼠"      , "🐹",
-"仓鼠脸"     , "🐹",
-"仙人掌"     , "🌵",
-"仙子"      , "🧚",
-"仪器"      , "🎷",
-"仪式"      , "🎑",
-"企"       , "🧍",
-"企鹅"      , "🐧",
-"会计"      , "🧾",
-"传呼机"     , "📟",
-"传真"      , "📠",
-"传真机"     , "📠",
-"伤心"      , "😢",
-"低"       , "🔅",
-"低手"      , "🥎",
-"体操"      , "🤸",
-"体育场"     , "🏟",
-"佛教"      , "☸",
-"佛法"      , "☸",
-"佛法轮"     , "☸",
-"侦探"      , "🕵",
-"侧手翻"     , "🤸",
-"便利店"     , "🏪",
-"便当"      , "🍱",
-"便条"      , "📝",
-"俄罗斯"     , "🪆",
-"保健员"     , "🧑‍⚕",
-"保龄球"     , "🎳",
-"信"       , "💌",
-"信号"      , "🚥",
-"信封"      , "✉",
-"信用"      , "💳",
-"信用卡"     , "💳",
-"信箱"      , "📫",
-"修甲"      , "💅",
-"假扮"      , "🥸",
-"停"       , "🚏",
-"停止"      , "🛑",
-"健康"      , "🤧",
-"傍晚"      , "🌆",
-"傻笑"      , "😏",
-"傻笑脸"     , "😏",
-"光"       , "🪶",
-"光亮"      , "☀",
-"光头"      , "🦲",
-"光学"      , "💽",
-"光环"      , "😇",
-"光碟"      , "💽",
-"免费"      , "🈚",
-"兑换"      , "💱",
-"兔"       , "🐰",
-"兔耳"      , "👯",
-"兔脸"      , "🐰",
-"入场"      , "🎟",
-"入场券"     , "🎟",
-"八"       , "🕗",
-"八点"      , "🕗",
-"八点半"     , "🕣",
-"八角形"     , "🛑",
-"八角星"     , "✳",
-"公"       , "🐏",
-"公主"      , "👸",
-"公事包"     , "💼",
-"公仔"      , "🪆",
-"公园"      , "🏞",
-"公牛"      , "🐂",
-"公羊"      , "🐏",
-"公路"      , "🛣",
-"公鸡"      , "🐓",
-"六"       , "🕕",
-"六点"      , "🕕",
-"六点半"     , "🕡",
-"关闭"      , "📫",
-"兴奋"      , "💖",
-"内"       , "💠",
-"内衣"      , "🩲",
-"冇位"      , "🈵",
-"写字"      , "✍",
-"军事"      , "🪖",
-"军队"      , "🪖",
-"农夫"      , "🧑‍🌾",
-"农夫车"     , "🛻",
-"冥想"      , "🧘",
-"冬甩"      , "🍩",
-"冰"       , "🥶",
-"冰冷"      , "😓",
-"冰块"      , "🧊",
-"冰川"      , "🐻‍❄",
-"冰球"      , "🏒",
-"冲凉"      , "🛀",
-"冷球"      , "🧶",
-"冻"       , "😅",
-"冻伤"      , "🥶",
-"冻结"      , "🥶",
-"凉鞋"      , "🩴",
-"凋谢"      , "🥀",
-"减"       , "➖",
-"几何"      , "🔴",
-"出发"      , "🛫",
-"出汗"      , "🥵",
-"击中"      , "🎯",
-"刀"       , "🍽",
-"分开"      , "🪓",
-"分数"      , "💯",
-"分类"      , "🗂",
-"分量"      , "🥃",
-"划艇"      , "🚣",
-"初学者"     , "🔰",
-"刨"       , "🍧",
-"刨冰"      , "🍧",
-"利"       , "🪒",
-"利是"      , "🧧",
-"利是封"     , "🧧",
-"到达"      , "🛬",
-"制服"      , "🥋",
-"刷"       , "🪥",
-"券"       , "🎟",
-"刺"       , "🦔",
-"刺猬"      , "🦔",
-"刺绣"      , "🪡",
-"剃刀"      , "🪒",
-"剃头"      , "🦲",
-"剃须"      , "🪒",
-"剑"       , "🤺",
-"剑击"      , "🤺",
-"剔号"      , "✅",
-"剧场"      , "🎭",
-"剪"       , "✂",
-"剪头发"     , "💇‍♂",
-"剪影"      , "🗣",
-"割"       , "🈹",
-"办公室"     , "👨‍💼",
-"加"       , "➕",
-"勾"       , "🪝",
-"包头"      , "🧕",
-"包装"      , "🎁",
-"包裹"      , "📦",
-"匆忙"      , "😰",
-"匕首"      , "🗡",
-"化妆"      , "💄",
-"化妆品"     , "💅",
-"化学"      , "⚗",
-"化学家"     , "🧑‍🔬",
-"化疗"      , "🦲",
-"北"       , "⬆",
-"北极熊"     , "🐻‍❄",
-"匙羮"      , "🥄",
-"医生"      , "😷",
-"医疗"      , "🩸",
-"医药"      , "💉",
-"医院"      , "🏥",
-"匿名"      , "🥸",
-"十"       , "🕙",
-"十一"      , "🕦",
-"十一点"     , "🕚",
-"十二"      , "🕛",
-"十二点"     , "🕛",
-"十八岁"     , "🔞",
-"十字架"     , "⛪",
-"十点"      , "🕙",
-"十点半"     , "🕥",
-"升降机"     , "🛗",
-"半"       , "🚛",
-"协助"      , "🐕‍🦺",
-"卒"       , "🤌",
-"卒手指"     , "🤌",
-"单车"      , "🚴",
-"单轨"      , "🚝",
-"卖点"      , "🪝",
-"南"       , "⬇",
-"南瓜"      , "🎃",
-"博物馆"     , "🖼",
-"卡"       , "💳",
-"卡片"      , "🗂",
-"卡片盒"     , "📇",
-"卡车"      , "🚒",
-"卫星"      , "🛰",
-"卫生"      , "🪥",
-"卫生间"     , "🚹",
-"印"       , "👣",
-"印度寺"     , "🛕",
-"印度教"     , "🕉",
-"危险"      , "⚡",
-"卷"       , "🧵",
-"卷发"      , "🦱",
-"卷心菜"     , "🥬",
-"卷曲"      , "🦱",
-"卷曲圈"     , "➰",
-"卷纸"      , "🧻",
-"卷起"      , "🗞",
-"卷页"      , "📃",
-"卷饼"      , "🌯",
-"压"       , "🗜",
-"厌倦"      , "🙀",
-"厕所"      , "🚽",
-"厕所泵"     , "🪠",
-"厕纸"      , "🧻",
-"原子"      , "⚛",
-"原子笔"     , "🖊",
-"原驼"      , "🦙",
-"厨师"      , "🧑‍🍳",
-"厨房刀"     , "🔪",
-"叉"       , "🍽",
-"叉同刀"     , "🍴",
-"双"       , "⏸",
-"双子"      , "♊",
-"双子座"     , "👬",
-"双眼"      , "👀",
-"双耳瓶"     , "🏺",
-"双胞胎"     , "👬",
-"双重"      , "⏩",
-"双鱼座"     , "🐟",
-"反射"      , "🪃",
-"反射器"     , "🪞",
-"反射镜"     , "🪞",
-"反弹"      , "🪃",
-"反手"      , "🤚",
-"发件箱"     , "📤",
-"发光"      , "🌟",
-"发出"      , "📩",
-"发动机"     , "🚂",
-"发型师"     , "💇",
-"发明家"     , "🧑‍💻",
-"发烧"      , "🦟",
-"发疯"      , "😡",
-"发癫"      , "😠",
-"发誓"      , "🤬",
-"发送"      , "📩",
-"取消"      , "✖",
-"受伤"      , "🤕",
-"口罩"      , "😷",
-"口震"      , "😱",
-"古典"      , "🏛",
-"可"       , "🉑",
-"台风"      , "🌀",
-"叶"       , "🌿",
-"号角"      , "🥳",
-"合"       , "🈴",
-"合埋"      , "😚",
-"合手"      , "🙏",
-"合格"      , "🈴",
-"吊钟"      , "🔔",
-"同情"      , "😮",
-"同意"      , "🤝",
-"名牌"      , "📛",
-"向上"      , "💹",
-"向下"      , "⬇",
-"向右"      , "🤜",
-"向左"      , "🤛",
-"吓亲"      , "😲",
-"吓惊"      , "😯",
-"听"       , "🙉",
-"听筒"      , "🩺",
-"听障"      , "🦻",
-"吸力"      , "🧲",
-"吸气"      , "🫁",
-"吸水"      , "🧽",
-"吸烟"      , "🚬",
-"吸血鬼"     , "🧛",
-"吹"       , "🍃",
-"吻"       , "😘",
-"呕吐"      , "🤢",
-"呕心"      , "🤢",
-"员工"      , "⚕",
-"呜咽"      , "😭",
-"呢度"      , "🈁",
-"呼"       , "😥",
-"呼叫"      , "🤭",
-"呼吸"      , "🫁",
-"呼气"      , "🫁",
-"咀唇"      , "💋",
-"和平"      , "🕊",
-"和服"      , "👘",
-"咖哩"      , "🍛",
-"咖哩饭"     , "🍛",
-"咖啡"      , "☕",
-"咧嘴笑"     , "😁",
-"咪"       , "🎙",
-"咪高峰"     , "🎙",
-"哺乳"      , "👨‍🍼",
-"哺育"      , "🧑‍🍼",
-"唇印"      , "💋",
-"唇膏"      , "💄",
-"唔准"      , "🙈",
-"唔吉利"     , "🐈‍⬛",
-"唔好"      , "🙈",
-"唔客气"     , "😑",
-"唔开心"     , "😒",
-"唔相信"     , "🤦",
-"唵"       , "🕉",
-"啄木鸟"     , "🦜",
-"商业"      , "🧑‍💼",
-"商人"      , "👨‍🔧",
-"商店"      , "🏪",
-"商标"      , "™",
-"啡色"      , "🤎",
-"啡色心"     , "🤎",
-"啤酒"      , "🍺",
-"啤酒杯"     , "🍺",
-"啧水"      , "🐳",
-"喂哺"      , "🧑‍🍼",
-"喇叭"      , "🔇",
-"喊"       , "😢",
-"喊嘅脸"     , "😢",
-"喷水池"     , "⛲",
-"嗯"       , "😋",
-"嘘"       , "🤫",
-"嘘嘅脸"     , "🤫",
-"嘟嘟鸟"     , "🦤",
-"嘭嘭"      , "‼",
-"嘲笑"      , "🤌",
-"嘴"       , "😃",
-"噢"       , "🙀",
-"器官"      , "🫀",
-"四"       , "🍀",
-"四叶草"     , "🍀",
-"四点"      , "🕓",
-"四点半"     , "🕟",
-"回力镖"     , "🪃",
-"回带"      , "◀",
-"团"       , "🍙",
-"园丁"      , "🧑‍🌾",
-"困惑"      , "😖",
-"国王"      , "👑",
-"图"       , "💹",
-"图片"      , "🖼",
-"图表"      , "💹",
-"圆屋"      , "🛖",
-"圆形"      , "⏺",
-"圆碌碌"     , "🙄",
-"圆禁钉"     , "📍",
-"圈"       , "➰",
-"圈套"      , "🪝",
-"土星"      , "🪐",
-"圣诞树"     , "🎄",
-"圣诞节"     , "🎅",
-"在"       , "🔛",
-"地下"      , "🤣",
-"地图"      , "🗺",
-"地球"      , "🌍",
-"地球仪"     , "🌍",
-"地铁"      , "🚇",
-"场所"      , "🛐",
-"坏人"      , "🦹",
-"坐"       , "🪑",
-"块"       , "🧩",
-"坚硬"      , "🪨",
-"坟墓"      , "🪦",
-"坠落"      , "🌠",
-"垂直"      , "⏸",
-"垃圾"      , "🚮",
-"垃圾桶"     , "🚮",
-"垒球"      , "🥎",
-"垫"       , "🗒",
-"城堡"      , "🏯",
-"城市"      , "🏙",
-"培养皿"     , "🧫",
-"培育"      , "🪴",
-"基因"      , "🧬",
-"基点"      , "⬆",
-"基点间"     , "↗",
-"基督徒"     , "⛪",
-"基督教"     , "✝",
-"塔"       , "🗼",
-"墓地"      , "🪦",
-"墓碑"      , "🪦",
-"墙"       , "🧱",
-"增长"      , "💹",
-"墨水"      , "🔏",
-"墨西哥"     , "🫔",
-"士兵"      , "🪖",
-"士巴拿"     , "🛠",
-"壳"       , "🐚",
-"壶"       , "🫖",
-"处女"      , "👧",
-"处女座"     , "♍",
-"夏日"      , "🍹",
-"外卖盒"     , "🥡",
-"外套"      , "🧥",
-"外星"      , "👽",
-"外星人"     , "👽",
-"外框"      , "❔",
-"外送盘"     , "📤",
-"多动作"     , "🤹",
-"多窿"      , "🧽",
-"多谢"      , "🫂",
-"夜晚"      , "🌃",
-"大"       , "🦣",
-"大卫"      , "✡",
-"大厦"      , "🏢",
-"大厨"      , "👨‍🍳",
-"大声"      , "🔊",
-"大声公"     , "📢",
-"大头针"     , "📌",
-"大桥"      , "🌉",
-"大烛台"     , "🕎",
-"大猩猩"     , "🦍",
-"大羊驼"     , "🦙",
-"大虾"      , "🍤",
-"大象"      , "🐘",
-"大阶"      , "🔠",
-"大雾"      , "🌁",
-"天使"      , "😇",
-"天妇罗"     , "🍤",
-"天房"      , "🕋",
-"天气"      , "🌡",
-"天父"      , "🎅",
-"天真"      , "😇",
-"天秤"      , "⚖",
-"天秤座"     , "⚖",
-"天线"      , "📡",
-"天线棒"     , "📶",
-"天蝎座"     , "🦂",
-"天鹅"      , "🦢",
-"太空"      , "🛰",
-"太空人"     , "🧑‍🚀",
-"太阳"      , "😎",
-"太阳花"     , "🌻",
-"夫妇"      , "👭",
-"失望"      , "😥",
-"头"       , "🗣",
-"头发"      , "🦳",
-"头巾"      , "👳",
-"头晕"      , "😵",
-"头盔"      , "🪖",
-"奇异果"     , "🥝",
-"奇怪"      , "🤓",
-"奖"       , "🏆",
-"奖杯"      , "🏆",
-"奖牌"      , "🎖",
-"奥布朗"     , "🧚",
-"女"       , "👱‍♀",
-"女人"      , "👩",
-"女仔"      , "👧",
-"女仙子"     , "🧚‍♀",
-"女侦探"     , "🕵‍♀",
-"女农夫"     , "👩‍🌾",
-"女厕"      , "🚺",
-"女厨师"     , "👩‍🍳",
-"女士"      , "👠",
-"女学生"     , "👩‍🎓",
-"女巫"      , "🪄",
-"女巫师"     , "🧙‍♀",
-"女技工"     , "👩‍🔧",
-"女教师"     , "👩‍🏫",
-"女歌手"     , "👩‍🎤",
-"女殭尸"     , "🧟‍♀",
-"女法官"     , "👩‍⚖",
-"女王"      , "👑",
-"女精灵"     , "🧝‍♀",
-"女装"      , "👚",
-"女装帽"     , "👒",
-"女装靴"     , "👢",
-"女警察"     , "👮‍♀",
-"女超人"     , "🦸‍♀",
-"奶"       , "🍼",
-"好"       , "🦸",
-"好奇"      , "🦝",
-"好累"      , "😩",
-"好运"      , "🧧",
-"好食"      , "😋",
-"妈妈"      , "🤶",
-"妖"       , "👿",
-"姓名"      , "📛",
-"姿势"      , "🙇",
-"威士忌"     , "🥃",
-"娃娃"      , "🎎",
-"娥眉月"     , "🌒",
-"娱乐"      , "🚙",
-"娱乐家"     , "🧑‍🎤",
-"婚礼"      , "👰",
-"婴儿"      , "👶",
-"嬲"       , "😡",
-"嬲嘅脸"     , "😠",
-"子午线"     , "🌐",
-"子弹"      , "🚅",
-"孔雀"      , "🦚",
-"孕妇"      , "🤰",
-"字母"      , "🔠",
-"学校"      , "🏫",
-"学生"      , "🧑‍🎓",
-"孵化"      , "🐣",
-"守卫员"     , "💂",
-"安全"      , "🦺",
-"安息"      , "🪦",
-"安静"      , "🔇",
-"完全"      , "😲",
-"宗教"      , "⛪",
-"宝石"      , "💎",
-"宝藏"      , "🪙",
-"实验"      , "🥼",
-"实验室"     , "🧪",
-"实验袍"     , "🥼",
-"宠物"      , "🐶",
-"客厅"      , "💇",
-"客船"      , "🛳",
-"害怕"      , "😨",
-"家"       , "🏠",
-"家庭"      , "👪",
-"家禽"      , "🍗",
-"寄信"      , "💌",
-"寄存"      , "🛅",
-"寄生虫"     , "🪱",
-"密码"      , "🔑",
-"富士"      , "🗻",
-"富士山"     , "🗻",
-"寒冷"      , "🌨",
-"寒冷的"     , "🏔",
-"对"       , "🆚",
-"对唔住"     , "🙇",
-"对话"      , "💬",
-"寺庙"      , "🛕",
-"导师"      , "🧑‍🏫",
-"导盲"      , "🦮",
-"导盲犬"     , "🦮",
-"导航"      , "🧭",
-"寿司"      , "🍣",
-"封面"      , "📔",
-"射击"      , "🌠",
-"射手"      , "🏹",
-"射手座"     , "🏹",
-"射箭"      , "🏹",
-"射线"      , "☀",
-"小"       , "🦐",
-"小丑"      , "🤡",
-"小丑脸"     , "🤡",
-"小天鹅"     , "🦢",
-"小妖精"     , "👺",
-"小屋"      , "🛖",
-"小巴"      , "🚐",
-"小提琴"     , "🎻",
-"小教堂"     , "💒",
-"小水滴"     , "💧",
-"小童"      , "🧒",
-"小精灵"     , "🧝",
-"小量"      , "🤏",
-"小阶"      , "🔡",
-"小鸡"      , "🐣",
-"尺度"      , "🧑‍⚖",
-"尿片"      , "🧷",
-"屋"       , "🪴",
-"屎"       , "💩",
-"山"       , "🏔",
-"山地"      , "🚵",
-"山羊"      , "🐐",
-"山羊座"     , "🐐",
-"岗位"      , "🚩",
-"岛"       , "🏝",
-"崇拜"      , "🥰",
-"巡逻"      , "🚓",
-"工业"      , "🧑‍🏭",
-"工人"      , "🧑‍🏭",
-"工具"      , "🪚",
-"工具箱"     , "🧰",
-"工厂"      , "🧑‍🏭",
-"工程师"     , "🧑‍🔬",
-"巨灵"      , "🧞",
-"巨石"      , "🪨",
-"巨蛇"      , "🐍",
-"巨蟹座"     , "🦀",
-"巫婆"      , "🧙",
-"巫师"      , "🪄",
-"巴士"      , "🚌",
-"巴士站"     , "🚏",
-"市场"      , "💹",
-"布甸"      , "🍮",
-"帆船"      , "⛵",
-"帐单"      , "💴",
-"帐篷"      , "⛺",
-"帕克"      , "🧚",
-"带"       , "📼",
-"帮助"      , "💁",
-"常青树"     , "🌲",
-"帽"       , "🤠",
-"干净"      , "🪥",
-"平底镬"     , "🍳",
-"平底鞋"     , "🥿",
-"平行"      , "🤹",
-"年青"      , "👶",
-"幸运"      , "🤞",
-"幻想"      , "😇",
-"幼小"      , "🌱",
-"幼苗"      , "🌱",
-"庆祝"      , "🪅",
-"床"       , "🛏",
-"废纸篓"     , "🗑",
-"度假村"     , "⛵",
-"座位"      , "💺",
-"座灯"      , "🛋",
-"康加鼓"     , "🪘",
-"建筑"      , "👷",
-"建筑师"     , "🧑‍💼",
-"建造"      , "🏗",
-"开"       , "🔓",
-"开会"      , "🤝",
-"开发者"     , "🧑‍💻",
-"开屏"      , "🦚",
-"开玩笑"     , "😜",
-"开花"      , "🌸",
-"开酒塞"     , "🍾",
-"弓"       , "🏹",
-"弓箭"      , "🏹",
-"张开"      , "🖐",
-"弦月"      , "🌒",
-"弦线"      , "🪕",
-"弯"       , "🪝",
-"弯曲"      , "🪝",
-"录像机"     , "📹",
-"录制"      , "⏺",
-"录影带"     , "📼",
-"录影机"     , "📼",
-"录音室"     , "🎙",
-"彗星"      , "☄",
-"彩虹"      , "🌈",
-"彩虹旗"     , "🏳‍🌈",
-"影片"      , "📻",
-"得"       , "🉐",
-"微生物"     , "🦠",
-"微笑"      , "🥲",
-"德古拉"     , "🧛",
-"徽章"      , "🔱",
-"心"       , "💌",
-"心脏"      , "🫀",
-"心跳"      , "🫀",
-"忌廉"      , "🍦",
-"忍者"      , "🥷",
-"忧心"      , "😔",
-"快"       , "⏩",
-"快乐"      , "😂",
-"快到"      , "🚔",
-"快艇"      , "🚤",
-"快走"      , "💨",
-"快进"      , "⏩",
-"快速"      , "💨",
-"念珠"      , "📿",
-"怀孕"      , "🤰",
-"怀疑"      , "🤨",
-"怜悯"      , "🥺",
-"怪物"      , "💀",
-"恋爱"      , "🥰",
-"恐布"      , "😝",
-"恭喜"      , "㊗",
-"恶魔"      , "👿",
-"您好"      , "🫂",
-"悬架"      , "🚟",
-"情人"      , "💝",
-"情侣"      , "🧑‍🤝‍🧑",
-"情信"      , "💌",
-"惊叫"      , "😱",
-"惊恐"      , "😨",
-"惊慌"      , "😨",
-"惊讶"      , "😯",
-"惧怕"      , "😱",
-"想法"      , "💡",
-"感动"      , "🥲",
-"感叹号"     , "‼",
-"感叹嘅"     , "❣",
-"感激"      , "🥲",
-"感谢"      , "🙇‍♂",
-"愤怒"      , "😡",
-"慢"       , "🦥",
-"懒"       , "🦥",
-"戏"       , "🎞",
-"戏院"      , "🎥",
-"成人"      , "🧑",
-"成长"      , "🪴",
-"我爱您"     , "🤟",
-"戒指"      , "💍",
-"战士"      , "🪖",
-"战斗机"     , "🥷",
-"房屋"      , "🏚",
-"手"       , "👋",
-"手势"      , "🤌",
-"手卷"      , "🫔",
-"手套"      , "🥎",
-"手指"      , "🤌",
-"手指公"     , "👍",
-"手掌"      , "🤦",
-"手提袋"     , "👝",
-"手机"      , "🤳",
-"手枪"      , "🔫",
-"手球"      , "🤾",
-"手瓜"      , "💪",
-"手表"      , "⌚",
-"手袋"      , "👜",
-"手风琴"     , "🪗",
-"手鼓"      , "🪘",
-"扒"       , "🥩",
-"打"       , "✊",
-"打印机"     , "🖨",
-"打喊露"     , "🥱",
-"打开"      , "🪟",
-"打开手"     , "👐",
-"打扮"      , "🧑‍🎄",
-"打气"      , "📣",
-"打电话"     , "🤙",
-"托盘"      , "📤",
-"扣针"      , "🧷",
-"扩音器"     , "📣",
-"扫"       , "🧹",
-"扫把"      , "🧹",
-"扭"       , "🪢",
-"扭歪"      , "😼",
-"扭纹"      , "🥨",
-"扳手"      , "🛠",
-"批"       , "🥧",
-"技工"      , "🧑‍🔧",
-"技术"      , "🤹",
-"投币口"     , "🎰",
-"投票"      , "🗳",
-"抗议"      , "🪧",
-"折扣"      , "🈹",
-"抢"       , "🏴‍☠",
-"护士"      , "🧑‍⚕",
-"护照"      , "🛂",
-"护理"      , "💅",
-"护符"      , "🧿",
-"护镜"      , "🥽",
-"报纸"      , "📰",
-"抱抱"      , "🫂",
-"抵达"      , "🛬",
-"担心"      , "😟",
-"拉丁"      , "🔠",
-"拉链"      , "🤐",
-"拉面"      , "🍜",
-"拍子"      , "🪘",
-"拍手"      , "👏",
-"拍板"      , "🎬",
-"拖"       , "👭",
-"拖住"      , "🧑‍🤝‍🧑",
-"拖头车"     , "🚛",
-"拖拉机"     , "🚜",
-"拖鞋"      , "🥿",
-"招牌"      , "💈",
-"拜拜"      , "🫂",
-"拥抱"      , "🫂",
-"拳击"      , "🥊",
-"拳头"      , "✊",
-"拳套"      , "🥊",
-"持有人"     , "🐍",
-"指"       , "👈",
-"指南针"     , "🧭",
-"指向"      , "👈",
-"指甲"      , "💅",
-"指甲油"     , "💅",
-"按摩"      , "💆",
-"按钮"      , "🔼",
-"挑"       , "⛏",
-"挥手"      , "👋",
-"挥紧手"     , "👋",
-"捏手"      , "🤏",
-"捐血"      , "🩸",
-"损伤"      , "🤕",
-"换片"      , "🚼",
-"掌"       , "🐾",
-"掌印"      , "🐾",
-"排球"      , "🏐",
-"探热针"     , "🤒",
-"接受"      , "🉑",
-"接收"      , "📨",
-"控制"      , "🎛",
-"控制器"     , "🎮",
-"提子"      , "🍇",
-"提示"      , "💁",
-"插头"      , "🔌",
-"握"       , "🤝",
-"握手"      , "🤝",
-"握紧"      , "✊",
-"揽"       , "🤗",
-"搜寻"      , "🔍",
-"搞笑"      , "💢",
-"摇"       , "🪀",
-"摇摇"      , "🪀",
-"摇滚"      , "🤘",
-"摔交"      , "🤼",
-"摔交手"     , "🤼",
-"摧毁"      , "⚡",
-"摩天轮"     , "🎡",
-"摩艾"      , "🗿",
-"撅嘴"      , "😡",
-"播放"      , "▶",
-"收件盘"     , "📥",
-"收件箱"     , "📥",
-"收到"      , "📲",
-"收据"      , "🧾",
-"收费"      , "🈶",
-"收集"      , "🛻",
-"收音机"     , "📻",
-"放低"      , "📪",
-"放大"      , "🔍",
-"放射性"     , "☢",
-"放映机"     , "📽",
-"放松"      , "☺",
-"救护车"     , "🚑",
-"救生衣"     , "🦺",
-"教堂"      , "⛪",
-"教师"      , "👨‍🏫",
-"教授"      , "🧑‍🏫",
-"散子"      , "👛",
-"散子包"     , "👛",
-"敬礼"      , "🖖",
-"数字"      , "🔢",
-"数学"      , "➕",
-"数学家"     , "👨‍🔬",
-"文件"      , "📃",
-"文件夹"     , "📁",
-"文化"      , "🧫",
-"斑点"      , "🦒",
-"斑马"      , "🦓",
-"斧头"      , "🪓",
-"斩"       , "🪓",
-"新娘"      , "👰",
-"新干线"     , "🚄",
-"新月"      , "🌑",
-"新月面"     , "🌚",
-"新郎"      , "🤵",
-"新闻"      , "📰",
-"方位"      , "🧭",
-"方便"      , "🏪",
-"方向"      , "⬆",
-"方格旗"     , "🏁",
-"旅行"      , "🧳",
-"旋转"      , "💞",
-"旋风"      , "🌪",
-"旗"       , "🎏",
-"无"       , "🈚",
-"无声"      , "😶",
-"无头发"     , "🦲",
-"无用"      , "🪴",
-"无知"      , "🤷",
-"无表情"     , "😐",
-"无表达"     , "😑",
-"无限"      , "♾",
-"无限制"     , "♾",
-"无障碍"     , "🛗",
-"日元"      , "💹",
-"日出"      , "🌄",
-"日历"      , "📅",
-"日圆"      , "💴",
-"日式"      , "🏣",
-"日期"      , "📅",
-"日本"      , "🍙",
-"日落"      , "🌆",
-"旧"       , "🗝",
-"旧锁匙"     , "🗝",
-"早上"      , "🌄",
-"早餐"      , "🥣",
-"时钟"      , "⌚",
-"时髦"      , "💁",
-"昆虫"      , "🪲",
-"明星"      , "🤩",
-"明星脸"     , "🤩",
-"星"       , "💫",
-"星夜"      , "🌃",
-"星座"      , "👧",
-"星星"      , "🌃",
-"显微镜"     , "🔬",
-"晕"       , "🥴",
-"晚上"      , "🌉",
-"晚礼服"     , "🤵",
-"景观"      , "🪟",
-"晴朗"      , "☀",
-"智力"      , "🧠",
-"智慧"      , "🦉",
-"暂停"      , "⏯",
-"暗"       , "🔅",
-"暴龙"      , "🦖",
-"曱甴"      , "🪳",
-"曲发"      , "🦱",
-"曲奇"      , "🍪",
-"曲棍球"     , "🏑",
-"月"       , "🌒",
-"月亮"      , "🌑",
-"月经"      , "🩸",
-"月费"      , "🈷",
-"月饼"      , "🥮",
-"有"       , "🈶",
-"有雾"      , "🌁",
-"服务"      , "🐕‍🦺",
-"服务员"     , "🛎",
-"服务费"     , "🈂",
-"服装"      , "👣",
-"望远镜"     , "🔭",
-"木"       , "🪓",
-"木头"      , "🪵",
-"木屐"      , "🩴",
-"木工"      , "🪚",
-"木材"      , "🪚",
-"木桶"      , "🪣",
-"木锯"      , "🪚",
-"未成年"     , "🔞",
-"朱古力"     , "🫕",
-"机动船"     , "🛥",
-"机械人"     , "🤖",
-"机械脚"     , "🦿",
-"机械臂"     , "🦾",
-"杂耍"      , "🤹",
-"条"       , "🍫",
-"条纹"      , "🦓",
-"来"       , "📨",
-"杯"       , "🥛",
-"松树"      , "🎍",
-"板"       , "🛹",
-"板手"      , "🔧",
-"板球"      , "🏏",
-"果仁"      , "🥜",
-"果汁"      , "🥤",
-"果汁盒"     , "🧃",
-"果汁酒"     , "🥥",
-"枪"       , "🎉",
-"枫叶"      , "🍁",
-"枫树"      , "🍁",
-"柑桔"      , "🍊",
-"柑橘"      , "🍋",
-"柔软"      , "🔈",
-"柔道"      , "🥋",
-"柜"       , "🗄",
-"柠檬"      , "🍋",
-"标志"      , "🪧",
-"标签"      , "📑",
-"标记"      , "📑",
-"标语"      , "🪧",
-"树"       , "🌲",
-"树熊"      , "🐨",
-"树獭"      , "🦥",
-"栗子"      , "🌰",
-"格子"      , "🏁",
-"桃"       , "🍑",
-"框架"      , "🪟",
-"框画"      , "🖼",
-"桌球"      , "🎱",
-"桌面"      , "🖥",
-"桑拿"      , "🧖",
-"档案"      , "📁",
-"档案柜"     , "🗄",
-"桶"       , "🛢",
-"梅花"      , "♣",
-"梨"       , "🍐",
-"梯"       , "🪜",
-"梯级"      , "🪜",
-"梳打"      , "🥤",
-"检查"      , "🛂",
-"棍"       , "🥍",
-"棒"       , "🍢",
-"棒型图"     , "📊",
-"棒球"      , "⚾",
-"棒球帽"     , "🧢",
-"棕榈"      , "🌴",
-"棕榈树"     , "🌴",
-"棺材"      , "⚰",
-"植物"      , "🪴",
-"椰子"      , "🥥",
-"榄球"      , "🏉",
-"槿"       , "🌺",
-"模式"      , "📳",
-"横额"      , "🎋",
-"樱花"      , "🌸",
-"樽"       , "🍼",
-"橄榄"      , "🫒",
-"橙"       , "🍊",
-"橙色"      , "🧡",
-"橙色书"     , "📙",
-"橙色心"     , "🧡",
-"櫈"       , "💺",
-"欧元"      , "💶",
-"欧洲"      , "🌍",
-"欧陆式"     , "🏰",
-"歌手"      , "🧑‍🎤",
-"歌记号"     , "〽",
-"正义"      , "👨‍⚖",
-"正方形"     , "⏹",
-"步"       , "🪜",
-"武器"      , "🔪",
-"武术"      , "🥋",
-"死"       , "💀",
-"死亡"      , "☠",
-"残月"      , "🌘",
-"殡仪馆"     , "⚱",
-"殭尸"      , "🧟",
-"毒菌"      , "🍄",
-"比坚尼"     , "👙",
-"比赛"      , "🏐",
-"比高包"     , "🥯",
-"毕业"      , "🧑‍🎓",
-"毕业帽"     , "🎓",
-"毛绒"      , "🧸",
-"气体"      , "⛽",
-"气球"      , "💬",
-"水"       , "🤽",
-"水坝"      , "🦫",
-"水晶"      , "🔮",
-"水晶球"     , "🔮",
-"水果"      , "🥭",
-"水桶"      , "🪣",
-"水泥"      , "🧱",
-"水点"      , "☔",
-"水牛"      , "🦬",
-"水狸"      , "🦫",
-"水球"      , "🤽",
-"水瓶座"     , "🏺",
-"水龟"      , "🐢",
-"永远"      , "♾",
-"求助"      , "🆘",
-"汉堡包"     , "🍔",
-"汗"       , "😅",
-"汽球"      , "🎈",
-"汽车"      , "🚞",
-"沉默"      , "😯",
-"沙"       , "⌛",
-"沙发"      , "🛋",
-"沙律"      , "🥗",
-"沙漏"      , "⏳",
-"沙漠"      , "🏜",
-"沮丧"      , "😔",
-"河马"      , "🦛",
-"油"       , "🛢",
-"油桶"      , "🛢",
-"治疗师"     , "🧑‍⚕",
-"治疗犬"     , "🐕‍🦺",
-"泉"       , "♨",
-"泊车"      , "🅿",
-"法国"      , "🥐",
-"法官"      , "🧑‍⚖",
-"法式"      , "🥖",
-"泡"       , "🧋",
-"泡泡"      , "💬",
-"泡菜"      , "🥒",
-"波"       , "🏌",
-"波板糖"     , "🍭",
-"波浪"      , "🌊",
-"注册"      , "®",
-"注射"      , "💉",
-"注释"      , "🗒",
-"泳衣"      , "🩱",
-"泳裤"      , "🩲",
-"泵"       , "⛽",
-"洋葱"      , "🧅",
-"洗头水"     , "🧴",
-"洗手间"     , "🚹",
-"洗衫"      , "🧺",
-"洞"       , "⛳",
-"派对"      , "🪅",
-"派对枪"     , "🎉",
-"流动"      , "📱",
-"流口水"     , "🤤",
-"流星"      , "🌠",
-"浅"       , "🥘",
-"浅肤色"     , "🏻",
-"浓汤"      , "🦞",
-"浪漫"      , "💒",
-"浮潜"      , "🤿",
-"浴室"      , "🪥",
-"浴缸"      , "🛀",
-"海"       , "⛵",
-"海关"      , "🛃",
-"海洋"      , "🌊",
-"海浪"      , "🌊",
-"海滩"      , "🏖",
-"海狮"      , "🦭",
-"海盗"      , "🦜",
-"海盗旗"     , "🏴‍☠",
-"海绵"      , "🧽",
-"海豚"      , "🐬",
-"海豹"      , "🦭",
-"海鲜"      , "🍢",
-"海龟"      , "🐢",
-"消闲"      , "♟",
-"消防员"     , "🧑‍🚒",
-"消防车"     , "🧑‍🚒",
-"润肤霜"     , "🧴",
-"深肤色"     , "🏿",
-"清洁"      , "🧹",
-"清真寺"     , "🕌",
-"清酒"      , "🍶",
-"渡船"      , "⛴",
-"温度计"     , "🌡",
-"温泉"      , "♨",
-"游乐场"     , "🎡",
-"游戏"      , "🥌",
-"游戏杆"     , "🕹",
-"游水"      , "🏊",
-"游艇"      , "⛵",
-"溅"       , "💦",
-"溜冰"      , "⛸",
-"溜冰鞋"     , "🛼",
-"滑块"      , "🎚",
-"滑板"      , "🛹",
-"滑板车"     , "🛵",
-"滑浪"      , "🏄",
-"滑翔伞"     , "🪂",
-"滑雪"      , "⛷",
-"滑雪板"     , "🏂",
-"滚动"      , "📜",
-"滚筒"      , "🎢",
-"滚轴"      , "🛼",
-"满"       , "🌕",
-"满分"      , "💯",
-"满意"      , "😆",
-"满月"      , "🌕",
-"满月面"     , "🌝",
-"滴汗"      , "💦",
-"演员"      , "🧑‍🎤",
-"漩涡"      , "🍥",
-"漫画"      , "💩",
-"潜水"      , "🦪",
-"潜水镜"     , "🤿",
-"澳洲"      , "🪃",
-"火"       , "🚒",
-"火山"      , "🌋",
-"火焰"      , "🔥",
-"火箭"      , "🧑‍🚀",
-"火花"      , "🎇",
-"火车"      , "🚂",
-"火鸡"      , "🦃",
-"灯"       , "🚨",
-"灯泡"      , "💡",
-"灯笼"      , "🎃",
-"灯笼椒"     , "🫑",
-"灯胆"      , "💡",
-"灰烬"      , "⚱",
-"灰色"      , "🦳",
-"炖"       , "🍲",
-"炮丈"      , "🧨",
-"炸"       , "🍤",
-"炸弹"      , "💣",
-"炸药"      , "🧨",
-"炸虾"      , "🍤",
-"点"       , "🕛",
-"烈酒"      , "🥃",
-"烈酒㷴"     , "🥃",
-"烘焙"      , "🥯",
-"烛台"      , "🕎",
-"烟肉"      , "🥓",
-"烟花"      , "🎆",
-"烤肉串"     , "🥙",
-"烤饼"      , "🫓",
-"烧焊"      , "🥽",
-"烩"       , "🍠",
-"烩番薯"     , "🍠",
-"热"       , "🥵",
-"热带"      , "🦩",
-"热带鱼"     , "🐠",
-"热狗"      , "🌭",
-"热腾腾"     , "♨",
-"热饮"      , "☕",
-"热香饼"     , "🥞",
-"煎"       , "🍳",
-"煮熟"      , "🍚",
-"煮食"      , "🍳",
-"煲"       , "🫕",
-"熄"       , "🧯",
-"熊"       , "🐻",
-"熊仔"      , "🧸",
-"熊猫"      , "🐼",
-"熊猫脸"     , "🐼",
-"熊脸"      , "🐻",
-"燃油"      , "⛽",
-"燃油泵"     , "⛽",
-"燕尾服"     , "🤵‍♀",
-"燕麦"      , "🥣",
-"爆发"      , "🌋",
-"爆炸"      , "🧨",
-"爆炸头"     , "🤯",
-"爆谷"      , "🍿",
-"爪"       , "🦞",
-"爬"       , "🪜",
-"爱"       , "😍",
-"爱情"      , "💌",
-"片"       , "🍕",
-"片装"      , "🍰",
-"版权"      , "©",
-"牌"       , "📛",
-"牙"       , "🪥",
-"牙刷"      , "🪥",
-"牙医"      , "🦷",
-"牙科"      , "🪥",
-"牙齿"      , "🦷",
-"牛"       , "🐮",
-"牛仔"      , "🤠",
-"牛仔裤"     , "👖",
-"牛女"      , "🤠",
-"牛奶"      , "🧋",
-"牛扒"      , "🥩",
-"牛油"      , "🧈",
-"牛油果"     , "🥑",
-"牛脸"      , "🐮",
-"牛角"      , "😈",
-"牛角包"     , "🥐",
-"牛角卷"     , "🥐",
-"牧人"      , "👨‍🌾",
-"犀牛"      , "🦏",
-"犯罪"      , "🦹",
-"犹太人"     , "✡",
-"犹太教"     , "🕍",
-"狂热"      , "🥵",
-"狐狸"      , "🦊",
-"狐狸脸"     , "🦊",
-"狗"       , "🐶",
-"狗脸"      , "🐶",
-"狡猾"      , "🦝",
-"独峰驼"     , "🐪",
-"独木舟"     , "🛶",
-"独角兽"     , "🦄",
-"狮子"      , "🦁",
-"狮子座"     , "🦁",
-"狮子狗"     , "🐩",
-"狮子脸"     , "🦁",
-"狸"       , "🦝",
-"狼"       , "🐺",
-"狼脸"      , "🐺",
-"猩猩"      , "🦧",
-"猪"       , "🐷",
-"猪公"      , "🐗",
-"猪扒"      , "🥩",
-"猪脸"      , "🐷",
-"猪鼻"      , "🐽",
-"猫"       , "😺",
-"猫头鹰"     , "🦉",
-"猫脸"      , "🐱",
-"猿"       , "🦧",
-"獭"       , "🦦",
-"獾"       , "🦡",
-"玉米"      , "🌽",
-"王子"      , "🤴",
-"玛黛茶"     , "🧉",
-"玩"       , "🎴",
-"玩具"      , "🪀",
-"玫瑰"      , "🌹",
-"环虫"      , "🪱",
-"玻璃"      , "🥃",
-"玻璃杯"     , "🍸",
-"珍珠"      , "🧋",
-"珠"       , "🧿",
-"珠宝"      , "💎",
-"班卓琴"     , "🪕",
-"班戟"      , "🥞",
-"球"       , "🤾",
-"球场"      , "🏑",
-"球拍"      , "🏓",
-"球棒"      , "🏏",
-"理发"      , "💇",
-"瑜伽"      , "🧘",
-"瑞士"      , "🫕",
-"瓦肯式"     , "🖖",
-"瓮"       , "⚱",
-"甜"       , "🍡",
-"甜品"      , "🍡",
-"生命"      , "🧬",
-"生姜"      , "🦰",
-"生果"      , "🍇",
-"生物"      , "👹",
-"生物学"     , "🧫",
-"生病"      , "🤒",
-"生肖"      , "⛎",
-"生菜"      , "🥬",
-"生蚝"      , "🦪",
-"用笔锁"     , "🔏",
-"甲壳虫"     , "🪲",
-"甲虫"      , "🪲",
-"申"       , "🈸",
-"申请"      , "🈸",
-"电"       , "🚃",
-"电力"      , "⚡",
-"电单车"     , "🏍",
-"电压"      , "⚡",
-"电工"      , "🧑‍🔧",
-"电影"      , "🎥",
-"电池"      , "🔋",
-"电筒"      , "🔦",
-"电脑"      , "💻",
-"电视机"     , "📺",
-"电话"      , "📱",
-"电车"      , "🚃",
-"电邮"      , "✉",
-"男"       , "👱‍♂",
-"男人"      , "👨",
-"男仔"      , "👦",
-"男仙子"     , "🧚‍♂",
-"男侦探"     , "🕵‍♂",
-"男农夫"     , "👨‍🌾",
-"男厕"      , "🚹",
-"男厨师"     , "👨‍🍳",
-"男士"      , "👞",
-"男学生"     , "👨‍🎓",
-"男巫"      , "🧙",
-"男巫师"     , "🧙‍♂",
-"男技工"     , "👨‍🔧",
-"男教师"     , "👨‍🏫",
-"男歌手"     , "👨‍🎤",
-"男殭尸"     , "🧟‍♂",
-"男法官"     , "👨‍⚖",
-"男精灵"     , "🧝‍♂",
-"男装鞋"     , "👞",
-"男警察"     , "👮‍♂",
-"男超人"     , "🦸‍♂",
-"画画"      , "🖌",
-"画笔"      , "🖌",
-"画面"      , "🎞",
-"番枧"      , "🧼",
-"番枧盒"     , "🧼",
-"番茄"      , "🍅",
-"番薯"      , "🍠",
-"疟疾"      , "🦟",
-"疾病"      , "🪰",
-"病"       , "😷",
-"病毒"      , "🦟",
-"痛苦"      , "😬",
-"痢"       , "😛",
-"登山者"     , "🧗",
-"白兔"      , "🐰",
-"白羊座"     , "🐏",
-"白色"      , "🤍",
-"白色心"     , "🤍",
-"白色旗"     , "🏳",
-"白花"      , "💮",
-"白菜"      , "🥬",
-"白领"      , "🧑‍💼",
-"百"       , "💯",
-"百撘卡"     , "🃏",
-"的士"      , "🚕",
-"皇冠"      , "👑",
-"皮纳塔"     , "🪅",
-"皱眉"      , "☹",
-"盆栽"      , "🪴",
-"盈"       , "🌒",
-"盈凸月"     , "🌔",
-"盐"       , "🧂",
-"盐樽"      , "🧂",
-"盒"       , "🍱",
-"盒子"      , "📥",
-"目标"      , "🥍",
-"盲"       , "👨‍🦯",
-"盲人"      , "🧑‍🦯",
-"直升机"     , "🚁",
-"直尺"      , "📏",
-"直边"      , "📏",
-"相机"      , "🤳",
-"盾"       , "🛡",
-"眨眼"      , "😉",
-"眼"       , "😄",
-"眼泪"      , "🥲",
-"眼睛"      , "🤩",
-"眼镜"      , "🥸",
-"着上"      , "🥿",
-"睇"       , "🙈",
-"短裤"      , "🩳",
-"石"       , "🥌",
-"石头"      , "🪨",
-"砂浆"      , "🧱",
-"砂锅"      , "🥘",
-"砌图"      , "🧩",
-"砖"       , "🧱",
-"破折号"     , "〰",
-"破碎"      , "💔",
-"硬币"      , "🪙",
-"碌地"      , "🤣",
-"碎"       , "💔",
-"碗"       , "🍜",
-"碟"       , "🍽",
-"碰撞"      , "💥",
-"磁力"      , "🧭",
-"磁性"      , "🧲",
-"磁石"      , "🧲",
-"磁碟"      , "💾",
-"礼物"      , "🧧",
-"祈祷"      , "🤲",
-"祝"       , "㊗",
-"神奇"      , "🧝",
-"神教"      , "⛩",
-"神社"      , "⛩",
-"祷告"      , "📿",
-"禁"       , "🈲",
-"禁止"      , "🙈",
-"禁钉"      , "📌",
-"离境"      , "🛫",
-"禾束"      , "🌾",
-"秋天"      , "🥮",
-"科学"      , "🧪",
-"科学家"     , "🧑‍🔬",
-"秒表"      , "⏱",
-"秘"       , "㊙",
-"秘密"      , "㊙",
-"秤"       , "👨‍⚖",
-"穆斯林"     , "🕌",
-"穗"       , "🌾",
-"空"       , "🈳",
-"空中"      , "🚡",
-"空手道"     , "🥋",
-"突起"      , "🌔",
-"窗"       , "🪟",
-"窝夫"      , "🧇",
-"窿"       , "🕳",
-"竖起"      , "👍",
-"章鱼"      , "🐙",
-"童话"      , "👼",
-"竹"       , "🎍",
-"竿"       , "🎣",
-"笃笃"      , "🛺",
-"笑"       , "😆",
-"笑脸"      , "😀",
-"笔"       , "✒",
-"笔尖"      , "✒",
-"笔记板"     , "📋",
-"笔记簿"     , "📔",
-"符号"      , "❣",
-"第一"      , "🥇",
-"第三"      , "🥉",
-"第二"      , "🥈",
-"筷子"      , "🥢",
-"算盘"      , "🧮",
-"箭"       , "💘",
-"箭咀"      , "📲",
-"箭头"      , "🏹",
-"箭靶"      , "🎯",
-"箱"       , "🧰",
-"篮"       , "🧺",
-"篮圈"      , "🏀",
-"篮球"      , "🏀",
-"簿记"      , "🧾",
-"米"       , "🌾",
-"米饼"      , "🍘",
-"粉碎"      , "🥰",
-"粗乘号"     , "✖",
-"粗减号"     , "➖",
-"粗剔号"     , "✔",
-"粗加号"     , "➕",
-"粗除号"     , "➗",
-"粟米"      , "🌽",
-"粟米饼"     , "🫓",
-"粥"       , "🥣",
-"粪便"      , "💩",
-"粱龙"      , "🦕",
-"糕点"      , "🍥",
-"糖果"      , "🍬",
-"索引"      , "🗂",
-"紧张"      , "💗",
-"紧急"      , "🦺",
-"紫色"      , "💜",
-"紫色心"     , "💜",
-"累"       , "😩",
-"累嘅脸"     , "😫",
-"纠察"      , "🪧",
-"纠缠"      , "🦡",
-"红"       , "😡",
-"红包"      , "🧧",
-"红心"      , "♥",
-"红色"      , "🍎",
-"红色心"     , "❤",
-"红苹果"     , "🍎",
-"红萝卜"     , "🥕",
-"红酒杯"     , "🍷",
-"红面"      , "🥵",
-"红鹤"      , "🦩",
-"级别"      , "🎚",
-"纪念"      , "🎗",
-"纱丽"      , "🥻",
-"纳扎尔"     , "🧿",
-"纸"       , "📜",
-"纸屑"      , "🎊",
-"纸屑球"     , "🎊",
-"纸巾"      , "🧻",
-"纸币"      , "💴",
-"纸牌"      , "♠",
-"线"       , "🧵",
-"线索"      , "🧩",
-"组合"      , "📐",
-"组装"      , "🪆",
-"细"       , "🤪",
-"细菌"      , "🦠",
-"终极"      , "🥏",
-"经理"      , "🧑‍💼",
-"结"       , "🪢",
-"结他"      , "🎸",
-"结束"      , "🔚",
-"绘画"      , "🖼",
-"绝种"      , "🦣",
-"绳"       , "🪢",
-"绳球"      , "🪢",
-"绵羊"      , "🐏",
-"绷带"      , "🤕",
-"绿色"      , "💚",
-"绿色书"     , "📗",
-"绿色心"     , "💚",
-"缆"       , "🚠",
-"缆车"      , "🚠",
-"缝纫"      , "🧵",
-"缝纫针"     , "🪡",
-"缝线"      , "🪡",
-"缝补"      , "🪡",
-"缝针"      , "🪡",
-"缸"       , "🪣",
-"罐"       , "🍯",
-"罐头"      , "🥫",
-"网"       , "🕸",
-"网球"      , "🎾",
-"网球拍"     , "🎾",
-"羊扒"      , "🥩",
-"羊毛"      , "🦣",
-"羊驼"      , "🦙",
-"美人鱼"     , "🧜",
-"美元"      , "💵",
-"美容"      , "💇",
-"美容店"     , "💆",
-"美式"      , "🏈",
-"美洲"      , "🌎",
-"羽毛"      , "🪶",
-"羽毛球"     , "🏸",
-"翼"       , "💸",
-"老"       , "🦳",
-"老人"      , "🧓",
-"老伯伯"     , "👴",
-"老婆婆"     , "👵",
-"老师"      , "🧑‍🏫",
-"老年"      , "🧓",
-"老虎"      , "🐯",
-"老虎机"     , "🎰",
-"老虎脸"     , "🐯",
-"老鼠"      , "🐭",
-"老鼠夹"     , "🪤",
-"老鼠脸"     , "🐭",
-"耕种"      , "🧺",
-"耳仔"      , "👂",
-"耳机"      , "🎧",
-"耸肩"      , "🤷",
-"聋"       , "🧏",
-"聋人"      , "🧏",
-"联锁"      , "🧩",
-"肉"       , "🍖",
-"肉丸"      , "🧆",
-"肉块"      , "🥩",
-"肉菜饭"     , "🥘",
-"肉连⻣"     , "🍖",
-"肌肉"      , "💪",
-"肢"       , "🦵",
-"肤色"      , "🏻",
-"肩带"      , "🎽",
-"肺"       , "🫁",
-"背囊"      , "🥾",
-"背心"      , "🦺",
-"胜利"      , "✌",
-"胡椒粉"     , "🫑",
-"胶布"      , "🩹",
-"胸像"      , "👤",
-"脉冲"      , "🫀",
-"脉动"      , "💗",
-"脑"       , "🧠",
-"脚"       , "🦵",
-"脚印"      , "👣",
-"脚掌"      , "🦶",
-"脱落"      , "🌳",
-"脸"       , "😀",
-"脸红"      , "😳",
-"腐烂"      , "🪰",
-"腕龙"      , "🦕",
-"腮红"      , "😊",
-"自动化"     , "🏧",
-"自拍"      , "🤳",
-"自来水"     , "🚰",
-"自然"      , "😐",
-"自由"      , "🗽",
-"自行车"     , "🚳",
-"自豪"      , "🥲",
-"臭"       , "💩",
-"臭鼬"      , "🦨",
-"舞蹈员"     , "👯",
-"航班"      , "🪶",
-"船"       , "⚓",
-"艇"       , "🚣",
-"色士风"     , "🎷",
-"艺人"      , "👨‍🎤",
-"艺术"      , "🎭",
-"艺术家"     , "👨‍🎨",
-"节奏"      , "🪘",
-"节日"      , "🥮",
-"芒果"      , "🥭",
-"芝士"      , "🫕",
-"芭蕾舞"     , "🩰",
-"花"       , "💐",
-"花园"      , "🏡",
-"花束"      , "💐",
-"花栗鼠"     , "🐿",
-"花洒"      , "🚿",
-"花环"      , "🏵",
-"花生"      , "🥜",
-"花纸牌"     , "🎴",
-"苦恼"      , "😧",
-"英镑"      , "💷",
-"英雄"      , "🦸",
-"苹果"      , "🍎",
-"茄子"      , "🍆",
-"茶"       , "🧋",
-"茶壶"      , "🫖",
-"茶杯"      , "🍵",
-"草"       , "🍀",
-"草蜢"      , "🦗",
-"荒岛"      , "🏝",
-"荒废"      , "🏚",
-"药"       , "😷",
-"药丸"      , "💊",
-"莓"       , "🫐",
-"莫伊"      , "🗿",
-"菜"       , "🥬",
-"菠萝"      , "🍍",
-"菱形"      , "🔶",
-"营"       , "🈺",
-"营业"      , "🈺",
-"落叶"      , "🍁",
-"落叶树"     , "🌳",
-"落雨"      , "🌈",
-"葬礼"      , "⚱",
-"葵扇"      , "♠",
-"蒙古包"     , "🛖",
-"蒜头"      , "🧄",
-"蒸气"      , "🍜",
-"蒸气房"     , "🧖",
-"蒸汽"      , "🚂",
-"蒸馏器"     , "⚗",
-"蓝光"      , "📀",
-"蓝色"      , "🫐",
-"蓝色书"     , "📘",
-"蓝色心"     , "💙",
-"蓝莓"      , "🫐",
-"蔬菜"      , "🫑",
-"薄班戟"     , "🥞",
-"薄饼"      , "🫓",
-"薯仔"      , "🥔",
-"薯条"      , "🍟",
-"蘑菇"      , "🍄",
-"虎头钳"     , "🗜",
-"虫"       , "🪱",
-"虾"       , "🍤",
-"蚂蚁"      , "🐜",
-"蚊"       , "🦟",
-"蚝桶"      , "🥡",
-"蚯蚓"      , "🪱",
-"蛆"       , "🪰",
-"蛇"       , "🐍",
-"蛇夫座"     , "🐍",
-"蛋"       , "🥚",
-"蛋糕"      , "🎂",
-"蜂蜜獾"     , "🦡",
-"蜗牛"      , "🐌",
-"蜘蛛"      , "🕷",
-"蜘蛛网"     , "🕸",
-"蜜瓜"      , "🍈",
-"蜜糖"      , "🍯",
-"蜜糖罐"     , "🍯",
-"蜜蜂"      , "🐝",
-"蜡烛"      , "🕯",
-"蜡笔"      , "🖍",
-"蜥蜴"      , "🦎",
-"蝎子"      , "🦂",
-"蝙蝠"      , "🦇",
-"蝴蝶"      , "🦋",
-"蝴蝶结"     , "💝",
-"蝴蝶酥"     , "🥨",
-"融"       , "🫕",
-"螺"       , "🐚",
-"螺丝"      , "🪛",
-"螺丝批"     , "🪛",
-"螺旋"      , "🗒",
-"螺旋形"     , "🐚",
-"螺栓"      , "🔩",
-"螺母"      , "🔩",
-"蟹"       , "🦀",
-"血型"      , "🅰",
-"血液"      , "🩸",
-"行人"      , "🚸",
-"行尸"      , "🧟",
-"行山"      , "🥾",
-"行山鞋"     , "🥾",
-"行李"      , "🧳",
-"行紧路"     , "🚶",
-"行路"      , "🚶",
-"表情"      , "🙍",
-"表演"      , "🎭",
-"衫"       , "🎽",
-"袋"       , "👝",
-"袋棍球"     , "🥍",
-"袋鼠"      , "🦘",
-"袜"       , "🧦",
-"裁剪"      , "🪡",
-"装配"      , "👨‍🏭",
-"装饰"      , "📔",
-"裇衫"      , "👕",
-"裙"       , "👗",
-"裤"       , "👖",
-"西"       , "⬅",
-"西兰花"     , "🥦",
-"西北"      , "↖",
-"西南"      , "↙",
-"西瓜"      , "🍉",
-"西装"      , "🕴",
-"见证"      , "👁‍🗨",
-"解锁"      , "🔓",
-"警告"      , "⚠",
-"警员"      , "👮",
-"警官"      , "👮",
-"警察"      , "👮",
-"警报"      , "⏰",
-"警示灯"     , "🚨",
-"警车"      , "🚓",
-"警车灯"     , "🚨",
-"计数"      , "🧮",
-"计时器"     , "⌛",
-"训紧觉"     , "😴",
-"训觉"      , "😪",
-"讯号"      , "📶",
-"讲"       , "🙊",
-"讲价"      , "🉐",
-"讲大话"     , "🤥",
-"讲师"      , "👨‍🏫",
-"讲野"      , "💬",
-"讽刺"      , "😼",
-"证据"      , "🧾",
-"证明"      , "🧾",
-"试味"      , "😝",
-"试管"      , "🧪",
-"试食"      , "😋",
-"请"       , "🙏",
-"谂野"      , "🤔",
-"调味"      , "🧄",
-"调味料"     , "🧂",
-"调查员"     , "🕵",
-"调皮"      , "🦦",
-"调色板"     , "🧑‍🎨",
-"谷物"      , "🌾",
-"豹"       , "🐆",
-"账簿"      , "📒",
-"货币"      , "💴",
-"货船"      , "🎢",
-"货车"      , "🛻",
-"质问"      , "🤌",
-"购物"      , "🛍",
-"购物袋"     , "🛍",
-"购物车"     , "🛒",
-"资讯"      , "💁",
-"赏月"      , "🎑",
-"赛跑"      , "🏃‍♂",
-"赛跑衫"     , "🎽",
-"赛车"      , "🏎",
-"赛马"      , "🏇",
-"赢"       , "😤",
-"赢咗"      , "😤",
-"赶上"      , "🪝",
-"起重机"     , "🛗",
-"超人"      , "🦸",
-"超级"      , "🦸",
-"趋势"      , "💹",
-"足球"      , "⚽",
-"跆拳道"     , "🥋",
-"跑"       , "💨",
-"跑步"      , "🏃",
-"跑鞋"      , "👟",
-"跪"       , "🧎",
-"跪嘅人"     , "🧎",
-"路"       , "🛣",
-"跳"       , "🦘",
-"跳伞"      , "🪂",
-"跳动"      , "💓",
-"跳舞"      , "💃",
-"踏"       , "🦶",
-"踢"       , "🦵",
-"踩单车"     , "🚴",
-"踫杯"      , "🍻",
-"身份"      , "🆔",
-"身体"      , "👂",
-"车"       , "🚃",
-"车厘子"     , "🍒",
-"车站"      , "🚉",
-"车辆"      , "🚝",
-"轨迹球"     , "🖲",
-"轮"       , "🎡",
-"轮廓"      , "☺",
-"轮椅"      , "🧑‍🦼",
-"软"       , "🧇",
-"软件"      , "🧑‍💻",
-"软雪糕"     , "🍦",
-"轰"       , "💥",
-"轻铁"      , "🚈",
-"较剪"      , "✂",
-"辅助"      , "🦾",
-"输入"      , "🔠",
-"辣"       , "🌶",
-"辣椒"      , "🫑",
-"过山车"     , "🎢",
-"过路"      , "🚸",
-"运动"      , "👟",
-"运动场"     , "🎽",
-"运动鞋"     , "👟",
-"返回"      , "🔙",
-"进入"      , "⛔",
-"进化"      , "🧬",
-"远足"      , "🚶",
-"连住"      , "🖇",
-"连结"      , "🔗",
-"迪亚"      , "🪔",
-"迪亚灯"     , "🪔",
-"迷茫"      , "😕",
-"退出"      , "⏏",
-"送礼"      , "🎁",
-"送货"      , "🚚",
-"送货车"     , "🚚",
-"逆时针"     , "🔄",
-"选框"      , "☑",
-"透明"      , "🪟",
-"通渠"      , "🪠",
-"速度"      , "🚄",
-"道"       , "☯",
-"道教"      , "☯",
-"道歉"      , "🙇",
-"遗传学"     , "🧬",
-"遮"       , "🏖",
-"邋遢"      , "🧐",
-"邪恶"      , "🙈",
-"邪眼"      , "🧿",
-"邮件"      , "📧",
-"邮局"      , "🏤",
-"邮政"      , "🏣",
-"邮箱"      , "📫",
-"郁金香"     , "🌷",
-"部门"      , "🏬",
-"酒"       , "🍷",
-"酒吧"      , "🍶",
-"酒塞"      , "🍾",
-"酒店"      , "🛌",
-"酱"       , "🥯",
-"酷"       , "😎",
-"醉"       , "🥴",
-"醉嘅脸"     , "🥴",
-"醒"       , "😎",
-"采矿"      , "⛏",
-"重"       , "🪨",
-"重覆"      , "🔁",
-"重量"      , "⚖",
-"野牛"      , "🦬",
-"野餐"      , "🧺",
-"金"       , "🪙",
-"金属"      , "🪙",
-"金牌"      , "🥇",
-"金牛座"     , "🐂",
-"针"       , "🪡",
-"针筒"      , "💉",
-"针织"      , "🧶",
-"钓鱼"      , "🦦",
-"钓鱼竿"     , "🎣",
-"钟"       , "🛎",
-"钢琴"      , "🎹",
-"钢笔"      , "🖋",
-"钩针"      , "🧶",
-"钮"       , "🎛",
-"钱"       , "🪙",
-"钱袋"      , "💰",
-"钳"       , "🗜",
-"钻石"      , "💍",
-"铁"       , "🧇",
-"铁路"      , "🚂",
-"铁路车"     , "🚃",
-"铃"       , "🎐",
-"铅笔"      , "✏",
-"铜"       , "🥉",
-"铜牌"      , "🥉",
-"银"       , "🪙",
-"银河"      , "🌌",
-"银牌"      , "🥈",
-"银纸"      , "💴",
-"银行"      , "🏦",
-"链"       , "⛓",
-"锁"       , "🔓",
-"锁匙"      , "🔐",
-"锅"       , "🍲",
-"锚"       , "⚓",
-"锤"       , "🔨",
-"锤同挑"     , "⚒",
-"键盘"      , "🎹",
-"锯"       , "🪚",
-"镜"       , "🪞",
-"镜片"      , "🔍",
-"长大"      , "💗",
-"长条"      , "🏮",
-"长毛象"     , "🦣",
-"长牙"      , "🦣",
-"长裤"      , "👖",
-"长颈鹿"     , "🦒",
-"长鼓"      , "🪘",
-"门"       , "🚪",
-"门券"      , "🎫",
-"闩"       , "📴",
-"闩埋"      , "📕",
-"闪"       , "💖",
-"闪光"      , "📸",
-"闪嘅心"     , "💖",
-"闪电"      , "🌩",
-"闪电云"     , "🌩",
-"闪耀"      , "🌟",
-"闪闪"      , "❇",
-"问"       , "🙏",
-"问号"      , "❓",
-"问题"      , "⁉",
-"间尺"      , "📏",
-"间谍"      , "🕵",
-"闷"       , "🪴",
-"闹钟"      , "⏰",
-"防晒"      , "🧴",
-"阳"       , "☯",
-"阴"       , "☯",
-"阴沉"      , "🪐",
-"阴阳"      , "☯",
-"阶砖"      , "♦",
-"阿米巴"     , "🦠",
-"陆龟"      , "🐢",
-"降落"      , "🛬",
-"降落伞"     , "🪂",
-"除"       , "➗",
-"陶醉"      , "🥴",
-"陷阱"      , "🪤",
-"隐形"      , "🥷",
-"隐私"      , "🔏",
-"障碍物"     , "🚧",
-"雀"       , "🦃",
-"雀仔"      , "🐦",
-"雌性"      , "🐑",
-"雌性猪"     , "🐖",
-"雕像"      , "🗽",
-"雨"       , "⛈",
-"雨云"      , "🌧",
-"雪"       , "⛷",
-"雪云"      , "🌨",
-"雪人"      , "☃",
-"雪山"      , "🏔",
-"雪橇"      , "🛷",
-"雪糕"      , "🍦",
-"雪花"      , "❄",
-"雷电"      , "⛈",
-"雷龙"      , "🦕",
-"雾"       , "🌫",
-"震动"      , "📳",
-"震惊"      , "🤯",
-"露营"      , "🏕",
-"青瓜"      , "🥒",
-"青色"      , "🍏",
-"青苹果"     , "🍏",
-"青蛙"      , "🐸",
-"青蛙脸"     , "🐸",
-"靓"       , "🦩",
-"静"       , "🤫",
-"静音"      , "🔇",
-"非洲"      , "🦱",
-"非饮用"     , "🚱",
-"面"       , "🥸",
-"面具"      , "🥸",
-"面包"      , "🍞",
-"面纱"      , "🧕",
-"靴"       , "🥾",
-"靴子"      , "👢",
-"靶"       , "🎯",
-"靶心"      , "🎯",
-"鞋"       , "👞",
-"鞠躬"      , "🙏",
-"音乐"      , "🎼",
-"音符"      , "🎵",
-"页"       , "📃",
-"顶帽"      , "🎩",
-"顶部"      , "🔝",
-"项链"      , "📿",
-"顺时针"     , "🔃",
-"须"       , "🧔",
-"预言"      , "🥠",
-"预订"      , "🈯",
-"领取"      , "🛄",
-"领呔"      , "🪢",
-"颈"       , "🧣",
-"颈巾"      , "🧣",
-"风"       , "🍃",
-"风筝"      , "🪁",
-"风脸"      , "🌬",
-"风铃"      , "🎐",
-"飘动"      , "🍃",
-"飞"       , "🕊",
-"飞机"      , "🧑‍✈",
-"飞机师"     , "🧑‍✈",
-"飞碟"      , "👽",
-"飞镖"      , "🎯",
-"食物"      , "🫒",
-"餐具"      , "🥄",
-"饭"       , "🍙",
-"饭团"      , "🍙",
-"饮"       , "🫖",
-"饮品"      , "🍼",
-"饮水"      , "🚰",
-"饮用"      , "🚰",
-"饮管杯"     , "🥤",
-"饮酒"      , "🍶",
-"饵"       , "🪤",
-"饺子"      , "🥟",
-"饼"       , "🍘",
-"馅料"      , "🥧",
-"馅饼"      , "🫓",
-"香烟"      , "🚬",
-"香肠"      , "🌭",
-"香草"      , "🌿",
-"香蕉"      , "🍌",
-"马"       , "🏇",
-"马戏团"     , "🎪",
-"马拉松"     , "🏃",
-"马脸"      , "🐴",
-"马蹄铁"     , "🧲",
-"马骝"      , "🙈",
-"马骝脸"     , "🐵",
-"驼峰"      , "🐪",
-"骄傲"      , "🦚",
-"骆马"      , "🦙",
-"骆驼"      , "🐪",
-"骑单车"     , "🚵‍♀",
-"骑师"      , "🏇",
-"骨"       , "🍖",
-"骨头"      , "🦴",
-"骰子"      , "🎲",
-"骷髅头"     , "💀",
-"高压"      , "⚡",
-"高尔夫"     , "🏌",
-"高根鞋"     , "👠",
-"高飞"      , "🪁",
-"髪型屋"     , "💈",
-"鬼"       , "👻",
-"魅力"      , "🧿",
-"魔术"      , "🪄",
-"魔法棒"     , "🪄",
-"魔鬼"      , "👿",
-"鱼"       , "🐟",
-"鱿鱼"      , "🦑",
-"鲤鱼"      , "🎏",
-"鲤鱼旗"     , "🎏",
-"鲨鱼"      , "🦈",
-"鲸鱼"      , "🐳",
-"鳄鱼"      , "🐊",
-"鳍"       , "🐬",
-"鸡"       , "🐔",
-"鸡仔"      , "🐤",
-"鸡尾酒"     , "🍸",
-"鸡泡鱼"     , "🐡",
-"鸡肶"      , "🍗",
-"鸢尾花"     , "⚜",
-"鸣门卷"     , "🍥",
-"鸭"       , "🦆",
-"鸽"       , "🕊",
-"鹰"       , "🦅",
-"鹰嘴豆"     , "🧆",
-"鹿"       , "🦌",
-"麻雀"      , "🀄",
-"黄昏"      , "🌆",
-"黄色"      , "💛",
-"黄色心"     , "💛",
-"黎紧"      , "🚍",
-"黑暗"      , "🌑",
-"黑猫"      , "🐈‍⬛",
-"黑色"      , "🖤",
-"黑色心"     , "🖤",
-"黑色旗"     , "🏴",
-"鼓"       , "🪘",
-"鼓棍"      , "🥁",
-"鼠"       , "🐀",
-"鼻"       , "🥸",
-"齿轮"      , "⚙",
-"龙"       , "🐲",
-"龙卷风"     , "🌀",
-"龙脸"      , "🐲",
-"龙虾"      , "🦞",
-"龙门"      , "🥅"
+static const EmojiTable chinese_emoji_table = {
+    chinese_emoji_strings,
+    chinese_emoji_slots, G_N_ELEMENTS (chinese_emoji_slots),
+    chinese_emoji_results,
+    chinese_emoji_seeds, G_N_ELEMENTS (chinese_emoji_seeds),
 };
 
 };
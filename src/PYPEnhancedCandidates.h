@@ -22,7 +22,6 @@
 #define __PY_LIB_PINYIN_ENHANCED_CANDIDATES_H_
 
 #include <glib.h>
-#include <string>
 #include <vector>
 
 namespace PY {
@@ -54,7 +53,9 @@ enum SelectCandidateAction {
 struct EnhancedCandidate {
     CandidateType m_candidate_type;
     guint m_candidate_id;
-    std::string m_display_string;
+    /* owned by the provider of the candidate, valid until
+       the provider processes the candidates again. */
+    const gchar *m_display_string;
 };
 
 template <class IEditor>
@@ -28,11 +28,12 @@ FullPinyinEditor::FullPinyinEditor
 (PinyinProperties & props, Config & config)
     : PinyinEditor (props, config)
 {
-    m_instance = LibPinyinBackEnd::instance ().allocPinyinInstance ();
+    m_instance = LibPinyinBackEnd::instance ().allocPinyinInstance (&m_config);
 }
 
 FullPinyinEditor::~FullPinyinEditor (void)
 {
+    cancelGuess ();
     LibPinyinBackEnd::instance ().freePinyinInstance (m_instance);
     m_instance = NULL;
 }
@@ -51,9 +52,7 @@ FullPinyinEditor::insert (gint ch)
         return TRUE;
 
     m_text.insert (m_cursor++, ch);
-
-    updatePinyin ();
-    update ();
+    scheduleUpdate ();
     return TRUE;
 }
 
@@ -66,20 +65,11 @@ FullPinyinEditor::processKeyEvent (guint keyval,
     return PinyinEditor::processKeyEvent (keyval, keycode, modifiers);
 }
 
-void
-FullPinyinEditor::updatePinyin (void)
+guint
+FullPinyinEditor::parsePinyin (pinyin_instance_t *instance, const String & text)
 {
-    if (G_UNLIKELY (m_text.empty ())) {
-        m_pinyin_len = 0;
-        /* TODO: check whether to replace "" with NULL. */
-        pinyin_parse_more_full_pinyins (m_instance, "");
-        pinyin_guess_sentence (m_instance);
-        return;
-    }
-
-    m_pinyin_len =
-        pinyin_parse_more_full_pinyins (m_instance, m_text.c_str ());
-    pinyin_guess_sentence (m_instance);
+    /* called from the guess worker as well, only use the arguments. */
+    return pinyin_parse_more_full_pinyins (instance, text.c_str ());
 }
 
 void
@@ -95,10 +85,14 @@ FullPinyinEditor::updateAuxiliaryText (void)
 
     m_buffer.clear ();
 
-    gchar * aux_text = NULL;
-    pinyin_get_full_pinyin_auxiliary_text (m_instance, m_cursor, &aux_text);
-    m_buffer << aux_text;
-    g_free(aux_text);
+    if (!m_auxiliary_text.valid (m_revision, m_cursor)) {
+        gchar * aux_text = NULL;
+        LibPinyinBackEnd::Locker locker;
+        pinyin_get_full_pinyin_auxiliary_text (m_instance, m_cursor, &aux_text);
+        m_auxiliary_text.set (m_revision, m_cursor, aux_text ? aux_text : "");
+        g_free (aux_text);
+    }
+    m_buffer << m_auxiliary_text.get ();
 
     /* append rest text */
     const gchar * p = m_text.c_str() + m_pinyin_len;
@@ -112,19 +106,10 @@ FullPinyinEditor::updateAuxiliaryText (void)
 }
 
 guint
-FullPinyinEditor::getLookupCursor (void)
+FullPinyinEditor::getPinyinEnd (void)
 {
-    guint lookup_cursor = getPinyinCursor ();
-
     /* as pinyin_get_pinyin_offset can't handle the last "'" characters,
-       strip the string to work around it here. */
-    String stripped = m_text;
-    size_t pos = stripped.find_last_not_of ("'") + 1;
-    if (pos < stripped.length ())
-        stripped.erase (pos);
-
-    /* show candidates when pinyin cursor is at end. */
-    if (lookup_cursor == stripped.length ())
-        lookup_cursor = 0;
-    return lookup_cursor;
+       ignore them here. */
+    size_t pos = m_text.find_last_not_of ("'");
+    return (pos == String::npos) ? 0 : pos + 1;
 }
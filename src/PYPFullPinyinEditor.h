@@ -40,9 +40,10 @@ public:
 
 protected:
 
-    virtual void updatePinyin (void);
+    virtual guint parsePinyin (pinyin_instance_t *instance,
+                               const String & text);
 
-    virtual guint getLookupCursor (void);
+    virtual guint getPinyinEnd (void);
 
 };
 
@@ -0,0 +1,198 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PYPGuessWorker.h"
+#include <algorithm>
+#include <deque>
+#include "PYLibPinyin.h"
+
+using namespace PY;
+
+/* the thread shared by all workers, started with the first worker
+   and joined with the last one. */
+static GMutex worker_mutex;
+static GCond worker_cond;
+static GThread *worker_thread = NULL;
+static guint worker_refs = 0;
+static gboolean worker_quit = FALSE;
+static std::deque<GuessWorker *> worker_queue;
+
+GuessWorker::GuessWorker (ParseFunc parse, FinishFunc finish)
+    : m_parse (parse),
+      m_finish (finish),
+      m_busy (FALSE),
+      m_queued (FALSE),
+      m_running (FALSE),
+      m_finished (FALSE),
+      m_finished_id (0)
+{
+    g_mutex_lock (&worker_mutex);
+    if (0 == worker_refs++) {
+        worker_quit = FALSE;
+        worker_thread = g_thread_new ("guess-worker",
+                                      GuessWorker::threadFunc, NULL);
+    }
+    g_mutex_unlock (&worker_mutex);
+}
+
+GuessWorker::~GuessWorker (void)
+{
+    GThread *thread = NULL;
+
+    g_mutex_lock (&worker_mutex);
+
+    /* drop the queued job, finish the running one. */
+    if (m_queued) {
+        worker_queue.erase (std::find (worker_queue.begin (),
+                                       worker_queue.end (), this));
+        m_queued = FALSE;
+    }
+    while (m_running)
+        g_cond_wait (&worker_cond, &worker_mutex);
+
+    if (m_finished_id != 0)
+        g_source_remove (m_finished_id);
+    m_finished_id = 0;
+
+    if (0 == --worker_refs) {
+        worker_quit = TRUE;
+        g_cond_broadcast (&worker_cond);
+        thread = worker_thread;
+        worker_thread = NULL;
+    }
+
+    g_mutex_unlock (&worker_mutex);
+
+    if (thread)
+        g_thread_join (thread);
+}
+
+void
+GuessWorker::submit (const Job & job)
+{
+    g_assert (!m_busy);
+
+    g_mutex_lock (&worker_mutex);
+    m_job = job;
+    m_busy = TRUE;
+    m_queued = TRUE;
+    m_finished = FALSE;
+    worker_queue.push_back (this);
+    g_cond_broadcast (&worker_cond);
+    g_mutex_unlock (&worker_mutex);
+}
+
+gboolean
+GuessWorker::wait (Job & job)
+{
+    if (!m_busy)
+        return FALSE;
+
+    g_mutex_lock (&worker_mutex);
+    while (!m_finished)
+        g_cond_wait (&worker_cond, &worker_mutex);
+
+    if (m_finished_id != 0) {
+        g_source_remove (m_finished_id);
+        m_finished_id = 0;
+    }
+    m_finished = FALSE;
+    job = m_job;
+    g_mutex_unlock (&worker_mutex);
+
+    m_busy = FALSE;
+    return TRUE;
+}
+
+void
+GuessWorker::run (Job & job)
+{
+    LibPinyinBackEnd::Locker locker;
+
+    job.pinyin_len = m_parse (job.instance, job.text);
+    pinyin_guess_sentence (job.instance);
+
+    size_t pinyin_cursor = 0;
+    pinyin_get_pinyin_offset (job.instance, job.cursor, &pinyin_cursor);
+    job.pinyin_cursor = pinyin_cursor;
+
+    /* show candidates when pinyin cursor is at end. */
+    job.lookup_cursor = pinyin_cursor;
+    if (job.lookup_cursor == job.pinyin_end)
+        job.lookup_cursor = 0;
+
+    pinyin_guess_candidates (job.instance, job.lookup_cursor,
+                             job.sort_option);
+}
+
+gpointer
+GuessWorker::threadFunc (gpointer data)
+{
+    g_mutex_lock (&worker_mutex);
+
+    while (TRUE) {
+        while (worker_queue.empty () && !worker_quit)
+            g_cond_wait (&worker_cond, &worker_mutex);
+        if (worker_queue.empty ())
+            break;
+
+        GuessWorker *worker = worker_queue.front ();
+        worker_queue.pop_front ();
+        worker->m_queued = FALSE;
+        worker->m_running = TRUE;
+        Job job = worker->m_job;
+        g_mutex_unlock (&worker_mutex);
+
+        worker->run (job);
+
+        g_mutex_lock (&worker_mutex);
+        worker->m_job = job;
+        worker->m_running = FALSE;
+        worker->m_finished = TRUE;
+        worker->m_finished_id =
+            g_idle_add (GuessWorker::finishedCallback,
+                        static_cast<gpointer> (worker));
+        g_cond_broadcast (&worker_cond);
+    }
+
+    g_mutex_unlock (&worker_mutex);
+    return NULL;
+}
+
+gboolean
+GuessWorker::finishedCallback (gpointer data)
+{
+    GuessWorker *self = static_cast<GuessWorker *> (data);
+
+    g_mutex_lock (&worker_mutex);
+    /* already taken by wait (). */
+    if (!self->m_finished || 0 == self->m_finished_id) {
+        g_mutex_unlock (&worker_mutex);
+        return FALSE;
+    }
+    self->m_finished_id = 0;
+    self->m_finished = FALSE;
+    Job job = self->m_job;
+    g_mutex_unlock (&worker_mutex);
+
+    self->m_busy = FALSE;
+    self->m_finish (job);
+    return FALSE;
+}
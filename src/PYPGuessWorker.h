@@ -0,0 +1,93 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PY_LIB_PINYIN_GUESS_WORKER_H_
+#define __PY_LIB_PINYIN_GUESS_WORKER_H_
+
+#include <functional>
+#include <glib.h>
+#include <pinyin.h>
+#include "PYString.h"
+
+namespace PY {
+
+/* parses the input and guesses the sentence and the candidates
+   on a worker thread. each editor has its own GuessWorker with at
+   most one job, the jobs of all workers run in order on one thread
+   shared by them.
+
+   the instance of a job belongs to the worker thread from submit ()
+   until the job is finished, the thread holds the LibPinyinBackEnd
+   lock while it uses the instance. */
+class GuessWorker {
+public:
+    struct Job {
+        /* input */
+        pinyin_instance_t *instance;
+        guint revision;
+        String text;
+        guint cursor;
+        guint pinyin_end;
+        sort_option_t sort_option;
+
+        /* output */
+        guint pinyin_len;
+        guint pinyin_cursor;
+        guint lookup_cursor;
+    };
+
+    /* parses the text into the instance, returns the parsed length. */
+    typedef std::function<guint (pinyin_instance_t *, const String &)> ParseFunc;
+    /* called in the main loop when a job is finished. */
+    typedef std::function<void (Job &)> FinishFunc;
+
+    GuessWorker (ParseFunc parse, FinishFunc finish);
+    ~GuessWorker (void);
+
+    gboolean busy (void) const { return m_busy; }
+
+    void submit (const Job & job);
+
+    /* waits for the running job and returns it instead of
+       calling the finish function, FALSE when the worker is idle. */
+    gboolean wait (Job & job);
+
+private:
+    void run (Job & job);
+    static gpointer threadFunc (gpointer data);
+    static gboolean finishedCallback (gpointer data);
+
+private:
+    ParseFunc m_parse;
+    FinishFunc m_finish;
+
+    Job m_job;
+    /* only changed in the main loop. */
+    gboolean m_busy;
+    /* protected by the shared worker mutex. */
+    gboolean m_queued;
+    gboolean m_running;
+    gboolean m_finished;
+    guint m_finished_id;
+};
+
+};
+
+#endif
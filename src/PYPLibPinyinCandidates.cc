@@ -32,6 +32,9 @@ gboolean
 LibPinyinCandidates::processCandidates (std::vector<EnhancedCandidate> & candidates)
 {
     pinyin_instance_t *instance = m_editor->m_instance;
+    LibPinyinBackEnd::Locker locker;
+
+    m_strings.reset ();
 
     guint len = 0;
     pinyin_get_n_candidate (instance, &len);
@@ -67,7 +70,7 @@ LibPinyinCandidates::processCandidates (std::vector<EnhancedCandidate> & candida
         }
 
         enhanced.m_candidate_id = i;
-        enhanced.m_display_string = phrase_string;
+        enhanced.m_display_string = m_strings.dup (phrase_string);
 
         candidates.push_back (enhanced);
     }
@@ -82,6 +85,7 @@ LibPinyinCandidates::selectCandidate (EnhancedCandidate & enhanced)
     assert (CANDIDATE_NBEST_MATCH == enhanced.m_candidate_type ||
             CANDIDATE_NORMAL == enhanced.m_candidate_type ||
             CANDIDATE_USER == enhanced.m_candidate_type);
+    LibPinyinBackEnd::Locker locker;
 
     guint len = 0;
     pinyin_get_n_candidate (instance, &len);
@@ -99,6 +103,7 @@ LibPinyinCandidates::selectCandidate (EnhancedCandidate & enhanced)
         /* because nbest match candidate
            starts from the beginning of user input. */
         pinyin_choose_candidate (instance, 0, candidate);
+        m_editor->bumpRevision ();
 
         guint8 index = 0;
         pinyin_get_candidate_nbest_index(instance, candidate, &index);
@@ -119,10 +124,11 @@ LibPinyinCandidates::selectCandidate (EnhancedCandidate & enhanced)
         (instance, lookup_cursor, candidate);
 
     pinyin_guess_sentence (instance);
+    m_editor->bumpRevision ();
 
     if (lookup_cursor == m_editor->m_text.length ()) {
         pinyin_get_sentence (instance, 0, &str);
-        enhanced.m_display_string = str;
+        enhanced.m_display_string = m_strings.dup (str);
         pinyin_train (instance, 0);
 
         if (m_editor->m_config.rememberEveryInput ())
@@ -151,6 +157,7 @@ LibPinyinCandidates::removeCandidate (EnhancedCandidate & enhanced)
     if (enhanced.m_candidate_type != CANDIDATE_USER)
         return FALSE;
 
+    LibPinyinBackEnd::Locker locker;
     lookup_candidate_t * candidate = NULL;
     guint index = enhanced.m_candidate_id;
     pinyin_get_candidate (instance, index, &candidate);
@@ -22,6 +22,7 @@
 #define __PY_LIB_PINYIN_LIB_PINYIN_CANDIDATES_H_
 
 #include "PYPEnhancedCandidates.h"
+#include "PYPStringArena.h"
 
 namespace PY {
 
@@ -38,6 +39,9 @@ public:
 
     int selectCandidate (EnhancedCandidate & enhanced);
     gboolean removeCandidate (EnhancedCandidate & enhanced);
+
+protected:
+    StringArena m_strings;
 };
 
 };
@@ -20,6 +20,7 @@
 
 #include "PYPLuaConverterCandidates.h"
 #include <assert.h>
+#include <algorithm>
 #include "PYString.h"
 #include "PYConfig.h"
 #include "PYPPhoneticEditor.h"
@@ -31,47 +32,107 @@ LuaConverterCandidates::LuaConverterCandidates (Editor *editor)
     m_editor = editor;
 }
 
+/* the converted strings kept for a converter, dropped when full. */
+#define MAX_MEMO_SIZE 4096
+
 gboolean
 LuaConverterCandidates::setLuaPlugin (IBusEnginePlugin * plugin)
 {
     m_lua_plugin = plugin;
+    m_memo.clear ();
     return TRUE;
 }
 
 gboolean
 LuaConverterCandidates::setConverter (const char * lua_function_name)
 {
+    if (m_converter != lua_function_name) {
+        m_converter = lua_function_name;
+        m_memo.clear ();
+    }
+
     return ibus_engine_plugin_set_converter (m_lua_plugin, lua_function_name);
 }
 
+void
+LuaConverterCandidates::convert (std::vector<const gchar *> & strings)
+{
+    m_missed.clear ();
+    m_missed_index.clear ();
+
+    for (guint i = 0; i < strings.size (); i++) {
+        std::unordered_map<std::string, std::string>::const_iterator iter =
+            m_memo.find (strings[i]);
+
+        if (iter != m_memo.end ()) {
+            strings[i] = m_strings.dup (iter->second.c_str (),
+                                        iter->second.length ());
+        } else {
+            m_missed.push_back (strings[i]);
+            m_missed_index.push_back (i);
+        }
+    }
+
+    if (m_missed.empty ())
+        return;
+
+    m_results.resize (m_missed.size ());
+    gboolean converted = ibus_engine_plugin_convert
+        (m_lua_plugin, &m_missed[0], m_missed.size (), &m_results[0]);
+
+    if (converted && m_memo.size () + m_missed.size () > MAX_MEMO_SIZE)
+        m_memo.clear ();
+
+    for (guint i = 0; i < m_missed.size (); i++) {
+        /* keep the string when the converter gives no result. */
+        const gchar * result = m_results[i] ? m_results[i] : m_missed[i];
+
+        if (converted)
+            m_memo[m_missed[i]] = result;
+
+        strings[m_missed_index[i]] = m_strings.dup (result);
+        g_free (m_results[i]);
+    }
+}
+
 gboolean
-LuaConverterCandidates::processCandidates (std::vector<EnhancedCandidate> & candidates)
+LuaConverterCandidates::processCandidates (std::vector<EnhancedCandidate> & candidates,
+                                           guint begin, guint end)
 {
     if (!m_lua_plugin)
         return FALSE;
 
-    m_candidates.clear ();
+    if (0 == begin) {
+        m_candidates.clear ();
+        m_strings.reset ();
+    }
 
     const char * converter = ibus_engine_plugin_get_converter (m_lua_plugin);
 
     if (NULL == converter)
         return FALSE;
 
-    for (guint i = 0; i < candidates.size (); i++) {
+    end = std::min (end, (guint) candidates.size ());
+    if (begin >= end)
+        return TRUE;
+
+    m_converting.clear ();
+    for (guint i = begin; i < end; i++) {
         EnhancedCandidate & enhanced = candidates[i];
 
         m_candidates.push_back (enhanced);
+        m_converting.push_back (enhanced.m_display_string);
 
         enhanced.m_candidate_type = CANDIDATE_LUA_CONVERTER;
-        enhanced.m_candidate_id = i;
-
-        ibus_engine_plugin_call (m_lua_plugin, converter,
-                                enhanced.m_display_string.c_str ());
-        gchar * string = ibus_engine_plugin_get_first_result (m_lua_plugin);
-        enhanced.m_display_string = string;
-        g_free (string);
+        enhanced.m_candidate_id = m_candidates.size () - 1;
     }
 
+    /* one lua call for the whole window. */
+    convert (m_converting);
+
+    for (guint i = begin; i < end; i++)
+        candidates[i].m_display_string = m_converting[i - begin];
+
     return TRUE;
 }
 
@@ -90,11 +151,9 @@ LuaConverterCandidates::selectCandidate (EnhancedCandidate & enhanced)
     int action = m_editor->selectCandidateInternal (m_candidates[id]);
 
     if (action & SELECT_CANDIDATE_MODIFY_IN_PLACE) {
-        ibus_engine_plugin_call (m_lua_plugin, converter,
-                                 enhanced.m_display_string.c_str ());
-        gchar * string = ibus_engine_plugin_get_first_result (m_lua_plugin);
-        enhanced.m_display_string = string;
-        g_free (string);
+        m_converting.assign (1, m_candidates[id].m_display_string);
+        convert (m_converting);
+        enhanced.m_display_string = m_converting[0];
     }
 
     return action;
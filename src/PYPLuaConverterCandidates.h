@@ -23,9 +23,12 @@
 
 #include "lua-plugin.h"
 
+#include <string>
+#include <unordered_map>
 #include <vector>
 #include "PYPointer.h"
 #include "PYPEnhancedCandidates.h"
+#include "PYPStringArena.h"
 
 namespace PY {
 
@@ -38,17 +41,38 @@ public:
 public:
     gboolean setLuaPlugin (IBusEnginePlugin * plugin);
 
+    /* a different converter drops the converted strings. */
     gboolean setConverter (const char * lua_function_name);
 
-    gboolean processCandidates (std::vector<EnhancedCandidate> & candidates);
+    /* converts the candidates in [begin, end) in place,
+       a new candidate list starts from zero. */
+    gboolean processCandidates (std::vector<EnhancedCandidate> & candidates,
+                                guint begin, guint end);
 
     int selectCandidate (EnhancedCandidate & enhanced);
     gboolean removeCandidate (EnhancedCandidate & enhanced);
 
 protected:
+    /* converts the strings in place with one lua call for the strings
+       not converted before. */
+    void convert (std::vector<const gchar *> & strings);
+
     std::vector<EnhancedCandidate> m_candidates;
 
     Pointer<IBusEnginePlugin> m_lua_plugin;
+
+    /* the converted strings. */
+    StringArena m_strings;
+
+    std::string m_converter;
+    /* the converted strings of m_converter. */
+    std::unordered_map<std::string, std::string> m_memo;
+
+    /* buffers of convert. */
+    std::vector<const gchar *> m_converting;
+    std::vector<const gchar *> m_missed;
+    std::vector<guint> m_missed_index;
+    std::vector<gchar *> m_results;
 };
 
 };
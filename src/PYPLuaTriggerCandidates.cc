@@ -44,6 +44,8 @@ LuaTriggerCandidates::processCandidates (std::vector<EnhancedCandidate> & candid
     if (!m_lua_plugin)
         return FALSE;
 
+    m_strings.reset ();
+
     EnhancedCandidate enhanced;
     enhanced.m_candidate_type = CANDIDATE_LUA_TRIGGER;
     enhanced.m_candidate_id = 0;
@@ -60,10 +62,15 @@ LuaTriggerCandidates::processCandidates (std::vector<EnhancedCandidate> & candid
 
     if (ibus_engine_plugin_match_input
         (m_lua_plugin, text, &lua_function_name)) {
-        ibus_engine_plugin_call (m_lua_plugin, lua_function_name, text);
+        /* the call fails when the function is over its time budget. */
+        if (0 == ibus_engine_plugin_call (m_lua_plugin,
+                                          lua_function_name, text))
+            return FALSE;
 
         string = ibus_engine_plugin_get_first_result (m_lua_plugin);
-        enhanced.m_display_string = string;
+        if (NULL == string)
+            return FALSE;
+        enhanced.m_display_string = m_strings.dup (string);
         g_free (string);
 
         candidates.insert (pos, enhanced);
@@ -72,13 +79,17 @@ LuaTriggerCandidates::processCandidates (std::vector<EnhancedCandidate> & candid
         int num = std::min
             (m_editor->m_config.pageSize (), (guint)candidates.size ());
         for (int i = 0; i < num; ++i) {
-            text = candidates[i].m_display_string.c_str ();
+            text = candidates[i].m_display_string;
             if (ibus_engine_plugin_match_candidate
                 (m_lua_plugin, text, &lua_function_name)) {
-                ibus_engine_plugin_call (m_lua_plugin, lua_function_name, text);
+                if (0 == ibus_engine_plugin_call (m_lua_plugin,
+                                                  lua_function_name, text))
+                    continue;
 
                 string = ibus_engine_plugin_get_first_result (m_lua_plugin);
-                enhanced.m_display_string = string;
+                if (NULL == string)
+                    continue;
+                enhanced.m_display_string = m_strings.dup (string);
                 g_free (string);
 
                 candidates.insert (pos, enhanced);
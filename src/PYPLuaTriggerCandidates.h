@@ -25,6 +25,7 @@
 
 #include "PYPointer.h"
 #include "PYPEnhancedCandidates.h"
+#include "PYPStringArena.h"
 
 namespace PY {
 
@@ -44,6 +45,8 @@ public:
 
 protected:
     Pointer<IBusEnginePlugin> m_lua_plugin;
+
+    StringArena m_strings;
 };
 
 };
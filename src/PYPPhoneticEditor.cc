@@ -21,6 +21,7 @@
 #include "PYPPhoneticEditor.h"
 #include <assert.h>
 #include "PYConfig.h"
+#include "PYLibPinyin.h"
 #include "PYPinyinProperties.h"
 
 using namespace PY;
@@ -31,6 +32,8 @@ PhoneticEditor::PhoneticEditor (PinyinProperties &props,
     : Editor (props, config),
     m_pinyin_len (0),
     m_lookup_table (m_config.pageSize ()),
+    m_revision (1),
+    m_update_id (0),
     m_libpinyin_candidates (this),
 #ifdef IBUS_BUILD_LUA_EXTENSION
     m_lua_trigger_candidates (this),
@@ -39,9 +42,61 @@ PhoneticEditor::PhoneticEditor (PinyinProperties &props,
     m_emoji_candidates (this),
     m_traditional_candidates (this, config)
 {
+    m_pipeline.addStage
+        (TRACE_STAGE_LIBPINYIN_CANDIDATES, CANDIDATE_WINDOW_ALL, nullptr,
+         [this] (std::vector<EnhancedCandidate> & candidates,
+                 guint begin, guint end) {
+            return m_libpinyin_candidates.processCandidates (candidates);
+        });
+
+    m_pipeline.addStage
+        (TRACE_STAGE_EMOJI_CANDIDATES, CANDIDATE_WINDOW_FIRST_PAGE,
+         [this] () { return m_config.emojiCandidate (); },
+         [this] (std::vector<EnhancedCandidate> & candidates,
+                 guint begin, guint end) {
+            return m_emoji_candidates.processCandidates (candidates);
+        });
+
+#ifdef IBUS_BUILD_LUA_EXTENSION
+    m_pipeline.addStage
+        (TRACE_STAGE_LUA_TRIGGER_CANDIDATES, CANDIDATE_WINDOW_FIRST_PAGE,
+         nullptr,
+         [this] (std::vector<EnhancedCandidate> & candidates,
+                 guint begin, guint end) {
+            return m_lua_trigger_candidates.processCandidates (candidates);
+        });
+
+    m_pipeline.addStage
+        (TRACE_STAGE_LUA_CONVERTER_CANDIDATES, CANDIDATE_WINDOW_VISIBLE,
+         [this] () {
+            std::string converter = m_config.luaConverter ();
+            if (converter.empty ())
+                return FALSE;
+            m_lua_converter_candidates.setConverter (converter.c_str ());
+            return TRUE;
+        },
+         [this] (std::vector<EnhancedCandidate> & candidates,
+                 guint begin, guint end) {
+            return m_lua_converter_candidates.processCandidates
+                (candidates, begin, end);
+        });
+#endif
+
+    m_pipeline.addStage
+        (TRACE_STAGE_TRADITIONAL_CANDIDATES, CANDIDATE_WINDOW_VISIBLE,
+         [this] () { return !m_props.modeSimp (); },
+         [this] (std::vector<EnhancedCandidate> & candidates,
+                 guint begin, guint end) {
+            return m_traditional_candidates.processCandidates
+                (candidates, begin, end);
+        });
 }
 
 PhoneticEditor::~PhoneticEditor (){
+    if (m_update_id != 0)
+        g_source_remove (m_update_id);
+    /* the sub classes call cancelGuess before freeing m_instance. */
+    m_guess_worker.reset ();
 }
 
 #ifdef IBUS_BUILD_LUA_EXTENSION
@@ -221,26 +276,14 @@ PhoneticEditor::updateLookupTable (void)
 gboolean
 PhoneticEditor::updateCandidates (void)
 {
-    m_candidates.clear ();
-
-    m_libpinyin_candidates.processCandidates (m_candidates);
-
-    if (m_config.emojiCandidate ())
-        m_emoji_candidates.processCandidates (m_candidates);
+    TraceScope scope (TRACE_STAGE_UPDATE_CANDIDATES);
 
-#ifdef IBUS_BUILD_LUA_EXTENSION
-    m_lua_trigger_candidates.processCandidates (m_candidates);
-
-    std::string converter = m_config.luaConverter ();
-
-    if (!converter.empty ()) {
-        m_lua_converter_candidates.setConverter (converter.c_str ());
-        m_lua_converter_candidates.processCandidates (m_candidates);
-    }
-#endif
+    m_candidates.clear ();
 
-    if (!m_props.modeSimp ())
-        m_traditional_candidates.processCandidates (m_candidates);
+    /* the converting stages only run on the first two pages here,
+       fillLookupTable () extends them as the user pages. */
+    guint page_size = m_lookup_table.pageSize ();
+    m_pipeline.run (m_candidates, page_size, 2 * page_size);
 
     return TRUE;
 }
@@ -248,12 +291,19 @@ PhoneticEditor::updateCandidates (void)
 gboolean
 PhoneticEditor::fillLookupTable (void)
 {
-    String word;
-    for (guint i = 0; i < m_candidates.size (); i++) {
-        EnhancedCandidate & candidate = m_candidates[i];
-        word = candidate.m_display_string;
+    TraceScope scope (TRACE_STAGE_FILL_LOOKUP_TABLE);
 
-        Text text (word);
+    /* only the page of the cursor and the next page are filled,
+       the rest is appended when the cursor moves down. */
+    guint page_size = m_lookup_table.pageSize ();
+    guint page = m_lookup_table.cursorPos () / page_size;
+    guint end = MIN ((page + 2) * page_size, m_candidates.size ());
+
+    m_pipeline.extend (m_candidates, end);
+
+    for (guint i = m_lookup_table.size (); i < end; i++) {
+        EnhancedCandidate & candidate = m_candidates[i];
+        Text text (candidate.m_display_string);
 
         /* show user candidate as blue. */
         if (CANDIDATE_USER == candidate.m_candidate_type)
@@ -268,6 +318,8 @@ PhoneticEditor::fillLookupTable (void)
 void
 PhoneticEditor::pageUp (void)
 {
+    flushUpdate ();
+
     if (G_LIKELY (m_lookup_table.pageUp ())) {
         updateLookupTableFast ();
         updatePreeditText ();
@@ -278,7 +330,10 @@ PhoneticEditor::pageUp (void)
 void
 PhoneticEditor::pageDown (void)
 {
+    flushUpdate ();
+
     if (G_LIKELY(m_lookup_table.pageDown ())) {
+        fillLookupTable ();
         updateLookupTableFast ();
         updatePreeditText ();
         updateAuxiliaryText ();
@@ -288,6 +343,8 @@ PhoneticEditor::pageDown (void)
 void
 PhoneticEditor::cursorUp (void)
 {
+    flushUpdate ();
+
     if (G_LIKELY (m_lookup_table.cursorUp ())) {
         updateLookupTableFast ();
         updatePreeditText ();
@@ -298,7 +355,10 @@ PhoneticEditor::cursorUp (void)
 void
 PhoneticEditor::cursorDown (void)
 {
+    flushUpdate ();
+
     if (G_LIKELY (m_lookup_table.cursorDown ())) {
+        fillLookupTable ();
         updateLookupTableFast ();
         updatePreeditText ();
         updateAuxiliaryText ();
@@ -308,6 +368,7 @@ PhoneticEditor::cursorDown (void)
 void
 PhoneticEditor::candidateClicked (guint index, guint button, guint state)
 {
+    flushUpdate ();
     selectCandidateInPage (index);
 }
 
@@ -317,7 +378,18 @@ PhoneticEditor::reset (void)
     m_pinyin_len = 0;
     m_lookup_table.clear ();
 
-    pinyin_reset (m_instance);
+    /* the pending keys are discarded with the text. */
+    if (m_update_id != 0) {
+        g_source_remove (m_update_id);
+        m_update_id = 0;
+    }
+    cancelGuess ();
+
+    {
+        LibPinyinBackEnd::Locker locker;
+        pinyin_reset (m_instance);
+    }
+    bumpRevision ();
 
     Editor::reset ();
 }
@@ -325,36 +397,231 @@ PhoneticEditor::reset (void)
 void
 PhoneticEditor::update (void)
 {
+    flushPinyin ();
+
     guint lookup_cursor = getLookupCursor ();
-    pinyin_guess_candidates (m_instance, lookup_cursor,
-                             m_config.sortOption ());
+    sort_option_t sort_option = m_config.sortOption ();
+    {
+        TraceScope scope (TRACE_STAGE_GUESS_CANDIDATES);
+        LibPinyinBackEnd::Locker locker;
+        pinyin_guess_candidates (m_instance, lookup_cursor, sort_option);
+    }
+    m_guessed_candidates.set (m_revision, lookup_cursor, sort_option);
 
     updateLookupTable ();
     updatePreeditText ();
     updateAuxiliaryText ();
 }
 
+void
+PhoneticEditor::updatePinyin (void)
+{
+    TraceScope scope (TRACE_STAGE_UPDATE_PINYIN);
+    LibPinyinBackEnd::Locker locker;
+    bumpRevision ();
+
+    m_pinyin_len = parsePinyin (m_instance, m_text);
+    pinyin_guess_sentence (m_instance);
+}
+
+void
+PhoneticEditor::scheduleUpdate (void)
+{
+    if (m_config.asyncCandidates ()) {
+        bumpRevision ();
+        submitGuess ();
+
+        /* show the input until the candidates are ready. */
+        Text text (m_text);
+        Editor::updatePreeditText (text, m_cursor, TRUE);
+        return;
+    }
+
+    if (!m_config.coalesceKeys ()) {
+        updatePinyin ();
+        update ();
+        return;
+    }
+
+    /* the keys arriving before the idle callback runs
+       only edit m_text, then they are parsed together. */
+    if (m_update_id != 0)
+        return;
+
+    m_update_id = g_idle_add (PhoneticEditor::updateCallback,
+                              static_cast<gpointer> (this));
+}
+
+void
+PhoneticEditor::flushPinyin (void)
+{
+    waitGuess ();
+
+    if (G_LIKELY (m_update_id == 0))
+        return;
+
+    g_source_remove (m_update_id);
+    m_update_id = 0;
+
+    updatePinyin ();
+}
+
+void
+PhoneticEditor::flushUpdate (void)
+{
+    waitGuess ();
+
+    if (G_UNLIKELY (m_update_id != 0))
+        update ();
+}
+
+gboolean
+PhoneticEditor::updateCallback (gpointer data)
+{
+    PhoneticEditor *self = static_cast<PhoneticEditor *> (data);
+
+    self->m_update_id = 0;
+    self->updatePinyin ();
+    self->update ();
+
+    return FALSE;
+}
+
+void
+PhoneticEditor::submitGuess (void)
+{
+    if (NULL == m_guess_worker.get ()) {
+        m_guess_worker.reset (new GuessWorker (
+            [this] (pinyin_instance_t *instance, const String & text) {
+                return parsePinyin (instance, text);
+            },
+            [this] (GuessWorker::Job & job) {
+                guessFinished (job);
+            }));
+    }
+
+    /* the newer input is submitted when the running job finished. */
+    if (m_guess_worker->busy ())
+        return;
+
+    GuessWorker::Job job;
+    job.instance = m_instance;
+    job.revision = m_revision;
+    job.text = m_text;
+    job.cursor = m_cursor;
+    job.pinyin_end = getPinyinEnd ();
+    job.sort_option = m_config.sortOption ();
+    m_guess_worker->submit (job);
+}
+
+void
+PhoneticEditor::waitGuess (void)
+{
+    if (G_LIKELY (NULL == m_guess_worker.get ()))
+        return;
+
+    GuessWorker::Job job;
+    while (m_guess_worker->wait (job))
+        guessFinished (job);
+}
+
+void
+PhoneticEditor::cancelGuess (void)
+{
+    if (G_LIKELY (NULL == m_guess_worker.get ()))
+        return;
+
+    /* drop the result, m_instance is reset or freed next. */
+    GuessWorker::Job job;
+    m_guess_worker->wait (job);
+}
+
+void
+PhoneticEditor::guessFinished (GuessWorker::Job & job)
+{
+    /* outdated by a newer key, guess again for the current input. */
+    if (job.revision != m_revision) {
+        submitGuess ();
+        return;
+    }
+
+    m_pinyin_len = job.pinyin_len;
+    m_pinyin_cursor.set (m_revision, m_cursor, job.pinyin_cursor);
+    m_lookup_cursor.set (m_revision, m_cursor, job.lookup_cursor);
+    m_guessed_candidates.set (m_revision, job.lookup_cursor, job.sort_option);
+
+    updateLookupTable ();
+    updatePreeditText ();
+    updateAuxiliaryText ();
+}
+
+void
+PhoneticEditor::updateCursor (void)
+{
+    guint lookup_cursor = getLookupCursor ();
+
+    /* the candidates stay the same when only the cursor moved
+       inside the same pinyin. */
+    if (m_guessed_candidates.valid (m_revision, lookup_cursor) &&
+        m_guessed_candidates.get () == m_config.sortOption ()) {
+        updatePreeditText ();
+        updateAuxiliaryText ();
+        return;
+    }
+
+    update ();
+}
+
 guint
 PhoneticEditor::getPinyinCursor ()
 {
+    if (m_pinyin_cursor.valid (m_revision, m_cursor))
+        return m_pinyin_cursor.get ();
+
     /* Translate cursor position to pinyin position. */
     size_t pinyin_cursor = 0;
-    pinyin_get_pinyin_offset (m_instance, m_cursor, &pinyin_cursor);
+    {
+        LibPinyinBackEnd::Locker locker;
+        pinyin_get_pinyin_offset (m_instance, m_cursor, &pinyin_cursor);
+    }
 
+    m_pinyin_cursor.set (m_revision, m_cursor, (guint) pinyin_cursor);
     return pinyin_cursor;
 }
 
 guint
 PhoneticEditor::getLookupCursor (void)
 {
+    if (m_lookup_cursor.valid (m_revision, m_cursor))
+        return m_lookup_cursor.get ();
+
     guint lookup_cursor = getPinyinCursor ();
 
     /* show candidates when pinyin cursor is at end. */
-    if (lookup_cursor == m_text.length ())
+    if (lookup_cursor == getPinyinEnd ())
         lookup_cursor = 0;
+
+    m_lookup_cursor.set (m_revision, m_cursor, lookup_cursor);
     return lookup_cursor;
 }
 
+const String &
+PhoneticEditor::getSentence (void)
+{
+    if (m_sentence.valid (m_revision, 0))
+        return m_sentence.get ();
+
+    gchar * sentence = NULL;
+    {
+        LibPinyinBackEnd::Locker locker;
+        pinyin_get_sentence (m_instance, 0, &sentence);
+    }
+    m_sentence.set (m_revision, 0, sentence ? sentence : "");
+    g_free (sentence);
+
+    return m_sentence.get ();
+}
+
 int
 PhoneticEditor::selectCandidateInternal (EnhancedCandidate & candidate)
 {
@@ -432,6 +699,7 @@ PhoneticEditor::selectCandidate (guint i)
     if (NBEST_MATCH_CANDIDATE == type) {
         /* as nbest match candidate starts from the beginning of user input. */
         pinyin_choose_candidate (m_instance, 0, candidate);
+        bumpRevision ();
         guint8 index = 0;
         pinyin_get_candidate_nbest_index(m_instance, candidate, &index);
         commit (index);
@@ -442,6 +710,7 @@ PhoneticEditor::selectCandidate (guint i)
         (m_instance, lookup_cursor, candidate);
 
     pinyin_guess_sentence (m_instance);
+    bumpRevision ();
 
     if (lookup_cursor == m_text.length ()) {
         commit ();
@@ -466,11 +735,13 @@ PhoneticEditor::selectCandidate (guint index)
     if (G_UNLIKELY (index >= m_candidates.size ()))
         return FALSE;
 
+    m_pipeline.extend (m_candidates, index + 1);
+
     EnhancedCandidate & candidate = m_candidates[index];
     int action = selectCandidateInternal (candidate);
 
     if (action & SELECT_CANDIDATE_COMMIT)
-        commit (candidate.m_display_string.c_str ());
+        commit (candidate.m_display_string);
 
     if (action & SELECT_CANDIDATE_UPDATE)
         update ();
@@ -500,8 +771,7 @@ PhoneticEditor::removeCharBefore (void)
     m_cursor --;
     m_text.erase (m_cursor, 1);
 
-    updatePinyin ();
-    update ();
+    scheduleUpdate ();
 
     return TRUE;
 }
@@ -527,7 +797,7 @@ PhoneticEditor::moveCursorLeft (void)
         return FALSE;
 
     m_cursor --;
-    update ();
+    updateCursor ();
     return TRUE;
 }
 
@@ -538,7 +808,7 @@ PhoneticEditor::moveCursorRight (void)
         return FALSE;
 
     m_cursor ++;
-    update ();
+    updateCursor ();
     return TRUE;
 }
 
@@ -549,7 +819,7 @@ PhoneticEditor::moveCursorToBegin (void)
         return FALSE;
 
     m_cursor = 0;
-    update ();
+    updateCursor ();
     return TRUE;
 }
 
@@ -560,7 +830,7 @@ PhoneticEditor::moveCursorToEnd (void)
         return FALSE;
 
     m_cursor = m_text.length ();
-    update ();
+    updateCursor ();
     return TRUE;
 }
 
@@ -570,6 +840,7 @@ PhoneticEditor::moveCursorToEnd (void)
 guint
 PhoneticEditor::getCursorLeftByWord (void)
 {
+    LibPinyinBackEnd::Locker locker;
     size_t offset = 0;
 
     pinyin_get_pinyin_offset (m_instance, m_cursor, &offset);
@@ -584,6 +855,7 @@ PhoneticEditor::getCursorLeftByWord (void)
 guint
 PhoneticEditor::getCursorRightByWord (void)
 {
+    LibPinyinBackEnd::Locker locker;
     size_t offset = 0;
 
     pinyin_get_pinyin_offset (m_instance, m_cursor, &offset);
@@ -631,7 +903,7 @@ PhoneticEditor::moveCursorLeftByWord (void)
     guint cursor = getCursorLeftByWord ();
 
     m_cursor = cursor;
-    update ();
+    updateCursor ();
     return TRUE;
 }
 
@@ -644,6 +916,6 @@ PhoneticEditor::moveCursorRightByWord (void)
     guint cursor = getCursorRightByWord ();
 
     m_cursor = cursor;
-    update ();
+    updateCursor ();
     return TRUE;
 }
@@ -24,11 +24,13 @@
 #include "lua-plugin.h"
 #endif
 
+#include <memory>
 #include <vector>
 #include <pinyin.h>
 #include "PYLookupTable.h"
 #include "PYEditor.h"
 #include "PYPEnhancedCandidates.h"
+#include "PYPCandidatePipeline.h"
 #include "PYPLibPinyinCandidates.h"
 #include "PYPTradCandidates.h"
 
@@ -38,9 +40,38 @@
 #endif
 
 #include "PYPEmojiCandidates.h"
+#include "PYPGuessWorker.h"
 
 namespace PY {
 
+/* a value derived from the editor state,
+   tagged with the revision and the cursor it was computed for. */
+template <typename T>
+class DerivedValue {
+public:
+    DerivedValue () : m_revision (0), m_cursor (0) { }
+
+    gboolean valid (guint revision, guint cursor) const
+    {
+        return m_revision == revision && m_cursor == cursor;
+    }
+
+    template <typename V>
+    void set (guint revision, guint cursor, const V & value)
+    {
+        m_revision = revision;
+        m_cursor = cursor;
+        m_value = value;
+    }
+
+    const T & get (void) const { return m_value; }
+
+private:
+    guint m_revision;
+    guint m_cursor;
+    T m_value;
+};
+
 class PhoneticEditor : public Editor {
     friend class LibPinyinCandidates;
 
@@ -78,8 +109,37 @@ protected:
 
     void commit () { selectCandidate (0); }
 
+    /* parse m_text and update, coalesced into one idle update
+       when the coalesce-keys option is set. */
+    void scheduleUpdate (void);
+    /* apply the pending update before any other key is handled. */
+    void flushUpdate (void);
+    /* parse the pending keys without updating. */
+    void flushPinyin (void);
+    static gboolean updateCallback (gpointer data);
+
+    /* guess the candidates on the worker thread,
+       when the async-candidates option is set. */
+    void submitGuess (void);
+    void waitGuess (void);
+    void cancelGuess (void);
+    void guessFinished (GuessWorker::Job & job);
+
+    /* update after a cursor move, re-guesses candidates only
+       when the lookup cursor changed. */
+    void updateCursor (void);
+
+    /* derived state, computed at most once per revision and cursor. */
     guint getPinyinCursor (void);
     guint getLookupCursor (void);
+    const String & getSentence (void);
+
+    /* call after every change of m_text or m_instance. */
+    void bumpRevision (void) { m_revision ++; }
+
+    /* the pinyin cursor at which the candidates for
+       the whole input are shown. */
+    virtual guint getPinyinEnd (void) { return m_text.length (); }
 
     /* inline functions */
 
@@ -97,7 +157,9 @@ protected:
     virtual gboolean moveCursorToEnd (void);
     virtual void updateAuxiliaryText (void) = 0;
     virtual void updatePreeditText (void) = 0;
-    virtual void updatePinyin (void) = 0;
+    virtual void updatePinyin (void);
+    virtual guint parsePinyin (pinyin_instance_t *instance,
+                               const String & text) = 0;
 
     guint getCursorLeftByWord (void);
     guint getCursorRightByWord (void);
@@ -111,6 +173,21 @@ protected:
     /* use LibPinyinBackEnd here. */
     pinyin_instance_t           *m_instance;
 
+    /* derived state of m_text, m_cursor and m_instance. */
+    guint                       m_revision;
+    DerivedValue<guint>         m_pinyin_cursor;
+    DerivedValue<guint>         m_lookup_cursor;
+    DerivedValue<String>        m_sentence;
+    DerivedValue<String>        m_auxiliary_text;
+    /* the key of the last pinyin_guess_candidates call. */
+    DerivedValue<sort_option_t> m_guessed_candidates;
+
+    /* pending coalesced update. */
+    guint                       m_update_id;
+
+    /* m_instance is lent to the worker while it is busy. */
+    std::unique_ptr<GuessWorker> m_guess_worker;
+
     /* use EnhancedCandidates here. */
     std::vector<EnhancedCandidate> m_candidates;
 
@@ -125,6 +202,9 @@ protected:
     EmojiCandidates m_emoji_candidates;
 
     TraditionalCandidates m_traditional_candidates;
+
+    /* runs the providers above, registered in the constructor. */
+    CandidatePipeline m_pipeline;
 };
 
 };
@@ -178,6 +178,12 @@ PinyinEditor::processKeyEvent (guint keyval, guint keycode,
                   IBUS_META_MASK |
                   IBUS_LOCK_MASK);
 
+    /* only letters and backspace are coalesced,
+       the other keys need the parsed input. */
+    if (!(keyval >= IBUS_a && keyval <= IBUS_z) &&
+        !(keyval == IBUS_BackSpace && cmshm_filter (modifiers) == 0))
+        flushUpdate ();
+
     switch (keyval) {
     /* letters */
     case IBUS_a ... IBUS_z:
@@ -230,6 +236,7 @@ PinyinEditor::updatePreeditText ()
     if (DISPLAY_STYLE_COMPACT == m_config.displayStyle ())
         return;
 
+    LibPinyinBackEnd::Locker locker;
     guint num = 0;
     pinyin_get_n_candidate (m_instance, &num);
 
@@ -247,9 +254,9 @@ PinyinEditor::updatePreeditText ()
     pinyin_get_candidate (m_instance, 0, &candidate);
     pinyin_get_candidate_type (m_instance, candidate, &type);
 
-    gchar * sentence = NULL;
+    const gchar * sentence = NULL;
     if (NBEST_MATCH_CANDIDATE == type) {
-        pinyin_get_sentence (m_instance, 0, &sentence);
+        sentence = getSentence ().c_str ();
         m_buffer<<m_candidates[0].m_display_string;
     }
 
@@ -265,8 +272,6 @@ PinyinEditor::updatePreeditText ()
     guint cursor = getPinyinCursor ();
     pinyin_get_character_offset(m_instance, sentence, cursor, &offset);
     Editor::updatePreeditText (preedit_text, offset, TRUE);
-
-    g_free (sentence);
 }
 
 #if 0
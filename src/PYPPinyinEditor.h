@@ -45,7 +45,6 @@ protected:
 
     virtual gboolean processKeyEvent (guint keyval, guint keycode, guint modifiers);
 
-    virtual void updatePinyin (void) = 0;
     virtual void commit (const gchar *str);
     using PhoneticEditor::commit;
 
@@ -128,6 +128,8 @@ gboolean
 PinyinEngine::initLuaPlugin (void)
 {
     m_lua_plugin = ibus_engine_plugin_new ();
+    ibus_engine_plugin_set_call_budget
+        (m_lua_plugin, PinyinConfig::instance ().luaCallBudget ());
 
     loadLuaScript ( ".." G_DIR_SEPARATOR_S "lua" G_DIR_SEPARATOR_S "base.lua")||
         loadLuaScript (PKGDATADIR G_DIR_SEPARATOR_S "base.lua");
@@ -248,6 +250,8 @@ PinyinEngine::processKeyEvent (guint keyval, guint keycode, guint modifiers)
     if (modifiers & IBUS_RELEASE_MASK)
         return FALSE;
 
+    TraceScope scope (TRACE_STAGE_PROCESS_KEY);
+
     if (m_props.modeChinese ()) {
         /* return from MODE_SUGGESTION to normal input. */
         if (m_input_mode == MODE_SUGGESTION) {
@@ -260,6 +264,7 @@ PinyinEngine::processKeyEvent (guint keyval, guint keycode, guint modifiers)
                 return TRUE;
             }
 
+            KeyTrace::instance ().setMode (traceMode ());
             retval = m_editors[m_input_mode]->processKeyEvent (keyval, keycode, modifiers);
 
             if (retval) {
@@ -327,6 +332,7 @@ PinyinEngine::processKeyEvent (guint keyval, guint keycode, guint modifiers)
                 /* TODO: Unknown */
             }
         }
+        KeyTrace::instance ().setMode (traceMode ());
         retval = m_editors[m_input_mode]->processKeyEvent (keyval, keycode, modifiers);
         if (G_UNLIKELY (retval &&
                         m_input_mode != MODE_INIT &&
@@ -379,6 +385,11 @@ PinyinEngine::focusIn (void)
         m_double_pinyin = FALSE;
     }
 
+#ifdef IBUS_BUILD_LUA_EXTENSION
+    ibus_engine_plugin_set_call_budget
+        (m_lua_plugin, PinyinConfig::instance ().luaCallBudget ());
+#endif
+
     registerProperties (m_props.properties ());
 }
 
@@ -487,6 +498,28 @@ PinyinEngine::commitText (Text & text)
 #endif
 }
 
+TraceMode
+PinyinEngine::traceMode (void) const
+{
+    switch (m_input_mode) {
+    case MODE_PUNCT:
+        return TRACE_MODE_PUNCT;
+    case MODE_RAW:
+        return TRACE_MODE_RAW;
+    case MODE_ENGLISH:
+        return TRACE_MODE_ENGLISH;
+    case MODE_STROKE:
+        return TRACE_MODE_STROKE;
+    case MODE_EXTENSION:
+        return TRACE_MODE_EXTENSION;
+    case MODE_SUGGESTION:
+        return TRACE_MODE_SUGGESTION;
+    default:
+        return m_double_pinyin ?
+            TRACE_MODE_DOUBLE_PINYIN : TRACE_MODE_FULL_PINYIN;
+    }
+}
+
 void
 PinyinEngine::connectEditorSignals (EditorPtr editor)
 {
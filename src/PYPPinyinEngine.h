@@ -27,6 +27,7 @@
 
 #include "PYEngine.h"
 #include "PYPinyinProperties.h"
+#include "PYPTrace.h"
 
 namespace PY {
 class PinyinEngine : public Engine {
@@ -60,6 +61,7 @@ private:
 
     void showSetupDialog (void);
     void connectEditorSignals (EditorPtr editor);
+    TraceMode traceMode (void) const;
 
     void commitText (Text & text);
 
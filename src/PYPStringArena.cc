@@ -0,0 +1,56 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PYPStringArena.h"
+#include <string.h>
+
+using namespace PY;
+
+StringArena::~StringArena ()
+{
+    for (guint i = 0; i < m_chunks.size (); i++)
+        g_free (m_chunks[i].data);
+}
+
+const gchar *
+StringArena::dup (const gchar *str, gsize len)
+{
+    gsize size = len + 1;
+
+    /* skip the chunks which are too small. */
+    while (m_chunk < m_chunks.size () &&
+           m_used + size > m_chunks[m_chunk].size) {
+        m_chunk++;
+        m_used = 0;
+    }
+
+    if (m_chunk == m_chunks.size ()) {
+        Chunk chunk;
+        chunk.size = MAX (CHUNK_SIZE, size);
+        chunk.data = (gchar *) g_malloc (chunk.size);
+        m_chunks.push_back (chunk);
+    }
+
+    gchar *dest = m_chunks[m_chunk].data + m_used;
+    memcpy (dest, str, len);
+    dest[len] = '\0';
+    m_used += size;
+    return dest;
+}
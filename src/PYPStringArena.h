@@ -0,0 +1,69 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PY_LIB_PINYIN_STRING_ARENA_H_
+#define __PY_LIB_PINYIN_STRING_ARENA_H_
+
+#include <string.h>
+#include <vector>
+#include <glib.h>
+
+namespace PY {
+
+/* bump allocator for the candidate strings of one update,
+   the strings stay valid until reset (), which keeps the chunks
+   for the next update. */
+class StringArena {
+public:
+    StringArena () : m_chunk (0), m_used (0) { }
+    ~StringArena ();
+
+    const gchar * dup (const gchar *str, gsize len);
+    const gchar * dup (const gchar *str)
+    {
+        return dup (str, strlen (str));
+    }
+
+    void reset (void)
+    {
+        m_chunk = 0;
+        m_used = 0;
+    }
+
+private:
+    StringArena (const StringArena &);
+    StringArena & operator= (const StringArena &);
+
+    static const gsize CHUNK_SIZE = 4096;
+
+    struct Chunk {
+        gchar *data;
+        gsize size;
+    };
+
+    std::vector<Chunk> m_chunks;
+    /* the chunk in use and its used bytes. */
+    guint m_chunk;
+    gsize m_used;
+};
+
+};
+
+#endif
@@ -21,6 +21,7 @@
 #include "PYPSuggestionCandidates.h"
 #include <assert.h>
 #include <pinyin.h>
+#include "PYLibPinyin.h"
 #include "PYPSuggestionEditor.h"
 
 using namespace PY;
@@ -29,6 +30,9 @@ gboolean
 SuggestionCandidates::processCandidates (std::vector<EnhancedCandidate> & candidates)
 {
     pinyin_instance_t *instance = m_editor->m_instance;
+    LibPinyinBackEnd::Locker locker;
+
+    m_strings.reset ();
 
     guint len = 0;
     pinyin_get_n_candidate (instance, &len);
@@ -47,7 +51,7 @@ SuggestionCandidates::processCandidates (std::vector<EnhancedCandidate> & candid
         EnhancedCandidate enhanced;
         enhanced.m_candidate_type = CANDIDATE_SUGGESTION;
         enhanced.m_candidate_id = i;
-        enhanced.m_display_string = phrase_string;
+        enhanced.m_display_string = m_strings.dup (phrase_string);
 
         candidates.push_back (enhanced);
     }
@@ -60,6 +64,7 @@ SuggestionCandidates::selectCandidate (EnhancedCandidate & enhanced)
 {
     pinyin_instance_t * instance = m_editor->m_instance;
     assert (CANDIDATE_SUGGESTION == enhanced.m_candidate_type);
+    LibPinyinBackEnd::Locker locker;
 
     guint len = 0;
     pinyin_get_n_candidate (instance, &len);
@@ -22,6 +22,7 @@
 #define __PY_LIB_PINYIN_SUGGESTION_CANDIDATES_H_
 
 #include "PYPEnhancedCandidates.h"
+#include "PYPStringArena.h"
 
 namespace PY {
 
@@ -37,6 +38,9 @@ public:
     gboolean processCandidates (std::vector<EnhancedCandidate> & candidates);
 
     int selectCandidate (EnhancedCandidate & enhanced);
+
+protected:
+    StringArena m_strings;
 };
 
 };
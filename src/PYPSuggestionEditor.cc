@@ -21,6 +21,7 @@
 #include "PYPSuggestionEditor.h"
 #include <assert.h>
 #include "PYConfig.h"
+#include "PYPConfig.h"
 #include "PYLibPinyin.h"
 #include "PYPinyinProperties.h"
 
@@ -40,7 +41,50 @@ SuggestionEditor::SuggestionEditor (PinyinProperties &props,
     m_text = "";
     m_cursor = 0;
 
-    m_instance = LibPinyinBackEnd::instance ().allocPinyinInstance ();
+    /* the suggestion editor always uses the pinyin context. */
+    m_instance = LibPinyinBackEnd::instance ().allocPinyinInstance
+        (&PinyinConfig::instance ());
+
+    m_pipeline.addStage
+        (TRACE_STAGE_SUGGESTION_CANDIDATES, CANDIDATE_WINDOW_ALL, nullptr,
+         [this] (std::vector<EnhancedCandidate> & candidates,
+                 guint begin, guint end) {
+            return m_suggestion_candidates.processCandidates (candidates);
+        });
+
+    m_pipeline.addStage
+        (TRACE_STAGE_TRADITIONAL_CANDIDATES, CANDIDATE_WINDOW_VISIBLE,
+         [this] () { return !m_props.modeSimp (); },
+         [this] (std::vector<EnhancedCandidate> & candidates,
+                 guint begin, guint end) {
+            return m_traditional_candidates.processCandidates
+                (candidates, begin, end);
+        });
+
+#ifdef IBUS_BUILD_LUA_EXTENSION
+    m_pipeline.addStage
+        (TRACE_STAGE_LUA_TRIGGER_CANDIDATES, CANDIDATE_WINDOW_FIRST_PAGE,
+         nullptr,
+         [this] (std::vector<EnhancedCandidate> & candidates,
+                 guint begin, guint end) {
+            return m_lua_trigger_candidates.processCandidates (candidates);
+        });
+
+    m_pipeline.addStage
+        (TRACE_STAGE_LUA_CONVERTER_CANDIDATES, CANDIDATE_WINDOW_VISIBLE,
+         [this] () {
+            std::string converter = m_config.luaConverter ();
+            if (converter.empty ())
+                return FALSE;
+            m_lua_converter_candidates.setConverter (converter.c_str ());
+            return TRUE;
+        },
+         [this] (std::vector<EnhancedCandidate> & candidates,
+                 guint begin, guint end) {
+            return m_lua_converter_candidates.processCandidates
+                (candidates, begin, end);
+        });
+#endif
 }
 
 SuggestionEditor::~SuggestionEditor (void)
@@ -199,6 +243,8 @@ SuggestionEditor::selectCandidate (guint index)
     if (G_UNLIKELY (index >= m_candidates.size ()))
         return FALSE;
 
+    m_pipeline.extend (m_candidates, index + 1);
+
     EnhancedCandidate & candidate = m_candidates[index];
     int action = selectCandidateInternal (candidate);
 
@@ -229,6 +275,7 @@ void
 SuggestionEditor::pageDown (void)
 {
     if (G_LIKELY (m_lookup_table.pageDown ())) {
+        fillLookupTable ();
         updateLookupTableFast ();
         updatePreeditText ();
         updateAuxiliaryText ();
@@ -249,6 +296,7 @@ void
 SuggestionEditor::cursorDown (void)
 {
     if (G_LIKELY (m_lookup_table.cursorDown ())) {
+        fillLookupTable ();
         updateLookupTableFast ();
         updatePreeditText ();
         updateAuxiliaryText ();
@@ -258,7 +306,11 @@ SuggestionEditor::cursorDown (void)
 void
 SuggestionEditor::update (void)
 {
-    pinyin_guess_predicted_candidates (m_instance, m_text);
+    {
+        TraceScope scope (TRACE_STAGE_GUESS_CANDIDATES);
+        LibPinyinBackEnd::Locker locker;
+        pinyin_guess_predicted_candidates (m_instance, m_text);
+    }
 
     updateLookupTable ();
     updatePreeditText ();
@@ -299,23 +351,14 @@ SuggestionEditor::updateLookupTable (void)
 gboolean
 SuggestionEditor::updateCandidates (void)
 {
-    m_candidates.clear ();
-
-    m_suggestion_candidates.processCandidates (m_candidates);
+    TraceScope scope (TRACE_STAGE_UPDATE_CANDIDATES);
 
-    if (!m_props.modeSimp ())
-        m_traditional_candidates.processCandidates (m_candidates);
-
-#ifdef IBUS_BUILD_LUA_EXTENSION
-    m_lua_trigger_candidates.processCandidates (m_candidates);
-
-    std::string converter = m_config.luaConverter ();
+    m_candidates.clear ();
 
-    if (!converter.empty ()) {
-        m_lua_converter_candidates.setConverter (converter.c_str ());
-        m_lua_converter_candidates.processCandidates (m_candidates);
-    }
-#endif
+    /* the converting stages only run on the first two pages here,
+       fillLookupTable () extends them as the user pages. */
+    guint page_size = m_lookup_table.pageSize ();
+    m_pipeline.run (m_candidates, page_size, 2 * page_size);
 
     return TRUE;
 }
@@ -323,7 +366,17 @@ SuggestionEditor::updateCandidates (void)
 gboolean
 SuggestionEditor::fillLookupTable ()
 {
-    for (guint i = 0; i < m_candidates.size (); i++) {
+    TraceScope scope (TRACE_STAGE_FILL_LOOKUP_TABLE);
+
+    /* only the page of the cursor and the next page are filled,
+       the rest is appended when the cursor moves down. */
+    guint page_size = m_lookup_table.pageSize ();
+    guint page = m_lookup_table.cursorPos () / page_size;
+    guint end = MIN ((page + 2) * page_size, m_candidates.size ());
+
+    m_pipeline.extend (m_candidates, end);
+
+    for (guint i = m_lookup_table.size (); i < end; i++) {
         EnhancedCandidate & candidate = m_candidates[i];
 
         Text text (candidate.m_display_string);
@@ -25,6 +25,7 @@
 #include <pinyin.h>
 #include "PYEditor.h"
 #include "PYLookupTable.h"
+#include "PYPCandidatePipeline.h"
 #include "PYPSuggestionCandidates.h"
 #include "PYPTradCandidates.h"
 
@@ -95,6 +96,9 @@ private:
 #endif
 
     TraditionalCandidates m_traditional_candidates;
+
+    /* runs the providers above, registered in the constructor. */
+    CandidatePipeline m_pipeline;
 };
 
 };
@@ -0,0 +1,223 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PYPTrace.h"
+#include <string.h>
+
+using namespace PY;
+
+std::unique_ptr<KeyTrace> KeyTrace::m_instance;
+
+static const gchar * const trace_stage_names[] = {
+    "process-key",
+    "update-pinyin",
+    "guess-candidates",
+    "update-candidates",
+    "  libpinyin",
+    "  emoji",
+    "  lua-trigger",
+    "  lua-converter",
+    "  traditional",
+    "  suggestion",
+    "fill-lookup-table",
+    "emit-preedit",
+    "emit-auxiliary",
+    "emit-lookup-table",
+};
+
+static const gchar * const trace_mode_names[] = {
+    "full-pinyin",
+    "double-pinyin",
+    "bopomofo",
+    "punct",
+    "raw",
+    "english",
+    "stroke",
+    "extension",
+    "suggestion",
+};
+
+static const gchar * const trace_channel_names[] = {
+    "preedit",
+    "auxiliary",
+    "lookup-table",
+};
+
+G_STATIC_ASSERT (G_N_ELEMENTS (trace_stage_names) == TRACE_STAGE_LAST);
+G_STATIC_ASSERT (G_N_ELEMENTS (trace_mode_names) == TRACE_MODE_LAST);
+G_STATIC_ASSERT (G_N_ELEMENTS (trace_channel_names) == TRACE_CHANNEL_LAST);
+
+guint
+LatencyHistogram::bucketIndex (guint64 nsec)
+{
+    if (nsec < (1 << SUB_BUCKET_BITS))
+        return nsec;
+
+    /* position of the most significant bit. */
+    guint msb = 63 - __builtin_clzll (nsec);
+    guint sub = (nsec >> (msb - SUB_BUCKET_BITS)) &
+        ((1 << SUB_BUCKET_BITS) - 1);
+    guint index = ((msb - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS) + sub;
+    return MIN (index, BUCKET_NUM - 1);
+}
+
+guint64
+LatencyHistogram::bucketUpperBound (guint index)
+{
+    if (index < (1 << SUB_BUCKET_BITS))
+        return index;
+
+    guint msb = (index >> SUB_BUCKET_BITS) + SUB_BUCKET_BITS - 1;
+    guint sub = index & ((1 << SUB_BUCKET_BITS) - 1);
+    guint shift = msb - SUB_BUCKET_BITS;
+    guint64 lower = ((guint64) ((1 << SUB_BUCKET_BITS) + sub)) << shift;
+    return lower + (G_GUINT64_CONSTANT (1) << shift) - 1;
+}
+
+void
+LatencyHistogram::record (guint64 nsec)
+{
+    m_buckets[bucketIndex (nsec)] ++;
+    m_count ++;
+    m_total += nsec;
+    if (nsec > m_max)
+        m_max = nsec;
+}
+
+void
+LatencyHistogram::reset (void)
+{
+    memset (m_buckets, 0, sizeof (m_buckets));
+    m_count = 0;
+    m_total = 0;
+    m_max = 0;
+}
+
+guint64
+LatencyHistogram::percentile (gdouble percent) const
+{
+    if (0 == m_count)
+        return 0;
+
+    guint64 rank = (guint64) (m_count * percent / 100.0 + 0.5);
+    if (rank < 1)
+        rank = 1;
+
+    guint64 seen = 0;
+    for (guint i = 0; i < BUCKET_NUM; ++i) {
+        seen += m_buckets[i];
+        if (seen >= rank)
+            return MIN (bucketUpperBound (i), m_max);
+    }
+
+    return m_max;
+}
+
+KeyTrace::KeyTrace ()
+    : m_mode (TRACE_MODE_FULL_PINYIN)
+{
+    reset ();
+}
+
+void
+KeyTrace::init (void)
+{
+    g_assert (NULL == m_instance.get ());
+    m_instance.reset (new KeyTrace);
+}
+
+void
+KeyTrace::finalize (void)
+{
+    m_instance.reset ();
+}
+
+void
+KeyTrace::reset (void)
+{
+    for (guint mode = 0; mode < TRACE_MODE_LAST; ++mode)
+        for (guint stage = 0; stage < TRACE_STAGE_LAST; ++stage)
+            m_histograms[mode][stage].reset ();
+
+    memset (m_sent_updates, 0, sizeof (m_sent_updates));
+    memset (m_suppressed_updates, 0, sizeof (m_suppressed_updates));
+}
+
+const gchar *
+KeyTrace::stageName (TraceStage stage)
+{
+    return trace_stage_names[stage];
+}
+
+const gchar *
+KeyTrace::modeName (TraceMode mode)
+{
+    return trace_mode_names[mode];
+}
+
+const gchar *
+KeyTrace::channelName (TraceChannel channel)
+{
+    return trace_channel_names[channel];
+}
+
+void
+KeyTrace::dump (String & output) const
+{
+    for (guint mode = 0; mode < TRACE_MODE_LAST; ++mode) {
+        const LatencyHistogram & keys =
+            m_histograms[mode][TRACE_STAGE_PROCESS_KEY];
+        if (0 == keys.count ())
+            continue;
+
+        output.appendPrintf ("%s: %" G_GUINT64_FORMAT " keys\n",
+                             modeName ((TraceMode) mode), keys.count ());
+        output.appendPrintf ("  %-20s %8s %10s %10s %10s %10s\n",
+                             "stage (usec)", "count",
+                             "p50", "p95", "p99", "max");
+
+        for (guint stage = 0; stage < TRACE_STAGE_LAST; ++stage) {
+            const LatencyHistogram & histogram = m_histograms[mode][stage];
+            if (0 == histogram.count ())
+                continue;
+
+            output.appendPrintf ("  %-20s %8" G_GUINT64_FORMAT
+                                 " %10.1f %10.1f %10.1f %10.1f\n",
+                                 stageName ((TraceStage) stage),
+                                 histogram.count (),
+                                 histogram.percentile (50) / 1000.0,
+                                 histogram.percentile (95) / 1000.0,
+                                 histogram.percentile (99) / 1000.0,
+                                 histogram.max () / 1000.0);
+        }
+    }
+
+    for (guint channel = 0; channel < TRACE_CHANNEL_LAST; ++channel) {
+        guint64 sent = m_sent_updates[channel];
+        guint64 suppressed = m_suppressed_updates[channel];
+        if (0 == sent + suppressed)
+            continue;
+
+        output.appendPrintf ("%s updates: %" G_GUINT64_FORMAT " sent, %"
+                             G_GUINT64_FORMAT " suppressed\n",
+                             channelName ((TraceChannel) channel),
+                             sent, suppressed);
+    }
+}
@@ -0,0 +1,178 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PY_LIB_PINYIN_TRACE_H_
+#define __PY_LIB_PINYIN_TRACE_H_
+
+#include <memory>
+#include <time.h>
+#include <glib.h>
+#include "PYString.h"
+
+namespace PY {
+
+/* stages of the key path, nested stages are timed inclusively. */
+enum TraceStage {
+    TRACE_STAGE_PROCESS_KEY = 0,
+    TRACE_STAGE_UPDATE_PINYIN,
+    TRACE_STAGE_GUESS_CANDIDATES,
+    TRACE_STAGE_UPDATE_CANDIDATES,
+    TRACE_STAGE_LIBPINYIN_CANDIDATES,
+    TRACE_STAGE_EMOJI_CANDIDATES,
+    TRACE_STAGE_LUA_TRIGGER_CANDIDATES,
+    TRACE_STAGE_LUA_CONVERTER_CANDIDATES,
+    TRACE_STAGE_TRADITIONAL_CANDIDATES,
+    TRACE_STAGE_SUGGESTION_CANDIDATES,
+    TRACE_STAGE_FILL_LOOKUP_TABLE,
+    TRACE_STAGE_EMIT_PREEDIT_TEXT,
+    TRACE_STAGE_EMIT_AUXILIARY_TEXT,
+    TRACE_STAGE_EMIT_LOOKUP_TABLE,
+    TRACE_STAGE_LAST
+};
+
+/* editor modes, the histograms are kept per mode. */
+enum TraceMode {
+    TRACE_MODE_FULL_PINYIN = 0,
+    TRACE_MODE_DOUBLE_PINYIN,
+    TRACE_MODE_BOPOMOFO,
+    TRACE_MODE_PUNCT,
+    TRACE_MODE_RAW,
+    TRACE_MODE_ENGLISH,
+    TRACE_MODE_STROKE,
+    TRACE_MODE_EXTENSION,
+    TRACE_MODE_SUGGESTION,
+    TRACE_MODE_LAST
+};
+
+/* update channels to the ibus client, see Engine. */
+enum TraceChannel {
+    TRACE_CHANNEL_PREEDIT_TEXT = 0,
+    TRACE_CHANNEL_AUXILIARY_TEXT,
+    TRACE_CHANNEL_LOOKUP_TABLE,
+    TRACE_CHANNEL_LAST
+};
+
+/* log-bucketed latency histogram in nanoseconds,
+   each power of two is split into 4 sub-buckets. */
+class LatencyHistogram {
+public:
+    LatencyHistogram () { reset (); }
+
+    void record (guint64 nsec);
+    void reset (void);
+
+    /* returns the upper bound of the bucket holding the percentile. */
+    guint64 percentile (gdouble percent) const;
+
+    guint64 count (void) const { return m_count; }
+    guint64 total (void) const { return m_total; }
+    guint64 max (void) const { return m_max; }
+
+private:
+    static const guint SUB_BUCKET_BITS = 2;
+    /* up to 2^40 nsec, slower samples go into the last bucket. */
+    static const guint BUCKET_NUM = 40 << SUB_BUCKET_BITS;
+
+    static guint bucketIndex (guint64 nsec);
+    static guint64 bucketUpperBound (guint index);
+
+    guint64 m_buckets[BUCKET_NUM];
+    guint64 m_count;
+    guint64 m_total;
+    guint64 m_max;
+};
+
+class KeyTrace {
+public:
+    static KeyTrace & instance (void) { return *m_instance; }
+
+    static void init (void);
+    static void finalize (void);
+
+    static guint64 now (void)
+    {
+        struct timespec ts;
+        clock_gettime (CLOCK_MONOTONIC, &ts);
+        return (guint64) ts.tv_sec * G_GUINT64_CONSTANT (1000000000) +
+            ts.tv_nsec;
+    }
+
+    void setMode (TraceMode mode) { m_mode = mode; }
+    TraceMode mode (void) const { return m_mode; }
+
+    void record (TraceStage stage, guint64 nsec)
+    {
+        m_histograms[m_mode][stage].record (nsec);
+    }
+
+    const LatencyHistogram & histogram (TraceMode mode, TraceStage stage) const
+    {
+        return m_histograms[mode][stage];
+    }
+
+    /* counts the updates sent to and suppressed for the client. */
+    void countUpdate (TraceChannel channel, gboolean suppressed)
+    {
+        if (suppressed)
+            m_suppressed_updates[channel] ++;
+        else
+            m_sent_updates[channel] ++;
+    }
+
+    void reset (void);
+
+    /* p50/p95/p99 per stage for every mode which saw a key,
+       and the sent and suppressed updates per channel. */
+    void dump (String & output) const;
+
+    static const gchar * stageName (TraceStage stage);
+    static const gchar * modeName (TraceMode mode);
+    static const gchar * channelName (TraceChannel channel);
+
+private:
+    KeyTrace ();
+
+    TraceMode m_mode;
+    LatencyHistogram m_histograms[TRACE_MODE_LAST][TRACE_STAGE_LAST];
+    guint64 m_sent_updates[TRACE_CHANNEL_LAST];
+    guint64 m_suppressed_updates[TRACE_CHANNEL_LAST];
+
+    static std::unique_ptr<KeyTrace> m_instance;
+};
+
+/* times the enclosing scope into the current mode. */
+class TraceScope {
+public:
+    TraceScope (TraceStage stage)
+        : m_stage (stage), m_start (KeyTrace::now ()) { }
+
+    ~TraceScope ()
+    {
+        KeyTrace::instance ().record (m_stage, KeyTrace::now () - m_start);
+    }
+
+private:
+    TraceStage m_stage;
+    guint64 m_start;
+};
+
+};
+
+#endif
@@ -26,22 +26,34 @@
 using namespace PY;
 
 gboolean
-TraditionalCandidates::processCandidates (std::vector<EnhancedCandidate> & candidates)
+TraditionalCandidates::processCandidates (std::vector<EnhancedCandidate> & candidates,
+                                          guint begin, guint end)
 {
-    m_candidates.clear ();
+    if (0 == begin) {
+        m_candidates.clear ();
+        m_strings.reset ();
+    }
+
+    end = MIN (end, candidates.size ());
+    if (begin >= end)
+        return TRUE;
+
+    /* convert the window in one batch. */
+    m_simp.clear ();
+    for (guint i = begin; i < end; i++)
+        m_simp.push_back (candidates[i].m_display_string);
+    m_converter.simpToTrad (m_simp, m_trad);
 
-    String trad;
-    for (guint i = 0; i < candidates.size (); i++) {
+    for (guint i = begin; i < end; i++) {
         EnhancedCandidate & enhanced = candidates[i];
 
         m_candidates.push_back (enhanced);
 
         enhanced.m_candidate_type = CANDIDATE_TRADITIONAL_CHINESE;
-        enhanced.m_candidate_id = i;
+        enhanced.m_candidate_id = m_candidates.size () - 1;
 
-        trad.truncate (0);
-        m_converter.simpToTrad (enhanced.m_display_string.c_str (), trad);
-        enhanced.m_display_string = trad;
+        const String & trad = m_trad[i - begin];
+        enhanced.m_display_string = m_strings.dup (trad, trad.length ());
     }
 
     return TRUE;
@@ -61,8 +73,8 @@ TraditionalCandidates::selectCandidate (EnhancedCandidate & enhanced)
     if (action & SELECT_CANDIDATE_MODIFY_IN_PLACE) {
         String trad;
         m_converter.simpToTrad
-            (m_candidates[id].m_display_string.c_str (), trad);
-        enhanced.m_display_string = trad;
+            (m_candidates[id].m_display_string, trad);
+        enhanced.m_display_string = m_strings.dup (trad, trad.length ());
     }
 
     return action;
@@ -23,6 +23,7 @@
 
 #include <vector>
 #include "PYPEnhancedCandidates.h"
+#include "PYPStringArena.h"
 #include "PYConfig.h"
 #include "PYSimpTradConverter.h"
 
@@ -37,7 +38,10 @@ public:
     }
 
 public:
-    gboolean processCandidates (std::vector<EnhancedCandidate> & candidates);
+    /* converts the candidates in [begin, end) in place,
+       a new candidate list starts from zero. */
+    gboolean processCandidates (std::vector<EnhancedCandidate> & candidates,
+                                guint begin, guint end);
 
     int selectCandidate (EnhancedCandidate & enhanced);
     gboolean removeCandidate (EnhancedCandidate & enhanced);
@@ -45,6 +49,13 @@ public:
 protected:
     std::vector<EnhancedCandidate> m_candidates;
     SimpTradConverter m_converter;
+
+    /* the converted strings. */
+    StringArena m_strings;
+
+    /* buffers of the batch conversion. */
+    std::vector<const gchar *> m_simp;
+    std::vector<String> m_trad;
 };
 
 };
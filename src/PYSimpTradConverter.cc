@@ -26,16 +26,93 @@
 
 #ifdef HAVE_OPENCC
 #  include <opencc.h>
-#else
-#  include <cstring>
-#  include <cstdlib>
 #endif
 
+#include <string.h>
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include "PYTypes.h"
 #include "PYString.h"
 
 namespace PY {
 
+/* the lookups of all caches. */
+static guint64 cache_hits = 0;
+static guint64 cache_misses = 0;
+
+/* LRU cache of the converted phrases, the candidates of
+   two successive keys are mostly the same phrases. */
+class SimpTradCache {
+public:
+    const std::string * lookup (const gchar *simp)
+    {
+        m_key = simp;
+        Map::iterator it = m_map.find (m_key);
+        if (it == m_map.end ()) {
+            cache_misses ++;
+            return NULL;
+        }
+
+        cache_hits ++;
+        m_entries.splice (m_entries.begin (), m_entries, it->second);
+        return &it->second->second;
+    }
+
+    void insert (const gchar *simp, const std::string & trad)
+    {
+        /* a string missed twice in one batch. */
+        m_key = simp;
+        Map::iterator it = m_map.find (m_key);
+        if (it != m_map.end ()) {
+            it->second->second = trad;
+            m_entries.splice (m_entries.begin (), m_entries, it->second);
+            return;
+        }
+
+        if (m_entries.size () < CACHE_SIZE) {
+            m_entries.push_front (Entry ());
+        } else {
+            /* reuse the least recently used entry. */
+            m_map.erase (m_entries.back ().first);
+            m_entries.splice (m_entries.begin (), m_entries,
+                              --m_entries.end ());
+        }
+
+        Entry & entry = m_entries.front ();
+        entry.first = simp;
+        entry.second = trad;
+        m_map[entry.first] = m_entries.begin ();
+    }
+
+private:
+    static const guint CACHE_SIZE = 2048;
+
+    typedef std::pair<std::string, std::string> Entry;
+    typedef std::list<Entry> List;
+    typedef std::unordered_map<std::string, List::iterator> Map;
+
+    List m_entries;
+    Map m_map;
+    /* avoids a temporary key for every lookup. */
+    std::string m_key;
+};
+
+/* one cache per backend config, see simp_trad_cache (). */
+typedef std::unordered_map<std::string, SimpTradCache> SimpTradCaches;
+
+static SimpTradCaches &
+simp_trad_caches (void)
+{
+    static SimpTradCaches caches;
+    return caches;
+}
+
+/* joins the strings of a batch conversion, no phrase spans it. */
+static const gchar BATCH_SEPARATOR = '\n';
+
 #ifdef HAVE_OPENCC
 
 class opencc {
@@ -62,100 +139,186 @@ private:
     opencc_t m_cc;
 };
 
+/* one opencc handle per config file, opened on first use. */
+typedef std::unordered_map<std::string, std::unique_ptr<opencc> > OpenCCHandles;
+
+static OpenCCHandles &
+opencc_handles (void)
+{
+    static OpenCCHandles handles;
+    return handles;
+}
+
+static SimpTradCache &
+simp_trad_cache (Config & config)
+{
+    return simp_trad_caches ()[config.openccConfig ()];
+}
+
 void
-SimpTradConverter::simpToTrad (const gchar *in, String &out)
+SimpTradConverter::convert (const gchar *in, String &out)
 {
-    static opencc opencc(m_config.openccConfig().c_str());
-    opencc.convert (in, out);
+    const std::string & name = m_config.openccConfig ();
+    std::unique_ptr<opencc> & handle = opencc_handles ()[name];
+    if (!handle)
+        handle.reset (new opencc (name.c_str ()));
+    handle->convert (in, out);
 }
 
 #else
 
-static gint _xcmp (const gchar *p1, const gchar *p2, const gchar *str)
+static SimpTradCache &
+simp_trad_cache (Config & config)
 {
-    for (;;) {
-        // both reach end
-        if (p1 == p2 && *str == '\0')
-            return 0;
-        // p1 reaches end
-        if (p1 == p2)
-            return -1;
-        // str reaches end
-        if (*str == '\0')
-            return 1;
-
-        if (*p1 < *str)
-            return -1;
-        if (*p1 > *str)
-            return 1;
-
-        p1 ++; str ++;
-    };
+    return simp_trad_caches ()[""];
 }
 
-static gint _cmp (gconstpointer p1, gconstpointer p2)
+#include "PYSimpTradConverterTable.h"
+#include "PYSimpTradConverterTrie.h"
+
+/* returns the row of the longest key at the beginning of in,
+   -1 when no key matches, and the end of the key in end. */
+static gint
+longest_match (const gchar *in, const gchar *&end)
 {
-    const gchar **pp = (const gchar **) p1;
-    const gchar **s2 = (const gchar **) p2;
+    gint state = 0;
+    gint match = -1;
 
-    return _xcmp (pp[0], pp[1], s2[0]);
-}
+    for (const gchar *p = in; *p; p++) {
+        gint next = simp_to_trad_trie[state].base + (guchar) *p;
+        if (next >= (gint) G_N_ELEMENTS (simp_to_trad_trie) ||
+            simp_to_trad_trie[next].check != state)
+            break;
 
-#include "PYSimpTradConverterTable.h"
+        state = next;
+        if (simp_to_trad_trie[state].value >= 0) {
+            match = simp_to_trad_trie[state].value;
+            end = p + 1;
+        }
+    }
+
+    return match;
+}
 
 void
-SimpTradConverter::simpToTrad (const gchar *in, String &out)
+SimpTradConverter::convert (const gchar *in, String &out)
 {
-    const gchar *pend;
-    const gchar *pp[2];
-    glong len;
-    glong begin;
-
     if (!g_utf8_validate (in, -1 , NULL)) {
         g_warning ("\%s\" is not an utf8 string!", in);
         g_assert_not_reached ();
     }
 
-    begin = 0;
-    pend = in + std::strlen (in);
-    len = g_utf8_strlen (in, -1);   // length in charactoers
-    pp[0] = in;
-
-    while (pp[0] != pend) {
-        glong slen  = std::min (len - begin, (glong) SIMP_TO_TRAD_MAX_LEN); // the length of sub string in character
-        pp[1] = g_utf8_offset_to_pointer (pp[0], slen);    // the end of sub string
-
-        for (;;) {
-            const gchar **result;
-            result = (const gchar **) std::bsearch (pp, simp_to_trad,
-                                            G_N_ELEMENTS (simp_to_trad), sizeof (simp_to_trad[0]),
-                                            _cmp);
-
-            if (result != NULL) {
-                // found item in table,
-                // append the trad to out and adjust pointers
-                out << result[1];
-                pp[0] = pp[1];
-                begin += slen;
-                break;
-            }
-
-            if (slen == 1) {
-                // if only one character left,
-                // append origin character to out and adjust pointers
-                out.append (pp[0], pp[1] - pp[0]);
-                pp[0] = pp[1];
-                begin += 1;
-                break;
-            }
-
-            // if more than on characters left,
-            // adjust pp[1] to previous character
-            pp[1] = g_utf8_prev_char (pp[1]);
-            slen--;
+    const gchar *p = in;
+    while (*p) {
+        const gchar *end = NULL;
+        gint row = longest_match (p, end);
+
+        if (row >= 0) {
+            out << simp_to_trad[row][1];
+            p = end;
+        } else {
+            /* no phrase starts here, keep the character. */
+            end = g_utf8_next_char (p);
+            out.append (p, end - p);
+            p = end;
         }
     }
 }
 #endif
 
+void
+SimpTradConverter::simpToTrad (const gchar *in, String &out)
+{
+    SimpTradCache & cache = simp_trad_cache (m_config);
+
+    const std::string *trad = cache.lookup (in);
+    if (trad) {
+        out << *trad;
+        return;
+    }
+
+    String converted;
+    convert (in, converted);
+    cache.insert (in, converted);
+    out << converted;
+}
+
+void
+SimpTradConverter::simpToTrad (const std::vector<const gchar *> & in,
+                               std::vector<String> & out)
+{
+    SimpTradCache & cache = simp_trad_cache (m_config);
+
+    out.resize (in.size ());
+    m_missed.clear ();
+    m_joined.truncate (0);
+
+    for (guint i = 0; i < in.size (); i++) {
+        out[i].truncate (0);
+
+        const std::string *trad = cache.lookup (in[i]);
+        if (trad) {
+            out[i] << *trad;
+        } else if (strchr (in[i], BATCH_SEPARATOR)) {
+            simpToTrad (in[i], out[i]);
+        } else {
+            if (!m_missed.empty ())
+                m_joined << BATCH_SEPARATOR;
+            m_joined << in[i];
+            m_missed.push_back (i);
+        }
+    }
+
+    if (m_missed.empty ())
+        return;
+
+    /* convert the missed strings in one backend call. */
+    m_converted.truncate (0);
+    convert (m_joined, m_converted);
+
+    /* the backend dropped or merged a separator, the pieces
+       can't be matched to the strings. */
+    if (std::count (m_converted.begin (), m_converted.end (),
+                    BATCH_SEPARATOR) + 1 != (gint) m_missed.size ()) {
+        for (guint i = 0; i < m_missed.size (); i++)
+            simpToTrad (in[m_missed[i]], out[m_missed[i]]);
+        return;
+    }
+
+    const gchar *p = m_converted;
+    for (guint i = 0; i < m_missed.size (); i++) {
+        String & trad = out[m_missed[i]];
+
+        const gchar *end = strchr (p, BATCH_SEPARATOR);
+        if (NULL == end)
+            end = p + strlen (p);
+
+        trad.append (p, end - p);
+        cache.insert (in[m_missed[i]], trad);
+
+        p = end + 1;
+    }
+}
+
+void
+SimpTradConverter::reload (void)
+{
+    simp_trad_caches ().clear ();
+#ifdef HAVE_OPENCC
+    opencc_handles ().clear ();
+#endif
+}
+
+guint64
+SimpTradConverter::cacheHits (void)
+{
+    return cache_hits;
+}
+
+guint64
+SimpTradConverter::cacheMisses (void)
+{
+    return cache_misses;
+}
+
 }
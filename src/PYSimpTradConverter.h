@@ -20,19 +20,39 @@
 #ifndef __PY_SIMP_TRAD_CONVERTER_H_
 #define __PY_SIMP_TRAD_CONVERTER_H_
 
+#include <vector>
 #include <glib.h>
 #include "PYConfig.h"
+#include "PYString.h"
 
 namespace PY {
 
-class String;
-
 class SimpTradConverter {
 public:
     SimpTradConverter(Config & config) : m_config(config) {}
     void simpToTrad (const gchar *in, String &out);
+    /* converts the strings of in to out, the strings missing from
+       the cache are converted together in one backend call. */
+    void simpToTrad (const std::vector<const gchar *> & in,
+                     std::vector<String> & out);
+
+    /* drops the cached conversions and the opencc handles,
+       called when the opencc config changes. */
+    static void reload (void);
+
+    /* the phrases found in and missing from the caches, one cache
+       per opencc config is shared by all converters. */
+    static guint64 cacheHits (void);
+    static guint64 cacheMisses (void);
 private:
+    void convert (const gchar *in, String &out);
+
     Config & m_config;
+
+    /* buffers of the batch conversion. */
+    std::vector<guint> m_missed;
+    String m_joined;
+    String m_converted;
 };
 
 };
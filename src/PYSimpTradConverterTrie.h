@@ -0,0 +1,3631 @@
+/* generated by gensimptradtable.py, do not edit. */
+
+/* the double-array trie of the utf-8 bytes of the keys of
+   simp_to_trad, a byte c moves from state s to t = base[s] + c
+   when check[t] == s, value is the row of the key ending at t. */
+static const struct {
+    gint32 base;
+    gint32 check;
+    gint32 value;
+} simp_to_trad_trie[] = {
+    { 1, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 1, 228, -1 }, { 5118, 419, -1 }, { 5395, 464, -1 },
+    { 5402, 466, -1 }, { 10147, 840, -1 }, { 398, 186, -1 }, { 10187, 668, -1 }, { 454, 129, -1 }, { 5590, 496, -1 },
+    { 1446, 246, -1 }, { 0, 186, 263 }, { 421, 186, 264 }, { 5592, 496, -1 }, { 2484, 186, -1 }, { 1308, 186, 271 },
+    { 0, 380, 4351 }, { 929, 238, -1 }, { 1785, 246, 1107 }, { 653, 186, 276 }, { 0, 267, 1813 }, { 949, 239, -1 },
+    { 3041, 289, -1 }, { 422, 186, 279 }, { 0, 267, 1814 }, { 706, 190, -1 }, { 0, 450, 5396 }, { 714, 190, -1 },
+    { 2354, 267, -1 }, { 0, 287, 2267 }, { 0, 287, 2268 }, { 2570, 190, 531 }, { 1891, 186, -1 }, { 2383, 268, -1 },
+    { 5321, 441, -1 }, { 0, 186, 289 }, { 438, 186, 290 }, { 3357, 190, -1 }, { 5322, 441, -1 }, { 715, 190, -1 },
+    { 732, 190, -1 }, { 596, 186, 292 }, { 0, 261, 1668 }, { 1518, 246, -1 }, { 751, 190, -1 }, { 0, 258, 1656 },
+    { 0, 277, 2086 }, { 785, 190, 647 }, { 944, 238, -1 }, { 0, 190, 651 }, { 0, 341, 3771 }, { 699, 186, 295 },
+    { 781, 186, 298 }, { 0, 258, 1657 }, { 773, 191, -1 }, { 947, 238, -1 }, { 0, 375, 4318 }, { 425, 229, -1 },
+    { 3, 229, -1 }, { 454, 229, -1 }, { 508, 229, -1 }, { 549, 229, -1 }, { 12, 229, -1 }, { 41, 229, -1 },
+    { 564, 229, -1 }, { 456, 186, -1 }, { 0, 239, 729 }, { 2135, 261, -1 }, { 0, 336, 3746 }, { 1592, 246, -1 },
+    { 893, 191, -1 }, { 2120, 260, -1 }, { 0, 287, 2269 }, { 0, 191, 656 }, { 2123, 260, 1665 }, { 763, 190, -1 },
+    { 0, 191, 657 }, { 0, 415, 4793 }, { 803, 191, 658 }, { 0, 191, 660 }, { 0, 191, 661 }, { 0, 191, 662 },
+    { 0, 191, 663 }, { 0, 191, 664 }, { 2458, 270, 1824 }, { 0, 191, 665 }, { 2444, 270, 1827 }, { 5393, 463, -1 },
+    { 2128, 260, -1 }, { 2466, 270, 1829 }, { 5408, 470, -1 }, { 0, 288, 2270 }, { 2468, 270, 1831 }, { 0, 338, 3752 },
+    { 817, 191, -1 }, { 2474, 270, -1 }, { 0, 288, 2271 }, { 0, 338, 3753 }, { 0, 338, 3754 }, { 5410, 471, -1 },
+    { 1, 0, -1 }, { 1, 0, -1 }, { 107, 0, -1 }, { 171, 0, -1 }, { 234, 0, -1 }, { 298, 0, -1 },
+    { 362, 0, -1 }, { 520, 230, -1 }, { 387, 230, -1 }, { 498, 230, -1 }, { 2, 230, -1 }, { 3, 230, -1 },
+    { 612, 230, -1 }, { 669, 230, -1 }, { 721, 230, -1 }, { 745, 230, -1 }, { 795, 230, -1 }, { 817, 230, -1 },
+    { 7, 230, -1 }, { 644, 230, -1 }, { 855, 230, -1 }, { 900, 230, -1 }, { 920, 230, -1 }, { 975, 230, -1 },
+    { 803, 230, -1 }, { 1009, 230, -1 }, { 1041, 230, -1 }, { 852, 230, -1 }, { 1032, 230, -1 }, { 1018, 230, -1 },
+    { 2, 230, -1 }, { 482, 230, -1 }, { 46, 230, -1 }, { 7, 230, -1 }, { 1055, 230, -1 }, { 1084, 230, -1 },
+    { 1120, 230, -1 }, { 1116, 230, -1 }, { 684, 230, -1 }, { 3, 230, -1 }, { 3, 230, -1 }, { 486, 230, -1 },
+    { 38, 230, -1 }, { 1158, 230, -1 }, { 1176, 230, -1 }, { 1199, 230, -1 }, { 533, 230, -1 }, { 1218, 230, -1 },
+    { 323, 230, -1 }, { 4, 230, -1 }, { 396, 230, -1 }, { 561, 230, -1 }, { 603, 230, -1 }, { 1248, 230, -1 },
+    { 1289, 230, -1 }, { 1336, 230, -1 }, { 1357, 230, -1 }, { 1376, 230, -1 }, { 599, 230, -1 }, { 27, 230, -1 },
+    { 67, 230, -1 }, { 4, 230, -1 }, { 1206, 230, -1 }, { 1421, 230, -1 }, { 1261, 230, -1 }, { 1459, 230, -1 },
+    { 375, 230, -1 }, { 1414, 230, -1 }, { 1285, 230, -1 }, { 1491, 230, -1 }, { 1498, 230, -1 }, { 1543, 231, -1 },
+    { 1475, 231, -1 }, { 1520, 231, -1 }, { 1549, 231, -1 }, { 440, 231, -1 }, { 480, 231, -1 }, { 5617, 499, 6309 },
+    { 622, 231, -1 }, { 1593, 231, -1 }, { 1611, 231, -1 }, { 1643, 231, -1 }, { 1682, 231, -1 }, { 1722, 231, -1 },
+    { 1754, 231, -1 }, { 1758, 231, -1 }, { 698, 231, -1 }, { 1790, 231, -1 }, { 1767, 231, -1 }, { 1813, 231, -1 },
+    { 969, 231, -1 }, { 954, 231, -1 }, { 1826, 231, -1 }, { 1839, 231, -1 }, { 1862, 231, -1 }, { 1896, 231, -1 },
+    { 1904, 231, -1 }, { 497, 231, -1 }, { 546, 231, -1 }, { 1923, 231, -1 }, { 1971, 231, -1 }, { 2009, 231, -1 },
+    { 1077, 231, -1 }, { 2050, 231, -1 }, { 1988, 231, -1 }, { 1567, 231, -1 }, { 1121, 231, -1 }, { 2068, 231, -1 },
+    { 8, 231, -1 }, { 831, 231, -1 }, { 66, 231, -1 }, { 642, 231, -1 }, { 594, 231, -1 }, { 9, 231, -1 },
+    { 0, 500, 6323 }, { 889, 231, -1 }, { 1351, 231, -1 }, { 2096, 231, -1 }, { 2119, 231, -1 }, { 1928, 231, -1 },
+    { 1795, 231, -1 }, { 2145, 231, -1 }, { 2161, 231, -1 }, { 2108, 231, -1 }, { 2223, 231, -1 }, { 2254, 231, -1 },
+    { 2263, 231, -1 }, { 2303, 231, -1 }, { 1171, 231, -1 }, { 869, 231, -1 }, { 2315, 231, -1 }, { 1007, 231, -1 },
+    { 2078, 231, -1 }, { 596, 231, -1 }, { 440, 231, -1 }, { 1850, 232, -1 }, { 2354, 232, -1 }, { 2363, 232, -1 },
+    { 871, 232, -1 }, { 815, 232, -1 }, { 314, 232, -1 }, { 327, 232, -1 }, { 1127, 232, -1 }, { 2371, 232, -1 },
+    { 690, 232, -1 }, { 2389, 232, -1 }, { 2427, 232, -1 }, { 11, 232, -1 }, { 2434, 232, -1 }, { 1271, 232, -1 },
+    { 1355, 232, -1 }, { 514, 232, -1 }, { 2, 232, -1 }, { 902, 232, -1 }, { 2424, 232, -1 }, { 762, 232, -1 },
+    { 2471, 232, -1 }, { 2490, 232, -1 }, { 1331, 232, -1 }, { 780, 232, -1 }, { 2251, 232, -1 }, { 2520, 232, -1 },
+    { 718, 232, -1 }, { 996, 232, -1 }, { 1234, 232, -1 }, { 2025, 232, -1 }, { 2539, 232, -1 }, { 2468, 232, -1 },
+    { 1891, 232, -1 }, { 484, 232, -1 }, { 588, 232, -1 }, { 2519, 232, -1 }, { 1515, 232, -1 }, { 2577, 232, -1 },
+    { 2200, 232, -1 }, { 1321, 232, -1 }, { 2589, 232, -1 }, { 943, 232, -1 }, { 1678, 232, -1 }, { 2313, 232, -1 },
+    { 2608, 232, -1 }, { 880, 232, -1 }, { 317, 232, -1 }, { 1781, 232, -1 }, { 2630, 232, -1 }, { 1255, 232, -1 },
+    { 1052, 232, -1 }, { 22, 232, -1 }, { 0, 447, 5383 }, { 0, 502, 6324 }, { 0, 447, 5384 }, { 1, 232, -1 },
+    { 2646, 232, -1 }, { 2710, 232, -1 }, { 2774, 232, -1 }, { 2826, 232, -1 }, { 2127, 232, -1 }, { 1230, 232, -1 },
+    { 2829, 233, -1 }, { 2835, 233, -1 }, { 2860, 233, -1 }, { 2897, 233, -1 }, { 2918, 233, -1 }, { 2854, 233, -1 },
+    { 524, 233, -1 }, { 1944, 233, -1 }, { 2947, 233, -1 }, { 1281, 233, -1 }, { 2614, 233, -1 }, { 2986, 233, -1 },
+    { 3006, 233, -1 }, { 3031, 233, -1 }, { 3047, 233, -1 }, { 6, 233, -1 }, { 2978, 233, -1 }, { 461, 233, -1 },
+    { 2083, 233, -1 }, { 3080, 233, -1 }, { 677, 233, -1 }, { 238, 233, -1 }, { 1156, 233, -1 }, { 1193, 233, -1 },
+    { 4, 233, -1 }, { 3099, 233, -1 }, { 2457, 233, -1 }, { 3119, 233, -1 }, { 1598, 233, -1 }, { 2543, 233, -1 },
+    { 5897, 554, -1 }, { 4877, 368, -1 }, { 5942, 572, -1 }, { 3139, 233, -1 }, { 3008, 233, -1 }, { 2949, 233, -1 },
+    { 1079, 233, -1 }, { 24, 233, -1 }, { 2, 233, -1 }, { 3185, 233, -1 }, { 4, 233, -1 }, { 0, 410, 4720 },
+    { 369, 233, -1 }, { 4882, 369, -1 }, { 35, 233, -1 }, { 61, 233, -1 }, { 3200, 233, -1 }, { 3264, 233, -1 },
+    { 3328, 233, -1 }, { 496, 233, -1 }, { 4882, 369, -1 }, { 5986, 575, -1 }, { 3355, 233, -1 }, { 3419, 233, -1 },
+    { 1506, 233, -1 }, { 3433, 233, -1 }, { 1699, 233, -1 }, { 1280, 233, -1 }, { 1097, 233, -1 }, { 2654, 276, -1 },
+    { 4880, 368, -1 }, { 3455, 233, -1 }, { 3518, 233, -1 }, { 3561, 233, -1 }, { 3595, 234, -1 }, { 3112, 234, -1 },
+    { 3615, 234, -1 }, { 3652, 234, -1 }, { 5950, 579, -1 }, { 3665, 234, -1 }, { 2, 234, -1 }, { 1629, 234, -1 },
+    { 5983, 580, -1 }, { 125, 234, -1 }, { 168, 234, -1 }, { 5089, 410, -1 }, { 227, 234, -1 }, { 0, 276, 2083 },
+    { 0, 276, 2084 }, { 0, 276, 2085 }, { 0, 468, 5541 }, { 0, 468, 5542 }, { 3723, 234, -1 }, { 3787, 234, -1 },
+    { 3851, 234, -1 }, { 3914, 234, -1 }, { 5965, 587, -1 }, { 3933, 234, -1 }, { 3996, 234, -1 }, { 4024, 234, -1 },
+    { 1875, 234, -1 }, { 4019, 234, -1 }, { 2148, 234, -1 }, { 2343, 234, -1 }, { 1417, 234, -1 }, { 3175, 234, -1 },
+    { 1720, 236, -1 }, { 4029, 234, -1 }, { 4093, 234, -1 }, { 3618, 234, -1 }, { 414, 234, -1 }, { 4096, 234, -1 },
+    { 4160, 234, -1 }, { 889, 236, -1 }, { 5983, 590, -1 }, { 4142, 234, -1 }, { 4206, 234, -1 }, { 2896, 234, -1 },
+    { 1710, 234, -1 }, { 2504, 234, -1 }, { 2666, 278, -1 }, { 5818, 551, 7277 }, { 0, 551, 7279 }, { 602, 234, -1 },
+    { 4246, 234, -1 }, { 4305, 234, -1 }, { 0, 278, 2089 }, { 901, 236, -1 }, { 0, 278, 2090 }, { 0, 294, 2595 },
+    { 4309, 234, -1 }, { 4372, 234, -1 }, { 1626, 234, -1 }, { 3541, 234, -1 }, { 3666, 234, -1 }, { 393, 234, -1 },
+    { 4421, 234, -1 }, { 2145, 185, -1 }, { 228, 185, -1 }, { 0, 526, 6957 }, { 815, 185, -1 }, { 3349, 294, -1 },
+    { 5754, 526, -1 }, { 0, 236, 710 }, { 1280, 185, 42 }, { 3394, 294, -1 }, { 1340, 185, -1 }, { 1677, 185, -1 },
+    { 1351, 185, -1 }, { 2683, 278, -1 }, { 2171, 185, -1 }, { 0, 185, 116 }, { 4836, 362, -1 }, { 6030, 592, -1 },
+    { 3104, 185, -1 }, { 6028, 605, -1 }, { 226, 185, 168 }, { 0, 278, 2092 }, { 0, 236, 711 }, { 246, 185, -1 },
+    { 3801, 303, -1 }, { 0, 236, 712 }, { 0, 236, 713 }, { 266, 185, 174 }, { 268, 185, 176 }, { 493, 185, 178 },
+    { 610, 185, 183 }, { 3811, 303, -1 }, { 5833, 551, 7280 }, { 0, 362, 4167 }, { 0, 362, 4168 }, { 284, 185, 187 },
+    { 1530, 187, -1 }, { 2321, 185, 189 }, { 302, 185, 200 }, { 1844, 187, 309 }, { 336, 185, 202 }, { 671, 187, -1 },
+    { 2564, 187, -1 }, { 1383, 185, 204 }, { 2734, 187, 328 }, { 0, 187, 397 }, { 1754, 185, -1 }, { 2861, 187, 398 },
+    { 0, 303, 2941 }, { 1940, 185, 240 }, { 2073, 187, -1 }, { 684, 187, -1 }, { 0, 303, 2942 }, { 341, 185, 249 },
+    { 0, 303, 2943 }, { 6055, 610, -1 }, { 0, 187, 421 }, { 6088, 615, -1 }, { 377, 185, -1 }, { 575, 185, 252 },
+    { 1130, 185, -1 }, { 5019, 397, -1 }, { 0, 185, 259 }, { 379, 185, 260 }, { 3817, 304, -1 }, { 2391, 269, -1 },
+    { 849, 187, -1 }, { 2095, 259, -1 }, { 3817, 304, -1 }, { 0, 187, 425 }, { 5327, 443, -1 }, { 0, 187, 426 },
+    { 5330, 443, -1 }, { 0, 304, 2948 }, { 482, 187, -1 }, { 0, 325, 3477 }, { 517, 187, -1 }, { 6047, 134, -1 },
+    { 5466, 475, -1 }, { 3815, 303, 2944 }, { 0, 187, 430 }, { 2415, 269, -1 }, { 0, 259, 1659 }, { 0, 187, 431 },
+    { 484, 188, -1 }, { 503, 188, -1 }, { 5329, 443, 5340 }, { 2422, 269, 1820 }, { 1913, 187, -1 }, { 533, 188, 446 },
+    { 2979, 188, -1 }, { 553, 188, -1 }, { 2425, 269, -1 }, { 967, 187, 438 }, { 0, 259, 1660 }, { 579, 188, -1 },
+    { 4534, 325, -1 }, { 6040, 140, -1 }, { 1405, 188, 468 }, { 6059, 151, -1 }, { 5020, 397, -1 }, { 0, 188, 474 },
+    { 2443, 269, -1 }, { 0, 188, 475 }, { 5017, 397, -1 }, { 5467, 475, -1 }, { 587, 188, -1 }, { 2103, 259, 1661 },
+    { 591, 188, -1 }, { 605, 188, -1 }, { 2104, 259, -1 }, { 0, 237, 714 }, { 0, 325, 3482 }, { 0, 237, 715 },
+    { 0, 237, 716 }, { 0, 237, 717 }, { 3, 164, -1 }, { 0, 432, 5139 }, { 903, 237, -1 }, { 972, 188, -1 },
+    { 4917, 379, -1 }, { 852, 235, -1 }, { 855, 235, -1 }, { 864, 235, -1 }, { 935, 237, -1 }, { 4535, 325, -1 },
+    { 614, 188, 482 }, { 3364, 235, -1 }, { 625, 188, 484 }, { 2630, 274, -1 }, { 5875, 136, -1 }, { 5926, 136, -1 },
+    { 0, 274, 2054 }, { 920, 237, -1 }, { 869, 235, -1 }, { 3036, 189, -1 }, { 6076, 193, -1 }, { 4395, 274, -1 },
+    { 636, 188, -1 }, { 0, 188, 487 }, { 5241, 432, -1 }, { 657, 189, -1 }, { 664, 189, -1 }, { 646, 188, -1 },
+    { 4916, 379, 4348 }, { 0, 379, 4350 }, { 2688, 279, -1 }, { 651, 188, -1 }, { 0, 189, 503 }, { 681, 189, 504 },
+    { 1661, 189, -1 }, { 691, 189, 512 }, { 0, 189, 517 }, { 5240, 432, -1 }, { 883, 235, 699 }, { 0, 189, 518 },
+    { 0, 189, 519 }, { 694, 189, 520 }, { 0, 235, 701 }, { 2703, 279, -1 }, { 6118, 626, -1 }, { 0, 189, 522 },
+    { 0, 189, 523 }, { 0, 189, 524 }, { 0, 189, 525 }, { 6168, 636, -1 }, { 0, 274, 2072 }, { 0, 189, 526 },
+    { 0, 189, 527 }, { 822, 192, -1 }, { 6030, 581, -1 }, { 5958, 581, -1 }, { 4539, 326, -1 }, { 828, 192, -1 },
+    { 4545, 326, -1 }, { 0, 192, 670 }, { 4833, 361, -1 }, { 701, 189, -1 }, { 0, 192, 671 }, { 0, 286, 2261 },
+    { 0, 192, 672 }, { 0, 192, 673 }, { 0, 192, 674 }, { 6139, 637, -1 }, { 4536, 326, -1 }, { 1425, 192, 675 },
+    { 998, 192, -1 }, { 835, 192, -1 }, { 953, 240, -1 }, { 2731, 279, -1 }, { 4832, 361, -1 }, { 962, 240, -1 },
+    { 0, 279, 2096 }, { 6116, 628, -1 }, { 981, 240, -1 }, { 2735, 280, -1 }, { 989, 240, -1 }, { 1006, 240, -1 },
+    { 6160, 628, -1 }, { 1438, 240, -1 }, { 0, 361, 4163 }, { 1010, 240, -1 }, { 2779, 280, -1 }, { 2749, 280, -1 },
+    { 2754, 280, 2103 }, { 0, 240, 743 }, { 3823, 306, -1 }, { 0, 340, 3767 }, { 0, 286, 2262 }, { 6148, 641, -1 },
+    { 0, 240, 744 }, { 0, 286, 2263 }, { 0, 286, 2264 }, { 0, 286, 2265 }, { 1740, 240, 745 }, { 0, 306, 2950 },
+    { 0, 306, 2951 }, { 2816, 280, 2105 }, { 3826, 306, 2952 }, { 0, 340, 3768 }, { 0, 247, 1118 }, { 0, 280, 2108 },
+    { 5020, 398, -1 }, { 3026, 286, -1 }, { 5022, 398, 4575 }, { 1905, 247, -1 }, { 5022, 398, -1 }, { 0, 340, 3769 },
+    { 1028, 240, -1 }, { 4836, 361, -1 }, { 0, 340, 3770 }, { 2152, 240, -1 }, { 1103, 240, -1 }, { 2227, 240, -1 },
+    { 6201, 643, -1 }, { 1450, 247, -1 }, { 1043, 240, 774 }, { 1052, 240, -1 }, { 5800, 539, 7094 }, { 1052, 240, 778 },
+    { 0, 240, 784 }, { 0, 539, 7097 }, { 1063, 240, -1 }, { 1497, 247, -1 }, { 1064, 240, -1 }, { 0, 240, 787 },
+    { 0, 241, 793 }, { 1068, 240, 788 }, { 1073, 240, -1 }, { 1088, 240, 791 }, { 1973, 241, 794 }, { 4660, 339, -1 },
+    { 6085, 611, -1 }, { 0, 241, 801 }, { 1090, 241, -1 }, { 0, 446, 5378 }, { 6084, 611, -1 }, { 0, 241, 803 },
+    { 0, 247, 1129 }, { 6235, 647, -1 }, { 4664, 339, 3759 }, { 3831, 306, -1 }, { 1465, 247, -1 }, { 2430, 266, -1 },
+    { 6185, 658, -1 }, { 0, 339, 3764 }, { 0, 247, 1131 }, { 0, 339, 3765 }, { 1094, 241, -1 }, { 6235, 660, -1 },
+    { 1095, 241, 805 }, { 4658, 339, -1 }, { 0, 241, 807 }, { 1346, 241, 808 }, { 2555, 266, -1 }, { 6073, 169, -1 },
+    { 0, 372, 4287 }, { 6091, 169, -1 }, { 1473, 247, 1132 }, { 0, 247, 1135 }, { 2283, 266, -1 }, { 1109, 241, -1 },
+    { 1114, 241, -1 }, { 6189, 661, -1 }, { 0, 266, 1807 }, { 0, 266, 1808 }, { 0, 266, 1809 }, { 6007, 582, -1 },
+    { 4, 582, -1 }, { 1356, 241, -1 }, { 4304, 314, -1 }, { 2308, 266, -1 }, { 0, 241, 817 }, { 1119, 241, -1 },
+    { 6237, 678, -1 }, { 3615, 241, 819 }, { 1134, 241, 870 }, { 1373, 242, 876 }, { 0, 241, 872 }, { 1148, 241, -1 },
+    { 1155, 241, -1 }, { 2990, 242, 879 }, { 6194, 680, -1 }, { 3053, 242, -1 }, { 0, 241, 875 }, { 4988, 390, -1 },
+    { 1168, 242, 927 }, { 4254, 314, -1 }, { 0, 446, 5379 }, { 1160, 242, -1 }, { 0, 446, 5380 }, { 0, 446, 5381 },
+    { 0, 242, 931 }, { 0, 446, 5382 }, { 0, 242, 932 }, { 4282, 314, -1 }, { 4298, 314, -1 }, { 6234, 690, -1 },
+    { 2326, 266, -1 }, { 4285, 314, -1 }, { 0, 372, 4288 }, { 0, 372, 4289 }, { 6192, 695, -1 }, { 4897, 372, 4290 },
+    { 0, 242, 933 }, { 4994, 390, -1 }, { 1179, 242, -1 }, { 1300, 243, -1 }, { 6246, 699, -1 }, { 2198, 242, 935 },
+    { 6082, 147, -1 }, { 6052, 147, -1 }, { 0, 390, 4512 }, { 1190, 242, 943 }, { 0, 243, 990 }, { 0, 314, 3213 },
+    { 6198, 693, -1 }, { 0, 314, 3214 }, { 1199, 243, -1 }, { 3952, 243, 992 }, { 0, 242, 945 }, { 6199, 694, -1 },
+    { 2284, 242, 946 }, { 4937, 383, 4388 }, { 0, 242, 953 }, { 1469, 243, 1007 }, { 0, 243, 1010 }, { 1474, 243, 1011 },
+    { 1393, 243, 1014 }, { 6107, 593, -1 }, { 4935, 383, -1 }, { 2453, 242, -1 }, { 6129, 593, -1 }, { 0, 243, 1017 },
+    { 4995, 390, -1 }, { 1262, 242, -1 }, { 1228, 242, 979 }, { 1218, 243, -1 }, { 1192, 242, -1 }, { 6209, 701, -1 },
+    { 0, 242, 983 }, { 6106, 603, -1 }, { 1224, 243, -1 }, { 4940, 383, -1 }, { 1328, 243, 1020 }, { 6157, 603, -1 },
+    { 0, 243, 1025 }, { 2753, 243, -1 }, { 6261, 703, -1 }, { 1240, 243, -1 }, { 6219, 709, -1 }, { 0, 244, 1075 },
+    { 6272, 703, -1 }, { 0, 244, 1076 }, { 1837, 244, -1 }, { 4335, 243, -1 }, { 6114, 179, -1 }, { 6100, 179, -1 },
+    { 0, 243, 1069 }, { 6225, 729, -1 }, { 1486, 243, -1 }, { 1546, 244, -1 }, { 0, 243, 1073 }, { 6275, 153, -1 },
+    { 0, 243, 1074 }, { 1943, 252, -1 }, { 0, 387, 4431 }, { 0, 244, 1082 }, { 0, 244, 1083 }, { 1991, 252, -1 },
+    { 0, 383, 4396 }, { 0, 387, 4432 }, { 6274, 155, -1 }, { 1249, 244, -1 }, { 6228, 167, -1 }, { 0, 252, 1540 },
+    { 6272, 167, -1 }, { 0, 252, 1541 }, { 0, 252, 1542 }, { 0, 387, 4433 }, { 0, 252, 1543 }, { 0, 252, 1544 },
+    { 1816, 252, 1545 }, { 0, 252, 1547 }, { 0, 252, 1548 }, { 4867, 367, -1 }, { 0, 252, 1549 }, { 0, 252, 1550 },
+    { 1268, 244, 1085 }, { 6294, 168, -1 }, { 0, 244, 1087 }, { 0, 337, 3747 }, { 1291, 244, -1 }, { 1295, 244, -1 },
+    { 0, 337, 3748 }, { 0, 337, 3749 }, { 0, 337, 3750 }, { 4952, 387, -1 }, { 4958, 387, -1 }, { 2035, 252, -1 },
+    { 1368, 245, -1 }, { 1340, 244, -1 }, { 0, 245, 1093 }, { 1399, 245, 1094 }, { 1407, 245, -1 }, { 1416, 245, -1 },
+    { 0, 245, 1098 }, { 0, 245, 1099 }, { 6262, 172, -1 }, { 2055, 255, -1 }, { 4872, 367, -1 }, { 4873, 367, -1 },
+    { 2316, 248, -1 }, { 0, 245, 1100 }, { 2509, 248, -1 }, { 2060, 255, -1 }, { 1450, 245, -1 }, { 4875, 367, -1 },
+    { 1630, 248, -1 }, { 1827, 252, -1 }, { 6304, 203, -1 }, { 1480, 248, -1 }, { 0, 245, 1102 }, { 0, 245, 1103 },
+    { 0, 245, 1104 }, { 1484, 248, 1162 }, { 1505, 248, 1164 }, { 4659, 337, -1 }, { 0, 357, 4115 }, { 6252, 182, -1 },
+    { 0, 357, 4116 }, { 0, 357, 4117 }, { 2467, 248, 1166 }, { 1511, 248, 1172 }, { 2519, 248, -1 }, { 0, 255, 1625 },
+    { 0, 245, 1105 }, { 2345, 248, -1 }, { 6108, 180, -1 }, { 6102, 180, -1 }, { 0, 255, 1626 }, { 6244, 175, -1 },
+    { 0, 255, 1627 }, { 2361, 248, -1 }, { 0, 255, 1628 }, { 1521, 248, 1188 }, { 6286, 175, -1 }, { 4353, 248, 1190 },
+    { 0, 366, 4245 }, { 0, 366, 4246 }, { 1527, 248, 1213 }, { 0, 366, 4247 }, { 4870, 366, -1 }, { 0, 409, 4716 },
+    { 1571, 248, 1215 }, { 0, 409, 4717 }, { 4812, 357, -1 }, { 2067, 255, -1 }, { 0, 249, 1259 }, { 1850, 248, -1 },
+    { 6260, 206, -1 }, { 0, 249, 1260 }, { 3375, 249, 1261 }, { 0, 248, 1221 }, { 1549, 248, -1 }, { 0, 249, 1278 },
+    { 4359, 248, -1 }, { 1560, 249, 1279 }, { 0, 249, 1282 }, { 0, 249, 1283 }, { 2113, 255, -1 }, { 5901, 556, -1 },
+    { 5939, 556, -1 }, { 5961, 556, -1 }, { 6264, 222, -1 }, { 4812, 357, -1 }, { 0, 381, 4352 }, { 0, 249, 1284 },
+    { 1734, 250, 1307 }, { 0, 343, 3772 }, { 1855, 249, -1 }, { 0, 343, 3773 }, { 0, 409, 4718 }, { 6298, 721, -1 },
+    { 4665, 343, 3774 }, { 0, 409, 4719 }, { 6317, 725, -1 }, { 2528, 249, -1 }, { 2062, 250, 1311 }, { 1896, 250, -1 },
+    { 0, 249, 1295 }, { 0, 249, 1296 }, { 6332, 739, -1 }, { 4365, 250, 1322 }, { 0, 249, 1297 }, { 4668, 343, -1 },
+    { 1563, 249, 1298 }, { 0, 249, 1300 }, { 1608, 250, -1 }, { 1645, 250, -1 }, { 1930, 250, 1378 }, { 0, 250, 1381 },
+    { 1576, 249, 1301 }, { 4668, 343, -1 }, { 4919, 381, -1 }, { 0, 381, 4354 }, { 6146, 618, -1 }, { 6161, 618, -1 },
+    { 1613, 250, 1382 }, { 6303, 673, -1 }, { 5067, 405, -1 }, { 2887, 250, -1 }, { 2405, 250, -1 }, { 4920, 381, -1 },
+    { 1621, 250, -1 }, { 1602, 249, -1 }, { 6317, 674, -1 }, { 1625, 250, -1 }, { 3469, 250, -1 }, { 1663, 249, 1304 },
+    { 6287, 675, -1 }, { 5068, 405, 4667 }, { 1636, 250, -1 }, { 1691, 250, -1 }, { 2042, 250, -1 }, { 4446, 318, -1 },
+    { 1681, 250, -1 }, { 6296, 686, -1 }, { 0, 319, 3254 }, { 5071, 405, 4669 }, { 1698, 250, 1436 }, { 1710, 250, 1440 },
+    { 2088, 251, -1 }, { 0, 250, 1442 }, { 2868, 251, -1 }, { 1932, 251, -1 }, { 5074, 405, -1 }, { 0, 250, 1443 },
+    { 4452, 318, -1 }, { 2203, 251, -1 }, { 1714, 251, -1 }, { 4371, 251, -1 }, { 6307, 706, -1 }, { 1719, 251, -1 },
+    { 1723, 251, -1 }, { 3073, 251, 1501 }, { 6318, 529, -1 }, { 1728, 251, -1 }, { 2220, 251, -1 }, { 6250, 198, -1 },
+    { 0, 251, 1519 }, { 6306, 198, -1 }, { 1746, 251, 1520 }, { 0, 391, 4517 }, { 0, 251, 1522 }, { 0, 318, 3251 },
+    { 5074, 405, -1 }, { 4454, 319, -1 }, { 6381, 543, -1 }, { 4452, 318, -1 }, { 6322, 670, -1 }, { 1771, 251, -1 },
+    { 1773, 251, -1 }, { 4453, 318, -1 }, { 4452, 319, -1 }, { 4821, 359, -1 }, { 0, 251, 1525 }, { 4456, 319, -1 },
+    { 0, 391, 4518 }, { 0, 391, 4519 }, { 1778, 251, -1 }, { 0, 251, 1527 }, { 4456, 319, -1 }, { 4460, 319, -1 },
+    { 1778, 251, -1 }, { 0, 251, 1529 }, { 2331, 257, 1644 }, { 1867, 253, -1 }, { 1791, 251, 1530 }, { 1875, 253, -1 },
+    { 0, 253, 1560 }, { 6379, 685, -1 }, { 4824, 359, -1 }, { 0, 251, 1532 }, { 4826, 359, -1 }, { 4989, 391, -1 },
+    { 1881, 253, -1 }, { 1804, 251, -1 }, { 1808, 251, -1 }, { 6337, 145, -1 }, { 0, 253, 1562 }, { 1916, 253, -1 },
+    { 0, 253, 1564 }, { 6327, 676, -1 }, { 2256, 256, -1 }, { 4824, 359, -1 }, { 6357, 676, -1 }, { 2235, 254, -1 },
+    { 1993, 254, -1 }, { 0, 359, 4146 }, { 6332, 176, -1 }, { 2016, 254, -1 }, { 2077, 257, -1 }, { 2084, 257, -1 },
+    { 6344, 183, -1 }, { 1962, 253, -1 }, { 4829, 359, -1 }, { 1967, 253, -1 }, { 6373, 149, -1 }, { 1979, 253, -1 },
+    { 1996, 254, 1603 }, { 6367, 740, -1 }, { 1981, 253, -1 }, { 2096, 257, -1 }, { 0, 254, 1605 }, { 0, 254, 1606 },
+    { 0, 254, 1607 }, { 0, 254, 1608 }, { 0, 254, 1609 }, { 6389, 743, -1 }, { 2292, 254, 1610 }, { 3602, 253, -1 },
+    { 0, 254, 1617 }, { 6157, 645, -1 }, { 6207, 645, -1 }, { 0, 254, 1618 }, { 0, 254, 1619 }, { 0, 256, 1635 },
+    { 2024, 254, 1620 }, { 0, 257, 1653 }, { 6226, 671, -1 }, { 6232, 671, -1 }, { 0, 256, 1636 }, { 0, 256, 1637 },
+    { 2495, 256, 1638 }, { 0, 257, 1654 }, { 0, 257, 1655 }, { 6341, 746, -1 }, { 3595, 262, -1 }, { 2022, 254, -1 },
+    { 5111, 414, -1 }, { 3934, 262, -1 }, { 5109, 414, -1 }, { 2070, 256, -1 }, { 0, 256, 1643 }, { 2143, 262, 1720 },
+    { 0, 263, 1749 }, { 5111, 414, 4784 }, { 2269, 263, -1 }, { 4606, 330, -1 }, { 6393, 748, -1 }, { 5116, 414, -1 },
+    { 4607, 330, -1 }, { 5389, 462, -1 }, { 5504, 484, -1 }, { 5117, 414, -1 }, { 2186, 262, 1722 }, { 6285, 738, -1 },
+    { 6331, 738, -1 }, { 3046, 262, -1 }, { 0, 262, 1732 }, { 4608, 330, 3646 }, { 0, 462, 5497 }, { 0, 262, 1733 },
+    { 0, 262, 1734 }, { 0, 330, 3649 }, { 6394, 749, -1 }, { 6343, 753, -1 }, { 0, 484, 5916 }, { 2159, 262, -1 },
+    { 4609, 330, -1 }, { 2339, 263, -1 }, { 2375, 262, 1736 }, { 2157, 262, 1746 }, { 2421, 265, -1 }, { 2535, 263, 1755 },
+    { 0, 265, 1790 }, { 0, 334, 3716 }, { 0, 265, 1791 }, { 0, 334, 3717 }, { 2166, 263, -1 }, { 0, 484, 5917 },
+    { 4609, 330, -1 }, { 2265, 265, -1 }, { 4608, 330, -1 }, { 6364, 780, -1 }, { 4644, 334, -1 }, { 0, 462, 5498 },
+    { 2384, 263, -1 }, { 4884, 370, -1 }, { 0, 265, 1793 }, { 0, 264, 1767 }, { 2348, 264, -1 }, { 2177, 264, -1 },
+    { 0, 330, 3653 }, { 4645, 334, -1 }, { 5510, 484, -1 }, { 0, 263, 1764 }, { 2172, 263, 1765 }, { 0, 264, 1773 },
+    { 5510, 484, 5919 }, { 6387, 788, -1 }, { 2205, 264, 1774 }, { 2210, 264, 1776 }, { 0, 264, 1779 }, { 0, 264, 1780 },
+    { 0, 264, 1781 }, { 0, 264, 1782 }, { 0, 264, 1783 }, { 6429, 789, -1 }, { 2277, 265, 1794 }, { 6397, 791, -1 },
+    { 2230, 264, -1 }, { 0, 265, 1796 }, { 2239, 264, -1 }, { 0, 265, 1797 }, { 5350, 448, -1 }, { 0, 265, 1798 },
+    { 0, 271, 1834 }, { 6388, 794, -1 }, { 4645, 334, -1 }, { 2479, 271, 1835 }, { 0, 265, 1799 }, { 4646, 334, -1 },
+    { 6441, 796, -1 }, { 2262, 264, -1 }, { 4650, 334, -1 }, { 4377, 271, 1837 }, { 6450, 799, -1 }, { 2543, 271, -1 },
+    { 6398, 800, -1 }, { 4885, 370, -1 }, { 4886, 370, 4267 }, { 0, 272, 2014 }, { 0, 272, 2015 }, { 4654, 334, -1 },
+    { 2481, 271, -1 }, { 5351, 448, -1 }, { 0, 370, 4270 }, { 2928, 272, -1 }, { 2554, 271, -1 }, { 5352, 448, -1 },
+    { 2739, 271, -1 }, { 2521, 272, 2019 }, { 4885, 370, -1 }, { 0, 271, 1913 }, { 6413, 801, -1 }, { 2526, 272, -1 },
+    { 6439, 806, -1 }, { 4808, 356, -1 }, { 6408, 820, -1 }, { 4811, 356, -1 }, { 6425, 822, -1 }, { 4383, 271, -1 },
+    { 2559, 272, 2022 }, { 2789, 271, -1 }, { 2847, 271, -1 }, { 2760, 273, -1 }, { 0, 448, 5389 }, { 6378, 784, -1 },
+    { 6411, 784, -1 }, { 2597, 273, 2044 }, { 0, 273, 2046 }, { 0, 273, 2047 }, { 5353, 449, -1 }, { 6415, 833, -1 },
+    { 2728, 271, 1961 }, { 0, 290, 2273 }, { 0, 449, 5393 }, { 0, 272, 2024 }, { 4389, 271, -1 }, { 2489, 271, 2009 },
+    { 2502, 271, 2012 }, { 4810, 356, -1 }, { 6457, 834, -1 }, { 2644, 275, -1 }, { 6429, 845, -1 }, { 2628, 273, -1 },
+    { 0, 275, 2074 }, { 0, 275, 2075 }, { 0, 275, 2076 }, { 0, 275, 2077 }, { 0, 275, 2078 }, { 2562, 272, -1 },
+    { 2577, 272, -1 }, { 5354, 449, -1 }, { 6035, 612, -1 }, { 6038, 612, -1 }, { 2604, 272, -1 }, { 0, 356, 4113 },
+    { 0, 356, 4114 }, { 6078, 612, -1 }, { 6459, 848, -1 }, { 3020, 272, -1 }, { 4996, 392, -1 }, { 3120, 290, -1 },
+    { 0, 273, 2049 }, { 0, 273, 2050 }, { 0, 273, 2051 }, { 3064, 290, -1 }, { 3079, 290, -1 }, { 3081, 290, -1 },
+    { 3087, 290, -1 }, { 0, 290, 2283 }, { 4995, 392, -1 }, { 0, 281, 2109 }, { 6428, 851, -1 }, { 5179, 425, -1 },
+    { 0, 392, 4523 }, { 0, 290, 2284 }, { 0, 425, 5021 }, { 2766, 281, -1 }, { 0, 413, 4744 }, { 2771, 281, -1 },
+    { 3123, 290, -1 }, { 2771, 281, -1 }, { 6462, 852, -1 }, { 3093, 290, -1 }, { 0, 413, 4745 }, { 0, 292, 2314 },
+    { 6496, 861, -1 }, { 5098, 413, -1 }, { 3148, 292, -1 }, { 0, 275, 2079 }, { 0, 275, 2080 }, { 6447, 858, -1 },
+    { 0, 275, 2081 }, { 2778, 281, -1 }, { 2786, 281, -1 }, { 6484, 858, -1 }, { 2794, 281, -1 }, { 4999, 392, 4524 },
+    { 5104, 413, -1 }, { 2841, 281, 2119 }, { 2941, 281, 2124 }, { 5182, 425, -1 }, { 0, 281, 2128 }, { 0, 281, 2129 },
+    { 6518, 878, -1 }, { 2802, 281, -1 }, { 4905, 377, -1 }, { 4998, 392, -1 }, { 2803, 281, -1 }, { 4907, 377, 4331 },
+    { 0, 377, 4333 }, { 5183, 425, -1 }, { 2808, 281, 2132 }, { 2814, 281, 2134 }, { 6502, 885, -1 }, { 2830, 282, -1 },
+    { 6551, 910, -1 }, { 2853, 282, -1 }, { 2933, 282, -1 }, { 0, 483, 5909 }, { 5506, 483, 5910 }, { 6523, 890, -1 },
+    { 2822, 281, -1 }, { 2868, 282, -1 }, { 2905, 281, -1 }, { 3551, 296, 2640 }, { 3435, 296, 2643 }, { 2822, 281, -1 },
+    { 3445, 296, 2649 }, { 2873, 282, -1 }, { 2875, 282, -1 }, { 2879, 281, 2142 }, { 0, 281, 2146 }, { 4406, 292, -1 },
+    { 3158, 292, -1 }, { 3519, 292, -1 }, { 5106, 413, -1 }, { 4412, 292, 2530 }, { 4906, 377, -1 }, { 3453, 292, -1 },
+    { 0, 282, 2154 }, { 3475, 296, -1 }, { 6596, 909, -1 }, { 0, 377, 4335 }, { 2900, 282, -1 }, { 0, 296, 2652 },
+    { 3463, 292, 2566 }, { 5506, 483, -1 }, { 6575, 914, -1 }, { 5057, 403, -1 }, { 0, 483, 5913 }, { 0, 435, 5191 },
+    { 6556, 908, -1 }, { 5264, 435, -1 }, { 5264, 435, 5194 }, { 6553, 908, -1 }, { 3481, 296, -1 }, { 2917, 282, -1 },
+    { 0, 386, 4424 }, { 2949, 283, -1 }, { 0, 403, 4643 }, { 0, 435, 5196 }, { 2945, 283, -1 }, { 6579, 921, -1 },
+    { 0, 283, 2182 }, { 0, 483, 5914 }, { 0, 296, 2654 }, { 2930, 282, -1 }, { 4341, 282, 2158 }, { 2933, 282, -1 },
+    { 0, 282, 2174 }, { 2939, 282, 2175 }, { 6634, 945, -1 }, { 3528, 283, -1 }, { 2943, 282, 2177 }, { 2950, 283, -1 },
+    { 0, 386, 4425 }, { 0, 386, 4426 }, { 2955, 283, 2193 }, { 3447, 284, -1 }, { 4912, 378, -1 }, { 0, 284, 2225 },
+    { 0, 283, 2195 }, { 4914, 378, -1 }, { 6511, 907, -1 }, { 4669, 344, -1 }, { 6501, 907, -1 }, { 0, 283, 2196 },
+    { 0, 284, 2226 }, { 0, 284, 2227 }, { 3061, 284, -1 }, { 6641, 960, -1 }, { 0, 378, 4343 }, { 0, 378, 4344 },
+    { 2960, 284, -1 }, { 0, 386, 4427 }, { 0, 386, 4428 }, { 0, 283, 2197 }, { 5060, 403, 4644 }, { 2996, 285, 2247 },
+    { 0, 285, 2249 }, { 5062, 403, -1 }, { 5910, 560, -1 }, { 5959, 560, -1 }, { 5946, 560, -1 }, { 5920, 560, -1 },
+    { 5918, 560, -1 }, { 2983, 283, -1 }, { 4673, 344, -1 }, { 2975, 284, 2231 }, { 0, 283, 2200 }, { 4674, 344, -1 },
+    { 2980, 284, 2233 }, { 6590, 964, -1 }, { 3583, 283, 2201 }, { 0, 386, 4429 }, { 0, 386, 4430 }, { 0, 284, 2235 },
+    { 6650, 965, -1 }, { 4400, 283, 2209 }, { 0, 285, 2250 }, { 0, 285, 2251 }, { 0, 285, 2252 }, { 6563, 879, -1 },
+    { 0, 285, 2253 }, { 0, 285, 2254 }, { 3079, 284, -1 }, { 6561, 879, -1 }, { 3380, 284, -1 }, { 4912, 378, -1 },
+    { 4675, 344, -1 }, { 6100, 143, -1 }, { 4673, 344, -1 }, { 0, 344, 3790 }, { 6093, 143, -1 }, { 6044, 143, -1 },
+    { 3495, 295, 2599 }, { 0, 378, 4346 }, { 0, 295, 2607 }, { 3400, 295, 2608 }, { 3967, 295, -1 }, { 3005, 285, -1 },
+    { 0, 284, 2246 }, { 0, 285, 2256 }, { 0, 291, 2288 }, { 3105, 291, -1 }, { 3108, 291, -1 }, { 3009, 285, -1 },
+    { 0, 291, 2293 }, { 3027, 285, -1 }, { 5714, 520, -1 }, { 3121, 291, 2294 }, { 6612, 916, -1 }, { 0, 295, 2615 },
+    { 6558, 916, -1 }, { 3130, 291, -1 }, { 0, 520, 6837 }, { 3492, 295, -1 }, { 0, 291, 2298 }, { 0, 291, 2299 },
+    { 3409, 295, -1 }, { 0, 285, 2260 }, { 5922, 562, -1 }, { 5972, 562, -1 }, { 5960, 562, -1 }, { 5922, 562, -1 },
+    { 6645, 973, -1 }, { 0, 291, 2300 }, { 3545, 295, 2620 }, { 6457, 825, -1 }, { 6424, 825, -1 }, { 0, 291, 2301 },
+    { 3130, 291, -1 }, { 3539, 295, 2626 }, { 5719, 520, -1 }, { 5966, 564, -1 }, { 5945, 564, -1 }, { 5945, 564, -1 },
+    { 0, 295, 2630 }, { 6470, 841, -1 }, { 6421, 841, -1 }, { 3370, 291, 2303 }, { 0, 291, 2307 }, { 0, 295, 2631 },
+    { 5724, 520, -1 }, { 3386, 293, 2570 }, { 0, 520, 6840 }, { 3170, 293, 2573 }, { 3143, 291, -1 }, { 0, 291, 2310 },
+    { 6596, 972, -1 }, { 3179, 293, -1 }, { 0, 291, 2311 }, { 3506, 295, 2632 }, { 3429, 295, 2635 }, { 6436, 849, -1 },
+    { 6483, 849, -1 }, { 0, 293, 2578 }, { 0, 293, 2579 }, { 3676, 300, -1 }, { 0, 293, 2580 }, { 3455, 293, 2581 },
+    { 0, 291, 2312 }, { 0, 291, 2313 }, { 3201, 293, -1 }, { 6010, 595, -1 }, { 3232, 293, 2586 }, { 6047, 595, -1 },
+    { 3692, 300, 2888 }, { 3257, 293, -1 }, { 6066, 595, -1 }, { 0, 293, 2591 }, { 3286, 293, 2592 }, { 3778, 297, -1 },
+    { 4418, 297, -1 }, { 0, 300, 2890 }, { 6607, 900, -1 }, { 0, 297, 2706 }, { 3486, 297, -1 }, { 6603, 900, -1 },
+    { 3337, 293, -1 }, { 3563, 297, -1 }, { 6652, 975, -1 }, { 3866, 298, -1 }, { 3510, 297, -1 }, { 3551, 298, -1 },
+    { 0, 298, 2845 }, { 6180, 650, -1 }, { 6213, 650, -1 }, { 3513, 297, -1 }, { 6655, 976, -1 }, { 3515, 297, -1 },
+    { 6234, 650, -1 }, { 5495, 480, -1 }, { 0, 297, 2716 }, { 0, 298, 2846 }, { 3537, 297, -1 }, { 0, 400, 4588 },
+    { 5032, 400, -1 }, { 0, 480, 5887 }, { 6620, 977, -1 }, { 0, 400, 4591 }, { 0, 400, 4592 }, { 3559, 298, -1 },
+    { 3713, 300, -1 }, { 3561, 298, -1 }, { 3580, 297, -1 }, { 6268, 737, -1 }, { 3700, 300, 2893 }, { 6300, 737, -1 },
+    { 6296, 737, -1 }, { 3941, 300, 2895 }, { 3570, 298, -1 }, { 0, 300, 2900 }, { 0, 300, 2901 }, { 0, 300, 2902 },
+    { 0, 300, 2903 }, { 0, 300, 2904 }, { 0, 300, 2905 }, { 3570, 298, 2854 }, { 3706, 301, -1 }, { 6394, 751, -1 },
+    { 6399, 751, -1 }, { 3592, 298, -1 }, { 6382, 751, -1 }, { 3596, 299, 2859 }, { 0, 299, 2862 }, { 0, 299, 2863 },
+    { 0, 299, 2864 }, { 0, 299, 2865 }, { 0, 299, 2866 }, { 0, 299, 2867 }, { 6609, 988, -1 }, { 6668, 138, -1 },
+    { 3762, 301, -1 }, { 6641, 787, -1 }, { 3744, 302, -1 }, { 5500, 480, 5888 }, { 3752, 302, -1 }, { 3609, 299, -1 },
+    { 0, 301, 2910 }, { 4079, 302, 2924 }, { 0, 298, 2858 }, { 3609, 299, -1 }, { 0, 480, 5890 }, { 0, 301, 2911 },
+    { 3972, 301, 2912 }, { 0, 301, 2917 }, { 6639, 814, -1 }, { 0, 301, 2918 }, { 4636, 333, -1 }, { 6539, 897, -1 },
+    { 3789, 301, -1 }, { 0, 299, 2872 }, { 3621, 299, -1 }, { 6602, 897, -1 }, { 0, 400, 4593 }, { 6556, 899, -1 },
+    { 3723, 301, -1 }, { 5031, 400, -1 }, { 6690, 830, -1 }, { 6587, 899, -1 }, { 3623, 299, -1 }, { 6697, 993, -1 },
+    { 3705, 299, -1 }, { 3635, 299, -1 }, { 6659, 997, -1 }, { 3635, 299, -1 }, { 3640, 299, -1 }, { 6620, 932, -1 },
+    { 0, 302, 2928 }, { 3763, 302, 2929 }, { 3774, 302, 2931 }, { 6618, 932, -1 }, { 0, 302, 2933 }, { 0, 302, 2934 },
+    { 0, 302, 2935 }, { 0, 302, 2936 }, { 0, 302, 2937 }, { 6635, 795, -1 }, { 6668, 795, -1 }, { 0, 307, 2955 },
+    { 5367, 454, -1 }, { 3791, 302, -1 }, { 3645, 299, 2881 }, { 0, 299, 2885 }, { 0, 307, 2956 }, { 4637, 333, 3708 },
+    { 0, 299, 2886 }, { 4639, 333, -1 }, { 3835, 307, 2957 }, { 3846, 307, -1 }, { 6692, 998, -1 }, { 3862, 308, -1 },
+    { 3865, 308, -1 }, { 6701, 1005, -1 }, { 4640, 333, -1 }, { 4641, 333, -1 }, { 0, 307, 2960 }, { 3978, 307, 2961 },
+    { 6621, 171, -1 }, { 0, 454, 5432 }, { 6654, 171, -1 }, { 0, 454, 5433 }, { 4423, 308, -1 }, { 6704, 1017, -1 },
+    { 3871, 308, -1 }, { 4429, 308, -1 }, { 5365, 454, -1 }, { 0, 333, 3715 }, { 4051, 308, 3004 }, { 6688, 1022, -1 },
+    { 4434, 308, -1 }, { 0, 454, 5435 }, { 6098, 588, -1 }, { 6125, 588, -1 }, { 6119, 588, -1 }, { 4440, 308, -1 },
+    { 5594, 497, -1 }, { 3847, 307, 2965 }, { 3902, 308, -1 }, { 0, 497, 6267 }, { 0, 307, 2967 }, { 5599, 497, -1 },
+    { 5604, 497, -1 }, { 5607, 497, -1 }, { 5610, 497, -1 }, { 3854, 307, -1 }, { 5611, 497, -1 }, { 6630, 933, -1 },
+    { 0, 307, 2969 }, { 6701, 1036, -1 }, { 0, 308, 3048 }, { 6618, 933, -1 }, { 0, 308, 3049 }, { 0, 308, 3050 },
+    { 3911, 308, 3051 }, { 0, 308, 3053 }, { 3855, 307, -1 }, { 5814, 548, -1 }, { 3915, 308, -1 }, { 0, 308, 3055 },
+    { 3957, 309, -1 }, { 6761, 1039, -1 }, { 4118, 309, -1 }, { 6736, 1068, -1 }, { 0, 548, 7238 }, { 3923, 308, -1 },
+    { 3974, 309, -1 }, { 4167, 309, -1 }, { 4061, 308, -1 }, { 0, 309, 3081 }, { 0, 309, 3082 }, { 3956, 308, -1 },
+    { 6732, 1026, -1 }, { 6729, 1026, -1 }, { 0, 309, 3083 }, { 0, 309, 3084 }, { 0, 309, 3085 }, { 0, 309, 3086 },
+    { 6780, 1074, -1 }, { 4003, 309, 3087 }, { 0, 309, 3089 }, { 0, 406, 4677 }, { 0, 548, 7239 }, { 5812, 548, 7240 },
+    { 4009, 310, -1 }, { 5817, 548, -1 }, { 4125, 309, -1 }, { 4067, 310, 3104 }, { 4018, 310, -1 }, { 5077, 406, 4678 },
+    { 4029, 310, -1 }, { 4287, 310, -1 }, { 4147, 309, -1 }, { 6628, 197, -1 }, { 4042, 310, -1 }, { 5074, 406, -1 },
+    { 4212, 309, -1 }, { 6639, 197, -1 }, { 5078, 406, 4681 }, { 0, 406, 4684 }, { 4006, 309, -1 }, { 4053, 310, -1 },
+    { 4150, 310, -1 }, { 6756, 1087, -1 }, { 4027, 309, -1 }, { 4057, 310, -1 }, { 4010, 309, -1 }, { 4070, 310, -1 },
+    { 4070, 310, -1 }, { 0, 482, 5903 }, { 4077, 310, -1 }, { 0, 482, 5904 }, { 6829, 1070, -1 }, { 0, 310, 3121 },
+    { 6792, 1080, -1 }, { 5791, 534, -1 }, { 0, 310, 3122 }, { 0, 310, 3123 }, { 5793, 534, -1 }, { 0, 310, 3124 },
+    { 0, 310, 3125 }, { 4091, 310, 3126 }, { 4105, 310, 3128 }, { 0, 310, 3130 }, { 4160, 311, 3138 }, { 6812, 1086, -1 },
+    { 4114, 310, -1 }, { 4130, 310, -1 }, { 5794, 534, -1 }, { 5795, 534, 7086 }, { 6865, 1089, -1 }, { 6656, 990, -1 },
+    { 5505, 482, -1 }, { 4143, 310, -1 }, { 4173, 311, -1 }, { 6681, 990, -1 }, { 0, 406, 4685 }, { 6873, 1094, -1 },
+    { 0, 406, 4686 }, { 4202, 311, -1 }, { 0, 406, 4687 }, { 0, 482, 5906 }, { 4154, 310, -1 }, { 0, 482, 5907 },
+    { 4156, 310, -1 }, { 4187, 310, -1 }, { 0, 482, 5908 }, { 6832, 1071, -1 }, { 0, 311, 3146 }, { 0, 311, 3147 },
+    { 6816, 1071, -1 }, { 0, 311, 3148 }, { 0, 311, 3149 }, { 0, 311, 3150 }, { 0, 311, 3151 }, { 0, 311, 3152 },
+    { 0, 311, 3153 }, { 0, 311, 3154 }, { 0, 311, 3155 }, { 4191, 311, 3156 }, { 4204, 312, -1 }, { 6212, 702, -1 },
+    { 6259, 702, -1 }, { 4213, 312, -1 }, { 6745, 1091, -1 }, { 6230, 702, -1 }, { 4267, 313, -1 }, { 4221, 312, -1 },
+    { 6802, 1091, -1 }, { 4218, 312, -1 }, { 5795, 534, -1 }, { 4321, 316, 3225 }, { 0, 316, 3227 }, { 4344, 316, 3228 },
+    { 0, 316, 3230 }, { 0, 316, 3231 }, { 4296, 313, -1 }, { 0, 316, 3232 }, { 5967, 563, -1 }, { 5950, 563, -1 },
+    { 5940, 563, -1 }, { 5939, 563, -1 }, { 0, 411, 4722 }, { 4196, 311, -1 }, { 4256, 312, 3174 }, { 0, 312, 3177 },
+    { 6909, 1098, -1 }, { 0, 312, 3178 }, { 4228, 312, 3179 }, { 4225, 312, 3182 }, { 0, 315, 3215 }, { 0, 315, 3216 },
+    { 0, 315, 3217 }, { 4242, 313, -1 }, { 6850, 1095, -1 }, { 0, 315, 3218 }, { 6900, 1095, -1 }, { 4698, 348, -1 },
+    { 4246, 313, -1 }, { 6905, 1102, -1 }, { 4232, 312, 3184 }, { 4286, 315, -1 }, { 4701, 348, 3840 }, { 6900, 1102, -1 },
+    { 4702, 348, 3845 }, { 4292, 315, -1 }, { 4349, 316, -1 }, { 4232, 312, -1 }, { 4235, 312, -1 }, { 0, 313, 3197 },
+    { 0, 313, 3198 }, { 6860, 1103, -1 }, { 4346, 316, -1 }, { 0, 313, 3199 }, { 0, 313, 3200 }, { 6940, 1112, -1 },
+    { 0, 313, 3201 }, { 0, 317, 3237 }, { 0, 313, 3202 }, { 6919, 1115, -1 }, { 4425, 317, -1 }, { 6346, 522, -1 },
+    { 6354, 522, -1 }, { 4444, 316, -1 }, { 6940, 1116, -1 }, { 6366, 522, -1 }, { 4705, 348, -1 }, { 4702, 348, -1 },
+    { 4704, 348, -1 }, { 6962, 1119, -1 }, { 0, 317, 3239 }, { 4709, 348, 3850 }, { 5094, 411, -1 }, { 0, 411, 4727 },
+    { 4302, 315, -1 }, { 4318, 315, -1 }, { 6790, 1050, -1 }, { 6753, 1050, -1 }, { 4462, 320, 3264 }, { 4432, 317, -1 },
+    { 0, 411, 4728 }, { 0, 411, 4729 }, { 6406, 766, -1 }, { 4442, 317, -1 }, { 6348, 766, -1 }, { 6382, 766, -1 },
+    { 4475, 321, -1 }, { 6973, 1124, -1 }, { 0, 315, 3224 }, { 4447, 317, -1 }, { 0, 321, 3304 }, { 4463, 320, -1 },
+    { 4709, 348, 3855 }, { 0, 320, 3268 }, { 4448, 317, -1 }, { 6041, 598, -1 }, { 6050, 598, -1 }, { 6029, 598, -1 },
+    { 0, 321, 3305 }, { 6043, 598, -1 }, { 4464, 320, -1 }, { 4468, 320, -1 }, { 4480, 321, -1 }, { 4492, 322, -1 },
+    { 4467, 320, -1 }, { 0, 363, 4169 }, { 0, 317, 3245 }, { 4493, 322, -1 }, { 0, 317, 3246 }, { 0, 317, 3247 },
+    { 4468, 320, -1 }, { 0, 317, 3248 }, { 6933, 1133, -1 }, { 4495, 322, -1 }, { 4470, 320, 3275 }, { 6935, 1134, -1 },
+    { 4469, 320, -1 }, { 4493, 322, -1 }, { 4474, 320, -1 }, { 6977, 1142, -1 }, { 0, 321, 3385 }, { 5689, 516, -1 },
+    { 4473, 321, -1 }, { 6932, 1146, -1 }, { 4485, 321, 3387 }, { 6618, 146, -1 }, { 6668, 146, -1 }, { 4486, 321, -1 },
+    { 6671, 146, -1 }, { 4484, 321, -1 }, { 0, 516, 6738 }, { 5690, 516, 6739 }, { 6980, 1150, -1 }, { 4840, 363, -1 },
+    { 4499, 322, 3404 }, { 0, 363, 4175 }, { 4490, 321, -1 }, { 0, 363, 4176 }, { 4835, 363, -1 }, { 4501, 322, -1 },
+    { 4487, 321, -1 }, { 4503, 322, 3414 }, { 4510, 323, -1 }, { 4842, 363, 4179 }, { 0, 396, 4562 }, { 6939, 1159, -1 },
+    { 4512, 323, -1 }, { 4523, 324, -1 }, { 5016, 396, -1 }, { 6982, 1160, -1 }, { 4514, 323, -1 }, { 4502, 322, -1 },
+    { 0, 363, 4181 }, { 0, 363, 4182 }, { 5013, 396, -1 }, { 0, 324, 3464 }, { 4504, 322, 3422 }, { 0, 322, 3425 },
+    { 0, 396, 4565 }, { 0, 396, 4566 }, { 6955, 954, -1 }, { 0, 323, 3442 }, { 4527, 324, 3465 }, { 0, 324, 3468 },
+    { 0, 324, 3469 }, { 0, 324, 3470 }, { 0, 324, 3471 }, { 4519, 323, -1 }, { 6997, 991, -1 }, { 0, 516, 6742 },
+    { 4524, 324, -1 }, { 4546, 327, -1 }, { 4552, 327, -1 }, { 4520, 323, -1 }, { 4529, 324, -1 }, { 0, 347, 3822 },
+    { 0, 516, 6743 }, { 5688, 516, 6744 }, { 6623, 926, -1 }, { 5014, 396, -1 }, { 0, 396, 4568 }, { 6636, 926, -1 },
+    { 6610, 926, -1 }, { 4515, 323, -1 }, { 4527, 324, -1 }, { 6094, 591, -1 }, { 6111, 591, -1 }, { 6076, 591, -1 },
+    { 4692, 347, 3823 }, { 4520, 323, -1 }, { 4532, 324, -1 }, { 6746, 1031, -1 }, { 4541, 327, -1 }, { 6703, 1031, -1 },
+    { 5244, 433, -1 }, { 6747, 1031, -1 }, { 0, 323, 3451 }, { 6780, 1052, -1 }, { 4523, 323, 3452 }, { 6724, 1052, -1 },
+    { 6754, 1052, -1 }, { 4551, 327, -1 }, { 0, 347, 3826 }, { 4555, 327, -1 }, { 4689, 347, -1 }, { 4558, 327, -1 },
+    { 4533, 324, -1 }, { 4560, 327, -1 }, { 7006, 1149, -1 }, { 0, 347, 3828 }, { 4558, 327, 3525 }, { 0, 328, 3556 },
+    { 4562, 327, -1 }, { 4571, 328, 3557 }, { 0, 328, 3561 }, { 4566, 327, -1 }, { 6954, 1151, -1 }, { 4571, 328, -1 },
+    { 0, 347, 3829 }, { 5246, 433, -1 }, { 4694, 347, -1 }, { 4562, 327, 3551 }, { 6999, 1158, -1 }, { 5243, 433, -1 },
+    { 4699, 347, -1 }, { 4573, 328, -1 }, { 5247, 433, -1 }, { 4577, 328, -1 }, { 4575, 328, -1 }, { 5247, 433, -1 },
+    { 4626, 332, -1 }, { 6055, 160, -1 }, { 6102, 160, -1 }, { 6101, 160, -1 }, { 4625, 332, -1 }, { 6065, 160, -1 },
+    { 5251, 433, -1 }, { 6823, 1061, -1 }, { 6798, 1061, -1 }, { 4578, 328, -1 }, { 4630, 332, -1 }, { 4582, 328, -1 },
+    { 4583, 328, -1 }, { 4583, 328, 3574 }, { 4584, 328, 3577 }, { 4632, 332, -1 }, { 6679, 777, -1 }, { 6679, 777, -1 },
+    { 0, 328, 3579 }, { 6641, 777, -1 }, { 0, 329, 3623 }, { 4582, 328, 3580 }, { 0, 328, 3582 }, { 0, 329, 3624 },
+    { 6171, 640, -1 }, { 6187, 640, -1 }, { 6175, 640, -1 }, { 7000, 1163, -1 }, { 4587, 328, -1 }, { 4589, 328, 3585 },
+    { 0, 332, 3693 }, { 0, 332, 3694 }, { 4633, 332, 3695 }, { 0, 332, 3697 }, { 0, 332, 3698 }, { 4633, 332, 3699 },
+    { 0, 332, 3701 }, { 0, 332, 3702 }, { 0, 332, 3703 }, { 0, 332, 3704 }, { 6788, 1072, -1 }, { 6784, 1072, -1 },
+    { 4598, 329, -1 }, { 4593, 328, -1 }, { 4587, 328, -1 }, { 6892, 1107, -1 }, { 6880, 1107, -1 }, { 4599, 329, -1 },
+    { 4600, 329, -1 }, { 0, 329, 3632 }, { 6022, 601, -1 }, { 6070, 601, -1 }, { 6055, 601, -1 }, { 0, 329, 3633 },
+    { 0, 329, 3634 }, { 6057, 601, -1 }, { 0, 329, 3635 }, { 6996, 937, -1 }, { 6997, 937, -1 }, { 0, 329, 3636 },
+    { 0, 331, 3654 }, { 4602, 329, 3637 }, { 0, 329, 3639 }, { 5002, 393, -1 }, { 0, 329, 3640 }, { 0, 331, 3655 },
+    { 4604, 329, -1 }, { 4613, 331, 3656 }, { 0, 331, 3663 }, { 4617, 331, 3664 }, { 0, 331, 3666 }, { 4617, 331, 3667 },
+    { 0, 331, 3669 }, { 4601, 329, -1 }, { 0, 331, 3670 }, { 0, 331, 3671 }, { 6972, 1177, -1 }, { 4619, 331, 3672 },
+    { 0, 393, 4528 }, { 0, 335, 3737 }, { 5003, 393, -1 }, { 6987, 1179, -1 }, { 0, 331, 3676 }, { 4621, 331, -1 },
+    { 6454, 802, -1 }, { 6442, 802, -1 }, { 5003, 393, -1 }, { 6461, 802, -1 }, { 6437, 802, -1 }, { 0, 393, 4535 },
+    { 6982, 1181, -1 }, { 4656, 335, -1 }, { 6961, 1184, -1 }, { 4623, 331, -1 }, { 0, 360, 4149 }, { 0, 360, 4150 },
+    { 4653, 335, -1 }, { 0, 393, 4536 }, { 0, 393, 4537 }, { 0, 360, 4151 }, { 0, 444, 5342 }, { 0, 360, 4152 },
+    { 0, 444, 5343 }, { 6977, 941, -1 }, { 0, 444, 5344 }, { 0, 444, 5345 }, { 6999, 941, -1 }, { 0, 345, 3791 },
+    { 7022, 1170, -1 }, { 0, 335, 3740 }, { 0, 335, 3741 }, { 7017, 1182, -1 }, { 0, 335, 3742 }, { 0, 345, 3792 },
+    { 0, 335, 3743 }, { 4621, 331, 3680 }, { 4830, 360, 4153 }, { 4679, 345, 3793 }, { 5335, 444, -1 }, { 0, 351, 3943 },
+    { 4624, 331, -1 }, { 5340, 444, -1 }, { 0, 331, 3686 }, { 0, 335, 3744 }, { 0, 345, 3796 }, { 0, 345, 3797 },
+    { 4657, 335, -1 }, { 7022, 1173, -1 }, { 4676, 345, -1 }, { 6989, 1173, -1 }, { 4680, 346, 3807 }, { 0, 346, 3809 },
+    { 0, 345, 3799 }, { 4828, 360, -1 }, { 4832, 360, -1 }, { 7023, 1200, -1 }, { 0, 351, 3944 }, { 7039, 1211, -1 },
+    { 5175, 424, 5006 }, { 0, 345, 3800 }, { 0, 360, 4160 }, { 4749, 351, -1 }, { 4687, 346, -1 }, { 5341, 444, -1 },
+    { 4687, 346, -1 }, { 4746, 351, -1 }, { 6995, 971, -1 }, { 6956, 971, -1 }, { 4748, 351, -1 }, { 5342, 444, -1 },
+    { 4686, 346, 3813 }, { 5179, 424, -1 }, { 6850, 1096, -1 }, { 6901, 1096, -1 }, { 0, 346, 3815 }, { 6916, 1096, -1 },
+    { 4689, 346, -1 }, { 6901, 1096, -1 }, { 4679, 345, 3801 }, { 5706, 518, 6780 }, { 4750, 351, -1 }, { 4681, 345, -1 },
+    { 0, 346, 3818 }, { 4715, 349, -1 }, { 4716, 349, -1 }, { 5709, 518, -1 }, { 7032, 981, -1 }, { 5710, 518, -1 },
+    { 0, 424, 5016 }, { 4679, 345, -1 }, { 5181, 424, 5017 }, { 6996, 987, -1 }, { 4691, 346, -1 }, { 5182, 424, -1 },
+    { 6807, 1060, -1 }, { 4733, 350, -1 }, { 6816, 1060, -1 }, { 6795, 1060, -1 }, { 0, 351, 3953 }, { 6999, 1029, -1 },
+    { 4719, 349, -1 }, { 7003, 1215, -1 }, { 0, 346, 3821 }, { 6100, 602, -1 }, { 6170, 602, -1 }, { 6149, 602, -1 },
+    { 4708, 349, 3881 }, { 6162, 602, -1 }, { 4725, 349, 3883 }, { 7023, 1174, -1 }, { 0, 349, 3890 }, { 4708, 349, 3891 },
+    { 4718, 349, 3893 }, { 0, 349, 3895 }, { 0, 349, 3896 }, { 7014, 1175, -1 }, { 0, 349, 3897 }, { 0, 349, 3898 },
+    { 4734, 350, -1 }, { 6889, 1104, -1 }, { 6877, 1104, -1 }, { 0, 350, 3910 }, { 6886, 1104, -1 }, { 0, 518, 6789 },
+    { 4736, 350, -1 }, { 4737, 350, -1 }, { 4727, 349, -1 }, { 7056, 1185, -1 }, { 5716, 518, -1 }, { 7029, 619, -1 },
+    { 5051, 402, -1 }, { 4742, 350, -1 }, { 4728, 349, -1 }, { 4739, 350, 3930 }, { 4721, 349, -1 }, { 7072, 659, -1 },
+    { 0, 402, 4631 }, { 4728, 349, -1 }, { 4732, 349, -1 }, { 7076, 662, -1 }, { 4743, 350, -1 }, { 5053, 402, -1 },
+    { 4747, 350, -1 }, { 6996, 1042, -1 }, { 0, 402, 4633 }, { 0, 350, 3935 }, { 0, 350, 3936 }, { 0, 350, 3937 },
+    { 7029, 1042, -1 }, { 0, 350, 3938 }, { 0, 350, 3939 }, { 0, 350, 3940 }, { 0, 350, 3941 }, { 0, 350, 3942 },
+    { 4755, 352, -1 }, { 7024, 199, -1 }, { 0, 352, 3958 }, { 7075, 202, -1 }, { 4755, 352, 3959 }, { 0, 352, 3961 },
+    { 0, 352, 3962 }, { 0, 352, 3963 }, { 7040, 216, -1 }, { 0, 352, 3964 }, { 4758, 352, 3965 }, { 0, 402, 4634 },
+    { 0, 352, 3967 }, { 0, 352, 3968 }, { 0, 352, 3969 }, { 7040, 195, -1 }, { 4761, 352, 3970 }, { 0, 352, 3973 },
+    { 4761, 352, 3974 }, { 0, 352, 3976 }, { 7058, 1217, -1 }, { 5888, 553, -1 }, { 5944, 553, -1 }, { 5936, 553, -1 },
+    { 5943, 553, -1 }, { 4763, 352, -1 }, { 5927, 553, -1 }, { 5054, 402, 4635 }, { 6367, 783, -1 }, { 6414, 783, -1 },
+    { 6413, 783, -1 }, { 4963, 388, -1 }, { 4774, 353, 3989 }, { 4955, 388, -1 }, { 4964, 388, -1 }, { 5053, 402, -1 },
+    { 7059, 1241, -1 }, { 5057, 402, -1 }, { 7118, 1245, -1 }, { 4788, 354, -1 }, { 4763, 352, -1 }, { 4764, 352, -1 },
+    { 4780, 353, -1 }, { 7088, 1252, -1 }, { 0, 388, 4471 }, { 4768, 352, -1 }, { 4966, 388, -1 }, { 5937, 566, -1 },
+    { 5981, 566, -1 }, { 5987, 566, -1 }, { 4793, 354, -1 }, { 5950, 566, -1 }, { 6005, 566, -1 }, { 7136, 1270, -1 },
+    { 4772, 352, -1 }, { 4770, 352, -1 }, { 4790, 354, -1 }, { 0, 353, 4008 }, { 7141, 1265, -1 }, { 0, 353, 4009 },
+    { 0, 353, 4010 }, { 0, 353, 4011 }, { 0, 353, 4012 }, { 0, 353, 4013 }, { 7048, 1228, -1 }, { 0, 353, 4014 },
+    { 0, 353, 4015 }, { 7098, 1228, -1 }, { 0, 353, 4016 }, { 0, 353, 4017 }, { 0, 353, 4018 }, { 4781, 353, 4019 },
+    { 4791, 354, -1 }, { 4968, 388, -1 }, { 6466, 881, -1 }, { 6538, 881, -1 }, { 4969, 388, 4478 }, { 0, 388, 4480 },
+    { 6468, 881, -1 }, { 6883, 1111, -1 }, { 6937, 1111, -1 }, { 4782, 353, -1 }, { 4794, 354, -1 }, { 4794, 354, -1 },
+    { 6938, 1111, -1 }, { 7142, 1274, -1 }, { 4786, 353, -1 }, { 7121, 1275, -1 }, { 4798, 354, -1 }, { 4799, 355, 4040 },
+    { 4798, 354, -1 }, { 0, 355, 4043 }, { 0, 355, 4044 }, { 0, 355, 4045 }, { 4813, 358, -1 }, { 0, 355, 4046 },
+    { 0, 355, 4047 }, { 6938, 1120, -1 }, { 6982, 1120, -1 }, { 0, 355, 4048 }, { 6925, 1120, -1 }, { 0, 355, 4049 },
+    { 4800, 355, 4050 }, { 6390, 785, -1 }, { 6446, 785, -1 }, { 6423, 785, -1 }, { 5081, 407, 4688 }, { 6385, 785, -1 },
+    { 4818, 358, -1 }, { 5082, 407, -1 }, { 7142, 1284, -1 }, { 4802, 355, -1 }, { 7009, 1169, -1 }, { 7017, 1169, -1 },
+    { 0, 358, 4122 }, { 0, 407, 4692 }, { 0, 407, 4693 }, { 0, 358, 4123 }, { 0, 407, 4694 }, { 7142, 1286, -1 },
+    { 4803, 355, 4053 }, { 0, 358, 4124 }, { 0, 358, 4125 }, { 0, 358, 4126 }, { 4819, 358, 4127 }, { 0, 358, 4130 },
+    { 4805, 355, -1 }, { 0, 358, 4131 }, { 0, 358, 4132 }, { 0, 358, 4133 }, { 0, 364, 4183 }, { 4819, 358, 4134 },
+    { 4822, 358, 4136 }, { 7045, 1166, -1 }, { 7028, 1166, -1 }, { 4807, 355, -1 }, { 4840, 364, -1 }, { 5716, 519, -1 },
+    { 0, 519, 6793 }, { 0, 364, 4185 }, { 0, 365, 4216 }, { 0, 365, 4217 }, { 0, 365, 4218 }, { 7153, 1297, -1 },
+    { 0, 519, 6794 }, { 7148, 1255, -1 }, { 0, 407, 4695 }, { 7092, 1220, -1 }, { 4841, 364, -1 }, { 5717, 519, -1 },
+    { 7122, 1220, -1 }, { 5083, 407, 4696 }, { 4846, 364, 4187 }, { 5722, 519, -1 }, { 4886, 371, -1 }, { 4891, 371, -1 },
+    { 0, 519, 6835 }, { 7099, 1282, -1 }, { 0, 364, 4189 }, { 0, 364, 4190 }, { 0, 371, 4275 }, { 6559, 894, -1 },
+    { 6531, 894, -1 }, { 4852, 365, -1 }, { 7160, 832, -1 }, { 6519, 894, -1 }, { 0, 365, 4221 }, { 4899, 373, -1 },
+    { 6976, 1192, -1 }, { 7026, 1192, -1 }, { 4860, 365, 4222 }, { 7040, 1192, -1 }, { 4890, 371, -1 }, { 0, 373, 4295 },
+    { 4893, 371, -1 }, { 4861, 365, -1 }, { 4847, 364, -1 }, { 0, 365, 4227 }, { 4862, 365, 4228 }, { 0, 365, 4230 },
+    { 4859, 365, 4231 }, { 4900, 373, -1 }, { 4865, 365, 4233 }, { 4868, 365, 4241 }, { 0, 365, 4243 }, { 0, 371, 4278 },
+    { 4844, 364, -1 }, { 4850, 364, 4193 }, { 4893, 371, -1 }, { 7161, 843, -1 }, { 4855, 364, 4202 }, { 0, 364, 4215 },
+    { 6642, 984, -1 }, { 6692, 984, -1 }, { 6691, 984, -1 }, { 0, 373, 4297 }, { 4868, 365, -1 }, { 5998, 589, -1 },
+    { 6050, 589, -1 }, { 6054, 589, -1 }, { 4896, 371, 4280 }, { 6002, 589, -1 }, { 5977, 589, -1 }, { 7163, 870, -1 },
+    { 4896, 371, -1 }, { 0, 371, 4286 }, { 0, 374, 4308 }, { 7007, 1148, -1 }, { 7047, 1148, -1 }, { 4898, 373, 4298 },
+    { 0, 373, 4301 }, { 0, 373, 4302 }, { 0, 373, 4303 }, { 0, 373, 4304 }, { 4898, 373, 4305 }, { 0, 373, 4307 },
+    { 7122, 1243, -1 }, { 0, 374, 4309 }, { 7079, 1243, -1 }, { 4905, 376, -1 }, { 7125, 1243, -1 }, { 4907, 376, -1 },
+    { 6684, 1009, -1 }, { 6704, 1009, -1 }, { 0, 374, 4310 }, { 7131, 1264, -1 }, { 6727, 1009, -1 }, { 0, 376, 4323 },
+    { 4921, 382, -1 }, { 7129, 1264, -1 }, { 4903, 374, -1 }, { 4924, 382, -1 }, { 7116, 156, -1 }, { 0, 452, 5410 },
+    { 5361, 452, 5411 }, { 0, 452, 5413 }, { 0, 374, 4312 }, { 0, 376, 4324 }, { 6699, 1015, -1 }, { 6690, 1015, -1 },
+    { 4922, 382, -1 }, { 4927, 382, -1 }, { 6695, 1015, -1 }, { 5362, 452, -1 }, { 0, 395, 4553 }, { 0, 374, 4313 },
+    { 0, 374, 4314 }, { 0, 374, 4315 }, { 4925, 382, -1 }, { 4905, 374, 4316 }, { 4927, 382, -1 }, { 7065, 1244, -1 },
+    { 7109, 1244, -1 }, { 4931, 382, 4370 }, { 0, 452, 5415 }, { 4937, 382, -1 }, { 0, 376, 4325 }, { 4906, 376, 4326 },
+    { 0, 376, 4328 }, { 4933, 382, 4386 }, { 7082, 1260, -1 }, { 7112, 1260, -1 }, { 4940, 384, -1 }, { 7172, 161, -1 },
+    { 4943, 384, -1 }, { 0, 395, 4554 }, { 0, 395, 4555 }, { 5011, 395, 4556 }, { 0, 376, 4329 }, { 0, 384, 4400 },
+    { 0, 384, 4401 }, { 4947, 385, -1 }, { 7166, 617, -1 }, { 4947, 385, -1 }, { 0, 385, 4414 }, { 0, 385, 4415 },
+    { 4949, 385, -1 }, { 0, 452, 5416 }, { 0, 384, 4402 }, { 0, 384, 4403 }, { 0, 384, 4404 }, { 6803, 1084, -1 },
+    { 5795, 535, -1 }, { 6844, 1084, -1 }, { 0, 385, 4417 }, { 6816, 1084, -1 }, { 6847, 1084, -1 }, { 0, 535, 7090 },
+    { 5014, 395, -1 }, { 0, 535, 7091 }, { 5013, 395, 4559 }, { 0, 384, 4405 }, { 7111, 633, -1 }, { 0, 384, 4406 },
+    { 0, 384, 4407 }, { 5798, 535, -1 }, { 0, 384, 4408 }, { 4942, 384, -1 }, { 7142, 1246, -1 }, { 0, 395, 4561 },
+    { 5796, 535, -1 }, { 7147, 1246, -1 }, { 4973, 389, -1 }, { 7169, 639, -1 }, { 4975, 389, -1 }, { 7115, 644, -1 },
+    { 0, 385, 4418 }, { 7147, 815, -1 }, { 0, 385, 4419 }, { 0, 385, 4420 }, { 7150, 815, -1 }, { 0, 389, 4483 },
+    { 4976, 389, 4484 }, { 4978, 389, 4488 }, { 4975, 389, -1 }, { 0, 394, 4538 }, { 5006, 394, 4539 }, { 4949, 385, 4421 },
+    { 0, 389, 4491 }, { 4976, 389, 4492 }, { 4981, 389, 4495 }, { 7128, 654, -1 }, { 7134, 214, -1 }, { 4979, 389, -1 },
+    { 5027, 399, -1 }, { 5028, 399, -1 }, { 0, 455, 5436 }, { 0, 455, 5437 }, { 0, 455, 5438 }, { 0, 399, 4583 },
+    { 6548, 903, -1 }, { 6576, 903, -1 }, { 6571, 903, -1 }, { 5367, 455, 5439 }, { 6529, 903, -1 }, { 5005, 394, -1 },
+    { 7123, 212, -1 }, { 0, 394, 4544 }, { 0, 394, 4545 }, { 7151, 212, -1 }, { 5028, 399, -1 }, { 0, 394, 4546 },
+    { 0, 399, 4585 }, { 6661, 1004, -1 }, { 6709, 1004, -1 }, { 6712, 1004, -1 }, { 4983, 389, -1 }, { 7175, 217, -1 },
+    { 4984, 389, -1 }, { 7176, 220, -1 }, { 0, 399, 4586 }, { 0, 399, 4587 }, { 4986, 389, -1 }, { 5035, 401, -1 },
+    { 5037, 401, -1 }, { 7181, 223, -1 }, { 5037, 401, 4607 }, { 7134, 1293, -1 }, { 7194, 1308, -1 }, { 0, 401, 4610 },
+    { 6039, 142, -1 }, { 6039, 142, -1 }, { 6093, 142, -1 }, { 5010, 394, -1 }, { 5039, 401, -1 }, { 6094, 142, -1 },
+    { 5041, 401, 4613 }, { 5007, 394, -1 }, { 5058, 404, 4652 }, { 7241, 1343, -1 }, { 5042, 401, -1 }, { 5039, 401, -1 },
+    { 7045, 1206, -1 }, { 0, 394, 4549 }, { 5009, 394, 4550 }, { 7037, 1206, -1 }, { 7002, 1206, -1 }, { 0, 394, 4552 },
+    { 0, 404, 4654 }, { 0, 455, 5441 }, { 7247, 1344, -1 }, { 0, 455, 5442 }, { 0, 404, 4655 }, { 5063, 404, -1 },
+    { 5087, 408, 4700 }, { 6645, 986, -1 }, { 6693, 986, -1 }, { 6693, 986, -1 }, { 5067, 404, -1 }, { 5045, 401, -1 },
+    { 6686, 986, -1 }, { 5046, 401, -1 }, { 5270, 436, 5197 }, { 0, 404, 4659 }, { 5065, 404, 4660 }, { 6668, 1006, -1 },
+    { 6700, 1006, -1 }, { 6675, 1006, -1 }, { 0, 436, 5201 }, { 7279, 1315, -1 }, { 5047, 401, 4622 }, { 5046, 401, 4627 },
+    { 0, 404, 4663 }, { 0, 404, 4664 }, { 7292, 1319, -1 }, { 6739, 1059, -1 }, { 6767, 1059, -1 }, { 5083, 408, -1 },
+    { 5265, 436, -1 }, { 6774, 1059, -1 }, { 0, 404, 4665 }, { 7075, 1247, -1 }, { 7118, 1247, -1 }, { 0, 436, 5203 },
+    { 0, 401, 4629 }, { 5094, 412, -1 }, { 7095, 1247, -1 }, { 5090, 408, -1 }, { 0, 436, 5204 }, { 7133, 1301, -1 },
+    { 7182, 1301, -1 }, { 7143, 1301, -1 }, { 0, 408, 4709 }, { 0, 408, 4710 }, { 0, 408, 4711 }, { 0, 408, 4712 },
+    { 0, 408, 4713 }, { 0, 408, 4714 }, { 0, 436, 5205 }, { 5097, 412, -1 }, { 7149, 1312, -1 }, { 7234, 1312, -1 },
+    { 7108, 826, -1 }, { 5087, 408, -1 }, { 0, 412, 4732 }, { 0, 412, 4733 }, { 7158, 826, -1 }, { 7274, 1326, -1 },
+    { 7245, 1355, -1 }, { 5274, 436, -1 }, { 6081, 594, -1 }, { 6124, 594, -1 }, { 0, 412, 4734 }, { 6080, 594, -1 },
+    { 6118, 594, -1 }, { 6137, 594, -1 }, { 5267, 436, -1 }, { 6222, 159, -1 }, { 5097, 412, 4735 }, { 6234, 159, -1 },
+    { 6274, 159, -1 }, { 6280, 159, -1 }, { 0, 412, 4737 }, { 7246, 1356, -1 }, { 0, 420, 4796 }, { 5124, 420, 4797 },
+    { 5125, 420, 4801 }, { 0, 420, 4806 }, { 5130, 420, 4807 }, { 0, 420, 4811 }, { 0, 420, 4812 }, { 0, 420, 4813 },
+    { 0, 420, 4814 }, { 0, 420, 4815 }, { 5121, 420, 4816 }, { 0, 420, 4819 }, { 0, 420, 4820 }, { 0, 420, 4821 },
+    { 5100, 412, -1 }, { 5125, 420, 4822 }, { 0, 420, 4824 }, { 0, 420, 4825 }, { 5129, 420, 4826 }, { 5134, 420, 4828 },
+    { 7305, 1333, -1 }, { 5134, 420, 4830 }, { 0, 420, 4832 }, { 0, 420, 4833 }, { 5135, 420, 4834 }, { 0, 420, 4836 },
+    { 0, 420, 4837 }, { 7270, 1360, -1 }, { 7304, 1360, -1 }, { 0, 420, 4838 }, { 0, 420, 4839 }, { 5137, 420, 4840 },
+    { 0, 421, 4842 }, { 0, 421, 4843 }, { 0, 421, 4844 }, { 0, 421, 4845 }, { 5134, 421, 4846 }, { 0, 421, 4848 },
+    { 5140, 421, 4849 }, { 0, 421, 4854 }, { 0, 421, 4855 }, { 0, 421, 4856 }, { 0, 421, 4857 }, { 0, 421, 4858 },
+    { 0, 421, 4859 }, { 0, 421, 4860 }, { 0, 421, 4861 }, { 5140, 421, 4862 }, { 0, 421, 4865 }, { 5143, 421, 4866 },
+    { 0, 421, 4868 }, { 5146, 421, 4869 }, { 7273, 1349, -1 }, { 5147, 421, 4875 }, { 7315, 681, -1 }, { 0, 421, 4877 },
+    { 5149, 421, 4878 }, { 0, 421, 4880 }, { 0, 421, 4881 }, { 0, 421, 4882 }, { 5147, 421, 4883 }, { 0, 421, 4885 },
+    { 5151, 421, 4886 }, { 0, 421, 4888 }, { 0, 421, 4889 }, { 0, 421, 4890 }, { 0, 421, 4891 }, { 0, 421, 4892 },
+    { 7296, 1347, -1 }, { 5151, 421, 4893 }, { 0, 421, 4895 }, { 0, 421, 4896 }, { 0, 421, 4897 }, { 0, 421, 4898 },
+    { 5154, 421, 4899 }, { 0, 421, 4901 }, { 7273, 485, -1 }, { 0, 421, 4902 }, { 0, 421, 4903 }, { 0, 421, 4904 },
+    { 0, 421, 4905 }, { 0, 421, 4906 }, { 0, 421, 4907 }, { 0, 421, 4908 }, { 5152, 421, 4909 }, { 0, 421, 4912 },
+    { 0, 421, 4913 }, { 5154, 421, 4914 }, { 0, 421, 4916 }, { 7327, 536, -1 }, { 0, 421, 4917 }, { 0, 421, 4918 },
+    { 5156, 421, 4919 }, { 0, 421, 4921 }, { 5157, 421, 4922 }, { 5158, 421, 4924 }, { 0, 422, 4926 }, { 0, 422, 4927 },
+    { 0, 422, 4928 }, { 0, 422, 4929 }, { 0, 422, 4930 }, { 0, 422, 4931 }, { 0, 422, 4932 }, { 0, 422, 4933 },
+    { 0, 422, 4934 }, { 5159, 422, 4935 }, { 7296, 565, -1 }, { 0, 422, 4937 }, { 0, 422, 4938 }, { 0, 422, 4939 },
+    { 0, 422, 4940 }, { 0, 422, 4941 }, { 7286, 698, -1 }, { 0, 422, 4942 }, { 0, 422, 4943 }, { 5160, 422, 4944 },
+    { 0, 422, 4947 }, { 0, 422, 4948 }, { 5162, 422, 4949 }, { 0, 422, 4955 }, { 0, 422, 4956 }, { 0, 422, 4957 },
+    { 0, 422, 4958 }, { 0, 422, 4959 }, { 5160, 422, 4960 }, { 5165, 422, 4962 }, { 7286, 711, -1 }, { 0, 422, 4965 },
+    { 5166, 422, 4966 }, { 0, 422, 4968 }, { 0, 422, 4969 }, { 0, 422, 4970 }, { 0, 422, 4971 }, { 0, 422, 4972 },
+    { 0, 422, 4973 }, { 0, 422, 4974 }, { 0, 422, 4975 }, { 5169, 422, 4976 }, { 0, 422, 4979 }, { 0, 422, 4980 },
+    { 0, 422, 4981 }, { 0, 422, 4982 }, { 0, 422, 4983 }, { 0, 422, 4984 }, { 0, 422, 4985 }, { 0, 422, 4986 },
+    { 0, 422, 4987 }, { 0, 422, 4988 }, { 0, 422, 4989 }, { 0, 422, 4990 }, { 0, 423, 4991 }, { 7251, 1338, -1 },
+    { 5186, 426, -1 }, { 7283, 741, -1 }, { 5189, 426, -1 }, { 7260, 1338, -1 }, { 6087, 596, -1 }, { 6144, 596, -1 },
+    { 6145, 596, -1 }, { 0, 427, 5041 }, { 6163, 596, -1 }, { 6201, 596, -1 }, { 7341, 747, -1 }, { 7190, 1314, -1 },
+    { 5189, 426, -1 }, { 5172, 423, 4992 }, { 7200, 1314, -1 }, { 5194, 427, -1 }, { 0, 427, 5043 }, { 0, 427, 5044 },
+    { 0, 427, 5045 }, { 5164, 423, 4998 }, { 5188, 426, -1 }, { 7347, 755, -1 }, { 0, 423, 5002 }, { 6566, 919, -1 },
+    { 6625, 919, -1 }, { 5194, 427, 5046 }, { 7329, 756, -1 }, { 6623, 919, -1 }, { 6600, 919, -1 }, { 5193, 427, -1 },
+    { 0, 423, 5003 }, { 5195, 427, -1 }, { 7288, 1329, -1 }, { 0, 428, 5052 }, { 5231, 431, 5122 }, { 7282, 1329, -1 },
+    { 5234, 431, 5124 }, { 7320, 1383, -1 }, { 0, 426, 5036 }, { 5200, 428, -1 }, { 5236, 431, -1 }, { 5234, 431, -1 },
+    { 5172, 423, -1 }, { 7317, 1385, -1 }, { 7354, 1387, -1 }, { 5235, 431, -1 }, { 0, 427, 5050 }, { 0, 427, 5051 },
+    { 0, 423, 5005 }, { 7353, 1399, -1 }, { 5194, 426, -1 }, { 7303, 754, -1 }, { 7319, 754, -1 }, { 5194, 426, -1 },
+    { 7349, 754, -1 }, { 0, 426, 5039 }, { 5199, 428, -1 }, { 7357, 1400, -1 }, { 0, 426, 5040 }, { 5202, 428, -1 },
+    { 7259, 1327, -1 }, { 7196, 1327, -1 }, { 5204, 428, 5062 }, { 5207, 428, -1 }, { 7226, 1327, -1 }, { 7365, 1402, -1 },
+    { 0, 428, 5065 }, { 0, 429, 5073 }, { 0, 429, 5074 }, { 0, 431, 5130 }, { 5209, 429, -1 }, { 0, 533, 7072 },
+    { 5235, 431, -1 }, { 0, 429, 5077 }, { 7329, 1411, -1 }, { 7325, 1414, -1 }, { 0, 428, 5066 }, { 0, 533, 7073 },
+    { 0, 533, 7074 }, { 5214, 429, -1 }, { 7331, 1418, -1 }, { 5215, 429, -1 }, { 5205, 428, 5067 }, { 0, 431, 5132 },
+    { 0, 431, 5133 }, { 0, 431, 5134 }, { 5240, 431, 5135 }, { 7317, 769, -1 }, { 5207, 428, -1 }, { 7377, 1419, -1 },
+    { 5785, 533, -1 }, { 7358, 769, -1 }, { 5208, 428, 5070 }, { 0, 428, 5072 }, { 7330, 1428, -1 }, { 5212, 429, 5080 },
+    { 7376, 1433, -1 }, { 5223, 430, 5100 }, { 5223, 430, -1 }, { 5787, 533, -1 }, { 5217, 429, -1 }, { 0, 430, 5103 },
+    { 7386, 1421, -1 }, { 5225, 430, 5104 }, { 0, 430, 5108 }, { 5226, 430, 5109 }, { 0, 429, 5091 }, { 0, 430, 5111 },
+    { 0, 430, 5112 }, { 0, 429, 5092 }, { 0, 429, 5093 }, { 5785, 533, -1 }, { 7360, 1405, -1 }, { 5787, 533, -1 },
+    { 5226, 430, 5113 }, { 5216, 429, -1 }, { 7368, 1405, -1 }, { 7206, 1328, -1 }, { 7240, 1328, -1 }, { 5249, 434, -1 },
+    { 5388, 461, -1 }, { 5220, 429, 5095 }, { 7239, 1328, -1 }, { 0, 434, 5155 }, { 5389, 461, 5489 }, { 0, 461, 5491 },
+    { 5790, 533, -1 }, { 7389, 1423, -1 }, { 5222, 429, -1 }, { 5253, 434, -1 }, { 5255, 434, -1 }, { 6096, 599, -1 },
+    { 6166, 599, -1 }, { 6098, 599, -1 }, { 6111, 599, -1 }, { 5259, 434, -1 }, { 6150, 599, -1 }, { 5229, 430, 5115 },
+    { 7338, 1429, -1 }, { 6896, 1106, -1 }, { 6908, 1106, -1 }, { 6904, 1106, -1 }, { 0, 430, 5118 }, { 6932, 1106, -1 },
+    { 0, 430, 5119 }, { 7368, 1435, -1 }, { 5227, 430, -1 }, { 5260, 434, -1 }, { 7363, 1436, -1 }, { 7329, 1437, -1 },
+    { 5228, 430, -1 }, { 7365, 1437, -1 }, { 0, 434, 5182 }, { 0, 461, 5492 }, { 0, 461, 5493 }, { 0, 461, 5494 },
+    { 0, 461, 5495 }, { 0, 437, 5214 }, { 6797, 1083, -1 }, { 5260, 434, -1 }, { 6850, 1083, -1 }, { 6853, 1083, -1 },
+    { 6855, 1083, -1 }, { 0, 437, 5215 }, { 0, 437, 5216 }, { 5262, 434, 5185 }, { 0, 434, 5187 }, { 0, 437, 5217 },
+    { 0, 437, 5218 }, { 5279, 437, 5219 }, { 0, 437, 5223 }, { 5280, 437, 5224 }, { 7358, 1450, -1 }, { 5271, 437, -1 },
+    { 5263, 434, -1 }, { 7333, 1430, -1 }, { 0, 434, 5190 }, { 5322, 442, 5325 }, { 5288, 438, -1 }, { 5294, 438, -1 },
+    { 7380, 1430, -1 }, { 5300, 438, -1 }, { 0, 460, 5470 }, { 0, 460, 5471 }, { 0, 442, 5328 }, { 5326, 442, 5329 },
+    { 5327, 442, 5331 }, { 5328, 442, 5333 }, { 0, 442, 5335 }, { 5382, 460, -1 }, { 5300, 438, 5253 }, { 0, 438, 5255 },
+    { 7396, 1463, -1 }, { 0, 438, 5256 }, { 5285, 437, -1 }, { 5286, 437, 5231 }, { 0, 438, 5257 }, { 0, 438, 5258 },
+    { 7232, 1311, -1 }, { 7283, 1311, -1 }, { 5380, 460, -1 }, { 7389, 1473, -1 }, { 7234, 1311, -1 }, { 7338, 1424, -1 },
+    { 7391, 1424, -1 }, { 5281, 437, -1 }, { 0, 460, 5476 }, { 0, 439, 5262 }, { 7392, 1475, -1 }, { 5329, 442, -1 },
+    { 5303, 439, -1 }, { 7355, 1477, -1 }, { 7319, 1406, -1 }, { 5290, 437, -1 }, { 7326, 1406, -1 }, { 0, 438, 5259 },
+    { 7337, 1406, -1 }, { 5300, 439, 5265 }, { 7384, 1480, -1 }, { 7358, 1465, -1 }, { 7389, 1468, -1 }, { 5387, 460, -1 },
+    { 0, 440, 5305 }, { 0, 460, 5486 }, { 7386, 1465, -1 }, { 7414, 1481, -1 }, { 7416, 1484, -1 }, { 0, 439, 5267 },
+    { 0, 439, 5268 }, { 0, 439, 5269 }, { 5302, 438, -1 }, { 5301, 439, 5270 }, { 0, 439, 5272 }, { 0, 439, 5273 },
+    { 5308, 439, 5274 }, { 7410, 1500, -1 }, { 0, 439, 5289 }, { 0, 439, 5290 }, { 0, 439, 5291 }, { 5310, 439, 5292 },
+    { 5309, 439, 5294 }, { 0, 439, 5296 }, { 0, 439, 5297 }, { 0, 439, 5298 }, { 0, 439, 5299 }, { 5313, 440, -1 },
+    { 0, 439, 5300 }, { 7437, 1515, -1 }, { 5312, 439, 5301 }, { 6176, 642, -1 }, { 6230, 642, -1 }, { 6206, 642, -1 },
+    { 6179, 642, -1 }, { 6198, 642, -1 }, { 5343, 445, -1 }, { 7414, 1518, -1 }, { 5312, 439, -1 }, { 7411, 1513, -1 },
+    { 7417, 1513, -1 }, { 5317, 440, -1 }, { 5340, 445, -1 }, { 6485, 853, -1 }, { 6524, 853, -1 }, { 6496, 853, -1 },
+    { 6490, 853, -1 }, { 6497, 853, -1 }, { 0, 440, 5308 }, { 0, 440, 5309 }, { 0, 440, 5310 }, { 0, 440, 5311 },
+    { 7456, 1505, -1 }, { 0, 440, 5312 }, { 5319, 440, 5313 }, { 0, 440, 5315 }, { 0, 440, 5316 }, { 0, 440, 5317 },
+    { 7408, 1547, -1 }, { 0, 440, 5318 }, { 5317, 440, -1 }, { 5344, 445, 5368 }, { 7409, 1553, -1 }, { 0, 445, 5370 },
+    { 0, 445, 5371 }, { 5354, 451, -1 }, { 0, 451, 5399 }, { 0, 445, 5372 }, { 0, 451, 5400 }, { 0, 445, 5373 },
+    { 0, 445, 5374 }, { 5559, 491, -1 }, { 7253, 1365, -1 }, { 7303, 1365, -1 }, { 7289, 1365, -1 }, { 7271, 1365, -1 },
+    { 5348, 445, -1 }, { 5357, 451, 5401 }, { 5363, 453, -1 }, { 7435, 775, -1 }, { 7410, 1555, -1 }, { 0, 453, 5418 },
+    { 5362, 453, -1 }, { 5561, 491, -1 }, { 7403, 1555, -1 }, { 0, 453, 5420 }, { 5365, 453, 5421 }, { 5566, 491, 6099 },
+    { 6199, 687, -1 }, { 6215, 687, -1 }, { 6234, 687, -1 }, { 5372, 459, -1 }, { 6196, 687, -1 }, { 6267, 687, -1 },
+    { 0, 451, 5403 }, { 7428, 150, -1 }, { 5368, 459, 5444 }, { 5356, 451, 5404 }, { 7052, 1231, -1 }, { 7113, 1231, -1 },
+    { 7093, 1231, -1 }, { 0, 491, 6103 }, { 7077, 1231, -1 }, { 5374, 459, -1 }, { 5565, 491, -1 }, { 6484, 855, -1 },
+    { 6544, 855, -1 }, { 6538, 855, -1 }, { 6537, 855, -1 }, { 6482, 855, -1 }, { 5568, 491, -1 }, { 0, 459, 5450 },
+    { 0, 451, 5406 }, { 5356, 451, 5407 }, { 0, 451, 5409 }, { 7409, 1496, -1 }, { 7405, 1371, -1 }, { 5366, 453, 5423 },
+    { 7437, 1496, -1 }, { 0, 453, 5425 }, { 0, 453, 5426 }, { 0, 453, 5427 }, { 0, 453, 5428 }, { 0, 453, 5429 },
+    { 5371, 459, -1 }, { 6899, 1117, -1 }, { 6971, 1117, -1 }, { 6913, 1117, -1 }, { 5375, 459, 5452 }, { 6961, 1117, -1 },
+    { 6949, 1117, -1 }, { 5377, 459, -1 }, { 7461, 1372, -1 }, { 7439, 1532, -1 }, { 7454, 1373, -1 }, { 5378, 459, 5467 },
+    { 7443, 1532, -1 }, { 0, 459, 5469 }, { 5395, 465, 5509 }, { 5394, 465, 5513 }, { 7461, 1374, -1 }, { 5397, 465, 5515 },
+    { 0, 465, 5517 }, { 0, 465, 5518 }, { 0, 465, 5519 }, { 0, 465, 5520 }, { 0, 465, 5521 }, { 0, 465, 5522 },
+    { 0, 465, 5523 }, { 0, 465, 5524 }, { 7466, 1389, -1 }, { 0, 465, 5525 }, { 0, 465, 5526 }, { 0, 465, 5527 },
+    { 0, 465, 5528 }, { 5400, 465, -1 }, { 5941, 570, -1 }, { 6014, 570, -1 }, { 6032, 570, -1 }, { 5986, 570, -1 },
+    { 6006, 570, -1 }, { 6020, 570, -1 }, { 7467, 1551, -1 }, { 5401, 465, -1 }, { 7427, 1552, -1 }, { 5728, 521, 6841 },
+    { 0, 521, 6843 }, { 0, 465, 5533 }, { 5729, 521, 6844 }, { 0, 521, 6847 }, { 0, 521, 6848 }, { 0, 521, 6849 },
+    { 5404, 465, -1 }, { 7437, 1367, -1 }, { 7409, 1367, -1 }, { 5401, 465, 5537 }, { 7422, 1386, -1 }, { 7464, 1557, -1 },
+    { 5731, 521, -1 }, { 7471, 1386, -1 }, { 0, 521, 6853 }, { 5732, 521, -1 }, { 7417, 1561, -1 }, { 7462, 1578, -1 },
+    { 0, 465, 5539 }, { 5415, 472, 5548 }, { 5410, 472, 5551 }, { 0, 472, 5553 }, { 5413, 472, 5554 }, { 0, 472, 5556 },
+    { 0, 472, 5557 }, { 0, 472, 5558 }, { 0, 472, 5559 }, { 0, 472, 5560 }, { 0, 472, 5561 }, { 0, 472, 5562 },
+    { 7468, 1594, -1 }, { 0, 472, 5563 }, { 0, 472, 5564 }, { 0, 472, 5565 }, { 0, 472, 5566 }, { 7455, 1394, -1 },
+    { 0, 472, 5567 }, { 0, 472, 5568 }, { 0, 472, 5569 }, { 0, 472, 5570 }, { 0, 472, 5571 }, { 0, 472, 5572 },
+    { 5416, 472, 5573 }, { 0, 472, 5575 }, { 5417, 472, 5576 }, { 7481, 1440, -1 }, { 0, 472, 5578 }, { 0, 472, 5579 },
+    { 0, 472, 5580 }, { 0, 472, 5581 }, { 0, 473, 5582 }, { 5416, 473, 5583 }, { 0, 473, 5585 }, { 0, 473, 5586 },
+    { 5419, 473, 5587 }, { 0, 473, 5591 }, { 0, 473, 5592 }, { 7500, 1593, -1 }, { 0, 473, 5593 }, { 0, 473, 5594 },
+    { 0, 473, 5595 }, { 0, 473, 5596 }, { 0, 473, 5597 }, { 5425, 473, 5598 }, { 0, 473, 5602 }, { 0, 473, 5603 },
+    { 7454, 1597, -1 }, { 5421, 473, 5604 }, { 0, 473, 5608 }, { 0, 473, 5609 }, { 5424, 473, 5610 }, { 5428, 473, 5612 },
+    { 0, 473, 5614 }, { 5430, 473, 5615 }, { 0, 473, 5620 }, { 0, 473, 5621 }, { 5430, 473, 5622 }, { 0, 473, 5625 },
+    { 0, 473, 5626 }, { 5428, 473, 5627 }, { 0, 473, 5629 }, { 0, 473, 5630 }, { 0, 473, 5631 }, { 0, 473, 5632 },
+    { 0, 473, 5633 }, { 0, 473, 5634 }, { 0, 473, 5635 }, { 5431, 473, 5636 }, { 5436, 473, 5638 }, { 0, 473, 5641 },
+    { 0, 473, 5642 }, { 0, 473, 5643 }, { 7529, 1610, -1 }, { 0, 473, 5644 }, { 5435, 473, 5645 }, { 5440, 473, 5647 },
+    { 0, 473, 5653 }, { 0, 473, 5654 }, { 0, 473, 5655 }, { 5440, 473, 5656 }, { 0, 473, 5658 }, { 0, 473, 5659 },
+    { 5443, 473, 5660 }, { 0, 473, 5662 }, { 0, 473, 5663 }, { 5445, 473, 5664 }, { 5444, 473, 5667 }, { 0, 473, 5669 },
+    { 0, 473, 5670 }, { 0, 473, 5671 }, { 0, 473, 5672 }, { 0, 473, 5673 }, { 5448, 473, 5674 }, { 0, 473, 5677 },
+    { 0, 474, 5678 }, { 5449, 474, 5679 }, { 0, 474, 5681 }, { 5450, 474, 5682 }, { 0, 474, 5687 }, { 0, 474, 5688 },
+    { 0, 474, 5689 }, { 0, 474, 5690 }, { 5451, 474, 5691 }, { 7537, 1612, -1 }, { 0, 474, 5693 }, { 5452, 474, 5694 },
+    { 0, 474, 5696 }, { 0, 474, 5697 }, { 0, 474, 5698 }, { 0, 474, 5699 }, { 0, 474, 5700 }, { 0, 474, 5701 },
+    { 0, 474, 5702 }, { 0, 474, 5703 }, { 0, 474, 5704 }, { 0, 474, 5705 }, { 0, 474, 5706 }, { 0, 474, 5707 },
+    { 0, 474, 5708 }, { 0, 474, 5709 }, { 0, 474, 5710 }, { 0, 474, 5711 }, { 0, 474, 5712 }, { 0, 474, 5713 },
+    { 7488, 1615, -1 }, { 0, 474, 5714 }, { 0, 474, 5715 }, { 0, 474, 5716 }, { 5455, 474, 5717 }, { 0, 474, 5720 },
+    { 0, 474, 5721 }, { 0, 474, 5722 }, { 0, 474, 5723 }, { 0, 474, 5724 }, { 5456, 474, 5725 }, { 0, 474, 5727 },
+    { 0, 474, 5728 }, { 0, 474, 5729 }, { 5455, 474, 5730 }, { 0, 474, 5733 }, { 0, 474, 5734 }, { 0, 474, 5735 },
+    { 0, 474, 5736 }, { 0, 474, 5737 }, { 0, 474, 5738 }, { 0, 474, 5739 }, { 0, 474, 5740 }, { 0, 474, 5741 },
+    { 0, 474, 5742 }, { 5461, 474, -1 }, { 0, 478, 5774 }, { 0, 478, 5775 }, { 0, 478, 5776 }, { 7531, 1618, -1 },
+    { 0, 478, 5777 }, { 0, 478, 5778 }, { 0, 478, 5779 }, { 5468, 478, 5780 }, { 0, 478, 5782 }, { 0, 478, 5783 },
+    { 0, 478, 5784 }, { 5469, 478, 5785 }, { 0, 478, 5788 }, { 5470, 478, 5789 }, { 0, 478, 5791 }, { 0, 478, 5792 },
+    { 5473, 478, 5793 }, { 0, 478, 5796 }, { 0, 478, 5797 }, { 0, 478, 5798 }, { 0, 478, 5799 }, { 0, 478, 5800 },
+    { 0, 478, 5801 }, { 0, 478, 5802 }, { 5475, 478, 5803 }, { 0, 478, 5807 }, { 0, 478, 5808 }, { 0, 478, 5809 },
+    { 5474, 478, 5810 }, { 0, 478, 5812 }, { 5474, 478, 5813 }, { 0, 478, 5815 }, { 0, 478, 5816 }, { 5478, 478, 5817 },
+    { 0, 478, 5819 }, { 0, 479, 5820 }, { 0, 479, 5821 }, { 0, 479, 5822 }, { 0, 479, 5823 }, { 0, 479, 5824 },
+    { 0, 479, 5825 }, { 0, 479, 5826 }, { 0, 479, 5827 }, { 5475, 479, 5828 }, { 0, 479, 5830 }, { 0, 479, 5831 },
+    { 5477, 479, 5832 }, { 5481, 479, 5834 }, { 0, 479, 5838 }, { 0, 479, 5839 }, { 5480, 479, 5840 }, { 0, 479, 5842 },
+    { 0, 481, 5891 }, { 0, 481, 5892 }, { 0, 479, 5843 }, { 0, 479, 5844 }, { 0, 479, 5845 }, { 0, 479, 5846 },
+    { 7537, 1626, -1 }, { 0, 479, 5847 }, { 0, 479, 5848 }, { 0, 479, 5849 }, { 0, 479, 5850 }, { 0, 479, 5851 },
+    { 0, 479, 5852 }, { 5485, 479, 5853 }, { 7542, 557, -1 }, { 0, 479, 5870 }, { 0, 479, 5871 }, { 5491, 479, 5872 },
+    { 0, 479, 5874 }, { 5490, 479, -1 }, { 6288, 165, -1 }, { 6236, 165, -1 }, { 6297, 165, -1 }, { 6320, 165, -1 },
+    { 6357, 165, -1 }, { 6374, 165, -1 }, { 6407, 165, -1 }, { 0, 481, 5893 }, { 6288, 679, -1 }, { 6341, 679, -1 },
+    { 6353, 679, -1 }, { 6338, 679, -1 }, { 6295, 679, -1 }, { 6341, 679, -1 }, { 7418, 1587, -1 }, { 7465, 1587, -1 },
+    { 5493, 479, 5877 }, { 5495, 479, 5881 }, { 5496, 479, -1 }, { 6702, 1034, -1 }, { 6801, 1034, -1 }, { 6800, 1034, -1 },
+    { 6776, 1034, -1 }, { 6711, 1034, -1 }, { 5501, 481, -1 }, { 7401, 1534, -1 }, { 7420, 1534, -1 }, { 7390, 1534, -1 },
+    { 5501, 481, -1 }, { 7449, 1534, -1 }, { 0, 481, 5898 }, { 7501, 1591, -1 }, { 0, 481, 5899 }, { 0, 481, 5900 },
+    { 0, 481, 5901 }, { 7502, 1591, -1 }, { 0, 481, 5902 }, { 5511, 487, 5921 }, { 0, 487, 5926 }, { 5509, 487, 5927 },
+    { 5511, 487, 5929 }, { 7512, 561, -1 }, { 0, 487, 5931 }, { 5516, 487, 5932 }, { 0, 487, 5936 }, { 5518, 487, 5937 },
+    { 0, 487, 5940 }, { 0, 487, 5941 }, { 7557, 1545, -1 }, { 0, 487, 5942 }, { 0, 487, 5943 }, { 0, 487, 5944 },
+    { 0, 487, 5945 }, { 0, 487, 5946 }, { 7570, 1566, -1 }, { 0, 487, 5947 }, { 0, 487, 5948 }, { 0, 487, 5949 },
+    { 5518, 487, 5950 }, { 0, 487, 5953 }, { 0, 487, 5954 }, { 0, 487, 5955 }, { 0, 487, 5956 }, { 0, 488, 5957 },
+    { 0, 488, 5958 }, { 0, 488, 5959 }, { 0, 488, 5960 }, { 0, 488, 5961 }, { 0, 488, 5962 }, { 0, 488, 5963 },
+    { 0, 488, 5964 }, { 0, 488, 5965 }, { 0, 488, 5966 }, { 0, 488, 5967 }, { 7602, 1600, -1 }, { 0, 488, 5968 },
+    { 0, 488, 5969 }, { 0, 488, 5970 }, { 0, 488, 5971 }, { 0, 488, 5972 }, { 7635, 1432, -1 }, { 0, 488, 5973 },
+    { 0, 488, 5974 }, { 0, 488, 5975 }, { 0, 488, 5976 }, { 0, 488, 5977 }, { 0, 488, 5978 }, { 0, 488, 5979 },
+    { 0, 488, 5980 }, { 5822, 549, 7244 }, { 7605, 1434, -1 }, { 7374, 1485, -1 }, { 5519, 488, 5981 }, { 5522, 488, -1 },
+    { 0, 549, 7258 }, { 7383, 1485, -1 }, { 7431, 1485, -1 }, { 5519, 488, -1 }, { 7503, 1445, -1 }, { 5818, 549, -1 },
+    { 7507, 1607, -1 }, { 7436, 1445, -1 }, { 5827, 549, -1 }, { 5526, 488, 5998 }, { 7507, 1607, -1 }, { 5528, 488, 6000 },
+    { 0, 489, 6007 }, { 5531, 489, -1 }, { 7439, 1452, -1 }, { 7484, 1452, -1 }, { 5528, 488, -1 }, { 7495, 1452, -1 },
+    { 5531, 489, 6009 }, { 0, 489, 6011 }, { 6895, 1090, -1 }, { 6876, 1090, -1 }, { 6858, 1090, -1 }, { 6858, 1090, -1 },
+    { 6880, 1090, -1 }, { 0, 488, 6003 }, { 7601, 1447, -1 }, { 0, 489, 6012 }, { 5532, 489, -1 }, { 5529, 488, 6004 },
+    { 0, 488, 6006 }, { 5533, 489, -1 }, { 0, 549, 7264 }, { 0, 549, 7265 }, { 7588, 1462, -1 }, { 5535, 489, 6015 },
+    { 5537, 489, 6018 }, { 7594, 1624, -1 }, { 5543, 489, 6051 }, { 5537, 489, 6054 }, { 0, 489, 6056 }, { 5545, 489, 6057 },
+    { 0, 489, 6062 }, { 7567, 1563, -1 }, { 7561, 1563, -1 }, { 5551, 490, -1 }, { 7576, 1542, -1 }, { 0, 490, 6070 },
+    { 5538, 489, -1 }, { 7501, 1542, -1 }, { 7557, 1542, -1 }, { 5547, 490, -1 }, { 0, 489, 6064 }, { 0, 549, 7266 },
+    { 5551, 490, 6074 }, { 0, 490, 6080 }, { 5553, 490, -1 }, { 7562, 1599, -1 }, { 5550, 490, -1 }, { 7593, 1599, -1 },
+    { 5552, 490, -1 }, { 7629, 1630, -1 }, { 0, 489, 6065 }, { 5556, 490, 6084 }, { 7595, 1635, -1 }, { 5568, 492, -1 },
+    { 5543, 489, -1 }, { 7645, 1637, -1 }, { 0, 489, 6067 }, { 7430, 1441, -1 }, { 7476, 1441, -1 }, { 5557, 490, -1 },
+    { 5548, 489, -1 }, { 7443, 1441, -1 }, { 7485, 1441, -1 }, { 5558, 490, -1 }, { 5566, 492, -1 }, { 5555, 490, -1 },
+    { 7358, 1479, -1 }, { 7403, 1479, -1 }, { 7396, 1479, -1 }, { 7371, 1479, -1 }, { 5755, 525, 6929 }, { 0, 490, 6093 },
+    { 0, 492, 6108 }, { 0, 525, 6940 }, { 0, 525, 6941 }, { 0, 525, 6942 }, { 7650, 1642, -1 }, { 0, 525, 6943 },
+    { 7545, 1579, -1 }, { 7540, 1579, -1 }, { 5760, 525, 6944 }, { 0, 525, 6949 }, { 0, 492, 6109 }, { 7546, 1574, -1 },
+    { 7577, 1574, -1 }, { 7575, 1574, -1 }, { 5765, 525, 6950 }, { 5766, 525, -1 }, { 5571, 492, -1 }, { 7548, 1431, -1 },
+    { 7554, 1431, -1 }, { 5577, 493, -1 }, { 0, 490, 6094 }, { 5560, 490, -1 }, { 7640, 1631, -1 }, { 5558, 490, -1 },
+    { 0, 525, 6956 }, { 0, 492, 6117 }, { 7735, 1649, -1 }, { 0, 492, 6118 }, { 5571, 493, -1 }, { 7579, 1627, -1 },
+    { 7641, 1627, -1 }, { 7608, 1627, -1 }, { 7685, 1651, -1 }, { 0, 493, 6164 }, { 0, 493, 6165 }, { 5573, 493, 6166 },
+    { 7636, 1658, -1 }, { 0, 493, 6168 }, { 0, 492, 6119 }, { 0, 492, 6120 }, { 0, 492, 6121 }, { 7696, 1665, -1 },
+    { 5570, 493, -1 }, { 0, 550, 7267 }, { 5584, 495, -1 }, { 0, 550, 7268 }, { 7595, 1652, -1 }, { 7654, 1652, -1 },
+    { 7642, 1652, -1 }, { 5585, 495, -1 }, { 7376, 1520, -1 }, { 5828, 550, -1 }, { 7388, 1520, -1 }, { 7379, 1520, -1 },
+    { 7372, 1520, -1 }, { 0, 550, 7271 }, { 0, 493, 6170 }, { 0, 493, 6171 }, { 5579, 493, -1 }, { 7700, 1669, -1 },
+    { 0, 495, 6182 }, { 7033, 1210, -1 }, { 7083, 1210, -1 }, { 7083, 1210, -1 }, { 5818, 550, -1 }, { 7085, 1210, -1 },
+    { 7066, 1210, -1 }, { 7701, 1671, -1 }, { 5586, 495, -1 }, { 7010, 1193, -1 }, { 7021, 1193, -1 }, { 7030, 1193, -1 },
+    { 7022, 1193, -1 }, { 6991, 1193, -1 }, { 0, 493, 6173 }, { 7645, 1685, -1 }, { 7694, 1689, -1 }, { 7662, 1689, -1 },
+    { 7711, 1689, -1 }, { 5583, 493, -1 }, { 0, 495, 6184 }, { 6423, 847, -1 }, { 6480, 847, -1 }, { 6475, 847, -1 },
+    { 6479, 847, -1 }, { 6454, 847, -1 }, { 6498, 847, -1 }, { 5588, 495, -1 }, { 7676, 1700, -1 }, { 0, 550, 7273 },
+    { 7711, 1708, -1 }, { 5829, 550, -1 }, { 0, 495, 6186 }, { 0, 495, 6187 }, { 5590, 495, 6188 }, { 0, 508, 6325 },
+    { 0, 508, 6326 }, { 0, 508, 6327 }, { 0, 508, 6328 }, { 0, 508, 6329 }, { 0, 508, 6330 }, { 0, 508, 6331 },
+    { 0, 508, 6332 }, { 7678, 1711, -1 }, { 0, 508, 6333 }, { 0, 508, 6334 }, { 7721, 1713, -1 }, { 0, 508, 6335 },
+    { 0, 508, 6336 }, { 0, 508, 6337 }, { 0, 508, 6338 }, { 7726, 1714, -1 }, { 0, 508, 6339 }, { 7713, 1730, -1 },
+    { 0, 508, 6340 }, { 7702, 1730, -1 }, { 0, 508, 6341 }, { 0, 508, 6342 }, { 0, 508, 6343 }, { 0, 508, 6344 },
+    { 5622, 508, 6345 }, { 0, 508, 6416 }, { 0, 508, 6417 }, { 5628, 508, 6418 }, { 0, 508, 6422 }, { 0, 508, 6423 },
+    { 0, 508, 6424 }, { 0, 508, 6425 }, { 0, 508, 6426 }, { 0, 508, 6427 }, { 5613, 508, 6428 }, { 0, 508, 6430 },
+    { 0, 508, 6431 }, { 0, 508, 6432 }, { 0, 508, 6433 }, { 0, 508, 6434 }, { 0, 508, 6435 }, { 0, 508, 6436 },
+    { 5616, 508, 6437 }, { 0, 508, 6440 }, { 0, 508, 6441 }, { 0, 508, 6442 }, { 0, 508, 6443 }, { 0, 508, 6444 },
+    { 7706, 1605, -1 }, { 0, 508, 6445 }, { 0, 508, 6446 }, { 0, 508, 6447 }, { 0, 508, 6448 }, { 0, 508, 6449 },
+    { 0, 508, 6450 }, { 0, 508, 6451 }, { 0, 508, 6452 }, { 0, 509, 6453 }, { 5630, 509, 6454 }, { 0, 509, 6458 },
+    { 0, 509, 6459 }, { 0, 509, 6460 }, { 0, 509, 6461 }, { 0, 509, 6462 }, { 7746, 1614, -1 }, { 0, 509, 6463 },
+    { 0, 509, 6464 }, { 0, 509, 6465 }, { 0, 509, 6466 }, { 0, 509, 6467 }, { 0, 509, 6468 }, { 0, 509, 6469 },
+    { 7757, 1654, -1 }, { 0, 509, 6470 }, { 0, 509, 6471 }, { 0, 509, 6472 }, { 7716, 1710, -1 }, { 7681, 1710, -1 },
+    { 0, 509, 6473 }, { 0, 509, 6474 }, { 0, 509, 6475 }, { 7771, 1666, -1 }, { 0, 509, 6476 }, { 7702, 1650, -1 },
+    { 0, 509, 6477 }, { 5632, 509, 6478 }, { 5631, 509, 6482 }, { 7713, 1650, -1 }, { 0, 509, 6484 }, { 0, 509, 6485 },
+    { 0, 509, 6486 }, { 0, 509, 6487 }, { 0, 509, 6488 }, { 0, 509, 6489 }, { 0, 509, 6490 }, { 7757, 1704, -1 },
+    { 0, 509, 6491 }, { 0, 509, 6492 }, { 0, 509, 6493 }, { 0, 509, 6494 }, { 0, 509, 6495 }, { 0, 509, 6496 },
+    { 0, 509, 6497 }, { 0, 509, 6498 }, { 5629, 509, 6499 }, { 0, 509, 6501 }, { 0, 509, 6502 }, { 5637, 509, 6503 },
+    { 0, 509, 6509 }, { 0, 509, 6510 }, { 0, 509, 6511 }, { 5638, 509, 6512 }, { 0, 509, 6515 }, { 5636, 509, 6516 },
+    { 0, 509, 6518 }, { 0, 509, 6519 }, { 7746, 1682, -1 }, { 0, 509, 6520 }, { 0, 509, 6521 }, { 5639, 509, 6522 },
+    { 0, 509, 6524 }, { 0, 510, 6525 }, { 0, 510, 6526 }, { 0, 510, 6527 }, { 7763, 1684, -1 }, { 0, 510, 6528 },
+    { 0, 510, 6529 }, { 0, 510, 6530 }, { 0, 510, 6531 }, { 5641, 510, 6532 }, { 0, 510, 6536 }, { 0, 510, 6537 },
+    { 0, 510, 6538 }, { 5645, 510, 6539 }, { 7774, 1680, -1 }, { 7742, 1717, -1 }, { 7764, 1680, -1 }, { 0, 510, 6541 },
+    { 0, 510, 6542 }, { 0, 510, 6543 }, { 0, 510, 6544 }, { 0, 510, 6545 }, { 0, 510, 6546 }, { 0, 510, 6547 },
+    { 0, 510, 6548 }, { 7736, 1718, -1 }, { 0, 510, 6549 }, { 0, 510, 6550 }, { 0, 510, 6551 }, { 7582, 1619, -1 },
+    { 7599, 1619, -1 }, { 0, 510, 6552 }, { 0, 510, 6553 }, { 7622, 1619, -1 }, { 0, 510, 6554 }, { 0, 510, 6555 },
+    { 0, 510, 6556 }, { 5644, 510, 6557 }, { 0, 510, 6559 }, { 5647, 510, 6560 }, { 7780, 1698, -1 }, { 0, 510, 6563 },
+    { 0, 510, 6564 }, { 7771, 1729, -1 }, { 7785, 1698, -1 }, { 0, 510, 6565 }, { 0, 510, 6566 }, { 0, 510, 6567 },
+    { 0, 510, 6568 }, { 0, 510, 6569 }, { 0, 510, 6570 }, { 5645, 510, 6571 }, { 7792, 576, -1 }, { 0, 510, 6573 },
+    { 0, 510, 6574 }, { 0, 510, 6575 }, { 0, 510, 6576 }, { 0, 510, 6577 }, { 0, 510, 6578 }, { 0, 510, 6579 },
+    { 0, 510, 6580 }, { 0, 510, 6581 }, { 7773, 583, -1 }, { 0, 510, 6582 }, { 0, 511, 6583 }, { 0, 511, 6584 },
+    { 0, 511, 6585 }, { 7784, 631, -1 }, { 0, 511, 6586 }, { 7755, 616, -1 }, { 0, 511, 6587 }, { 5646, 511, 6588 },
+    { 7807, 620, -1 }, { 0, 511, 6590 }, { 0, 511, 6591 }, { 7786, 758, -1 }, { 0, 511, 6592 }, { 0, 511, 6593 },
+    { 7784, 770, -1 }, { 0, 511, 6594 }, { 0, 511, 6595 }, { 0, 511, 6596 }, { 0, 511, 6597 }, { 0, 511, 6598 },
+    { 0, 511, 6599 }, { 7805, 813, -1 }, { 0, 511, 6600 }, { 0, 511, 6601 }, { 0, 511, 6602 }, { 0, 511, 6603 },
+    { 7811, 1736, -1 }, { 0, 511, 6604 }, { 5651, 511, 6605 }, { 0, 511, 6607 }, { 0, 511, 6608 }, { 0, 511, 6609 },
+    { 7764, 1737, -1 }, { 0, 511, 6610 }, { 0, 511, 6611 }, { 0, 511, 6612 }, { 0, 511, 6613 }, { 7777, 1765, -1 },
+    { 0, 511, 6614 }, { 0, 511, 6615 }, { 0, 511, 6616 }, { 7811, 1773, -1 }, { 0, 511, 6617 }, { 0, 511, 6618 },
+    { 0, 511, 6619 }, { 0, 511, 6620 }, { 7820, 1784, -1 }, { 0, 511, 6621 }, { 5653, 511, 6622 }, { 0, 511, 6624 },
+    { 7819, 1739, -1 }, { 0, 511, 6625 }, { 7603, 1629, -1 }, { 7818, 1740, -1 }, { 0, 511, 6626 }, { 7615, 1629, -1 },
+    { 7664, 1629, -1 }, { 7660, 1629, -1 }, { 7779, 1752, -1 }, { 5654, 513, 6635 }, { 0, 513, 6639 }, { 0, 513, 6640 },
+    { 5654, 513, 6641 }, { 5653, 511, 6627 }, { 0, 513, 6643 }, { 0, 513, 6644 }, { 5654, 513, 6645 }, { 0, 513, 6648 },
+    { 0, 513, 6649 }, { 5658, 513, 6650 }, { 0, 513, 6655 }, { 5661, 513, 6656 }, { 5659, 513, 6659 }, { 0, 513, 6661 },
+    { 0, 513, 6662 }, { 0, 513, 6663 }, { 5663, 513, 6664 }, { 5661, 513, 6667 }, { 5664, 513, 6669 }, { 0, 513, 6671 },
+    { 0, 513, 6672 }, { 0, 513, 6673 }, { 0, 514, 6674 }, { 5669, 514, 6675 }, { 0, 514, 6677 }, { 5667, 514, 6678 },
+    { 0, 514, 6680 }, { 0, 514, 6681 }, { 0, 514, 6682 }, { 7814, 1766, -1 }, { 0, 514, 6683 }, { 0, 514, 6684 },
+    { 0, 514, 6685 }, { 0, 514, 6686 }, { 0, 514, 6687 }, { 0, 514, 6688 }, { 0, 514, 6689 }, { 0, 514, 6690 },
+    { 0, 514, 6691 }, { 0, 514, 6692 }, { 0, 514, 6693 }, { 7853, 1782, -1 }, { 0, 514, 6694 }, { 0, 514, 6695 },
+    { 0, 514, 6696 }, { 0, 514, 6697 }, { 7841, 1786, -1 }, { 0, 514, 6698 }, { 0, 514, 6699 }, { 7812, 1793, -1 },
+    { 5689, 517, -1 }, { 5693, 517, -1 }, { 5696, 517, -1 }, { 5667, 514, 6700 }, { 5673, 515, -1 }, { 0, 515, 6720 },
+    { 0, 515, 6721 }, { 0, 515, 6722 }, { 5686, 515, 6723 }, { 0, 515, 6728 }, { 0, 517, 6760 }, { 7092, 1213, -1 },
+    { 7079, 1213, -1 }, { 7082, 1213, -1 }, { 7097, 1213, -1 }, { 7107, 1213, -1 }, { 5700, 517, -1 }, { 7708, 1657, -1 },
+    { 7706, 1657, -1 }, { 7748, 1657, -1 }, { 7745, 1657, -1 }, { 0, 515, 6729 }, { 5672, 514, -1 }, { 5677, 514, 6706 },
+    { 5681, 514, 6711 }, { 0, 514, 6717 }, { 0, 514, 6718 }, { 0, 517, 6766 }, { 6530, 891, -1 }, { 6582, 891, -1 },
+    { 6578, 891, -1 }, { 6560, 891, -1 }, { 6531, 891, -1 }, { 6535, 891, -1 }, { 5675, 515, -1 }, { 5695, 517, -1 },
+    { 7885, 1799, -1 }, { 5701, 517, -1 }, { 7886, 1788, -1 }, { 0, 515, 6731 }, { 0, 515, 6732 }, { 0, 515, 6733 },
+    { 5683, 515, -1 }, { 7510, 1546, -1 }, { 7514, 1546, -1 }, { 7543, 1546, -1 }, { 0, 517, 6772 }, { 7575, 1546, -1 },
+    { 7536, 1546, -1 }, { 5707, 517, -1 }, { 7767, 1692, -1 }, { 7831, 1794, -1 }, { 7773, 1692, -1 }, { 7767, 1692, -1 },
+    { 5684, 515, -1 }, { 7787, 1745, -1 }, { 7802, 1745, -1 }, { 5704, 517, 6778 }, { 5729, 523, 6855 }, { 5734, 523, 6857 },
+    { 0, 523, 6860 }, { 0, 523, 6861 }, { 5731, 523, 6862 }, { 5732, 523, 6864 }, { 5737, 523, 6867 }, { 0, 523, 6878 },
+    { 0, 523, 6879 }, { 0, 523, 6880 }, { 0, 523, 6881 }, { 0, 524, 6882 }, { 0, 524, 6883 }, { 5740, 524, 6884 },
+    { 0, 524, 6887 }, { 5744, 524, 6888 }, { 0, 524, 6891 }, { 5743, 524, 6892 }, { 0, 524, 6894 }, { 0, 524, 6895 },
+    { 0, 524, 6896 }, { 5743, 524, 6897 }, { 7887, 1807, -1 }, { 0, 524, 6899 }, { 0, 524, 6900 }, { 7855, 1828, -1 },
+    { 0, 524, 6901 }, { 0, 524, 6902 }, { 0, 524, 6903 }, { 7902, 1834, -1 }, { 0, 524, 6904 }, { 0, 524, 6905 },
+    { 7900, 1812, -1 }, { 0, 524, 6906 }, { 0, 524, 6907 }, { 0, 524, 6908 }, { 7863, 1816, -1 }, { 0, 524, 6909 },
+    { 5744, 524, 6910 }, { 5746, 524, 6912 }, { 5750, 524, 6914 }, { 0, 524, 6918 }, { 0, 524, 6919 }, { 5752, 524, 6920 },
+    { 0, 524, 6923 }, { 0, 524, 6924 }, { 7908, 1832, -1 }, { 5752, 524, 6925 }, { 7871, 1832, -1 }, { 0, 524, 6927 },
+    { 0, 524, 6928 }, { 5771, 527, 6959 }, { 7895, 1818, -1 }, { 0, 527, 6967 }, { 0, 527, 6968 }, { 0, 527, 6969 },
+    { 0, 527, 6970 }, { 0, 527, 6971 }, { 0, 527, 6972 }, { 5762, 527, 6973 }, { 0, 527, 6976 }, { 0, 527, 6977 },
+    { 0, 527, 6978 }, { 0, 527, 6979 }, { 0, 527, 6980 }, { 7904, 1822, -1 }, { 0, 527, 6981 }, { 0, 527, 6982 },
+    { 0, 527, 6983 }, { 0, 527, 6984 }, { 7837, 1756, -1 }, { 7832, 1756, -1 }, { 0, 527, 6985 }, { 7907, 1829, -1 },
+    { 5769, 527, 6986 }, { 0, 527, 6988 }, { 7931, 1833, -1 }, { 0, 527, 6989 }, { 0, 528, 6990 }, { 0, 528, 6991 },
+    { 7878, 1796, -1 }, { 7864, 1796, -1 }, { 5769, 528, 6992 }, { 0, 528, 6994 }, { 5773, 528, 6995 }, { 7860, 1815, -1 },
+    { 0, 528, 6998 }, { 7909, 1815, -1 }, { 0, 528, 6999 }, { 0, 528, 7000 }, { 7912, 1835, -1 }, { 0, 528, 7001 },
+    { 7933, 1836, -1 }, { 0, 528, 7002 }, { 0, 528, 7003 }, { 0, 528, 7004 }, { 0, 528, 7005 }, { 7933, 1838, -1 },
+    { 0, 528, 7006 }, { 7760, 1687, -1 }, { 5778, 528, -1 }, { 7741, 1687, -1 }, { 7778, 1687, -1 }, { 5779, 528, -1 },
+    { 5780, 531, 7012 }, { 0, 531, 7017 }, { 0, 531, 7018 }, { 0, 531, 7019 }, { 0, 531, 7020 }, { 0, 531, 7021 },
+    { 7886, 1849, -1 }, { 0, 531, 7022 }, { 0, 531, 7023 }, { 0, 531, 7024 }, { 0, 531, 7025 }, { 0, 531, 7026 },
+    { 0, 531, 7027 }, { 0, 531, 7028 }, { 0, 531, 7029 }, { 5781, 531, 7030 }, { 0, 531, 7032 }, { 0, 531, 7033 },
+    { 0, 531, 7034 }, { 0, 531, 7035 }, { 5780, 532, 7036 }, { 0, 532, 7038 }, { 0, 532, 7039 }, { 7896, 1850, -1 },
+    { 0, 532, 7040 }, { 0, 532, 7041 }, { 0, 532, 7042 }, { 0, 532, 7043 }, { 0, 532, 7044 }, { 7930, 1854, -1 },
+    { 0, 532, 7045 }, { 0, 532, 7046 }, { 0, 532, 7047 }, { 7854, 1790, -1 }, { 7870, 1790, -1 }, { 0, 532, 7048 },
+    { 0, 532, 7049 }, { 0, 532, 7050 }, { 0, 532, 7051 }, { 0, 532, 7052 }, { 7888, 1814, -1 }, { 7867, 1814, -1 },
+    { 0, 532, 7053 }, { 0, 532, 7054 }, { 0, 532, 7055 }, { 7889, 1855, -1 }, { 0, 532, 7056 }, { 0, 532, 7057 },
+    { 0, 532, 7058 }, { 0, 532, 7059 }, { 0, 532, 7060 }, { 0, 532, 7061 }, { 0, 532, 7062 }, { 0, 532, 7063 },
+    { 0, 532, 7064 }, { 0, 532, 7065 }, { 0, 532, 7066 }, { 0, 532, 7067 }, { 7898, 1861, -1 }, { 0, 532, 7068 },
+    { 5784, 532, -1 }, { 0, 540, 7098 }, { 0, 540, 7099 }, { 7878, 1820, -1 }, { 7855, 1820, -1 }, { 7921, 1830, -1 },
+    { 0, 540, 7100 }, { 0, 540, 7101 }, { 0, 540, 7102 }, { 7905, 1830, -1 }, { 7926, 1870, -1 }, { 0, 540, 7103 },
+    { 7899, 1872, -1 }, { 0, 540, 7104 }, { 0, 540, 7105 }, { 7938, 1852, -1 }, { 0, 540, 7106 }, { 0, 540, 7107 },
+    { 0, 540, 7108 }, { 7935, 1852, -1 }, { 0, 540, 7109 }, { 0, 540, 7110 }, { 7889, 1795, -1 }, { 7891, 1795, -1 },
+    { 7874, 1795, -1 }, { 7866, 1795, -1 }, { 0, 540, 7111 }, { 0, 540, 7112 }, { 5803, 540, 7113 }, { 7933, 1862, -1 },
+    { 0, 540, 7115 }, { 0, 540, 7116 }, { 0, 540, 7117 }, { 0, 540, 7118 }, { 0, 540, 7119 }, { 0, 540, 7120 },
+    { 0, 540, 7121 }, { 0, 540, 7122 }, { 0, 540, 7123 }, { 0, 540, 7124 }, { 0, 540, 7125 }, { 0, 540, 7126 },
+    { 7943, 1873, -1 }, { 0, 540, 7127 }, { 7919, 1873, -1 }, { 0, 540, 7128 }, { 0, 540, 7129 }, { 7949, 1887, -1 },
+    { 0, 540, 7130 }, { 0, 540, 7131 }, { 0, 540, 7132 }, { 0, 540, 7133 }, { 7932, 1911, -1 }, { 0, 540, 7134 },
+    { 7959, 1911, -1 }, { 0, 540, 7135 }, { 5799, 540, 7136 }, { 7920, 1867, -1 }, { 7935, 1867, -1 }, { 0, 540, 7138 },
+    { 7952, 1888, -1 }, { 0, 540, 7139 }, { 0, 541, 7140 }, { 0, 541, 7141 }, { 0, 541, 7142 }, { 0, 541, 7143 },
+    { 0, 541, 7144 }, { 7846, 1824, -1 }, { 7947, 1891, -1 }, { 7901, 1824, -1 }, { 7872, 1824, -1 }, { 0, 541, 7145 },
+    { 0, 541, 7146 }, { 0, 541, 7147 }, { 0, 541, 7148 }, { 0, 541, 7149 }, { 7901, 1895, -1 }, { 7937, 1897, -1 },
+    { 0, 541, 7150 }, { 0, 541, 7151 }, { 0, 541, 7152 }, { 0, 541, 7153 }, { 0, 541, 7154 }, { 7954, 1916, -1 },
+    { 7927, 1917, -1 }, { 7925, 1916, -1 }, { 7914, 1928, -1 }, { 0, 541, 7155 }, { 0, 541, 7156 }, { 0, 541, 7157 },
+    { 0, 541, 7158 }, { 7944, 1935, -1 }, { 7972, 1936, -1 }, { 0, 541, 7159 }, { 5803, 546, 7160 }, { 0, 546, 7162 },
+    { 5806, 546, 7163 }, { 0, 546, 7172 }, { 5803, 546, 7173 }, { 7935, 1921, -1 }, { 0, 546, 7175 }, { 0, 546, 7176 },
+    { 7978, 1926, -1 }, { 0, 546, 7177 }, { 0, 546, 7178 }, { 0, 546, 7179 }, { 0, 546, 7180 }, { 0, 546, 7181 },
+    { 0, 546, 7182 }, { 7971, 859, -1 }, { 0, 546, 7183 }, { 7910, 1912, -1 }, { 0, 546, 7184 }, { 0, 546, 7185 },
+    { 0, 546, 7186 }, { 7939, 1912, -1 }, { 0, 546, 7187 }, { 0, 546, 7188 }, { 0, 546, 7189 }, { 0, 546, 7190 },
+    { 0, 546, 7191 }, { 0, 546, 7192 }, { 7964, 1894, -1 }, { 7953, 1894, -1 }, { 0, 546, 7193 }, { 5804, 546, 7194 },
+    { 5807, 546, 7196 }, { 0, 547, 7198 }, { 0, 547, 7199 }, { 0, 547, 7200 }, { 5811, 547, 7201 }, { 5812, 547, 7203 },
+    { 0, 547, 7205 }, { 0, 547, 7206 }, { 0, 547, 7207 }, { 0, 547, 7208 }, { 0, 547, 7209 }, { 7931, 867, -1 },
+    { 0, 547, 7210 }, { 7935, 871, -1 }, { 0, 547, 7211 }, { 0, 547, 7212 }, { 7924, 1819, -1 }, { 0, 547, 7213 },
+    { 7872, 1819, -1 }, { 7963, 1929, -1 }, { 7902, 1819, -1 }, { 0, 547, 7214 }, { 7971, 1933, -1 }, { 0, 547, 7215 },
+    { 0, 547, 7216 }, { 7921, 1904, -1 }, { 0, 547, 7217 }, { 7974, 868, -1 }, { 0, 547, 7218 }, { 7937, 1904, -1 },
+    { 0, 547, 7219 }, { 7983, 868, -1 }, { 7972, 1962, -1 }, { 7937, 842, -1 }, { 7966, 842, -1 }, { 0, 547, 7220 },
+    { 5813, 547, 7221 }, { 7942, 842, -1 }, { 0, 547, 7225 }, { 0, 547, 7226 }, { 0, 547, 7227 }, { 0, 547, 7228 },
+    { 0, 547, 7229 }, { 0, 547, 7230 }, { 0, 547, 7231 }, { 0, 547, 7232 }, { 7935, 1963, -1 }, { 7939, 1963, -1 },
+    { 5810, 547, 7233 }, { 0, 552, 7284 }, { 7989, 1899, -1 }, { 0, 547, 7235 }, { 0, 552, 7285 }, { 0, 552, 7286 },
+    { 0, 552, 7287 }, { 0, 552, 7288 }, { 0, 552, 7289 }, { 0, 552, 7290 }, { 0, 552, 7291 }, { 0, 552, 7292 },
+    { 0, 552, 7293 }, { 0, 552, 7294 }, { 0, 547, 7236 }, { 6570, 927, -1 }, { 6631, 927, -1 }, { 6622, 927, -1 },
+    { 6632, 927, -1 }, { 6629, 927, -1 }, { 6634, 927, -1 }, { 7349, 1474, -1 }, { 7399, 1474, -1 }, { 7397, 1474, -1 },
+    { 7379, 1474, -1 }, { 7376, 1474, -1 }, { 5837, 552, 7295 }, { 0, 552, 7302 }, { 0, 552, 7303 }, { 7980, 1901, -1 },
+    { 7970, 1934, -1 }, { 7994, 1940, -1 }, { 5830, 552, 7304 }, { 6682, 1019, -1 }, { 6734, 1019, -1 }, { 6719, 1019, -1 },
+    { 6738, 1019, -1 }, { 6750, 1019, -1 }, { 6716, 1019, -1 }, { 6700, 1038, -1 }, { 6776, 1038, -1 }, { 6766, 1038, -1 },
+    { 6775, 1038, -1 }, { 6754, 1038, -1 }, { 6763, 1038, -1 }, { 6774, 1065, -1 }, { 6840, 1065, -1 }, { 6832, 1065, -1 },
+    { 6846, 1065, -1 }, { 6865, 1065, -1 }, { 6885, 1065, -1 }, { 6892, 1113, -1 }, { 6937, 1113, -1 }, { 6953, 1113, -1 },
+    { 6912, 1113, -1 }, { 6963, 1113, -1 }, { 6942, 1113, -1 }, { 7129, 1299, -1 }, { 7182, 1299, -1 }, { 7172, 1299, -1 },
+    { 7195, 1299, -1 }, { 7197, 1299, -1 }, { 7214, 1299, -1 }, { 7153, 1325, -1 }, { 7241, 1325, -1 }, { 7202, 1325, -1 },
+    { 7208, 1325, -1 }, { 7204, 1325, -1 }, { 7254, 1325, -1 }, { 7224, 1342, -1 }, { 7276, 1342, -1 }, { 7270, 1342, -1 },
+    { 7254, 1342, -1 }, { 7292, 1342, -1 }, { 7231, 1342, -1 }, { 7269, 689, -1 }, { 7305, 689, -1 }, { 7313, 689, -1 },
+    { 7318, 689, -1 }, { 7328, 689, -1 }, { 7324, 689, -1 }, { 7424, 1525, -1 }, { 7407, 1525, -1 }, { 7386, 1525, -1 },
+    { 7427, 1525, -1 }, { 7435, 1525, -1 }, { 7427, 1439, -1 }, { 7513, 1439, -1 }, { 7567, 1439, -1 }, { 7625, 1439, -1 },
+    { 7678, 1439, -1 }, { 7715, 1439, -1 }, { 7437, 1443, -1 }, { 7490, 1443, -1 }, { 7485, 1443, -1 }, { 7485, 1443, -1 },
+    { 7502, 1443, -1 }, { 7455, 1443, -1 }, { 7577, 1620, -1 }, { 7740, 1620, -1 }, { 7762, 1620, -1 }, { 7687, 1620, -1 },
+    { 7758, 1620, -1 }, { 7644, 1620, -1 }, { 7825, 1750, -1 }, { 7822, 1750, -1 }, { 7988, 1948, -1 }, { 7800, 1750, -1 },
+    { 7828, 1750, -1 }, { 7781, 1753, -1 }, { 7811, 1753, -1 }, { 7831, 1753, -1 }, { 7788, 1753, -1 }, { 7837, 1753, -1 },
+    { 7823, 1753, -1 }, { 7839, 1758, -1 }, { 7823, 1758, -1 }, { 7972, 1967, -1 }, { 7801, 1758, -1 }, { 7836, 1758, -1 },
+    { 7802, 1763, -1 }, { 7864, 1763, -1 }, { 7841, 1763, -1 }, { 7842, 1763, -1 }, { 7836, 1763, -1 }, { 7849, 1763, -1 },
+    { 7967, 1951, -1 }, { 7989, 1971, -1 }, { 7951, 1977, -1 }, { 7985, 1951, -1 }, { 7987, 1982, -1 }, { 7981, 1097, -1 },
+    { 7950, 1110, -1 }, { 7997, 1131, -1 }, { 7957, 1135, -1 }, { 7958, 1129, -1 }, { 8004, 1136, -1 }, { 7957, 1139, -1 },
+    { 8016, 1144, -1 }, { 8012, 1129, -1 }, { 8011, 1144, -1 }, { 8015, 1139, -1 }, { 8003, 1145, -1 }, { 7963, 1966, -1 },
+    { 7982, 1979, -1 }, { 7972, 1988, -1 }, { 8008, 1988, -1 }, { 8016, 1979, -1 }, { 7971, 1989, -1 }, { 8005, 1992, -1 },
+    { 8022, 1998, -1 }, { 8020, 2002, -1 }, { 8019, 1989, -1 }, { 7975, 2002, -1 }, { 8019, 2004, -1 }, { 8031, 2006, -1 },
+    { 7995, 1974, -1 }, { 8041, 1974, -1 }, { 8020, 2010, -1 }, { 8004, 2006, -1 }, { 7986, 1990, -1 }, { 8043, 1990, -1 },
+    { 8066, 1990, -1 }, { 8071, 1990, -1 }, { 8115, 1990, -1 }, { 8098, 1990, -1 }, { 8034, 2012, -1 }, { 8036, 2015, -1 },
+    { 8046, 2015, -1 }, { 8033, 2017, -1 }, { 7999, 2024, -1 }, { 8056, 2028, -1 }, { 8012, 2024, -1 }, { 8004, 1991, -1 },
+    { 8017, 1991, -1 }, { 8013, 1995, -1 }, { 8043, 2001, -1 }, { 8043, 2001, -1 }, { 8070, 2005, -1 }, { 8028, 2022, -1 },
+    { 8021, 2022, -1 }, { 8051, 2022, -1 }, { 8072, 2027, -1 }, { 8048, 2039, -1 }, { 8080, 2029, -1 }, { 8041, 2029, -1 },
+    { 8080, 2027, -1 }, { 8068, 2029, -1 }, { 8084, 2029, -1 }, { 8090, 2044, -1 }, { 8048, 2030, -1 }, { 8123, 2030, -1 },
+    { 8107, 2030, -1 }, { 8073, 2034, -1 }, { 8115, 2030, -1 }, { 8060, 2038, -1 }, { 8128, 2071, -1 }, { 8103, 2038, -1 },
+    { 8119, 2038, -1 }, { 8127, 2038, -1 }, { 8123, 2055, -1 }, { 8110, 2055, -1 }, { 8084, 2061, -1 }, { 8105, 2077, -1 },
+    { 8111, 2055, -1 }, { 8103, 2061, -1 }, { 8112, 2086, -1 }, { 8136, 2035, -1 }, { 8093, 2050, -1 }, { 8134, 2058, -1 },
+    { 8138, 2062, -1 }, { 8103, 2050, -1 }, { 8138, 2072, -1 }, { 8139, 2078, -1 }, { 8101, 2094, -1 }, { 8131, 648, -1 },
+    { 8139, 648, -1 }, { 8144, 677, -1 }, { 8151, 736, -1 }, { 8157, 648, -1 }, { 8118, 724, -1 }, { 8127, 724, -1 },
+    { 8132, 724, -1 }, { 8112, 724, -1 }, { 8173, 724, -1 }, { 8116, 726, -1 }, { 8170, 2080, -1 }, { 8166, 2059, -1 },
+    { 8132, 726, -1 }, { 8165, 2059, -1 }, { 8160, 726, -1 }, { 8175, 2059, -1 }, { 8125, 2060, -1 }, { 8178, 2060, -1 },
+    { 8152, 2060, -1 }, { 8187, 2089, -1 }, { 8191, 2091, -1 }, { 8166, 2091, -1 }, { 8149, 2091, -1 }, { 8140, 2093, -1 },
+    { 8178, 2091, -1 }, { 8191, 2095, -1 }, { 8177, 2098, -1 }, { 8145, 2100, -1 }, { 8177, 2109, -1 }, { 8190, 2100, -1 },
+    { 8141, 2103, -1 }, { 8193, 2103, -1 }, { 8197, 2103, -1 }, { 8202, 2103, -1 }, { 8163, 2103, -1 }, { 8209, 2103, -1 },
+    { 8201, 2101, -1 }, { 8188, 2105, -1 }, { 8180, 2105, -1 }, { 8206, 2105, -1 }, { 8183, 2101, -1 }, { 8160, 2113, -1 },
+    { 8167, 2115, -1 }, { 8209, 2116, -1 }, { 8219, 2116, -1 }, { 8212, 2127, -1 }, { 8231, 2127, -1 }, { 8186, 2129, -1 },
+    { 8218, 2130, -1 }, { 8213, 2131, -1 }, { 8213, 2132, -1 }, { 8209, 2139, -1 }, { 8184, 2146, -1 }, { 8184, 2147, -1 },
+    { 8205, 2147, -1 }, { 8236, 2162, -1 }, { 8214, 2146, -1 }, { 8190, 2161, -1 }, { 8253, 2161, -1 }, { 8248, 2161, -1 },
+    { 8214, 2161, -1 }, { 8267, 2161, -1 }, { 8247, 2161, -1 }, { 8205, 2160, -1 }, { 8225, 2165, -1 }, { 8215, 2166, -1 },
+    { 8209, 2165, -1 }, { 8234, 2160, -1 }, { 8247, 2179, -1 }, { 8221, 2184, -1 }, { 8262, 2191, -1 }, { 8268, 1221, -1 },
+    { 8270, 1224, -1 }, { 8271, 1233, -1 }, { 8240, 1242, -1 }, { 8255, 1254, -1 }, { 8243, 1256, -1 }, { 8280, 1233, -1 },
+    { 8285, 2185, -1 }, { 8261, 2185, -1 }, { 8250, 2185, -1 }, { 8290, 2185, -1 }, { 8283, 2187, -1 }, { 8266, 2189, -1 },
+    { 8245, 2195, -1 }, { 8273, 2195, -1 }, { 8298, 2201, -1 }, { 8273, 2201, -1 }, { 8301, 2211, -1 }, { 8297, 2233, -1 },
+    { 8288, 2238, -1 }, { 8287, 2118, -1 }, { 8299, 2238, -1 }, { 8307, 2238, -1 }, { 8310, 2122, -1 }, { 8304, 2128, -1 },
+    { 8263, 2128, -1 }, { 8263, 2133, -1 }, { 8264, 2150, -1 }, { 8288, 2153, -1 }, { 8267, 1696, -1 }, { 8308, 1696, -1 },
+    { 8294, 1696, -1 }, { 8270, 1733, -1 }, { 8272, 1735, -1 }, { 8324, 1742, -1 }, { 8320, 1733, -1 }, { 8309, 1743, -1 },
+    { 8281, 1743, -1 }, { 8325, 1258, -1 }, { 8290, 1267, -1 }, { 8308, 1292, -1 }, { 8307, 1295, -1 }, { 8327, 1258, -1 },
+    { 8277, 1298, -1 }, { 8324, 1298, -1 }, { 8309, 1298, -1 }, { 8316, 1298, -1 }, { 8303, 1298, -1 }, { 8325, 1298, -1 },
+    { 8314, 1307, -1 }, { 8332, 2209, -1 }, { 8320, 2214, -1 }, { 8320, 2244, -1 }, { 8294, 999, -1 }, { 8344, 803, -1 },
+    { 8318, 803, -1 }, { 8350, 823, -1 }, { 8342, 803, -1 }, { 8349, 812, -1 }, { 8322, 812, -1 }, { 8302, 1056, -1 },
+    { 8300, 1067, -1 }, { 8325, 1067, -1 }, { 8309, 1067, -1 }, { 8362, 1067, -1 }, { 8347, 1075, -1 }, { 8338, 1067, -1 },
+    { 8348, 1491, -1 }, { 8345, 1514, -1 }, { 8346, 1517, -1 }, { 8348, 1536, -1 }, { 8364, 1538, -1 }, { 8311, 2235, -1 },
+    { 8329, 2246, -1 }, { 8356, 2276, -1 }, { 8323, 2279, -1 }, { 8373, 2235, -1 }, { 8374, 2287, -1 }, { 8364, 2248, -1 },
+    { 8371, 2279, -1 }, { 8327, 2260, -1 }, { 8370, 2262, -1 }, { 8366, 2268, -1 }, { 8374, 2274, -1 }, { 8372, 2260, -1 },
+    { 8376, 2290, -1 }, { 8381, 2076, -1 }, { 8391, 2092, -1 }, { 8388, 2108, -1 }, { 8367, 2108, -1 }, { 8390, 2076, -1 },
+    { 8364, 2108, -1 }, { 8391, 2108, -1 }, { 8385, 2112, -1 }, { 8370, 1925, -1 }, { 8394, 1930, -1 }, { 8345, 1932, -1 },
+    { 8358, 1930, -1 }, { 8341, 1930, -1 }, { 8349, 1954, -1 }, { 8400, 1955, -1 }, { 8388, 1956, -1 }, { 8353, 1959, -1 },
+    { 8397, 1959, -1 }, { 8360, 1980, -1 }, { 8379, 2304, -1 }, { 8428, 2309, -1 }, { 8383, 1959, -1 }, { 8361, 2281, -1 },
+    { 8406, 2281, -1 }, { 8409, 2281, -1 }, { 8366, 2282, -1 }, { 8375, 2310, -1 }, { 8417, 2281, -1 }, { 8420, 2282, -1 },
+    { 8409, 2298, -1 }, { 8433, 2332, -1 }, { 8419, 2298, -1 }, { 8370, 2306, -1 }, { 8422, 2306, -1 }, { 8420, 2306, -1 },
+    { 8383, 2324, -1 }, { 8426, 2335, -1 }, { 8414, 2330, -1 }, { 8412, 2335, -1 }, { 8427, 2324, -1 }, { 8406, 2330, -1 },
+    { 8382, 2336, -1 }, { 8399, 2293, -1 }, { 8388, 2316, -1 }, { 8438, 2322, -1 }, { 8434, 2323, -1 }, { 8415, 2323, -1 },
+    { 8429, 2331, -1 }, { 8418, 2322, -1 }, { 8395, 2329, -1 }, { 8447, 2329, -1 }, { 8434, 2329, -1 }, { 8434, 2329, -1 },
+    { 8456, 2329, -1 }, { 8456, 2329, -1 }, { 8465, 2338, -1 }, { 8421, 2340, -1 }, { 8455, 2259, -1 }, { 8454, 2263, -1 },
+    { 8469, 2259, -1 }, { 8466, 2266, -1 }, { 8462, 2278, -1 }, { 8457, 2278, -1 }, { 8415, 2352, -1 }, { 8426, 2356, -1 },
+    { 8426, 2362, -1 }, { 8465, 2352, -1 }, { 8445, 2352, -1 }, { 8428, 2368, -1 }, { 8472, 2370, -1 }, { 8457, 2368, -1 },
+    { 8474, 2377, -1 }, { 8436, 2392, -1 }, { 8435, 2393, -1 }, { 8477, 2392, -1 }, { 8479, 2393, -1 }, { 8458, 2397, -1 },
+    { 8467, 2397, -1 }, { 8487, 2407, -1 }, { 8484, 2397, -1 }, { 8441, 2406, -1 }, { 8444, 2406, -1 }, { 8466, 2384, -1 },
+    { 8483, 2384, -1 }, { 8446, 2384, -1 }, { 8458, 2384, -1 }, { 8486, 2384, -1 }, { 8452, 2394, -1 }, { 8504, 2394, -1 },
+    { 8484, 2394, -1 }, { 8496, 2394, -1 }, { 8459, 2394, -1 }, { 8467, 2423, -1 }, { 8498, 2433, -1 }, { 8460, 2438, -1 },
+    { 8461, 2391, -1 }, { 8507, 2391, -1 }, { 8466, 2391, -1 }, { 8486, 2391, -1 }, { 8485, 2391, -1 }, { 8462, 2402, -1 },
+    { 8514, 2408, -1 }, { 8509, 2424, -1 }, { 8486, 2434, -1 }, { 8535, 2435, -1 }, { 8518, 2434, -1 }, { 8489, 2440, -1 },
+    { 8511, 2442, -1 }, { 8485, 2441, -1 }, { 8483, 2454, -1 }, { 8538, 2463, -1 }, { 8534, 2441, -1 }, { 8493, 2472, -1 },
+    { 8538, 2478, -1 }, { 8491, 2487, -1 }, { 8549, 2487, -1 }, { 8556, 2487, -1 }, { 8559, 2487, -1 }, { 8576, 2487, -1 },
+    { 8572, 2487, -1 }, { 8545, 1321, -1 }, { 8506, 1323, -1 }, { 8557, 1345, -1 }, { 8543, 1028, -1 }, { 8537, 1047, -1 },
+    { 8564, 2446, -1 }, { 8569, 2460, -1 }, { 8534, 2476, -1 }, { 8515, 2476, -1 }, { 8555, 2483, -1 }, { 8521, 2484, -1 },
+    { 8525, 2484, -1 }, { 8568, 1137, -1 }, { 8534, 1154, -1 }, { 8583, 1154, -1 }, { 8578, 1156, -1 }, { 8586, 1167, -1 },
+    { 8583, 1178, -1 }, { 8544, 1178, -1 }, { 8597, 2234, -1 }, { 8595, 2251, -1 }, { 8549, 2252, -1 }, { 8556, 728, -1 },
+    { 8589, 742, -1 }, { 8595, 781, -1 }, { 8591, 568, -1 }, { 8602, 2026, -1 }, { 8598, 781, -1 }, { 8567, 2021, -1 },
+    { 8608, 2021, -1 }, { 8574, 2021, -1 }, { 8601, 2031, -1 }, { 8597, 2488, -1 }, { 8598, 2500, -1 }, { 8620, 2504, -1 },
+    { 8622, 2528, -1 }, { 8626, 2538, -1 }, { 8577, 2539, -1 }, { 8621, 2539, -1 }, { 8607, 2539, -1 }, { 8639, 2515, -1 },
+    { 8583, 2539, -1 }, { 8631, 2539, -1 }, { 8633, 2542, -1 }, { 8594, 2542, -1 }, { 8609, 2542, -1 }, { 8592, 2542, -1 },
+    { 8639, 2542, -1 }, { 8637, 2522, -1 }, { 8638, 2527, -1 }, { 8596, 2530, -1 }, { 8625, 2532, -1 }, { 8599, 2534, -1 },
+    { 8641, 2534, -1 }, { 8614, 2534, -1 }, { 8599, 2535, -1 }, { 8653, 2548, -1 }, { 8630, 2534, -1 }, { 8605, 1024, -1 },
+    { 8634, 957, -1 }, { 8659, 982, -1 }, { 8609, 983, -1 }, { 8638, 982, -1 }, { 8659, 989, -1 }, { 8612, 457, -1 },
+    { 8607, 457, -1 }, { 8640, 457, -1 }, { 8639, 989, -1 }, { 8665, 486, -1 }, { 8647, 457, -1 }, { 8659, 469, -1 },
+    { 8619, 476, -1 }, { 8661, 1261, -1 }, { 8631, 1303, -1 }, { 8652, 1304, -1 }, { 8630, 1304, -1 }, { 8668, 1316, -1 },
+    { 8643, 2506, -1 }, { 8677, 2506, -1 }, { 8659, 2507, -1 }, { 8643, 2524, -1 }, { 8677, 2526, -1 }, { 8649, 2540, -1 },
+    { 8641, 2552, -1 }, { 8691, 2556, -1 }, { 8662, 875, -1 }, { 8647, 2552, -1 }, { 8644, 2519, -1 }, { 8702, 2533, -1 },
+    { 8668, 2561, -1 }, { 8697, 2566, -1 }, { 8699, 2582, -1 }, { 8650, 2601, -1 }, { 8693, 2571, -1 }, { 8647, 2573, -1 },
+    { 8654, 2609, -1 }, { 8709, 1412, -1 }, { 8696, 1415, -1 }, { 8706, 1444, -1 }, { 8700, 2573, -1 }, { 8699, 1486, -1 },
+    { 8659, 1489, -1 }, { 8701, 1489, -1 }, { 8673, 1489, -1 }, { 8700, 1535, -1 }, { 8657, 672, -1 }, { 8675, 696, -1 },
+    { 8675, 1076, -1 }, { 8714, 1085, -1 }, { 8705, 2580, -1 }, { 8676, 2580, -1 }, { 8681, 2592, -1 }, { 8716, 2583, -1 },
+    { 8696, 2580, -1 }, { 8718, 2583, -1 }, { 8718, 2593, -1 }, { 8708, 2583, -1 }, { 8727, 2600, -1 }, { 8732, 2602, -1 },
+    { 8730, 2605, -1 }, { 8703, 2605, -1 }, { 8706, 2605, -1 }, { 8706, 2605, -1 }, { 8722, 2605, -1 }, { 8682, 2607, -1 },
+    { 8735, 2611, -1 }, { 8687, 895, -1 }, { 8737, 902, -1 }, { 8731, 915, -1 }, { 8720, 2614, -1 }, { 8725, 2649, -1 },
+    { 8743, 2616, -1 }, { 8727, 915, -1 }, { 8700, 2616, -1 }, { 8695, 2623, -1 }, { 8695, 2623, -1 }, { 8754, 2623, -1 },
+    { 8700, 2625, -1 }, { 8756, 2628, -1 }, { 8739, 2669, -1 }, { 8756, 969, -1 }, { 8736, 969, -1 }, { 8715, 969, -1 },
+    { 8773, 2385, -1 }, { 8759, 969, -1 }, { 8711, 970, -1 }, { 8753, 970, -1 }, { 8765, 970, -1 }, { 8767, 970, -1 },
+    { 8763, 970, -1 }, { 8721, 2383, -1 }, { 8763, 2383, -1 }, { 8767, 2386, -1 }, { 8753, 2386, -1 }, { 8769, 2398, -1 },
+    { 8761, 2383, -1 }, { 8777, 2425, -1 }, { 8757, 2425, -1 }, { 8784, 2428, -1 }, { 8790, 2425, -1 }, { 8786, 2425, -1 },
+    { 8779, 2654, -1 }, { 8735, 2656, -1 }, { 8736, 2664, -1 }, { 8785, 2664, -1 }, { 8790, 2664, -1 }, { 8792, 2665, -1 },
+    { 8794, 2666, -1 }, { 8796, 2671, -1 }, { 8775, 2672, -1 }, { 8752, 2675, -1 }, { 8750, 2698, -1 }, { 8802, 2700, -1 },
+    { 8797, 2672, -1 }, { 8804, 2704, -1 }, { 8793, 2704, -1 }, { 8809, 857, -1 }, { 8766, 857, -1 }, { 8771, 1157, -1 },
+    { 8785, 857, -1 }, { 8801, 857, -1 }, { 8765, 877, -1 }, { 8815, 877, -1 }, { 8766, 906, -1 }, { 8821, 1366, -1 },
+    { 8796, 906, -1 }, { 8811, 1376, -1 }, { 8819, 906, -1 }, { 8821, 1403, -1 }, { 8813, 1413, -1 }, { 8796, 2181, -1 },
+    { 8818, 2198, -1 }, { 8800, 2204, -1 }, { 8831, 2687, -1 }, { 8824, 2204, -1 }, { 8818, 2204, -1 }, { 8805, 2668, -1 },
+    { 8805, 2668, -1 }, { 8779, 2715, -1 }, { 8832, 2719, -1 }, { 8794, 2726, -1 }, { 8810, 2619, -1 }, { 8787, 2640, -1 },
+    { 8794, 2642, -1 }, { 8783, 2036, -1 }, { 8840, 2042, -1 }, { 8830, 2067, -1 }, { 8841, 613, -1 }, { 8842, 652, -1 },
+    { 8835, 656, -1 }, { 8849, 652, -1 }, { 8842, 774, -1 }, { 8823, 652, -1 }, { 8802, 776, -1 }, { 8849, 778, -1 },
+    { 8842, 2676, -1 }, { 8847, 2692, -1 }, { 8803, 2677, -1 }, { 8805, 2676, -1 }, { 8847, 2677, -1 }, { 8835, 2677, -1 },
+    { 8820, 1644, -1 }, { 8817, 1705, -1 }, { 8851, 2705, -1 }, { 8811, 2706, -1 }, { 8854, 2708, -1 }, { 8846, 2706, -1 },
+    { 8857, 2716, -1 }, { 8815, 2716, -1 }, { 8816, 2718, -1 }, { 8826, 2722, -1 }, { 8858, 2723, -1 }, { 8825, 2718, -1 },
+    { 8863, 2722, -1 }, { 8848, 2741, -1 }, { 8828, 2743, -1 }, { 8824, 2752, -1 }, { 8829, 2753, -1 }, { 8832, 2752, -1 },
+    { 8878, 2752, -1 }, { 8854, 2328, -1 }, { 8871, 2339, -1 }, { 8884, 2379, -1 }, { 8877, 2379, -1 }, { 8839, 2387, -1 },
+    { 8826, 2389, -1 }, { 8854, 1455, -1 }, { 8830, 1455, -1 }, { 8878, 1504, -1 }, { 8834, 1507, -1 }, { 8880, 2720, -1 },
+    { 8831, 1504, -1 }, { 8855, 2735, -1 }, { 8883, 1507, -1 }, { 8879, 1507, -1 }, { 8844, 2740, -1 }, { 8878, 2740, -1 },
+    { 8896, 2746, -1 }, { 8892, 1082, -1 }, { 8852, 1093, -1 }, { 8884, 1101, -1 }, { 8848, 1108, -1 }, { 8900, 1128, -1 },
+    { 8879, 1128, -1 }, { 8865, 1128, -1 }, { 8854, 1817, -1 }, { 8905, 1823, -1 }, { 8884, 1826, -1 }, { 8875, 1826, -1 },
+    { 8899, 2458, -1 }, { 8881, 2461, -1 }, { 8916, 2759, -1 }, { 8909, 2503, -1 }, { 8892, 2458, -1 }, { 8871, 2503, -1 },
+    { 8863, 2736, -1 }, { 8893, 2736, -1 }, { 8891, 2736, -1 }, { 8867, 2769, -1 }, { 8918, 2785, -1 }, { 8913, 501, -1 },
+    { 8866, 1960, -1 }, { 8901, 1960, -1 }, { 8879, 1960, -1 }, { 8887, 2767, -1 }, { 8925, 2781, -1 }, { 8902, 1960, -1 },
+    { 8895, 2800, -1 }, { 8932, 2820, -1 }, { 8906, 2820, -1 }, { 8935, 1393, -1 }, { 8934, 2820, -1 }, { 8886, 1404, -1 },
+    { 8888, 1442, -1 }, { 8937, 1442, -1 }, { 8947, 1442, -1 }, { 8920, 1442, -1 }, { 8944, 1442, -1 }, { 8946, 1442, -1 },
+    { 8936, 1212, -1 }, { 8933, 1212, -1 }, { 8928, 1214, -1 }, { 8951, 1219, -1 }, { 8926, 1212, -1 }, { 8920, 1223, -1 },
+    { 8933, 1227, -1 }, { 8930, 130, -1 }, { 8943, 1227, -1 }, { 8956, 1227, -1 }, { 8970, 2816, -1 }, { 8949, 130, -1 },
+    { 8909, 2807, -1 }, { 8944, 2807, -1 }, { 8959, 2808, -1 }, { 8957, 2821, -1 }, { 8918, 2808, -1 }, { 8970, 2807, -1 },
+    { 8960, 2808, -1 }, { 8944, 2810, -1 }, { 8973, 2810, -1 }, { 8924, 2810, -1 }, { 8977, 2824, -1 }, { 8925, 2825, -1 },
+    { 8944, 2827, -1 }, { 8981, 2830, -1 }, { 8964, 2837, -1 }, { 8985, 2842, -1 }, { 8937, 2844, -1 }, { 8956, 2844, -1 },
+    { 8976, 2853, -1 }, { 8993, 2844, -1 }, { 8990, 2844, -1 }, { 8990, 2855, -1 }, { 8947, 2857, -1 }, { 8986, 2857, -1 },
+    { 8994, 2857, -1 }, { 8971, 2859, -1 }, { 9001, 2862, -1 }, { 9005, 2866, -1 }, { 8954, 2868, -1 }, { 8977, 2875, -1 },
+    { 8952, 2880, -1 }, { 8964, 2890, -1 }, { 9007, 2893, -1 }, { 9001, 2898, -1 }, { 9003, 2900, -1 }, { 9004, 2901, -1 },
+    { 9013, 2911, -1 }, { 9015, 2921, -1 }, { 8961, 2924, -1 }, { 9015, 2924, -1 }, { 9019, 2930, -1 }, { 8992, 2924, -1 },
+    { 9019, 2931, -1 }, { 9018, 2924, -1 }, { 9007, 2934, -1 }, { 8996, 2977, -1 }, { 9021, 2931, -1 }, { 8998, 2943, -1 },
+    { 9000, 2943, -1 }, { 8969, 2971, -1 }, { 8977, 2971, -1 }, { 9018, 2971, -1 }, { 8998, 3000, -1 }, { 9028, 2971, -1 },
+    { 8988, 2256, -1 }, { 8984, 2269, -1 }, { 9026, 2269, -1 }, { 8981, 2288, -1 }, { 8987, 2291, -1 }, { 8982, 1379, -1 },
+    { 8989, 1407, -1 }, { 9017, 1417, -1 }, { 8988, 2958, -1 }, { 9009, 2958, -1 }, { 9020, 2958, -1 }, { 9042, 2958, -1 },
+    { 8989, 2960, -1 }, { 9031, 2970, -1 }, { 9040, 2978, -1 }, { 9005, 2960, -1 }, { 8994, 3008, -1 }, { 8994, 3011, -1 },
+    { 9035, 2973, -1 }, { 9007, 2983, -1 }, { 9032, 2987, -1 }, { 9047, 2989, -1 }, { 9006, 2997, -1 }, { 9006, 2997, -1 },
+    { 9035, 2997, -1 }, { 9003, 2997, -1 }, { 9062, 3014, -1 }, { 9039, 2997, -1 }, { 9066, 3017, -1 }, { 9070, 3017, -1 },
+    { 9070, 3020, -1 }, { 9043, 3021, -1 }, { 9038, 3040, -1 }, { 9074, 3046, -1 }, { 9076, 3050, -1 }, { 9077, 3028, -1 },
+    { 9075, 3028, -1 }, { 9055, 3037, -1 }, { 9069, 3039, -1 }, { 9065, 3053, -1 }, { 9041, 3058, -1 }, { 9059, 3058, -1 },
+    { 9085, 3073, -1 }, { 9077, 3079, -1 }, { 9081, 3058, -1 }, { 9034, 3086, -1 }, { 9086, 3055, -1 }, { 9060, 3056, -1 },
+    { 9070, 3061, -1 }, { 9040, 3063, -1 }, { 9048, 3072, -1 }, { 9093, 3061, -1 }, { 9085, 3095, -1 }, { 9098, 3104, -1 },
+    { 9099, 3108, -1 }, { 9053, 3095, -1 }, { 9060, 2992, -1 }, { 9097, 2994, -1 }, { 9045, 2998, -1 }, { 9050, 2998, -1 },
+    { 9104, 2999, -1 }, { 9076, 3003, -1 }, { 9103, 3030, -1 }, { 9105, 3044, -1 }, { 9080, 3044, -1 }, { 9084, 692, -1 },
+    { 9112, 705, -1 }, { 9072, 2082, -1 }, { 9059, 2107, -1 }, { 9071, 2111, -1 }, { 9112, 2114, -1 }, { 9075, 2117, -1 },
+    { 9117, 2114, -1 }, { 9083, 2114, -1 }, { 9078, 2124, -1 }, { 9078, 3077, -1 }, { 9070, 3087, -1 }, { 9072, 3088, -1 },
+    { 9124, 3088, -1 }, { 9122, 3088, -1 }, { 9112, 3088, -1 }, { 9081, 3088, -1 }, { 9120, 3093, -1 }, { 9120, 3105, -1 },
+    { 9083, 3117, -1 }, { 9125, 3123, -1 }, { 9130, 3132, -1 }, { 9135, 1460, -1 }, { 9103, 1459, -1 }, { 9125, 2760, -1 },
+    { 9128, 3132, -1 }, { 9128, 1459, -1 }, { 9091, 2744, -1 }, { 9139, 2798, -1 }, { 9109, 2744, -1 }, { 9127, 2744, -1 },
+    { 9101, 2791, -1 }, { 9139, 2791, -1 }, { 9165, 3131, -1 }, { 9132, 2791, -1 }, { 9147, 2791, -1 }, { 9146, 2791, -1 },
+    { 9148, 3127, -1 }, { 9137, 3127, -1 }, { 9144, 3129, -1 }, { 9156, 3163, -1 }, { 9163, 3127, -1 }, { 9165, 3129, -1 },
+    { 9116, 3152, -1 }, { 9152, 3152, -1 }, { 9174, 3153, -1 }, { 9174, 3153, -1 }, { 9168, 3152, -1 }, { 9139, 3171, -1 },
+    { 9151, 3171, -1 }, { 9179, 3136, -1 }, { 9127, 3137, -1 }, { 9156, 3137, -1 }, { 9190, 3137, -1 }, { 9167, 3137, -1 },
+    { 9139, 3137, -1 }, { 9185, 3137, -1 }, { 9135, 3139, -1 }, { 9137, 3148, -1 }, { 9134, 3188, -1 }, { 9141, 3168, -1 },
+    { 9142, 3168, -1 }, { 9162, 3175, -1 }, { 9142, 3189, -1 }, { 9167, 3188, -1 }, { 9144, 3192, -1 }, { 9166, 3192, -1 },
+    { 9176, 3192, -1 }, { 9202, 3192, -1 }, { 9201, 3192, -1 }, { 9174, 3197, -1 }, { 9205, 3198, -1 }, { 9165, 3206, -1 },
+    { 9207, 3214, -1 }, { 9186, 3206, -1 }, { 9190, 3203, -1 }, { 9192, 3217, -1 }, { 9209, 3230, -1 }, { 9209, 3236, -1 },
+    { 9196, 162, -1 }, { 9216, 3135, -1 }, { 9192, 166, -1 }, { 9224, 162, -1 }, { 9212, 166, -1 }, { 9174, 3143, -1 },
+    { 9205, 3144, -1 }, { 9218, 3145, -1 }, { 9219, 3167, -1 }, { 9221, 622, -1 }, { 9190, 624, -1 }, { 9230, 3167, -1 },
+    { 9236, 638, -1 }, { 9182, 2236, -1 }, { 9205, 2236, -1 }, { 9218, 2236, -1 }, { 9213, 2236, -1 }, { 9243, 2236, -1 },
+    { 9218, 2236, -1 }, { 9233, 2239, -1 }, { 9193, 2261, -1 }, { 9242, 2267, -1 }, { 9236, 3212, -1 }, { 9252, 3218, -1 },
+    { 9201, 3237, -1 }, { 9249, 3212, -1 }, { 9221, 3212, -1 }, { 9242, 3252, -1 }, { 9229, 3252, -1 }, { 9202, 1288, -1 },
+    { 9247, 1309, -1 }, { 9250, 1313, -1 }, { 9250, 1336, -1 }, { 9258, 1357, -1 }, { 9246, 3241, -1 }, { 9247, 1336, -1 },
+    { 9234, 3253, -1 }, { 9236, 3241, -1 }, { 9246, 3273, -1 }, { 9243, 3289, -1 }, { 9259, 2586, -1 }, { 9266, 2595, -1 },
+    { 9262, 3254, -1 }, { 9253, 3258, -1 }, { 9222, 3262, -1 }, { 9223, 3293, -1 }, { 9274, 1728, -1 }, { 9228, 1728, -1 },
+    { 9276, 1754, -1 }, { 9236, 2685, -1 }, { 9224, 3267, -1 }, { 9268, 3272, -1 }, { 9229, 3279, -1 }, { 9281, 3279, -1 },
+    { 9280, 3300, -1 }, { 9239, 3304, -1 }, { 9290, 3307, -1 }, { 9287, 3307, -1 }, { 9279, 3307, -1 }, { 9276, 3307, -1 },
+    { 9295, 3307, -1 }, { 9290, 3311, -1 }, { 9269, 3147, -1 }, { 9295, 3158, -1 }, { 9267, 3147, -1 }, { 9294, 3147, -1 },
+    { 9289, 3179, -1 }, { 9299, 3078, -1 }, { 9252, 3179, -1 }, { 9298, 3082, -1 }, { 9298, 3179, -1 }, { 9256, 1225, -1 },
+    { 9298, 215, -1 }, { 9286, 215, -1 }, { 9305, 131, -1 }, { 9282, 3314, -1 }, { 9266, 3314, -1 }, { 9313, 3315, -1 },
+    { 9301, 3314, -1 }, { 9309, 3317, -1 }, { 9312, 3331, -1 }, { 9289, 3339, -1 }, { 9307, 3331, -1 }, { 9311, 3348, -1 },
+    { 9296, 3351, -1 }, { 9323, 132, -1 }, { 9275, 218, -1 }, { 9301, 3348, -1 }, { 9276, 227, -1 }, { 9331, 3362, -1 },
+    { 9323, 227, -1 }, { 9298, 227, -1 }, { 9333, 3364, -1 }, { 9317, 227, -1 }, { 9328, 3361, -1 }, { 9315, 3361, -1 },
+    { 9337, 3384, -1 }, { 9321, 3386, -1 }, { 9296, 3393, -1 }, { 9323, 3396, -1 }, { 9347, 3409, -1 }, { 9335, 3409, -1 },
+    { 9340, 3396, -1 }, { 9289, 3405, -1 }, { 9294, 3405, -1 }, { 9305, 3405, -1 }, { 9305, 3412, -1 }, { 9352, 3413, -1 },
+    { 9303, 3415, -1 }, { 9303, 3418, -1 }, { 9338, 3418, -1 }, { 9360, 3421, -1 }, { 9309, 3415, -1 }, { 9345, 3415, -1 },
+    { 9350, 3429, -1 }, { 9307, 3430, -1 }, { 9319, 3430, -1 }, { 9351, 3436, -1 }, { 9314, 3437, -1 }, { 9339, 3441, -1 },
+    { 9345, 3437, -1 }, { 9321, 3444, -1 }, { 9319, 3448, -1 }, { 9368, 3437, -1 }, { 9362, 3447, -1 }, { 9370, 3447, -1 },
+    { 9320, 3454, -1 }, { 9320, 3454, -1 }, { 9326, 3457, -1 }, { 9377, 3459, -1 }, { 9327, 3464, -1 }, { 9333, 3467, -1 },
+    { 9354, 3459, -1 }, { 9370, 3459, -1 }, { 9378, 3490, -1 }, { 9363, 3490, -1 }, { 9389, 3496, -1 }, { 9342, 3500, -1 },
+    { 9390, 3500, -1 }, { 9340, 3511, -1 }, { 9373, 3511, -1 }, { 9377, 3511, -1 }, { 9393, 3511, -1 }, { 9402, 3511, -1 },
+    { 9379, 3511, -1 }, { 9350, 630, -1 }, { 9350, 657, -1 }, { 9400, 3519, -1 }, { 9404, 630, -1 }, { 9396, 3523, -1 },
+    { 9376, 3525, -1 }, { 9364, 3528, -1 }, { 9365, 3528, -1 }, { 9364, 3536, -1 }, { 9370, 3536, -1 }, { 9377, 3540, -1 },
+    { 9416, 3542, -1 }, { 9413, 3545, -1 }, { 9396, 3555, -1 }, { 9422, 3558, -1 }, { 9420, 3559, -1 }, { 9415, 3559, -1 },
+    { 9385, 3562, -1 }, { 9383, 3577, -1 }, { 9430, 3577, -1 }, { 9432, 3577, -1 }, { 9384, 3577, -1 }, { 9406, 3577, -1 },
+    { 9415, 3577, -1 }, { 9390, 3581, -1 }, { 9427, 3583, -1 }, { 9397, 3583, -1 }, { 9417, 3600, -1 }, { 9455, 3600, -1 },
+    { 9452, 3601, -1 }, { 9443, 3602, -1 }, { 9405, 1639, -1 }, { 9411, 1639, -1 }, { 9432, 3601, -1 }, { 9408, 1683, -1 },
+    { 9439, 3608, -1 }, { 9435, 3612, -1 }, { 9422, 3608, -1 }, { 9457, 3612, -1 }, { 9422, 1860, -1 }, { 9423, 1426, -1 },
+    { 9438, 1453, -1 }, { 9471, 1226, -1 }, { 9414, 1268, -1 }, { 9419, 1272, -1 }, { 9420, 3621, -1 }, { 9469, 3623, -1 },
+    { 9436, 3621, -1 }, { 9420, 3624, -1 }, { 9473, 3621, -1 }, { 9467, 3627, -1 }, { 9475, 3627, -1 }, { 9458, 3629, -1 },
+    { 9457, 3642, -1 }, { 9438, 3676, -1 }, { 9432, 3677, -1 }, { 9481, 3677, -1 }, { 9465, 3681, -1 }, { 9470, 3677, -1 },
+    { 9444, 3677, -1 }, { 9489, 3677, -1 }, { 9474, 3687, -1 }, { 9483, 3689, -1 }, { 9441, 3694, -1 }, { 9450, 3707, -1 },
+    { 9474, 3691, -1 }, { 9454, 3696, -1 }, { 9480, 3706, -1 }, { 9476, 3709, -1 }, { 9501, 3713, -1 }, { 9453, 3714, -1 },
+    { 9504, 3714, -1 }, { 9461, 3717, -1 }, { 9501, 3713, -1 }, { 9520, 3726, -1 }, { 9505, 3714, -1 }, { 9458, 3716, -1 },
+    { 9508, 3716, -1 }, { 9462, 3719, -1 }, { 9505, 3719, -1 }, { 9507, 3744, -1 }, { 9470, 3719, -1 }, { 9519, 3750, -1 },
+    { 9515, 3719, -1 }, { 9468, 3723, -1 }, { 9511, 3729, -1 }, { 9521, 3732, -1 }, { 9516, 3734, -1 }, { 9531, 3736, -1 },
+    { 9471, 3738, -1 }, { 9507, 3741, -1 }, { 9521, 3749, -1 }, { 9530, 3753, -1 }, { 9520, 3755, -1 }, { 9482, 3783, -1 },
+    { 9527, 3749, -1 }, { 9518, 3785, -1 }, { 9507, 3247, -1 }, { 9531, 3259, -1 }, { 9484, 3263, -1 }, { 9491, 3280, -1 },
+    { 9492, 3286, -1 }, { 9513, 3743, -1 }, { 9533, 3263, -1 }, { 9543, 3754, -1 }, { 9538, 3778, -1 }, { 9500, 3790, -1 },
+    { 9552, 3797, -1 }, { 9552, 3804, -1 }, { 9545, 3778, -1 }, { 9494, 3781, -1 }, { 9544, 3781, -1 }, { 9559, 3781, -1 },
+    { 9559, 3781, -1 }, { 9546, 3781, -1 }, { 9565, 3781, -1 }, { 9557, 3820, -1 }, { 9519, 3841, -1 }, { 9570, 3806, -1 },
+    { 9551, 3811, -1 }, { 9554, 3811, -1 }, { 9556, 3830, -1 }, { 9547, 3849, -1 }, { 9525, 3811, -1 }, { 9583, 3856, -1 },
+    { 9564, 137, -1 }, { 9564, 141, -1 }, { 9559, 1764, -1 }, { 9618, 1764, -1 }, { 9636, 1764, -1 }, { 9658, 1764, -1 },
+    { 9681, 1764, -1 }, { 9594, 1764, -1 }, { 9664, 1769, -1 }, { 9547, 1769, -1 }, { 9574, 1769, -1 }, { 9639, 1769, -1 },
+    { 9612, 1769, -1 }, { 9603, 1770, -1 }, { 9595, 1770, -1 }, { 9542, 1770, -1 }, { 9566, 1771, -1 }, { 9558, 1771, -1 },
+    { 9569, 1772, -1 }, { 9568, 1774, -1 }, { 9621, 1774, -1 }, { 9576, 1774, -1 }, { 9589, 3892, -1 }, { 9626, 1774, -1 },
+    { 9646, 1774, -1 }, { 9579, 305, -1 }, { 9659, 305, -1 }, { 9652, 305, -1 }, { 9686, 3900, -1 }, { 9634, 305, -1 },
+    { 9651, 3882, -1 }, { 9724, 3882, -1 }, { 9714, 3882, -1 }, { 9754, 3882, -1 }, { 9761, 3882, -1 }, { 9767, 3882, -1 },
+    { 9583, 3885, -1 }, { 9634, 3885, -1 }, { 9610, 3885, -1 }, { 9658, 3916, -1 }, { 9680, 3944, -1 }, { 9663, 3943, -1 },
+    { 9674, 3962, -1 }, { 9712, 3916, -1 }, { 9665, 3943, -1 }, { 9665, 3943, -1 }, { 9733, 3965, -1 }, { 9696, 3969, -1 },
+    { 9687, 3969, -1 }, { 9700, 3971, -1 }, { 9679, 3965, -1 }, { 9690, 3977, -1 }, { 9703, 3987, -1 }, { 9722, 3987, -1 },
+    { 9730, 3991, -1 }, { 9743, 4015, -1 }, { 9733, 4017, -1 }, { 9749, 4029, -1 }, { 9688, 4017, -1 }, { 9743, 4049, -1 },
+    { 9726, 4070, -1 }, { 9696, 4090, -1 }, { 9769, 4105, -1 }, { 9742, 4101, -1 }, { 9763, 4104, -1 }, { 9763, 4108, -1 },
+    { 9759, 4108, -1 }, { 9755, 4101, -1 }, { 9772, 4111, -1 }, { 9732, 4113, -1 }, { 9764, 4111, -1 }, { 9776, 4111, -1 },
+    { 9790, 4114, -1 }, { 9790, 4119, -1 }, { 9786, 4113, -1 }, { 9766, 4118, -1 }, { 9783, 4118, -1 }, { 9768, 4120, -1 },
+    { 9746, 4125, -1 }, { 9793, 4127, -1 }, { 9799, 4155, -1 }, { 9745, 4174, -1 }, { 9760, 4174, -1 }, { 9770, 4156, -1 },
+    { 9798, 4174, -1 }, { 9791, 4174, -1 }, { 9799, 4175, -1 }, { 9790, 4175, -1 }, { 9822, 4186, -1 }, { 9768, 4175, -1 },
+    { 9803, 4176, -1 }, { 9768, 4176, -1 }, { 9814, 4194, -1 }, { 9824, 4206, -1 }, { 9817, 4176, -1 }, { 9809, 4160, -1 },
+    { 9796, 4160, -1 }, { 9824, 4160, -1 }, { 9826, 2009, -1 }, { 9827, 2019, -1 }, { 9827, 2065, -1 }, { 9824, 4152, -1 },
+    { 9810, 4153, -1 }, { 9817, 4153, -1 }, { 9785, 4154, -1 }, { 9836, 4154, -1 }, { 9832, 4153, -1 }, { 9833, 4187, -1 },
+    { 9837, 4154, -1 }, { 9784, 4168, -1 }, { 9846, 4168, -1 }, { 9786, 4168, -1 }, { 9810, 4189, -1 }, { 9793, 4168, -1 },
+    { 9846, 4189, -1 }, { 9798, 4201, -1 }, { 9840, 4201, -1 }, { 9849, 4209, -1 }, { 9846, 2277, -1 }, { 9829, 2283, -1 },
+    { 9815, 2285, -1 }, { 9812, 2285, -1 }, { 9850, 2285, -1 }, { 9807, 2285, -1 }, { 9811, 2326, -1 }, { 9819, 2489, -1 },
+    { 9814, 2501, -1 }, { 9870, 1556, -1 }, { 9870, 1580, -1 }, { 9841, 2489, -1 }, { 9813, 2505, -1 }, { 9867, 2505, -1 },
+    { 9857, 2505, -1 }, { 9881, 2505, -1 }, { 9860, 2505, -1 }, { 9850, 2505, -1 }, { 9820, 1590, -1 }, { 9833, 3341, -1 },
+    { 9882, 3344, -1 }, { 9836, 3354, -1 }, { 9886, 3354, -1 }, { 9846, 3357, -1 }, { 9868, 4210, -1 }, { 9892, 4211, -1 },
+    { 9882, 4214, -1 }, { 9884, 4215, -1 }, { 9889, 4216, -1 }, { 9873, 4216, -1 }, { 9888, 4216, -1 }, { 9908, 4216, -1 },
+    { 9879, 4216, -1 }, { 9863, 4223, -1 }, { 9862, 4223, -1 }, { 9909, 4225, -1 }, { 9908, 4225, -1 }, { 9888, 4227, -1 },
+    { 9890, 4231, -1 }, { 9891, 4248, -1 }, { 9915, 4249, -1 }, { 9868, 4250, -1 }, { 9925, 4250, -1 }, { 9877, 4253, -1 },
+    { 9904, 4257, -1 }, { 9938, 558, -1 }, { 9929, 3760, -1 }, { 9901, 4253, -1 }, { 9929, 3760, -1 }, { 9927, 3760, -1 },
+    { 9933, 3760, -1 }, { 9928, 3770, -1 }, { 9888, 3770, -1 }, { 9944, 4269, -1 }, { 9933, 3770, -1 }, { 9912, 3770, -1 },
+    { 9940, 3776, -1 }, { 9940, 3776, -1 }, { 9907, 3777, -1 }, { 9917, 3776, -1 }, { 9904, 4284, -1 }, { 9923, 3777, -1 },
+    { 9907, 4261, -1 }, { 9907, 4261, -1 }, { 9925, 4292, -1 }, { 9943, 4261, -1 }, { 9921, 4261, -1 }, { 9916, 4294, -1 },
+    { 9959, 4294, -1 }, { 9960, 4310, -1 }, { 9911, 4313, -1 }, { 9912, 4314, -1 }, { 9950, 4314, -1 }, { 9961, 4329, -1 },
+    { 9960, 4334, -1 }, { 9947, 4374, -1 }, { 9921, 3048, -1 }, { 9976, 4374, -1 }, { 9964, 3057, -1 }, { 9978, 3069, -1 },
+    { 9950, 3069, -1 }, { 9981, 3071, -1 }, { 9956, 3084, -1 }, { 9958, 1843, -1 }, { 9973, 1846, -1 }, { 9974, 1856, -1 },
+    { 9975, 1857, -1 }, { 9943, 1898, -1 }, { 9983, 2634, -1 }, { 9931, 2647, -1 }, { 9961, 2652, -1 }, { 9938, 790, -1 },
+    { 9967, 790, -1 }, { 9939, 4402, -1 }, { 9965, 4430, -1 }, { 9967, 4468, -1 }, { 9944, 4470, -1 }, { 9990, 4470, -1 },
+    { 9985, 4472, -1 }, { 9998, 4499, -1 }, { 9996, 4470, -1 }, { 9996, 4500, -1 }, { 9994, 4504, -1 }, { 10003, 4505, -1 },
+    { 9996, 4536, -1 }, { 9986, 4548, -1 }, { 9958, 1785, -1 }, { 9987, 1811, -1 }, { 9968, 1813, -1 }, { 10012, 3683, -1 },
+    { 10006, 3826, -1 }, { 10022, 537, -1 }, { 10012, 1813, -1 }, { 10004, 3673, -1 }, { 9993, 3673, -1 }, { 9999, 3673, -1 },
+    { 9978, 3673, -1 }, { 10019, 3673, -1 }, { 10014, 3686, -1 }, { 10006, 3813, -1 }, { 10027, 3853, -1 }, { 10001, 3853, -1 },
+    { 10009, 3686, -1 }, { 10025, 3813, -1 }, { 10025, 584, -1 }, { 10036, 4580, -1 }, { 10021, 682, -1 }, { 10023, 584, -1 },
+    { 10028, 4574, -1 }, { 10020, 4574, -1 }, { 10015, 4574, -1 }, { 10006, 683, -1 }, { 10011, 4574, -1 }, { 10009, 683, -1 },
+    { 10008, 2373, -1 }, { 10053, 2375, -1 }, { 10043, 2373, -1 }, { 10068, 2378, -1 }, { 10028, 2373, -1 }, { 10030, 2373, -1 },
+    { 10006, 2374, -1 }, { 10051, 2374, -1 }, { 10028, 2376, -1 }, { 10073, 456, -1 }, { 10035, 1044, -1 }, { 10077, 1510, -1 },
+    { 10039, 1044, -1 }, { 10033, 1043, -1 }, { 10034, 2374, -1 }, { 10042, 2374, -1 }, { 10050, 2374, -1 }, { 10022, 2374, -1 },
+    { 10051, 1043, -1 }, { 10059, 2374, -1 }, { 10076, 1045, -1 }, { 10030, 1511, -1 }, { 10083, 1508, -1 }, { 10060, 1512, -1 },
+    { 10051, 2375, -1 }, { 10087, 1570, -1 }, { 10068, 1045, -1 }, { 10060, 1508, -1 }, { 10016, 2374, -1 }, { 10080, 1509, -1 },
+    { 10045, 1509, -1 }, { 10039, 1044, -1 }, { 10048, 1509, -1 }, { 10049, 2376, -1 }, { 10052, 1568, -1 }, { 10090, 1569, -1 },
+    { 10024, 2374, -1 }, { 10071, 1571, -1 }, { 10055, 1906, -1 }, { 10070, 1568, -1 }, { 10103, 1907, -1 }, { 10043, 1908, -1 },
+    { 10045, 1909, -1 }, { 10055, 1569, -1 }, { 10101, 1581, -1 }, { 10058, 1569, -1 }, { 10049, 1582, -1 }, { 10047, 1908, -1 },
+    { 10050, 1583, -1 }, { 10096, 2399, -1 }, { 10059, 2400, -1 }, { 10048, 1509, -1 }, { 10096, 2401, -1 }, { 10112, 3332, -1 },
+    { 10067, 2403, -1 }, { 10119, 3332, -1 }, { 10109, 1581, -1 }, { 10016, 2374, -1 }, { 10092, 2403, -1 }, { 10089, 3332, -1 },
+    { 10158, 458, -1 }, { 10098, 2404, -1 }, { 10107, 3335, -1 }, { 10164, 477, -1 }, { 10058, 1569, -1 }, { 10098, 2401, -1 },
+    { 10109, 3336, -1 }, { 10154, 494, -1 }, { 10119, 2404, -1 }, { 10157, 498, -1 }, { 10128, 723, -1 }, { 10131, 839, -1 },
+    { 10038, 1509, -1 }, { 10073, 2400, -1 }, { 10055, 2400, -1 }, { 10089, 3333, -1 }, { 10166, 3337, -1 }, { 10172, 512, -1 },
+    { 10169, 839, -1 }, { 10121, 3333, -1 }, { 10105, 2400, -1 }, { 10119, 2404, -1 }, { 10112, 3333, -1 }, { 10185, 2553, -1 },
+    { 10100, 2400, -1 }, { 10085, 3333, -1 }, { 10123, 3333, -1 }, { 10151, 3336, -1 }, { 10150, 3334, -1 }, { 10098, 3334, -1 },
+    { 10099, 1569, -1 }, { 10104, 3335, -1 }, { 10131, 722, -1 }, { 10168, 2554, -1 }, { 10069, 2400, -1 }, { 10155, 3336, -1 },
+    { 10097, 2404, -1 }, { 10184, 530, -1 }, { 10089, 3333, -1 }, { 10114, 3337, -1 }, { 10136, 477, -1 }, { 10163, 3337, -1 },
+    { 10168, 3336, -1 }, { 10142, 722, -1 }, { 10171, 569, -1 }, { 10090, 3333, -1 }, { 10087, 3333, -1 }, { 10093, 3333, -1 },
+    { 10133, 3333, -1 }, { 10158, 3336, -1 }, { 10149, 2549, -1 }, { 10099, 3334, -1 }, { 10095, 3333, -1 }, { 10135, 2550, -1 },
+    { 10110, 3336, -1 }, { 10167, 2549, -1 }, { 10111, 3334, -1 }, { 10154, 3334, -1 }, { 10132, 3333, -1 }, { 10183, 2551, -1 },
+    { 10102, 3334, -1 }, { 10152, 2550, -1 }, { 10159, 1611, -1 }, { 10155, 2550, -1 }, { 10141, 3336, -1 }, { 10097, 3333, -1 },
+    { 10166, 1613, -1 }, { 10198, 1983, -1 }, { 10204, 1984, -1 }, { 10195, 1616, -1 }, { 10150, 1985, -1 }, { 10198, 1613, -1 },
+    { 10132, 3333, -1 }, { 10099, 3334, -1 }, { 10199, 1987, -1 }, { 10139, 3334, -1 }, { 10132, 722, -1 }, { 10172, 2168, -1 },
+    { 10115, 3334, -1 }, { 10192, 2551, -1 }, { 10177, 1616, -1 }, { 10167, 2169, -1 }, { 10155, 2550, -1 }, { 10210, 2170, -1 },
+    { 10166, 2173, -1 }, { 10160, 571, -1 }, { 10172, 607, -1 }, { 10159, 1983, -1 }, { 10216, 804, -1 }, { 10171, 808, -1 },
+    { 10218, 1358, -1 }, { 10175, 1359, -1 }, { 10195, 1363, -1 }, { 10216, 609, -1 }, { 10169, 629, -1 }, { 10223, 649, -1 },
+    { 10205, 2712, -1 }, { 10230, 2713, -1 }, { 10208, 2714, -1 }, { 10181, 2717, -1 }, { 10222, 1540, -1 }, { 10178, 1537, -1 },
+    { 10213, 1541, -1 }, { 10199, 882, -1 }, { 10184, 883, -1 }, { 10190, 651, -1 }, { 10233, 2121, -1 }, { 10220, 2119, -1 },
+    { 10203, 2717, -1 }, { 10193, 2123, -1 }, { 10178, 2170, -1 }, { 10219, 1537, -1 }, { 10218, 2119, -1 }, { 10202, 2120, -1 },
+    { 10189, 827, -1 }, { 10205, 2120, -1 }, { 10218, 829, -1 }, { 10199, 928, -1 }, { 10209, 929, -1 }, { 10238, 1010, -1 },
+    { 10234, 1011, -1 }, { 10225, 688, -1 }, { 10232, 1760, -1 }, { 10252, 1010, -1 }, { 10178, 2169, -1 }, { 10206, 1761, -1 },
+    { 10224, 1762, -1 }, { 10256, 2073, -1 }, { 10251, 2073, -1 }, { 10242, 2074, -1 }, { 10232, 2075, -1 }, { 10258, 901, -1 },
+    { 10256, 904, -1 }, { 10256, 2792, -1 }, { 10205, 2120, -1 }, { 10229, 2793, -1 }, { 10220, 2795, -1 }, { 10232, 2793, -1 },
+    { 10245, 2792, -1 }, { 10261, 2796, -1 }, { 10264, 2797, -1 }, { 10260, 2962, -1 }, { 10264, 2962, -1 }, { 10253, 2962, -1 },
+    { 10255, 2962, -1 }, { 10272, 2963, -1 }, { 10250, 2963, -1 }, { 10247, 2963, -1 }, { 10275, 3089, -1 }, { 10289, 2964, -1 },
+    { 10281, 3091, -1 }, { 10330, 3092, -1 }, { 10299, 2301, -1 }, { 10327, 3094, -1 }, { 10335, 2303, -1 }, { 10274, 2963, -1 },
+    { 10232, 2793, -1 }, { 10317, 2301, -1 }, { 10275, 2963, -1 }, { 10304, 913, -1 }, { 10343, 917, -1 }, { 10352, 1078, -1 },
+    { 10336, 2305, -1 }, { 10259, 2964, -1 }, { 10351, 712, -1 }, { 10293, 2964, -1 }, { 10333, 1079, -1 }, { 10227, 2963, -1 },
+    { 10343, 745, -1 }, { 10263, 2963, -1 }, { 10271, 2964, -1 }, { 10266, 2964, -1 }, { 10283, 2966, -1 }, { 10293, 2964, -1 },
+    { 10330, 750, -1 }, { 10311, 3090, -1 }, { 10251, 2963, -1 }, { 10284, 2963, -1 }, { 10305, 3090, -1 }, { 10281, 3094, -1 },
+    { 10325, 2144, -1 }, { 10301, 2302, -1 }, { 10345, 2142, -1 }, { 10304, 2302, -1 }, { 10334, 717, -1 }, { 10255, 2963, -1 },
+    { 10265, 2963, -1 }, { 10320, 735, -1 }, { 10280, 2963, -1 }, { 10247, 2963, -1 }, { 10302, 2964, -1 }, { 10340, 2305, -1 },
+    { 10251, 2964, -1 }, { 10272, 2964, -1 }, { 10260, 2964, -1 }, { 10289, 2964, -1 }, { 10292, 2963, -1 }, { 10239, 2963, -1 },
+    { 10293, 2964, -1 }, { 10243, 2963, -1 }, { 10264, 2967, -1 }, { 10285, 2963, -1 }, { 10304, 2302, -1 }, { 10281, 2963, -1 },
+    { 10316, 2143, -1 }, { 10349, 761, -1 }, { 10298, 2305, -1 }, { 10281, 2966, -1 }, { 10374, 3209, -1 }, { 10325, 1195, -1 },
+    { 10316, 3090, -1 }, { 10291, 2966, -1 }, { 10291, 2966, -1 }, { 10302, 1079, -1 }, { 10343, 1195, -1 }, { 10379, 3210, -1 },
+    { 10295, 2302, -1 }, { 10300, 2302, -1 }, { 10327, 1196, -1 }, { 10330, 3211, -1 }, { 10330, 1196, -1 }, { 10304, 2967, -1 },
+    { 10296, 2966, -1 }, { 10367, 786, -1 }, { 10313, 2142, -1 }, { 10321, 2967, -1 }, { 10299, 2967, -1 }, { 10315, 2143, -1 },
+    { 10292, 2967, -1 }, { 10332, 3208, -1 }, { 10317, 3207, -1 }, { 10370, 3207, -1 }, { 10317, 2967, -1 }, { 10314, 3207, -1 },
+    { 10389, 811, -1 }, { 10388, 1633, -1 }, { 10333, 1634, -1 }, { 10385, 1638, -1 }, { 10348, 816, -1 }, { 10330, 1196, -1 },
+    { 10376, 821, -1 }, { 10345, 835, -1 }, { 10364, 3208, -1 }, { 10354, 1202, -1 }, { 10397, 1203, -1 }, { 10402, 846, -1 },
+    { 10350, 3209, -1 }, { 10356, 854, -1 }, { 10376, 869, -1 }, { 10387, 874, -1 }, { 10355, 880, -1 }, { 10382, 3264, -1 },
+    { 10366, 3266, -1 }, { 10322, 3208, -1 }, { 10352, 3268, -1 }, { 10375, 888, -1 }, { 10308, 2967, -1 }, { 10417, 893, -1 },
+    { 10347, 1634, -1 }, { 10391, 3265, -1 }, { 10403, 1203, -1 }, { 10363, 911, -1 }, { 10338, 3208, -1 }, { 10413, 3269, -1 },
+    { 10375, 3208, -1 }, { 10366, 3208, -1 }, { 10415, 3269, -1 }, { 10351, 3208, -1 }, { 10397, 1889, -1 }, { 10384, 3265, -1 },
+    { 10410, 1890, -1 }, { 10410, 1890, -1 }, { 10391, 1893, -1 }, { 10415, 920, -1 }, { 10382, 3208, -1 }, { 10415, 924, -1 },
+    { 10415, 922, -1 }, { 10373, 931, -1 }, { 10424, 935, -1 }, { 10417, 944, -1 }, { 10431, 2799, -1 }, { 10374, 2801, -1 },
+    { 10431, 2802, -1 }, { 10423, 2803, -1 }, { 10429, 3584, -1 }, { 10512, 946, -1 }, { 10508, 948, -1 }, { 10330, 3208, -1 },
+    { 10437, 3585, -1 }, { 10409, 3585, -1 }, { 10430, 3585, -1 }, { 10371, 1890, -1 }, { 10416, 3585, -1 }, { 10431, 3586, -1 },
+    { 10487, 980, -1 }, { 10420, 3585, -1 }, { 10438, 3586, -1 }, { 10535, 961, -1 }, { 10438, 3586, -1 }, { 10538, 1013, -1 },
+    { 10496, 1018, -1 }, { 10448, 3586, -1 }, { 10402, 3586, -1 }, { 10426, 3586, -1 }, { 10447, 3586, -1 }, { 10492, 992, -1 },
+    { 10455, 3586, -1 }, { 10541, 1001, -1 }, { 10519, 1121, -1 }, { 10541, 961, -1 }, { 10406, 3586, -1 }, { 10525, 1123, -1 },
+    { 10445, 3586, -1 }, { 10494, 1032, -1 }, { 10376, 920, -1 }, { 10435, 3586, -1 }, { 10446, 3587, -1 }, { 10499, 1046, -1 },
+    { 10420, 3587, -1 }, { 10513, 1055, -1 }, { 10433, 3586, -1 }, { 10413, 3586, -1 }, { 10531, 1058, -1 }, { 10550, 1653, -1 },
+    { 10505, 1655, -1 }, { 10512, 1656, -1 }, { 10543, 1229, -1 }, { 10422, 3586, -1 }, { 10417, 3586, -1 }, { 10444, 3586, -1 },
+    { 10528, 1230, -1 }, { 10442, 3586, -1 }, { 10442, 3586, -1 }, { 10468, 3586, -1 }, { 10512, 1064, -1 }, { 10550, 1081, -1 },
+    { 10514, 1088, -1 }, { 10429, 3587, -1 }, { 10454, 3586, -1 }, { 10548, 1092, -1 }, { 10466, 3587, -1 }, { 10457, 3587, -1 },
+    { 10475, 3587, -1 }, { 10529, 3592, -1 }, { 10572, 3596, -1 }, { 10439, 3587, -1 }, { 10525, 3597, -1 }, { 10526, 3593, -1 },
+    { 10522, 1099, -1 }, { 10482, 3587, -1 }, { 10421, 3586, -1 }, { 10466, 3586, -1 }, { 10533, 3593, -1 }, { 10459, 3586, -1 },
+    { 10525, 3595, -1 }, { 10532, 1114, -1 }, { 10493, 3588, -1 }, { 10563, 1949, -1 }, { 10559, 3594, -1 }, { 10557, 1950, -1 },
+    { 10457, 3587, -1 }, { 10450, 3587, -1 }, { 10489, 3587, -1 }, { 10475, 3587, -1 }, { 10474, 3587, -1 }, { 10464, 3587, -1 },
+    { 10459, 3587, -1 }, { 10465, 3587, -1 }, { 10489, 3588, -1 }, { 10570, 1953, -1 }, { 10566, 3594, -1 }, { 10533, 1118, -1 },
+    { 10459, 3587, -1 }, { 10472, 3588, -1 }, { 10479, 3588, -1 }, { 10533, 1132, -1 }, { 10496, 3589, -1 }, { 10514, 3594, -1 },
+    { 10556, 1130, -1 }, { 10532, 1165, -1 }, { 10519, 3595, -1 }, { 10561, 1168, -1 }, { 10578, 1153, -1 }, { 10469, 3589, -1 },
+    { 10562, 3593, -1 }, { 10531, 1130, -1 }, { 10561, 1161, -1 }, { 10586, 1172, -1 }, { 10537, 1176, -1 }, { 10509, 3589, -1 },
+    { 10557, 1180, -1 }, { 10548, 1183, -1 }, { 10542, 1191, -1 }, { 10555, 1209, -1 }, { 10537, 3594, -1 }, { 10492, 3588, -1 },
+    { 10592, 1222, -1 }, { 10548, 1238, -1 }, { 10573, 1209, -1 }, { 10564, 1667, -1 }, { 10601, 1670, -1 }, { 10605, 1239, -1 },
+    { 10607, 1970, -1 }, { 10460, 3588, -1 }, { 10567, 1668, -1 }, { 10493, 3589, -1 }, { 10482, 3590, -1 }, { 10581, 1972, -1 },
+    { 10473, 3590, -1 }, { 10498, 3589, -1 }, { 10509, 3590, -1 }, { 10552, 1973, -1 }, { 10465, 3588, -1 }, { 10450, 3588, -1 },
+    { 10467, 3588, -1 }, { 10477, 3588, -1 }, { 10459, 3589, -1 }, { 10560, 1257, -1 }, { 10603, 2382, -1 }, { 10569, 2380, -1 },
+    { 10456, 3589, -1 }, { 10614, 1332, -1 }, { 10485, 3589, -1 }, { 10572, 1668, -1 }, { 10587, 2380, -1 }, { 10571, 2381, -1 },
+    { 10477, 3590, -1 }, { 10574, 2381, -1 }, { 10616, 2457, -1 }, { 10578, 2459, -1 }, { 10474, 3590, -1 }, { 10522, 3590, -1 },
+    { 10512, 3589, -1 }, { 10612, 1331, -1 }, { 10479, 3590, -1 }, { 10594, 1331, -1 }, { 10474, 3590, -1 }, { 10504, 3590, -1 },
+    { 10520, 3590, -1 }, { 10585, 1130, -1 }, { 10545, 1668, -1 }, { 10592, 1273, -1 }, { 10582, 2455, -1 }, { 10623, 1281, -1 },
+    { 10577, 1283, -1 }, { 10612, 1291, -1 }, { 10574, 2381, -1 }, { 10600, 2455, -1 }, { 10576, 2456, -1 }, { 10635, 1296, -1 },
+    { 10624, 1300, -1 }, { 10586, 1302, -1 }, { 10596, 1332, -1 }, { 10591, 1318, -1 }, { 10603, 1332, -1 }, { 10593, 2381, -1 },
+    { 10571, 2457, -1 }, { 10585, 2456, -1 }, { 10588, 2202, -1 }, { 10588, 2456, -1 }, { 10621, 2203, -1 }, { 10630, 2205, -1 },
+    { 10612, 2206, -1 }, { 10638, 1320, -1 }, { 10573, 1332, -1 }, { 10623, 1322, -1 }, { 10626, 1324, -1 }, { 10644, 1575, -1 },
+    { 10634, 1576, -1 }, { 10639, 2202, -1 }, { 10645, 1337, -1 }, { 10628, 1346, -1 }, { 10610, 1585, -1 }, { 10599, 1586, -1 },
+    { 10607, 1348, -1 }, { 10647, 3843, -1 }, { 10641, 3844, -1 }, { 10678, 1364, -1 }, { 10588, 2456, -1 }, { 10631, 3846, -1 },
+    { 10646, 1378, -1 }, { 10649, 3844, -1 }, { 10629, 3844, -1 }, { 10604, 3844, -1 }, { 10616, 3844, -1 }, { 10666, 3845, -1 },
+    { 10638, 3844, -1 }, { 10669, 1388, -1 }, { 10692, 3847, -1 }, { 10646, 3845, -1 }, { 10655, 3844, -1 }, { 10632, 3844, -1 },
+    { 10642, 3845, -1 }, { 10679, 1601, -1 }, { 10688, 1602, -1 }, { 10697, 3219, -1 }, { 10657, 3221, -1 }, { 10675, 3222, -1 },
+    { 10659, 3223, -1 }, { 10704, 1397, -1 }, { 10679, 3845, -1 }, { 10681, 3848, -1 }, { 10629, 3846, -1 }, { 10639, 3847, -1 },
+    { 10687, 3846, -1 }, { 10642, 3844, -1 }, { 10623, 3844, -1 }, { 10637, 3846, -1 }, { 10668, 3844, -1 }, { 10716, 1401, -1 },
+    { 10728, 1392, -1 }, { 10657, 3847, -1 }, { 10630, 3844, -1 }, { 10690, 3847, -1 }, { 10687, 3848, -1 }, { 10679, 3846, -1 },
+    { 10694, 1410, -1 }, { 10690, 3846, -1 }, { 10713, 2426, -1 }, { 10644, 3848, -1 }, { 10701, 3220, -1 }, { 10649, 3220, -1 },
+    { 10647, 3845, -1 }, { 10698, 3220, -1 }, { 10641, 3845, -1 }, { 10716, 3285, -1 }, { 10697, 3285, -1 }, { 10733, 2430, -1 },
+    { 10648, 3220, -1 }, { 10686, 3848, -1 }, { 10709, 3285, -1 }, { 10642, 3844, -1 }, { 10721, 1420, -1 }, { 10629, 3846, -1 },
+    { 10684, 3845, -1 }, { 10679, 3284, -1 }, { 10705, 3281, -1 }, { 10742, 2514, -1 }, { 10717, 2517, -1 }, { 10670, 3844, -1 },
+    { 10693, 3281, -1 }, { 10756, 2427, -1 }, { 10709, 3281, -1 }, { 10692, 3281, -1 }, { 10659, 3282, -1 }, { 10700, 3283, -1 },
+    { 10696, 3282, -1 }, { 10686, 3283, -1 }, { 10718, 3282, -1 }, { 10715, 2427, -1 }, { 10746, 2686, -1 }, { 10718, 2427, -1 },
+    { 10768, 2682, -1 }, { 10736, 1492, -1 }, { 10698, 3221, -1 }, { 10731, 2513, -1 }, { 10685, 3283, -1 }, { 10680, 3283, -1 },
+    { 10704, 3283, -1 }, { 10733, 3284, -1 }, { 10687, 3284, -1 }, { 10776, 1458, -1 }, { 10758, 2513, -1 }, { 10771, 1490, -1 },
+    { 10767, 1490, -1 }, { 10671, 3282, -1 }, { 10694, 3284, -1 }, { 10763, 1461, -1 }, { 10747, 1422, -1 }, { 10729, 2682, -1 },
+    { 10718, 2427, -1 }, { 10755, 2513, -1 }, { 10786, 1529, -1 }, { 10719, 2683, -1 }, { 10762, 2683, -1 }, { 10768, 1533, -1 },
+    { 10719, 3282, -1 }, { 10735, 2684, -1 }, { 10751, 2684, -1 }, { 10757, 2684, -1 }, { 10775, 1427, -1 }, { 10765, 2683, -1 },
+    { 10802, 4180, -1 }, { 10766, 4181, -1 }, { 10795, 4180, -1 }, { 10808, 4183, -1 }, { 10701, 3282, -1 }, { 10758, 2682, -1 },
+    { 10764, 4181, -1 }, { 10768, 2684, -1 }, { 10802, 4184, -1 }, { 10679, 3284, -1 }, { 10693, 3284, -1 }, { 10785, 4185, -1 },
+    { 10730, 2684, -1 }, { 10771, 1529, -1 }, { 10760, 1697, -1 }, { 10677, 3282, -1 }, { 10691, 3282, -1 }, { 10720, 2682, -1 },
+    { 10715, 3282, -1 }, { 10777, 2683, -1 }, { 10736, 2683, -1 }, { 10769, 4182, -1 }, { 10782, 1529, -1 }, { 10771, 2683, -1 },
+    { 10773, 2682, -1 }, { 10767, 4182, -1 }, { 10756, 1701, -1 }, { 10763, 1703, -1 }, { 10809, 1707, -1 }, { 10763, 1622, -1 },
+    { 10738, 2683, -1 }, { 10763, 1625, -1 }, { 10774, 1448, -1 }, { 10770, 1454, -1 }, { 10793, 1560, -1 }, { 10776, 1558, -1 },
+    { 10770, 2683, -1 }, { 10799, 1558, -1 }, { 10819, 2981, -1 }, { 10808, 2982, -1 }, { 10797, 2985, -1 }, { 10790, 2986, -1 },
+    { 10785, 1469, -1 }, { 10781, 4563, -1 }, { 10831, 4565, -1 }, { 10808, 4563, -1 }, { 10811, 4564, -1 }, { 10857, 1715, -1 },
+    { 10830, 4568, -1 }, { 10819, 2986, -1 }, { 10838, 1719, -1 }, { 10791, 4564, -1 }, { 10853, 2066, -1 }, { 10838, 2069, -1 },
+    { 10838, 4564, -1 }, { 10844, 4566, -1 }, { 10811, 4567, -1 }, { 10813, 2070, -1 }, { 10782, 4181, -1 }, { 10856, 1775, -1 },
+    { 10819, 4564, -1 }, { 10840, 1779, -1 }, { 10851, 1478, -1 }, { 10822, 1497, -1 }, { 10841, 4564, -1 }, { 10852, 1519, -1 },
+    { 10832, 4568, -1 }, { 10867, 1572, -1 }, { 10872, 1596, -1 }, { 10824, 1524, -1 }, { 10842, 1715, -1 }, { 10838, 1628, -1 },
+    { 10781, 4564, -1 }, { 10837, 4566, -1 }, { 10803, 1558, -1 }, { 10788, 2982, -1 }, { 10824, 4567, -1 }, { 10824, 4568, -1 },
+    { 10855, 4568, -1 }, { 10862, 1524, -1 }, { 10872, 1636, -1 }, { 10837, 4564, -1 }, { 10850, 1646, -1 }, { 10830, 4565, -1 },
+    { 10860, 1678, -1 }, { 10885, 1679, -1 }, { 10843, 4566, -1 }, { 10828, 4565, -1 }, { 10861, 2013, -1 }, { 10844, 4565, -1 },
+    { 10783, 2985, -1 }, { 10793, 4566, -1 }, { 10837, 2014, -1 }, { 10836, 2016, -1 }, { 10886, 1746, -1 }, { 10820, 4567, -1 },
+    { 10841, 1748, -1 }, { 10834, 4566, -1 }, { 10894, 1825, -1 }, { 10844, 1821, -1 }, { 10891, 2134, -1 }, { 10805, 2982, -1 },
+    { 10885, 2135, -1 }, { 10845, 2137, -1 }, { 10801, 4566, -1 }, { 10892, 1821, -1 }, { 10842, 1681, -1 }, { 10822, 4564, -1 },
+    { 10885, 1725, -1 }, { 10873, 1726, -1 }, { 10856, 1694, -1 }, { 10895, 1706, -1 }, { 10866, 2544, -1 }, { 10852, 2545, -1 },
+    { 10900, 2546, -1 }, { 10873, 2737, -1 }, { 10907, 2739, -1 }, { 10884, 2544, -1 }, { 10883, 2742, -1 }, { 10874, 1863, -1 },
+    { 10891, 2737, -1 }, { 10869, 2545, -1 }, { 10875, 2738, -1 }, { 10872, 2545, -1 }, { 10878, 2738, -1 }, { 10893, 1859, -1 },
+    { 10885, 1709, -1 }, { 10873, 1859, -1 }, { 10858, 2016, -1 }, { 10891, 1712, -1 }, { 10879, 1738, -1 }, { 10855, 1726, -1 },
+    { 10854, 1726, -1 }, { 10916, 2695, -1 }, { 10889, 2738, -1 }, { 10915, 2697, -1 }, { 10910, 2696, -1 }, { 10890, 1741, -1 },
+    { 10902, 1863, -1 }, { 10915, 2696, -1 }, { 10892, 2747, -1 }, { 10907, 2748, -1 }, { 10872, 2545, -1 }, { 10879, 2738, -1 },
+    { 10850, 2016, -1 }, { 10885, 2749, -1 }, { 10922, 2574, -1 }, { 10895, 2575, -1 }, { 10937, 2578, -1 }, { 10893, 2590, -1 },
+    { 10848, 2134, -1 }, { 10925, 2591, -1 }, { 10923, 2594, -1 }, { 10899, 1751, -1 }, { 10943, 4581, -1 }, { 10929, 4583, -1 },
+    { 10896, 4582, -1 }, { 10912, 4584, -1 }, { 10914, 1757, -1 }, { 10933, 4586, -1 }, { 10895, 2748, -1 }, { 10932, 4584, -1 },
+    { 10957, 1800, -1 }, { 10924, 2748, -1 }, { 10889, 2748, -1 }, { 10900, 4582, -1 }, { 10952, 4585, -1 }, { 10941, 1801, -1 },
+    { 10919, 2079, -1 }, { 10927, 2081, -1 }, { 10923, 2083, -1 }, { 10962, 1777, -1 }, { 10960, 4587, -1 }, { 10973, 3603, -1 },
+    { 10995, 3607, -1 }, { 10963, 4587, -1 }, { 10990, 4591, -1 }, { 11004, 4592, -1 }, { 10956, 4584, -1 }, { 10934, 4585, -1 },
+    { 10883, 2696, -1 }, { 10903, 4583, -1 }, { 10955, 4583, -1 }, { 10975, 1789, -1 }, { 11001, 2087, -1 }, { 10891, 4582, -1 },
+    { 10935, 4586, -1 }, { 10964, 4586, -1 }, { 10974, 4589, -1 }, { 10902, 4585, -1 }, { 10935, 4583, -1 }, { 10954, 4585, -1 },
+    { 10965, 4590, -1 }, { 10937, 4582, -1 }, { 10916, 4588, -1 }, { 10944, 4588, -1 }, { 10950, 4592, -1 }, { 10995, 2088, -1 },
+    { 11021, 2757, -1 }, { 10984, 3606, -1 }, { 10942, 4588, -1 }, { 10977, 3606, -1 }, { 10982, 4591, -1 }, { 11031, 2758, -1 },
+    { 10924, 4588, -1 }, { 10967, 4588, -1 }, { 11008, 2761, -1 }, { 10942, 4589, -1 }, { 10962, 4590, -1 }, { 10956, 4589, -1 },
+    { 10950, 4592, -1 }, { 11015, 1791, -1 }, { 10996, 4592, -1 }, { 10960, 4585, -1 }, { 10973, 2085, -1 }, { 10979, 2085, -1 },
+    { 11018, 1806, -1 }, { 10923, 4588, -1 }, { 10955, 4588, -1 }, { 10993, 1831, -1 }, { 11010, 3604, -1 }, { 10957, 4591, -1 },
+    { 11020, 1892, -1 }, { 11032, 1896, -1 }, { 10932, 4589, -1 }, { 10997, 1964, -1 }, { 11009, 1965, -1 }, { 10968, 4589, -1 },
+    { 10951, 4590, -1 }, { 10954, 4591, -1 }, { 10964, 3604, -1 }, { 11023, 2292, -1 }, { 10954, 3604, -1 }, { 11020, 2294, -1 },
+    { 10981, 4590, -1 }, { 10972, 3605, -1 }, { 11028, 2295, -1 }, { 10985, 3605, -1 }, { 10929, 4588, -1 }, { 10997, 2085, -1 },
+    { 11002, 2126, -1 }, { 10990, 2085, -1 }, { 10979, 3605, -1 }, { 11000, 2125, -1 }, { 11045, 4593, -1 }, { 11005, 4593, -1 },
+    { 10964, 4588, -1 }, { 10944, 4590, -1 }, { 10985, 3606, -1 }, { 10960, 4590, -1 }, { 11029, 2085, -1 }, { 11091, 1840, -1 },
+    { 11038, 2125, -1 }, { 10986, 4588, -1 }, { 11005, 3604, -1 }, { 11081, 1875, -1 }, { 11027, 4595, -1 }, { 11099, 1878, -1 },
+    { 11090, 2158, -1 }, { 11048, 4594, -1 }, { 11107, 2159, -1 }, { 10981, 3604, -1 }, { 11064, 1842, -1 }, { 10956, 3604, -1 },
+    { 11019, 3604, -1 }, { 11003, 3605, -1 }, { 11016, 4594, -1 }, { 11004, 4594, -1 }, { 11060, 3116, -1 }, { 11050, 4594, -1 },
+    { 11023, 4596, -1 }, { 11074, 3118, -1 }, { 11055, 3119, -1 }, { 11039, 2125, -1 }, { 11077, 2633, -1 }, { 11009, 4595, -1 },
+    { 11101, 3120, -1 }, { 11074, 2637, -1 }, { 11015, 4595, -1 }, { 11090, 2638, -1 }, { 11109, 2635, -1 }, { 11051, 4597, -1 },
+    { 11034, 4597, -1 }, { 11063, 4597, -1 }, { 11050, 4594, -1 }, { 11043, 4596, -1 }, { 11065, 2635, -1 }, { 11083, 3120, -1 },
+    { 11091, 1853, -1 }, { 11071, 2635, -1 }, { 11005, 4594, -1 }, { 11034, 4596, -1 }, { 11004, 4594, -1 }, { 11063, 2637, -1 },
+    { 11062, 4597, -1 }, { 11033, 2125, -1 }, { 11016, 4595, -1 }, { 11092, 1858, -1 }, { 11079, 4596, -1 }, { 11117, 3699, -1 },
+    { 11069, 3700, -1 }, { 11125, 3702, -1 }, { 11087, 1865, -1 }, { 11053, 4594, -1 }, { 11023, 4596, -1 }, { 11020, 4596, -1 },
+    { 11074, 4595, -1 }, { 11058, 4597, -1 }, { 11041, 4596, -1 }, { 11015, 4594, -1 }, { 11028, 4594, -1 }, { 11017, 4594, -1 },
+    { 11130, 3701, -1 }, { 11058, 4594, -1 }, { 11054, 4594, -1 }, { 11074, 3698, -1 }, { 11096, 1922, -1 }, { 11071, 4598, -1 },
+    { 11035, 4596, -1 }, { 11066, 4596, -1 }, { 11032, 4598, -1 }, { 11069, 4596, -1 }, { 11093, 3698, -1 }, { 11084, 1924, -1 },
+    { 11091, 4598, -1 }, { 11106, 2270, -1 }, { 11076, 4598, -1 }, { 11070, 4598, -1 }, { 11065, 4598, -1 }, { 11132, 2271, -1 },
+    { 11088, 3701, -1 }, { 11093, 2273, -1 }, { 11093, 1914, -1 }, { 11111, 2275, -1 }, { 11092, 1927, -1 }, { 11082, 4597, -1 },
+    { 11052, 4598, -1 }, { 11126, 1939, -1 }, { 11096, 1931, -1 }, { 11109, 2317, -1 }, { 11149, 2318, -1 }, { 11050, 4597, -1 },
+    { 11042, 4598, -1 }, { 11083, 4598, -1 }, { 11118, 2275, -1 }, { 11095, 1931, -1 }, { 11138, 2273, -1 }, { 11098, 2320, -1 },
+    { 11115, 1865, -1 }, { 11126, 3097, -1 }, { 11130, 2275, -1 }, { 11092, 3098, -1 }, { 11133, 3099, -1 }, { 11145, 3101, -1 },
+    { 11103, 3698, -1 }, { 11100, 2163, -1 }, { 11129, 2164, -1 }, { 11136, 2431, -1 }, { 11156, 2432, -1 }, { 11158, 2436, -1 },
+    { 11123, 2271, -1 }, { 11112, 1943, -1 }, { 11129, 4599, -1 }, { 11142, 4602, -1 }, { 11114, 4600, -1 }, { 11157, 2432, -1 },
+    { 11148, 4600, -1 }, { 11182, 1952, -1 }, { 11142, 4601, -1 }, { 11156, 3301, -1 }, { 11078, 3698, -1 }, { 11170, 4600, -1 },
+    { 11131, 4601, -1 }, { 11163, 4600, -1 }, { 11166, 4604, -1 }, { 11124, 3101, -1 }, { 11145, 4601, -1 }, { 11184, 4603, -1 },
+    { 11126, 4601, -1 }, { 11152, 4604, -1 }, { 11154, 3303, -1 }, { 11164, 4603, -1 }, { 11143, 4603, -1 }, { 11192, 4603, -1 },
+    { 11132, 4602, -1 }, { 11164, 4601, -1 }, { 11197, 3305, -1 }, { 11121, 4600, -1 }, { 11142, 4600, -1 }, { 11176, 4601, -1 },
+    { 11162, 4601, -1 }, { 11142, 1947, -1 }, { 11177, 3306, -1 }, { 11176, 1947, -1 }, { 11177, 1947, -1 }, { 11154, 1957, -1 },
+    { 11146, 4600, -1 }, { 11142, 4600, -1 }, { 11157, 3302, -1 }, { 11154, 2449, -1 }, { 11189, 3302, -1 }, { 11195, 2450, -1 },
+    { 11176, 2452, -1 }, { 11204, 1975, -1 }, { 11165, 2000, -1 }, { 11164, 2003, -1 }, { 11173, 2007, -1 }, { 11159, 2011, -1 },
+    { 11110, 2432, -1 }, { 11206, 2020, -1 }, { 11174, 2033, -1 }, { 11208, 2037, -1 }, { 11128, 4600, -1 }, { 11163, 4604, -1 },
+    { 11215, 2449, -1 }, { 11169, 4601, -1 }, { 11166, 1943, -1 }, { 11175, 2175, -1 }, { 11216, 2176, -1 }, { 11184, 2221, -1 },
+    { 11218, 2224, -1 }, { 11166, 3302, -1 }, { 11201, 2048, -1 }, { 11226, 2264, -1 }, { 11180, 4603, -1 }, { 11181, 4603, -1 },
+    { 11177, 2265, -1 }, { 11233, 2056, -1 }, { 11181, 2096, -1 }, { 11138, 4603, -1 }, { 11237, 2104, -1 }, { 11218, 2110, -1 },
+    { 11214, 2145, -1 }, { 11207, 2194, -1 }, { 11202, 2199, -1 }, { 11215, 2208, -1 }, { 11225, 2210, -1 }, { 11209, 3831, -1 },
+    { 11256, 3834, -1 }, { 11261, 2464, -1 }, { 11237, 3835, -1 }, { 11195, 3831, -1 }, { 11191, 3831, -1 }, { 11211, 2465, -1 },
+    { 11195, 3832, -1 }, { 11221, 2226, -1 }, { 11234, 2245, -1 }, { 11259, 2247, -1 }, { 11196, 3831, -1 }, { 11246, 2229, -1 },
+    { 11255, 2520, -1 }, { 11238, 3834, -1 }, { 11218, 3831, -1 }, { 11176, 2037, -1 }, { 11209, 3835, -1 }, { 11255, 2521, -1 },
+    { 11218, 3833, -1 }, { 11180, 2096, -1 }, { 11228, 2523, -1 }, { 11282, 2253, -1 }, { 11273, 2255, -1 }, { 11225, 3835, -1 },
+    { 11276, 2284, -1 }, { 11256, 3834, -1 }, { 11233, 3833, -1 }, { 11238, 2521, -1 }, { 11246, 2521, -1 }, { 11237, 2289, -1 },
+    { 11273, 2245, -1 }, { 11232, 2297, -1 }, { 11258, 3833, -1 }, { 11264, 2341, -1 }, { 11256, 2346, -1 }, { 11285, 2485, -1 },
+    { 11285, 2486, -1 }, { 11285, 2724, -1 }, { 11251, 2727, -1 }, { 11232, 2728, -1 }, { 11277, 2299, -1 }, { 11291, 2559, -1 },
+    { 11267, 2560, -1 }, { 11266, 2307, -1 }, { 11212, 3831, -1 }, { 11201, 3832, -1 }, { 11218, 3832, -1 }, { 11251, 2313, -1 },
+    { 11228, 3831, -1 }, { 11193, 3832, -1 }, { 11201, 3832, -1 }, { 11298, 2325, -1 }, { 11224, 3832, -1 }, { 11248, 2327, -1 },
+    { 11236, 3832, -1 }, { 11204, 3833, -1 }, { 11227, 3833, -1 }, { 11280, 2333, -1 }, { 11228, 3832, -1 }, { 11293, 2337, -1 },
+    { 11266, 2523, -1 }, { 11243, 2353, -1 }, { 11292, 2355, -1 }, { 11300, 2360, -1 }, { 11254, 2367, -1 }, { 11268, 3823, -1 },
+    { 11254, 3824, -1 }, { 11307, 3824, -1 }, { 11303, 3825, -1 }, { 11306, 3827, -1 }, { 11286, 3823, -1 }, { 11286, 3828, -1 },
+    { 11285, 4165, -1 }, { 11313, 4163, -1 }, { 11272, 3824, -1 }, { 11304, 4166, -1 }, { 11275, 3824, -1 }, { 11322, 4164, -1 },
+    { 11319, 4164, -1 }, { 11330, 2372, -1 }, { 11291, 2416, -1 }, { 11336, 2419, -1 }, { 11317, 4163, -1 }, { 11323, 4167, -1 },
+    { 11279, 4167, -1 }, { 11334, 3274, -1 }, { 11304, 4166, -1 }, { 11311, 4163, -1 }, { 11312, 3825, -1 }, { 11312, 3275, -1 },
+    { 11336, 4167, -1 }, { 11329, 3276, -1 }, { 11344, 3278, -1 }, { 11298, 4167, -1 }, { 11290, 3275, -1 }, { 11275, 3824, -1 },
+    { 11317, 4163, -1 }, { 11353, 2388, -1 }, { 11344, 2603, -1 }, { 11351, 2604, -1 }, { 11349, 2603, -1 }, { 11346, 2390, -1 },
+    { 11359, 2499, -1 }, { 11307, 2390, -1 }, { 11313, 4163, -1 }, { 11349, 2502, -1 }, { 11308, 2568, -1 }, { 11329, 2570, -1 },
+    { 11352, 2572, -1 }, { 11307, 2763, -1 }, { 11352, 2764, -1 }, { 11275, 4164, -1 }, { 11323, 2768, -1 }, { 11319, 2395, -1 },
+    { 11352, 2612, -1 }, { 11308, 2613, -1 }, { 11276, 4165, -1 }, { 11313, 4165, -1 }, { 11331, 4167, -1 }, { 11360, 2405, -1 },
+    { 11285, 4166, -1 }, { 11315, 4165, -1 }, { 11325, 2577, -1 }, { 11344, 2581, -1 }, { 11364, 2410, -1 }, { 11325, 2437, -1 },
+    { 11351, 2439, -1 }, { 11317, 4163, -1 }, { 11292, 4166, -1 }, { 11294, 4163, -1 }, { 11377, 2462, -1 }, { 11348, 2471, -1 },
+    { 11381, 2495, -1 }, { 11366, 2650, -1 }, { 11296, 4166, -1 }, { 11381, 2653, -1 }, { 11382, 2497, -1 }, { 11355, 2509, -1 },
+    { 11377, 2659, -1 }, { 11353, 2662, -1 }, { 11387, 2784, -1 }, { 11378, 2788, -1 }, { 11363, 2439, -1 }, { 11380, 2516, -1 },
+    { 11381, 2541, -1 }, { 11372, 2577, -1 }, { 11388, 2555, -1 }, { 11396, 2584, -1 }, { 11346, 2615, -1 }, { 11386, 2624, -1 },
+    { 11376, 2644, -1 }, { 11368, 2613, -1 }, { 11388, 2655, -1 }, { 11370, 2657, -1 }, { 11394, 2673, -1 }, { 11347, 2688, -1 },
+    { 11370, 2691, -1 }, { 11392, 2674, -1 }, { 11394, 2699, -1 }, { 11395, 2701, -1 }, { 11407, 2707, -1 }, { 11369, 2709, -1 },
+    { 11378, 4605, -1 }, { 11409, 4606, -1 }, { 11388, 4606, -1 }, { 11353, 4606, -1 }, { 11409, 4606, -1 }, { 11448, 2771, -1 },
+    { 11378, 4605, -1 }, { 11378, 4607, -1 }, { 11370, 4607, -1 }, { 11368, 4606, -1 }, { 11458, 2772, -1 }, { 11393, 4606, -1 },
+    { 11410, 4606, -1 }, { 11409, 2773, -1 }, { 11385, 4607, -1 }, { 11429, 4607, -1 }, { 11412, 2710, -1 }, { 11396, 4607, -1 },
+    { 11378, 4607, -1 }, { 11452, 2782, -1 }, { 11395, 4609, -1 }, { 11466, 2972, -1 }, { 11431, 4609, -1 }, { 11462, 4611, -1 },
+    { 11445, 2782, -1 }, { 11430, 4613, -1 }, { 11464, 4613, -1 }, { 11455, 4611, -1 }, { 11446, 4610, -1 }, { 11450, 2969, -1 },
+    { 11402, 4607, -1 }, { 11418, 4606, -1 }, { 11496, 3019, -1 }, { 11416, 4607, -1 }, { 11345, 2555, -1 }, { 11409, 4606, -1 },
+    { 11394, 4608, -1 }, { 11381, 4608, -1 }, { 11378, 4607, -1 }, { 11437, 4607, -1 }, { 11475, 4613, -1 }, { 11398, 4606, -1 },
+    { 11389, 4606, -1 }, { 11366, 4606, -1 }, { 11446, 4613, -1 }, { 11486, 4614, -1 }, { 11407, 4610, -1 }, { 11492, 3022, -1 },
+    { 11429, 4608, -1 }, { 11446, 4614, -1 }, { 11420, 4608, -1 }, { 11481, 4615, -1 }, { 11453, 4610, -1 }, { 11373, 4606, -1 },
+    { 11421, 2783, -1 }, { 11414, 2783, -1 }, { 11410, 4606, -1 }, { 11403, 4609, -1 }, { 11447, 4609, -1 }, { 11408, 4610, -1 },
+    { 11421, 2969, -1 }, { 11453, 3076, -1 }, { 11479, 3076, -1 }, { 11431, 2783, -1 }, { 11425, 4609, -1 }, { 11434, 2783, -1 },
+    { 11453, 4614, -1 }, { 11381, 4608, -1 }, { 11409, 2710, -1 }, { 11475, 4612, -1 }, { 11440, 4612, -1 }, { 11465, 4615, -1 },
+    { 11443, 4612, -1 }, { 11448, 4609, -1 }, { 11406, 4609, -1 }, { 11479, 4616, -1 }, { 11488, 3075, -1 }, { 11509, 3080, -1 },
+    { 11488, 3018, -1 }, { 11500, 3075, -1 }, { 11494, 2957, -1 }, { 11500, 2961, -1 }, { 11496, 4622, -1 }, { 11524, 2732, -1 },
+    { 11434, 2783, -1 }, { 11473, 4612, -1 }, { 11466, 4616, -1 }, { 11494, 3018, -1 }, { 11510, 2721, -1 }, { 11487, 3018, -1 },
+    { 11521, 2721, -1 }, { 11429, 4612, -1 }, { 11512, 4619, -1 }, { 11517, 4619, -1 }, { 11503, 4617, -1 }, { 11450, 2961, -1 },
+    { 11509, 4617, -1 }, { 11494, 4617, -1 }, { 11475, 4618, -1 }, { 11485, 4617, -1 }, { 11488, 4618, -1 }, { 11454, 3018, -1 },
+    { 11531, 3156, -1 }, { 11484, 4616, -1 }, { 11476, 4620, -1 }, { 11485, 4618, -1 }, { 11537, 4621, -1 }, { 11488, 4620, -1 },
+    { 11538, 3157, -1 }, { 11510, 4621, -1 }, { 11490, 4621, -1 }, { 11493, 3160, -1 }, { 11436, 4612, -1 }, { 11494, 4619, -1 },
+    { 11469, 4618, -1 }, { 11530, 2751, -1 }, { 11531, 2756, -1 }, { 11509, 2789, -1 }, { 11551, 2790, -1 }, { 11554, 2805, -1 },
+    { 11518, 2833, -1 }, { 11558, 2834, -1 }, { 11555, 2833, -1 }, { 11555, 3248, -1 }, { 11519, 3249, -1 }, { 11554, 3250, -1 },
+    { 11496, 4618, -1 }, { 11501, 4618, -1 }, { 11567, 3249, -1 }, { 11489, 4618, -1 }, { 11516, 3251, -1 }, { 11509, 4619, -1 },
+    { 11551, 2990, -1 }, { 11543, 2993, -1 }, { 11533, 2826, -1 }, { 11562, 2858, -1 }, { 11502, 4618, -1 }, { 11478, 4619, -1 },
+    { 11559, 2860, -1 }, { 11555, 4623, -1 }, { 11549, 4624, -1 }, { 11584, 4626, -1 }, { 11592, 4627, -1 }, { 11551, 4628, -1 },
+    { 11527, 3249, -1 }, { 11551, 2874, -1 }, { 11595, 2882, -1 }, { 11568, 2834, -1 }, { 11548, 2895, -1 }, { 11576, 2912, -1 },
+    { 11493, 4618, -1 }, { 11539, 4625, -1 }, { 11504, 4618, -1 }, { 11513, 4621, -1 }, { 11540, 4627, -1 }, { 11544, 4625, -1 },
+    { 11549, 2918, -1 }, { 11550, 2932, -1 }, { 11582, 2959, -1 }, { 11511, 4621, -1 }, { 11586, 4625, -1 }, { 11586, 4627, -1 },
+    { 11596, 2968, -1 }, { 11522, 3249, -1 }, { 11596, 3009, -1 }, { 11610, 3010, -1 }, { 11603, 3009, -1 }, { 11536, 2834, -1 },
+    { 11499, 4621, -1 }, { 11535, 4621, -1 }, { 11600, 3012, -1 }, { 11589, 2979, -1 }, { 11566, 2984, -1 }, { 11527, 2834, -1 },
+    { 11576, 4625, -1 }, { 11538, 4628, -1 }, { 11589, 4625, -1 }, { 11561, 3045, -1 }, { 11542, 2895, -1 }, { 11604, 3049, -1 },
+    { 11592, 2995, -1 }, { 11610, 3001, -1 }, { 11608, 3002, -1 }, { 11570, 4626, -1 }, { 11580, 3007, -1 }, { 11615, 3015, -1 },
+    { 11617, 3023, -1 }, { 11570, 3023, -1 }, { 11620, 3070, -1 }, { 11615, 3074, -1 }, { 11579, 3170, -1 }, { 11576, 3074, -1 },
+    { 11583, 3172, -1 }, { 11619, 3174, -1 }, { 11628, 3032, -1 }, { 11577, 3033, -1 }, { 11613, 3038, -1 }, { 11595, 4628, -1 },
+    { 11623, 3047, -1 }, { 11574, 3015, -1 }, { 11580, 3052, -1 }, { 11628, 3138, -1 }, { 11638, 3054, -1 }, { 11620, 3133, -1 },
+    { 11617, 3107, -1 }, { 11572, 4627, -1 }, { 11632, 3133, -1 }, { 11614, 3133, -1 }, { 11581, 3109, -1 }, { 11620, 3060, -1 },
+    { 11593, 3085, -1 }, { 11639, 3161, -1 }, { 11641, 3162, -1 }, { 11623, 3096, -1 }, { 11626, 3103, -1 }, { 11649, 3106, -1 },
+    { 11601, 3130, -1 }, { 11645, 3150, -1 }, { 11636, 3159, -1 }, { 11641, 4569, -1 }, { 11649, 4570, -1 }, { 11633, 4571, -1 },
+    { 11658, 4572, -1 }, { 11619, 4573, -1 }, { 11629, 3166, -1 }, { 11605, 3169, -1 }, { 11642, 4570, -1 }, { 11628, 3176, -1 },
+    { 11605, 3177, -1 }, { 11630, 3182, -1 }, { 11644, 3178, -1 }, { 11660, 3756, -1 }, { 11625, 3757, -1 }, { 11615, 3758, -1 },
+    { 11619, 3759, -1 }, { 11664, 3183, -1 }, { 11628, 3184, -1 }, { 11670, 3215, -1 }, { 11662, 3216, -1 }, { 11670, 3812, -1 },
+    { 11673, 3814, -1 }, { 11664, 3815, -1 }, { 11648, 3816, -1 }, { 11673, 4629, -1 }, { 11644, 4630, -1 }, { 11639, 4630, -1 },
+    { 11654, 4631, -1 }, { 11657, 3757, -1 }, { 11646, 4632, -1 }, { 11658, 4633, -1 }, { 11673, 3812, -1 }, { 11688, 3675, -1 },
+    { 11682, 3680, -1 }, { 11635, 4629, -1 }, { 11676, 3679, -1 }, { 11688, 3679, -1 }, { 11675, 4633, -1 }, { 11694, 3291, -1 },
+    { 11684, 3294, -1 }, { 11683, 3193, -1 }, { 11674, 3205, -1 }, { 11637, 3213, -1 }, { 11686, 3309, -1 }, { 11655, 3814, -1 },
+    { 11689, 3312, -1 }, { 11651, 3609, -1 }, { 11696, 3611, -1 }, { 11662, 3609, -1 }, { 11703, 3610, -1 }, { 11656, 3610, -1 },
+    { 11695, 3613, -1 }, { 11646, 3228, -1 }, { 11669, 3234, -1 }, { 11660, 3238, -1 }, { 11661, 3256, -1 }, { 11694, 3260, -1 },
+    { 11684, 3255, -1 }, { 11666, 3271, -1 }, { 11686, 3349, -1 }, { 11661, 3350, -1 }, { 11690, 3292, -1 }, { 11669, 3308, -1 },
+    { 11714, 3310, -1 }, { 11668, 3316, -1 }, { 11703, 3352, -1 }, { 11712, 3355, -1 }, { 11622, 4629, -1 }, { 11713, 3326, -1 },
+    { 11714, 3338, -1 }, { 11673, 3340, -1 }, { 11726, 3353, -1 }, { 11683, 3358, -1 }, { 11717, 3359, -1 }, { 11707, 3598, -1 },
+    { 11716, 3599, -1 }, { 11680, 3372, -1 }, { 11675, 3377, -1 }, { 11728, 4634, -1 }, { 11732, 4634, -1 }, { 11737, 4634, -1 },
+    { 11742, 4634, -1 }, { 11641, 4629, -1 }, { 11925, 3387, -1 }, { 11898, 3747, -1 }, { 11928, 3748, -1 }, { 11880, 3751, -1 },
+    { 11925, 3752, -1 }, { 11939, 4640, -1 }, { 11886, 3752, -1 }, { 11903, 4641, -1 }, { 11911, 4642, -1 }, { 11915, 4645, -1 },
+    { 11893, 4641, -1 }, { 11944, 3685, -1 }, { 11915, 4641, -1 }, { 11960, 3692, -1 }, { 11917, 3693, -1 }, { 11951, 3695, -1 },
+    { 11911, 4644, -1 }, { 11926, 4641, -1 }, { 11936, 4641, -1 }, { 11960, 3615, -1 }, { 11943, 3682, -1 }, { 11955, 3619, -1 },
+    { 11925, 3408, -1 }, { 11671, 3310, -1 }, { 11898, 4642, -1 }, { 11720, 3372, -1 }, { 11962, 3399, -1 }, { 11917, 3684, -1 },
+    { 11959, 3399, -1 }, { 11681, 4635, -1 }, { 11939, 4642, -1 }, { 11698, 4635, -1 }, { 11745, 4635, -1 }, { 11734, 4635, -1 },
+    { 11712, 4635, -1 }, { 11721, 4635, -1 }, { 11931, 4643, -1 }, { 11942, 3688, -1 }, { 11712, 4635, -1 }, { 11733, 3599, -1 },
+    { 11700, 4635, -1 }, { 11744, 4635, -1 }, { 11739, 4635, -1 }, { 11705, 4635, -1 }, { 11740, 4635, -1 }, { 11713, 4635, -1 },
+    { 11731, 4635, -1 }, { 11941, 4644, -1 }, { 11962, 3434, -1 }, { 11742, 4635, -1 }, { 11881, 3387, -1 }, { 11758, 4635, -1 },
+    { 11743, 4635, -1 }, { 11768, 4635, -1 }, { 11760, 4635, -1 }, { 11887, 4643, -1 }, { 11963, 3465, -1 }, { 11926, 3486, -1 },
+    { 11934, 4643, -1 }, { 11963, 3515, -1 }, { 11933, 3682, -1 }, { 11740, 4635, -1 }, { 11729, 4635, -1 }, { 11770, 4635, -1 },
+    { 11772, 4635, -1 }, { 11759, 4635, -1 }, { 11909, 4644, -1 }, { 11947, 3570, -1 }, { 11973, 3578, -1 }, { 11963, 3625, -1 },
+    { 11768, 4635, -1 }, { 11774, 4635, -1 }, { 11903, 3682, -1 }, { 11733, 4635, -1 }, { 11780, 4635, -1 }, { 11955, 3727, -1 },
+    { 11980, 3728, -1 }, { 11975, 3632, -1 }, { 11972, 4195, -1 }, { 11765, 4636, -1 }, { 11743, 4635, -1 }, { 11971, 3684, -1 },
+    { 11746, 4635, -1 }, { 11940, 4196, -1 }, { 11929, 4197, -1 }, { 11782, 4635, -1 }, { 11779, 4635, -1 }, { 11776, 4635, -1 },
+    { 11788, 4636, -1 }, { 11781, 4636, -1 }, { 11794, 4636, -1 }, { 11977, 4199, -1 }, { 11933, 4200, -1 }, { 11799, 4636, -1 },
+    { 11977, 3721, -1 }, { 11972, 3722, -1 }, { 11990, 3638, -1 }, { 11807, 4636, -1 }, { 11772, 4636, -1 }, { 11764, 4636, -1 },
+    { 11989, 3774, -1 }, { 11787, 4636, -1 }, { 11766, 4636, -1 }, { 11964, 3724, -1 }, { 11972, 3724, -1 }, { 11794, 4636, -1 },
+    { 11954, 3768, -1 }, { 11979, 3724, -1 }, { 11801, 4636, -1 }, { 11791, 4636, -1 }, { 11768, 4636, -1 }, { 11788, 4636, -1 },
+    { 11962, 3769, -1 }, { 11817, 4636, -1 }, { 11989, 3773, -1 }, { 11983, 3773, -1 }, { 11953, 3775, -1 }, { 11967, 3768, -1 },
+    { 11987, 3775, -1 }, { 11990, 3735, -1 }, { 11975, 3737, -1 }, { 11986, 3779, -1 }, { 11954, 3658, -1 }, { 11958, 3780, -1 },
+    { 11764, 4636, -1 }, { 11962, 3674, -1 }, { 11996, 3704, -1 }, { 11962, 3712, -1 }, { 11792, 4636, -1 }, { 11798, 4636, -1 },
+    { 12006, 4007, -1 }, { 11802, 4636, -1 }, { 11825, 4636, -1 }, { 11789, 4636, -1 }, { 11983, 4008, -1 }, { 11800, 4636, -1 },
+    { 11771, 4636, -1 }, { 11935, 3724, -1 }, { 11789, 4637, -1 }, { 11829, 4636, -1 }, { 11792, 4637, -1 }, { 12009, 4011, -1 },
+    { 12054, 3715, -1 }, { 11796, 4637, -1 }, { 11804, 4637, -1 }, { 11790, 4637, -1 }, { 11835, 4637, -1 }, { 12051, 3791, -1 },
+    { 11986, 4646, -1 }, { 12011, 3793, -1 }, { 11984, 3724, -1 }, { 11953, 3658, -1 }, { 11990, 4646, -1 }, { 11840, 4637, -1 },
+    { 12007, 3664, -1 }, { 12068, 3739, -1 }, { 12053, 4651, -1 }, { 11824, 4637, -1 }, { 11812, 4637, -1 }, { 11816, 4637, -1 },
+    { 12064, 3792, -1 }, { 11816, 4637, -1 }, { 11821, 4637, -1 }, { 11853, 4637, -1 }, { 12025, 3742, -1 }, { 11799, 4637, -1 },
+    { 12052, 3745, -1 }, { 11818, 4637, -1 }, { 11959, 3664, -1 }, { 12033, 3808, -1 }, { 12029, 3766, -1 }, { 11960, 3658, -1 },
+    { 12051, 3766, -1 }, { 11802, 4637, -1 }, { 12026, 3809, -1 }, { 12071, 3810, -1 }, { 12059, 4094, -1 }, { 11800, 4637, -1 },
+    { 12026, 4097, -1 }, { 12077, 4099, -1 }, { 12072, 4098, -1 }, { 11847, 4637, -1 }, { 11856, 4637, -1 }, { 12058, 4651, -1 },
+    { 11804, 4637, -1 }, { 12032, 3784, -1 }, { 12080, 4097, -1 }, { 11858, 4637, -1 }, { 11861, 4637, -1 }, { 12055, 4098, -1 },
+    { 11852, 4638, -1 }, { 12051, 4651, -1 }, { 11870, 4638, -1 }, { 12027, 4099, -1 }, { 11874, 4638, -1 }, { 11835, 4637, -1 },
+    { 11867, 4637, -1 }, { 11813, 4637, -1 }, { 12054, 4651, -1 }, { 11838, 4637, -1 }, { 11832, 4638, -1 }, { 11863, 4638, -1 },
+    { 11847, 4638, -1 }, { 11875, 4638, -1 }, { 12085, 3794, -1 }, { 11860, 4638, -1 }, { 11852, 4638, -1 }, { 12093, 3798, -1 },
+    { 11996, 3664, -1 }, { 11993, 4649, -1 }, { 12021, 3792, -1 }, { 12099, 3803, -1 }, { 11848, 4638, -1 }, { 12074, 3809, -1 },
+    { 12097, 3837, -1 }, { 11871, 4638, -1 }, { 12031, 3809, -1 }, { 11882, 4638, -1 }, { 12051, 3821, -1 }, { 12008, 4649, -1 },
+    { 12091, 3829, -1 }, { 12089, 3838, -1 }, { 12087, 3839, -1 }, { 11893, 4638, -1 }, { 12065, 3840, -1 }, { 11892, 4638, -1 },
+    { 12107, 3850, -1 }, { 11845, 4639, -1 }, { 11889, 4639, -1 }, { 12060, 3852, -1 }, { 11869, 4639, -1 }, { 12073, 3829, -1 },
+    { 11868, 4639, -1 }, { 11900, 4639, -1 }, { 11899, 4639, -1 }, { 11857, 4638, -1 }, { 12068, 3934, -1 }, { 12063, 3935, -1 },
+    { 12094, 3865, -1 }, { 12035, 4649, -1 }, { 12103, 3868, -1 }, { 12115, 3873, -1 }, { 11867, 4638, -1 }, { 11842, 4638, -1 },
+    { 12030, 4649, -1 }, { 11852, 4638, -1 }, { 12069, 3875, -1 }, { 11910, 4639, -1 }, { 11899, 4638, -1 }, { 12118, 3877, -1 },
+    { 12097, 3906, -1 }, { 11853, 4639, -1 }, { 11999, 4647, -1 }, { 11877, 4638, -1 }, { 11862, 4639, -1 }, { 11905, 4639, -1 },
+    { 11885, 4639, -1 }, { 12019, 4647, -1 }, { 12032, 4649, -1 }, { 12110, 3922, -1 }, { 11978, 4647, -1 }, { 11890, 4639, -1 },
+    { 11893, 4639, -1 }, { 11996, 4647, -1 }, { 11880, 4639, -1 }, { 11921, 4639, -1 }, { 12093, 3788, -1 }, { 12017, 4647, -1 },
+    { 12016, 4647, -1 }, { 12066, 3788, -1 }, { 12016, 4647, -1 }, { 12028, 4650, -1 }, { 12086, 3941, -1 }, { 12068, 3945, -1 },
+    { 11998, 4648, -1 }, { 12059, 3821, -1 }, { 11869, 4639, -1 }, { 11902, 4639, -1 }, { 12100, 3930, -1 }, { 12119, 4169, -1 },
+    { 11997, 4647, -1 }, { 12123, 4170, -1 }, { 12104, 4171, -1 }, { 12028, 4648, -1 }, { 12076, 4172, -1 }, { 12015, 4648, -1 },
+    { 12128, 3939, -1 }, { 11990, 4647, -1 }, { 12098, 3992, -1 }, { 12099, 3994, -1 }, { 12111, 3934, -1 }, { 12131, 4202, -1 },
+    { 12133, 4204, -1 }, { 12009, 4647, -1 }, { 11989, 4648, -1 }, { 12036, 4648, -1 }, { 12038, 4648, -1 }, { 12105, 4205, -1 },
+    { 12006, 4647, -1 }, { 12133, 4018, -1 }, { 12137, 4022, -1 }, { 12116, 3953, -1 }, { 12090, 3974, -1 }, { 12089, 3982, -1 },
+    { 12119, 4309, -1 }, { 12089, 3788, -1 }, { 12113, 4311, -1 }, { 12094, 3788, -1 }, { 12113, 4312, -1 }, { 12112, 3993, -1 },
+    { 11981, 4647, -1 }, { 12083, 4003, -1 }, { 12017, 4647, -1 }, { 12133, 4202, -1 }, { 12016, 4647, -1 }, { 12124, 4021, -1 },
+    { 12008, 4650, -1 }, { 12020, 4650, -1 }, { 12052, 4650, -1 }, { 12023, 4650, -1 }, { 12140, 4030, -1 }, { 12110, 4040, -1 },
+    { 12012, 4650, -1 }, { 12044, 4648, -1 }, { 12098, 4045, -1 }, { 12109, 4047, -1 }, { 12140, 4050, -1 }, { 12091, 4053, -1 },
+    { 12131, 4056, -1 }, { 12152, 4063, -1 }, { 12144, 4068, -1 }, { 12020, 4650, -1 }, { 12028, 4650, -1 }, { 12003, 4650, -1 },
+    { 12143, 4074, -1 }, { 12117, 4207, -1 }, { 12136, 4208, -1 }, { 12106, 4079, -1 }, { 12145, 4083, -1 }, { 12151, 4088, -1 },
+    { 12140, 4092, -1 }, { 12134, 4095, -1 }, { 12075, 3992, -1 }, { 12132, 4652, -1 }, { 12143, 4653, -1 }, { 12130, 4655, -1 },
+    { 12137, 4208, -1 }, { 12159, 4656, -1 }, { 12123, 4100, -1 }, { 12164, 4657, -1 }, { 12130, 4658, -1 }, { 12165, 4659, -1 },
+    { 12144, 4660, -1 }, { 12158, 4661, -1 }, { 12188, 4662, -1 }, { 12146, 4280, -1 }, { 12162, 4281, -1 }, { 12173, 4664, -1 },
+    { 12135, 4663, -1 }, { 12110, 4656, -1 }, { 12116, 4658, -1 }, { 12143, 4666, -1 }, { 12188, 4131, -1 }, { 12106, 4653, -1 },
+    { 12161, 4663, -1 }, { 12148, 4661, -1 }, { 12168, 4667, -1 }, { 12165, 4280, -1 }, { 12213, 4673, -1 }, { 12148, 4658, -1 },
+    { 12139, 4658, -1 }, { 12153, 4668, -1 }, { 12196, 4668, -1 }, { 12179, 4668, -1 }, { 12209, 4670, -1 }, { 12125, 4659, -1 },
+    { 12154, 4671, -1 }, { 12212, 4671, -1 }, { 12195, 4143, -1 }, { 12142, 4658, -1 }, { 12141, 4669, -1 }, { 12194, 4669, -1 },
+    { 12195, 4148, -1 }, { 12186, 4667, -1 }, { 12129, 4661, -1 }, { 12205, 4151, -1 }, { 12222, 4673, -1 }, { 12177, 4670, -1 },
+    { 12220, 4672, -1 }, { 12184, 4669, -1 }, { 12113, 4653, -1 }, { 12172, 4669, -1 }, { 12196, 4669, -1 }, { 12149, 4669, -1 },
+    { 12197, 4669, -1 }, { 12208, 4672, -1 }, { 12179, 4661, -1 }, { 12225, 4290, -1 }, { 12212, 4291, -1 }, { 12191, 4188, -1 },
+    { 12186, 4671, -1 }, { 12237, 4190, -1 }, { 12133, 4661, -1 }, { 12183, 4347, -1 }, { 12217, 4348, -1 }, { 12208, 4203, -1 },
+    { 12179, 4672, -1 }, { 12192, 4396, -1 }, { 12145, 4663, -1 }, { 12229, 4398, -1 }, { 12193, 4672, -1 }, { 12217, 4672, -1 },
+    { 12240, 4397, -1 }, { 12228, 4399, -1 }, { 12237, 4232, -1 }, { 12238, 4354, -1 }, { 12211, 4396, -1 }, { 12230, 4355, -1 },
+    { 12206, 4377, -1 }, { 12228, 4378, -1 }, { 12228, 4441, -1 }, { 12176, 4669, -1 }, { 12200, 4443, -1 }, { 12225, 4444, -1 },
+    { 12214, 4235, -1 }, { 12221, 4256, -1 }, { 12221, 4290, -1 }, { 12196, 4291, -1 }, { 12205, 4258, -1 }, { 12251, 4239, -1 },
+    { 12238, 4242, -1 }, { 12250, 4295, -1 }, { 12266, 4297, -1 }, { 12196, 4398, -1 }, { 12206, 4669, -1 }, { 12247, 4246, -1 },
+    { 12204, 4354, -1 }, { 12201, 4397, -1 }, { 12229, 4396, -1 }, { 12244, 4397, -1 }, { 12214, 4262, -1 }, { 12263, 4516, -1 },
+    { 12239, 4518, -1 }, { 12242, 4520, -1 }, { 12196, 4398, -1 }, { 12243, 4275, -1 }, { 12229, 4396, -1 }, { 12226, 4283, -1 },
+    { 12262, 4379, -1 }, { 12188, 4396, -1 }, { 12221, 4383, -1 }, { 12238, 4286, -1 }, { 12230, 4300, -1 }, { 12270, 4302, -1 },
+    { 12260, 4307, -1 }, { 12235, 4320, -1 }, { 12231, 4337, -1 }, { 12270, 4343, -1 }, { 12238, 4359, -1 }, { 12289, 4372, -1 },
+    { 12267, 4384, -1 }, { 12283, 4386, -1 }, { 12286, 4416, -1 }, { 12241, 4418, -1 }, { 12288, 4389, -1 }, { 12255, 4393, -1 },
+    { 12282, 4389, -1 }, { 12275, 4403, -1 }, { 12260, 4431, -1 }, { 12277, 4432, -1 }, { 12290, 4421, -1 }, { 12252, 4426, -1 },
+    { 12284, 4428, -1 }, { 12294, 4434, -1 }, { 12292, 4442, -1 }, { 12278, 4450, -1 }, { 12263, 4393, -1 }, { 12216, 4256, -1 },
+    { 12278, 4451, -1 }, { 12263, 4485, -1 }, { 12280, 4489, -1 }, { 12274, 4457, -1 }, { 12255, 4459, -1 }, { 12259, 4458, -1 },
+    { 12303, 4460, -1 }, { 12287, 4465, -1 }, { 12262, 4466, -1 }, { 12312, 4496, -1 }, { 12270, 4497, -1 }, { 12291, 4426, -1 },
+    { 12275, 4525, -1 }, { 12286, 4529, -1 }, { 12265, 4473, -1 }, { 12323, 4476, -1 }, { 12314, 4533, -1 }, { 12291, 4534, -1 },
+    { 12254, 4442, -1 }, { 12309, 4537, -1 }, { 12317, 4483, -1 }, { 12305, 4476, -1 }, { 12285, 4511, -1 }, { 12319, 4527, -1 },
+    { 12330, 4531, -1 }, { 12322, 4513, -1 }, { 12306, 4519, -1 }, { 12318, 4522, -1 }, { 12319, 4532, -1 }, { 12318, 4546, -1 },
+    { 12294, 4547, -1 }, { 12291, 4550, -1 }, { 12315, 4577, -1 }, { 12321, 4578, -1 }, { 12328, 4533, -1 }, { 12341, 4579, -1 },
+    { 12300, 4674, -1 }, { 12319, 4677, -1 }, { 12341, 4654, -1 }, { 12293, 4665, -1 }, { 12292, 4428, -1 }, { 12322, 4675, -1 },
+    { 12301, 4676, -1 }, { 12333, 4678, -1 }, { 12323, 4679, -1 }, { 12330, 4680, -1 }, { 12342, 4681, -1 }, { 12301, 4675, -1 },
+    { 12310, 4682, -1 }, { 12311, 4683, -1 }, { 12279, 4531, -1 }, { 12349, 4687, -1 }, { 12308, 4684, -1 }, { 12363, 4685, -1 },
+    { 12268, 4428, -1 }, { 12288, 4428, -1 }, { 12358, 4689, -1 }, { 12336, 4686, -1 }, { 12335, 4688, -1 }, { 12346, 4690, -1 },
+    { 12308, 4691, -1 }, { 12333, 4692, -1 }, { 12369, 4695, -1 }, { 12323, 4693, -1 }, { 12351, 4694, -1 }, { 12350, 4696, -1 },
+    { 12343, 4700, -1 }, { 12325, 4697, -1 }, { 12317, 4698, -1 }, { 12337, 4699, -1 }, { 12340, 4701, -1 }, { 12352, 4702, -1 },
+    { 12326, 4703, -1 }, { 12372, 4707, -1 }, { 12349, 4704, -1 }, { 12360, 4705, -1 }, { 12377, 4708, -1 }, { 12374, 4709, -1 },
+    { 12385, 4708, -1 }, { 12305, 4686, -1 }, { 12368, 4703, -1 }, { 12443, 4706, -1 }, { 12332, 4709, -1 }, { 12448, 4714, -1 },
+    { 12460, 4715, -1 }, { 12389, 4709, -1 }, { 12379, 4709, -1 }, { 12370, 4709, -1 }, { 12391, 4709, -1 }, { 12454, 4716, -1 },
+    { 12339, 4699, -1 }, { 12387, 4704, -1 }, { 12367, 4709, -1 }, { 12392, 4709, -1 }, { 12448, 4717, -1 }, { 12407, 4718, -1 },
+    { 12397, 4709, -1 }, { 12450, 4720, -1 }, { 12460, 4719, -1 }, { 12358, 4699, -1 }, { 12474, 4721, -1 }, { 12350, 4709, -1 },
+    { 12436, 4722, -1 }, { 12421, 4723, -1 }, { 12448, 4724, -1 }, { 12355, 4709, -1 }, { 12417, 4725, -1 }, { 12358, 4709, -1 },
+    { 12398, 4710, -1 }, { 12396, 4710, -1 }, { 12416, 4710, -1 }, { 12468, 4726, -1 }, { 12362, 4709, -1 }, { 12354, 4709, -1 },
+    { 12417, 4711, -1 }, { 12430, 4711, -1 }, { 12408, 4711, -1 }, { 12482, 4728, -1 }, { 12455, 4727, -1 }, { 12483, 4729, -1 },
+    { 12479, 4730, -1 }, { 12475, 4734, -1 }, { 12411, 4710, -1 }, { 12457, 4727, -1 }, { 12395, 4709, -1 }, { 12359, 4710, -1 },
+    { 12367, 4710, -1 }, { 12417, 4715, -1 }, { 12482, 4732, -1 }, { 12386, 4710, -1 }, { 12373, 4711, -1 }, { 12433, 4733, -1 },
+    { 12369, 4709, -1 }, { 12376, 4711, -1 }, { 12397, 4709, -1 }, { 12450, 4735, -1 }, { 12460, 4736, -1 }, { 12407, 4709, -1 },
+    { 12371, 4709, -1 }, { 12442, 4731, -1 }, { 12410, 4709, -1 }, { 12478, 4738, -1 }, { 12462, 4737, -1 }, { 12464, 4741, -1 },
+    { 12436, 4711, -1 }, { 12386, 4710, -1 }, { 12373, 4710, -1 }, { 12442, 4737, -1 }, { 12406, 4710, -1 }, { 12427, 4712, -1 },
+    { 12437, 4740, -1 }, { 12406, 4710, -1 }, { 12413, 4712, -1 }, { 12417, 4712, -1 }, { 12482, 4742, -1 }, { 12406, 4713, -1 },
+    { 12506, 4743, -1 }, { 12397, 4712, -1 }, { 12395, 4712, -1 }, { 12415, 4713, -1 }, { 12488, 4742, -1 }, { 12393, 4712, -1 },
+    { 12439, 4712, -1 }, { 12488, 4739, -1 }, { 12462, 4745, -1 }, { 12507, 4746, -1 }, { 12458, 4739, -1 }, { 12444, 4713, -1 },
+    { 12451, 4740, -1 }, { 12483, 4730, -1 }, { 12459, 4747, -1 }, { 12506, 4748, -1 }, { 12482, 4749, -1 }, { 12464, 4752, -1 },
+    { 12459, 4750, -1 }, { 12491, 4753, -1 }, { 12433, 4712, -1 }, { 12500, 4744, -1 }, { 12470, 4751, -1 }, { 12486, 4745, -1 },
+    { 12439, 4712, -1 }, { 12399, 4713, -1 }, { 12461, 4754, -1 }, { 12487, 4755, -1 }, { 12471, 4756, -1 }, { 12467, 4759, -1 },
+    { 12492, 4757, -1 }, { 12507, 4758, -1 }, { 12427, 4713, -1 }, { 12450, 4713, -1 }, { 12494, 4760, -1 }, { 12500, 4761, -1 },
+    { 12477, 4762, -1 }, { 12480, 4763, -1 }, { 12438, 4713, -1 }, { 12506, 4764, -1 }, { 12422, 4712, -1 }, { 12501, 4742, -1 },
+    { 12519, 4767, -1 }, { 12505, 4765, -1 }, { 12509, 4768, -1 }, { 12415, 4712, -1 }, { 12399, 4712, -1 }, { 12420, 4712, -1 },
+    { 12485, 4769, -1 }, { 12535, 4770, -1 }, { 12449, 4739, -1 }, { 12498, 4771, -1 }, { 12518, 4772, -1 }, { 12534, 4773, -1 },
+    { 12472, 4739, -1 }, { 12479, 4776, -1 }, { 12511, 4778, -1 }, { 12491, 4766, -1 }, { 12538, 4775, -1 }, { 12542, 4777, -1 },
+    { 12534, 4779, -1 }, { 12536, 4780, -1 }, { 12542, 4780, -1 }, { 12544, 4781, -1 }, { 12524, 4780, -1 }, { 12506, 4782, -1 },
+    { 12525, 4774, -1 }, { 12499, 4764, -1 }, { 12519, 4783, -1 }, { 12489, 4772, -1 }, { 12505, 4784, -1 }, { 12534, 4781, -1 },
+    { 12501, 4786, -1 }, { 12545, 4785, -1 }, { 12533, 4788, -1 }, { 12515, 4787, -1 }, { 12508, 4789, -1 }, { 12506, 4784, -1 },
+    { 12561, 4785, -1 }, { 12530, 4772, -1 }, { 12554, 4790, -1 }, { 12564, 4791, -1 }, { 12527, 4794, -1 }, { 12522, 4781, -1 },
+    { 12565, 4793, -1 }, { 12548, 4795, -1 }, { 12554, 4796, -1 }, { 12529, 4798, -1 }, { 12527, 4797, -1 }, { 12545, 4792, -1 },
+    { 12562, 4804, -1 }, { 12561, 4799, -1 }, { 12522, 4781, -1 }, { 12545, 4798, -1 }, { 12574, 4799, -1 }, { 12586, 4800, -1 },
+    { 12555, 4801, -1 }, { 12562, 4802, -1 }, { 12529, 4774, -1 }, { 12587, 4803, -1 }, { 12570, 4793, -1 }, { 12570, 4805, -1 },
+    { 12551, 4806, -1 }, { 12541, 4807, -1 }, { 12591, 4808, -1 }, { 12560, 4799, -1 }, { 12562, 4809, -1 }, { 12530, 4797, -1 },
+    { 12533, 4790, -1 }, { 12604, 4810, -1 }, { 12595, 4811, -1 }, { 12590, 4812, -1 }, { 12579, 4799, -1 }, { 12603, 4814, -1 },
+    { 12606, 4815, -1 }, { 12559, 4796, -1 }, { 12537, 4795, -1 }, { 12547, 4795, -1 }, { 12553, 4781, -1 }, { 12562, 4816, -1 },
+    { 12602, 4813, -1 }, { 12579, 4820, -1 }, { 12576, 4817, -1 }, { 12614, 4818, -1 }, { 12616, 4821, -1 }, { 12619, 4826, -1 },
+    { 12611, 4821, -1 }, { 12614, 4819, -1 }, { 12547, 4799, -1 }, { 12633, 4827, -1 }, { 12618, 4831, -1 }, { 12566, 4789, -1 },
+    { 12551, 4797, -1 }, { 12619, 4823, -1 }, { 12525, 4795, -1 }, { 12617, 4823, -1 }, { 12615, 4822, -1 }, { 12591, 4799, -1 },
+    { 12607, 4813, -1 }, { 12607, 4830, -1 }, { 12621, 4823, -1 }, { 12579, 4822, -1 }, { 12572, 4800, -1 }, { 12598, 4822, -1 },
+    { 12598, 4824, -1 }, { 12603, 4825, -1 }, { 12586, 4822, -1 }, { 12596, 4823, -1 }, { 12635, 4828, -1 }, { 12636, 4825, -1 },
+    { 12605, 4829, -1 }, { 12622, 4824, -1 }, { 12621, 4824, -1 }, { 12613, 4822, -1 }, { 12650, 4832, -1 }, { 12570, 4823, -1 },
+    { 12607, 4833, -1 }, { 12613, 4823, -1 }, { 12627, 4834, -1 }, { 12592, 4822, -1 }, { 12603, 4828, -1 }, { 12617, 4835, -1 },
+    { 12586, 4826, -1 }, { 12643, 4836, -1 }, { 12613, 4837, -1 }, { 12650, 4841, -1 }, { 12662, 4838, -1 }, { 12663, 4839, -1 },
+    { 12647, 4840, -1 }, { 12645, 4831, -1 }, { 12660, 4842, -1 }, { 12661, 4843, -1 }, { 12632, 4825, -1 }, { 12608, 4844, -1 },
+    { 12614, 4823, -1 }, { 12619, 4845, -1 }, { 12655, 4846, -1 }, { 12563, 4822, -1 }, { 12672, 4847, -1 }, { 12589, 4823, -1 },
+    { 12624, 4848, -1 }, { 12652, 4849, -1 }, { 12616, 4850, -1 }, { 12655, 4851, -1 }, { 12594, 4823, -1 }, { 12675, 4849, -1 },
+    { 12673, 4852, -1 }, { 12677, 4853, -1 }, { 12658, 4854, -1 }, { 12679, 4856, -1 }, { 12629, 4843, -1 }, { 12625, 4822, -1 },
+    { 12671, 4857, -1 }, { 12678, 4855, -1 }, { 12583, 4822, -1 }, { 12674, 4858, -1 }, { 12681, 4859, -1 }, { 12632, 4860, -1 },
+    { 12639, 4861, -1 }, { 12640, 4862, -1 }, { 12690, 4863, -1 }, { 12682, 4864, -1 }, { 12646, 4865, -1 }, { 12645, 4866, -1 },
+    { 12639, 4867, -1 }, { 12684, 4870, -1 }, { 12597, 4825, -1 }, { 12647, 4868, -1 }, { 12648, 4869, -1 }, { 12676, 4871, -1 },
+    { 12641, 4872, -1 }, { 12647, 4873, -1 }, { 12690, 4877, -1 }, { 12687, 4874, -1 }, { 12652, 4875, -1 }, { 12682, 4876, -1 },
+    { 12687, 4878, -1 }, { 12659, 4879, -1 }, { 12661, 4880, -1 }, { 12653, 4881, -1 }, { 12698, 4882, -1 }, { 12703, 4884, -1 },
+    { 12662, 4880, -1 }, { 12680, 4883, -1 }, { 12690, 4883, -1 }, { 12703, 4885, -1 }, { 12644, 4842, -1 }, { 12687, 4886, -1 },
+    { 12687, 4887, -1 }, { 12673, 4888, -1 }, { 12670, 4889, -1 }, { 12676, 4890, -1 }, { 12723, 4892, -1 }, { 12677, 4893, -1 },
+    { 12729, 4894, -1 }, { 12724, 4891, -1 }, { 12676, 4895, -1 }, { 12697, 4896, -1 }, { 12717, 4897, -1 }, { 12704, 4881, -1 },
+    { 12681, 4898, -1 }, { 12694, 4899, -1 }, { 12710, 4901, -1 }, { 12714, 4900, -1 }, { 12709, 4902, -1 }, { 12734, 4903, -1 },
+    { 12719, 4904, -1 }, { 12692, 4879, -1 }, { 12720, 4905, -1 }, { 12732, 4906, -1 }, { 12720, 4907, -1 }, { 12707, 4879, -1 },
+    { 12651, 4881, -1 }, { 12694, 4911, -1 }, { 12686, 4881, -1 }, { 12692, 4908, -1 }, { 12725, 4909, -1 }, { 12741, 4910, -1 },
+    { 12698, 4914, -1 }, { 12739, 4912, -1 }, { 12722, 4913, -1 }, { 12737, 4915, -1 }, { 12752, 4919, -1 }, { 12714, 4916, -1 },
+    { 12726, 4917, -1 }, { 12712, 4921, -1 }, { 12682, 4897, -1 }, { 12741, 4918, -1 }, { 12736, 4920, -1 }, { 12744, 4920, -1 },
+    { 12721, 4912, -1 }, { 12762, 4925, -1 }, { 12763, 4922, -1 }, { 12759, 4923, -1 }, { 12730, 4924, -1 }, { 12728, 4926, -1 },
+    { 12757, 4927, -1 }, { 12764, 4928, -1 }, { 12680, 4893, -1 }, { 12735, 4929, -1 }, { 12764, 4930, -1 }, { 12760, 4933, -1 },
+    { 12752, 4932, -1 }, { 12741, 4931, -1 }, { 12725, 4934, -1 }, { 12768, 4935, -1 }, { 12764, 4936, -1 }, { 12771, 4937, -1 },
+    { 12747, 4938, -1 }, { 12728, 4893, -1 }, { 12751, 4942, -1 }, { 12731, 4918, -1 }, { 12774, 4939, -1 }, { 12711, 4929, -1 },
+    { 12774, 4932, -1 }, { 12730, 4943, -1 }, { 12765, 4944, -1 }, { 12767, 4945, -1 }, { 12797, 4948, -1 }, { 12800, 4946, -1 },
+    { 12780, 4944, -1 }, { 12800, 4949, -1 }, { 12750, 4938, -1 }, { 12797, 4950, -1 }, { 12791, 4952, -1 }, { 12749, 4940, -1 },
+    { 12794, 4953, -1 }, { 12800, 4954, -1 }, { 12784, 4955, -1 }, { 12809, 4941, -1 }, { 12761, 4947, -1 }, { 12761, 4956, -1 },
+    { 12801, 4960, -1 }, { 12782, 4961, -1 }, { 12791, 4958, -1 }, { 12809, 4951, -1 }, { 12796, 4957, -1 }, { 12809, 4959, -1 },
+    { 12773, 4962, -1 }, { 12748, 4948, -1 }, { 12751, 4944, -1 }, { 12771, 4963, -1 }, { 12766, 4964, -1 }, { 12712, 4923, -1 },
+    { 12769, 4965, -1 }, { 12790, 4969, -1 }, { 12748, 4928, -1 }, { 12808, 4966, -1 }, { 12777, 4967, -1 }, { 12817, 4970, -1 },
+    { 12754, 4955, -1 }, { 12816, 4971, -1 }, { 12802, 4973, -1 }, { 12742, 4944, -1 }, { 12819, 4973, -1 }, { 12742, 4945, -1 },
+    { 12817, 4972, -1 }, { 12744, 4945, -1 }, { 12809, 4974, -1 }, { 12762, 4944, -1 }, { 12741, 4945, -1 }, { 12829, 4975, -1 },
+    { 12797, 4945, -1 }, { 12755, 4958, -1 }, { 12825, 4972, -1 }, { 12840, 4968, -1 }, { 12843, 4976, -1 }, { 12825, 4977, -1 },
+    { 12829, 4978, -1 }, { 12787, 4980, -1 }, { 12818, 4979, -1 }, { 12838, 4981, -1 }, { 12848, 4982, -1 }, { 12821, 4983, -1 },
+    { 12840, 4975, -1 }, { 12852, 4984, -1 }, { 12821, 4987, -1 }, { 12757, 4954, -1 }, { 12841, 4988, -1 }, { 12856, 4985, -1 },
+    { 12844, 4986, -1 }, { 12780, 4971, -1 }, { 12816, 4989, -1 }, { 12807, 4991, -1 }, { 12793, 4968, -1 }, { 12843, 4990, -1 },
+    { 12798, 4992, -1 }, { 12822, 4993, -1 }, { 12831, 4995, -1 }, { 12809, 4994, -1 }, { 12833, 4996, -1 }, { 12804, 4971, -1 },
+    { 12811, 4997, -1 }, { 12801, 4974, -1 }, { 12806, 4998, -1 }, { 12836, 5000, -1 }, { 12820, 5001, -1 }, { 12871, 5002, -1 },
+    { 12836, 4999, -1 }, { 12827, 5003, -1 }, { 12789, 4974, -1 }, { 12821, 4974, -1 }, { 12860, 5004, -1 }, { 12864, 5005, -1 },
+    { 12838, 5006, -1 }, { 12816, 5007, -1 }, { 12871, 5008, -1 }, { 12845, 5009, -1 }, { 12840, 5011, -1 }, { 12825, 5009, -1 },
+    { 12834, 5012, -1 }, { 12848, 5010, -1 }, { 12854, 5003, -1 }, { 12836, 5013, -1 }, { 12867, 5014, -1 }, { 12843, 5015, -1 },
+    { 12891, 5016, -1 }, { 12872, 5017, -1 }, { 12867, 5009, -1 }, { 12897, 5018, -1 }, { 12863, 5012, -1 }, { 12877, 5021, -1 },
+    { 12865, 5020, -1 }, { 12851, 5019, -1 }, { 12900, 5022, -1 }, { 12879, 5023, -1 }, { 12845, 4980, -1 }, { 12832, 4992, -1 },
+    { 12855, 5024, -1 }, { 12873, 5026, -1 }, { 12834, 5010, -1 }, { 12882, 5020, -1 }, { 12815, 5004, -1 }, { 12878, 5010, -1 },
+    { 12890, 5019, -1 }, { 12847, 5025, -1 }, { 12859, 5027, -1 }, { 12857, 5028, -1 }, { 12859, 5029, -1 }, { 12899, 5032, -1 },
+    { 12817, 5007, -1 }, { 12893, 5030, -1 }, { 12863, 5031, -1 }, { 12887, 5033, -1 }, { 12861, 5034, -1 }, { 12887, 5035, -1 },
+    { 12901, 5035, -1 }, { 12912, 5035, -1 }, { 12894, 5035, -1 }, { 12868, 5035, -1 }, { 12954, 5041, -1 }, { 12889, 5035, -1 },
+    { 12870, 5036, -1 }, { 12869, 5036, -1 }, { 12847, 5017, -1 }, { 12921, 5036, -1 }, { 12920, 5042, -1 }, { 12885, 5036, -1 },
+    { 12967, 5043, -1 }, { 12944, 5044, -1 }, { 12893, 5037, -1 }, { 12920, 5036, -1 }, { 12920, 5037, -1 }, { 12925, 5037, -1 },
+    { 12937, 5045, -1 }, { 12971, 5046, -1 }, { 12903, 5038, -1 }, { 12942, 5047, -1 }, { 12922, 5048, -1 }, { 12929, 5038, -1 },
+    { 12934, 5040, -1 }, { 12904, 5038, -1 }, { 12942, 5049, -1 }, { 12928, 5050, -1 }, { 12882, 5036, -1 }, { 12932, 5051, -1 },
+    { 12880, 5037, -1 }, { 12976, 5052, -1 }, { 12907, 5037, -1 }, { 12946, 5053, -1 }, { 12928, 5054, -1 }, { 12950, 5054, -1 },
+    { 12894, 5039, -1 }, { 12945, 5039, -1 }, { 12900, 5038, -1 }, { 12929, 5055, -1 }, { 12932, 5037, -1 }, { 12920, 5039, -1 },
+    { 12923, 5056, -1 }, { 12958, 5054, -1 }, { 12937, 5040, -1 }, { 12973, 5057, -1 }, { 12912, 5036, -1 }, { 12895, 5036, -1 },
+    { 12931, 5058, -1 }, { 12888, 5038, -1 }, { 12881, 5036, -1 }, { 12937, 5038, -1 }, { 12931, 5059, -1 }, { 12973, 5060, -1 },
+    { 12978, 5061, -1 }, { 12979, 5062, -1 }, { 12923, 5037, -1 }, { 12961, 5063, -1 }, { 12890, 5037, -1 }, { 12968, 5064, -1 },
+    { 12921, 5036, -1 }, { 12942, 5039, -1 }, { 12946, 5065, -1 }, { 12962, 5068, -1 }, { 12927, 5036, -1 }, { 12973, 5066, -1 },
+    { 12946, 5040, -1 }, { 12947, 5039, -1 }, { 12948, 5069, -1 }, { 12962, 5040, -1 }, { 12975, 5070, -1 }, { 12938, 5071, -1 },
+    { 12976, 5067, -1 }, { 12935, 5038, -1 }, { 12908, 5039, -1 }, { 12905, 5039, -1 }, { 12944, 5069, -1 }, { 12998, 5072, -1 },
+    { 12971, 5073, -1 }, { 12972, 5074, -1 }, { 12953, 5075, -1 }, { 12954, 5039, -1 }, { 12954, 5076, -1 }, { 12960, 5077, -1 },
+    { 12917, 5039, -1 }, { 12968, 5078, -1 }, { 13001, 5079, -1 }, { 12968, 5080, -1 }, { 12984, 5082, -1 }, { 12914, 5039, -1 },
+    { 13003, 5083, -1 }, { 12963, 5084, -1 }, { 12975, 5086, -1 }, { 12964, 5084, -1 }, { 13004, 5085, -1 }, { 12995, 5085, -1 },
+    { 12984, 5087, -1 }, { 12937, 5060, -1 }, { 13011, 5088, -1 }, { 12975, 5081, -1 }, { 12982, 5084, -1 }, { 12985, 5083, -1 },
+    { 12976, 5089, -1 }, { 12997, 5090, -1 }, { 12984, 5089, -1 }, { 12985, 5091, -1 }, { 13002, 5092, -1 }, { 13037, 5093, -1 },
+    { 13021, 5094, -1 }, { 12986, 5079, -1 }, { 13007, 5095, -1 }, { 13007, 5098, -1 }, { 13017, 5096, -1 }, { 12989, 5097, -1 },
+    { 12994, 5099, -1 }, { 13011, 5100, -1 }, { 13009, 5101, -1 }, { 12991, 5103, -1 }, { 12998, 5102, -1 }, { 12995, 5104, -1 },
+    { 13016, 5108, -1 }, { 13019, 5105, -1 }, { 13049, 5106, -1 }, { 13034, 5107, -1 }, { 13001, 5110, -1 }, { 13004, 5109, -1 },
+    { 13042, 5111, -1 }, { 13004, 5112, -1 }, { 13044, 5113, -1 }, { 13036, 5114, -1 }, { 12997, 5084, -1 }, { 13015, 5115, -1 },
+    { 13013, 5116, -1 }, { 13032, 5117, -1 }, { 13042, 5110, -1 }, { 13066, 5118, -1 }, { 13055, 5119, -1 }, { 13032, 5110, -1 },
+    { 13006, 5120, -1 }, { 13027, 5094, -1 }, { 13007, 5121, -1 }, { 13013, 5084, -1 }, { 13038, 5107, -1 }, { 12984, 5084, -1 },
+    { 13028, 5122, -1 }, { 13021, 5123, -1 }, { 12989, 5084, -1 }, { 12984, 5090, -1 }, { 12980, 5081, -1 }, { 13072, 5124, -1 },
+    { 13014, 5127, -1 }, { 13020, 5125, -1 }, { 13074, 5126, -1 }, { 13023, 5128, -1 }, { 13047, 5129, -1 }, { 13079, 5130, -1 },
+    { 13070, 5131, -1 }, { 13033, 5132, -1 }, { 13067, 5133, -1 }, { 13079, 5134, -1 }, { 13061, 5135, -1 }, { 13035, 5140, -1 },
+    { 13032, 5136, -1 }, { 13037, 5137, -1 }, { 13085, 5138, -1 }, { 13079, 5139, -1 }, { 13044, 5141, -1 }, { 13093, 5142, -1 },
+    { 13077, 5143, -1 }, { 13063, 5144, -1 }, { 13066, 5145, -1 }, { 13097, 5146, -1 }, { 13037, 5147, -1 }, { 13091, 5148, -1 },
+    { 13047, 5149, -1 }, { 13046, 5150, -1 }, { 13051, 5151, -1 }, { 13070, 5154, -1 }, { 13078, 5153, -1 }, { 13068, 5155, -1 },
+    { 13102, 5157, -1 }, { 13092, 5153, -1 }, { 13050, 5130, -1 }, { 13090, 5153, -1 }, { 13090, 5152, -1 }, { 13095, 5156, -1 },
+    { 13101, 5158, -1 }, { 13110, 5159, -1 }, { 13065, 5160, -1 }, { 13071, 5161, -1 }, { 13119, 5162, -1 }, { 13081, 5163, -1 },
+    { 13092, 5164, -1 }, { 13118, 5165, -1 }, { 13113, 5166, -1 }, { 13070, 5167, -1 }, { 13115, 5168, -1 }, { 13116, 5163, -1 },
+    { 13111, 5169, -1 }, { 13083, 5143, -1 }, { 13066, 5173, -1 }, { 13068, 5170, -1 }, { 13077, 5172, -1 }, { 13073, 5174, -1 },
+    { 13085, 5171, -1 }, { 13074, 5125, -1 }, { 13085, 5161, -1 }, { 13080, 5153, -1 }, { 13109, 5175, -1 }, { 13135, 5176, -1 },
+    { 13129, 5177, -1 }, { 13119, 5178, -1 }, { 13131, 5179, -1 }, { 13093, 5180, -1 }, { 13084, 5180, -1 }, { 13142, 5181, -1 },
+    { 13098, 5182, -1 }, { 13137, 5183, -1 }, { 13135, 5185, -1 }, { 13107, 5186, -1 }, { 13110, 5187, -1 }, { 13097, 5189, -1 },
+    { 13113, 5187, -1 }, { 13126, 5181, -1 }, { 13126, 5186, -1 }, { 13110, 5190, -1 }, { 13141, 5188, -1 }, { 13100, 5160, -1 },
+    { 13131, 5188, -1 }, { 13119, 5191, -1 }, { 13145, 5192, -1 }, { 13135, 5196, -1 }, { 13162, 5184, -1 }, { 13164, 5193, -1 },
+    { 13104, 5196, -1 }, { 13170, 5194, -1 }, { 13155, 5195, -1 }, { 13119, 5197, -1 }, { 13112, 5198, -1 }, { 13139, 5185, -1 },
+    { 13122, 5184, -1 }, { 13113, 5187, -1 }, { 13133, 5192, -1 }, { 13068, 5160, -1 }, { 13139, 5200, -1 }, { 13164, 5201, -1 },
+    { 13153, 5199, -1 }, { 13168, 5202, -1 }, { 13154, 5203, -1 }, { 13155, 5204, -1 }, { 13145, 5205, -1 }, { 13163, 5206, -1 },
+    { 13129, 5207, -1 }, { 13172, 5208, -1 }, { 13157, 5210, -1 }, { 13178, 5209, -1 }, { 13176, 5214, -1 }, { 13159, 5211, -1 },
+    { 13141, 5189, -1 }, { 13140, 5212, -1 }, { 13141, 5213, -1 }, { 13181, 5215, -1 }, { 13143, 5215, -1 }, { 13105, 5190, -1 },
+    { 13115, 5192, -1 }, { 13094, 5181, -1 }, { 13155, 5209, -1 }, { 13173, 5216, -1 }, { 13191, 5217, -1 }, { 13177, 5218, -1 },
+    { 13159, 5220, -1 }, { 13169, 5221, -1 }, { 13115, 5192, -1 }, { 13184, 5222, -1 }, { 13148, 5223, -1 }, { 13153, 5224, -1 },
+    { 13150, 5226, -1 }, { 13178, 5226, -1 }, { 13194, 5228, -1 }, { 13151, 5219, -1 }, { 13202, 5225, -1 }, { 13184, 5227, -1 },
+    { 13186, 5229, -1 }, { 13186, 5230, -1 }, { 13156, 5231, -1 }, { 13196, 5232, -1 }, { 13213, 5233, -1 }, { 13166, 5235, -1 },
+    { 13185, 5236, -1 }, { 13216, 5237, -1 }, { 13178, 5238, -1 }, { 13165, 5234, -1 }, { 13201, 5239, -1 }, { 13169, 5240, -1 },
+    { 13167, 5241, -1 }, { 13177, 5242, -1 }, { 13174, 5243, -1 }, { 13166, 5244, -1 }, { 13204, 5245, -1 }, { 13216, 5246, -1 },
+    { 13198, 5247, -1 }, { 13176, 5248, -1 }, { 13177, 5249, -1 }, { 13172, 5251, -1 }, { 13199, 5253, -1 }, { 13203, 5250, -1 },
+    { 13232, 5252, -1 }, { 13206, 5254, -1 }, { 13225, 5255, -1 }, { 13221, 5256, -1 }, { 13209, 5259, -1 }, { 13184, 5258, -1 },
+    { 13181, 5260, -1 }, { 13140, 5215, -1 }, { 13221, 5261, -1 }, { 13233, 5257, -1 }, { 13194, 5262, -1 }, { 13190, 5263, -1 },
+    { 13229, 5264, -1 }, { 13236, 5265, -1 }, { 13225, 5267, -1 }, { 13233, 5266, -1 }, { 13249, 5268, -1 }, { 13197, 5269, -1 },
+    { 13246, 5270, -1 }, { 13200, 5273, -1 }, { 13196, 5271, -1 }, { 13254, 5274, -1 }, { 13227, 5272, -1 }, { 13253, 5275, -1 },
+    { 13252, 5276, -1 }, { 13261, 5277, -1 }, { 13207, 5279, -1 }, { 13262, 5280, -1 }, { 13234, 5278, -1 }, { 13203, 5281, -1 },
+    { 13265, 5282, -1 }, { 13230, 5283, -1 }, { 13254, 5284, -1 }, { 13214, 5285, -1 }, { 13269, 5286, -1 }, { 13222, 5287, -1 },
+    { 13199, 5267, -1 }, { 13251, 5288, -1 }, { 13248, 5266, -1 }, { 13256, 5289, -1 }, { 13213, 5292, -1 }, { 13250, 5290, -1 },
+    { 13243, 5294, -1 }, { 13247, 5295, -1 }, { 13248, 5291, -1 }, { 13230, 5293, -1 }, { 13257, 5296, -1 }, { 13252, 5294, -1 },
+    { 13268, 5297, -1 }, { 13271, 5298, -1 }, { 13281, 5299, -1 }, { 13230, 5300, -1 }, { 13263, 5301, -1 }, { 13281, 5302, -1 },
+    { 13234, 5303, -1 }, { 13267, 5304, -1 }, { 13230, 5305, -1 }, { 13243, 5306, -1 }, { 13282, 5307, -1 }, { 13289, 5308, -1 },
+    { 13293, 5309, -1 }, { 13283, 5310, -1 }, { 13247, 5314, -1 }, { 13286, 5311, -1 }, { 13279, 5315, -1 }, { 13240, 5313, -1 },
+    { 13249, 5316, -1 }, { 13252, 5317, -1 }, { 13260, 5318, -1 }, { 13301, 5312, -1 }, { 13259, 5319, -1 }, { 13298, 5320, -1 },
+    { 13278, 5321, -1 }, { 13287, 5322, -1 }, { 13279, 5323, -1 }, { 13306, 5324, -1 }, { 13302, 5312, -1 }, { 13281, 5327, -1 },
+    { 13254, 5325, -1 }, { 13263, 5326, -1 }, { 13257, 5328, -1 }, { 13260, 5330, -1 }, { 13289, 5318, -1 }, { 13249, 5304, -1 },
+    { 13268, 5313, -1 }, { 13313, 5329, -1 }, { 13266, 5329, -1 }, { 13271, 5332, -1 }, { 13313, 5331, -1 }, { 13276, 5333, -1 },
+    { 13317, 5334, -1 }, { 13306, 5335, -1 }, { 13314, 5334, -1 }, { 13332, 5336, -1 }, { 13322, 5336, -1 }, { 13335, 5337, -1 },
+    { 13310, 5338, -1 }, { 13328, 5340, -1 }, { 13308, 5338, -1 }, { 13329, 5339, -1 }, { 13298, 5341, -1 }, { 13314, 5344, -1 },
+    { 13244, 5303, -1 }, { 13315, 5342, -1 }, { 13299, 5343, -1 }, { 13325, 5345, -1 }, { 13329, 5346, -1 }, { 13295, 5341, -1 },
+    { 13319, 5348, -1 }, { 13324, 5349, -1 }, { 13304, 5335, -1 }, { 13350, 5346, -1 }, { 13347, 5347, -1 }, { 13330, 5351, -1 },
+    { 13286, 5336, -1 }, { 13306, 5342, -1 }, { 13337, 5352, -1 }, { 13333, 5353, -1 }, { 13297, 5337, -1 }, { 13363, 5357, -1 },
+    { 13349, 5354, -1 }, { 13353, 5354, -1 }, { 13331, 5339, -1 }, { 13317, 5356, -1 }, { 13339, 5358, -1 }, { 13318, 5337, -1 },
+    { 13328, 5359, -1 }, { 13329, 5339, -1 }, { 13361, 5360, -1 }, { 13322, 5361, -1 }, { 13368, 5350, -1 }, { 13324, 5355, -1 },
+    { 13325, 5362, -1 }, { 13377, 5363, -1 }, { 13329, 5364, -1 }, { 13271, 5329, -1 }, { 13366, 5365, -1 }, { 13320, 5366, -1 },
+    { 13371, 5367, -1 }, { 13371, 5368, -1 }, { 13383, 5369, -1 }, { 13326, 5371, -1 }, { 13293, 5332, -1 }, { 13335, 5372, -1 },
+    { 13381, 5370, -1 }, { 13376, 5373, -1 }, { 13328, 5335, -1 }, { 13376, 5375, -1 }, { 13357, 5348, -1 }, { 13380, 5376, -1 },
+    { 13380, 5370, -1 }, { 13394, 5377, -1 }, { 13310, 5338, -1 }, { 13366, 5374, -1 }, { 13367, 5374, -1 }, { 13342, 5378, -1 },
+    { 13351, 5379, -1 }, { 13348, 5380, -1 }, { 13350, 5381, -1 }, { 13375, 5382, -1 }, { 13291, 5343, -1 }, { 13342, 5383, -1 },
+    { 13384, 5384, -1 }, { 13395, 5385, -1 }, { 13387, 5386, -1 }, { 13388, 5387, -1 }, { 13352, 5388, -1 }, { 13357, 5389, -1 },
+    { 13384, 5390, -1 }, { 13356, 5391, -1 }, { 13410, 5393, -1 }, { 13405, 5395, -1 }, { 13362, 5392, -1 }, { 13361, 5394, -1 },
+    { 13404, 5398, -1 }, { 13394, 5396, -1 }, { 13396, 5399, -1 }, { 13375, 5400, -1 }, { 13398, 5401, -1 }, { 13366, 5402, -1 },
+    { 13420, 5403, -1 }, { 13413, 5405, -1 }, { 13382, 5395, -1 }, { 13382, 5397, -1 }, { 13427, 5404, -1 }, { 13369, 5406, -1 },
+    { 13412, 5407, -1 }, { 13413, 5408, -1 }, { 13407, 5409, -1 }, { 13416, 5410, -1 }, { 13403, 5411, -1 }, { 13379, 5412, -1 },
+    { 13374, 5413, -1 }, { 13432, 5414, -1 }, { 13411, 5415, -1 }, { 13378, 5416, -1 }, { 13387, 5417, -1 }, { 13443, 5418, -1 },
+    { 13424, 5421, -1 }, { 13423, 5419, -1 }, { 13392, 5420, -1 }, { 13423, 5422, -1 }, { 13438, 5423, -1 }, { 13439, 5424, -1 },
+    { 13392, 5425, -1 }, { 13445, 5426, -1 }, { 13406, 5427, -1 }, { 13399, 5403, -1 }, { 13425, 5428, -1 }, { 13405, 5429, -1 },
+    { 13394, 5430, -1 }, { 13401, 5431, -1 }, { 13390, 5415, -1 }, { 13382, 5417, -1 }, { 13425, 5433, -1 }, { 13448, 5432, -1 },
+    { 13446, 5434, -1 }, { 13425, 5413, -1 }, { 13374, 5408, -1 }, { 13461, 5435, -1 }, { 13448, 5436, -1 }, { 13441, 5437, -1 },
+    { 13445, 5438, -1 }, { 13407, 5389, -1 }, { 13451, 5439, -1 }, { 13407, 5430, -1 }, { 13452, 5440, -1 }, { 13453, 5441, -1 },
+    { 13457, 5442, -1 }, { 13422, 5443, -1 }, { 13454, 5444, -1 }, { 13426, 5445, -1 }, { 13457, 5446, -1 }, { 13422, 5447, -1 },
+    { 13465, 5450, -1 }, { 13465, 5448, -1 }, { 13427, 5449, -1 }, { 13433, 5451, -1 }, { 13434, 5452, -1 }, { 13441, 5447, -1 },
+    { 13484, 5453, -1 }, { 13446, 5454, -1 }, { 13431, 5457, -1 }, { 13439, 5455, -1 }, { 13471, 5457, -1 }, { 13450, 5456, -1 },
+    { 13474, 5458, -1 }, { 13437, 5461, -1 }, { 13478, 5459, -1 }, { 13479, 5460, -1 }, { 13475, 5462, -1 }, { 13442, 5463, -1 },
+    { 13472, 5464, -1 }, { 13448, 5465, -1 }, { 13484, 5466, -1 }, { 13460, 5467, -1 }, { 13489, 5468, -1 }, { 13452, 5469, -1 },
+    { 13443, 5470, -1 }, { 13443, 5471, -1 }, { 13419, 5450, -1 }, { 13441, 5447, -1 }, { 13491, 5472, -1 }, { 13491, 5473, -1 },
+    { 13502, 5474, -1 }, { 13454, 5475, -1 }, { 13456, 5476, -1 }, { 13459, 5478, -1 }, { 13506, 5479, -1 }, { 13496, 5477, -1 },
+    { 13434, 5450, -1 }, { 13511, 5480, -1 }, { 13463, 5481, -1 }, { 13469, 5482, -1 }, { 13507, 5483, -1 }, { 13484, 5484, -1 },
+    { 13513, 5485, -1 }, { 13464, 5484, -1 }, { 13502, 5486, -1 }, { 13483, 5488, -1 }, { 13492, 5470, -1 }, { 13491, 5489, -1 },
+    { 13485, 5490, -1 }, { 13465, 5478, -1 }, { 13464, 5484, -1 }, { 13492, 5487, -1 }, { 13499, 5491, -1 }, { 13463, 5484, -1 },
+    { 13498, 5487, -1 }, { 13489, 5486, -1 }, { 13520, 5487, -1 }, { 13500, 5492, -1 }, { 13512, 5496, -1 }, { 13494, 5494, -1 },
+    { 13455, 5476, -1 }, { 13482, 5497, -1 }, { 13487, 5485, -1 }, { 13532, 5493, -1 }, { 13523, 5498, -1 }, { 13499, 5500, -1 },
+    { 13504, 5501, -1 }, { 13523, 5495, -1 }, { 13504, 5484, -1 }, { 13539, 5502, -1 }, { 13549, 5503, -1 }, { 13548, 5505, -1 },
+    { 13508, 5506, -1 }, { 13502, 5499, -1 }, { 13504, 5506, -1 }, { 13543, 5508, -1 }, { 13526, 5507, -1 }, { 13514, 5509, -1 },
+    { 13561, 5512, -1 }, { 13473, 5485, -1 }, { 13557, 5510, -1 }, { 13462, 5476, -1 }, { 13517, 5484, -1 }, { 13546, 5513, -1 },
+    { 13553, 5504, -1 }, { 13516, 5514, -1 }, { 13544, 5515, -1 }, { 13556, 5518, -1 }, { 13517, 5516, -1 }, { 13523, 5517, -1 },
+    { 13564, 5511, -1 }, { 13478, 5484, -1 }, { 13566, 5519, -1 }, { 13545, 5520, -1 }, { 13513, 5521, -1 }, { 13525, 5523, -1 },
+    { 13525, 5484, -1 }, { 13530, 5522, -1 }, { 13506, 5484, -1 }, { 13514, 5507, -1 }, { 13532, 5525, -1 }, { 13565, 5522, -1 },
+    { 13541, 5524, -1 }, { 13549, 5526, -1 }, { 13569, 5527, -1 }, { 13573, 5528, -1 }, { 13538, 5529, -1 }, { 13564, 5530, -1 },
+    { 13556, 5535, -1 }, { 13564, 5531, -1 }, { 13547, 5532, -1 }, { 13556, 5533, -1 }, { 13556, 5534, -1 }, { 13555, 5523, -1 },
+    { 13556, 5536, -1 }, { 13545, 5537, -1 }, { 13590, 5537, -1 }, { 13563, 5538, -1 }, { 13550, 5539, -1 }, { 13561, 5541, -1 },
+    { 13607, 5542, -1 }, { 13574, 5540, -1 }, { 13547, 5543, -1 }, { 13533, 5524, -1 }, { 13575, 5524, -1 }, { 13591, 5537, -1 },
+    { 13573, 5540, -1 }, { 13576, 5545, -1 }, { 13564, 5523, -1 }, { 13562, 5544, -1 }, { 13539, 5524, -1 }, { 13578, 5546, -1 },
+    { 13566, 5547, -1 }, { 13572, 5548, -1 }, { 13582, 5549, -1 }, { 13548, 5537, -1 }, { 13581, 5538, -1 }, { 13589, 5550, -1 },
+    { 13566, 5553, -1 }, { 13570, 5552, -1 }, { 13591, 5554, -1 }, { 13593, 5551, -1 }, { 13566, 5538, -1 }, { 13572, 5555, -1 },
+    { 13593, 5556, -1 }, { 13622, 5557, -1 }, { 13608, 5558, -1 }, { 13580, 5561, -1 }, { 13541, 5538, -1 }, { 13623, 5559, -1 },
+    { 13613, 5560, -1 }, { 13628, 5562, -1 }, { 13619, 5563, -1 }, { 13580, 5564, -1 }, { 13594, 5565, -1 }, { 13624, 5566, -1 },
+    { 13597, 5567, -1 }, { 13579, 5568, -1 }, { 13600, 5567, -1 }, { 13572, 5565, -1 }, { 13627, 5569, -1 }, { 13600, 5570, -1 },
+    { 13592, 5571, -1 }, { 13631, 5572, -1 }, { 13616, 5575, -1 }, { 13567, 5550, -1 }, { 13591, 5576, -1 }, { 13650, 5573, -1 },
+    { 13652, 5574, -1 }, { 13636, 5577, -1 }, { 13592, 5578, -1 }, { 13605, 5579, -1 }, { 13619, 5568, -1 }, { 13615, 5567, -1 },
+    { 13639, 5580, -1 }, { 13629, 5581, -1 }, { 13652, 5582, -1 }, { 13634, 5585, -1 }, { 13606, 5583, -1 }, { 13607, 5565, -1 },
+    { 13640, 5584, -1 }, { 13605, 5587, -1 }, { 13609, 5586, -1 }, { 13617, 5588, -1 }, { 13633, 5589, -1 }, { 13581, 5565, -1 },
+    { 13580, 5568, -1 }, { 13654, 5590, -1 }, { 13629, 5591, -1 }, { 13653, 5592, -1 }, { 13610, 5593, -1 }, { 13622, 5594, -1 },
+    { 13623, 5595, -1 }, { 13668, 5596, -1 }, { 13663, 5597, -1 }, { 13664, 5598, -1 }, { 13631, 5599, -1 }, { 13653, 5600, -1 },
+    { 13648, 5601, -1 }, { 13669, 5602, -1 }, { 13627, 5603, -1 }, { 13631, 5604, -1 }, { 13644, 5605, -1 }, { 13657, 5606, -1 },
+    { 13656, 5607, -1 }, { 13681, 5608, -1 }, { 13669, 5609, -1 }, { 13665, 5610, -1 }, { 13654, 5606, -1 }, { 13686, 5611, -1 },
+    { 13693, 5612, -1 }, { 13597, 5571, -1 }, { 13660, 5614, -1 }, { 13689, 5615, -1 }, { 13690, 5613, -1 }, { 13647, 5618, -1 },
+    { 13686, 5616, -1 }, { 13695, 5620, -1 }, { 13669, 5608, -1 }, { 13654, 5617, -1 }, { 13686, 5619, -1 }, { 13681, 5621, -1 },
+    { 13709, 5623, -1 }, { 13667, 5624, -1 }, { 13706, 5622, -1 }, { 13689, 5610, -1 }, { 13617, 5583, -1 }, { 13673, 5622, -1 },
+    { 13628, 5607, -1 }, { 13669, 5625, -1 }, { 13687, 5626, -1 }, { 13689, 5628, -1 }, { 13714, 5627, -1 }, { 13719, 5629, -1 },
+    { 13670, 5630, -1 }, { 13663, 5632, -1 }, { 13676, 5631, -1 }, { 13648, 5616, -1 }, { 13709, 5633, -1 }, { 13628, 5603, -1 },
+    { 13721, 5637, -1 }, { 13670, 5634, -1 }, { 13718, 5635, -1 }, { 13714, 5636, -1 }, { 13710, 5638, -1 }, { 13696, 5640, -1 },
+    { 13676, 5641, -1 }, { 13704, 5643, -1 }, { 13718, 5644, -1 }, { 13651, 5609, -1 }, { 13683, 5645, -1 }, { 13684, 5639, -1 },
+    { 13733, 5642, -1 }, { 13677, 5646, -1 }, { 13660, 5623, -1 }, { 13734, 5647, -1 }, { 13727, 5648, -1 }, { 13698, 5649, -1 },
+    { 13649, 5606, -1 }, { 13674, 5616, -1 }, { 13663, 5622, -1 }, { 13693, 5652, -1 }, { 13721, 5653, -1 }, { 13697, 5654, -1 },
+    { 13687, 5606, -1 }, { 13646, 5606, -1 }, { 13741, 5655, -1 }, { 13695, 5650, -1 }, { 13655, 5617, -1 }, { 13743, 5651, -1 },
+    { 13722, 5656, -1 }, { 13726, 5633, -1 }, { 13699, 5657, -1 }, { 13737, 5658, -1 }, { 13726, 5662, -1 }, { 13726, 5663, -1 },
+    { 13730, 5658, -1 }, { 13757, 5659, -1 }, { 13707, 5660, -1 }, { 13748, 5661, -1 }, { 13730, 5664, -1 }, { 13761, 5665, -1 },
+    { 13723, 5666, -1 }, { 13747, 5667, -1 }, { 13748, 5668, -1 }, { 13757, 5670, -1 }, { 13704, 5649, -1 }, { 13757, 5673, -1 },
+    { 13714, 5669, -1 }, { 13758, 5671, -1 }, { 13745, 5674, -1 }, { 13749, 5675, -1 }, { 13749, 5672, -1 }, { 13750, 5676, -1 },
+    { 13775, 5677, -1 }, { 13727, 5678, -1 }, { 13772, 5679, -1 }, { 13725, 5679, -1 }, { 13711, 5651, -1 }, { 13740, 5682, -1 },
+    { 13750, 5683, -1 }, { 13781, 5680, -1 }, { 13733, 5681, -1 }, { 13770, 5684, -1 }, { 13737, 5685, -1 }, { 13723, 5686, -1 },
+    { 13760, 5670, -1 }, { 13757, 5687, -1 }, { 13747, 5670, -1 }, { 13781, 5688, -1 }, { 13731, 5689, -1 }, { 13771, 5689, -1 },
+    { 13759, 5691, -1 }, { 13747, 5690, -1 }, { 13759, 5692, -1 }, { 13762, 5689, -1 }, { 13779, 5690, -1 }, { 13758, 5693, -1 },
+    { 13774, 5694, -1 }, { 13766, 5695, -1 }, { 13743, 5690, -1 }, { 13802, 5698, -1 }, { 13759, 5693, -1 }, { 13797, 5691, -1 },
+    { 13818, 5696, -1 }, { 13786, 5693, -1 }, { 13784, 5694, -1 }, { 13801, 5693, -1 }, { 13806, 5697, -1 }, { 13773, 5699, -1 },
+    { 13779, 5690, -1 }, { 13755, 5692, -1 }, { 13773, 5700, -1 }, { 13776, 5701, -1 }, { 13771, 5702, -1 }, { 13771, 5703, -1 },
+    { 13770, 5699, -1 }, { 13759, 5691, -1 }, { 13778, 5705, -1 }, { 13777, 5704, -1 }, { 13827, 5706, -1 }, { 13817, 5707, -1 },
+    { 13772, 5692, -1 }, { 13799, 5692, -1 }, { 13827, 5704, -1 }, { 13795, 5708, -1 }, { 13830, 5709, -1 }, { 13786, 5710, -1 },
+    { 13821, 5710, -1 }, { 13813, 5711, -1 }, { 13807, 5712, -1 }, { 13838, 5713, -1 }, { 13823, 5713, -1 }, { 13799, 5715, -1 },
+    { 13753, 5692, -1 }, { 13788, 5692, -1 }, { 13799, 5713, -1 }, { 13784, 5714, -1 }, { 13831, 5716, -1 }, { 13819, 5714, -1 },
+    { 13837, 5717, -1 }, { 13850, 5718, -1 }, { 13756, 5693, -1 }, { 13828, 5719, -1 }, { 13791, 5717, -1 }, { 13835, 5717, -1 },
+    { 13764, 5693, -1 }, { 13807, 5720, -1 }, { 13804, 5721, -1 }, { 13855, 5722, -1 }, { 13825, 5723, -1 }, { 13834, 5717, -1 },
+    { 13805, 5724, -1 }, { 13826, 5728, -1 }, { 13857, 5725, -1 }, { 13823, 5726, -1 }, { 13833, 5727, -1 }, { 13815, 5729, -1 },
+    { 13804, 5730, -1 }, { 13805, 5732, -1 }, { 13820, 5717, -1 }, { 13867, 5731, -1 }, { 13836, 5733, -1 }, { 13870, 5734, -1 },
+    { 13871, 5735, -1 }, { 13823, 5736, -1 }, { 13872, 5737, -1 }, { 13855, 5738, -1 }, { 13825, 5739, -1 }, { 13832, 5715, -1 },
+    { 13857, 5740, -1 }, { 13852, 5742, -1 }, { 13866, 5744, -1 }, { 13876, 5741, -1 }, { 13849, 5743, -1 }, { 13864, 5745, -1 },
+    { 13858, 5746, -1 }, { 13854, 5747, -1 }, { 13824, 5748, -1 }, { 13880, 5749, -1 }, { 13830, 5750, -1 }, { 13873, 5751, -1 },
+    { 13847, 5753, -1 }, { 13857, 5755, -1 }, { 13862, 5754, -1 }, { 13862, 5750, -1 }, { 13866, 5752, -1 }, { 13829, 5747, -1 },
+    { 13878, 5756, -1 }, { 13860, 5746, -1 }, { 13885, 5757, -1 }, { 13861, 5758, -1 }, { 13896, 5759, -1 }, { 13875, 5760, -1 },
+    { 13854, 5761, -1 }, { 13870, 5762, -1 }, { 13856, 5763, -1 }, { 13799, 5723, -1 }, { 13867, 5754, -1 }, { 13860, 5764, -1 },
+    { 13904, 5768, -1 }, { 13861, 5751, -1 }, { 13904, 5765, -1 }, { 13856, 5766, -1 }, { 13904, 5770, -1 }, { 13888, 5765, -1 },
+    { 13883, 5771, -1 }, { 13879, 5753, -1 }, { 13866, 5772, -1 }, { 13865, 5767, -1 }, { 13913, 5773, -1 }, { 13873, 5766, -1 },
+    { 13906, 5774, -1 }, { 13865, 5776, -1 }, { 13918, 5778, -1 }, { 13887, 5770, -1 }, { 13872, 5769, -1 }, { 13902, 5775, -1 },
+    { 13874, 5777, -1 }, { 13857, 5751, -1 }, { 13904, 5779, -1 }, { 13899, 5780, -1 }, { 13921, 5781, -1 }, { 13916, 5782, -1 },
+    { 13897, 5783, -1 }, { 13904, 5784, -1 }, { 13906, 5785, -1 }, { 13931, 5786, -1 }, { 13888, 5790, -1 }, { 13887, 5787, -1 },
+    { 13911, 5788, -1 }, { 13889, 5789, -1 }, { 13836, 5751, -1 }, { 13894, 5791, -1 }, { 13931, 5792, -1 }, { 13943, 5793, -1 },
+    { 13915, 5794, -1 }, { 13945, 5798, -1 }, { 13917, 5780, -1 }, { 13894, 5795, -1 }, { 13934, 5796, -1 }, { 13911, 5797, -1 },
+    { 13941, 5799, -1 }, { 13899, 5800, -1 }, { 13944, 5804, -1 }, { 13913, 5800, -1 }, { 13947, 5805, -1 }, { 13955, 5806, -1 },
+    { 13935, 5801, -1 }, { 13941, 5806, -1 }, { 13882, 5786, -1 }, { 13945, 5802, -1 }, { 13932, 5808, -1 }, { 13947, 5807, -1 },
+    { 13931, 5808, -1 }, { 13930, 5807, -1 }, { 13926, 5809, -1 }, { 13973, 5809, -1 }, { 13945, 5808, -1 }, { 13968, 5810, -1 },
+    { 13985, 5810, -1 }, { 13950, 5807, -1 }, { 13962, 5803, -1 }, { 13911, 5807, -1 }, { 13970, 5810, -1 }, { 13933, 5811, -1 },
+    { 13942, 5806, -1 }, { 13993, 5812, -1 }, { 13936, 5806, -1 }, { 13932, 5806, -1 }, { 13942, 5813, -1 }, { 13984, 5809, -1 },
+    { 13972, 5814, -1 }, { 13950, 5815, -1 }, { 13971, 5808, -1 }, { 13945, 5818, -1 }, { 13936, 5786, -1 }, { 13941, 5816, -1 },
+    { 13976, 5817, -1 }, { 13917, 5807, -1 }, { 13943, 5810, -1 }, { 13947, 5807, -1 }, { 13935, 5810, -1 }, { 13951, 5819, -1 },
+    { 13954, 5820, -1 }, { 13980, 5821, -1 }, { 14059, 5827, -1 }, { 14030, 5829, -1 }, { 13892, 5798, -1 }, { 13935, 5813, -1 },
+    { 13932, 5808, -1 }, { 14023, 5830, -1 }, { 14028, 5829, -1 }, { 14052, 5827, -1 }, { 13981, 5815, -1 }, { 14078, 5835, -1 },
+    { 14074, 5834, -1 }, { 14074, 5836, -1 }, { 13952, 5806, -1 }, { 13951, 5807, -1 }, { 13941, 5807, -1 }, { 13964, 5807, -1 },
+    { 13925, 5807, -1 }, { 14042, 5833, -1 }, { 14065, 5832, -1 }, { 14069, 5827, -1 }, { 14047, 5837, -1 }, { 13997, 5822, -1 },
+    { 13961, 5822, -1 }, { 13947, 5808, -1 }, { 13962, 5808, -1 }, { 13994, 5822, -1 }, { 13996, 5822, -1 }, { 14066, 5827, -1 },
+    { 13979, 5822, -1 }, { 14004, 5823, -1 }, { 13973, 5810, -1 }, { 14091, 5838, -1 }, { 13966, 5823, -1 }, { 14099, 5839, -1 },
+    { 13985, 5823, -1 }, { 14059, 5827, -1 }, { 13958, 5823, -1 }, { 14034, 5832, -1 }, { 13958, 5823, -1 }, { 13996, 5823, -1 },
+    { 14066, 5841, -1 }, { 14041, 5832, -1 }, { 14089, 5840, -1 }, { 14100, 5845, -1 }, { 14106, 5843, -1 }, { 14084, 5833, -1 },
+    { 14169, 5856, -1 }, { 14060, 5832, -1 }, { 14127, 5857, -1 }, { 14075, 5831, -1 }, { 14181, 5858, -1 }, { 13989, 5823, -1 },
+    { 13981, 5823, -1 }, { 13984, 5824, -1 }, { 14004, 5824, -1 }, { 14072, 5840, -1 }, { 14003, 5824, -1 }, { 14044, 5834, -1 },
+    { 14180, 5842, -1 }, { 14004, 5824, -1 }, { 13974, 5824, -1 }, { 13961, 5823, -1 }, { 13976, 5824, -1 }, { 14107, 5849, -1 },
+    { 14006, 5824, -1 }, { 14070, 5843, -1 }, { 14102, 5847, -1 }, { 14106, 5843, -1 }, { 14010, 5824, -1 }, { 14002, 5825, -1 },
+    { 14081, 5844, -1 }, { 14051, 5844, -1 }, { 14134, 5859, -1 }, { 14072, 5846, -1 }, { 14016, 5824, -1 }, { 14017, 5824, -1 },
+    { 14025, 5825, -1 }, { 14137, 5861, -1 }, { 14051, 5831, -1 }, { 14008, 5825, -1 }, { 14080, 5846, -1 }, { 14013, 5828, -1 },
+    { 13982, 5824, -1 }, { 14189, 5864, -1 }, { 14010, 5825, -1 }, { 14002, 5823, -1 }, { 14001, 5823, -1 }, { 14122, 5849, -1 },
+    { 14119, 5849, -1 }, { 14162, 5865, -1 }, { 14016, 5824, -1 }, { 14026, 5825, -1 }, { 13980, 5824, -1 }, { 14110, 5849, -1 },
+    { 14140, 5860, -1 }, { 13993, 5825, -1 }, { 14041, 5825, -1 }, { 14004, 5826, -1 }, { 14165, 5862, -1 }, { 14000, 5826, -1 },
+    { 14010, 5826, -1 }, { 14008, 5826, -1 }, { 14049, 5826, -1 }, { 14032, 5825, -1 }, { 14182, 5848, -1 }, { 13989, 5825, -1 },
+    { 14025, 5828, -1 }, { 14031, 5831, -1 }, { 14073, 5831, -1 }, { 14053, 5826, -1 }, { 14166, 5870, -1 }, { 14091, 5846, -1 },
+    { 14087, 5846, -1 }, { 14116, 5850, -1 }, { 14079, 5850, -1 }, { 14099, 5847, -1 }, { 14035, 5825, -1 }, { 14186, 5867, -1 },
+    { 14112, 5850, -1 }, { 14076, 5828, -1 }, { 14062, 5826, -1 }, { 14155, 5868, -1 }, { 14000, 5825, -1 }, { 14027, 5825, -1 },
+    { 14174, 5869, -1 }, { 14114, 5852, -1 }, { 14041, 5828, -1 }, { 14119, 5846, -1 }, { 14060, 5828, -1 }, { 14166, 5871, -1 },
+    { 14043, 5828, -1 }, { 14104, 5851, -1 }, { 14202, 5872, -1 }, { 14001, 5826, -1 }, { 14064, 5826, -1 }, { 14082, 5851, -1 },
+    { 14158, 5863, -1 }, { 14143, 5852, -1 }, { 14182, 5863, -1 }, { 14021, 5826, -1 }, { 14132, 5848, -1 }, { 14102, 5852, -1 },
+    { 14102, 5851, -1 }, { 14196, 5873, -1 }, { 14156, 5874, -1 }, { 14118, 5851, -1 }, { 14139, 5866, -1 }, { 14191, 5866, -1 },
+    { 14145, 5852, -1 }, { 14123, 5851, -1 }, { 14060, 5826, -1 }, { 14151, 5875, -1 }, { 14176, 5876, -1 }, { 14178, 5878, -1 },
+    { 14209, 5873, -1 }, { 14202, 5877, -1 }, { 14203, 5879, -1 }, { 14095, 5852, -1 }, { 14097, 5851, -1 }, { 14154, 5880, -1 },
+    { 14123, 5852, -1 }, { 14198, 5881, -1 }, { 14102, 5853, -1 }, { 14118, 5851, -1 }, { 14212, 5883, -1 }, { 14138, 5851, -1 },
+    { 14098, 5851, -1 }, { 14080, 5851, -1 }, { 14212, 5887, -1 }, { 14225, 5884, -1 }, { 14124, 5852, -1 }, { 14166, 5885, -1 },
+    { 14119, 5854, -1 }, { 14143, 5855, -1 }, { 14149, 5853, -1 }, { 14148, 5866, -1 }, { 14109, 5853, -1 }, { 14119, 5854, -1 },
+    { 14194, 5886, -1 }, { 14093, 5851, -1 }, { 14143, 5852, -1 }, { 14223, 5888, -1 }, { 14186, 5882, -1 }, { 14197, 5890, -1 },
+    { 14189, 5891, -1 }, { 14105, 5851, -1 }, { 14158, 5853, -1 }, { 14139, 5853, -1 }, { 14105, 5851, -1 }, { 14213, 5882, -1 },
+    { 14203, 5882, -1 }, { 14111, 5851, -1 }, { 14135, 5851, -1 }, { 14104, 5851, -1 }, { 14219, 5889, -1 }, { 14120, 5853, -1 },
+    { 14150, 5866, -1 }, { 14111, 5854, -1 }, { 14167, 5855, -1 }, { 14221, 5894, -1 }, { 14158, 5854, -1 }, { 14128, 5854, -1 },
+    { 14142, 5855, -1 }, { 14227, 5892, -1 }, { 14199, 5883, -1 }, { 14195, 5895, -1 }, { 14123, 5855, -1 }, { 14205, 5896, -1 },
+    { 14234, 5893, -1 }, { 14224, 5897, -1 }, { 14211, 5898, -1 }, { 14237, 5899, -1 }, { 14229, 5900, -1 }, { 14209, 5901, -1 },
+    { 14191, 5902, -1 }, { 14169, 5854, -1 }, { 14241, 5904, -1 }, { 14237, 5905, -1 }, { 14104, 5853, -1 }, { 14240, 5906, -1 },
+    { 14210, 5907, -1 }, { 14125, 5853, -1 }, { 14193, 5909, -1 }, { 14243, 5910, -1 }, { 14220, 5911, -1 }, { 14130, 5854, -1 },
+    { 14251, 5914, -1 }, { 14213, 5903, -1 }, { 14247, 5915, -1 }, { 14143, 5855, -1 }, { 14246, 5916, -1 }, { 14208, 5916, -1 },
+    { 14197, 5917, -1 }, { 14165, 5855, -1 }, { 14173, 5888, -1 }, { 14246, 5908, -1 }, { 14249, 5912, -1 }, { 14198, 5882, -1 },
+    { 14206, 5913, -1 }, { 14255, 5918, -1 }, { 14230, 5919, -1 }, { 14251, 5920, -1 }, { 14262, 5921, -1 }, { 14232, 5922, -1 },
+    { 14219, 5923, -1 }, { 14257, 5926, -1 }, { 14231, 5919, -1 }, { 14211, 5924, -1 }, { 14245, 5925, -1 }, { 14213, 5924, -1 },
+    { 14226, 5925, -1 }, { 14219, 5928, -1 }, { 14237, 5924, -1 }, { 14276, 5929, -1 }, { 14267, 5930, -1 }, { 14268, 5931, -1 },
+    { 14260, 5933, -1 }, { 14259, 5927, -1 }, { 14262, 5932, -1 }, { 14274, 5934, -1 }, { 14245, 5935, -1 }, { 14247, 5936, -1 },
+    { 14280, 5937, -1 }, { 14250, 5936, -1 }, { 14290, 5938, -1 }, { 14263, 5935, -1 }, { 14200, 5910, -1 }, { 14271, 5939, -1 },
+    { 14277, 5940, -1 }, { 14276, 5940, -1 }, { 14265, 5941, -1 }, { 14286, 5942, -1 }, { 14282, 5943, -1 }, { 14283, 5944, -1 },
+    { 14252, 5945, -1 }, { 14293, 5949, -1 }, { 14247, 5946, -1 }, { 14246, 5950, -1 }, { 14272, 5954, -1 }, { 14212, 5923, -1 },
+    { 14302, 5952, -1 }, { 14251, 5951, -1 }, { 14250, 5936, -1 }, { 14319, 5947, -1 }, { 14278, 5948, -1 }, { 14301, 5951, -1 },
+    { 14280, 5930, -1 }, { 14305, 5951, -1 }, { 14302, 5956, -1 }, { 14259, 5953, -1 }, { 14222, 5928, -1 }, { 14296, 5955, -1 },
+    { 14291, 5952, -1 }, { 14270, 5955, -1 }, { 14323, 5955, -1 }, { 14289, 5957, -1 }, { 14281, 5958, -1 }, { 14238, 5925, -1 },
+    { 14324, 5959, -1 }, { 14332, 5960, -1 }, { 14274, 5951, -1 }, { 14291, 5961, -1 }, { 14299, 5951, -1 }, { 14307, 5962, -1 },
+    { 14240, 5928, -1 }, { 14288, 5963, -1 }, { 14293, 5951, -1 }, { 14282, 5964, -1 }, { 14314, 5965, -1 }, { 14292, 5953, -1 },
+    { 14331, 5966, -1 }, { 14292, 5967, -1 }, { 14278, 5952, -1 }, { 14272, 5953, -1 }, { 14320, 5968, -1 }, { 14275, 5958, -1 },
+    { 14309, 5952, -1 }, { 14320, 5969, -1 }, { 14295, 5970, -1 }, { 14318, 5953, -1 }, { 14297, 5971, -1 }, { 14327, 5972, -1 },
+    { 14343, 5968, -1 }, { 14304, 5973, -1 }, { 14322, 5974, -1 }, { 14333, 5965, -1 }, { 14323, 5967, -1 }, { 14291, 5960, -1 },
+    { 14338, 5975, -1 }, { 14302, 5976, -1 }, { 14302, 5977, -1 }, { 14288, 5951, -1 }, { 14309, 5953, -1 }, { 14360, 5978, -1 },
+    { 14317, 5963, -1 }, { 14315, 5970, -1 }, { 14363, 5979, -1 }, { 14313, 5953, -1 }, { 14313, 5953, -1 }, { 14348, 5980, -1 },
+    { 14316, 5981, -1 }, { 14335, 5985, -1 }, { 14345, 5982, -1 }, { 14323, 5984, -1 }, { 14334, 5986, -1 }, { 14373, 5987, -1 },
+    { 14371, 5988, -1 }, { 14269, 5953, -1 }, { 14315, 5984, -1 }, { 14362, 5989, -1 }, { 14324, 5990, -1 }, { 14358, 5984, -1 },
+    { 14348, 5992, -1 }, { 14358, 5993, -1 }, { 14371, 5994, -1 }, { 14371, 5995, -1 }, { 14374, 5997, -1 }, { 14337, 5996, -1 },
+    { 14354, 5999, -1 }, { 14341, 5983, -1 }, { 14372, 6000, -1 }, { 14374, 6001, -1 }, { 14376, 6003, -1 }, { 14342, 5984, -1 },
+    { 14346, 6004, -1 }, { 14379, 6004, -1 }, { 14383, 5991, -1 }, { 14349, 5998, -1 }, { 14360, 6002, -1 }, { 14340, 6001, -1 },
+    { 14346, 6005, -1 }, { 14335, 6001, -1 }, { 14390, 6006, -1 }, { 14345, 6007, -1 }, { 14356, 6008, -1 }, { 14357, 6009, -1 },
+    { 14397, 6011, -1 }, { 14364, 5991, -1 }, { 14362, 6010, -1 }, { 14379, 6012, -1 }, { 14353, 6009, -1 }, { 14387, 6007, -1 },
+    { 14386, 6013, -1 }, { 14367, 6015, -1 }, { 14366, 6014, -1 }, { 14400, 6016, -1 }, { 14322, 5987, -1 }, { 14385, 6017, -1 },
+    { 14350, 6010, -1 }, { 14360, 6018, -1 }, { 14387, 6019, -1 }, { 14359, 6020, -1 }, { 14324, 5984, -1 }, { 14360, 6021, -1 },
+    { 14406, 6022, -1 }, { 14407, 6023, -1 }, { 14408, 6024, -1 }, { 14406, 6025, -1 }, { 14374, 6026, -1 }, { 14427, 6027, -1 },
+    { 14390, 6028, -1 }, { 14381, 6029, -1 }, { 14370, 6030, -1 }, { 14419, 6031, -1 }, { 14375, 6032, -1 }, { 14413, 6033, -1 },
+    { 14407, 6034, -1 }, { 14378, 6038, -1 }, { 14428, 6034, -1 }, { 14412, 6036, -1 }, { 14364, 6013, -1 }, { 14396, 6035, -1 },
+    { 14386, 6035, -1 }, { 14392, 6037, -1 }, { 14442, 6039, -1 }, { 14429, 6040, -1 }, { 14441, 6041, -1 }, { 14431, 6042, -1 },
+    { 14439, 6042, -1 }, { 14430, 6043, -1 }, { 14396, 6044, -1 }, { 14444, 6045, -1 }, { 14448, 6046, -1 }, { 14406, 6050, -1 },
+    { 14450, 6051, -1 }, { 14440, 6051, -1 }, { 14410, 6052, -1 }, { 14386, 6007, -1 }, { 14413, 6052, -1 }, { 14431, 6038, -1 },
+    { 14401, 6053, -1 }, { 14440, 6054, -1 }, { 14447, 6055, -1 }, { 14384, 6035, -1 }, { 14457, 6047, -1 }, { 14450, 6056, -1 },
+    { 14407, 6060, -1 }, { 14429, 6057, -1 }, { 14460, 6061, -1 }, { 14423, 6048, -1 }, { 14468, 6058, -1 }, { 14474, 6059, -1 },
+    { 14465, 6049, -1 }, { 14434, 6055, -1 }, { 14428, 6062, -1 }, { 14418, 6065, -1 }, { 14461, 6062, -1 }, { 14425, 6066, -1 },
+    { 14460, 6067, -1 }, { 14424, 6068, -1 }, { 14426, 6070, -1 }, { 14434, 6063, -1 }, { 0, 6064, 0 }, { 14402, 6042, -1 },
+    { 0, 6069, 1 }, { 14386, 6071, -1 }, { 14387, 6072, 3 }, { 14416, 6056, -1 }, { 14389, 6074, -1 }, { 14389, 6076, 6 },
+    { 14417, 6051, -1 }, { 0, 6077, 8 }, { 0, 6078, 9 }, { 0, 6079, 10 }, { 14394, 6086, -1 }, { 14394, 6087, -1 },
+    { 14391, 6088, -1 }, { 14409, 6051, -1 }, { 14396, 6089, -1 }, { 14394, 6091, -1 }, { 14394, 6100, -1 }, { 14399, 6108, -1 },
+    { 14401, 6129, -1 }, { 0, 6073, 29 }, { 14399, 6096, -1 }, { 14402, 6080, -1 }, { 0, 6129, 28 }, { 14419, 6056, -1 },
+    { 14400, 6105, -1 }, { 14401, 6075, -1 }, { 14406, 6081, -1 }, { 0, 6085, 35 }, { 0, 6090, 36 }, { 0, 6082, 37 },
+    { 14440, 6066, -1 }, { 14407, 6084, -1 }, { 14408, 6103, -1 }, { 14409, 6092, -1 }, { 0, 6098, 41 }, { 14410, 6094, -1 },
+    { 0, 6087, 20 }, { 0, 6099, 45 }, { 14411, 6101, 46 }, { 0, 6102, 48 }, { 14412, 6104, -1 }, { 14413, 6123, -1 },
+    { 14414, 6144, -1 }, { 0, 6083, 52 }, { 14414, 6093, -1 }, { 0, 6095, 54 }, { 0, 6106, 55 }, { 0, 6111, 56 },
+    { 0, 6107, 57 }, { 0, 6115, 59 }, { 14417, 6117, -1 }, { 14418, 6136, -1 }, { 14420, 6162, -1 }, { 0, 6097, 63 },
+    { 14420, 6109, -1 }, { 14417, 6110, -1 }, { 0, 6112, 67 }, { 14423, 6113, 68 }, { 14428, 6119, -1 }, { 14424, 6114, -1 },
+    { 14425, 6116, -1 }, { 14390, 6079, -1 }, { 0, 6128, 83 }, { 14431, 6118, 84 }, { 14431, 6120, -1 }, { 0, 6121, 97 },
+    { 0, 6122, 98 }, { 14436, 6145, -1 }, { 14437, 6146, -1 }, { 14437, 6152, -1 }, { 14436, 6156, -1 }, { 14441, 6166, -1 },
+    { 0, 6124, 105 }, { 14438, 6137, 106 }, { 0, 6126, 109 }, { 14442, 6130, -1 }, { 14445, 6133, -1 }, { 0, 6094, 44 },
+    { 14446, 6140, 112 }, { 14443, 6153, -1 }, { 14448, 6168, -1 }, { 0, 6125, 117 }, { 0, 6127, 119 }, { 0, 6131, 121 },
+    { 14449, 6147, -1 }, { 14451, 6151, -1 }, { 0, 6154, 125 }, { 0, 6157, 126 }, { 0, 6158, 127 }, { 0, 6170, 129 },
+    { 14449, 6177, 130 }, { 14452, 6178, -1 }, { 0, 6180, 137 }, { 0, 6158, 128 }, { 0, 6178, 133 }, { 14442, 6137, -1 },
+    { 14453, 6179, 134 }, { 14455, 6179, -1 }, { 14456, 6184, 138 }, { 14453, 6190, -1 }, { 14415, 6107, -1 }, { 14457, 6197, -1 },
+    { 0, 6204, 142 }, { 0, 6160, 143 }, { 0, 6161, 144 }, { 0, 6183, 145 }, { 0, 6188, 146 }, { 14449, 6125, -1 },
+    { 0, 6189, 147 }, { 0, 6192, 148 }, { 0, 6205, 149 }, { 0, 6207, 150 }, { 0, 6151, 124 }, { 0, 6210, 152 },
+    { 0, 6134, 153 }, { 0, 6163, 154 }, { 14460, 6207, -1 }, { 0, 6138, 155 }, { 0, 6159, 156 }, { 0, 6167, 157 },
+    { 0, 6174, 158 }, { 0, 6181, 159 }, { 14458, 6186, -1 }, { 0, 6196, 163 }, { 0, 6148, 165 }, { 0, 6171, 166 },
+    { 0, 6173, 167 }, { 14457, 6132, -1 }, { 14461, 6135, -1 }, { 0, 6127, 120 }, { 14459, 6172, -1 }, { 0, 6139, 175 },
+    { 14460, 6141, -1 }, { 14462, 6164, -1 }, { 14462, 6175, -1 }, { 0, 6208, 181 }, { 0, 6142, 182 }, { 0, 6143, 184 },
+    { 0, 6150, 185 }, { 0, 6181, 160 }, { 14467, 133, -1 }, { 0, 6149, 188 }, { 0, 6196, 164 }, { 0, 6182, 190 },
+    { 0, 6187, 191 }, { 0, 6185, 192 }, { 0, 6193, 193 }, { 14468, 6195, -1 }, { 14469, 6214, -1 }, { 0, 6191, 196 },
+    { 0, 6211, 197 }, { 14470, 6155, -1 }, { 14470, 6165, -1 }, { 14472, 6169, -1 }, { 0, 6176, 203 }, { 0, 6181, 161 },
+    { 14473, 6194, -1 }, { 14476, 6198, -1 }, { 14474, 6203, -1 }, { 0, 6201, 217 }, { 14476, 6212, 218 }, { 14476, 6199, -1 },
+    { 0, 6219, 224 }, { 14477, 6200, -1 }, { 14484, 6202, 227 }, { 14488, 6206, -1 }, { 0, 6209, 241 }, { 0, 6213, 242 },
+    { 0, 6256, 243 }, { 14490, 6215, 244 }, { 14491, 6242, 246 }, { 0, 6216, 248 }, { 14490, 6217, -1 }, { 0, 6218, 251 },
+    { 0, 6220, 253 }, { 0, 6221, 254 }, { 0, 6222, 255 }, { 0, 6223, 256 }, { 14492, 6224, -1 }, { 14491, 6225, -1 },
+    { 0, 6226, 262 }, { 0, 6227, 265 }, { 0, 6228, 266 }, { 0, 6229, 267 }, { 0, 6230, 268 }, { 0, 6231, 269 },
+    { 0, 6240, 270 }, { 14495, 6233, -1 }, { 0, 6243, 273 }, { 14492, 6232, -1 }, { 14493, 6234, -1 }, { 14494, 6235, -1 },
+    { 14499, 6236, -1 }, { 0, 6237, 280 }, { 14501, 6239, -1 }, { 0, 6244, 283 }, { 0, 6245, 284 }, { 14501, 6247, -1 },
+    { 14502, 6266, -1 }, { 0, 6238, 287 }, { 0, 6241, 288 }, { 14482, 6200, -1 }, { 0, 135, 291 }, { 0, 6246, 293 },
+    { 0, 6248, 294 }, { 0, 6249, 296 }, { 14503, 6250, -1 }, { 14502, 6251, 299 }, { 14506, 6255, -1 }, { 0, 6252, 303 },
+    { 14507, 6253, -1 }, { 0, 6254, 305 }, { 14508, 6257, 306 }, { 14508, 6258, -1 }, { 0, 6239, 282 }, { 14509, 6259, -1 },
+    { 14510, 6260, -1 }, { 0, 6261, 315 }, { 14511, 6262, -1 }, { 14512, 6263, -1 }, { 0, 6264, 318 }, { 14513, 6265, -1 },
+    { 0, 6270, 321 }, { 0, 6267, 322 }, { 14515, 6269, -1 }, { 14516, 6288, -1 }, { 14513, 6268, -1 }, { 14516, 6271, -1 },
+    { 14519, 6272, -1 }, { 14516, 6273, -1 }, { 14520, 6274, -1 }, { 14521, 6275, -1 }, { 14523, 6276, -1 }, { 14522, 6277, -1 },
+    { 14526, 6278, -1 }, { 14526, 6279, -1 }, { 14523, 6275, -1 }, { 14527, 6287, -1 }, { 14529, 6287, -1 }, { 14533, 6290, -1 },
+    { 14532, 6299, -1 }, { 0, 6301, 344 }, { 14534, 6308, -1 }, { 14536, 6309, -1 }, { 14531, 6308, -1 }, { 14537, 6317, -1 },
+    { 14535, 6318, -1 }, { 14540, 6320, -1 }, { 14543, 6321, -1 }, { 0, 6328, 357 }, { 0, 6265, 320 }, { 14545, 6329, -1 },
+    { 14540, 6320, -1 }, { 14548, 6331, -1 }, { 14546, 6329, -1 }, { 0, 6333, 361 }, { 14549, 6335, -1 }, { 14547, 6281, -1 },
+    { 14549, 6295, -1 }, { 14552, 6297, -1 }, { 14554, 6302, -1 }, { 0, 6303, 368 }, { 14554, 6305, -1 }, { 14554, 6322, -1 },
+    { 14558, 6324, -1 }, { 14547, 6335, -1 }, { 14559, 6325, -1 }, { 14561, 6326, -1 }, { 0, 6327, 377 }, { 14561, 6330, -1 },
+    { 14563, 6304, -1 }, { 0, 6339, 381 }, { 14566, 6343, -1 }, { 0, 6339, 382 }, { 14529, 6287, -1 }, { 0, 6344, 384 },
+    { 14568, 6354, -1 }, { 14568, 6332, -1 }, { 14561, 6304, -1 }, { 0, 6353, 387 }, { 14570, 6357, -1 }, { 14570, 6358, -1 },
+    { 14572, 6360, -1 }, { 14573, 6364, -1 }, { 14575, 6388, -1 }, { 0, 6280, 399 }, { 14577, 6307, -1 }, { 14573, 6310, 401 },
+    { 0, 6342, 403 }, { 0, 6282, 404 }, { 14579, 6283, -1 }, { 14575, 6285, -1 }, { 0, 6311, 407 }, { 0, 6284, 408 },
+    { 0, 6289, 409 }, { 0, 6313, 410 }, { 14580, 6315, -1 }, { 14581, 6334, -1 }, { 0, 6348, 413 }, { 0, 6364, 395 },
+    { 14582, 6349, -1 }, { 0, 6286, 415 }, { 14557, 6305, -1 }, { 0, 6294, 416 }, { 14581, 6323, -1 }, { 0, 6338, 418 },
+    { 0, 6291, 419 }, { 0, 6292, 420 }, { 0, 6293, 422 }, { 0, 6298, 423 }, { 0, 6345, 424 }, { 0, 6296, 427 },
+    { 0, 6300, 428 }, { 0, 6306, 429 }, { 14583, 6314, -1 }, { 14583, 6356, -1 }, { 14586, 6336, -1 }, { 0, 6359, 436 },
+    { 14587, 6312, -1 }, { 0, 6341, 439 }, { 0, 6346, 440 }, { 0, 6350, 441 }, { 14588, 6352, -1 }, { 14589, 6371, -1 },
+    { 14587, 6316, -1 }, { 0, 6319, 445 }, { 0, 6337, 447 }, { 0, 6362, 448 }, { 0, 6363, 449 }, { 0, 6365, 451 },
+    { 0, 6361, 452 }, { 0, 6374, 453 }, { 14591, 6385, -1 }, { 0, 6394, 455 }, { 0, 6396, 456 }, { 0, 6397, 457 },
+    { 0, 6363, 450 }, { 0, 6399, 458 }, { 0, 6406, 459 }, { 0, 6419, 461 }, { 0, 6340, 462 }, { 0, 6378, 463 },
+    { 0, 6347, 464 }, { 14591, 6351, -1 }, { 0, 6355, 466 }, { 0, 6366, 467 }, { 0, 6367, 469 }, { 14590, 6368, -1 },
+    { 14591, 6390, -1 }, { 14596, 6369, -1 }, { 14595, 6370, -1 }, { 0, 6406, 460 }, { 0, 6372, 477 }, { 0, 6373, 478 },
+    { 14594, 6375, -1 }, { 14599, 6376, -1 }, { 14597, 6392, -1 }, { 0, 6377, 483 }, { 14599, 6379, -1 }, { 0, 6380, 486 },
+    { 14598, 6381, -1 }, { 0, 6382, 490 }, { 14602, 6383, -1 }, { 14603, 6391, -1 }, { 14601, 6401, -1 }, { 14606, 6384, -1 },
+    { 14603, 6386, -1 }, { 14607, 6395, -1 }, { 0, 6398, 500 }, { 14609, 6387, -1 }, { 0, 6389, 502 }, { 0, 6393, 505 },
+    { 0, 6400, 506 }, { 0, 6402, 508 }, { 0, 6403, 509 }, { 0, 6423, 510 }, { 0, 6404, 511 }, { 0, 6405, 513 },
+    { 14609, 6446, 514 }, { 0, 6407, 516 }, { 14612, 6408, -1 }, { 0, 6409, 528 }, { 0, 6410, 529 }, { 0, 6411, 530 },
+    { 0, 6412, 532 }, { 0, 6413, 533 }, { 0, 6414, 534 }, { 0, 6415, 535 }, { 0, 6416, 536 }, { 0, 6420, 537 },
+    { 0, 6421, 543 }, { 0, 6424, 548 }, { 0, 6420, 538 }, { 0, 6422, 544 }, { 0, 6422, 545 }, { 0, 6427, 549 },
+    { 0, 6425, 550 }, { 0, 6428, 551 }, { 14609, 6420, 539 }, { 0, 6430, 552 }, { 0, 6420, 541 }, { 0, 6400, 507 },
+    { 0, 6422, 546 }, { 0, 6433, 557 }, { 0, 6434, 560 }, { 14614, 6435, 561 }, { 0, 6436, 563 }, { 0, 6433, 558 },
+    { 0, 6438, 564 }, { 0, 6442, 565 }, { 0, 6444, 566 }, { 0, 6447, 567 }, { 0, 6452, 568 }, { 0, 6453, 569 },
+    { 0, 6459, 570 }, { 0, 6420, 542 }, { 0, 6430, 553 }, { 0, 6460, 571 }, { 0, 6461, 572 }, { 0, 6463, 573 },
+    { 0, 6464, 574 }, { 0, 6465, 575 }, { 0, 6470, 576 }, { 0, 6482, 579 }, { 0, 6483, 581 }, { 0, 6482, 580 },
+    { 0, 6485, 582 }, { 0, 6448, 584 }, { 0, 6450, 585 }, { 0, 6469, 586 }, { 0, 6470, 577 }, { 0, 6473, 589 },
+    { 0, 6472, 587 }, { 0, 6430, 554 }, { 0, 6474, 590 }, { 0, 6430, 555 }, { 0, 6477, 591 }, { 0, 6481, 593 },
+    { 0, 6477, 592 }, { 0, 6493, 597 }, { 0, 6422, 547 }, { 0, 6433, 559 }, { 0, 6430, 556 }, { 0, 6492, 595 },
+    { 0, 6494, 598 }, { 0, 6495, 599 }, { 0, 6496, 600 }, { 0, 6497, 601 }, { 0, 6498, 602 }, { 0, 6485, 583 },
+    { 0, 6472, 588 }, { 0, 6499, 603 }, { 0, 6504, 605 }, { 0, 6488, 606 }, { 0, 6500, 609 }, { 0, 6505, 610 },
+    { 0, 6506, 611 }, { 0, 6527, 612 }, { 0, 6535, 613 }, { 0, 6544, 614 }, { 0, 6545, 615 }, { 0, 6546, 616 },
+    { 0, 6547, 617 }, { 0, 6508, 618 }, { 0, 6515, 619 }, { 0, 6521, 620 }, { 0, 6537, 621 }, { 0, 6470, 578 },
+    { 0, 6541, 622 }, { 0, 6548, 623 }, { 0, 6552, 624 }, { 0, 6492, 596 }, { 0, 6554, 625 }, { 0, 6564, 626 },
+    { 0, 6538, 628 }, { 0, 6540, 629 }, { 0, 6542, 630 }, { 0, 6558, 631 }, { 0, 6499, 604 }, { 0, 6558, 632 },
+    { 0, 6562, 633 }, { 0, 6563, 634 }, { 0, 6566, 636 }, { 0, 6568, 638 }, { 0, 6566, 637 }, { 0, 6569, 639 },
+    { 0, 6570, 640 }, { 14613, 6417, -1 }, { 0, 6481, 594 }, { 0, 6488, 607 }, { 0, 6488, 608 }, { 0, 6418, 643 },
+    { 0, 6564, 627 }, { 0, 6429, 644 }, { 14611, 6441, -1 }, { 0, 6426, 646 }, { 0, 6431, 648 }, { 0, 6432, 649 },
+    { 14615, 6437, -1 }, { 0, 6439, 653 }, { 14618, 6440, -1 }, { 0, 6443, 655 }, { 0, 6445, 659 }, { 0, 6570, 641 },
+    { 0, 6563, 635 }, { 0, 6449, 666 }, { 14617, 6451, -1 }, { 14616, 6454, 668 }, { 0, 6455, 676 }, { 0, 6456, 677 },
+    { 14621, 6457, -1 }, { 0, 6432, 650 }, { 14621, 6458, -1 }, { 14622, 6462, -1 }, { 0, 6466, 682 }, { 0, 6467, 683 },
+    { 0, 6468, 684 }, { 0, 6471, 685 }, { 0, 6475, 686 }, { 0, 6479, 687 }, { 0, 6484, 688 }, { 14623, 6516, -1 },
+    { 0, 6490, 690 }, { 0, 6502, 691 }, { 0, 6509, 692 }, { 0, 6526, 693 }, { 0, 6486, 694 }, { 14625, 6512, -1 },
+    { 0, 6476, 696 }, { 0, 6478, 697 }, { 0, 6480, 698 }, { 14623, 6487, -1 }, { 14624, 6489, 702 }, { 0, 6491, 704 },
+    { 0, 6501, 705 }, { 0, 6503, 706 }, { 14627, 6510, -1 }, { 0, 6517, 708 }, { 0, 6571, 709 }, { 0, 6507, 718 },
+    { 0, 6511, 719 }, { 14627, 6513, -1 }, { 14629, 6514, -1 }, { 0, 6518, 722 }, { 0, 6519, 723 }, { 0, 6520, 724 },
+    { 14630, 6522, -1 }, { 0, 6523, 730 }, { 0, 6524, 731 }, { 0, 6525, 732 }, { 0, 6530, 733 }, { 0, 6528, 734 },
+    { 14629, 6529, -1 }, { 0, 6531, 736 }, { 0, 6536, 737 }, { 14629, 6555, 738 }, { 0, 6572, 740 }, { 0, 6532, 741 },
+    { 0, 6533, 742 }, { 14631, 6534, -1 }, { 0, 6539, 747 }, { 0, 6543, 748 }, { 0, 6549, 749 }, { 0, 6551, 750 },
+    { 0, 6556, 751 }, { 0, 6557, 752 }, { 14635, 6559, -1 }, { 14636, 6578, -1 }, { 14634, 6587, -1 }, { 0, 6550, 756 },
+    { 0, 6565, 757 }, { 0, 6567, 759 }, { 14639, 6553, 760 }, { 14641, 6584, -1 }, { 14637, 6586, -1 }, { 0, 6596, 764 },
+    { 0, 6574, 765 }, { 0, 6579, 766 }, { 0, 6580, 767 }, { 0, 6589, 768 }, { 14642, 6591, -1 }, { 14643, 6610, -1 },
+    { 0, 6560, 771 }, { 14644, 6588, -1 }, { 14634, 6565, -1 }, { 0, 6561, 773 }, { 14645, 6573, -1 }, { 14646, 6575, -1 },
+    { 14647, 6576, 779 }, { 0, 6577, 785 }, { 0, 6581, 786 }, { 0, 6582, 789 }, { 0, 6583, 790 }, { 0, 6585, 792 },
+    { 0, 6590, 795 }, { 0, 6601, 796 }, { 0, 6592, 797 }, { 0, 6593, 798 }, { 14650, 6594, -1 }, { 14652, 6595, -1 },
+    { 0, 6597, 804 }, { 14652, 6598, -1 }, { 14653, 6599, 809 }, { 14654, 6600, -1 }, { 0, 6602, 813 }, { 0, 6603, 814 },
+    { 14651, 6604, -1 }, { 0, 6605, 816 }, { 14652, 6606, -1 }, { 0, 6607, 820 }, { 0, 6607, 821 }, { 0, 6608, 822 },
+    { 0, 6613, 823 }, { 14657, 6614, 824 }, { 0, 6615, 827 }, { 0, 6615, 828 }, { 0, 6616, 829 }, { 0, 6618, 831 },
+    { 0, 6622, 834 }, { 0, 6623, 836 }, { 14654, 6637, -1 }, { 0, 6638, 838 }, { 0, 6640, 839 }, { 14657, 6644, 840 },
+    { 14660, 6663, -1 }, { 0, 6671, 844 }, { 0, 6616, 830 }, { 0, 6617, 845 }, { 0, 6621, 846 }, { 0, 6624, 847 },
+    { 0, 6618, 832 }, { 0, 6632, 848 }, { 0, 6614, 826 }, { 0, 6654, 850 }, { 14656, 6644, -1 }, { 0, 6656, 851 },
+    { 0, 6666, 852 }, { 0, 6611, 853 }, { 0, 6634, 854 }, { 0, 6636, 855 }, { 0, 6618, 833 }, { 0, 6639, 856 },
+    { 0, 6647, 857 }, { 0, 6649, 858 }, { 0, 6665, 859 }, { 0, 6620, 860 }, { 0, 6635, 861 }, { 0, 6643, 862 },
+    { 0, 6633, 865 }, { 0, 6645, 863 }, { 14661, 6646, 866 }, { 0, 6651, 868 }, { 0, 6661, 869 }, { 0, 6609, 871 },
+    { 0, 6612, 873 }, { 0, 6619, 874 }, { 0, 6625, 877 }, { 0, 6626, 878 }, { 0, 6627, 880 }, { 0, 6652, 881 },
+    { 0, 6653, 883 }, { 0, 6655, 884 }, { 0, 6660, 887 }, { 0, 6628, 888 }, { 0, 6686, 889 }, { 0, 6629, 890 },
+    { 0, 6622, 835 }, { 0, 6630, 891 }, { 0, 6632, 849 }, { 0, 6645, 864 }, { 14663, 6668, -1 }, { 0, 6672, 893 },
+    { 0, 6674, 894 }, { 14663, 6675, 895 }, { 0, 6676, 898 }, { 14666, 6678, -1 }, { 14668, 6680, -1 }, { 14669, 6697, -1 },
+    { 0, 6708, 904 }, { 0, 6718, 906 }, { 14670, 6729, -1 }, { 0, 6730, 908 }, { 0, 6732, 909 }, { 0, 6677, 910 },
+    { 0, 6679, 912 }, { 14672, 6688, -1 }, { 0, 6689, 915 }, { 0, 6690, 916 }, { 0, 6667, 918 }, { 0, 6691, 919 },
+    { 0, 6655, 885 }, { 0, 6692, 920 }, { 0, 6698, 921 }, { 0, 6652, 882 }, { 0, 6723, 922 }, { 0, 6680, 902 },
+    { 0, 6724, 923 }, { 0, 6657, 924 }, { 0, 6658, 925 }, { 14663, 6678, -1 }, { 14673, 6662, -1 }, { 0, 6631, 928 },
+    { 0, 6641, 929 }, { 0, 6690, 917 }, { 0, 6655, 886 }, { 14674, 6642, -1 }, { 0, 6648, 934 }, { 0, 6650, 936 },
+    { 14673, 6673, -1 }, { 0, 6681, 939 }, { 14677, 6683, -1 }, { 14678, 6702, -1 }, { 14679, 6659, -1 }, { 14680, 6664, -1 },
+    { 0, 6687, 947 }, { 14669, 6677, -1 }, { 0, 6694, 948 }, { 0, 6703, 950 }, { 0, 6669, 951 }, { 0, 6670, 952 },
+    { 0, 6684, 954 }, { 0, 6701, 955 }, { 0, 6719, 956 }, { 0, 6708, 905 }, { 14681, 6731, -1 }, { 0, 6705, 960 },
+    { 0, 6738, 958 }, { 0, 6706, 961 }, { 0, 6713, 962 }, { 0, 6733, 963 }, { 0, 6734, 964 }, { 0, 6737, 965 },
+    { 0, 6744, 966 }, { 0, 6750, 967 }, { 0, 6709, 968 }, { 0, 6710, 969 }, { 0, 6711, 970 }, { 0, 6721, 971 },
+    { 14681, 6726, 972 }, { 0, 6682, 974 }, { 0, 6695, 975 }, { 14683, 6696, -1 }, { 0, 6694, 949 }, { 0, 6738, 959 },
+    { 0, 6685, 978 }, { 0, 6693, 980 }, { 0, 6699, 981 }, { 14680, 6700, -1 }, { 14681, 6704, -1 }, { 14682, 6727, -1 },
+    { 14689, 6736, -1 }, { 14685, 6707, 988 }, { 0, 6712, 991 }, { 14693, 6716, -1 }, { 14689, 6714, -1 }, { 0, 6715, 997 },
+    { 0, 6720, 998 }, { 14693, 6772, -1 }, { 14695, 6735, -1 }, { 0, 6739, 1001 }, { 14694, 6717, -1 }, { 0, 6722, 1003 },
+    { 14694, 6725, -1 }, { 14697, 6728, -1 }, { 14699, 6740, -1 }, { 0, 6741, 1012 }, { 0, 6673, 938 }, { 14690, 6714, -1 },
+    { 0, 6742, 1013 }, { 0, 6743, 1015 }, { 0, 6745, 1016 }, { 14700, 6746, -1 }, { 0, 6747, 1019 }, { 0, 6749, 1021 },
+    { 0, 6751, 1022 }, { 0, 6788, 1023 }, { 0, 6748, 1024 }, { 0, 6752, 1026 }, { 0, 6753, 1027 }, { 14697, 6789, -1 },
+    { 0, 6815, 1029 }, { 0, 6722, 1004 }, { 0, 6754, 1030 }, { 0, 6804, 1031 }, { 0, 6755, 1034 }, { 14703, 6763, 1035 },
+    { 14700, 6756, -1 }, { 0, 6757, 1038 }, { 0, 6759, 1039 }, { 0, 6760, 1040 }, { 14701, 6804, 1032 }, { 0, 6765, 1041 },
+    { 0, 6768, 1044 }, { 0, 6774, 1045 }, { 0, 6778, 1046 }, { 0, 6786, 1047 }, { 0, 6795, 1048 }, { 0, 6821, 1049 },
+    { 14704, 6765, 1042 }, { 0, 6758, 1050 }, { 0, 6797, 1051 }, { 0, 6801, 1052 }, { 0, 6803, 1053 }, { 0, 6769, 1054 },
+    { 0, 6769, 1055 }, { 0, 6787, 1056 }, { 0, 6800, 1057 }, { 0, 6805, 1058 }, { 0, 6811, 1059 }, { 0, 6818, 1060 },
+    { 0, 6770, 1061 }, { 0, 6790, 1062 }, { 0, 6714, 995 }, { 0, 6809, 1064 }, { 0, 6762, 1065 }, { 0, 6780, 1066 },
+    { 14702, 6790, -1 }, { 0, 6791, 1067 }, { 0, 6792, 1068 }, { 14703, 6761, -1 }, { 14704, 6784, -1 }, { 0, 6764, 1072 },
+    { 0, 6766, 1077 }, { 0, 6767, 1078 }, { 0, 6771, 1079 }, { 0, 6773, 1080 }, { 0, 6775, 1081 }, { 0, 6776, 1084 },
+    { 0, 6777, 1086 }, { 0, 6779, 1088 }, { 14709, 6783, -1 }, { 0, 6793, 1090 }, { 0, 6781, 1091 }, { 14711, 6782, -1 },
+    { 14711, 6785, -1 }, { 0, 6794, 1096 }, { 14710, 6796, -1 }, { 0, 6798, 1101 }, { 0, 6799, 1106 }, { 0, 6802, 1108 },
+    { 0, 6806, 1109 }, { 0, 6807, 1110 }, { 0, 6842, 1111 }, { 0, 6858, 1112 }, { 0, 6808, 1113 }, { 0, 6810, 1114 },
+    { 0, 6813, 1115 }, { 14712, 6819, -1 }, { 14711, 6812, -1 }, { 0, 6814, 1119 }, { 0, 6864, 1120 }, { 0, 6816, 1121 },
+    { 0, 6817, 1122 }, { 0, 6820, 1123 }, { 14714, 6822, -1 }, { 14714, 6823, -1 }, { 14715, 6845, -1 }, { 0, 6846, 1128 },
+    { 0, 6824, 1130 }, { 14718, 6825, -1 }, { 0, 6826, 1136 }, { 0, 6831, 1137 }, { 14721, 6827, 1138 }, { 0, 6835, 1141 },
+    { 14722, 6837, -1 }, { 14723, 6856, -1 }, { 0, 6828, 1144 }, { 0, 6829, 1145 }, { 0, 6834, 1146 }, { 14724, 6836, 1147 },
+    { 14725, 6838, -1 }, { 14724, 6848, -1 }, { 14728, 6857, -1 }, { 0, 6830, 1154 }, { 14730, 6832, -1 }, { 0, 6839, 1156 },
+    { 0, 6841, 1157 }, { 0, 6833, 1158 }, { 14730, 6852, -1 }, { 14731, 6840, 1160 }, { 14728, 6843, -1 }, { 0, 6844, 1165 },
+    { 0, 6847, 1167 }, { 14734, 6850, -1 }, { 0, 6853, 1169 }, { 0, 6894, 1170 }, { 14732, 6849, -1 }, { 14735, 6851, -1 },
+    { 14732, 6854, -1 }, { 14735, 6855, -1 }, { 14734, 6874, -1 }, { 14739, 6877, -1 }, { 0, 6878, 1180 }, { 0, 6859, 1181 },
+    { 14740, 6860, -1 }, { 14741, 6861, -1 }, { 0, 6862, 1184 }, { 14741, 6863, -1 }, { 0, 6865, 1186 }, { 14743, 6866, -1 },
+    { 14746, 6867, -1 }, { 0, 6868, 1191 }, { 0, 6870, 1193 }, { 0, 6879, 1194 }, { 0, 6899, 1195 }, { 0, 6907, 1196 },
+    { 0, 6869, 1197 }, { 0, 6895, 1198 }, { 0, 6896, 1199 }, { 0, 6904, 1200 }, { 0, 6871, 1201 }, { 0, 6875, 1202 },
+    { 0, 6892, 1203 }, { 0, 6880, 1204 }, { 0, 6893, 1205 }, { 14743, 6868, -1 }, { 0, 6903, 1206 }, { 0, 6905, 1207 },
+    { 0, 6927, 1208 }, { 0, 6873, 1209 }, { 0, 6900, 1210 }, { 0, 6901, 1212 }, { 0, 6872, 1214 }, { 14747, 6876, -1 },
+    { 14744, 6881, -1 }, { 0, 6882, 1218 }, { 14747, 6883, -1 }, { 0, 6884, 1220 }, { 14748, 6885, -1 }, { 0, 6886, 1223 },
+    { 0, 6889, 1224 }, { 0, 6908, 1225 }, { 0, 6900, 1211 }, { 0, 6909, 1226 }, { 0, 6914, 1227 }, { 0, 6918, 1228 },
+    { 0, 6919, 1229 }, { 0, 6931, 1231 }, { 14748, 6932, -1 }, { 0, 6952, 1234 }, { 0, 6960, 1236 }, { 14751, 6967, -1 },
+    { 0, 6902, 1238 }, { 14751, 6952, -1 }, { 0, 6921, 1239 }, { 0, 6923, 1240 }, { 0, 6938, 1241 }, { 0, 6941, 1242 },
+    { 14753, 6906, 1243 }, { 0, 6922, 1245 }, { 14757, 6942, -1 }, { 0, 6948, 1247 }, { 0, 6961, 1248 }, { 0, 6963, 1249 },
+    { 0, 6890, 1250 }, { 0, 6932, 1233 }, { 0, 6916, 1251 }, { 0, 6935, 1252 }, { 0, 6943, 1254 }, { 0, 6891, 1255 },
+    { 14755, 6910, -1 }, { 0, 6924, 1257 }, { 0, 6926, 1258 }, { 0, 6887, 1262 }, { 0, 6935, 1253 }, { 0, 6934, 1263 },
+    { 14754, 6944, -1 }, { 0, 6946, 1265 }, { 0, 6968, 1266 }, { 0, 6975, 1267 }, { 0, 6977, 1268 }, { 0, 6978, 1269 },
+    { 14760, 6949, -1 }, { 14748, 6919, -1 }, { 0, 6951, 1271 }, { 0, 6956, 1272 }, { 0, 6979, 1273 }, { 14761, 6913, -1 },
+    { 0, 6915, 1275 }, { 0, 6962, 1276 }, { 0, 6888, 1277 }, { 14761, 6897, -1 }, { 0, 6928, 1285 }, { 0, 6929, 1286 },
+    { 0, 6953, 1287 }, { 0, 6955, 1288 }, { 0, 6964, 1289 }, { 0, 6898, 1290 }, { 0, 6911, 1291 }, { 14759, 6912, -1 },
+    { 14760, 6917, -1 }, { 0, 6920, 1294 }, { 0, 6925, 1299 }, { 0, 6930, 1302 }, { 14761, 6933, -1 }, { 0, 6936, 1305 },
+    { 0, 6937, 1306 }, { 14766, 6939, -1 }, { 0, 6940, 1310 }, { 14767, 6945, 1312 }, { 14766, 6947, -1 }, { 0, 6950, 1315 },
+    { 0, 6957, 1316 }, { 14769, 6966, -1 }, { 14771, 6987, 1318 }, { 14772, 7009, -1 }, { 0, 6954, 1321 }, { 14773, 6958, -1 },
+    { 0, 6959, 1327 }, { 14776, 6973, -1 }, { 0, 6980, 1329 }, { 0, 6981, 1330 }, { 14774, 6983, -1 }, { 0, 6998, 1332 },
+    { 0, 7004, 1333 }, { 0, 7006, 1334 }, { 0, 7017, 1335 }, { 14774, 7023, -1 }, { 0, 7024, 1337 }, { 0, 7025, 1338 },
+    { 0, 7027, 1339 }, { 0, 7028, 1340 }, { 14777, 6970, -1 }, { 0, 6989, 1343 }, { 0, 6992, 1344 }, { 0, 7010, 1345 },
+    { 0, 6958, 1325 }, { 14779, 7028, -1 }, { 0, 7020, 1346 }, { 14781, 6984, 1347 }, { 0, 6999, 1350 }, { 14783, 7005, -1 },
+    { 0, 7012, 1352 }, { 0, 7018, 1353 }, { 0, 7019, 1354 }, { 0, 7022, 1355 }, { 0, 7032, 1356 }, { 0, 7033, 1357 },
+    { 14781, 7035, -1 }, { 0, 6995, 1359 }, { 0, 6996, 1360 }, { 0, 6997, 1361 }, { 0, 7008, 1362 }, { 0, 7021, 1363 },
+    { 14785, 7049, -1 }, { 0, 7055, 1365 }, { 0, 7031, 1366 }, { 0, 7034, 1367 }, { 0, 7038, 1368 }, { 0, 7040, 1369 },
+    { 0, 7041, 1370 }, { 0, 7042, 1371 }, { 0, 7050, 1372 }, { 0, 7056, 1373 }, { 0, 7057, 1374 }, { 14772, 6958, -1 },
+    { 0, 6965, 1375 }, { 0, 6969, 1376 }, { 0, 6971, 1377 }, { 0, 6972, 1379 }, { 0, 6974, 1380 }, { 0, 6976, 1383 },
+    { 14782, 6982, 1384 }, { 14787, 6985, -1 }, { 14789, 6986, -1 }, { 0, 6990, 1388 }, { 0, 7001, 1389 }, { 14790, 6988, -1 },
+    { 14786, 6994, -1 }, { 0, 7000, 1392 }, { 14791, 7003, -1 }, { 14793, 6991, -1 }, { 0, 7007, 1395 }, { 14790, 6993, 1396 },
+    { 0, 7002, 1398 }, { 0, 7011, 1399 }, { 0, 7029, 1400 }, { 14792, 7036, -1 }, { 0, 7068, 1402 }, { 14795, 7084, 1403 },
+    { 14792, 7013, -1 }, { 0, 7014, 1406 }, { 14795, 7026, -1 }, { 14799, 7044, 1408 }, { 14800, 7015, 1415 }, { 14801, 7016, -1 },
+    { 0, 7062, 1418 }, { 14803, 7030, -1 }, { 0, 7037, 1420 }, { 0, 7039, 1421 }, { 14804, 7043, 1422 }, { 14805, 7074, -1 },
+    { 0, 7045, 1425 }, { 0, 7060, 1426 }, { 0, 7047, 1427 }, { 14806, 7058, -1 }, { 14809, 7064, 1431 }, { 0, 7046, 1435 },
+    { 14808, 7048, -1 }, { 14812, 7052, -1 }, { 0, 7059, 1439 }, { 0, 7051, 1441 }, { 0, 7053, 1444 }, { 0, 7054, 1445 },
+    { 14808, 7058, -1 }, { 0, 7061, 1446 }, { 0, 7063, 1447 }, { 14813, 7065, -1 }, { 14810, 7066, -1 }, { 14814, 7067, -1 },
+    { 0, 7089, 1452 }, { 14813, 7069, -1 }, { 0, 7070, 1454 }, { 0, 7071, 1455 }, { 0, 7072, 1456 }, { 14818, 7079, 1457 },
+    { 0, 7122, 1459 }, { 0, 7073, 1460 }, { 14819, 7075, -1 }, { 0, 7130, 1462 }, { 0, 7076, 1463 }, { 0, 7078, 1464 },
+    { 0, 7080, 1465 }, { 0, 7085, 1467 }, { 0, 7087, 1468 }, { 0, 7101, 1470 }, { 0, 7102, 1471 }, { 0, 7110, 1472 },
+    { 0, 7111, 1473 }, { 0, 7126, 1475 }, { 0, 7082, 1476 }, { 0, 7086, 1477 }, { 0, 7090, 1478 }, { 0, 7092, 1479 },
+    { 0, 7099, 1480 }, { 0, 7103, 1481 }, { 0, 7080, 1466 }, { 0, 7104, 1482 }, { 0, 7129, 1483 }, { 0, 7077, 1484 },
+    { 0, 7098, 1485 }, { 14820, 7091, -1 }, { 14821, 7095, -1 }, { 14821, 7096, -1 }, { 14823, 7097, -1 }, { 0, 7138, 1490 },
+    { 0, 7111, 1474 }, { 0, 7139, 1492 }, { 14821, 7143, -1 }, { 0, 7088, 1494 }, { 0, 7093, 1495 }, { 0, 7127, 1496 },
+    { 14825, 7105, -1 }, { 0, 7107, 1498 }, { 0, 7108, 1499 }, { 14827, 7081, -1 }, { 0, 7083, 1502 }, { 0, 7112, 1503 },
+    { 14827, 7114, -1 }, { 0, 7135, 1507 }, { 0, 7087, 1469 }, { 14829, 7094, -1 }, { 0, 7100, 1509 }, { 14831, 7106, -1 },
+    { 14831, 7109, -1 }, { 0, 7138, 1491 }, { 0, 7113, 1513 }, { 14832, 7128, 1514 }, { 0, 7115, 1517 }, { 0, 7116, 1518 },
+    { 0, 7117, 1521 }, { 0, 7118, 1523 }, { 0, 7119, 1524 }, { 0, 7120, 1526 }, { 14833, 7121, -1 }, { 14835, 7123, -1 },
+    { 0, 7124, 1533 }, { 0, 7125, 1534 }, { 0, 7167, 1535 }, { 14833, 7131, -1 }, { 14837, 7132, -1 }, { 0, 7133, 1538 },
+    { 0, 7134, 1539 }, { 0, 7136, 1546 }, { 14838, 7137, 1551 }, { 14839, 7140, 1553 }, { 0, 7141, 1555 }, { 14839, 7142, -1 },
+    { 0, 7171, 1558 }, { 14826, 7114, -1 }, { 0, 7144, 1559 }, { 14837, 7145, -1 }, { 14839, 7146, -1 }, { 0, 7147, 1565 },
+    { 0, 7148, 1566 }, { 14844, 7149, -1 }, { 0, 7150, 1568 }, { 0, 7151, 1569 }, { 0, 7155, 1570 }, { 0, 7156, 1571 },
+    { 14844, 7162, -1 }, { 0, 7166, 1573 }, { 0, 7196, 1574 }, { 0, 7200, 1575 }, { 0, 7158, 1576 }, { 0, 7197, 1577 },
+    { 0, 7198, 1578 }, { 0, 7201, 1579 }, { 0, 7202, 1580 }, { 0, 7204, 1581 }, { 0, 7206, 1582 }, { 0, 7210, 1584 },
+    { 0, 7170, 1585 }, { 0, 7178, 1586 }, { 0, 7184, 1587 }, { 0, 7207, 1588 }, { 0, 7208, 1589 }, { 0, 7152, 1590 },
+    { 14846, 7165, 1591 }, { 0, 7177, 1593 }, { 0, 7154, 1594 }, { 0, 7168, 1595 }, { 14844, 7175, -1 }, { 0, 7153, 1597 },
+    { 0, 7157, 1598 }, { 0, 7159, 1599 }, { 0, 7160, 1600 }, { 0, 7182, 1601 }, { 0, 7161, 1602 }, { 0, 7163, 1604 },
+    { 0, 7164, 1611 }, { 0, 7169, 1612 }, { 0, 7179, 1613 }, { 0, 7180, 1614 }, { 0, 7172, 1615 }, { 0, 7212, 1616 },
+    { 0, 7173, 1621 }, { 0, 7174, 1622 }, { 0, 7176, 1623 }, { 0, 7181, 1624 }, { 0, 7183, 1629 }, { 0, 7185, 1630 },
+    { 14845, 7186, -1 }, { 14849, 7187, 1632 }, { 14850, 7188, -1 }, { 0, 7189, 1639 }, { 0, 7190, 1640 }, { 14849, 7191, -1 },
+    { 0, 7192, 1642 }, { 14853, 7193, -1 }, { 0, 7194, 1646 }, { 0, 7206, 1583 }, { 14850, 7195, -1 }, { 0, 7199, 1650 },
+    { 0, 7203, 1651 }, { 0, 7205, 1658 }, { 0, 7209, 1662 }, { 0, 7211, 1663 }, { 14854, 7213, -1 }, { 0, 7214, 1666 },
+    { 0, 7215, 1667 }, { 0, 7216, 1669 }, { 0, 7217, 1670 }, { 0, 7222, 1671 }, { 14856, 7218, -1 }, { 14857, 7219, -1 },
+    { 0, 7226, 1675 }, { 14858, 7228, -1 }, { 14859, 7247, -1 }, { 0, 7220, 1678 }, { 14856, 7240, -1 }, { 14862, 7221, -1 },
+    { 14859, 7223, -1 }, { 0, 7203, 1652 }, { 14861, 7225, -1 }, { 14865, 7234, 1684 }, { 0, 7239, 1686 }, { 0, 7248, 1687 },
+    { 14867, 7256, -1 }, { 0, 7279, 1694 }, { 14869, 7281, -1 }, { 14872, 7229, -1 }, { 0, 7230, 1703 }, { 0, 7263, 1704 },
+    { 0, 7224, 1705 }, { 14873, 7268, -1 }, { 0, 7269, 1707 }, { 0, 7273, 1708 }, { 14875, 7227, 1709 }, { 0, 7238, 1711 },
+    { 0, 7272, 1712 }, { 0, 7280, 1713 }, { 0, 7286, 1714 }, { 14878, 7235, -1 }, { 0, 7236, 1716 }, { 0, 7242, 1717 },
+    { 0, 7245, 1718 }, { 0, 7270, 1719 }, { 0, 7231, 1721 }, { 14881, 7232, -1 }, { 0, 7233, 1724 }, { 0, 7237, 1725 },
+    { 14878, 7241, 1726 }, { 14883, 7246, -1 }, { 0, 7243, 1730 }, { 0, 7244, 1731 }, { 0, 7249, 1735 }, { 14882, 7250, -1 },
+    { 0, 7252, 1738 }, { 14887, 7251, 1739 }, { 14882, 7253, -1 }, { 0, 7255, 1748 }, { 0, 7254, 1750 }, { 0, 7257, 1751 },
+    { 0, 7258, 1752 }, { 14886, 7259, -1 }, { 0, 7260, 1754 }, { 14891, 7261, -1 }, { 0, 7262, 1757 }, { 14892, 7264, -1 },
+    { 14889, 7265, -1 }, { 14894, 7266, -1 }, { 14891, 7267, -1 }, { 14896, 7303, -1 }, { 0, 7271, 1766 }, { 14893, 7274, 1768 },
+    { 14894, 7297, -1 }, { 0, 7275, 1771 }, { 0, 7276, 1772 }, { 0, 7277, 1775 }, { 14897, 7278, -1 }, { 0, 7294, 1778 },
+    { 0, 7282, 1784 }, { 14897, 7283, 1785 }, { 0, 7284, 1787 }, { 0, 7285, 1788 }, { 0, 7287, 1789 }, { 0, 7288, 1792 },
+    { 0, 7289, 1795 }, { 14901, 7290, -1 }, { 14902, 7291, -1 }, { 14899, 7292, -1 }, { 0, 7293, 1805 }, { 0, 7303, 1763 },
+    { 14903, 7295, -1 }, { 0, 7296, 1810 }, { 0, 7298, 1811 }, { 0, 7348, 1812 }, { 0, 7299, 1815 }, { 14904, 7300, -1 },
+    { 0, 7301, 1817 }, { 14903, 7302, 1818 }, { 0, 7304, 1821 }, { 0, 7305, 1822 }, { 0, 7306, 1823 }, { 0, 7307, 1825 },
+    { 0, 7308, 1826 }, { 14908, 7309, -1 }, { 0, 7310, 1830 }, { 0, 7311, 1832 }, { 0, 7312, 1833 }, { 0, 7313, 1836 },
+    { 0, 7314, 1838 }, { 0, 7320, 1839 }, { 14905, 7315, -1 }, { 0, 7316, 1841 }, { 14909, 7317, -1 }, { 14910, 7318, -1 },
+    { 0, 7323, 1850 }, { 14912, 7325, -1 }, { 0, 7326, 1854 }, { 0, 7345, 1855 }, { 0, 7349, 1856 }, { 14910, 7355, -1 },
+    { 0, 7356, 1859 }, { 14914, 7357, -1 }, { 14912, 7367, -1 }, { 0, 7370, 1862 }, { 0, 7321, 1863 }, { 0, 7322, 1864 },
+    { 0, 7349, 1857 }, { 0, 7328, 1865 }, { 0, 7325, 1852 }, { 0, 7329, 1866 }, { 0, 7318, 1847 }, { 0, 7331, 1867 },
+    { 0, 7332, 1868 }, { 0, 7344, 1869 }, { 0, 7347, 1870 }, { 14914, 7352, -1 }, { 0, 7353, 1872 }, { 0, 7316, 1842 },
+    { 0, 7350, 1874 }, { 0, 7351, 1875 }, { 0, 7362, 1876 }, { 0, 7364, 1877 }, { 0, 7381, 1878 }, { 0, 7334, 1879 },
+    { 0, 7336, 1880 }, { 0, 7325, 1853 }, { 0, 7353, 1873 }, { 0, 7371, 1881 }, { 0, 7318, 1848 }, { 0, 7372, 1882 },
+    { 0, 7378, 1887 }, { 14914, 7387, -1 }, { 0, 7388, 1889 }, { 0, 7342, 1890 }, { 0, 7360, 1891 }, { 0, 7372, 1883 },
+    { 0, 7366, 1892 }, { 0, 7373, 1893 }, { 0, 7372, 1884 }, { 0, 7373, 1894 }, { 14920, 7319, -1 }, { 0, 7318, 1849 },
+    { 14920, 7324, 1896 }, { 0, 7327, 1898 }, { 0, 7330, 1899 }, { 14922, 7382, -1 }, { 0, 7372, 1885 }, { 0, 7333, 1901 },
+    { 0, 7338, 1902 }, { 0, 7368, 1903 }, { 14920, 7369, -1 }, { 14924, 7377, 1905 }, { 14924, 7379, -1 }, { 14925, 7398, -1 },
+    { 14922, 7343, -1 }, { 0, 7374, 1911 }, { 0, 7335, 1912 }, { 0, 7337, 1914 }, { 14927, 7341, 1915 }, { 14929, 7383, 1917 },
+    { 14931, 7384, 1920 }, { 14930, 7386, -1 }, { 14928, 7399, -1 }, { 0, 7405, 1927 }, { 0, 7426, 1928 }, { 14933, 7339, -1 },
+    { 14935, 7340, -1 }, { 14936, 7354, -1 }, { 14933, 7358, -1 }, { 14938, 7359, -1 }, { 14939, 7363, -1 }, { 14936, 7380, -1 },
+    { 14941, 7365, -1 }, { 0, 7385, 1939 }, { 14942, 7389, -1 }, { 0, 7400, 1941 }, { 14943, 7417, -1 }, { 14944, 7392, -1 },
+    { 14945, 7401, 1944 }, { 14946, 7403, -1 }, { 14949, 7415, -1 }, { 14949, 7346, -1 }, { 0, 7361, 1954 }, { 0, 7390, 1955 },
+    { 0, 7393, 1956 }, { 0, 7375, 1957 }, { 14950, 7376, -1 }, { 0, 7372, 1886 }, { 0, 7391, 1960 }, { 14949, 7394, 1962 },
+    { 0, 7395, 1964 }, { 14952, 7409, -1 }, { 14953, 7408, -1 }, { 0, 7410, 1968 }, { 0, 7411, 1970 }, { 0, 7413, 1971 },
+    { 0, 7412, 1972 }, { 0, 7414, 1973 }, { 0, 7419, 1974 }, { 0, 7428, 1975 }, { 14954, 7440, -1 }, { 0, 7441, 1980 },
+    { 0, 7443, 1982 }, { 0, 7464, 1985 }, { 0, 7450, 1983 }, { 0, 7466, 1987 }, { 0, 7406, 1988 }, { 0, 7406, 1989 },
+    { 0, 7407, 1990 }, { 14958, 7427, -1 }, { 0, 7445, 1992 }, { 14959, 7451, -1 }, { 0, 7418, 1994 }, { 0, 7440, 1977 },
+    { 0, 7421, 1995 }, { 0, 7420, 1996 }, { 14956, 7423, -1 }, { 0, 7424, 2000 }, { 0, 7482, 2006 }, { 0, 7473, 2004 },
+    { 0, 7483, 2007 }, { 0, 7467, 2001 }, { 0, 7396, 2008 }, { 0, 7402, 2010 }, { 0, 7404, 2011 }, { 0, 7397, 2013 },
+    { 0, 7416, 2016 }, { 0, 7422, 2017 }, { 0, 7425, 2018 }, { 14954, 7464, -1 }, { 14956, 7440, 1978 }, { 0, 7429, 2020 },
+    { 0, 7467, 2002 }, { 0, 7430, 2021 }, { 0, 7431, 2023 }, { 0, 7432, 2025 }, { 0, 7441, 1981 }, { 0, 7450, 1984 },
+    { 0, 7433, 2026 }, { 0, 7434, 2027 }, { 0, 7436, 2028 }, { 0, 7435, 2029 }, { 0, 7408, 1967 }, { 0, 7467, 2003 },
+    { 0, 7473, 2005 }, { 0, 7410, 1969 }, { 0, 7461, 2030 }, { 0, 7481, 2031 }, { 14961, 7487, 2032 }, { 14960, 7423, 1998 },
+    { 0, 7437, 2034 }, { 0, 7438, 2035 }, { 14962, 7442, -1 }, { 0, 7458, 2037 }, { 14965, 7477, -1 }, { 14962, 7439, 2039 },
+    { 0, 7444, 2041 }, { 14966, 7446, -1 }, { 14968, 7447, -1 }, { 0, 7448, 2045 }, { 14968, 7449, -1 }, { 14970, 7452, 2052 },
+    { 0, 7453, 2055 }, { 0, 7454, 2056 }, { 14967, 7465, -1 }, { 0, 7469, 2058 }, { 0, 7474, 2059 }, { 0, 7488, 2060 },
+    { 0, 7490, 2061 }, { 0, 7455, 2063 }, { 0, 7497, 2064 }, { 14968, 7456, -1 }, { 0, 7468, 2066 }, { 0, 7475, 2067 },
+    { 14971, 7519, -1 }, { 0, 7457, 2069 }, { 0, 7489, 2070 }, { 0, 7511, 2071 }, { 0, 7459, 2073 }, { 0, 7460, 2082 },
+    { 0, 7462, 2087 }, { 14969, 7492, -1 }, { 0, 7463, 2091 }, { 0, 7470, 2093 }, { 0, 7471, 2094 }, { 0, 7472, 2095 },
+    { 0, 7476, 2097 }, { 14974, 7478, -1 }, { 0, 7480, 2099 }, { 14972, 7479, -1 }, { 14973, 7484, -1 }, { 0, 7485, 2102 },
+    { 0, 7486, 2104 }, { 0, 7491, 2106 }, { 0, 7493, 2107 }, { 14977, 7494, -1 }, { 14974, 7495, -1 }, { 14979, 7496, -1 },
+    { 14976, 7498, -1 }, { 14981, 7499, 2114 }, { 14983, 7513, -1 }, { 0, 7500, 2117 }, { 0, 7501, 2118 }, { 0, 7490, 2062 },
+    { 14983, 7502, 2120 }, { 14984, 7503, -1 }, { 0, 7505, 2123 }, { 0, 7504, 2125 }, { 14983, 7506, -1 }, { 14982, 7507, -1 },
+    { 0, 7508, 2130 }, { 0, 7509, 2131 }, { 14983, 7510, -1 }, { 0, 7512, 2135 }, { 0, 7514, 2136 }, { 0, 7517, 2137 },
+    { 0, 7520, 2138 }, { 0, 7521, 2139 }, { 0, 7515, 2140 }, { 0, 7516, 2141 }, { 0, 7518, 2143 }, { 14987, 7522, 2144 },
+    { 0, 7523, 2147 }, { 0, 7524, 2148 }, { 0, 7525, 2149 }, { 0, 7526, 2150 }, { 0, 7527, 2151 }, { 0, 7528, 2152 },
+    { 14990, 7529, -1 }, { 0, 7530, 2155 }, { 0, 7531, 2156 }, { 14990, 7532, -1 }, { 14991, 7533, -1 }, { 14989, 7534, 2160 },
+    { 14994, 7540, -1 }, { 0, 7535, 2165 }, { 14995, 7536, -1 }, { 14997, 7537, -1 }, { 0, 7538, 2173 }, { 0, 7539, 2176 },
+    { 0, 7541, 2178 }, { 14997, 7542, -1 }, { 14997, 7543, -1 }, { 0, 7544, 2181 }, { 0, 7545, 2183 }, { 15003, 7546, 2184 },
+    { 14999, 7561, -1 }, { 15000, 7547, -1 }, { 15001, 7548, -1 }, { 0, 7549, 2192 }, { 15006, 7550, -1 }, { 0, 7551, 2198 },
+    { 0, 7552, 2199 }, { 15008, 7553, -1 }, { 15009, 7564, -1 }, { 0, 7554, 2204 }, { 15007, 7577, 2205 }, { 0, 7555, 2207 },
+    { 0, 7556, 2208 }, { 0, 7557, 2210 }, { 15008, 7567, -1 }, { 0, 7600, 2213 }, { 0, 7615, 2214 }, { 0, 7558, 2215 },
+    { 0, 7559, 2216 }, { 0, 7560, 2217 }, { 0, 7562, 2218 }, { 0, 7563, 2219 }, { 0, 7570, 2220 }, { 0, 7565, 2221 },
+    { 0, 7568, 2222 }, { 0, 7569, 2223 }, { 0, 7566, 2224 }, { 0, 7571, 2228 }, { 0, 7572, 2229 }, { 15012, 7573, -1 },
+    { 0, 7574, 2232 }, { 15013, 7575, -1 }, { 0, 7576, 2236 }, { 0, 7578, 2237 }, { 0, 7579, 2238 }, { 15010, 7581, -1 },
+    { 0, 7582, 2240 }, { 0, 7583, 2241 }, { 15012, 7580, -1 }, { 15015, 7584, -1 }, { 15017, 7584, -1 }, { 15020, 7585, -1 },
+    { 0, 7586, 2255 }, { 0, 7587, 2257 }, { 0, 7588, 2258 }, { 0, 7589, 2259 }, { 0, 7590, 2266 }, { 0, 7591, 2272 },
+    { 15020, 7592, 2274 }, { 0, 7593, 2276 }, { 15021, 7594, -1 }, { 15022, 7595, -1 }, { 15023, 7596, 2279 }, { 0, 7639, 2281 },
+    { 0, 7597, 2282 }, { 15024, 7598, -1 }, { 15024, 7599, -1 }, { 0, 7601, 2287 }, { 15024, 7602, -1 }, { 15009, 7557, -1 },
+    { 15023, 7603, 2290 }, { 0, 7604, 2295 }, { 15027, 7605, -1 }, { 15029, 7606, -1 }, { 0, 7607, 2304 }, { 15031, 7608, -1 },
+    { 0, 7655, 2306 }, { 0, 7609, 2308 }, { 0, 7641, 2309 }, { 15027, 7610, -1 }, { 0, 7611, 2316 }, { 15032, 7611, -1 },
+    { 0, 7612, 2323 }, { 15034, 7611, -1 }, { 15037, 7614, -1 }, { 0, 7613, 2325 }, { 0, 7645, 2333 }, { 0, 7648, 2336 },
+    { 0, 7647, 2334 }, { 0, 7649, 2338 }, { 0, 7613, 2326 }, { 15038, 7650, -1 }, { 0, 7654, 2343 }, { 0, 7651, 2341 },
+    { 0, 7612, 2324 }, { 0, 7647, 2335 }, { 0, 7648, 2337 }, { 0, 7656, 2344 }, { 0, 7659, 2349 }, { 0, 7611, 2320 },
+    { 0, 7613, 2327 }, { 0, 7657, 2345 }, { 0, 7658, 2347 }, { 0, 7660, 2351 }, { 0, 7661, 2354 }, { 0, 7658, 2348 },
+    { 0, 7613, 2328 }, { 0, 7614, 2332 }, { 0, 7659, 2350 }, { 0, 7657, 2346 }, { 0, 7662, 2355 }, { 0, 7665, 2357 },
+    { 15034, 7611, 2321 }, { 0, 7651, 2342 }, { 0, 7667, 2358 }, { 15040, 7668, -1 }, { 15039, 7669, -1 }, { 15042, 7670, -1 },
+    { 0, 7613, 2329 }, { 0, 7660, 2352 }, { 0, 7679, 2367 }, { 15043, 7677, -1 }, { 0, 7678, 2365 }, { 15042, 7678, -1 },
+    { 0, 7680, 2369 }, { 0, 7681, 2372 }, { 0, 7686, 2373 }, { 0, 7660, 2353 }, { 0, 7687, 2375 }, { 0, 7613, 2330 },
+    { 0, 7680, 2370 }, { 0, 7689, 2377 }, { 0, 7670, 2362 }, { 0, 7662, 2356 }, { 0, 7677, 2364 }, { 15035, 7649, -1 },
+    { 15043, 7690, -1 }, { 0, 7696, 2379 }, { 15045, 7698, 2380 }, { 0, 7701, 2382 }, { 0, 7702, 2384 }, { 0, 7703, 2385 },
+    { 0, 7680, 2371 }, { 0, 7704, 2389 }, { 0, 7695, 2386 }, { 0, 7686, 2374 }, { 15045, 7695, 2387 }, { 0, 7705, 2391 },
+    { 15044, 7706, -1 }, { 15043, 7704, -1 }, { 0, 7709, 2393 }, { 15049, 7713, -1 }, { 0, 7714, 2397 }, { 15051, 7715, -1 },
+    { 0, 7717, 2400 }, { 0, 7701, 2383 }, { 15051, 7713, -1 }, { 0, 7718, 2401 }, { 0, 7721, 2402 }, { 0, 7724, 2403 },
+    { 15052, 7724, -1 }, { 0, 7725, 2406 }, { 15052, 7726, 2408 }, { 0, 7727, 2410 }, { 0, 7729, 2411 }, { 0, 7740, 2412 },
+    { 0, 7744, 2413 }, { 0, 7747, 2416 }, { 0, 7748, 2418 }, { 0, 7679, 2368 }, { 0, 7687, 2376 }, { 0, 7745, 2414 },
+    { 0, 7749, 2420 }, { 0, 7745, 2415 }, { 0, 7751, 2422 }, { 0, 7709, 2394 }, { 0, 7752, 2424 }, { 0, 7755, 2425 },
+    { 15053, 7754, -1 }, { 0, 7756, 2427 }, { 0, 7725, 2407 }, { 0, 7748, 2419 }, { 0, 7759, 2428 }, { 0, 7760, 2429 },
+    { 0, 7762, 2434 }, { 15056, 7769, -1 }, { 15057, 7761, -1 }, { 0, 7749, 2421 }, { 0, 7761, 2431 }, { 0, 7761, 2432 },
+    { 0, 7724, 2405 }, { 0, 7774, 2442 }, { 15059, 7773, -1 }, { 0, 7761, 2433 }, { 0, 7751, 2423 }, { 0, 7775, 2443 },
+    { 0, 7777, 2444 }, { 15059, 7773, -1 }, { 0, 7778, 2447 }, { 15062, 7779, 2450 }, { 0, 7777, 2445 }, { 0, 7781, 2453 },
+    { 15062, 7783, -1 }, { 0, 7747, 2417 }, { 0, 7789, 2455 }, { 0, 7793, 2456 }, { 0, 7797, 2457 }, { 0, 7798, 2458 },
+    { 15063, 7800, -1 }, { 0, 7803, 2460 }, { 0, 7804, 2462 }, { 15063, 7811, -1 }, { 0, 7812, 2467 }, { 0, 7813, 2471 },
+    { 0, 7773, 2440 }, { 15064, 7812, -1 }, { 15068, 7815, -1 }, { 0, 7806, 2473 }, { 0, 7762, 2435 }, { 0, 7773, 2441 },
+    { 0, 7777, 2446 }, { 15067, 7808, -1 }, { 15066, 7810, 2477 }, { 0, 7816, 2479 }, { 15060, 7778, -1 }, { 0, 7817, 2480 },
+    { 0, 7819, 2483 }, { 0, 7811, 2465 }, { 0, 7812, 2469 }, { 15068, 7818, -1 }, { 0, 7821, 2484 }, { 15071, 7822, -1 },
+    { 0, 7828, 2487 }, { 0, 7831, 2488 }, { 0, 7833, 2489 }, { 15073, 7839, -1 }, { 0, 7841, 2492 }, { 0, 7851, 2493 },
+    { 0, 7858, 2494 }, { 15074, 7859, -1 }, { 0, 7811, 2466 }, { 0, 7861, 2497 }, { 0, 7864, 2498 }, { 15068, 7818, -1 },
+    { 0, 7869, 2499 }, { 0, 7808, 2475 }, { 0, 7803, 2461 }, { 0, 7843, 2500 }, { 0, 7858, 2495 }, { 0, 7808, 2476 },
+    { 0, 7844, 2501 }, { 0, 7846, 2502 }, { 0, 7848, 2503 }, { 0, 7849, 2505 }, { 0, 7850, 2506 }, { 0, 7822, 2486 },
+    { 0, 7850, 2507 }, { 0, 7863, 2508 }, { 15077, 7867, -1 }, { 0, 7870, 2510 }, { 15079, 7871, -1 }, { 0, 7872, 2512 },
+    { 0, 7804, 2463 }, { 15075, 7848, -1 }, { 0, 7812, 2470 }, { 0, 7877, 2514 }, { 0, 7878, 2515 }, { 0, 7880, 2516 },
+    { 15079, 7872, -1 }, { 0, 7881, 2517 }, { 0, 7839, 2491 }, { 0, 7892, 2519 }, { 0, 7893, 2520 }, { 0, 7616, 2521 },
+    { 15080, 7666, -1 }, { 15077, 7617, -1 }, { 15082, 7618, 2524 }, { 0, 7619, 2527 }, { 0, 7881, 2518 }, { 0, 7620, 2528 },
+    { 0, 7622, 2529 }, { 15085, 7621, -1 }, { 0, 7623, 2534 }, { 0, 7626, 2536 }, { 0, 7628, 2537 }, { 15086, 7633, -1 },
+    { 0, 7634, 2548 }, { 0, 7624, 2552 }, { 15092, 7640, -1 }, { 0, 7646, 2554 }, { 0, 7652, 2555 }, { 0, 7634, 2549 },
+    { 0, 7671, 2556 }, { 0, 7674, 2557 }, { 15093, 7632, -1 }, { 0, 7663, 2559 }, { 0, 7682, 2560 }, { 0, 7625, 2561 },
+    { 0, 7636, 2562 }, { 0, 7676, 2563 }, { 0, 7633, 2547 }, { 0, 7688, 2564 }, { 15091, 7627, -1 }, { 0, 7629, 2567 },
+    { 15091, 7630, -1 }, { 0, 7623, 2535 }, { 0, 7631, 2569 }, { 15096, 7635, -1 }, { 15092, 7634, 2550 }, { 0, 7637, 2572 },
+    { 15097, 7642, 2574 }, { 0, 7644, 2576 }, { 0, 7638, 2577 }, { 15098, 7643, -1 }, { 0, 7697, 2583 }, { 0, 7653, 2584 },
+    { 0, 7664, 2585 }, { 0, 7672, 2587 }, { 15098, 7673, 2588 }, { 0, 7675, 2593 }, { 0, 7683, 2594 }, { 0, 7684, 2596 },
+    { 15100, 7685, -1 }, { 0, 7719, 2600 }, { 0, 7720, 2601 }, { 0, 7723, 2602 }, { 15098, 7753, -1 }, { 0, 7766, 2604 },
+    { 0, 7691, 2605 }, { 0, 7692, 2606 }, { 0, 7693, 2609 }, { 0, 7694, 2610 }, { 0, 7699, 2611 }, { 0, 7700, 2612 },
+    { 15100, 7707, -1 }, { 15104, 7708, -1 }, { 0, 7710, 2616 }, { 0, 7711, 2617 }, { 15105, 7712, 2618 }, { 15086, 7621, -1 },
+    { 15107, 7730, -1 }, { 15108, 7731, -1 }, { 0, 7716, 2623 }, { 0, 7732, 2624 }, { 15105, 7734, -1 }, { 15105, 7722, -1 },
+    { 0, 7733, 2628 }, { 0, 7728, 2629 }, { 15110, 7735, -1 }, { 15111, 7736, -1 }, { 15113, 7738, 2636 }, { 0, 7767, 2638 },
+    { 0, 7787, 2639 }, { 0, 7737, 2641 }, { 0, 7739, 2642 }, { 0, 7770, 2644 }, { 0, 7784, 2645 }, { 15114, 7824, 2646 },
+    { 0, 7741, 2650 }, { 15114, 7742, -1 }, { 15115, 7743, -1 }, { 15117, 7746, -1 }, { 15117, 7750, -1 }, { 0, 7757, 2657 },
+    { 0, 7764, 2658 }, { 0, 7768, 2659 }, { 0, 7868, 2660 }, { 0, 7873, 2661 }, { 0, 7876, 2663 }, { 0, 7879, 2664 },
+    { 0, 7883, 2665 }, { 15116, 7884, -1 }, { 0, 7886, 2671 }, { 0, 7884, 2669 }, { 0, 7896, 2672 }, { 0, 7903, 2673 },
+    { 0, 7883, 2666 }, { 0, 7909, 2674 }, { 0, 7914, 2675 }, { 0, 7926, 2676 }, { 0, 7928, 2677 }, { 0, 7930, 2678 },
+    { 0, 7890, 2679 }, { 0, 7899, 2680 }, { 0, 7901, 2681 }, { 0, 7910, 2682 }, { 0, 7911, 2683 }, { 0, 7912, 2684 },
+    { 0, 7939, 2685 }, { 0, 7825, 2686 }, { 0, 7835, 2687 }, { 0, 7855, 2688 }, { 0, 7860, 2690 }, { 0, 7874, 2691 },
+    { 0, 7887, 2692 }, { 0, 7932, 2693 }, { 0, 7933, 2694 }, { 0, 7934, 2695 }, { 0, 7935, 2696 }, { 0, 7938, 2697 },
+    { 0, 7947, 2698 }, { 0, 7948, 2699 }, { 0, 7949, 2700 }, { 0, 7883, 2667 }, { 0, 7772, 2701 }, { 0, 7884, 2670 },
+    { 0, 7799, 2703 }, { 15120, 7807, -1 }, { 0, 7814, 2705 }, { 0, 7758, 2707 }, { 0, 7763, 2708 }, { 0, 7772, 2702 },
+    { 0, 7776, 2709 }, { 0, 7826, 2711 }, { 0, 7873, 2662 }, { 0, 7765, 2712 }, { 15121, 7771, -1 }, { 0, 7780, 2714 },
+    { 15120, 7782, -1 }, { 15123, 7786, -1 }, { 15124, 7788, -1 }, { 0, 7785, 2719 }, { 0, 7790, 2720 }, { 0, 7829, 2721 },
+    { 15125, 7832, -1 }, { 0, 7791, 2724 }, { 0, 7792, 2725 }, { 15127, 7794, -1 }, { 15132, 7802, -1 }, { 15131, 7796, 2838 },
+    { 0, 7805, 2840 }, { 15130, 7795, 2841 }, { 15135, 7809, -1 }, { 0, 7801, 2844 }, { 0, 7829, 2722 }, { 0, 7882, 2847 },
+    { 0, 7885, 2848 }, { 0, 7921, 2849 }, { 0, 7923, 2850 }, { 15136, 7820, 2851 }, { 0, 7855, 2689 }, { 0, 7823, 2853 },
+    { 0, 7827, 2855 }, { 0, 7834, 2856 }, { 15137, 7891, -1 }, { 0, 7836, 2860 }, { 0, 7847, 2861 }, { 15138, 7830, -1 },
+    { 15139, 7837, -1 }, { 15140, 7838, -1 }, { 15141, 7840, -1 }, { 15141, 7842, -1 }, { 15140, 7845, -1 }, { 15143, 7852, -1 },
+    { 0, 7906, 2876 }, { 0, 7853, 2877 }, { 15145, 7854, -1 }, { 15145, 7856, -1 }, { 0, 7857, 2880 }, { 15147, 7862, -1 },
+    { 0, 7776, 2710 }, { 15148, 7865, -1 }, { 0, 7866, 2887 }, { 15150, 7875, -1 }, { 15148, 7888, -1 }, { 0, 7889, 2892 },
+    { 0, 7894, 2894 }, { 0, 7895, 2896 }, { 0, 7897, 2897 }, { 0, 7898, 2898 }, { 15153, 7900, -1 }, { 0, 7902, 2906 },
+    { 15150, 7904, -1 }, { 0, 7958, 2908 }, { 0, 7905, 2909 }, { 0, 7907, 2913 }, { 0, 7929, 2914 }, { 15153, 7908, -1 },
+    { 0, 7913, 2916 }, { 0, 7915, 2919 }, { 0, 7916, 2920 }, { 0, 7917, 2921 }, { 0, 7918, 2922 }, { 0, 7919, 2923 },
+    { 0, 7920, 2925 }, { 0, 7922, 2926 }, { 0, 7924, 2927 }, { 0, 7925, 2930 }, { 15153, 7927, -1 }, { 0, 7931, 2938 },
+    { 0, 7936, 2939 }, { 15156, 7937, -1 }, { 0, 7940, 2945 }, { 0, 7941, 2946 }, { 15156, 7942, -1 }, { 0, 7943, 2949 },
+    { 0, 7944, 2953 }, { 0, 7945, 2954 }, { 0, 7946, 2958 }, { 15157, 7950, -1 }, { 15158, 7951, -1 }, { 0, 7952, 2963 },
+    { 0, 7962, 2964 }, { 0, 7953, 2966 }, { 15160, 7954, -1 }, { 0, 7955, 2970 }, { 0, 7956, 2971 }, { 15158, 7957, -1 },
+    { 15161, 7959, -1 }, { 0, 7960, 2974 }, { 0, 7979, 2975 }, { 0, 8006, 2976 }, { 15163, 7961, 2977 }, { 15167, 7963, 2982 },
+    { 0, 7975, 2984 }, { 15167, 7964, 2985 }, { 0, 7965, 2988 }, { 0, 7965, 2989 }, { 0, 7966, 2990 }, { 0, 7976, 2991 },
+    { 0, 7985, 2992 }, { 0, 7986, 2993 }, { 15169, 7995, -1 }, { 0, 7967, 2995 }, { 0, 7991, 2996 }, { 0, 7968, 2997 },
+    { 0, 7969, 2998 }, { 0, 7981, 2999 }, { 0, 8000, 3000 }, { 0, 8012, 3001 }, { 0, 8018, 3002 }, { 0, 7970, 3003 },
+    { 0, 7971, 3005 }, { 15170, 7983, 3006 }, { 0, 7972, 3008 }, { 15172, 7974, -1 }, { 15169, 7980, -1 }, { 15174, 8024, 3012 },
+    { 0, 7973, 3014 }, { 0, 7980, 3011 }, { 0, 7977, 3016 }, { 0, 7982, 3017 }, { 15176, 7999, -1 }, { 0, 7987, 3019 },
+    { 0, 7988, 3020 }, { 0, 7989, 3023 }, { 0, 7996, 3024 }, { 15173, 7997, -1 }, { 0, 8005, 3026 }, { 0, 7988, 3021 },
+    { 15175, 8007, -1 }, { 0, 8008, 3028 }, { 0, 8009, 3029 }, { 0, 8010, 3030 }, { 0, 8037, 3031 }, { 0, 8050, 3032 },
+    { 0, 7990, 3033 }, { 0, 8003, 3034 }, { 0, 7992, 3035 }, { 0, 7993, 3036 }, { 15175, 7973, -1 }, { 15179, 8016, 3037 },
+    { 0, 8004, 3039 }, { 0, 8011, 3040 }, { 0, 8022, 3041 }, { 0, 8026, 3042 }, { 0, 8027, 3043 }, { 15180, 7984, -1 },
+    { 0, 8002, 3046 }, { 15180, 7978, -1 }, { 0, 7994, 3052 }, { 0, 7998, 3054 }, { 0, 8001, 3056 }, { 15180, 8013, -1 },
+    { 0, 7988, 3022 }, { 0, 8027, 3044 }, { 0, 8042, 3058 }, { 0, 8014, 3059 }, { 0, 8043, 3060 }, { 15182, 8015, 3061 },
+    { 0, 8017, 3063 }, { 0, 8019, 3064 }, { 0, 8020, 3065 }, { 0, 8021, 3066 }, { 0, 8023, 3067 }, { 0, 8032, 3068 },
+    { 0, 8054, 3070 }, { 15183, 8062, 3071 }, { 0, 8065, 3073 }, { 0, 8028, 3074 }, { 0, 8053, 3075 }, { 0, 8055, 3076 },
+    { 0, 8025, 3077 }, { 0, 8049, 3078 }, { 0, 8060, 3079 }, { 0, 8029, 3080 }, { 0, 8030, 3088 }, { 0, 8031, 3090 },
+    { 15184, 8052, -1 }, { 15182, 8033, -1 }, { 15184, 8034, -1 }, { 0, 8032, 3069 }, { 15187, 8035, -1 }, { 0, 8036, 3095 },
+    { 0, 8038, 3096 }, { 0, 8039, 3097 }, { 0, 8040, 3098 }, { 15187, 8041, -1 }, { 0, 8093, 3100 }, { 0, 8044, 3101 },
+    { 0, 8045, 3102 }, { 15189, 8046, -1 }, { 15187, 8047, -1 }, { 15188, 8048, -1 }, { 0, 8051, 3107 }, { 0, 8056, 3108 },
+    { 15192, 8057, -1 }, { 0, 8058, 3110 }, { 15193, 8059, 3111 }, { 0, 8061, 3113 }, { 0, 8063, 3114 }, { 0, 8064, 3115 },
+    { 0, 8066, 3116 }, { 0, 8067, 3117 }, { 0, 8068, 3118 }, { 0, 8069, 3119 }, { 0, 8070, 3120 }, { 0, 8071, 3127 },
+    { 0, 8072, 3129 }, { 0, 8073, 3131 }, { 0, 8074, 3132 }, { 0, 8075, 3133 }, { 0, 8076, 3134 }, { 0, 8077, 3135 },
+    { 0, 8078, 3136 }, { 15196, 8079, -1 }, { 0, 8080, 3139 }, { 0, 8082, 3140 }, { 0, 8081, 3141 }, { 0, 8092, 3142 },
+    { 0, 8083, 3143 }, { 15195, 8084, -1 }, { 0, 8085, 3145 }, { 15194, 8086, -1 }, { 0, 8087, 3158 }, { 0, 8105, 3159 },
+    { 0, 8088, 3160 }, { 0, 8134, 3161 }, { 0, 8148, 3163 }, { 0, 8149, 3164 }, { 0, 8089, 3166 }, { 0, 8090, 3167 },
+    { 15198, 8112, 3168 }, { 0, 8091, 3172 }, { 15200, 8094, -1 }, { 0, 8095, 3175 }, { 0, 8096, 3176 }, { 0, 8134, 3162 },
+    { 0, 8097, 3180 }, { 0, 8098, 3181 }, { 0, 8149, 3165 }, { 15202, 8099, -1 }, { 0, 8100, 3185 }, { 0, 8101, 3186 },
+    { 0, 8102, 3187 }, { 0, 8103, 3188 }, { 15203, 8104, -1 }, { 15200, 8106, 3190 }, { 15201, 8107, -1 }, { 0, 8108, 3193 },
+    { 15206, 8109, -1 }, { 15208, 8115, 3195 }, { 15208, 8110, -1 }, { 15209, 8128, -1 }, { 15210, 8111, -1 }, { 15211, 8113, -1 },
+    { 0, 8114, 3207 }, { 0, 8116, 3208 }, { 0, 8117, 3209 }, { 0, 8118, 3210 }, { 0, 8144, 3211 }, { 0, 8119, 3212 },
+    { 0, 8120, 3219 }, { 0, 8121, 3220 }, { 0, 8122, 3221 }, { 0, 8123, 3222 }, { 15208, 8124, -1 }, { 0, 8125, 3226 },
+    { 0, 8126, 3229 }, { 15210, 8127, -1 }, { 0, 8129, 3234 }, { 0, 8130, 3235 }, { 0, 8131, 3236 }, { 0, 8132, 3238 },
+    { 0, 8133, 3240 }, { 0, 8135, 3241 }, { 15214, 8141, -1 }, { 0, 8136, 3243 }, { 0, 8137, 3244 }, { 0, 8138, 3249 },
+    { 15211, 8139, -1 }, { 0, 8140, 3252 }, { 0, 8142, 3253 }, { 0, 8143, 3255 }, { 15215, 8145, -1 }, { 0, 8146, 3257 },
+    { 0, 8147, 3258 }, { 0, 8150, 3259 }, { 15216, 8151, -1 }, { 0, 8173, 3261 }, { 0, 8152, 3262 }, { 0, 8153, 3263 },
+    { 15218, 8154, -1 }, { 15215, 8155, -1 }, { 0, 8156, 3267 }, { 0, 8157, 3269 }, { 15221, 8158, -1 }, { 0, 8159, 3271 },
+    { 0, 8160, 3272 }, { 0, 8161, 3273 }, { 0, 8162, 3274 }, { 15222, 8163, 3276 }, { 15224, 8184, -1 }, { 15223, 8193, -1 },
+    { 15228, 8164, -1 }, { 0, 8165, 3294 }, { 15229, 8166, -1 }, { 15230, 8174, -1 }, { 15233, 8167, -1 }, { 15234, 8168, -1 },
+    { 15234, 8185, -1 }, { 15235, 8169, -1 }, { 15234, 8170, -1 }, { 0, 8172, 3308 }, { 0, 8171, 3311 }, { 0, 8176, 3312 },
+    { 15237, 8172, 3309 }, { 15239, 8179, -1 }, { 0, 8180, 3315 }, { 0, 8181, 3316 }, { 0, 8182, 3318 }, { 0, 8186, 3319 },
+    { 0, 8187, 3322 }, { 0, 8190, 3323 }, { 0, 8195, 3324 }, { 15243, 8199, -1 }, { 0, 8201, 3326 }, { 0, 8206, 3327 },
+    { 0, 8207, 3328 }, { 0, 8218, 3329 }, { 0, 8226, 3330 }, { 15243, 8228, -1 }, { 0, 8174, 3299 }, { 0, 8231, 3332 },
+    { 0, 8232, 3334 }, { 15242, 8234, -1 }, { 0, 8202, 3337 }, { 0, 8203, 3339 }, { 0, 8204, 3341 }, { 0, 8219, 3344 },
+    { 0, 8216, 3342 }, { 0, 8220, 3345 }, { 0, 8181, 3317 }, { 15241, 8186, -1 }, { 0, 8202, 3338 }, { 15245, 8223, -1 },
+    { 0, 8239, 3347 }, { 0, 8240, 3348 }, { 0, 8242, 3349 }, { 0, 8245, 3350 }, { 0, 8231, 3333 }, { 0, 8208, 3351 },
+    { 15248, 8209, -1 }, { 0, 8210, 3357 }, { 15239, 8179, -1 }, { 0, 8234, 3336 }, { 0, 8216, 3343 }, { 15246, 8224, -1 },
+    { 0, 8227, 3360 }, { 15249, 8238, -1 }, { 0, 8170, 3307 }, { 15247, 8243, -1 }, { 0, 8210, 3358 }, { 0, 8246, 3364 },
+    { 15246, 8208, -1 }, { 0, 8247, 3365 }, { 0, 8208, 3354 }, { 0, 8251, 3366 }, { 0, 8252, 3367 }, { 0, 8255, 3368 },
+    { 0, 8256, 3369 }, { 0, 8270, 3370 }, { 15249, 8274, -1 }, { 0, 8290, 3372 }, { 0, 8295, 3373 }, { 15244, 8203, -1 },
+    { 0, 8296, 3374 }, { 0, 8297, 3375 }, { 15252, 8249, -1 }, { 15252, 8253, -1 }, { 0, 8261, 3379 }, { 0, 8275, 3380 },
+    { 0, 8282, 3381 }, { 0, 8249, 3377 }, { 15251, 8283, -1 }, { 0, 8288, 3384 }, { 15257, 8175, -1 }, { 15256, 8177, 3388 },
+    { 15258, 8178, 3390 }, { 15259, 8221, -1 }, { 0, 8183, 3393 }, { 15261, 8188, -1 }, { 15257, 8189, -1 }, { 15258, 8191, -1 },
+    { 0, 8282, 3382 }, { 0, 8192, 3397 }, { 0, 8209, 3356 }, { 15263, 8194, -1 }, { 0, 8196, 3399 }, { 0, 8197, 3400 },
+    { 0, 8198, 3401 }, { 0, 8200, 3402 }, { 0, 8205, 3403 }, { 15263, 8212, -1 }, { 0, 8217, 3406 }, { 15266, 8211, -1 },
+    { 15265, 8213, -1 }, { 15267, 8214, 3409 }, { 15268, 8263, -1 }, { 0, 8215, 3413 }, { 15269, 8222, 3415 }, { 0, 8225, 3417 },
+    { 0, 8229, 3418 }, { 15267, 8230, 3419 }, { 0, 8233, 3421 }, { 0, 8236, 3423 }, { 15272, 8241, -1 }, { 0, 8235, 3426 },
+    { 0, 8257, 3427 }, { 0, 8260, 3428 }, { 0, 8300, 3429 }, { 0, 8304, 3430 }, { 15271, 8244, -1 }, { 0, 8262, 3432 },
+    { 0, 8248, 3433 }, { 0, 8254, 3434 }, { 0, 8291, 3435 }, { 15274, 8237, -1 }, { 0, 8263, 3412 }, { 0, 8250, 3437 },
+    { 15274, 8258, -1 }, { 15275, 8273, -1 }, { 0, 8259, 3440 }, { 0, 8264, 3441 }, { 15276, 8265, 3443 }, { 15277, 8266, -1 },
+    { 15275, 8267, -1 }, { 0, 8268, 3447 }, { 15278, 8269, -1 }, { 15280, 8271, -1 }, { 0, 8272, 3450 }, { 15278, 8276, -1 },
+    { 0, 8277, 3463 }, { 0, 8278, 3466 }, { 0, 8279, 3467 }, { 0, 8280, 3472 }, { 0, 8281, 3473 }, { 0, 8284, 3474 },
+    { 15283, 8285, -1 }, { 0, 8286, 3476 }, { 15280, 8287, -1 }, { 0, 8289, 3479 }, { 15281, 8317, -1 }, { 0, 8292, 3481 },
+    { 15285, 8293, -1 }, { 0, 8294, 3484 }, { 0, 8298, 3485 }, { 15286, 8299, -1 }, { 0, 8301, 3487 }, { 15288, 8302, -1 },
+    { 0, 8319, 3489 }, { 0, 8329, 3490 }, { 15285, 8303, -1 }, { 0, 8305, 3492 }, { 0, 8306, 3493 }, { 0, 8307, 3494 },
+    { 15290, 8308, 3495 }, { 15291, 8309, -1 }, { 15291, 8310, -1 }, { 15294, 8311, -1 }, { 0, 8312, 3500 }, { 0, 8314, 3501 },
+    { 0, 8313, 3502 }, { 15294, 8321, -1 }, { 15296, 8333, -1 }, { 15294, 8342, -1 }, { 15297, 8368, 3508 }, { 15298, 8315, -1 },
+    { 0, 8316, 3512 }, { 15302, 8348, -1 }, { 0, 8318, 3514 }, { 15301, 8320, -1 }, { 0, 8327, 3516 }, { 15303, 8323, -1 },
+    { 0, 8328, 3518 }, { 0, 8322, 3519 }, { 0, 8324, 3520 }, { 15300, 8325, 3521 }, { 15304, 8326, -1 }, { 0, 8381, 3524 },
+    { 15302, 8330, -1 }, { 0, 8358, 3527 }, { 15308, 8331, -1 }, { 15308, 8334, -1 }, { 0, 8350, 3531 }, { 15308, 8332, -1 },
+    { 0, 8335, 3533 }, { 0, 8366, 3534 }, { 15291, 8321, 3504 }, { 0, 8367, 3535 }, { 15311, 8384, -1 }, { 0, 8336, 3537 },
+    { 0, 8365, 3538 }, { 0, 8338, 3539 }, { 0, 8357, 3540 }, { 0, 8382, 3541 }, { 0, 8337, 3542 }, { 0, 8343, 3543 },
+    { 0, 8341, 3544 }, { 0, 8344, 3545 }, { 0, 8344, 3546 }, { 0, 8355, 3547 }, { 0, 8362, 3548 }, { 0, 8378, 3549 },
+    { 0, 8387, 3550 }, { 15309, 8339, -1 }, { 15310, 8345, -1 }, { 0, 8392, 3559 }, { 0, 8340, 3560 }, { 0, 8346, 3562 },
+    { 0, 8347, 3563 }, { 0, 8349, 3564 }, { 15314, 8351, -1 }, { 0, 8352, 3566 }, { 15316, 8353, -1 }, { 15316, 8354, -1 },
+    { 15319, 8356, -1 }, { 15320, 8359, -1 }, { 15320, 8360, -1 }, { 0, 8361, 3573 }, { 0, 8370, 3575 }, { 0, 8388, 3576 },
+    { 15318, 8363, -1 }, { 15321, 8364, -1 }, { 0, 8369, 3583 }, { 0, 8371, 3584 }, { 0, 8372, 3586 }, { 15324, 8373, -1 },
+    { 15325, 8374, -1 }, { 0, 8376, 3589 }, { 15322, 8386, -1 }, { 0, 8391, 3592 }, { 0, 8393, 3594 }, { 15323, 8396, 3595 },
+    { 0, 8403, 3597 }, { 0, 8409, 3598 }, { 0, 8427, 3599 }, { 0, 8441, 3600 }, { 0, 8444, 3602 }, { 0, 8383, 3603 },
+    { 0, 8385, 3604 }, { 0, 8391, 3593 }, { 0, 8390, 3605 }, { 0, 8397, 3606 }, { 15328, 8405, -1 }, { 0, 8407, 3608 },
+    { 0, 8424, 3609 }, { 0, 8429, 3610 }, { 15329, 8434, -1 }, { 0, 8394, 3612 }, { 0, 8376, 3590 }, { 0, 8401, 3613 },
+    { 0, 8402, 3614 }, { 15330, 8395, -1 }, { 0, 8399, 3616 }, { 0, 8422, 3618 }, { 0, 8456, 3619 }, { 0, 8375, 3620 },
+    { 0, 8412, 3621 }, { 0, 8377, 3622 }, { 15331, 8379, -1 }, { 0, 8380, 3626 }, { 15332, 8419, -1 }, { 15333, 8398, -1 },
+    { 0, 8441, 3601 }, { 0, 8410, 3629 }, { 15332, 8389, -1 }, { 0, 8400, 3631 }, { 0, 8404, 3638 }, { 0, 8406, 3641 },
+    { 0, 8408, 3642 }, { 0, 8411, 3643 }, { 15333, 8413, 3644 }, { 0, 8414, 3647 }, { 0, 8415, 3648 }, { 15336, 8416, -1 },
+    { 0, 8417, 3651 }, { 15337, 8418, -1 }, { 0, 8420, 3657 }, { 0, 8476, 3658 }, { 15335, 8421, -1 }, { 0, 8440, 3660 },
+    { 0, 8423, 3661 }, { 0, 8425, 3662 }, { 15339, 8426, -1 }, { 0, 8428, 3668 }, { 0, 8430, 3673 }, { 15336, 8431, -1 },
+    { 0, 8435, 3675 }, { 0, 8432, 3677 }, { 0, 8433, 3678 }, { 0, 8436, 3679 }, { 0, 8437, 3681 }, { 0, 8438, 3682 },
+    { 0, 8439, 3683 }, { 15341, 8442, -1 }, { 15342, 8443, -1 }, { 0, 8399, 3617 }, { 0, 8445, 3688 }, { 15343, 8446, 3689 },
+    { 0, 8447, 3691 }, { 0, 8448, 3692 }, { 0, 8449, 3696 }, { 0, 8450, 3700 }, { 0, 8451, 3705 }, { 15341, 8452, -1 },
+    { 0, 8453, 3707 }, { 0, 8454, 3709 }, { 0, 8455, 3710 }, { 0, 8457, 3711 }, { 0, 8458, 3712 }, { 0, 8459, 3713 },
+    { 0, 8460, 3714 }, { 0, 8461, 3718 }, { 0, 8462, 3719 }, { 15342, 8463, -1 }, { 0, 8464, 3721 }, { 15343, 8465, -1 },
+    { 0, 8466, 3723 }, { 0, 8467, 3724 }, { 0, 8497, 3725 }, { 0, 8501, 3726 }, { 0, 8468, 3727 }, { 0, 8472, 3728 },
+    { 0, 8469, 3729 }, { 15346, 8489, -1 }, { 0, 8502, 3731 }, { 0, 8504, 3732 }, { 0, 8470, 3733 }, { 0, 8473, 3734 },
+    { 0, 8474, 3735 }, { 15345, 8471, -1 }, { 0, 8475, 3738 }, { 0, 8477, 3739 }, { 15350, 8478, -1 }, { 0, 8479, 3751 },
+    { 0, 8480, 3755 }, { 0, 8481, 3756 }, { 15352, 8482, 3757 }, { 0, 8483, 3760 }, { 15352, 8528, -1 }, { 15352, 8539, -1 },
+    { 0, 8484, 3763 }, { 0, 8485, 3766 }, { 0, 8486, 3775 }, { 15353, 8487, -1 }, { 15351, 8488, -1 }, { 0, 8516, 3778 },
+    { 15352, 8490, 3779 }, { 0, 8491, 3781 }, { 0, 8492, 3782 }, { 0, 8493, 3783 }, { 0, 8494, 3784 }, { 15353, 8495, -1 },
+    { 0, 8496, 3786 }, { 0, 8498, 3787 }, { 15357, 8499, -1 }, { 0, 8500, 3794 }, { 0, 8503, 3795 }, { 0, 8505, 3798 },
+    { 0, 8506, 3802 }, { 15357, 8507, -1 }, { 0, 8508, 3804 }, { 0, 8509, 3805 }, { 15357, 8520, -1 }, { 15363, 8510, -1 },
+    { 0, 8511, 3810 }, { 0, 8512, 3811 }, { 0, 8513, 3812 }, { 15363, 8514, -1 }, { 0, 8517, 3816 }, { 0, 8541, 3817 },
+    { 0, 8518, 3819 }, { 0, 8519, 3820 }, { 15363, 8515, -1 }, { 0, 8521, 3825 }, { 0, 8522, 3827 }, { 0, 8523, 3830 },
+    { 15364, 8573, -1 }, { 15365, 8524, -1 }, { 0, 8525, 3833 }, { 0, 8526, 3834 }, { 15367, 8527, 3835 }, { 15369, 8576, -1 },
+    { 15368, 8529, -1 }, { 0, 8543, 3839 }, { 0, 8530, 3841 }, { 0, 8532, 3842 }, { 0, 8544, 3843 }, { 0, 8531, 3844 },
+    { 15368, 8533, -1 }, { 15370, 8534, -1 }, { 0, 8535, 3848 }, { 0, 8536, 3849 }, { 15368, 8537, -1 }, { 0, 8538, 3852 },
+    { 0, 8552, 3853 }, { 0, 8540, 3854 }, { 0, 8542, 3856 }, { 15373, 8545, -1 }, { 0, 8546, 3861 }, { 0, 8550, 3862 },
+    { 15372, 8570, -1 }, { 15376, 8583, -1 }, { 0, 8589, 3868 }, { 0, 8547, 3869 }, { 0, 8585, 3870 }, { 0, 8587, 3871 },
+    { 15375, 8590, -1 }, { 0, 8592, 3874 }, { 0, 8548, 3875 }, { 0, 8569, 3876 }, { 0, 8549, 3877 }, { 0, 8551, 3878 },
+    { 0, 8553, 3879 }, { 15380, 8554, -1 }, { 0, 8555, 3882 }, { 15382, 8556, -1 }, { 0, 8557, 3885 }, { 15382, 8607, 3886 },
+    { 15381, 8558, -1 }, { 15382, 8580, -1 }, { 0, 8559, 3892 }, { 0, 8560, 3894 }, { 0, 8561, 3899 }, { 0, 8562, 3900 },
+    { 0, 8564, 3901 }, { 15382, 8593, -1 }, { 0, 8563, 3903 }, { 0, 8565, 3904 }, { 0, 8566, 3905 }, { 0, 8567, 3906 },
+    { 0, 8568, 3907 }, { 0, 8571, 3908 }, { 0, 8572, 3909 }, { 0, 8574, 3911 }, { 0, 8575, 3912 }, { 15384, 8577, -1 },
+    { 15385, 8578, -1 }, { 0, 8579, 3915 }, { 0, 8581, 3916 }, { 0, 8611, 3917 }, { 0, 8621, 3918 }, { 0, 8586, 3919 },
+    { 0, 8594, 3920 }, { 15389, 8582, -1 }, { 0, 8584, 3922 }, { 0, 8588, 3923 }, { 0, 8623, 3924 }, { 0, 8630, 3925 },
+    { 0, 8631, 3926 }, { 0, 8591, 3927 }, { 0, 8604, 3929 }, { 0, 8591, 3928 }, { 15389, 8595, -1 }, { 0, 8614, 3932 },
+    { 0, 8596, 3933 }, { 15387, 8597, -1 }, { 0, 8598, 3945 }, { 0, 8599, 3946 }, { 0, 8656, 3947 }, { 15393, 8600, -1 },
+    { 15390, 8601, 3949 }, { 0, 8602, 3951 }, { 0, 8603, 3952 }, { 0, 8605, 3954 }, { 0, 8606, 3955 }, { 15395, 8608, -1 },
+    { 0, 8609, 3960 }, { 15395, 8610, -1 }, { 0, 8612, 3971 }, { 0, 8613, 3972 }, { 0, 8615, 3975 }, { 0, 8616, 3977 },
+    { 0, 8657, 3978 }, { 15393, 8617, -1 }, { 0, 8618, 3980 }, { 0, 8619, 3981 }, { 0, 8620, 3982 }, { 0, 8622, 3983 },
+    { 0, 8624, 3984 }, { 0, 8625, 3985 }, { 0, 8626, 3986 }, { 15397, 8627, -1 }, { 0, 8628, 3988 }, { 15398, 8629, -1 },
+    { 15399, 8642, -1 }, { 15399, 8632, -1 }, { 15400, 8662, -1 }, { 15400, 8633, -1 }, { 15401, 8634, -1 }, { 15403, 8635, -1 },
+    { 15401, 8670, -1 }, { 0, 8636, 3998 }, { 0, 8637, 3999 }, { 0, 8639, 4000 }, { 0, 8648, 4001 }, { 0, 8641, 4002 },
+    { 0, 8660, 4003 }, { 0, 8663, 4004 }, { 0, 8638, 4005 }, { 0, 8640, 4006 }, { 0, 8650, 4007 }, { 15406, 8643, -1 },
+    { 0, 8644, 4021 }, { 0, 8645, 4022 }, { 15408, 8646, -1 }, { 15406, 8647, -1 }, { 0, 8684, 4025 }, { 0, 8649, 4026 },
+    { 0, 8653, 4027 }, { 0, 8664, 4028 }, { 15407, 8652, -1 }, { 15411, 8661, -1 }, { 15411, 8651, -1 }, { 0, 8654, 4032 },
+    { 15409, 8655, -1 }, { 0, 8658, 4034 }, { 0, 8659, 4035 }, { 0, 8665, 4036 }, { 15414, 8666, -1 }, { 0, 8667, 4039 },
+    { 15414, 8668, -1 }, { 0, 8669, 4042 }, { 0, 8671, 4051 }, { 0, 8672, 4052 }, { 15415, 8673, -1 }, { 0, 8674, 4055 },
+    { 0, 8675, 4056 }, { 0, 8676, 4057 }, { 0, 8677, 4058 }, { 0, 8678, 4060 }, { 0, 8679, 4061 }, { 0, 8681, 4062 },
+    { 0, 8682, 4063 }, { 0, 8683, 4064 }, { 0, 8685, 4065 }, { 0, 8687, 4066 }, { 0, 8691, 4067 }, { 0, 8704, 4068 },
+    { 0, 8722, 4069 }, { 0, 8723, 4071 }, { 15414, 8726, -1 }, { 0, 8736, 4074 }, { 15416, 8740, -1 }, { 0, 8723, 4072 },
+    { 0, 8690, 4076 }, { 15415, 8692, 4077 }, { 15420, 8693, -1 }, { 0, 8706, 4080 }, { 0, 8708, 4081 }, { 15421, 8716, -1 },
+    { 0, 8732, 4084 }, { 0, 8734, 4085 }, { 0, 8696, 4086 }, { 0, 8699, 4087 }, { 0, 8708, 4082 }, { 0, 8701, 4088 },
+    { 15418, 8714, -1 }, { 0, 8725, 4090 }, { 0, 8727, 4091 }, { 15423, 8749, -1 }, { 0, 8722, 4070 }, { 0, 8712, 4093 },
+    { 0, 8713, 4094 }, { 0, 8717, 4096 }, { 0, 8737, 4097 }, { 0, 8743, 4099 }, { 0, 8750, 4100 }, { 0, 8751, 4101 },
+    { 0, 8757, 4102 }, { 0, 8760, 4104 }, { 0, 8765, 4105 }, { 0, 8700, 4106 }, { 0, 8720, 4107 }, { 15424, 8742, -1 },
+    { 0, 8745, 4109 }, { 0, 8737, 4098 }, { 0, 8680, 4110 }, { 0, 8686, 4111 }, { 0, 8688, 4112 }, { 0, 8689, 4118 },
+    { 0, 8677, 4059 }, { 0, 8694, 4119 }, { 0, 8695, 4120 }, { 0, 8697, 4121 }, { 15424, 8698, -1 }, { 15426, 8702, -1 },
+    { 15423, 8703, -1 }, { 0, 8705, 4137 }, { 0, 8707, 4138 }, { 0, 8709, 4139 }, { 0, 8710, 4140 }, { 0, 8711, 4141 },
+    { 0, 8719, 4142 }, { 0, 8715, 4143 }, { 0, 8718, 4144 }, { 0, 8721, 4145 }, { 0, 8724, 4147 }, { 0, 8728, 4148 },
+    { 15425, 8729, -1 }, { 15426, 8773, -1 }, { 0, 8730, 4158 }, { 0, 8731, 4159 }, { 15431, 8733, -1 }, { 0, 8735, 4162 },
+    { 0, 8738, 4164 }, { 0, 8739, 4165 }, { 0, 8741, 4166 }, { 15428, 8744, -1 }, { 15429, 8752, 4171 }, { 15434, 8746, -1 },
+    { 0, 8747, 4174 }, { 15432, 8748, 4177 }, { 0, 8757, 4103 }, { 0, 8713, 4095 }, { 0, 8753, 4180 }, { 0, 8754, 4184 },
+    { 0, 8755, 4186 }, { 0, 8756, 4188 }, { 0, 8758, 4191 }, { 15432, 8759, -1 }, { 15434, 8761, -1 }, { 15434, 8762, -1 },
+    { 15435, 8785, -1 }, { 0, 8763, 4197 }, { 0, 8764, 4198 }, { 15438, 8766, 4199 }, { 0, 8777, 4201 }, { 0, 8767, 4203 },
+    { 0, 8769, 4204 }, { 0, 8776, 4205 }, { 0, 8806, 4206 }, { 0, 8817, 4207 }, { 0, 8819, 4208 }, { 0, 8822, 4209 },
+    { 0, 8770, 4210 }, { 0, 8771, 4211 }, { 0, 8768, 4212 }, { 0, 8772, 4213 }, { 15440, 8774, -1 }, { 0, 8775, 4219 },
+    { 0, 8824, 4220 }, { 0, 8778, 4223 }, { 0, 8780, 4224 }, { 0, 8779, 4225 }, { 0, 8823, 4226 }, { 0, 8781, 4229 },
+    { 0, 8782, 4232 }, { 15443, 8783, -1 }, { 0, 8784, 4237 }, { 15445, 8815, -1 }, { 15446, 8786, -1 }, { 0, 8787, 4240 },
+    { 0, 8788, 4242 }, { 0, 8789, 4244 }, { 0, 8790, 4248 }, { 0, 8791, 4249 }, { 15445, 8792, -1 }, { 15448, 8793, -1 },
+    { 0, 8794, 4252 }, { 0, 8795, 4253 }, { 0, 8796, 4254 }, { 0, 8797, 4255 }, { 0, 8798, 4256 }, { 0, 8799, 4257 },
+    { 0, 8818, 4258 }, { 0, 8800, 4259 }, { 0, 8810, 4260 }, { 0, 8813, 4261 }, { 0, 8801, 4262 }, { 0, 8802, 4263 },
+    { 0, 8803, 4264 }, { 0, 8804, 4265 }, { 15447, 8805, -1 }, { 0, 8807, 4268 }, { 15446, 8808, -1 }, { 0, 8809, 4271 },
+    { 15451, 8811, -1 }, { 0, 8812, 4273 }, { 15448, 8814, -1 }, { 0, 8816, 4276 }, { 0, 8820, 4277 }, { 0, 8821, 4279 },
+    { 15453, 8825, -1 }, { 0, 8826, 4282 }, { 15451, 8827, 4283 }, { 0, 8881, 4285 }, { 15452, 8828, -1 }, { 15456, 8829, -1 },
+    { 15455, 8830, -1 }, { 15443, 8783, -1 }, { 15459, 8831, -1 }, { 15457, 8858, -1 }, { 0, 8832, 4306 }, { 0, 8833, 4311 },
+    { 0, 8834, 4317 }, { 15461, 8835, 4319 }, { 15458, 8836, -1 }, { 0, 8837, 4322 }, { 0, 8838, 4327 }, { 15463, 8839, -1 },
+    { 0, 8840, 4332 }, { 0, 8841, 4334 }, { 0, 8842, 4336 }, { 15465, 8843, -1 }, { 0, 8844, 4340 }, { 15467, 8875, -1 },
+    { 15468, 8845, -1 }, { 0, 8846, 4345 }, { 0, 8847, 4347 }, { 0, 8848, 4349 }, { 0, 8849, 4353 }, { 0, 8850, 4355 },
+    { 0, 8851, 4356 }, { 15465, 8852, -1 }, { 15466, 8853, -1 }, { 15467, 8854, -1 }, { 15472, 8857, -1 }, { 15471, 8859, 4361 },
+    { 0, 8883, 4363 }, { 15470, 8855, -1 }, { 0, 8856, 4365 }, { 15471, 8860, -1 }, { 0, 8861, 4367 }, { 0, 8862, 4368 },
+    { 0, 8863, 4369 }, { 0, 8864, 4371 }, { 15476, 8903, -1 }, { 15477, 8919, -1 }, { 15474, 8865, -1 }, { 15478, 8882, -1 },
+    { 15480, 8866, -1 }, { 0, 8867, 4381 }, { 15484, 8873, -1 }, { 0, 8868, 4384 }, { 0, 8869, 4385 }, { 0, 8870, 4387 },
+    { 0, 8871, 4389 }, { 0, 8872, 4390 }, { 15487, 8874, 4391 }, { 15485, 8876, -1 }, { 0, 8877, 4397 }, { 0, 8878, 4398 },
+    { 0, 8879, 4399 }, { 0, 8880, 4409 }, { 0, 8884, 4410 }, { 15465, 8843, -1 }, { 0, 8885, 4411 }, { 0, 8886, 4412 },
+    { 0, 8887, 4413 }, { 0, 8888, 4416 }, { 0, 8889, 4422 }, { 0, 8890, 4423 }, { 15482, 8891, -1 }, { 15491, 8899, 4435 },
+    { 15492, 8941, -1 }, { 0, 8892, 4438 }, { 15489, 8893, -1 }, { 15490, 8894, -1 }, { 0, 8915, 4442 }, { 0, 8895, 4443 },
+    { 0, 8892, 4439 }, { 0, 8900, 4444 }, { 15495, 8896, 4445 }, { 15496, 8898, -1 }, { 15497, 8917, -1 }, { 0, 8902, 4450 },
+    { 15499, 8904, -1 }, { 0, 8897, 4452 }, { 15496, 8934, -1 }, { 15501, 8901, -1 }, { 0, 8939, 4456 }, { 15503, 8905, -1 },
+    { 15503, 8906, -1 }, { 15504, 8918, -1 }, { 15502, 8940, -1 }, { 15507, 8948, -1 }, { 0, 8907, 4463 }, { 15508, 8910, -1 },
+    { 0, 8908, 4465 }, { 15510, 8916, -1 }, { 15510, 8909, 4467 }, { 15511, 8911, -1 }, { 0, 8912, 4472 }, { 0, 8913, 4473 },
+    { 0, 8914, 4474 }, { 0, 8920, 4475 }, { 15511, 8921, -1 }, { 0, 8922, 4479 }, { 0, 8923, 4481 }, { 0, 8924, 4482 },
+    { 0, 8925, 4485 }, { 0, 8926, 4486 }, { 15512, 8927, -1 }, { 0, 8928, 4489 }, { 0, 8929, 4490 }, { 0, 8931, 4493 },
+    { 0, 8942, 4494 }, { 0, 8930, 4496 }, { 0, 8932, 4497 }, { 0, 8933, 4498 }, { 0, 8935, 4499 }, { 0, 8936, 4500 },
+    { 0, 8937, 4501 }, { 0, 8938, 4502 }, { 0, 8989, 4503 }, { 15501, 8918, -1 }, { 0, 8943, 4504 }, { 0, 8944, 4505 },
+    { 15510, 8945, -1 }, { 0, 8946, 4507 }, { 0, 8947, 4508 }, { 0, 8949, 4509 }, { 0, 8950, 4511 }, { 0, 8951, 4513 },
+    { 15512, 8952, -1 }, { 15513, 8953, -1 }, { 0, 8954, 4516 }, { 15516, 8955, -1 }, { 0, 8956, 4521 }, { 0, 8957, 4522 },
+    { 0, 8958, 4525 }, { 0, 8959, 4526 }, { 0, 8960, 4527 }, { 15517, 8961, 4529 }, { 0, 8962, 4531 }, { 15516, 8963, -1 },
+    { 0, 8964, 4534 }, { 15518, 8965, -1 }, { 15520, 8966, 4541 }, { 0, 8967, 4543 }, { 0, 8968, 4547 }, { 0, 8969, 4548 },
+    { 0, 8970, 4551 }, { 0, 8971, 4557 }, { 0, 8972, 4558 }, { 0, 8973, 4560 }, { 0, 8949, 4510 }, { 0, 8974, 4563 },
+    { 0, 8975, 4564 }, { 0, 8976, 4567 }, { 0, 8977, 4569 }, { 0, 8978, 4570 }, { 0, 8979, 4571 }, { 0, 8980, 4572 },
+    { 0, 8981, 4573 }, { 0, 8982, 4574 }, { 0, 8983, 4576 }, { 0, 8984, 4577 }, { 0, 8985, 4578 }, { 0, 8986, 4579 },
+    { 0, 8987, 4580 }, { 15519, 8988, -1 }, { 0, 8990, 4582 }, { 0, 8991, 4584 }, { 15525, 8992, 4589 }, { 0, 8993, 4594 },
+    { 15525, 8994, 4595 }, { 15525, 8995, -1 }, { 0, 8996, 4605 }, { 0, 9018, 4606 }, { 0, 8997, 4608 }, { 15531, 9020, -1 },
+    { 0, 8998, 4611 }, { 0, 8999, 4612 }, { 15532, 9000, -1 }, { 0, 9001, 4616 }, { 15533, 9002, -1 }, { 0, 9003, 4618 },
+    { 0, 9004, 4619 }, { 0, 9005, 4620 }, { 15533, 9006, -1 }, { 0, 9007, 4623 }, { 15530, 9008, 4624 }, { 0, 9009, 4626 },
+    { 0, 9010, 4628 }, { 0, 9011, 4630 }, { 15535, 9012, -1 }, { 15535, 9013, -1 }, { 0, 9014, 4637 }, { 0, 9015, 4638 },
+    { 0, 9016, 4639 }, { 0, 9017, 4640 }, { 15534, 9019, -1 }, { 0, 9021, 4645 }, { 15540, 9022, -1 }, { 0, 9023, 4647 },
+    { 15537, 9024, 4648 }, { 0, 9029, 4650 }, { 0, 9025, 4651 }, { 15540, 9026, -1 }, { 0, 9027, 4656 }, { 0, 9028, 4657 },
+    { 15542, 9030, -1 }, { 15542, 9031, 4661 }, { 0, 9032, 4666 }, { 15541, 9033, -1 }, { 0, 9034, 4670 }, { 0, 9035, 4671 },
+    { 0, 9036, 4672 }, { 0, 9084, 4673 }, { 15546, 9037, -1 }, { 15546, 9065, -1 }, { 0, 9038, 4676 }, { 0, 9039, 4679 },
+    { 15544, 9040, -1 }, { 0, 9041, 4682 }, { 15548, 9042, -1 }, { 0, 9043, 4689 }, { 0, 9044, 4690 }, { 0, 9045, 4691 },
+    { 0, 9047, 4697 }, { 0, 9066, 4698 }, { 0, 9046, 4699 }, { 0, 9048, 4701 }, { 0, 9049, 4702 }, { 15549, 9050, -1 },
+    { 15548, 9064, -1 }, { 0, 9051, 4705 }, { 15551, 9058, 4706 }, { 0, 9052, 4708 }, { 0, 9053, 4715 }, { 0, 9054, 4721 },
+    { 0, 9055, 4723 }, { 0, 9056, 4724 }, { 0, 9057, 4725 }, { 0, 9059, 4726 }, { 15552, 9060, -1 }, { 0, 9061, 4731 },
+    { 15550, 9062, -1 }, { 0, 9067, 4738 }, { 0, 9068, 4739 }, { 0, 9117, 4740 }, { 0, 9063, 4741 }, { 0, 9069, 4742 },
+    { 0, 9124, 4743 }, { 15552, 9070, -1 }, { 0, 9071, 4747 }, { 15556, 9072, -1 }, { 15558, 9074, 4756 }, { 15555, 9073, -1 },
+    { 0, 9092, 4760 }, { 0, 9128, 4761 }, { 0, 9075, 4763 }, { 0, 9076, 4764 }, { 0, 9096, 4765 }, { 0, 9077, 4766 },
+    { 0, 9100, 4767 }, { 0, 9107, 4769 }, { 0, 9078, 4771 }, { 0, 9080, 4772 }, { 0, 9134, 4774 }, { 0, 9081, 4775 },
+    { 15561, 9104, -1 }, { 15561, 9109, -1 }, { 0, 9100, 4768 }, { 0, 9079, 4778 }, { 15559, 9082, -1 }, { 0, 9089, 4780 },
+    { 0, 9083, 4781 }, { 0, 9085, 4782 }, { 15560, 9097, -1 }, { 0, 9086, 4785 }, { 15566, 9142, -1 }, { 0, 9087, 4787 },
+    { 0, 9073, 4759 }, { 0, 9088, 4788 }, { 0, 9093, 4789 }, { 15564, 9090, -1 }, { 0, 9130, 4791 }, { 0, 9091, 4792 },
+    { 0, 9094, 4794 }, { 0, 9095, 4795 }, { 0, 9098, 4798 }, { 0, 9099, 4799 }, { 0, 9101, 4800 }, { 0, 9080, 4773 },
+    { 0, 9102, 4802 }, { 15567, 9103, -1 }, { 15566, 9105, -1 }, { 0, 9107, 4770 }, { 0, 9106, 4805 }, { 0, 9108, 4808 },
+    { 0, 9110, 4809 }, { 0, 9111, 4810 }, { 15569, 9112, 4817 }, { 0, 9072, 4755 }, { 0, 9113, 4823 }, { 0, 9114, 4827 },
+    { 0, 9115, 4829 }, { 0, 9116, 4831 }, { 0, 9118, 4835 }, { 0, 9128, 4762 }, { 15566, 9119, -1 }, { 0, 9120, 4847 },
+    { 15571, 9121, -1 }, { 15572, 9122, -1 }, { 0, 9123, 4852 }, { 0, 9125, 4853 }, { 15569, 9126, -1 }, { 15575, 9132, -1 },
+    { 0, 9127, 4867 }, { 0, 9135, 4870 }, { 0, 9136, 4872 }, { 0, 9129, 4873 }, { 0, 9131, 4874 }, { 0, 9133, 4876 },
+    { 0, 9137, 4879 }, { 15573, 9138, -1 }, { 0, 9139, 4887 }, { 0, 9140, 4894 }, { 0, 9141, 4900 }, { 15575, 9143, 4910 },
+    { 15578, 9144, -1 }, { 15579, 9145, -1 }, { 0, 9146, 4923 }, { 0, 9147, 4925 }, { 0, 9148, 4936 }, { 0, 9149, 4945 },
+    { 0, 9205, 4946 }, { 0, 9150, 4950 }, { 15579, 9151, -1 }, { 15578, 9152, -1 }, { 0, 9153, 4953 }, { 0, 9164, 4954 },
+    { 0, 9154, 4961 }, { 0, 9155, 4963 }, { 0, 9156, 4964 }, { 0, 9157, 4967 }, { 15575, 9135, -1 }, { 0, 9158, 4977 },
+    { 15582, 9159, -1 }, { 0, 9160, 4993 }, { 0, 9161, 4994 }, { 15583, 9162, -1 }, { 15580, 9189, -1 }, { 0, 9163, 4997 },
+    { 15585, 9165, -1 }, { 15585, 9166, -1 }, { 0, 9167, 5007 }, { 0, 9168, 5008 }, { 15588, 9169, -1 }, { 15588, 9200, -1 },
+    { 0, 9170, 5018 }, { 0, 9171, 5019 }, { 0, 9172, 5020 }, { 0, 9173, 5022 }, { 0, 9174, 5023 }, { 0, 9199, 5024 },
+    { 0, 9175, 5025 }, { 0, 9176, 5026 }, { 15587, 9194, 5027 }, { 0, 9177, 5029 }, { 15589, 9178, -1 }, { 15594, 9195, -1 },
+    { 0, 9179, 5032 }, { 15595, 9180, -1 }, { 0, 9181, 5034 }, { 0, 9182, 5035 }, { 0, 9183, 5037 }, { 15595, 9184, -1 },
+    { 15597, 9185, -1 }, { 0, 9186, 5047 }, { 0, 9187, 5048 }, { 15594, 9188, -1 }, { 15595, 9190, -1 }, { 0, 9191, 5054 },
+    { 0, 9192, 5055 }, { 0, 9207, 5056 }, { 15596, 9193, -1 }, { 0, 9196, 5058 }, { 0, 9197, 5059 }, { 0, 9198, 5060 },
+    { 0, 9201, 5061 }, { 0, 9202, 5063 }, { 0, 9203, 5064 }, { 0, 9204, 5068 }, { 0, 9206, 5069 }, { 0, 9208, 5071 },
+    { 0, 9209, 5075 }, { 0, 9210, 5076 }, { 15597, 9211, -1 }, { 0, 9212, 5079 }, { 0, 9213, 5081 }, { 15602, 9214, 5082 },
+    { 15603, 9215, -1 }, { 0, 9221, 5085 }, { 0, 9243, 5086 }, { 15601, 9216, -1 }, { 0, 9242, 5088 }, { 0, 9252, 5089 },
+    { 0, 9217, 5094 }, { 0, 9252, 5090 }, { 0, 9218, 5096 }, { 15604, 9219, 5097 }, { 0, 9220, 5101 }, { 0, 9222, 5102 },
+    { 0, 9223, 5105 }, { 0, 9224, 5106 }, { 0, 9226, 5107 }, { 0, 9225, 5110 }, { 0, 9227, 5114 }, { 0, 9228, 5116 },
+    { 15605, 9229, -1 }, { 0, 9230, 5120 }, { 0, 9231, 5121 }, { 0, 9232, 5123 }, { 0, 9233, 5125 }, { 0, 9234, 5126 },
+    { 0, 9235, 5127 }, { 0, 9236, 5128 }, { 0, 9237, 5129 }, { 0, 9238, 5131 }, { 0, 9239, 5136 }, { 15603, 9240, -1 },
+    { 0, 9262, 5138 }, { 0, 9241, 5140 }, { 0, 9244, 5141 }, { 15605, 9245, -1 }, { 0, 9246, 5143 }, { 15611, 9247, -1 },
+    { 15612, 9248, 5145 }, { 0, 9276, 5147 }, { 15613, 9297, -1 }, { 15612, 9249, -1 }, { 15610, 9265, -1 }, { 15612, 9250, -1 },
+    { 15616, 9251, -1 }, { 0, 9253, 5153 }, { 0, 9254, 5154 }, { 15617, 9255, -1 }, { 15618, 9256, -1 }, { 0, 9257, 5158 },
+    { 0, 9259, 5159 }, { 0, 9266, 5160 }, { 0, 9269, 5161 }, { 0, 9284, 5162 }, { 15619, 9298, -1 }, { 15621, 9307, -1 },
+    { 0, 9312, 5170 }, { 0, 9314, 5171 }, { 15621, 9258, -1 }, { 15619, 9278, -1 }, { 15624, 9295, -1 }, { 0, 9260, 5175 },
+    { 15625, 9271, -1 }, { 0, 9267, 5177 }, { 15627, 9270, -1 }, { 15626, 9272, -1 }, { 0, 9261, 5180 }, { 15624, 9263, -1 },
+    { 15629, 9264, -1 }, { 0, 9268, 5186 }, { 0, 9273, 5188 }, { 0, 9274, 5189 }, { 0, 9275, 5192 }, { 15630, 9277, -1 },
+    { 0, 9279, 5195 }, { 0, 9298, 5164 }, { 0, 9280, 5198 }, { 0, 9281, 5199 }, { 15627, 9282, -1 }, { 15632, 9283, -1 },
+    { 15630, 9285, -1 }, { 0, 9286, 5207 }, { 15630, 9287, -1 }, { 0, 9288, 5209 }, { 15632, 9290, -1 }, { 0, 9292, 5211 },
+    { 15636, 9315, -1 }, { 0, 9289, 5213 }, { 0, 9291, 5220 }, { 0, 9293, 5221 }, { 0, 9294, 5222 }, { 0, 9296, 5225 },
+    { 0, 9299, 5226 }, { 0, 9300, 5227 }, { 0, 9301, 5228 }, { 0, 9302, 5229 }, { 0, 9303, 5230 }, { 0, 9304, 5232 },
+    { 0, 9305, 5233 }, { 15633, 9306, -1 }, { 0, 9308, 5235 }, { 15638, 9309, 5236 }, { 15638, 9310, -1 }, { 0, 9313, 5239 },
+    { 0, 9317, 5240 }, { 0, 9311, 5241 }, { 0, 9329, 5242 }, { 0, 9344, 5243 }, { 15640, 9318, -1 }, { 0, 9339, 5245 },
+    { 15640, 9340, 5246 }, { 0, 9346, 5248 }, { 0, 9316, 5249 }, { 15641, 9319, -1 }, { 0, 9320, 5251 }, { 15640, 9321, -1 },
+    { 0, 9322, 5254 }, { 0, 9323, 5260 }, { 0, 9324, 5261 }, { 15640, 9325, -1 }, { 0, 9326, 5264 }, { 0, 9327, 5266 },
+    { 15641, 9328, -1 }, { 0, 9330, 5275 }, { 0, 9331, 5276 }, { 0, 9332, 5277 }, { 0, 9341, 5278 }, { 0, 9351, 5279 },
+    { 15643, 9333, -1 }, { 15647, 9352, 5281 }, { 0, 9358, 5283 }, { 0, 9364, 5284 }, { 0, 9334, 5285 }, { 0, 9337, 5286 },
+    { 0, 9342, 5288 }, { 0, 9335, 5293 }, { 0, 9336, 5295 }, { 0, 9338, 5302 }, { 15648, 9343, -1 }, { 15648, 9345, -1 },
+    { 0, 9347, 5306 }, { 0, 9348, 5307 }, { 15650, 9349, -1 }, { 0, 9350, 5319 }, { 0, 9353, 5320 }, { 0, 9381, 5321 },
+    { 0, 9354, 5322 }, { 15648, 9355, -1 }, { 15652, 9356, -1 }, { 15653, 9357, 5326 }, { 0, 9359, 5330 }, { 0, 9360, 5332 },
+    { 0, 9361, 5334 }, { 0, 9362, 5336 }, { 15651, 9363, -1 }, { 15655, 9365, -1 }, { 15656, 9366, -1 }, { 0, 9367, 5341 },
+    { 0, 9368, 5346 }, { 0, 9337, 5287 }, { 15654, 9369, -1 }, { 15657, 9370, -1 }, { 15655, 9375, -1 }, { 0, 9395, 5350 },
+    { 0, 9401, 5351 }, { 0, 9371, 5352 }, { 0, 9372, 5353 }, { 0, 9374, 5354 }, { 15658, 9389, -1 }, { 15657, 9373, 5356 },
+    { 0, 9388, 5358 }, { 0, 9402, 5359 }, { 0, 9376, 5360 }, { 0, 9377, 5361 }, { 0, 9378, 5362 }, { 0, 9427, 5363 },
+    { 0, 9379, 5364 }, { 0, 9380, 5365 }, { 0, 9382, 5366 }, { 0, 9383, 5367 }, { 0, 9384, 5369 }, { 0, 9385, 5375 },
+    { 15661, 9386, 5376 }, { 0, 9387, 5385 }, { 0, 9390, 5387 }, { 0, 9391, 5388 }, { 15663, 9392, 5390 }, { 15663, 9393, -1 },
+    { 0, 9394, 5394 }, { 0, 9387, 5386 }, { 0, 9442, 5395 }, { 0, 9396, 5397 }, { 0, 9397, 5398 }, { 0, 9398, 5402 },
+    { 15663, 9399, -1 }, { 0, 9400, 5408 }, { 0, 9403, 5412 }, { 15664, 9404, -1 }, { 15667, 9405, -1 }, { 15668, 9406, -1 },
+    { 0, 9407, 5422 }, { 0, 9408, 5424 }, { 0, 9409, 5430 }, { 0, 9410, 5431 }, { 15666, 9411, -1 }, { 0, 9412, 5440 },
+    { 0, 9413, 5443 }, { 0, 9414, 5445 }, { 15670, 9415, -1 }, { 0, 9416, 5448 }, { 15667, 9455, -1 }, { 0, 9417, 5451 },
+    { 0, 9418, 5453 }, { 0, 9419, 5454 }, { 0, 9424, 5455 }, { 0, 9474, 5456 }, { 0, 9480, 5457 }, { 0, 9481, 5458 },
+    { 0, 9420, 5459 }, { 0, 9444, 5460 }, { 0, 9421, 5461 }, { 0, 9434, 5462 }, { 15672, 9422, -1 }, { 0, 9465, 5464 },
+    { 0, 9423, 5465 }, { 0, 9441, 5466 }, { 0, 9425, 5468 }, { 0, 9426, 5472 }, { 0, 9428, 5473 }, { 0, 9429, 5474 },
+    { 0, 9430, 5475 }, { 15674, 9432, -1 }, { 0, 9453, 5482 }, { 15675, 9475, -1 }, { 15678, 9431, -1 }, { 0, 9433, 5485 },
+    { 0, 9435, 5487 }, { 0, 9484, 5488 }, { 0, 9436, 5490 }, { 0, 9437, 5496 }, { 15680, 9440, 5499 }, { 15678, 9443, -1 },
+    { 0, 9476, 5505 }, { 0, 9438, 5506 }, { 0, 9470, 5507 }, { 0, 9439, 5508 }, { 15680, 9445, -1 }, { 15683, 9446, -1 },
+    { 15686, 9447, -1 }, { 0, 9448, 5514 }, { 0, 9449, 5516 }, { 0, 9450, 5529 }, { 15686, 9451, -1 }, { 0, 9452, 5532 },
+    { 15688, 9454, -1 }, { 15688, 9487, -1 }, { 0, 9456, 5536 }, { 0, 9457, 5538 }, { 0, 9458, 5540 }, { 0, 9459, 5543 },
+    { 15685, 9460, -1 }, { 15687, 9461, -1 }, { 15688, 9462, -1 }, { 0, 9463, 5547 }, { 0, 9464, 5549 }, { 15690, 9466, -1 },
+    { 0, 9467, 5552 }, { 0, 9468, 5555 }, { 15691, 9469, -1 }, { 15691, 9471, -1 }, { 0, 9472, 5584 }, { 15696, 9473, -1 },
+    { 0, 9502, 5589 }, { 0, 9477, 5590 }, { 0, 9478, 5599 }, { 0, 9479, 5600 }, { 0, 9482, 5601 }, { 0, 9483, 5605 },
+    { 15693, 9485, -1 }, { 0, 9514, 5607 }, { 0, 9486, 5611 }, { 0, 9488, 5613 }, { 0, 9489, 5616 }, { 0, 9492, 5617 },
+    { 0, 9490, 5618 }, { 0, 9491, 5619 }, { 0, 9493, 5623 }, { 0, 9494, 5624 }, { 15697, 9495, -1 }, { 0, 9496, 5637 },
+    { 15699, 9497, -1 }, { 0, 9498, 5640 }, { 0, 9499, 5646 }, { 0, 9500, 5648 }, { 15701, 9501, -1 }, { 0, 9522, 5650 },
+    { 15697, 9524, -1 }, { 0, 9503, 5652 }, { 0, 9504, 5657 }, { 15702, 9505, -1 }, { 15703, 9506, -1 }, { 0, 9507, 5666 },
+    { 0, 9508, 5668 }, { 0, 9509, 5675 }, { 0, 9510, 5676 }, { 15702, 9511, -1 }, { 0, 9512, 5683 }, { 0, 9513, 5684 },
+    { 0, 9515, 5685 }, { 15702, 9516, -1 }, { 0, 9517, 5692 }, { 0, 9518, 5695 }, { 15706, 9519, -1 }, { 0, 9520, 5719 },
+    { 0, 9521, 5726 }, { 0, 9523, 5731 }, { 15704, 9525, -1 }, { 0, 9526, 5743 }, { 0, 9527, 5744 }, { 15708, 9531, -1 },
+    { 0, 9529, 5746 }, { 15709, 9532, -1 }, { 0, 9536, 5749 }, { 0, 9546, 5750 }, { 0, 9528, 5751 }, { 0, 9528, 5752 },
+    { 0, 9539, 5753 }, { 0, 9553, 5754 }, { 0, 9530, 5755 }, { 0, 9547, 5756 }, { 0, 9558, 5757 }, { 0, 9559, 5758 },
+    { 0, 9570, 5759 }, { 0, 9529, 5747 }, { 0, 9571, 5761 }, { 0, 9533, 5762 }, { 0, 9538, 5763 }, { 0, 9541, 5764 },
+    { 0, 9543, 5765 }, { 0, 9578, 5766 }, { 0, 9570, 5760 }, { 15711, 9582, -1 }, { 0, 9534, 5769 }, { 0, 9542, 5770 },
+    { 0, 9535, 5771 }, { 15707, 9582, -1 }, { 15712, 9537, -1 }, { 0, 9540, 5773 }, { 0, 9544, 5781 }, { 15709, 9545, -1 },
+    { 0, 9552, 5787 }, { 0, 9548, 5790 }, { 15713, 9549, -1 }, { 0, 9550, 5795 }, { 0, 9551, 5804 }, { 0, 9555, 5805 },
+    { 0, 9560, 5806 }, { 15711, 9554, -1 }, { 0, 9556, 5814 }, { 0, 9557, 5818 }, { 0, 9561, 5829 }, { 0, 9562, 5833 },
+    { 0, 9563, 5835 }, { 0, 9564, 5836 }, { 0, 9565, 5837 }, { 0, 9566, 5841 }, { 15717, 9567, -1 }, { 0, 9568, 5856 },
+    { 0, 9572, 5857 }, { 0, 9573, 5858 }, { 0, 9575, 5859 }, { 0, 9569, 5860 }, { 0, 9605, 5861 }, { 0, 9574, 5862 },
+    { 0, 9576, 5864 }, { 0, 9580, 5865 }, { 0, 9581, 5866 }, { 0, 9587, 5867 }, { 0, 9596, 5868 }, { 15715, 9567, -1 },
+    { 0, 9577, 5869 }, { 0, 9579, 5873 }, { 0, 9583, 5875 }, { 15716, 9584, -1 }, { 15719, 9585, -1 }, { 15720, 9586, -1 },
+    { 15721, 9633, -1 }, { 0, 9588, 5882 }, { 15721, 9589, -1 }, { 0, 9590, 5884 }, { 15722, 9591, -1 }, { 0, 9592, 5886 },
+    { 0, 9574, 5863 }, { 0, 9593, 5889 }, { 15720, 9594, -1 }, { 0, 9595, 5895 }, { 15725, 9597, -1 }, { 0, 9598, 5897 },
+    { 0, 9599, 5905 }, { 0, 9600, 5911 }, { 15726, 9601, -1 }, { 0, 9602, 5915 }, { 15727, 9603, -1 }, { 0, 9604, 5920 },
+    { 15724, 9606, -1 }, { 15725, 9607, -1 }, { 15726, 9608, 5924 }, { 0, 9609, 5928 }, { 0, 9610, 5930 }, { 0, 9611, 5933 },
+    { 0, 9612, 5934 }, { 15731, 9625, -1 }, { 0, 9613, 5938 }, { 0, 9623, 5939 }, { 15731, 9614, 5951 }, { 0, 9615, 5982 },
+    { 0, 9616, 5983 }, { 0, 9621, 5984 }, { 0, 9621, 5985 }, { 0, 9617, 5986 }, { 0, 9637, 5987 }, { 0, 9655, 5989 },
+    { 0, 9668, 5990 }, { 0, 9618, 5991 }, { 0, 9643, 5992 }, { 0, 9620, 5993 }, { 0, 9634, 5995 }, { 15734, 9619, -1 },
+    { 0, 9622, 5997 }, { 0, 9624, 5999 }, { 0, 9626, 6001 }, { 15734, 9627, -1 }, { 0, 9628, 6005 }, { 0, 9629, 6008 },
+    { 15731, 9630, -1 }, { 15735, 9631, -1 }, { 0, 9632, 6014 }, { 0, 9637, 5988 }, { 0, 9635, 6016 }, { 0, 9636, 6017 },
+    { 15737, 9638, -1 }, { 15739, 9641, -1 }, { 15740, 9639, 6021 }, { 15746, 9647, 6031 }, { 0, 9640, 6049 }, { 0, 9620, 5994 },
+    { 0, 9651, 6050 }, { 15740, 9642, -1 }, { 0, 9644, 6053 }, { 0, 9645, 6055 }, { 15741, 9646, -1 }, { 15751, 9648, -1 },
+    { 0, 9649, 6060 }, { 0, 9650, 6061 }, { 15752, 9652, -1 }, { 0, 9653, 6066 }, { 0, 9654, 6068 }, { 0, 9656, 6069 },
+    { 15753, 9657, 6071 }, { 15754, 9674, -1 }, { 15752, 9658, -1 }, { 0, 9659, 6081 }, { 15755, 9660, -1 }, { 0, 9661, 6083 },
+    { 0, 9662, 6085 }, { 15757, 9663, 6086 }, { 0, 9686, 6088 }, { 15754, 9712, -1 }, { 0, 9664, 6090 }, { 15758, 9665, -1 },
+    { 0, 9666, 6092 }, { 0, 9667, 6095 }, { 0, 9669, 6096 }, { 15760, 9670, -1 }, { 0, 9671, 6098 }, { 15757, 9672, -1 },
+    { 0, 9673, 6101 }, { 0, 9724, 6102 }, { 0, 9675, 6104 }, { 0, 9676, 6105 }, { 15763, 9677, -1 }, { 15759, 9678, -1 },
+    { 0, 9679, 6110 }, { 15765, 9681, 6111 }, { 0, 9680, 6116 }, { 0, 9682, 6122 }, { 0, 9683, 6123 }, { 0, 9685, 6124 },
+    { 0, 9702, 6126 }, { 15767, 9704, -1 }, { 0, 9705, 6128 }, { 0, 9734, 6129 }, { 0, 9685, 6125 }, { 0, 9689, 6130 },
+    { 0, 9691, 6131 }, { 0, 9697, 6132 }, { 0, 9699, 6133 }, { 0, 9715, 6134 }, { 0, 9717, 6135 }, { 0, 9735, 6136 },
+    { 0, 9736, 6137 }, { 15766, 9737, -1 }, { 0, 9738, 6139 }, { 0, 9688, 6140 }, { 0, 9690, 6141 }, { 0, 9694, 6142 },
+    { 0, 9710, 6143 }, { 0, 9726, 6144 }, { 0, 9745, 6145 }, { 0, 9746, 6146 }, { 0, 9692, 6147 }, { 0, 9693, 6148 },
+    { 0, 9707, 6149 }, { 0, 9695, 6150 }, { 15771, 9696, 6151 }, { 0, 9700, 6158 }, { 0, 9716, 6159 }, { 0, 9718, 6161 },
+    { 0, 9752, 6162 }, { 0, 9684, 6163 }, { 15769, 9687, -1 }, { 0, 9698, 6169 }, { 15772, 9701, -1 }, { 15769, 9703, -1 },
+    { 15771, 9706, 6175 }, { 15772, 9725, -1 }, { 0, 9716, 6160 }, { 0, 9708, 6178 }, { 0, 9709, 6179 }, { 15777, 9730, -1 },
+    { 0, 9711, 6181 }, { 0, 9713, 6183 }, { 0, 9714, 6185 }, { 0, 9719, 6189 }, { 0, 9720, 6190 }, { 0, 9721, 6191 },
+    { 0, 9743, 6192 }, { 0, 9744, 6194 }, { 0, 9747, 6195 }, { 0, 9748, 6196 }, { 0, 9750, 6197 }, { 0, 9751, 6198 },
+    { 0, 9754, 6199 }, { 0, 9756, 6201 }, { 0, 9758, 6202 }, { 0, 9760, 6203 }, { 0, 9761, 6204 }, { 0, 9773, 6205 },
+    { 0, 9754, 6200 }, { 0, 9774, 6206 }, { 0, 9783, 6207 }, { 0, 9807, 6208 }, { 0, 9808, 6209 }, { 0, 9775, 6210 },
+    { 0, 9776, 6212 }, { 0, 9778, 6213 }, { 0, 9781, 6214 }, { 0, 9782, 6216 }, { 0, 9784, 6217 }, { 0, 9786, 6218 },
+    { 0, 9790, 6219 }, { 15776, 9796, -1 }, { 0, 9797, 6222 }, { 15780, 9804, -1 }, { 0, 9812, 6224 }, { 0, 9814, 6225 },
+    { 0, 9791, 6226 }, { 0, 9798, 6227 }, { 0, 9801, 6228 }, { 15779, 9806, -1 }, { 0, 9813, 6231 }, { 15782, 9818, -1 },
+    { 15782, 9817, 6232 }, { 0, 9825, 6237 }, { 0, 9775, 6211 }, { 15783, 9827, -1 }, { 0, 9838, 6240 }, { 0, 9781, 6215 },
+    { 0, 9806, 6230 }, { 0, 9844, 6241 }, { 0, 9845, 6242 }, { 0, 9819, 6243 }, { 0, 9821, 6245 }, { 0, 9743, 6193 },
+    { 0, 9817, 6235 }, { 0, 9822, 6246 }, { 0, 9823, 6247 }, { 0, 9824, 6249 }, { 0, 9831, 6250 }, { 15786, 9819, -1 },
+    { 0, 9842, 6252 }, { 0, 9823, 6248 }, { 0, 9855, 6255 }, { 0, 9856, 6256 }, { 0, 9861, 6257 }, { 0, 9872, 6258 },
+    { 0, 9722, 6260 }, { 0, 9729, 6261 }, { 0, 9741, 6262 }, { 0, 9796, 6221 }, { 0, 9749, 6263 }, { 15782, 9757, 6264 },
+    { 0, 9842, 6253 }, { 15788, 9803, -1 }, { 0, 9872, 6259 }, { 0, 9828, 6269 }, { 0, 9841, 6270 }, { 0, 9848, 6272 },
+    { 15789, 9850, -1 }, { 0, 9852, 6274 }, { 15786, 9723, -1 }, { 15791, 9728, 6276 }, { 0, 9727, 6278 }, { 0, 9771, 6279 },
+    { 0, 9800, 6280 }, { 0, 9841, 6271 }, { 0, 9829, 6281 }, { 15791, 9830, -1 }, { 0, 9757, 6266 }, { 15793, 9740, -1 },
+    { 0, 9759, 6285 }, { 0, 9763, 6286 }, { 15794, 9769, 6287 }, { 0, 9831, 6251 }, { 0, 9739, 6289 }, { 0, 9767, 6290 },
+    { 0, 9732, 6291 }, { 0, 9842, 6254 }, { 0, 9779, 6292 }, { 15791, 9731, -1 }, { 0, 9733, 6294 }, { 0, 9742, 6295 },
+    { 15796, 9753, -1 }, { 15797, 9755, -1 }, { 0, 9764, 6298 }, { 15798, 9777, -1 }, { 15799, 9762, -1 }, { 0, 9766, 6301 },
+    { 15799, 9787, -1 }, { 15801, 9789, -1 }, { 0, 9792, 6307 }, { 0, 9793, 6308 }, { 0, 9765, 6310 }, { 0, 9795, 6311 },
+    { 0, 9802, 6312 }, { 0, 9833, 6313 }, { 0, 9834, 6314 }, { 15802, 9849, -1 }, { 0, 9788, 6316 }, { 0, 9837, 6317 },
+    { 0, 9785, 6318 }, { 0, 9809, 6319 }, { 0, 9810, 6321 }, { 0, 9815, 6322 }, { 0, 9835, 6346 }, { 0, 9835, 6347 },
+    { 0, 9809, 6320 }, { 15804, 9835, 6348 }, { 15806, 9836, -1 }, { 0, 9840, 6355 }, { 0, 9853, 6356 }, { 0, 9857, 6357 },
+    { 0, 9864, 6358 }, { 15805, 9867, -1 }, { 0, 9871, 6361 }, { 15810, 9880, -1 }, { 0, 9885, 6363 }, { 0, 9887, 6364 },
+    { 0, 9888, 6366 }, { 0, 9889, 6368 }, { 0, 9901, 6369 }, { 15811, 9907, -1 }, { 0, 9910, 6372 }, { 15809, 9913, 6373 },
+    { 0, 9914, 6375 }, { 0, 9915, 6376 }, { 0, 9847, 6377 }, { 0, 9859, 6378 }, { 0, 9888, 6367 }, { 0, 9907, 6371 },
+    { 0, 9863, 6379 }, { 0, 9867, 6360 }, { 0, 9870, 6380 }, { 0, 9879, 6381 }, { 0, 9882, 6382 }, { 0, 9892, 6383 },
+    { 0, 9902, 6384 }, { 0, 9884, 6385 }, { 0, 9896, 6386 }, { 0, 9898, 6387 }, { 0, 9908, 6388 }, { 0, 9909, 6389 },
+    { 0, 9917, 6391 }, { 0, 9940, 6392 }, { 0, 9943, 6393 }, { 0, 9894, 6394 }, { 0, 9899, 6395 }, { 0, 9919, 6396 },
+    { 0, 9922, 6397 }, { 0, 9923, 6406 }, { 0, 9937, 6407 }, { 0, 9947, 6408 }, { 0, 9895, 6409 }, { 15816, 9920, -1 },
+    { 0, 9924, 6411 }, { 0, 9928, 6412 }, { 0, 9951, 6413 }, { 0, 9955, 6414 }, { 15816, 9768, -1 }, { 0, 9770, 6420 },
+    { 0, 9772, 6421 }, { 15818, 9780, -1 }, { 0, 9955, 6415 }, { 0, 9826, 6438 }, { 0, 9887, 6365 }, { 0, 9862, 6439 },
+    { 0, 9794, 6455 }, { 0, 9858, 6456 }, { 0, 9860, 6457 }, { 0, 9799, 6479 }, { 0, 9805, 6480 }, { 0, 9811, 6481 },
+    { 0, 9816, 6483 }, { 0, 9909, 6390 }, { 0, 9820, 6500 }, { 0, 9868, 6504 }, { 15813, 9922, 6398 }, { 0, 9869, 6505 },
+    { 0, 9897, 6506 }, { 0, 9918, 6507 }, { 0, 9832, 6508 }, { 0, 9839, 6513 }, { 0, 9843, 6514 }, { 0, 9846, 6517 },
+    { 0, 9851, 6523 }, { 0, 9854, 6533 }, { 0, 9865, 6534 }, { 0, 9876, 6535 }, { 0, 9866, 6540 }, { 0, 9873, 6558 },
+    { 0, 9874, 6561 }, { 15817, 9875, -1 }, { 15822, 9877, -1 }, { 0, 9878, 6589 }, { 15818, 9881, -1 }, { 0, 9883, 6623 },
+    { 0, 9904, 6628 }, { 15823, 9911, 6629 }, { 15824, 9912, -1 }, { 15826, 9959, -1 }, { 15826, 9886, -1 }, { 0, 9926, 6637 },
+    { 0, 9890, 6638 }, { 15825, 9891, -1 }, { 0, 9893, 6646 }, { 0, 9900, 6647 }, { 15824, 9903, -1 }, { 0, 9956, 6652 },
+    { 0, 9905, 6653 }, { 0, 9906, 6654 }, { 15829, 9916, -1 }, { 0, 9921, 6658 }, { 15830, 9925, -1 }, { 0, 9927, 6665 },
+    { 0, 9929, 6666 }, { 0, 9930, 6668 }, { 15831, 9931, -1 }, { 0, 9932, 6676 }, { 0, 9933, 6679 }, { 0, 9934, 6701 },
+    { 0, 9935, 6702 }, { 15829, 9936, -1 }, { 0, 9938, 6704 }, { 0, 9939, 6705 }, { 15833, 9941, 6707 }, { 15830, 9942, -1 },
+    { 0, 9944, 6710 }, { 15835, 9945, 6712 }, { 0, 9988, 6714 }, { 15832, 9946, -1 }, { 0, 9948, 6716 }, { 0, 9949, 6719 },
+    { 0, 9950, 6724 }, { 15837, 9952, -1 }, { 0, 9953, 6726 }, { 0, 9954, 6727 }, { 0, 9957, 6730 }, { 0, 9958, 6734 },
+    { 0, 9960, 6735 }, { 15835, 9961, 6736 }, { 0, 9962, 6740 }, { 0, 9968, 6741 }, { 0, 9963, 6745 }, { 0, 9964, 6746 },
+    { 0, 9965, 6747 }, { 15835, 9966, -1 }, { 15839, 10001, -1 }, { 0, 9967, 6750 }, { 0, 9969, 6751 }, { 0, 9971, 6752 },
+    { 0, 9974, 6753 }, { 0, 9970, 6754 }, { 0, 9972, 6755 }, { 0, 10019, 6756 }, { 0, 9973, 6757 }, { 0, 10012, 6758 },
+    { 0, 10026, 6759 }, { 15837, 9975, -1 }, { 0, 9976, 6762 }, { 15840, 10008, -1 }, { 0, 9977, 6764 }, { 0, 9978, 6765 },
+    { 15840, 9979, -1 }, { 15841, 9980, -1 }, { 15843, 9981, 6769 }, { 0, 9982, 6773 }, { 0, 9987, 6774 }, { 0, 9983, 6775 },
+    { 15847, 9985, -1 }, { 15848, 10004, -1 }, { 0, 9984, 6779 }, { 0, 9986, 6781 }, { 0, 9989, 6782 }, { 0, 9990, 6783 },
+    { 15849, 9991, -1 }, { 0, 9992, 6785 }, { 0, 9993, 6786 }, { 0, 9994, 6787 }, { 0, 9995, 6790 }, { 15851, 9996, -1 },
+    { 0, 9997, 6792 }, { 15851, 9998, -1 }, { 15852, 9999, -1 }, { 15853, 10003, -1 }, { 15854, 10007, 6798 }, { 0, 10009, 6807 },
+    { 0, 10022, 6808 }, { 0, 10024, 6809 }, { 0, 10028, 6811 }, { 15855, 10053, 6812 }, { 0, 10002, 6814 }, { 0, 10014, 6815 },
+    { 0, 10034, 6818 }, { 0, 10038, 6819 }, { 15861, 10011, -1 }, { 15860, 10031, -1 }, { 0, 10035, 6822 }, { 15863, 10041, -1 },
+    { 0, 10054, 6824 }, { 0, 9994, 6788 }, { 15862, 10059, 6825 }, { 0, 10060, 6827 }, { 15858, 10014, 6816 }, { 0, 10069, 6828 },
+    { 0, 10000, 6829 }, { 15861, 10013, 6830 }, { 0, 10015, 6832 }, { 0, 10016, 6834 }, { 0, 10015, 6833 }, { 0, 10005, 6836 },
+    { 0, 10006, 6838 }, { 15866, 10010, -1 }, { 0, 10017, 6842 }, { 0, 10018, 6845 }, { 15867, 10037, -1 }, { 15868, 10020, -1 },
+    { 0, 10021, 6851 }, { 15869, 10049, -1 }, { 15870, 10023, -1 }, { 0, 10025, 6856 }, { 0, 10027, 6858 }, { 0, 10056, 6859 },
+    { 0, 10029, 6863 }, { 15871, 10030, -1 }, { 15858, 10024, -1 }, { 15872, 10047, -1 }, { 0, 10032, 6868 }, { 15872, 10033, 6869 },
+    { 0, 10048, 6871 }, { 0, 10036, 6872 }, { 0, 10044, 6873 }, { 0, 10039, 6874 }, { 0, 10040, 6875 }, { 0, 10057, 6876 },
+    { 0, 10042, 6885 }, { 0, 10043, 6886 }, { 0, 10045, 6889 }, { 15875, 10046, -1 }, { 15874, 10050, -1 }, { 0, 10051, 6898 },
+    { 15876, 10052, -1 }, { 0, 10055, 6913 }, { 0, 10058, 6915 }, { 15875, 10061, -1 }, { 15878, 10062, -1 }, { 15880, 10063, -1 },
+    { 0, 10064, 6926 }, { 0, 10065, 6930 }, { 15879, 10070, -1 }, { 0, 10057, 6877 }, { 0, 10073, 6932 }, { 15881, 10085, -1 },
+    { 0, 10114, 6934 }, { 15882, 10066, -1 }, { 0, 10067, 6936 }, { 15884, 10108, -1 }, { 0, 10068, 6938 }, { 15881, 10071, -1 },
+    { 0, 10072, 6946 }, { 0, 10074, 6947 }, { 15882, 10075, -1 }, { 0, 10068, 6939 }, { 15885, 10076, -1 }, { 0, 10077, 6952 },
+    { 15883, 10078, -1 }, { 0, 10079, 6954 }, { 0, 10080, 6955 }, { 0, 10081, 6958 }, { 0, 10082, 6960 }, { 0, 10083, 6961 },
+    { 0, 10091, 6962 }, { 0, 10093, 6963 }, { 0, 10084, 6964 }, { 0, 10086, 6965 }, { 0, 10087, 6966 }, { 15884, 10088, -1 },
+    { 0, 10099, 6975 }, { 0, 10089, 6987 }, { 15885, 10090, -1 }, { 0, 10092, 6996 }, { 0, 10094, 6997 }, { 15888, 10095, -1 },
+    { 0, 10103, 7008 }, { 15891, 10149, -1 }, { 0, 10096, 7011 }, { 0, 10097, 7013 }, { 15888, 10102, -1 }, { 15893, 10100, -1 },
+    { 15890, 10110, -1 }, { 0, 10098, 7031 }, { 0, 10101, 7037 }, { 0, 10104, 7069 }, { 0, 10132, 7070 }, { 15895, 10105, -1 },
+    { 15895, 10106, 7075 }, { 0, 10107, 7078 }, { 0, 10109, 7079 }, { 0, 10111, 7080 }, { 0, 10112, 7081 }, { 0, 10113, 7082 },
+    { 0, 10115, 7083 }, { 0, 10116, 7084 }, { 0, 10117, 7085 }, { 0, 10118, 7087 }, { 15897, 10119, -1 }, { 15897, 10120, -1 },
+    { 0, 10121, 7092 }, { 0, 10103, 7009 }, { 0, 10122, 7093 }, { 0, 10123, 7095 }, { 0, 10124, 7096 }, { 0, 10125, 7114 },
+    { 0, 10126, 7137 }, { 15900, 10127, -1 }, { 15897, 10128, 7164 }, { 15898, 10130, -1 }, { 0, 10133, 7167 }, { 15899, 10134, -1 },
+    { 0, 10155, 7169 }, { 15900, 10129, -1 }, { 15901, 10151, -1 }, { 0, 10131, 7174 }, { 0, 10135, 7195 }, { 0, 10136, 7197 },
+    { 0, 10137, 7202 }, { 0, 10138, 7204 }, { 0, 10139, 7222 }, { 0, 10140, 7223 }, { 15906, 10175, -1 }, { 0, 10141, 7234 },
+    { 0, 10142, 7237 }, { 0, 10143, 7241 }, { 15907, 10144, -1 }, { 15904, 10145, -1 }, { 15909, 10146, 7245 }, { 0, 10147, 7247 },
+    { 15910, 10182, -1 }, { 15907, 10189, -1 }, { 15911, 10148, -1 }, { 0, 10150, 7252 }, { 15912, 10152, -1 }, { 15913, 10153, -1 },
+    { 15912, 10154, -1 }, { 0, 10165, 7256 }, { 15918, 10156, -1 }, { 0, 10157, 7260 }, { 15918, 10179, -1 }, { 15919, 10199, -1 },
+    { 15920, 10158, -1 }, { 0, 10159, 7269 }, { 0, 10160, 7270 }, { 15918, 10161, -1 }, { 0, 10162, 7274 }, { 15922, 10163, 7275 },
+    { 15920, 10164, -1 }, { 15924, 10166, -1 }, { 0, 10168, 7282 }, { 15925, 10167, -1 }, { 0, 10169, 7296 }, { 0, 10206, 7297 },
+    { 15914, 10165, -1 }, { 15923, 10170, -1 }, { 15927, 10171, -1 }, { 15924, 10172, 7300 }, { 0, 10173, 7305 }, { 16014, 10177, -1 },
+    { 16024, 10178, -1 }, { 15976, 10180, -1 }, { 15997, 10181, -1 }, { 16025, 10237, -1 }, { 16033, 10237, -1 }, { 16016, 10237, -1 },
+    { 15981, 10186, -1 }, { 16025, 10187, -1 }, { 16021, 10188, -1 }, { 16024, 10190, -1 }, { 16042, 10191, -1 }, { 16036, 10192, -1 },
+    { 16028, 10193, -1 }, { 15988, 10194, -1 }, { 16023, 10196, -1 }, { 16044, 10197, -1 }, { 16027, 10193, -1 }, { 16021, 10200, -1 },
+    { 16022, 10201, -1 }, { 15991, 10202, -1 }, { 16037, 10207, -1 }, { 16038, 10208, -1 }, { 16050, 10209, -1 }, { 16041, 10211, -1 },
+    { 16042, 10214, -1 }, { 16042, 10216, -1 }, { 16043, 10217, -1 }, { 16046, 10218, -1 }, { 16046, 10220, -1 }, { 16055, 10276, -1 },
+    { 16048, 10226, -1 }, { 16049, 10227, -1 }, { 16010, 10228, -1 }, { 16053, 10230, -1 }, { 16039, 10231, -1 }, { 16011, 10233, -1 },
+    { 16065, 10233, -1 }, { 16052, 10233, -1 }, { 16015, 10233, -1 }, { 16028, 10233, -1 }, { 16021, 10234, -1 }, { 16060, 10235, -1 },
+    { 16072, 10236, -1 }, { 16024, 10239, -1 }, { 16077, 10239, -1 }, { 16064, 10239, -1 }, { 16027, 10239, -1 }, { 16040, 10239, -1 },
+    { 16071, 10240, -1 }, { 16083, 10243, -1 }, { 16034, 10244, -1 }, { 16047, 10245, -1 }, { 16095, 10246, -1 }, { 16040, 10247, -1 },
+    { 16095, 10249, -1 }, { 16084, 10271, -1 }, { 16091, 10251, -1 }, { 16094, 10247, -1 }, { 16085, 10252, -1 }, { 16067, 10254, -1 },
+    { 16085, 10255, -1 }, { 16047, 10256, -1 }, { 16069, 10283, -1 }, { 16106, 10260, -1 }, { 16098, 10261, -1 }, { 16045, 10266, -1 },
+    { 16109, 10267, -1 }, { 16091, 10272, -1 }, { 16109, 10273, -1 }, { 16076, 10274, -1 }, { 16059, 10275, -1 }, { 16116, 10277, -1 },
+    { 16059, 10292, -1 }, { 16098, 10298, -1 }, { 16112, 10303, -1 }, { 16091, 10304, -1 }, { 16114, 10306, -1 }, { 16117, 10308, -1 },
+    { 16088, 10309, -1 }, { 16108, 10310, -1 }, { 16112, 10316, -1 }, { 16112, 10323, -1 }, { 16113, 10324, -1 }, { 16125, 10327, -1 },
+    { 16109, 10328, -1 }, { 16127, 10329, -1 }, { 16120, 10332, -1 }, { 16076, 10332, -1 }, { 16122, 10332, -1 }, { 16083, 10333, -1 },
+    { 16136, 10332, -1 }, { 16133, 10334, -1 }, { 16108, 10336, -1 }, { 16124, 10337, -1 }, { 16136, 10339, -1 }, { 16129, 10377, -1 },
+    { 16087, 10340, -1 }, { 16143, 10340, -1 }, { 16126, 10340, -1 }, { 16089, 10340, -1 }, { 16105, 10340, -1 }, { 16132, 10341, -1 },
+    { 16097, 10345, -1 }, { 16097, 10346, -1 }, { 16133, 10348, -1 }, { 16101, 10354, -1 }, { 16133, 10354, -1 }, { 16128, 10355, -1 },
+    { 16156, 10363, -1 }, { 16156, 10365, -1 }, { 16135, 10366, -1 }, { 16147, 10367, -1 }, { 16152, 10368, -1 }, { 16110, 10370, -1 },
+    { 16152, 10373, -1 }, { 16153, 10374, -1 }, { 16155, 10382, -1 }, { 16151, 10383, -1 }, { 16168, 10383, -1 }, { 16154, 10384, -1 },
+    { 16160, 10386, -1 }, { 16159, 10388, -1 }, { 16164, 10389, -1 }, { 16155, 10391, -1 }, { 16156, 10392, -1 }, { 16159, 10394, -1 },
+    { 16160, 10395, -1 }, { 16148, 10397, -1 }, { 16168, 10400, -1 }, { 16170, 10401, -1 }, { 16169, 10402, -1 }, { 16163, 10403, -1 },
+    { 16155, 10404, -1 }, { 16135, 10405, -1 }, { 16130, 10406, -1 }, { 16143, 10407, -1 }, { 16168, 10412, -1 }, { 16169, 10408, -1 },
+    { 16134, 10409, -1 }, { 16185, 10410, -1 }, { 16166, 10411, -1 }, { 16150, 10413, -1 }, { 16193, 10411, -1 }, { 16194, 10414, -1 },
+    { 16200, 10450, -1 }, { 16144, 10415, -1 }, { 16172, 10416, -1 }, { 16160, 10418, -1 }, { 16145, 10420, -1 }, { 16150, 10419, -1 },
+    { 16146, 10421, -1 }, { 16149, 10422, -1 }, { 16151, 10423, -1 }, { 16162, 10428, -1 }, { 16181, 10428, -1 }, { 16159, 10424, -1 },
+    { 16189, 10424, -1 }, { 16207, 10428, -1 }, { 16212, 10427, -1 }, { 16180, 10424, -1 }, { 16167, 10430, -1 }, { 16167, 10429, -1 },
+    { 16175, 10432, -1 }, { 16221, 10441, -1 }, { 16162, 10433, -1 }, { 16163, 10434, -1 }, { 16172, 10435, -1 }, { 16178, 10436, -1 },
+    { 16176, 10438, -1 }, { 16169, 10478, -1 }, { 16176, 10439, -1 }, { 16183, 10440, -1 }, { 16220, 10442, -1 }, { 16177, 10443, -1 },
+    { 16231, 10445, -1 }, { 16223, 10443, -1 }, { 16232, 10446, -1 }, { 16173, 10443, -1 }, { 16210, 10454, -1 }, { 16191, 10448, -1 },
+    { 16180, 10452, -1 }, { 16227, 10453, -1 }, { 16186, 10456, -1 }, { 16234, 10456, -1 }, { 16219, 10457, -1 }, { 16230, 10456, -1 },
+    { 16224, 10458, -1 }, { 16227, 10459, -1 }, { 16211, 10460, -1 }, { 16193, 10462, -1 }, { 16222, 10463, -1 }, { 16196, 10466, -1 },
+    { 16226, 10467, -1 }, { 16238, 10472, -1 }, { 16239, 10473, -1 }, { 16242, 10476, -1 }, { 16237, 10480, -1 }, { 16246, 10490, -1 },
+    { 16233, 10491, -1 }, { 16245, 10492, -1 }, { 16199, 10494, -1 }, { 16247, 10498, -1 }, { 16248, 10499, -1 }, { 16254, 10492, -1 },
+    { 16236, 10500, -1 }, { 16266, 10508, -1 }, { 16206, 10519, -1 }, { 16261, 10523, -1 }, { 16262, 10524, -1 }, { 16262, 10525, -1 },
+    { 16245, 10526, -1 }, { 16265, 10530, -1 }, { 16258, 10531, -1 }, { 16241, 10532, -1 }, { 16249, 10534, -1 }, { 16258, 10536, -1 },
+    { 16277, 10538, -1 }, { 16230, 10539, -1 }, { 16251, 10540, -1 }, { 16276, 10541, -1 }, { 16275, 10542, -1 }, { 16254, 10543, -1 },
+    { 16268, 10545, -1 }, { 16276, 10554, -1 }, { 16228, 10556, -1 }, { 16284, 10574, -1 }, { 16232, 10581, -1 }, { 16254, 10663, -1 },
+    { 16283, 10670, -1 }, { 16269, 10674, -1 }, { 16236, 10676, -1 }, { 16262, 10682, -1 }, { 16242, 10683, -1 }, { 16238, 10686, -1 },
+    { 16287, 10688, -1 }, { 16289, 10689, -1 }, { 16293, 10697, -1 }, { 16240, 10703, -1 }, { 16248, 10707, -1 }, { 16264, 10708, -1 },
+    { 16241, 10712, -1 }, { 16282, 10717, -1 }, { 16303, 10718, -1 }, { 16292, 10722, -1 }, { 16287, 10722, -1 }, { 16301, 10728, -1 },
+    { 16286, 10731, -1 }, { 16299, 10735, -1 }, { 16295, 10742, -1 }, { 16296, 10743, -1 }, { 16310, 10744, -1 }, { 16285, 10760, -1 },
+    { 16300, 10748, -1 }, { 16260, 10749, -1 }, { 16310, 10750, -1 }, { 16302, 10756, -1 }, { 16303, 10757, -1 }, { 16304, 10759, -1 },
+    { 16265, 10762, -1 }, { 16308, 10763, -1 }, { 16315, 10764, -1 }, { 16315, 10764, -1 }, { 16286, 10764, -1 }, { 16314, 10774, -1 },
+    { 16268, 10775, -1 }, { 16313, 10777, -1 }, { 16314, 10778, -1 }, { 16316, 10779, -1 }, { 16271, 10782, -1 }, { 16325, 10784, -1 },
+    { 16318, 10789, -1 }, { 16309, 10796, -1 }, { 16333, 10799, -1 }, { 16312, 10810, -1 }, { 16319, 10800, -1 }, { 16308, 10826, -1 },
+    { 16332, 10846, -1 }, { 16330, 10849, -1 }, { 16284, 10851, -1 }, { 16290, 10875, -1 }, { 16334, 10849, -1 }, { 16299, 10852, -1 },
+    { 16298, 10853, -1 }, { 16333, 10856, -1 }, { 16319, 10891, -1 }, { 16309, 10861, -1 }, { 16295, 10876, -1 }, { 16344, 10881, -1 },
+    { 16311, 10884, -1 }, { 16347, 10861, -1 }, { 16338, 10886, -1 }, { 16339, 10887, -1 }, { 16349, 10888, -1 }, { 16300, 10889, -1 },
+    { 16303, 10900, -1 }, { 16312, 10914, -1 }, { 16300, 10917, -1 }, { 16355, 10923, -1 }, { 16345, 10924, -1 }, { 16346, 10925, -1 },
+    { 16333, 10917, -1 }, { 16307, 10926, -1 }, { 16360, 10927, -1 }, { 16335, 10930, -1 }, { 16340, 10943, -1 }, { 16314, 10929, -1 },
+    { 16348, 10926, -1 }, { 16342, 10933, -1 }, { 16364, 10934, -1 }, { 16362, 10936, -1 }, { 16366, 10938, -1 }, { 16375, 10939, -1 },
+    { 16360, 10940, -1 }, { 16362, 10947, -1 }, { 16343, 10955, -1 }, { 16350, 10966, -1 }, { 16364, 10961, -1 }, { 16374, 10962, -1 },
+    { 16354, 10974, -1 }, { 16363, 10992, -1 }, { 16366, 10995, -1 }, { 16367, 10996, -1 }, { 16371, 11006, -1 }, { 16331, 11009, -1 },
+    { 16373, 11010, -1 }, { 16339, 11012, -1 }, { 16368, 11023, -1 }, { 16378, 11024, -1 }, { 16342, 11030, -1 }, { 16335, 11031, -1 },
+    { 16343, 11032, -1 }, { 16375, 11031, -1 }, { 16368, 11035, -1 }, { 16371, 11035, -1 }, { 16391, 11038, -1 }, { 16383, 11040, -1 },
+    { 16384, 11041, -1 }, { 16365, 11045, -1 }, { 16387, 11046, -1 }, { 16379, 11047, -1 }, { 16348, 11045, -1 }, { 16389, 11048, -1 },
+    { 16350, 11050, -1 }, { 16391, 11054, -1 }, { 16372, 11055, -1 }, { 16391, 11056, -1 }, { 16352, 11059, -1 }, { 16400, 11062, -1 },
+    { 16397, 11063, -1 }, { 16395, 11064, -1 }, { 16356, 11065, -1 }, { 16416, 11066, -1 }, { 16396, 11065, -1 }, { 16392, 11067, -1 },
+    { 16390, 11070, -1 }, { 16394, 11071, -1 }, { 16375, 11073, -1 }, { 16391, 11075, -1 }, { 16362, 11076, -1 }, { 16413, 11091, -1 },
+    { 16366, 11099, -1 }, { 16407, 11100, -1 }, { 16367, 11102, -1 }, { 16397, 11104, -1 }, { 16402, 11149, -1 }, { 16423, 11114, -1 },
+    { 16419, 11119, -1 }, { 16417, 11117, -1 }, { 16406, 11124, -1 }, { 16376, 11126, -1 }, { 16408, 11136, -1 }, { 16429, 11142, -1 },
+    { 16380, 11148, -1 }, { 16381, 11153, -1 }, { 16432, 11157, -1 }, { 16412, 11157, -1 }, { 16423, 11165, -1 }, { 16435, 11166, -1 },
+    { 16436, 11170, -1 }, { 16429, 11173, -1 }, { 16398, 11175, -1 }, { 16398, 11176, -1 }, { 16412, 11179, -1 }, { 16438, 11173, -1 },
+    { 16441, 11180, -1 }, { 16442, 11181, -1 }, { 16445, 11183, -1 }, { 16440, 11183, -1 }, { 16420, 11231, -1 }, { 16439, 11185, -1 },
+    { 16450, 11188, -1 }, { 16428, 11193, -1 }, { 16444, 11203, -1 }, { 16456, 11198, -1 }, { 16453, 11205, -1 }, { 16460, 11205, -1 },
+    { 16398, 11207, -1 }, { 16447, 11214, -1 }, { 16457, 11220, -1 }, { 16430, 11238, -1 }, { 16445, 11239, -1 }, { 16409, 11240, -1 },
+    { 16409, 11243, -1 }, { 16461, 11244, -1 }, { 16451, 11246, -1 }, { 16412, 11247, -1 }, { 16438, 11249, -1 }, { 16435, 11253, -1 },
+    { 16454, 11255, -1 }, { 16473, 11256, -1 }, { 16466, 11258, -1 }, { 16420, 11259, -1 }, { 16461, 11259, -1 }, { 16444, 11260, -1 },
+    { 16419, 11261, -1 }, { 16416, 11259, -1 }, { 16467, 11263, -1 }, { 16468, 11266, -1 }, { 16439, 11267, -1 }, { 16479, 11271, -1 },
+    { 16430, 11280, -1 }, { 16475, 11280, -1 }, { 16472, 11272, -1 }, { 16474, 11274, -1 }, { 16449, 11272, -1 }, { 16475, 11275, -1 },
+    { 16484, 11283, -1 }, { 16464, 11284, -1 }, { 16485, 11285, -1 }, { 16487, 11285, -1 }, { 16478, 11287, -1 }, { 16482, 11291, -1 },
+    { 16440, 11294, -1 }, { 16463, 11317, -1 }, { 16496, 11318, -1 }, { 16483, 11319, -1 }, { 16457, 11320, -1 }, { 16440, 11324, -1 },
+    { 16441, 11328, -1 }, { 16447, 11331, -1 }, { 16448, 11334, -1 }, { 16483, 11334, -1 }, { 16508, 11365, -1 }, { 16453, 11337, -1 },
+    { 16453, 11339, -1 }, { 16499, 11340, -1 }, { 16490, 11343, -1 }, { 16507, 11350, -1 }, { 16456, 11351, -1 }, { 16510, 11355, -1 },
+    { 16501, 11356, -1 }, { 16505, 11360, -1 }, { 16513, 11361, -1 }, { 16473, 11363, -1 }, { 16506, 11367, -1 }, { 16512, 11363, -1 },
+    { 16465, 11368, -1 }, { 16509, 11371, -1 }, { 16472, 11376, -1 }, { 16471, 11394, -1 }, { 16502, 11398, -1 }, { 16523, 11418, -1 },
+    { 16516, 11419, -1 }, { 16525, 11420, -1 }, { 16484, 11423, -1 }, { 16478, 11425, -1 }, { 16502, 11428, -1 }, { 16518, 11428, -1 },
+    { 16529, 11434, -1 }, { 16476, 11440, -1 }, { 16525, 11441, -1 }, { 16524, 11443, -1 }, { 16525, 11444, -1 }, { 16523, 11446, -1 },
+    { 16485, 11447, -1 }, { 16539, 11447, -1 }, { 16527, 11448, -1 }, { 16483, 11450, -1 }, { 16532, 11451, -1 }, { 16492, 11454, -1 },
+    { 16493, 11454, -1 }, { 16546, 11454, -1 }, { 16518, 11456, -1 }, { 16504, 11454, -1 }, { 16550, 11454, -1 }, { 16497, 11457, -1 },
+    { 16535, 11457, -1 }, { 16498, 11457, -1 }, { 16557, 11457, -1 }, { 16539, 11457, -1 }, { 16542, 11461, -1 }, { 16548, 11464, -1 },
+    { 16562, 11469, -1 }, { 16503, 11475, -1 }, { 16511, 11478, -1 }, { 16509, 11479, -1 }, { 16535, 11483, -1 }, { 16547, 11486, -1 },
+    { 16557, 11479, -1 }, { 16510, 11485, -1 }, { 16556, 11485, -1 }, { 16541, 11485, -1 }, { 16513, 11485, -1 }, { 16545, 11491, -1 },
+    { 16561, 11493, -1 }, { 16528, 11495, -1 }, { 16570, 11496, -1 }, { 16516, 11497, -1 }, { 16572, 11498, -1 }, { 16566, 11499, -1 },
+    { 16562, 11501, -1 }, { 16564, 11502, -1 }, { 16522, 11506, -1 }, { 16571, 11509, -1 }, { 16571, 11515, -1 }, { 16581, 11516, -1 },
+    { 16581, 11517, -1 }, { 16577, 11515, -1 }, { 16553, 11520, -1 }, { 16563, 11525, -1 }, { 16572, 11527, -1 }, { 16576, 11533, -1 },
+    { 16562, 11540, -1 }, { 16573, 11542, -1 }, { 16576, 11543, -1 }, { 16589, 11545, -1 }, { 16556, 11543, -1 }, { 16578, 11549, -1 },
+    { 16578, 11551, -1 }, { 16571, 11552, -1 }, { 16591, 11565, -1 }, { 16571, 11581, -1 }, { 16546, 11590, -1 }, { 16592, 11592, -1 },
+    { 16552, 11595, -1 }, { 16589, 11600, -1 }, { 16550, 11601, -1 }, { 16596, 11602, -1 }, { 16597, 11603, -1 }, { 16607, 11604, -1 },
+    { 16611, 11608, -1 }, { 16578, 11601, -1 }, { 16601, 11609, -1 }, { 16558, 11610, -1 }, { 16609, 11611, -1 }, { 16602, 11612, -1 },
+    { 16592, 11609, -1 }, { 16567, 11615, -1 }, { 16618, 11616, -1 }, { 16609, 11617, -1 }, { 16606, 11618, -1 }, { 16617, 11619, -1 },
+    { 16569, 11620, -1 }, { 16609, 11621, -1 }, { 16614, 11622, -1 }, { 16614, 11624, -1 }, { 16614, 11626, -1 }, { 16603, 11627, -1 },
+    { 16617, 11628, -1 }, { 16620, 11629, -1 }, { 16605, 11629, -1 }, { 16579, 11630, -1 }, { 16622, 11631, -1 }, { 16624, 11636, -1 },
+    { 16625, 11639, -1 }, { 16625, 11641, -1 }, { 16619, 11631, -1 }, { 16588, 11642, -1 }, { 16620, 11650, -1 }, { 16638, 11680, -1 },
+    { 16597, 11679, -1 }, { 16609, 11659, -1 }, { 16631, 11661, -1 }, { 16646, 11666, -1 }, { 16626, 11699, -1 }, { 16635, 11698, -1 },
+    { 16628, 11702, -1 }, { 16591, 11704, -1 }, { 16649, 11705, -1 }, { 16596, 11707, -1 }, { 16594, 11708, -1 }, { 16649, 11710, -1 },
+    { 16600, 11711, -1 }, { 16658, 11714, -1 }, { 16597, 11721, -1 }, { 16636, 11724, -1 }, { 16660, 11731, -1 }, { 16646, 11737, -1 },
+    { 16630, 11739, -1 }, { 16631, 11740, -1 }, { 16602, 11745, -1 }, { 16649, 11746, -1 }, { 16654, 11747, -1 }, { 16652, 11748, -1 },
+    { 16656, 11749, -1 }, { 16616, 11750, -1 }, { 16658, 11754, -1 }, { 16628, 11755, -1 }, { 16623, 11758, -1 }, { 16669, 11759, -1 },
+    { 16670, 11762, -1 }, { 16649, 11771, -1 }, { 16621, 11778, -1 }, { 16667, 11781, -1 }, { 16674, 11782, -1 }, { 16649, 11783, -1 },
+    { 16665, 11783, -1 }, { 16669, 11784, -1 }, { 16628, 11786, -1 }, { 16630, 11787, -1 }, { 16674, 11791, -1 }, { 16678, 11787, -1 },
+    { 16674, 11787, -1 }, { 16627, 11787, -1 }, { 16684, 11792, -1 }, { 16632, 11795, -1 }, { 16675, 11796, -1 }, { 16687, 11797, -1 },
+    { 16666, 11798, -1 }, { 16683, 11800, -1 }, { 16636, 11803, -1 }, { 16637, 11804, -1 }, { 16649, 11806, -1 }, { 16691, 11855, -1 },
+    { 16698, 11810, -1 }, { 16687, 11825, -1 }, { 16656, 11827, -1 }, { 16687, 11831, -1 }, { 16703, 11834, -1 }, { 16679, 11835, -1 },
+    { 16682, 11835, -1 }, { 16661, 11836, -1 }, { 16652, 11837, -1 }, { 16699, 11844, -1 }, { 16697, 11846, -1 }, { 16698, 11847, -1 },
+    { 16699, 11848, -1 }, { 16658, 11851, -1 }, { 16688, 11852, -1 }, { 16691, 11854, -1 }, { 16662, 11856, -1 }, { 16690, 11858, -1 },
+    { 16705, 11859, -1 }, { 16658, 11861, -1 }, { 16715, 11865, -1 }, { 16709, 11867, -1 }, { 16666, 11869, -1 }, { 16690, 11898, -1 },
+    { 16717, 11869, -1 }, { 16670, 11870, -1 }, { 16719, 11921, -1 }, { 16720, 11877, -1 }, { 16671, 11901, -1 }, { 16679, 11902, -1 },
+    { 16674, 11903, -1 }, { 16675, 11907, -1 }, { 16725, 11909, -1 }, { 16694, 11922, -1 }, { 16729, 11924, -1 }, { 16687, 11932, -1 },
+    { 16712, 11935, -1 }, { 16711, 11934, -1 }, { 16726, 11937, -1 }, { 16686, 11942, -1 }, { 16734, 11939, -1 }, { 16724, 11939, -1 },
+    { 16695, 11946, -1 }, { 16743, 11948, -1 }, { 16720, 11964, -1 }, { 16691, 11972, -1 }, { 16693, 11971, -1 }, { 16693, 11978, -1 },
+    { 16736, 11983, -1 }, { 16748, 12010, -1 }, { 16696, 11985, -1 }, { 16718, 11985, -1 }, { 16736, 12010, -1 }, { 16728, 11988, -1 },
+    { 16748, 11994, -1 }, { 16741, 11997, -1 }, { 16756, 12001, -1 }, { 16755, 12002, -1 }, { 16752, 12007, -1 }, { 16733, 12008, -1 },
+    { 16758, 12015, -1 }, { 16746, 12029, -1 }, { 16745, 12017, -1 }, { 16713, 12021, -1 }, { 16738, 12025, -1 }, { 16721, 12049, -1 },
+    { 16732, 12044, -1 }, { 16713, 12046, -1 }, { 16754, 12054, -1 }, { 16711, 12060, -1 }, { 16766, 12061, -1 }, { 16759, 12062, -1 },
+    { 16731, 12062, -1 }, { 16720, 12067, -1 }, { 16721, 12125, -1 }, { 16768, 12071, -1 }, { 16739, 12071, -1 }, { 16766, 12071, -1 },
+    { 16749, 12071, -1 }, { 16776, 12071, -1 }, { 16728, 12094, -1 }, { 16780, 12074, -1 }, { 16741, 12080, -1 }, { 16784, 12088, -1 },
+    { 16781, 12090, -1 }, { 16762, 12093, -1 }, { 16776, 12096, -1 }, { 16730, 12099, -1 }, { 16784, 12104, -1 }, { 16786, 12108, -1 },
+    { 16734, 12112, -1 }, { 16760, 12104, -1 }, { 16794, 12120, -1 }, { 16783, 12121, -1 }, { 16785, 12124, -1 }, { 16745, 12126, -1 },
+    { 16745, 12127, -1 }, { 16794, 12130, -1 }, { 16804, 12131, -1 }, { 16791, 12134, -1 }, { 16792, 12135, -1 }, { 16747, 12136, -1 },
+    { 16753, 12143, -1 }, { 16750, 12145, -1 }, { 16796, 12146, -1 }, { 16749, 12143, -1 }, { 16753, 12147, -1 }, { 16791, 12148, -1 },
+    { 16763, 12157, -1 }, { 16801, 12193, -1 }, { 16755, 12202, -1 }, { 16778, 12204, -1 }, { 16793, 12205, -1 }, { 16764, 12206, -1 },
+    { 16773, 12210, -1 }, { 16769, 12213, -1 }, { 16830, 12213, -1 }, { 16878, 12213, -1 }, { 16836, 12213, -1 }, { 16852, 12213, -1 },
+    { 16909, 12213, -1 }, { 16785, 12214, -1 }, { 16809, 12215, -1 }, { 16804, 12217, -1 }, { 16819, 12218, -1 }, { 16837, 12225, -1 },
+    { 16778, 12230, -1 }, { 16789, 12233, -1 }, { 16841, 12234, -1 }, { 16845, 12235, -1 }, { 16847, 12236, -1 }, { 16804, 12237, -1 },
+    { 16865, 12238, -1 }, { 16860, 12239, -1 }, { 16864, 12242, -1 }, { 16871, 12243, -1 }, { 16859, 12245, -1 }, { 16874, 12247, -1 },
+    { 16828, 12249, -1 }, { 16829, 12250, -1 }, { 16874, 12245, -1 }, { 16834, 12256, -1 }, { 16880, 12258, -1 }, { 16862, 12263, -1 },
+    { 16855, 12274, -1 }, { 16898, 12277, -1 }, { 16902, 12280, -1 }, { 16910, 12285, -1 }, { 16889, 12286, -1 }, { 16896, 12290, -1 },
+    { 16865, 12293, -1 }, { 16867, 12294, -1 }, { 16912, 12298, -1 }, { 16919, 12298, -1 }, { 16906, 12298, -1 }, { 16859, 12298, -1 },
+    { 16913, 12299, -1 }, { 16914, 12301, -1 }, { 16887, 12308, -1 }, { 16918, 12319, -1 }, { 16890, 12301, -1 }, { 16923, 12321, -1 },
+    { 16923, 12322, -1 }, { 16923, 12323, -1 }, { 16928, 12346, -1 }, { 16929, 12328, -1 }, { 16946, 12333, -1 }, { 16902, 12336, -1 },
+    { 16922, 12347, -1 }, { 16936, 12353, -1 }, { 16917, 12355, -1 }, { 16920, 12359, -1 }, { 16943, 12365, -1 }, { 16947, 12373, -1 },
+    { 16935, 12384, -1 }, { 16950, 12385, -1 }, { 16958, 12386, -1 }, { 16959, 12388, -1 }, { 16915, 12393, -1 }, { 16938, 12397, -1 },
+    { 16933, 12398, -1 }, { 16934, 12399, -1 }, { 16942, 12402, -1 }, { 16942, 12404, -1 }, { 16907, 12421, -1 }, { 16935, 12427, -1 },
+    { 16937, 12429, -1 }, { 16966, 12438, -1 }, { 16916, 12440, -1 }, { 16913, 12438, -1 }, { 16921, 12438, -1 }, { 16959, 12447, -1 },
+    { 16962, 12452, -1 }, { 16974, 12453, -1 }, { 16949, 12454, -1 }, { 16972, 12456, -1 }, { 16923, 12457, -1 }, { 16924, 12458, -1 },
+    { 16966, 12459, -1 }, { 16947, 12460, -1 }, { 16968, 12461, -1 }, { 16966, 12472, -1 }, { 16972, 12475, -1 }, { 16981, 12482, -1 },
+    { 16970, 12486, -1 }, { 16945, 12490, -1 }, { 16978, 12494, -1 }, { 16975, 12498, -1 }, { 16974, 12499, -1 }, { 16935, 12502, -1 },
+    { 16934, 12507, -1 }, { 16983, 12507, -1 }, { 16972, 12507, -1 }, { 16986, 12508, -1 }, { 16994, 12507, -1 }, { 16976, 12507, -1 },
+    { 16985, 12509, -1 }, { 16948, 12510, -1 }, { 16997, 12512, -1 }, { 16999, 12512, -1 }, { 16988, 12512, -1 }, { 16990, 12513, -1 },
+    { 16996, 12514, -1 }, { 16950, 12515, -1 }, { 16990, 12516, -1 }, { 16964, 12517, -1 }, { 16953, 12518, -1 }, { 16995, 12522, -1 },
+    { 16973, 12523, -1 }, { 16972, 12560, -1 }, { 17017, 12549, -1 }, { 16966, 12531, -1 }, { 16978, 12537, -1 }, { 16996, 12541, -1 },
+    { 17005, 12581, -1 }, { 17004, 12551, -1 }, { 17016, 12570, -1 }, { 17013, 12558, -1 }, { 17016, 12563, -1 }, { 17021, 12565, -1 },
+    { 17012, 12567, -1 }, { 17001, 12578, -1 }, { 16985, 12584, -1 }, { 16976, 12585, -1 }, { 16978, 12590, -1 }, { 16980, 12592, -1 },
+    { 17015, 12593, -1 }, { 17024, 12594, -1 }, { 17026, 12595, -1 }, { 16986, 12597, -1 }, { 17014, 12598, -1 }, { 17037, 12599, -1 },
+    { 17032, 12603, -1 }, { 16990, 12609, -1 }, { 16991, 12611, -1 }, { 17011, 12612, -1 }, { 17034, 12613, -1 }, { 17036, 12614, -1 },
+    { 17036, 12616, -1 }, { 17019, 12619, -1 }, { 16997, 12622, -1 }, { 16997, 12628, -1 }, { 16999, 12633, -1 }, { 16996, 12636, -1 },
+    { 17050, 12637, -1 }, { 17043, 12640, -1 }, { 17043, 12641, -1 }, { 17012, 12642, -1 }, { 17039, 12644, -1 }, { 17015, 12645, -1 },
+    { 17031, 12647, -1 }, { 17047, 12647, -1 }, { 17048, 12654, -1 }, { 17060, 12656, -1 }, { 17061, 12658, -1 }, { 17029, 12660, -1 },
+    { 17061, 12663, -1 }, { 17036, 12665, -1 }, { 17046, 12668, -1 }, { 17058, 12672, -1 }, { 17060, 12673, -1 }, { 17046, 12674, -1 },
+    { 17019, 12675, -1 }, { 17041, 12679, -1 }, { 17071, 12704, -1 }, { 17043, 12680, -1 }, { 17027, 12681, -1 }, { 17073, 12682, -1 },
+    { 17055, 12683, -1 }, { 17036, 12682, -1 }, { 17026, 12685, -1 }, { 17077, 12687, -1 }, { 17029, 12689, -1 }, { 17053, 12693, -1 },
+    { 17080, 12694, -1 }, { 17046, 12696, -1 }, { 17029, 12698, -1 }, { 17045, 12699, -1 }, { 17070, 12701, -1 }, { 17034, 12706, -1 },
+    { 17043, 12721, -1 }, { 17062, 12721, -1 }, { 17078, 12721, -1 }, { 17068, 12722, -1 }, { 17069, 12728, -1 }, { 17084, 12730, -1 },
+    { 17072, 12731, -1 }, { 17075, 12731, -1 }, { 17051, 12732, -1 }, { 17040, 12733, -1 }, { 17081, 12734, -1 }, { 17098, 12738, -1 },
+    { 17061, 12739, -1 }, { 17059, 12743, -1 }, { 17093, 12744, -1 }, { 17078, 12746, -1 }, { 17089, 12749, -1 }, { 17083, 12760, -1 },
+    { 17098, 12764, -1 }, { 17097, 12769, -1 }, { 17064, 12776, -1 }, { 17064, 12778, -1 }, { 17059, 12779, -1 }, { 17065, 12782, -1 },
+    { 17098, 12788, -1 }, { 17103, 12791, -1 }, { 17058, 12793, -1 }, { 17114, 12796, -1 }, { 17067, 12800, -1 }, { 17116, 12803, -1 },
+    { 17110, 12811, -1 }, { 17069, 12812, -1 }, { 17112, 12815, -1 }, { 17074, 12821, -1 }, { 17082, 12811, -1 }, { 17100, 12831, -1 },
+    { 17123, 12833, -1 }, { 17106, 12841, -1 }, { 17125, 12847, -1 }, { 17076, 12850, -1 }, { 17078, 12854, -1 }, { 17121, 12856, -1 },
+    { 17110, 12857, -1 }, { 17112, 12861, -1 }, { 17112, 12862, -1 }, { 17113, 12864, -1 }, { 17133, 12869, -1 }, { 17092, 12872, -1 },
+    { 17134, 12877, -1 }, { 17137, 12880, -1 }, { 17142, 12872, -1 }, { 17089, 12881, -1 }, { 17131, 12885, -1 }, { 17125, 12890, -1 },
+    { 17095, 12894, -1 }, { 17100, 12895, -1 }, { 17135, 12898, -1 }, { 17095, 12899, -1 }, { 17108, 12900, -1 }, { 17128, 12906, -1 },
+    { 17101, 12907, -1 }, { 17126, 12910, -1 }, { 17110, 12915, -1 }, { 17101, 12918, -1 }, { 17099, 12915, -1 }, { 17141, 12918, -1 },
+    { 17139, 12915, -1 }, { 17103, 12919, -1 }, { 17144, 12924, -1 }, { 17143, 12919, -1 }, { 17109, 12931, -1 }, { 17108, 12933, -1 },
+    { 17116, 12935, -1 }, { 17160, 12936, -1 }, { 17156, 12937, -1 }, { 17140, 12943, -1 }, { 17147, 12953, -1 }, { 17156, 12954, -1 },
+    { 17132, 12961, -1 }, { 17122, 12970, -1 }, { 17156, 12973, -1 }, { 17119, 12977, -1 }, { 17160, 12978, -1 }, { 17116, 12983, -1 },
+    { 17171, 12985, -1 }, { 17166, 12991, -1 }, { 17131, 12999, -1 }, { 17170, 13001, -1 }, { 17126, 13002, -1 }, { 17184, 13003, -1 },
+    { 17138, 13004, -1 }, { 17183, 13005, -1 }, { 17169, 13006, -1 }, { 17162, 13007, -1 }, { 17173, 13008, -1 }, { 17180, 13019, -1 },
+    { 17137, 13022, -1 }, { 17185, 13023, -1 }, { 17186, 13028, -1 }, { 17139, 13029, -1 }, { 17169, 13030, -1 }, { 17180, 13032, -1 },
+    { 17138, 13036, -1 }, { 17151, 13038, -1 }, { 17197, 13042, -1 }, { 17189, 13058, -1 }, { 17176, 13060, -1 }, { 17193, 13036, -1 },
+    { 17198, 13063, -1 }, { 17169, 13064, -1 }, { 17194, 13067, -1 }, { 17166, 13074, -1 }, { 17164, 13077, -1 }, { 17205, 13091, -1 },
+    { 17159, 13102, -1 }, { 17151, 13103, -1 }, { 17206, 13104, -1 }, { 17167, 13116, -1 }, { 17182, 13117, -1 }, { 17198, 13117, -1 },
+    { 17203, 13120, -1 }, { 17211, 13125, -1 }, { 17190, 13126, -1 }, { 17175, 13127, -1 }, { 17203, 13129, -1 }, { 17193, 13137, -1 },
+    { 17170, 13138, -1 }, { 17206, 13139, -1 }, { 17207, 13140, -1 }, { 17186, 13143, -1 }, { 17199, 13156, -1 }, { 17172, 13165, -1 },
+    { 17215, 13207, -1 }, { 17185, 13165, -1 }, { 17216, 13167, -1 }, { 17217, 13168, -1 }, { 17188, 13174, -1 }, { 17177, 13175, -1 },
+    { 17198, 13190, -1 }, { 17229, 13192, -1 }, { 17222, 13194, -1 }, { 17231, 13196, -1 }, { 17224, 13200, -1 }, { 17194, 13202, -1 },
+    { 17208, 13204, -1 }, { 17224, 13204, -1 }, { 17182, 13205, -1 }, { 17219, 13206, -1 }, { 17237, 13208, -1 }, { 17189, 13209, -1 },
+    { 17232, 13213, -1 }, { 17199, 13214, -1 }, { 17189, 13217, -1 }, { 17194, 13221, -1 }, { 17237, 13263, -1 }, { 17207, 13221, -1 },
+    { 17238, 13223, -1 }, { 17239, 13224, -1 }, { 17226, 13231, -1 }, { 17251, 13232, -1 }, { 17228, 13233, -1 }, { 17243, 13234, -1 },
+    { 17239, 13235, -1 }, { 17242, 13237, -1 }, { 17254, 13239, -1 }, { 17254, 13244, -1 }, { 17249, 13245, -1 }, { 17260, 13246, -1 },
+    { 17230, 13244, -1 }, { 17246, 13244, -1 }, { 17259, 13245, -1 }, { 17250, 13247, -1 }, { 17236, 13248, -1 }, { 17255, 13250, -1 },
+    { 17260, 13257, -1 }, { 17247, 13270, -1 }, { 17223, 13256, -1 }, { 17264, 13250, -1 }, { 17253, 13256, -1 }, { 17241, 13256, -1 },
+    { 17272, 13271, -1 }, { 17274, 13272, -1 }, { 17250, 13274, -1 }, { 17280, 13275, -1 }, { 17245, 13280, -1 }, { 17267, 13281, -1 },
+    { 17268, 13282, -1 }, { 17228, 13280, -1 }, { 17272, 13284, -1 }, { 17279, 13286, -1 }, { 17273, 13287, -1 }, { 17232, 13289, -1 },
+    { 17241, 13290, -1 }, { 17254, 13291, -1 }, { 17284, 13323, -1 }, { 17285, 13292, -1 }, { 17245, 13293, -1 }, { 17279, 13295, -1 },
+    { 17234, 13297, -1 }, { 17281, 13298, -1 }, { 17283, 13299, -1 }, { 17274, 13304, -1 }, { 17300, 13310, -1 }, { 17294, 13326, -1 },
+    { 17275, 13304, -1 }, { 17295, 13332, -1 }, { 17296, 13333, -1 }, { 17281, 13335, -1 }, { 17285, 13341, -1 }, { 17288, 13343, -1 },
+    { 17274, 13345, -1 }, { 17272, 13346, -1 }, { 17306, 13369, -1 }, { 17254, 13372, -1 }, { 17301, 13374, -1 }, { 17283, 13374, -1 },
+    { 17299, 13374, -1 }, { 17281, 13374, -1 }, { 17308, 13375, -1 }, { 17259, 13379, -1 }, { 17261, 13382, -1 }, { 17262, 13384, -1 },
+    { 17275, 13388, -1 }, { 17298, 13390, -1 }, { 17308, 13394, -1 }, { 17317, 13382, -1 }, { 17298, 13395, -1 }, { 17266, 13400, -1 },
+    { 17270, 13402, -1 }, { 17314, 13404, -1 }, { 17314, 13407, -1 }, { 17322, 13410, -1 }, { 17308, 13411, -1 }, { 17327, 13413, -1 },
+    { 17275, 13418, -1 }, { 17319, 13419, -1 }, { 17312, 13422, -1 }, { 17302, 13424, -1 }, { 17322, 13433, -1 }, { 17275, 13434, -1 },
+    { 17324, 13436, -1 }, { 17295, 13444, -1 }, { 17321, 13446, -1 }, { 17291, 13453, -1 }, { 17287, 13455, -1 }, { 17308, 13455, -1 },
+    { 17293, 13456, -1 }, { 17288, 13455, -1 }, { 17344, 13457, -1 }, { 17289, 13455, -1 }, { 17296, 13470, -1 }, { 17340, 13471, -1 },
+    { 17348, 13474, -1 }, { 17349, 13478, -1 }, { 17302, 13480, -1 }, { 17300, 13485, -1 }, { 17359, 13495, -1 }, { 17310, 13496, -1 },
+    { 17347, 13502, -1 }, { 17356, 13510, -1 }, { 17318, 13512, -1 }, { 17350, 13513, -1 }, { 17359, 13516, -1 }, { 17309, 13517, -1 },
+    { 17352, 13546, -1 }, { 17366, 13525, -1 }, { 17311, 13529, -1 }, { 17355, 13530, -1 }, { 17310, 13531, -1 }, { 17322, 13538, -1 },
+    { 17341, 13539, -1 }, { 17360, 13548, -1 }, { 17361, 13551, -1 }, { 17370, 13552, -1 }, { 17364, 13554, -1 }, { 17371, 13555, -1 },
+    { 17324, 13558, -1 }, { 17336, 13558, -1 }, { 17332, 13558, -1 }, { 17322, 13559, -1 }, { 17382, 13568, -1 }, { 17345, 13558, -1 },
+    { 17368, 13570, -1 }, { 17330, 13571, -1 }, { 17380, 13573, -1 }, { 17361, 13577, -1 }, { 17327, 13578, -1 }, { 17364, 13581, -1 },
+    { 17364, 13582, -1 }, { 17366, 13586, -1 }, { 17389, 13598, -1 }, { 17356, 13601, -1 }, { 17352, 13602, -1 }, { 17396, 13605, -1 },
+    { 17391, 13611, -1 }, { 17374, 13620, -1 }, { 17396, 13631, -1 }, { 17367, 13611, -1 }, { 17375, 13635, -1 }, { 17347, 13637, -1 },
+    { 17350, 13638, -1 }, { 17349, 13640, -1 }, { 17387, 13641, -1 }, { 17391, 13642, -1 }, { 17403, 13643, -1 }, { 17405, 13644, -1 },
+    { 17392, 13647, -1 }, { 17351, 13648, -1 }, { 17366, 13654, -1 }, { 17359, 13655, -1 }, { 17412, 13658, -1 }, { 17395, 13655, -1 },
+    { 17419, 13659, -1 }, { 17357, 13660, -1 }, { 17406, 13662, -1 }, { 17359, 13664, -1 }, { 17374, 13665, -1 }, { 17389, 13667, -1 },
+    { 17411, 13668, -1 }, { 17411, 13673, -1 }, { 17420, 13678, -1 }, { 17371, 13679, -1 }, { 17391, 13680, -1 }, { 17423, 13682, -1 },
+    { 17384, 13684, -1 }, { 17416, 13686, -1 }, { 17426, 13699, -1 }, { 17377, 13701, -1 }, { 17380, 13702, -1 }, { 17375, 13708, -1 },
+    { 17375, 13710, -1 }, { 17435, 13713, -1 }, { 17378, 13715, -1 }, { 17433, 13719, -1 }, { 17412, 13722, -1 }, { 17429, 13728, -1 },
+    { 17416, 13729, -1 }, { 17440, 13738, -1 }, { 17390, 13739, -1 }, { 17441, 13742, -1 }, { 17432, 13747, -1 }, { 17391, 13748, -1 },
+    { 17392, 13749, -1 }, { 17447, 13754, -1 }, { 17394, 13755, -1 }, { 17404, 13756, -1 }, { 17392, 13760, -1 }, { 17431, 13761, -1 },
+    { 17428, 13762, -1 }, { 17397, 13768, -1 }, { 17429, 13769, -1 }, { 17429, 13782, -1 }, { 17444, 13786, -1 }, { 17415, 13787, -1 },
+    { 17434, 13794, -1 }, { 17453, 13797, -1 }, { 17426, 13798, -1 }, { 17449, 13799, -1 }, { 17417, 13804, -1 }, { 17452, 13808, -1 },
+    { 17460, 13810, -1 }, { 17423, 13822, -1 }, { 17408, 13831, -1 }, { 17465, 13831, -1 }, { 17457, 13833, -1 }, { 17411, 13831, -1 },
+    { 17418, 13834, -1 }, { 17448, 13831, -1 }, { 17416, 13840, -1 }, { 17461, 13840, -1 }, { 17433, 13840, -1 }, { 17460, 13841, -1 },
+    { 17440, 13846, -1 }, { 17470, 13847, -1 }, { 17425, 13848, -1 }, { 17467, 13852, -1 }, { 17423, 13854, -1 }, { 17469, 13855, -1 },
+    { 17468, 13860, -1 }, { 17476, 13852, -1 }, { 17469, 13861, -1 }, { 17470, 13862, -1 }, { 17456, 13865, -1 }, { 17437, 13868, -1 },
+    { 17484, 13869, -1 }, { 17477, 13871, -1 }, { 17486, 13878, -1 }, { 17466, 13888, -1 }, { 17482, 13890, -1 }, { 17438, 13894, -1 },
+    { 17490, 13896, -1 }, { 17491, 13899, -1 }, { 17494, 13900, -1 }, { 17474, 13905, -1 }, { 17468, 13909, -1 }, { 17486, 13912, -1 },
+    { 17478, 13916, -1 }, { 17458, 13919, -1 }, { 17491, 13921, -1 }, { 17446, 13941, -1 }, { 17470, 13945, -1 }, { 17451, 13946, -1 },
+    { 17502, 13949, -1 }, { 17466, 13952, -1 }, { 17482, 13957, -1 }, { 17456, 13966, -1 }, { 17454, 13979, -1 }, { 17463, 13983, -1 },
+    { 17499, 13984, -1 }, { 17500, 13985, -1 }, { 17506, 13986, -1 }, { 17483, 13988, -1 }, { 17490, 13990, -1 }, { 17514, 13994, -1 },
+    { 17474, 13996, -1 }, { 17478, 14000, -1 }, { 17509, 14002, -1 }, { 17518, 14004, -1 }, { 17519, 14005, -1 }, { 17500, 14006, -1 },
+    { 17515, 14011, -1 }, { 17500, 14014, -1 }, { 17471, 14027, -1 }, { 17517, 14031, -1 }, { 17503, 14034, -1 }, { 17510, 14035, -1 },
+    { 17477, 14040, -1 }, { 17477, 14041, -1 }, { 17480, 14042, -1 }, { 17544, 14047, -1 }, { 17496, 14050, -1 }, { 17530, 14042, -1 },
+    { 17531, 14042, -1 }, { 17540, 14042, -1 }, { 17486, 14043, -1 }, { 17540, 14043, -1 }, { 17519, 14043, -1 }, { 17527, 14043, -1 },
+    { 17545, 14043, -1 }, { 17542, 14043, -1 }, { 17494, 14051, -1 }, { 17529, 14054, -1 }, { 17541, 14058, -1 }, { 17542, 14059, -1 },
+    { 17526, 14060, -1 }, { 17504, 14062, -1 }, { 17546, 14065, -1 }, { 17533, 14067, -1 }, { 17541, 14069, -1 }, { 17548, 14073, -1 },
+    { 17547, 14075, -1 }, { 17512, 14080, -1 }, { 17569, 14081, -1 }, { 17516, 14083, -1 }, { 17515, 14083, -1 }, { 17521, 14089, -1 },
+    { 17528, 14101, -1 }, { 17523, 14120, -1 }, { 17541, 14083, -1 }, { 17523, 14114, -1 }, { 17533, 14114, -1 }, { 17568, 14122, -1 },
+    { 17577, 14123, -1 }, { 17582, 14114, -1 }, { 17548, 14124, -1 }, { 17580, 14125, -1 }, { 17582, 14129, -1 }, { 17551, 14161, -1 },
+    { 17533, 14163, -1 }, { 17582, 14169, -1 }, { 17537, 14172, -1 }, { 17568, 14171, -1 }, { 17585, 14175, -1 }, { 17564, 14172, -1 },
+    { 17543, 14189, -1 }, { 17579, 14201, -1 }, { 17593, 14175, -1 }, { 17567, 14203, -1 }, { 17568, 14208, -1 }, { 17584, 14210, -1 },
+    { 17570, 14211, -1 }, { 17557, 14217, -1 }, { 17572, 14219, -1 }, { 17597, 14222, -1 }, { 17581, 14229, -1 }, { 17604, 14232, -1 },
+    { 17573, 14233, -1 }, { 17598, 14235, -1 }, { 17600, 14236, -1 }, { 17615, 14238, -1 }, { 17602, 14238, -1 }, { 17555, 14238, -1 },
+    { 17604, 14239, -1 }, { 17588, 14247, -1 }, { 17611, 14257, -1 }, { 17580, 14257, -1 }, { 17570, 14258, -1 }, { 17592, 14258, -1 },
+    { 17594, 14263, -1 }, { 17579, 14265, -1 }, { 17612, 14271, -1 }, { 17603, 14273, -1 }, { 17629, 14326, -1 }, { 17626, 14326, -1 },
+    { 17619, 14326, -1 }, { 17627, 14303, -1 }, { 17634, 14326, -1 }, { 17634, 14308, -1 }, { 17615, 14311, -1 }, { 17628, 14341, -1 },
+    { 17583, 14342, -1 }, { 17633, 14344, -1 }, { 17626, 14347, -1 }, { 17637, 14348, -1 }, { 17587, 14349, -1 }, { 17640, 14350, -1 },
+    { 17609, 14353, -1 }, { 17647, 14356, -1 }, { 17602, 14360, -1 }, { 17601, 14362, -1 }, { 17634, 14366, -1 }, { 17618, 14371, -1 },
+    { 17637, 14374, -1 }, { 17624, 14375, -1 }, { 17639, 14377, -1 }, { 17648, 14379, -1 }, { 17640, 14383, -1 }, { 17611, 14389, -1 },
+    { 17651, 14395, -1 }, { 17608, 14396, -1 }, { 17633, 14407, -1 }, { 17641, 14409, -1 }, { 17644, 14412, -1 }, { 17648, 14413, -1 },
+    { 17607, 14414, -1 }, { 17645, 14414, -1 }, { 17651, 14418, -1 }, { 17652, 14419, -1 }, { 17663, 14424, -1 }, { 17614, 14429, -1 },
+    { 17664, 14431, -1 }, { 17668, 14432, -1 }, { 17654, 14433, -1 }, { 17664, 14434, -1 }, { 17668, 14434, -1 }, { 17650, 14434, -1 },
+    { 17645, 14434, -1 }, { 17677, 14474, -1 }, { 17663, 14439, -1 }, { 17657, 14452, -1 }, { 17629, 14444, -1 }, { 17662, 14445, -1 },
+    { 17683, 14447, -1 }, { 17630, 14450, -1 }, { 17652, 14455, -1 }, { 17685, 14461, -1 }, { 17685, 14464, -1 }, { 17687, 14465, -1 },
+    { 17657, 14467, -1 }, { 17690, 14468, -1 }, { 17681, 14473, -1 }, { 17682, 14475, -1 }, { 17686, 14477, -1 }, { 17644, 14487, -1 },
+    { 17657, 14488, -1 }, { 17688, 14490, -1 }, { 17682, 14493, -1 }, { 17704, 14494, -1 }, { 17646, 14495, -1 }, { 17660, 14498, -1 },
+    { 17644, 14501, -1 }, { 17645, 14503, -1 }, { 17651, 14505, -1 }, { 17703, 14507, -1 }, { 17699, 14510, -1 }, { 17701, 14512, -1 },
+    { 17696, 14514, -1 }, { 17697, 14525, -1 }, { 17687, 14528, -1 }, { 17697, 14531, -1 }, { 17713, 14533, -1 }, { 17701, 14536, -1 },
+    { 17690, 14537, -1 }, { 17714, 14538, -1 }, { 17693, 14543, -1 }, { 17714, 14544, -1 }, { 17719, 14554, -1 }, { 17692, 14555, -1 },
+    { 17690, 14544, -1 }, { 17671, 14563, -1 }, { 17699, 14564, -1 }, { 17672, 14565, -1 }, { 17673, 14567, -1 }, { 17702, 14569, -1 },
+    { 17725, 14570, -1 }, { 17719, 14578, -1 }, { 17678, 14582, -1 }, { 17706, 14583, -1 }, { 17721, 14584, -1 }, { 17725, 14586, -1 },
+    { 17679, 14587, -1 }, { 17693, 14588, -1 }, { 17713, 14590, -1 }, { 17713, 14591, -1 }, { 17710, 14592, -1 }, { 17699, 14610, -1 },
+    { 17687, 14594, -1 }, { 17730, 14596, -1 }, { 17699, 14597, -1 }, { 17733, 14598, -1 }, { 17736, 14601, -1 }, { 17746, 14603, -1 },
+    { 17743, 14604, -1 }, { 17737, 14605, -1 }, { 17738, 14607, -1 }, { 17729, 14611, -1 }, { 17698, 14612, -1 }, { 17727, 14613, -1 },
+    { 17743, 14615, -1 }, { 17752, 14616, -1 }, { 17723, 14617, -1 }, { 17708, 14618, -1 }, { 17722, 14619, -1 }, { 17715, 14620, -1 },
+    { 17714, 14621, -1 }, { 17768, 14622, -1 }, { 17766, 14623, -1 }, { 17721, 14624, -1 }, { 17757, 14625, -1 }, { 17751, 14620, -1 },
+    { 17760, 14626, -1 }, { 17761, 14627, -1 }, { 17760, 14628, -1 }, { 17744, 14632, -1 }, { 17764, 14629, -1 }, { 17734, 14619, -1 },
+    { 17715, 14630, -1 }, { 17767, 14631, -1 }, { 17745, 14633, -1 }, { 17746, 14634, -1 }, { 17762, 14635, -1 }, { 17768, 14636, -1 },
+    { 17769, 14637, -1 }, { 17739, 14638, -1 }, { 17743, 14639, -1 }, { 17736, 14640, -1 }, { 17773, 14641, -1 }, { 17774, 14642, -1 },
+    { 17783, 14643, -1 }, { 17772, 14644, -1 }, { 17702, 14619, -1 }, { 17776, 14645, -1 }, { 17778, 14646, -1 }, { 17779, 14647, -1 },
+    { 17791, 14648, -1 }, { 17789, 14649, -1 }, { 17762, 14650, -1 }, { 17791, 14651, -1 }, { 17748, 14619, -1 }, { 17773, 14652, -1 },
+    { 17749, 14653, -1 }, { 17766, 14654, -1 }, { 17772, 14655, -1 }, { 17806, 14655, -1 }, { 17755, 14654, -1 }, { 17798, 14656, -1 },
+    { 17778, 14657, -1 }, { 17798, 14658, -1 }, { 17782, 14652, -1 }, { 17787, 14652, -1 }, { 17805, 14659, -1 }, { 17787, 14660, -1 },
+    { 17763, 14661, -1 }, { 17780, 14662, -1 }, { 17786, 14663, -1 }, { 17820, 14663, -1 }, { 17769, 14662, -1 }, { 17791, 14664, -1 },
+    { 17817, 14665, -1 }, { 17774, 14666, -1 }, { 17796, 14660, -1 }, { 17801, 14660, -1 }, { 17812, 14667, -1 }, { 17814, 14668, -1 },
+    { 17814, 14669, -1 }, { 17774, 14673, -1 }, { 17823, 14670, -1 }, { 17813, 14671, -1 }, { 17831, 14672, -1 }, { 17822, 14674, -1 },
+    { 17785, 14675, -1 }, { 17800, 14676, -1 }, { 17785, 14677, -1 }, { 17784, 14678, -1 }, { 17795, 14679, -1 }, { 17826, 14680, -1 },
+    { 17811, 14681, -1 }, { 17798, 14682, -1 }, { 17778, 14652, -1 }, { 17776, 14652, -1 }, { 17833, 14683, -1 }, { 17779, 14684, -1 },
+    { 17836, 14685, -1 }, { 17799, 14686, -1 }, { 17803, 14687, -1 }, { 17840, 14688, -1 }, { 17816, 14689, -1 }, { 17836, 14690, -1 },
+    { 17802, 14691, -1 }, { 17838, 14692, -1 }, { 17792, 14660, -1 }, { 17790, 14660, -1 }, { 17840, 14693, -1 }, { 17790, 14694, -1 },
+    { 17823, 14695, -1 }, { 17838, 14696, -1 }, { 17842, 14697, -1 }, { 17843, 14698, -1 }, { 17809, 14699, -1 }, { 17836, 14700, -1 },
+    { 17820, 14692, -1 }, { 17832, 14701, -1 }, { 17830, 14702, -1 }, { 17853, 14703, -1 }, { 17861, 14704, -1 }, { 17849, 14706, -1 },
+    { 17860, 14704, -1 }, { 17868, 14705, -1 }, { 17859, 14707, -1 }, { 17832, 14708, -1 }, { 17842, 14709, -1 }, { 17862, 14710, -1 },
+    { 17858, 14711, -1 }, { 17870, 14712, -1 }, { 17828, 14714, -1 }, { 17845, 14715, -1 }, { 17874, 14717, -1 }, { 17852, 14713, -1 },
+    { 17834, 14715, -1 }, { 17851, 14716, -1 }, { 17886, 14716, -1 }, { 17876, 14718, -1 }, { 17857, 14719, -1 }, { 17868, 14720, -1 },
+    { 17846, 14721, -1 }, { 17825, 14702, -1 }, { 17861, 14713, -1 }, { 17866, 14713, -1 }, { 17843, 14722, -1 }, { 17854, 14723, -1 },
+    { 17845, 14724, -1 }, { 17884, 14725, -1 }, { 17863, 14726, -1 }, { 17867, 14727, -1 }, { 17868, 14728, -1 }, { 17889, 14729, -1 },
+    { 17887, 14730, -1 }, { 17888, 14731, -1 }, { 17886, 14732, -1 }, { 17873, 14733, -1 }, { 17843, 14734, -1 }, { 17902, 14735, -1 },
+    { 17901, 14736, -1 }, { 17894, 14737, -1 }, { 17902, 14738, -1 }, { 17887, 14739, -1 }, { 17888, 14740, -1 }, { 17845, 14706, -1 },
+    { 17805, 14702, -1 }, { 17889, 14741, -1 }, { 17890, 14742, -1 }, { 17865, 14743, -1 }, { 17901, 14744, -1 }, { 17843, 14704, -1 },
+    { 17902, 14745, -1 }, { 17886, 14746, -1 }, { 17857, 14713, -1 }, { 17855, 14713, -1 }, { 17862, 14747, -1 }, { 17867, 14748, -1 },
+    { 17884, 14749, -1 }, { 17919, 14750, -1 }, { 17871, 14751, -1 }, { 17862, 14752, -1 }, { 17874, 14753, -1 }, { 17897, 14754, -1 },
+    { 17912, 14755, -1 }, { 17911, 14756, -1 }, { 17877, 14758, -1 }, { 17868, 14757, -1 }, { 17922, 14759, -1 }, { 17900, 14760, -1 },
+    { 17901, 14761, -1 }, { 17899, 14762, -1 }, { 17906, 14763, -1 }, { 17911, 14764, -1 }, { 17918, 14765, -1 }, { 17906, 14766, -1 },
+    { 17898, 14767, -1 }, { 17909, 14768, -1 }, { 17924, 14769, -1 }, { 17885, 14770, -1 }, { 17931, 14773, -1 }, { 17916, 14771, -1 },
+    { 17884, 14772, -1 }, { 17883, 14775, -1 }, { 17920, 14774, -1 }, { 17898, 14776, -1 }, { 17925, 14777, -1 }, { 17949, 14778, -1 },
+    { 17875, 14762, -1 }, { 17948, 14779, -1 }, { 17927, 14780, -1 }, { 17891, 14781, -1 }, { 17927, 14782, -1 }, { 17906, 14783, -1 },
+    { 17955, 14784, -1 }, { 17926, 14785, -1 }, { 17953, 14786, -1 }, { 17939, 14787, -1 }, { 17902, 14788, -1 }, { 17951, 14789, -1 },
+    { 17942, 14791, -1 }, { 17906, 14793, -1 }, { 17916, 14790, -1 }, { 17956, 14792, -1 }, { 17944, 14794, -1 }, { 17947, 14795, -1 },
+    { 17937, 14796, -1 }, { 17906, 14797, -1 }, { 17925, 14798, -1 }, { 17958, 14799, -1 }, { 17926, 14801, -1 }, { 17951, 14800, -1 },
+    { 17928, 14802, -1 }, { 17913, 14803, -1 }, { 17940, 14804, -1 }, { 17936, 14805, -1 }, { 17958, 14799, -1 }, { 17945, 14806, -1 },
+    { 17977, 14807, -1 }, { 17919, 14808, -1 }, { 17968, 14809, -1 }, { 17969, 14810, -1 }, { 17921, 14811, -1 }, { 17954, 14812, -1 },
+    { 17979, 14813, -1 }, { 17983, 14814, -1 }, { 17946, 14815, -1 }, { 17977, 14819, -1 }, { 17967, 14816, -1 }, { 17977, 14817, -1 },
+    { 17978, 14818, -1 }, { 17959, 14820, -1 }, { 17994, 14821, -1 }, { 17961, 14822, -1 }, { 17984, 14823, -1 }, { 17985, 14824, -1 },
+    { 17950, 14825, -1 }, { 17996, 14826, -1 }, { 17989, 14827, -1 }, { 17985, 14828, -1 }, { 17963, 14829, -1 }, { 18000, 14830, -1 },
+    { 17974, 14831, -1 }, { 17978, 14832, -1 }, { 17982, 14825, -1 }, { 17984, 14833, -1 }, { 17974, 14834, -1 }, { 17961, 14835, -1 },
+    { 17998, 14836, -1 }, { 17963, 14837, -1 }, { 18002, 14838, -1 }, { 17965, 14839, -1 }, { 18000, 14840, -1 }, { 17987, 14841, -1 },
+    { 17958, 14842, -1 }, { 17968, 14843, -1 }, { 18006, 14844, -1 }, { 17996, 14845, -1 }, { 18007, 14846, -1 }, { 17993, 14847, -1 },
+    { 17966, 14848, -1 }, { 18012, 14849, -1 }, { 18011, 14850, -1 }, { 18026, 14851, -1 }, { 17974, 14852, -1 }, { 17993, 14853, -1 },
+    { 17982, 14854, -1 }, { 17990, 14855, -1 }, { 18012, 14856, -1 }, { 18011, 14850, -1 }, { 18009, 14857, -1 }, { 17974, 14858, -1 },
+    { 18028, 14859, -1 }, { 17978, 14860, -1 }, { 17984, 14861, -1 }, { 17985, 14862, -1 }, { 17989, 14863, -1 }, { 18025, 14864, -1 },
+    { 18026, 14865, -1 }, { 18008, 14866, -1 }, { 18008, 14867, -1 }, { 17993, 14868, -1 }, { 18027, 14869, -1 }, { 18033, 14870, -1 },
+    { 18032, 14871, -1 }, { 18033, 14872, -1 }, { 18034, 14873, -1 }, { 18047, 14874, -1 }, { 18044, 14875, -1 }, { 18028, 14876, -1 },
+    { 18052, 14877, -1 }, { 18036, 14878, -1 }, { 18050, 14879, -1 }, { 18050, 14880, -1 }, { 18009, 14881, -1 }, { 18008, 14882, -1 },
+    { 18053, 14883, -1 }, { 18041, 14884, -1 }, { 18049, 14885, -1 }, { 18045, 14886, -1 }, { 18008, 14887, -1 }, { 18018, 14888, -1 },
+    { 18012, 14889, -1 }, { 18036, 14890, -1 }, { 18025, 14891, -1 }, { 18062, 14892, -1 }, { 18033, 14893, -1 }, { 18060, 14896, -1 },
+    { 18060, 14894, -1 }, { 18045, 14895, -1 }, { 18057, 14897, -1 }, { 18023, 14878, -1 }, { 18054, 14898, -1 }, { 18044, 14899, -1 },
+    { 18041, 14900, -1 }, { 18053, 14901, -1 }, { 18064, 14905, -1 }, { 18078, 14902, -1 }, { 18051, 14903, -1 }, { 18058, 14904, -1 },
+    { 18068, 14906, -1 }, { 18069, 14907, -1 }, { 18052, 14908, -1 }, { 18035, 14909, -1 }, { 18034, 14910, -1 }, { 18066, 14911, -1 },
+    { 18084, 14912, -1 }, { 18039, 14916, -1 }, { 18078, 14913, -1 }, { 18060, 14914, -1 }, { 18061, 14915, -1 }, { 18076, 14917, -1 },
+    { 18063, 14922, -1 }, { 18083, 14918, -1 }, { 18056, 14919, -1 }, { 18060, 14920, -1 }, { 18098, 14921, -1 }, { 18062, 14923, -1 },
+    { 18082, 14924, -1 }, { 18057, 14925, -1 }, { 18071, 14926, -1 }, { 18075, 14927, -1 }, { 18090, 14928, -1 }, { 18088, 14929, -1 },
+    { 18092, 14930, -1 }, { 18070, 14931, -1 }, { 18094, 14932, -1 }, { 18097, 14933, -1 }, { 18052, 14934, -1 }, { 18065, 14935, -1 },
+    { 18081, 14936, -1 }, { 18082, 14937, -1 }, { 18097, 14938, -1 }, { 18105, 14939, -1 }, { 18068, 14940, -1 }, { 18055, 14941, -1 },
+    { 18095, 14942, -1 }, { 18086, 14943, -1 }, { 18069, 14944, -1 }, { 18058, 14945, -1 }, { 18121, 14947, -1 }, { 18089, 14946, -1 },
+    { 18115, 14948, -1 }, { 18121, 14949, -1 }, { 18067, 14950, -1 }, { 18115, 14951, -1 }, { 18116, 14952, -1 }, { 18100, 14953, -1 },
+    { 18081, 14956, -1 }, { 18119, 14954, -1 }, { 18072, 14955, -1 }, { 18121, 14957, -1 }, { 18136, 14958, -1 }, { 18123, 14959, -1 },
+    { 18107, 14960, -1 }, { 18108, 14961, -1 }, { 18126, 14962, -1 }, { 18097, 14963, -1 }, { 18125, 14964, -1 }, { 18112, 14965, -1 },
+    { 18081, 14966, -1 }, { 18144, 14968, -1 }, { 18144, 14967, -1 }, { 18121, 14969, -1 }, { 18101, 14970, -1 }, { 18103, 14971, -1 },
+    { 18093, 14972, -1 }, { 18122, 14973, -1 }, { 18091, 14974, -1 }, { 18104, 14975, -1 }, { 18150, 14976, -1 }, { 18124, 14977, -1 },
+    { 18102, 14978, -1 }, { 18075, 14950, -1 }, { 18106, 14979, -1 }, { 18096, 14980, -1 }, { 18146, 14981, -1 }, { 18108, 14982, -1 },
+    { 18133, 14983, -1 }, { 18144, 14984, -1 }, { 18146, 14985, -1 }, { 18142, 14986, -1 }, { 18153, 14987, -1 }, { 18128, 14988, -1 },
+    { 18156, 14989, -1 }, { 18110, 14990, -1 }, { 18111, 14991, -1 }, { 18139, 14992, -1 }, { 18159, 14993, -1 }, { 18160, 14994, -1 },
+    { 18131, 14995, -1 }, { 18162, 14999, -1 }, { 18171, 14996, -1 }, { 18117, 14997, -1 }, { 18164, 14998, -1 }, { 18124, 15000, -1 },
+    { 18125, 15001, -1 }, { 18130, 15002, -1 }, { 18174, 15003, -1 }, { 18182, 15004, -1 }, { 18136, 15005, -1 }, { 18136, 15006, -1 },
+    { 18157, 15007, -1 }, { 18183, 15008, -1 }, { 18146, 15009, -1 }, { 18135, 15010, -1 }, { 18188, 15011, -1 }, { 18187, 15012, -1 },
+    { 18179, 15013, -1 }, { 18142, 15014, -1 }, { 18189, 15015, -1 }, { 18187, 15016, -1 }, { 18184, 15017, -1 }, { 18179, 15018, -1 },
+    { 18185, 15019, -1 }, { 18142, 15020, -1 }, { 18182, 15021, -1 }, { 18160, 15022, -1 }, { 18171, 15023, -1 }, { 18189, 15024, -1 },
+    { 18157, 15025, -1 }, { 18197, 15026, -1 }, { 18195, 15027, -1 }, { 18193, 15028, -1 }, { 18151, 15031, -1 }, { 18161, 15029, -1 },
+    { 18191, 15030, -1 }, { 18187, 15027, -1 }, { 18164, 15032, -1 }, { 18162, 15033, -1 }, { 18188, 15034, -1 }, { 18186, 15035, -1 },
+    { 18205, 15036, -1 }, { 18194, 15037, -1 }, { 18203, 15038, -1 }, { 18168, 15040, -1 }, { 18168, 15039, -1 }, { 18207, 15041, -1 },
+    { 18222, 15042, -1 }, { 18189, 15043, -1 }, { 18206, 15044, -1 }, { 18181, 15045, -1 }, { 18195, 15046, -1 }, { 18177, 15047, -1 },
+    { 18222, 15048, -1 }, { 18190, 15049, -1 }, { 18167, 15050, -1 }, { 18213, 15051, -1 }, { 18216, 15052, -1 }, { 18219, 15053, -1 },
+    { 18211, 15054, -1 }, { 18221, 15055, -1 }, { 18197, 15056, -1 }, { 18206, 15057, -1 }, { 18237, 15058, -1 }, { 18196, 15038, -1 },
+    { 18177, 15059, -1 }, { 18217, 15060, -1 }, { 18232, 15061, -1 }, { 18189, 15062, -1 }, { 18209, 15061, -1 }, { 18193, 15063, -1 },
+    { 18231, 15064, -1 }, { 18195, 15065, -1 }, { 18242, 15066, -1 }, { 18207, 15062, -1 }, { 18199, 15067, -1 }, { 18227, 15068, -1 },
+    { 18242, 15069, -1 }, { 18203, 15071, -1 }, { 18223, 15070, -1 }, { 18236, 15072, -1 }, { 18201, 15073, -1 }, { 18224, 15074, -1 },
+    { 18208, 15075, -1 }, { 18248, 15076, -1 }, { 18218, 15077, -1 }, { 18211, 15078, -1 }, { 18256, 15079, -1 }, { 18204, 15080, -1 },
+    { 18264, 15081, -1 }, { 18225, 15082, -1 }, { 18235, 15083, -1 }, { 18215, 15084, -1 }, { 18267, 15085, -1 }, { 18263, 15086, -1 },
+    { 18256, 15087, -1 }, { 18257, 15088, -1 }, { 18271, 15089, -1 }, { 18253, 15090, -1 }, { 18229, 15091, -1 }, { 18244, 15092, -1 },
+    { 18256, 15093, -1 }, { 18227, 15094, -1 }, { 18233, 15095, -1 }, { 18258, 15096, -1 }, { 18266, 15097, -1 }, { 18230, 15099, -1 },
+    { 18237, 15100, -1 }, { 18247, 15095, -1 }, { 18227, 15098, -1 }, { 18270, 15101, -1 }, { 18238, 15102, -1 }, { 18269, 15103, -1 },
+    { 18269, 15104, -1 }, { 18253, 15105, -1 }, { 18284, 15106, -1 }, { 18260, 15107, -1 }, { 18255, 15108, -1 }, { 18269, 15109, -1 },
+    { 18241, 15110, -1 }, { 18283, 15102, -1 }, { 18286, 15111, -1 }, { 18241, 15114, -1 }, { 18265, 15112, -1 }, { 18265, 15115, -1 },
+    { 18266, 15117, -1 }, { 18251, 15116, -1 }, { 18289, 15118, -1 }, { 18301, 15113, -1 }, { 18272, 15119, -1 }, { 18301, 15120, -1 },
+    { 18288, 15121, -1 }, { 18297, 15122, -1 }, { 18255, 15123, -1 }, { 18299, 15124, -1 }, { 18306, 15125, -1 }, { 18312, 15126, -1 },
+    { 18283, 15127, -1 }, { 18299, 15128, -1 }, { 18283, 15129, -1 }, { 18311, 15130, -1 }, { 18267, 15133, -1 }, { 18269, 15131, -1 },
+    { 18308, 15132, -1 }, { 18259, 15134, -1 }, { 18299, 15135, -1 }, { 18278, 15136, -1 }, { 18311, 15137, -1 }, { 18275, 15138, -1 },
+    { 18279, 15139, -1 }, { 18295, 15142, -1 }, { 18270, 15141, -1 }, { 18280, 15140, -1 }, { 18286, 15143, -1 }, { 18285, 15144, -1 },
+    { 18300, 15145, -1 }, { 18333, 15146, -1 }, { 18285, 15147, -1 }, { 18317, 15148, -1 }, { 18267, 15104, -1 }, { 18292, 15116, -1 },
+    { 18313, 15140, -1 }, { 18288, 15149, -1 }, { 18294, 15150, -1 }, { 18287, 15151, -1 }, { 18315, 15152, -1 }, { 18283, 15157, -1 },
+    { 18329, 15153, -1 }, { 18330, 15154, -1 }, { 18333, 15155, -1 }, { 18283, 15156, -1 }, { 18297, 15158, -1 }, { 18307, 15162, -1 },
+    { 18323, 15159, -1 }, { 18326, 15160, -1 }, { 18320, 15161, -1 }, { 18340, 15163, -1 }, { 18290, 15164, -1 }, { 18348, 15165, -1 },
+    { 18324, 15166, -1 }, { 18327, 15167, -1 }, { 18307, 15168, -1 }, { 18327, 15169, -1 }, { 18353, 15170, -1 }, { 18343, 15171, -1 },
+    { 18347, 15172, -1 }, { 18314, 15173, -1 }, { 18313, 15174, -1 }, { 18354, 15175, -1 }, { 18330, 15176, -1 }, { 18310, 15177, -1 },
+    { 18363, 15178, -1 }, { 18340, 15182, -1 }, { 18366, 15179, -1 }, { 18325, 15180, -1 }, { 18357, 15181, -1 }, { 18320, 15183, -1 },
+    { 18353, 15184, -1 }, { 18323, 15185, -1 }, { 18326, 15186, -1 }, { 18323, 15187, -1 }, { 18345, 15188, -1 }, { 18362, 15189, -1 },
+    { 18359, 15190, -1 }, { 18332, 15191, -1 }, { 18361, 15192, -1 }, { 18360, 15193, -1 }, { 18380, 15194, -1 }, { 18337, 15195, -1 },
+    { 18328, 15196, -1 }, { 18339, 15197, -1 }, { 18324, 15175, -1 }, { 18352, 15198, -1 }, { 18390, 15199, -1 }, { 18357, 15200, -1 },
+    { 18346, 15201, -1 }, { 18375, 15202, -1 }, { 18381, 15203, -1 }, { 18356, 15204, -1 }, { 18385, 15205, -1 }, { 18375, 15206, -1 },
+    { 18323, 15175, -1 }, { 18332, 15178, -1 }, { 18398, 15207, -1 }, { 18352, 15208, -1 }, { 18370, 15209, -1 }, { 18352, 15210, -1 },
+    { 18345, 15211, -1 }, { 18354, 15212, -1 }, { 18376, 15213, -1 }, { 18359, 15214, -1 }, { 18395, 15215, -1 }, { 18396, 15216, -1 },
+    { 18347, 15217, -1 }, { 18396, 15218, -1 }, { 18408, 15219, -1 }, { 18406, 15220, -1 }, { 18373, 15221, -1 }, { 18383, 15222, -1 },
+    { 18398, 15223, -1 }, { 18366, 15224, -1 }, { 18372, 15225, -1 }, { 18374, 15227, -1 }, { 18373, 15228, -1 }, { 18360, 15229, -1 },
+    { 18409, 15226, -1 }, { 18412, 15230, -1 }, { 18399, 15231, -1 }, { 18395, 15232, -1 }, { 18415, 15233, -1 }, { 18394, 15234, -1 },
+    { 18422, 15235, -1 }, { 18405, 15236, -1 }, { 18404, 15237, -1 }, { 18370, 15238, -1 }, { 18433, 15239, -1 }, { 18373, 15240, -1 },
+    { 18405, 15227, -1 }, { 18421, 15241, -1 }, { 18416, 15242, -1 }, { 18406, 15243, -1 }, { 18405, 15244, -1 }, { 18430, 15245, -1 },
+    { 18436, 15246, -1 }, { 18389, 15247, -1 }, { 18425, 15248, -1 }, { 18384, 15249, -1 }, { 18396, 15250, -1 }, { 18394, 15251, -1 },
+    { 18396, 15252, -1 }, { 18397, 15253, -1 }, { 18401, 15254, -1 }, { 18445, 15255, -1 }, { 18419, 15256, -1 }, { 18414, 15257, -1 },
+    { 18404, 15258, -1 }, { 18407, 15259, -1 }, { 18442, 15260, -1 }, { 18396, 15261, -1 }, { 18450, 15262, -1 }, { 18441, 15264, -1 },
+    { 18427, 15263, -1 }, { 18451, 15265, -1 }, { 18452, 15266, -1 }, { 18424, 15267, -1 }, { 18438, 15268, -1 }, { 18462, 15269, -1 },
+    { 18453, 15270, -1 }, { 18454, 15271, -1 }, { 18453, 15272, -1 }, { 18440, 15273, -1 }, { 18468, 15274, -1 }, { 18412, 15275, -1 },
+    { 18400, 15227, -1 }, { 18415, 15276, -1 }, { 18437, 15277, -1 }, { 18424, 15278, -1 }, { 18462, 15279, -1 }, { 18462, 15280, -1 },
+    { 18428, 15281, -1 }, { 18451, 15282, -1 }, { 18469, 15283, -1 }, { 18463, 15284, -1 }, { 18468, 15285, -1 }, { 18439, 15286, -1 },
+    { 18473, 15287, -1 }, { 18459, 15288, -1 }, { 18421, 15289, -1 }, { 18452, 15292, -1 }, { 18475, 15290, -1 }, { 18426, 15291, -1 },
+    { 18428, 15293, -1 }, { 18482, 15294, -1 }, { 18457, 15295, -1 }, { 18461, 15296, -1 }, { 18441, 15297, -1 }, { 18486, 15298, -1 },
+    { 18460, 15299, -1 }, { 18485, 15300, -1 }, { 18447, 15301, -1 }, { 18466, 15302, -1 }, { 18492, 15303, -1 }, { 18462, 15304, -1 },
+    { 18487, 15305, -1 }, { 18447, 15306, -1 }, { 18453, 15307, -1 }, { 18442, 15308, -1 }, { 18485, 15309, -1 }, { 18493, 15310, -1 },
+    { 18456, 15311, -1 }, { 18474, 15312, -1 }, { 18495, 15313, -1 }, { 18509, 15314, -1 }, { 18470, 15315, -1 }, { 18481, 15316, -1 },
+    { 18467, 15317, -1 }, { 18467, 15288, -1 }, { 18477, 15318, -1 }, { 18505, 15319, -1 }, { 18508, 15320, -1 }, { 18483, 15321, -1 },
+    { 18505, 15322, -1 }, { 18489, 15323, -1 }, { 18511, 15324, -1 }, { 18509, 15317, -1 }, { 18476, 15325, -1 }, { 18475, 15326, -1 },
+    { 18503, 15327, -1 }, { 18479, 15328, -1 }, { 18524, 15331, -1 }, { 18516, 15329, -1 }, { 18500, 15330, -1 }, { 18476, 15332, -1 },
+    { 18500, 15315, -1 }, { 18523, 15333, -1 }, { 18484, 15334, -1 }, { 18487, 15335, -1 }, { 18516, 15329, -1 }, { 18522, 15336, -1 },
+    { 18508, 15337, -1 }, { 18525, 15338, -1 }, { 18491, 15339, -1 }, { 18492, 15340, -1 }, { 18513, 15341, -1 }, { 18541, 15342, -1 },
+    { 18526, 15345, -1 }, { 18495, 15343, -1 }, { 18535, 15344, -1 }, { 18531, 15346, -1 }, { 18515, 15347, -1 }, { 18513, 15348, -1 },
+    { 18505, 15349, -1 }, { 18491, 15315, -1 }, { 18527, 15350, -1 }, { 18493, 15351, -1 }, { 18522, 15352, -1 }, { 18503, 15353, -1 },
+    { 18505, 15354, -1 }, { 18664, 15361, -1 }, { 18510, 15315, -1 }, { 18555, 15355, -1 }, { 18536, 15355, -1 }, { 18537, 15355, -1 },
+    { 18536, 15355, -1 }, { 18550, 15355, -1 }, { 18538, 15355, -1 }, { 18524, 15356, -1 }, { 18616, 15362, -1 }, { 18634, 15363, -1 },
+    { 18652, 15364, -1 }, { 18523, 15356, -1 }, { 18536, 15356, -1 }, { 18568, 15358, -1 }, { 18615, 15365, -1 }, { 18652, 15366, -1 },
+    { 18534, 15356, -1 }, { 18535, 15356, -1 }, { 18544, 15356, -1 }, { 18575, 15356, -1 }, { 18577, 15358, -1 }, { 18520, 15356, -1 },
+    { 18622, 15367, -1 }, { 18623, 15368, -1 }, { 18557, 15356, -1 }, { 18530, 15356, -1 }, { 18559, 15356, -1 }, { 18624, 15369, -1 },
+    { 18641, 15359, -1 }, { 18625, 15370, -1 }, { 18530, 15356, -1 }, { 18667, 15371, -1 }, { 18601, 15358, -1 }, { 18553, 15356, -1 },
+    { 18544, 15356, -1 }, { 18628, 15358, -1 }, { 18613, 15359, -1 }, { 18572, 15358, -1 }, { 18631, 15358, -1 }, { 18597, 15359, -1 },
+    { 18594, 15359, -1 }, { 18665, 15372, -1 }, { 18546, 15356, -1 }, { 18551, 15356, -1 }, { 18579, 15356, -1 }, { 18633, 15373, -1 },
+    { 18629, 15374, -1 }, { 18638, 15375, -1 }, { 18574, 15358, -1 }, { 18617, 15358, -1 }, { 18639, 15376, -1 }, { 18574, 15356, -1 },
+    { 18590, 15356, -1 }, { 18582, 15356, -1 }, { 18581, 15356, -1 }, { 18548, 15356, -1 }, { 18567, 15357, -1 }, { 18670, 15380, -1 },
+    { 18629, 15377, -1 }, { 18601, 15357, -1 }, { 18671, 15378, -1 }, { 18570, 15356, -1 }, { 18593, 15357, -1 }, { 18543, 15356, -1 },
+    { 18656, 15379, -1 }, { 18586, 15359, -1 }, { 18669, 15381, -1 }, { 18544, 15356, -1 }, { 18550, 15356, -1 }, { 18654, 15382, -1 },
+    { 18603, 15358, -1 }, { 18570, 15357, -1 }, { 18687, 15383, -1 }, { 18671, 15384, -1 }, { 18627, 15358, -1 }, { 18607, 15357, -1 },
+    { 18565, 15357, -1 }, { 18578, 15357, -1 }, { 18604, 15357, -1 }, { 18598, 15357, -1 }, { 18607, 15359, -1 }, { 18558, 15357, -1 },
+    { 18649, 15385, -1 }, { 18679, 15386, -1 }, { 18596, 15357, -1 }, { 18643, 15360, -1 }, { 18663, 15387, -1 }, { 18670, 15388, -1 },
+    { 18651, 15389, -1 }, { 18640, 15390, -1 }, { 18632, 15359, -1 }, { 18636, 15359, -1 }, { 18641, 15360, -1 }, { 18637, 15391, -1 },
+    { 18646, 15392, -1 }, { 18697, 15393, -1 }, { 18651, 15394, -1 }, { 18638, 15395, -1 }, { 18684, 15396, -1 }, { 18654, 15397, -1 },
+    { 18699, 15400, -1 }, { 18607, 15357, -1 }, { 18604, 15357, -1 }, { 18591, 15357, -1 }, { 18615, 15357, -1 }, { 18576, 15357, -1 },
+    { 18592, 15360, -1 }, { 18601, 15357, -1 }, { 18688, 15398, -1 }, { 18610, 15360, -1 }, { 18580, 15357, -1 }, { 18606, 15357, -1 },
+    { 18679, 15399, -1 }, { 18650, 15360, -1 }, { 18628, 15360, -1 }, { 18696, 15401, -1 }, { 18578, 15357, -1 }, { 18676, 15402, -1 },
+    { 18687, 15403, -1 }, { 18692, 15404, -1 }, { 18645, 15360, -1 }, { 18696, 15405, -1 }, { 18701, 15406, -1 }, { 18635, 15360, -1 },
+    { 18651, 15407, -1 }, { 18652, 15408, -1 }, { 18651, 15409, -1 }, { 18714, 15410, -1 }, { 18637, 15360, -1 }, { 18670, 15411, -1 },
+    { 18707, 15412, -1 }, { 18703, 15413, -1 }, { 18684, 15414, -1 }, { 18713, 15415, -1 }, { 18709, 15416, -1 }, { 18722, 15417, -1 },
+    { 18661, 15418, -1 }, { 18692, 15419, -1 }, { 18691, 15420, -1 }, { 18692, 15421, -1 }, { 18666, 15422, -1 }, { 18696, 15423, -1 },
+    { 18712, 15424, -1 }, { 18624, 15360, -1 }, { 18661, 15360, -1 }, { 18729, 15425, -1 }, { 18691, 15426, -1 }, { 18706, 15427, -1 },
+    { 18727, 15429, -1 }, { 18674, 15430, -1 }, { 18677, 15428, -1 }, { 18726, 15431, -1 }, { 18731, 15432, -1 }, { 18698, 15433, -1 },
+    { 18705, 15434, -1 }, { 18734, 15435, -1 }, { 18730, 15436, -1 }, { 18692, 15437, -1 }, { 18733, 15438, -1 }, { 18702, 15439, -1 },
+    { 18731, 15440, -1 }, { 18688, 15441, -1 }, { 18692, 15442, -1 }, { 18698, 15443, -1 }, { 18718, 15444, -1 }, { 18700, 15445, -1 },
+    { 18716, 15446, -1 }, { 18740, 15447, -1 }, { 18722, 15448, -1 }, { 18748, 15449, -1 }, { 18729, 15450, -1 }, { 18751, 15451, -1 },
+    { 18714, 15452, -1 }, { 18703, 15454, -1 }, { 18710, 15451, -1 }, { 18715, 15451, -1 }, { 18753, 15452, -1 }, { 18749, 15455, -1 },
+    { 18754, 15453, -1 }, { 18738, 15456, -1 }, { 18766, 15455, -1 }, { 18716, 15457, -1 }, { 18732, 15458, -1 }, { 18757, 15459, -1 },
+    { 18720, 15460, -1 }, { 18708, 15455, -1 }, { 18734, 15461, -1 }, { 18719, 15451, -1 }, { 18761, 15462, -1 }, { 18753, 15463, -1 },
+    { 18763, 15464, -1 }, { 18769, 15465, -1 }, { 18772, 15466, -1 }, { 18757, 15467, -1 }, { 18765, 15468, -1 }, { 18743, 15452, -1 },
+    { 18762, 15469, -1 }, { 18720, 15470, -1 }, { 18726, 15471, -1 }, { 18770, 15472, -1 }, { 18727, 15473, -1 }, { 18731, 15474, -1 },
+    { 18766, 15475, -1 }, { 18778, 15476, -1 }, { 18744, 15477, -1 }, { 18784, 15478, -1 }, { 18737, 15479, -1 }, { 18739, 15480, -1 },
+    { 18796, 15481, -1 }, { 18777, 15482, -1 }, { 18764, 15483, -1 }, { 18782, 15484, -1 }, { 18742, 15485, -1 }, { 18794, 15486, -1 },
+    { 18768, 15476, -1 }, { 18752, 15487, -1 }, { 18740, 15488, -1 }, { 18740, 15451, -1 }, { 18746, 15489, -1 }, { 18771, 15490, -1 },
+    { 18794, 15491, -1 }, { 18781, 15492, -1 }, { 18752, 15493, -1 }, { 18796, 15494, -1 }, { 18750, 15495, -1 }, { 18761, 15496, -1 },
+    { 18806, 15497, -1 }, { 18763, 15498, -1 }, { 18774, 15499, -1 }, { 18802, 15500, -1 }, { 18794, 15501, -1 }, { 18804, 15502, -1 },
+    { 18786, 15503, -1 }, { 18819, 15504, -1 }, { 18770, 15505, -1 }, { 18807, 15506, -1 }, { 18767, 15507, -1 }, { 18800, 15508, -1 },
+    { 18768, 15470, -1 }, { 18809, 15509, -1 }, { 18785, 15510, -1 }, { 18795, 15511, -1 }, { 18801, 15512, -1 }, { 18816, 15513, -1 },
+    { 18817, 15514, -1 }, { 18788, 15515, -1 }, { 18818, 15516, -1 }, { 18789, 15517, -1 }, { 18771, 15518, -1 }, { 18784, 15519, -1 },
+    { 18829, 15520, -1 }, { 18799, 15521, -1 }, { 18826, 15522, -1 }, { 18786, 15523, -1 }, { 18832, 15524, -1 }, { 18827, 15525, -1 },
+    { 18811, 15526, -1 }, { 18818, 15527, -1 }, { 18803, 15529, -1 }, { 18835, 15528, -1 }, { 18831, 15530, -1 }, { 18831, 15531, -1 },
+    { 18797, 15532, -1 }, { 18844, 15533, -1 }, { 18834, 15534, -1 }, { 18826, 15535, -1 }, { 18826, 15536, -1 }, { 18843, 15537, -1 },
+    { 18806, 15538, -1 }, { 18853, 15539, -1 }, { 18796, 15540, -1 }, { 18816, 15541, -1 }, { 18826, 15542, -1 }, { 18824, 15543, -1 },
+    { 18811, 15544, -1 }, { 18843, 15545, -1 }, { 18852, 15546, -1 }, { 18858, 15547, -1 }, { 18815, 15548, -1 }, { 18841, 15549, -1 },
+    { 18833, 15550, -1 }, { 18854, 15551, -1 }, { 18850, 15552, -1 }, { 18848, 15553, -1 }, { 18834, 15554, -1 }, { 18819, 15555, -1 },
+    { 18864, 15556, -1 }, { 18824, 15557, -1 }, { 18810, 15558, -1 }, { 18866, 15559, -1 }, { 18824, 15560, -1 }, { 18828, 15561, -1 },
+    { 18827, 15562, -1 }, { 18831, 15563, -1 }, { 18848, 15564, -1 }, { 18866, 15565, -1 }, { 18880, 15566, -1 }, { 18830, 15567, -1 },
+    { 18846, 15568, -1 }, { 18872, 15569, -1 }, { 18879, 15570, -1 }, { 18862, 15574, -1 }, { 18837, 15571, -1 }, { 18838, 15572, -1 },
+    { 18884, 15573, -1 }, { 18856, 15575, -1 }, { 18879, 15576, -1 }, { 18833, 15577, -1 }, { 18881, 15578, -1 }, { 18844, 15579, -1 },
+    { 18886, 15580, -1 }, { 18833, 15581, -1 }, { 18845, 15582, -1 }, { 18840, 15583, -1 }, { 18837, 15584, -1 }, { 18838, 15585, -1 },
+    { 18889, 15586, -1 }, { 18900, 15587, -1 }, { 18900, 15590, -1 }, { 18877, 15588, -1 }, { 18863, 15589, -1 }, { 18848, 15591, -1 },
+    { 18890, 15592, -1 }, { 18885, 15593, -1 }, { 18908, 15594, -1 }, { 18874, 15595, -1 }, { 18861, 15596, -1 }, { 18899, 15597, -1 },
+    { 18863, 15598, -1 }, { 18855, 15599, -1 }, { 18914, 15600, -1 }, { 18882, 15601, -1 }, { 18883, 15602, -1 }, { 18855, 15604, -1 },
+    { 18918, 15606, -1 }, { 18858, 15603, -1 }, { 18921, 15605, -1 }, { 18861, 15607, -1 }, { 18924, 15609, -1 }, { 18925, 15608, -1 },
+    { 18904, 15610, -1 }, { 18879, 15611, -1 }, { 18897, 15612, -1 }, { 18880, 15613, -1 }, { 18929, 15614, -1 }, { 18899, 15615, -1 },
+    { 18875, 15616, -1 }, { 18907, 15617, -1 }, { 18912, 15618, -1 }, { 18928, 15619, -1 }, { 18907, 15620, -1 }, { 18911, 15621, -1 },
+    { 18900, 15622, -1 }, { 18916, 15623, -1 }, { 18936, 15624, -1 }, { 18910, 15625, -1 }, { 18895, 15626, -1 }, { 18934, 15627, -1 },
+    { 18896, 15606, -1 }, { 18896, 15628, -1 }, { 18899, 15605, -1 }, { 18929, 15629, -1 }, { 18931, 15630, -1 }, { 18903, 15608, -1 },
+    { 18946, 15631, -1 }, { 18899, 15632, -1 }, { 18924, 15633, -1 }, { 18914, 15634, -1 }, { 18895, 15635, -1 }, { 18941, 15636, -1 },
+    { 18948, 15637, -1 }, { 18915, 15638, -1 }, { 18946, 15639, -1 }, { 18927, 15640, -1 }, { 18934, 15641, -1 }, { 18939, 15642, -1 },
+    { 18949, 15647, -1 }, { 18911, 15643, -1 }, { 18952, 15644, -1 }, { 18923, 15645, -1 }, { 18956, 15646, -1 }, { 18954, 15648, -1 },
+    { 18906, 15649, -1 }, { 18935, 15650, -1 }, { 18958, 15651, -1 }, { 18932, 15652, -1 }, { 18918, 15653, -1 }, { 18961, 15654, -1 },
+    { 18954, 15655, -1 }, { 18962, 15656, -1 }, { 18969, 15657, -1 }, { 18936, 15658, -1 }, { 18946, 15659, -1 }, { 18915, 15660, -1 },
+    { 18967, 15661, -1 }, { 18950, 15662, -1 }, { 18965, 15663, -1 }, { 18957, 15664, -1 }, { 18949, 15665, -1 }, { 18954, 15666, -1 },
+    { 18954, 15667, -1 }, { 18955, 15668, -1 }, { 18976, 15669, -1 }, { 18941, 15670, -1 }, { 18947, 15671, -1 }, { 18957, 15673, -1 },
+    { 18974, 15672, -1 }, { 18975, 15674, -1 }, { 18976, 15675, -1 }, { 18932, 15676, -1 }, { 18945, 15677, -1 }, { 18959, 15678, -1 },
+    { 18985, 15679, -1 }, { 18956, 15680, -1 }, { 18987, 15681, -1 }, { 18983, 15682, -1 }, { 18967, 15683, -1 }, { 18962, 15684, -1 },
+    { 18972, 15685, -1 }, { 18958, 15686, -1 }, { 18991, 15687, -1 }, { 18952, 15688, -1 }, { 18997, 15689, -1 }, { 18958, 15690, -1 },
+    { 18949, 15691, -1 }, { 19008, 15692, -1 }, { 18969, 15693, -1 }, { 18979, 15695, -1 }, { 18996, 15694, -1 }, { 18997, 15696, -1 },
+    { 18998, 15697, -1 }, { 18982, 15698, -1 }, { 18968, 15699, -1 }, { 18984, 15700, -1 }, { 19002, 15701, -1 }, { 18989, 15702, -1 },
+    { 18990, 15703, -1 }, { 19010, 15704, -1 }, { 18969, 15705, -1 }, { 18984, 15708, -1 }, { 18994, 15709, -1 }, { 19012, 15706, -1 },
+    { 19015, 15710, -1 }, { 19016, 15707, -1 }, { 18998, 15711, -1 }, { 18990, 15712, -1 }, { 18983, 15713, -1 }, { 19020, 15717, -1 },
+    { 19012, 15716, -1 }, { 19003, 15718, -1 }, { 19023, 15719, -1 }, { 19019, 15714, -1 }, { 19003, 15715, -1 }, { 18984, 15720, -1 },
+    { 18976, 15721, -1 }, { 19006, 15722, -1 }, { 19026, 15723, -1 }, { 19011, 15724, -1 }, { 18992, 15727, -1 }, { 19030, 15725, -1 },
+    { 19031, 15726, -1 }, { 19043, 15728, -1 }, { 19035, 15729, -1 }, { 19042, 15730, -1 }, { 19004, 15731, -1 }, { 19035, 15732, -1 },
+    { 19038, 15733, -1 }, { 19040, 15734, -1 }, { 19041, 15735, -1 }, { 19048, 15736, -1 }, { 19038, 15737, -1 }, { 19028, 15738, -1 },
+    { 19007, 15739, -1 }, { 19052, 15740, -1 }, { 19022, 15741, -1 }, { 19009, 15744, -1 }, { 19047, 15742, -1 }, { 19050, 15743, -1 },
+    { 19051, 15745, -1 }, { 19052, 15746, -1 }, { 19060, 15747, -1 }, { 19035, 15748, -1 }, { 19036, 15749, -1 }, { 19028, 15750, -1 },
+    { 19011, 15751, -1 }, { 19069, 15752, -1 }, { 19012, 15753, -1 }, { 19032, 15754, -1 }, { 19058, 15755, -1 }, { 19028, 15756, -1 },
+    { 19038, 15757, -1 }, { 19068, 15758, -1 }, { 19070, 15759, -1 }, { 19037, 15760, -1 }, { 19064, 15765, -1 }, { 19046, 15756, -1 },
+    { 19058, 15761, -1 }, { 19051, 15762, -1 }, { 19036, 15763, -1 }, { 19070, 15764, -1 }, { 19084, 15766, -1 }, { 19065, 15767, -1 },
+    { 19077, 15768, -1 }, { 19058, 15769, -1 }, { 19051, 15770, -1 }, { 19061, 15771, -1 }, { 19071, 15772, -1 }, { 19085, 15773, -1 },
+    { 19085, 15774, -1 }, { 19034, 15775, -1 }, { 19024, 15757, -1 }, { 19083, 15776, -1 }, { 19059, 15777, -1 }, { 19083, 15778, -1 },
+    { 19087, 15779, -1 }, { 19052, 15780, -1 }, { 19087, 15781, -1 }, { 19087, 15782, -1 }, { 19095, 15783, -1 }, { 19077, 15784, -1 },
+    { 19056, 15785, -1 }, { 19101, 15784, -1 }, { 19076, 15787, -1 }, { 19060, 15787, -1 }, { 19095, 15789, -1 }, { 19113, 15786, -1 },
+    { 19052, 15754, -1 }, { 19102, 15788, -1 }, { 19077, 15790, -1 }, { 19095, 15791, -1 }, { 19100, 15785, -1 }, { 19105, 15792, -1 },
+    { 19106, 15793, -1 }, { 19071, 15754, -1 }, { 19106, 15794, -1 }, { 19101, 15795, -1 }, { 19114, 15796, -1 }, { 19063, 15797, -1 },
+    { 19073, 15798, -1 }, { 19112, 15799, -1 }, { 19068, 15800, -1 }, { 19109, 15801, -1 }, { 19115, 15802, -1 }, { 19111, 15803, -1 },
+    { 19117, 15804, -1 }, { 19097, 15805, -1 }, { 19100, 15806, -1 }, { 19122, 15807, -1 }, { 19132, 15808, -1 }, { 19113, 15809, -1 },
+    { 19095, 15810, -1 }, { 19119, 15811, -1 }, { 19089, 15812, -1 }, { 19126, 15813, -1 }, { 19133, 15814, -1 }, { 19124, 15815, -1 },
+    { 19115, 15816, -1 }, { 19104, 15817, -1 }, { 19120, 15818, -1 }, { 19140, 15821, -1 }, { 19133, 15819, -1 }, { 19108, 15820, -1 },
+    { 19118, 15822, -1 }, { 19100, 15823, -1 }, { 19097, 15824, -1 }, { 19105, 15825, -1 }, { 19130, 15826, -1 }, { 19150, 15827, -1 },
+    { 19135, 15817, -1 }, { 19121, 15828, -1 }, { 19121, 15817, -1 }, { 19122, 15829, -1 }, { 19145, 15830, -1 }, { 19106, 15831, -1 },
+    { 19150, 15832, -1 }, { 19127, 15833, -1 }, { 19113, 15834, -1 }, { 19158, 15837, -1 }, { 19105, 15835, -1 }, { 19152, 15836, -1 },
+    { 19131, 15838, -1 }, { 19133, 15839, -1 }, { 19156, 15840, -1 }, { 19148, 15841, -1 }, { 19121, 15842, -1 }, { 19139, 15843, -1 },
+    { 19129, 15844, -1 }, { 19122, 15845, -1 }, { 19166, 15846, -1 }, { 19151, 15847, -1 }, { 19126, 15848, -1 }, { 19118, 15849, -1 },
+    { 19161, 15851, -1 }, { 19125, 15850, -1 }, { 19163, 15849, -1 }, { 19164, 15852, -1 }, { 19157, 15853, -1 }, { 19160, 15854, -1 },
+    { 19154, 15855, -1 }, { 19182, 15856, -1 }, { 19171, 15857, -1 }, { 19180, 15858, -1 }, { 19170, 15859, -1 }, { 19176, 15860, -1 },
+    { 19139, 15861, -1 }, { 19189, 15862, -1 }, { 19179, 15863, -1 }, { 19179, 15864, -1 }, { 19183, 15865, -1 }, { 19182, 15866, -1 },
+    { 19145, 15867, -1 }, { 19196, 15868, -1 }, { 19163, 15869, -1 }, { 19170, 15870, -1 }, { 19167, 15871, -1 }, { 19140, 15872, -1 },
+    { 19189, 15873, -1 }, { 19168, 15874, -1 }, { 19170, 15875, -1 }, { 19174, 15876, -1 }, { 19142, 15877, -1 }, { 19206, 15878, -1 },
+    { 19153, 15879, -1 }, { 19180, 15880, -1 }, { 19159, 15881, -1 }, { 19160, 15882, -1 }, { 19178, 15883, -1 }, { 19162, 15884, -1 },
+    { 19212, 15885, -1 }, { 19170, 15886, -1 }, { 19183, 15887, -1 }, { 19176, 15888, -1 }, { 19211, 15889, -1 }, { 19168, 15890, -1 },
+    { 19157, 15891, -1 }, { 19170, 15892, -1 }, { 19209, 15893, -1 }, { 19166, 15894, -1 }, { 19196, 15895, -1 }, { 19173, 15896, -1 },
+    { 19208, 15897, -1 }, { 19223, 15898, -1 }, { 19221, 15899, -1 }, { 19216, 15900, -1 }, { 19213, 15901, -1 }, { 19183, 15902, -1 },
+    { 19194, 15903, -1 }, { 19193, 15905, -1 }, { 19183, 15907, -1 }, { 19221, 15904, -1 }, { 19226, 15906, -1 }, { 19202, 15908, -1 },
+    { 19188, 15909, -1 }, { 19206, 15910, -1 }, { 19209, 15911, -1 }, { 19240, 15912, -1 }, { 19193, 15913, -1 }, { 19230, 15914, -1 },
+    { 19227, 15915, -1 }, { 19233, 15919, -1 }, { 19199, 15916, -1 }, { 19233, 15917, -1 }, { 19217, 15918, -1 }, { 19218, 15920, -1 },
+    { 19219, 15921, -1 }, { 19211, 15922, -1 }, { 19197, 15923, -1 }, { 19241, 15924, -1 }, { 19237, 15925, -1 }, { 19243, 15926, -1 },
+    { 19247, 15927, -1 }, { 19231, 15928, -1 }, { 19241, 15929, -1 }, { 19247, 15930, -1 }, { 19254, 15931, -1 }, { 19225, 15932, -1 },
+    { 19259, 15933, -1 }, { 19224, 15934, -1 }, { 19251, 15935, -1 }, { 19240, 15936, -1 }, { 19213, 15937, -1 }, { 19205, 15938, -1 },
+    { 19233, 15939, -1 }, { 19207, 15940, -1 }, { 19221, 15941, -1 }, { 19260, 15942, -1 }, { 19223, 15943, -1 }, { 19240, 15944, -1 },
+    { 19233, 15945, -1 }, { 19247, 15946, -1 }, { 19218, 15947, -1 }, { 19264, 15948, -1 }, { 19265, 15949, -1 }, { 19269, 15950, -1 },
+    { 19268, 15951, -1 }, { 19235, 15952, -1 }, { 19194, 15903, -1 }, { 19271, 15953, -1 }, { 19269, 15954, -1 }, { 19269, 15955, -1 },
+    { 19269, 15956, -1 }, { 19275, 15957, -1 }, { 19276, 15958, -1 }, { 19284, 15959, -1 }, { 19287, 15960, -1 }, { 19229, 15961, -1 },
+    { 19255, 15962, -1 }, { 19230, 15963, -1 }, { 19260, 15964, -1 }, { 19263, 15965, -1 }, { 19246, 15966, -1 }, { 19239, 15967, -1 },
+    { 19276, 15968, -1 }, { 19285, 15968, -1 }, { 19242, 15968, -1 }, { 19293, 15971, -1 }, { 19254, 15972, -1 }, { 19287, 15973, -1 },
+    { 19294, 15974, -1 }, { 19268, 15976, -1 }, { 19254, 15971, -1 }, { 19308, 15975, -1 }, { 19282, 15974, -1 }, { 19277, 15977, -1 },
+    { 19257, 15978, -1 }, { 19312, 15979, -1 }, { 19272, 15971, -1 }, { 19265, 15969, -1 }, { 19305, 15975, -1 }, { 19270, 15970, -1 },
+    { 19310, 15980, -1 }, { 19264, 15975, -1 }, { 19296, 15981, -1 }, { 19310, 15982, -1 }, { 19314, 15983, -1 }, { 19289, 15984, -1 },
+    { 19274, 15985, -1 }, { 19281, 15986, -1 }, { 19298, 15987, -1 }, { 19310, 15988, -1 }, { 19320, 15989, -1 }, { 19304, 15990, -1 },
+    { 19296, 15976, -1 }, { 19304, 15979, -1 }, { 19272, 15975, -1 }, { 19325, 15991, -1 }, { 19321, 15979, -1 }, { 19326, 15992, -1 },
+    { 19325, 15993, -1 }, { 19320, 15994, -1 }, { 19282, 15998, -1 }, { 19263, 15979, -1 }, { 19313, 15993, -1 }, { 19329, 15995, -1 },
+    { 19334, 15996, -1 }, { 19331, 15999, -1 }, { 19312, 16000, -1 }, { 19332, 15997, -1 }, { 19334, 16003, -1 }, { 19333, 16001, -1 },
+    { 19339, 16002, -1 }, { 19302, 16004, -1 }, { 19256, 15975, -1 }, { 19341, 16005, -1 }, { 19304, 16006, -1 }, { 19262, 15972, -1 },
+    { 19342, 16007, -1 }, { 19298, 16008, -1 }, { 19333, 16009, -1 }, { 19334, 16003, -1 }, { 19347, 16010, -1 }, { 19305, 16013, -1 },
+    { 19302, 16011, -1 }, { 19303, 16012, -1 }, { 19294, 15975, -1 }, { 19299, 16003, -1 }, { 19355, 16016, -1 }, { 19305, 16014, -1 },
+    { 19318, 16015, -1 }, { 19343, 16017, -1 }, { 19344, 16018, -1 }, { 19360, 16019, -1 }, { 19329, 16020, -1 }, { 19318, 16021, -1 },
+    { 19348, 16022, -1 }, { 19366, 16023, -1 }, { 19338, 16024, -1 }, { 19367, 16025, -1 }, { 19357, 16026, -1 }, { 19318, 16027, -1 },
+    { 19313, 16028, -1 }, { 19376, 16029, -1 }, { 19331, 16030, -1 }, { 19318, 16031, -1 }, { 19372, 16032, -1 }, { 19345, 16033, -1 },
+    { 19348, 16034, -1 }, { 19328, 16035, -1 }, { 19357, 16036, -1 }, { 19337, 16037, -1 }, { 19334, 16029, -1 }, { 19338, 16038, -1 },
+    { 19332, 16039, -1 }, { 19340, 16040, -1 }, { 19349, 16041, -1 }, { 19354, 16034, -1 }, { 19365, 16042, -1 }, { 19361, 16043, -1 },
+    { 19335, 16034, -1 }, { 19385, 16044, -1 }, { 19367, 16046, -1 }, { 19377, 16045, -1 }, { 19341, 16047, -1 }, { 19379, 16048, -1 },
+    { 19354, 16049, -1 }, { 19391, 16050, -1 }, { 19393, 16051, -1 }, { 19356, 16052, -1 }, { 19363, 16053, -1 }, { 19393, 16054, -1 },
+    { 19348, 16055, -1 }, { 19352, 16056, -1 }, { 19373, 16044, -1 }, { 19357, 16057, -1 }, { 19357, 16058, -1 }, { 19395, 16059, -1 },
+    { 19402, 16060, -1 }, { 19377, 16061, -1 }, { 19368, 16062, -1 }, { 19385, 16063, -1 }, { 19370, 16064, -1 }, { 19409, 16065, -1 },
+    { 19408, 16066, -1 }, { 19367, 16067, -1 }, { 19412, 16068, -1 }, { 19404, 16069, -1 }, { 19425, 16070, -1 }, { 19368, 16071, -1 },
+    { 19403, 16072, -1 }, { 19365, 16046, -1 }, { 19393, 16073, -1 }, { 19396, 16074, -1 }, { 19372, 16075, -1 }, { 19418, 16076, -1 },
+    { 19419, 16077, -1 }, { 19384, 16078, -1 }, { 19435, 16079, -1 }, { 19430, 16080, -1 }, { 19374, 16081, -1 }, { 19437, 16082, -1 },
+    { 19409, 16083, -1 }, { 19351, 16053, -1 }, { 19392, 16053, -1 }, { 19428, 16084, -1 }, { 19406, 16083, -1 }, { 19444, 16085, -1 },
+    { 19441, 16086, -1 }, { 19384, 16087, -1 }, { 19390, 16088, -1 }, { 19382, 16084, -1 }, { 19403, 16089, -1 }, { 19442, 16090, -1 },
+    { 19410, 16091, -1 }, { 19389, 16092, -1 }, { 19419, 16093, -1 }, { 19409, 16094, -1 }, { 19418, 16095, -1 }, { 19389, 16083, -1 },
+    { 19351, 16042, -1 }, { 19402, 16096, -1 }, { 19451, 16097, -1 }, { 19456, 16098, -1 }, { 19409, 16099, -1 }, { 19443, 16100, -1 },
+    { 19447, 16101, -1 }, { 19416, 16102, -1 }, { 19450, 16103, -1 }, { 19414, 16104, -1 }, { 19459, 16105, -1 }, { 19429, 16106, -1 },
+    { 19449, 16107, -1 }, { 19462, 16108, -1 }, { 19458, 16109, -1 }, { 19447, 16110, -1 }, { 19448, 16111, -1 }, { 19455, 16112, -1 },
+    { 19431, 16113, -1 }, { 19422, 16085, -1 }, { 19441, 16114, -1 }, { 19414, 16115, -1 }, { 19445, 16116, -1 }, { 19446, 16117, -1 },
+    { 19444, 16118, -1 }, { 19426, 16119, -1 }, { 19426, 16120, -1 }, { 19450, 16121, -1 }, { 19480, 16122, -1 }, { 19471, 16123, -1 },
+    { 19457, 16124, -1 }, { 19437, 16125, -1 }, { 19482, 16128, -1 }, { 19437, 16126, -1 }, { 19450, 16127, -1 }, { 19487, 16129, -1 },
+    { 19456, 16130, -1 }, { 19486, 16131, -1 }, { 19487, 16132, -1 }, { 19459, 16133, -1 }, { 19482, 16134, -1 }, { 19432, 16135, -1 },
+    { 19451, 16136, -1 }, { 19463, 16137, -1 }, { 19448, 16138, -1 }, { 19441, 16139, -1 }, { 19484, 16140, -1 }, { 19437, 16139, -1 },
+    { 19484, 16141, -1 }, { 19456, 16142, -1 }, { 19456, 16143, -1 }, { 19465, 16144, -1 }, { 19489, 16145, -1 }, { 19490, 16146, -1 },
+    { 19507, 16147, -1 }, { 19503, 16148, -1 }, { 19493, 16149, -1 }, { 19502, 16150, -1 }, { 19449, 16151, -1 }, { 19500, 16152, -1 },
+    { 19497, 16153, -1 }, { 19498, 16154, -1 }, { 19502, 16155, -1 }, { 19467, 16156, -1 }, { 19484, 16157, -1 }, { 0, 16158, 2 },
+    { 0, 16159, 4 }, { 19419, 16160, -1 }, { 0, 16161, 7 }, { 0, 16162, 11 }, { 19419, 16175, -1 }, { 19419, 16190, -1 },
+    { 0, 16198, 14 }, { 19421, 16163, -1 }, { 0, 16169, 16 }, { 19422, 16164, -1 }, { 19422, 16165, -1 }, { 19420, 16166, -1 },
+    { 0, 16167, 21 }, { 0, 16168, 22 }, { 19424, 16170, -1 }, { 0, 16171, 24 }, { 0, 16172, 25 }, { 0, 16173, 26 },
+    { 19426, 16174, -1 }, { 19424, 16176, -1 }, { 19429, 16177, -1 }, { 0, 16178, 32 }, { 0, 16179, 33 }, { 19429, 16180, -1 },
+    { 0, 16181, 38 }, { 0, 16182, 39 }, { 19429, 16183, -1 }, { 0, 16184, 43 }, { 0, 16185, 47 }, { 0, 16186, 49 },
+    { 0, 16187, 50 }, { 19428, 16188, -1 }, { 19431, 16189, -1 }, { 0, 16191, 58 }, { 0, 16192, 60 }, { 0, 16193, 61 },
+    { 19430, 16194, -1 }, { 19434, 16195, 64 }, { 0, 16196, 66 }, { 0, 16197, 69 }, { 0, 16199, 70 }, { 0, 16208, 71 },
+    { 0, 16209, 72 }, { 0, 16238, 73 }, { 0, 16239, 74 }, { 0, 16200, 75 }, { 0, 16201, 76 }, { 0, 16204, 77 },
+    { 0, 16202, 78 }, { 0, 16203, 79 }, { 0, 16205, 80 }, { 0, 16206, 81 }, { 0, 16207, 82 }, { 0, 16210, 85 },
+    { 0, 16211, 86 }, { 0, 16220, 87 }, { 0, 16221, 88 }, { 0, 16250, 89 }, { 0, 16251, 90 }, { 0, 16212, 91 },
+    { 0, 16213, 92 }, { 0, 16216, 93 }, { 0, 16214, 94 }, { 0, 16215, 95 }, { 0, 16217, 96 }, { 0, 16218, 99 },
+    { 19431, 16219, -1 }, { 19437, 16222, -1 }, { 19436, 16223, -1 }, { 19438, 16224, -1 }, { 0, 16225, 104 }, { 0, 16226, 107 },
+    { 0, 16227, 108 }, { 19438, 16228, -1 }, { 19440, 16229, -1 }, { 0, 16230, 113 }, { 0, 16231, 114 }, { 19438, 16232, -1 },
+    { 0, 16233, 118 }, { 0, 16234, 122 }, { 0, 16235, 123 }, { 19441, 16236, -1 }, { 19440, 16237, -1 }, { 19440, 16240, -1 },
+    { 0, 16241, 136 }, { 0, 16242, 139 }, { 0, 16243, 140 }, { 0, 16244, 141 }, { 0, 16245, 151 }, { 0, 16246, 162 },
+    { 0, 16247, 169 }, { 0, 16248, 170 }, { 0, 16249, 171 }, { 19442, 16260, 172 }, { 0, 16252, 177 }, { 19444, 16253, -1 },
+    { 0, 16254, 180 }, { 19446, 16255, -1 }, { 0, 16256, 194 }, { 0, 16257, 195 }, { 19447, 16258, -1 }, { 19447, 16259, -1 },
+    { 0, 16261, 201 }, { 19450, 16262, -1 }, { 0, 16285, 206 }, { 19451, 16308, -1 }, { 19453, 16263, -1 }, { 19453, 16264, -1 },
+    { 19453, 16266, -1 }, { 19455, 16313, -1 }, { 19455, 16265, -1 }, { 19457, 16307, -1 }, { 0, 16267, 215 }, { 0, 16268, 216 },
+    { 0, 16269, 219 }, { 19456, 16270, 220 }, { 0, 16271, 225 }, { 0, 16272, 226 }, { 0, 16273, 228 }, { 0, 16277, 229 },
+    { 0, 16286, 230 }, { 0, 16287, 231 }, { 0, 16316, 232 }, { 0, 16317, 233 }, { 0, 16274, 234 }, { 0, 16275, 235 },
+    { 0, 16278, 236 }, { 0, 16279, 237 }, { 19450, 16285, -1 }, { 0, 16280, 238 }, { 0, 16276, 239 }, { 19461, 16281, -1 },
+    { 0, 16282, 247 }, { 19462, 16283, -1 }, { 0, 16284, 257 }, { 19461, 16288, -1 }, { 0, 16289, 261 }, { 19460, 16290, -1 },
+    { 0, 16291, 274 }, { 0, 16292, 275 }, { 0, 16293, 277 }, { 0, 16294, 278 }, { 19466, 16295, -1 }, { 0, 16296, 285 },
+    { 0, 16297, 286 }, { 0, 16298, 297 }, { 0, 16299, 300 }, { 19465, 16300, -1 }, { 0, 16301, 302 }, { 0, 16302, 304 },
+    { 0, 16303, 307 }, { 19466, 16304, -1 }, { 19468, 16305, -1 }, { 19469, 16306, -1 }, { 19468, 16309, -1 }, { 19473, 16310, -1 },
+    { 19472, 16311, -1 }, { 0, 16312, 323 }, { 0, 16314, 324 }, { 19474, 16315, -1 }, { 19475, 16318, -1 }, { 0, 16319, 327 },
+    { 0, 16320, 329 }, { 0, 16321, 330 }, { 0, 16322, 331 }, { 0, 16323, 332 }, { 19476, 16324, -1 }, { 0, 16325, 334 },
+    { 0, 16326, 335 }, { 0, 16327, 336 }, { 0, 16328, 337 }, { 0, 16329, 338 }, { 0, 16330, 339 }, { 0, 16331, 340 },
+    { 0, 16332, 341 }, { 0, 16333, 342 }, { 0, 16350, 343 }, { 0, 16334, 345 }, { 0, 16335, 346 }, { 19477, 16336, -1 },
+    { 0, 16337, 348 }, { 0, 16338, 349 }, { 0, 16339, 350 }, { 0, 16340, 351 }, { 0, 16341, 352 }, { 19479, 16342, -1 },
+    { 0, 16343, 354 }, { 0, 16344, 355 }, { 0, 16345, 356 }, { 0, 16346, 358 }, { 0, 16347, 359 }, { 0, 16348, 360 },
+    { 0, 16349, 362 }, { 19476, 16351, -1 }, { 0, 16352, 364 }, { 19481, 16353, -1 }, { 0, 16354, 366 }, { 0, 16355, 367 },
+    { 0, 16356, 369 }, { 0, 16357, 370 }, { 0, 16358, 371 }, { 0, 16359, 372 }, { 0, 16360, 373 }, { 0, 16361, 374 },
+    { 0, 16362, 375 }, { 0, 16363, 376 }, { 0, 16364, 378 }, { 0, 16365, 379 }, { 0, 16366, 380 }, { 0, 16367, 383 },
+    { 0, 16368, 385 }, { 0, 16369, 386 }, { 0, 16370, 388 }, { 0, 16371, 389 }, { 0, 16378, 390 }, { 0, 16372, 391 },
+    { 0, 16373, 392 }, { 19482, 16374, -1 }, { 0, 16375, 394 }, { 0, 16376, 396 }, { 19482, 16377, -1 }, { 0, 16379, 402 },
+    { 19482, 16380, -1 }, { 19481, 16381, -1 }, { 0, 16382, 411 }, { 0, 16383, 412 }, { 0, 16384, 414 }, { 19486, 16385, -1 },
+    { 0, 16386, 432 }, { 0, 16387, 433 }, { 0, 16388, 434 }, { 0, 16389, 435 }, { 0, 16390, 437 }, { 0, 16391, 442 },
+    { 0, 16392, 443 }, { 0, 16393, 444 }, { 19486, 16394, -1 }, { 19484, 16395, -1 }, { 0, 16396, 470 }, { 0, 16397, 471 },
+    { 19489, 16398, -1 }, { 19490, 16406, -1 }, { 0, 16399, 476 }, { 0, 16400, 479 }, { 19488, 16401, -1 }, { 0, 16402, 481 },
+    { 0, 16403, 485 }, { 19489, 16404, 488 }, { 0, 16405, 491 }, { 19493, 16407, -1 }, { 0, 16408, 493 }, { 19494, 16409, -1 },
+    { 19496, 16410, -1 }, { 0, 16411, 499 }, { 19496, 16412, -1 }, { 0, 16413, 515 }, { 19498, 16414, -1 }, { 0, 16415, 540 },
+    { 0, 16416, 562 }, { 19496, 16417, -1 }, { 0, 16418, 645 }, { 0, 16419, 652 }, { 19497, 16420, -1 }, { 0, 16421, 667 },
+    { 19500, 16422, -1 }, { 19501, 16423, -1 }, { 0, 16424, 679 }, { 0, 16431, 680 }, { 0, 16425, 681 }, { 0, 16426, 689 },
+    { 19501, 16427, -1 }, { 0, 16428, 700 }, { 0, 16429, 703 }, { 19504, 16430, -1 }, { 19501, 16432, -1 }, { 19505, 16433, -1 },
+    { 19507, 16434, 725 }, { 19504, 16435, -1 }, { 0, 16436, 735 }, { 0, 16437, 739 }, { 0, 16438, 746 }, { 0, 16439, 753 },
+    { 0, 16440, 754 }, { 0, 16441, 755 }, { 0, 16442, 758 }, { 0, 16443, 761 }, { 0, 16444, 762 }, { 0, 16445, 763 },
+    { 0, 16446, 769 }, { 0, 16447, 770 }, { 19509, 16448, -1 }, { 0, 16449, 775 }, { 19510, 16450, 776 }, { 0, 16451, 780 },
+    { 0, 16452, 781 }, { 0, 16453, 782 }, { 0, 16473, 783 }, { 19509, 16454, 799 }, { 0, 16455, 802 }, { 0, 16456, 806 },
+    { 0, 16457, 810 }, { 19512, 16458, 811 }, { 0, 16459, 815 }, { 0, 16460, 818 }, { 19512, 16461, -1 }, { 19510, 16462, -1 },
+    { 0, 16463, 841 }, { 0, 16464, 842 }, { 19515, 16465, -1 }, { 0, 16466, 867 }, { 0, 16467, 892 }, { 0, 16468, 896 },
+    { 0, 16469, 897 }, { 0, 16470, 899 }, { 0, 16471, 900 }, { 0, 16472, 901 }, { 0, 16474, 903 }, { 0, 16475, 907 },
+    { 0, 16476, 911 }, { 0, 16477, 913 }, { 0, 16478, 914 }, { 0, 16479, 926 }, { 0, 16480, 930 }, { 19515, 16481, -1 },
+    { 0, 16482, 940 }, { 0, 16483, 941 }, { 19517, 16484, -1 }, { 0, 16485, 944 }, { 0, 16486, 957 }, { 19514, 16487, -1 },
+    { 19520, 16488, -1 }, { 19521, 16489, -1 }, { 0, 16490, 982 }, { 0, 16491, 984 }, { 0, 16492, 985 }, { 0, 16493, 986 },
+    { 0, 16494, 987 }, { 0, 16495, 989 }, { 0, 16496, 993 }, { 0, 16497, 994 }, { 19522, 16498, -1 }, { 0, 16499, 999 },
+    { 19522, 16500, -1 }, { 19522, 16501, -1 }, { 0, 16502, 1005 }, { 0, 16503, 1008 }, { 0, 16504, 1009 }, { 0, 16505, 1018 },
+    { 0, 16506, 1028 }, { 0, 16507, 1033 }, { 0, 16508, 1036 }, { 0, 16509, 1037 }, { 0, 16510, 1043 }, { 0, 16511, 1063 },
+    { 0, 16512, 1070 }, { 0, 16513, 1071 }, { 0, 16514, 1089 }, { 19523, 16515, -1 }, { 0, 16516, 1095 }, { 19525, 16517, -1 },
+    { 19523, 16518, -1 }, { 19523, 16519, -1 }, { 0, 16520, 1124 }, { 0, 16521, 1125 }, { 19525, 16522, -1 }, { 19525, 16523, -1 },
+    { 0, 16524, 1133 }, { 0, 16525, 1134 }, { 0, 16526, 1139 }, { 0, 16555, 1140 }, { 0, 16502, 1006 }, { 0, 16527, 1142 },
+    { 0, 16528, 1143 }, { 0, 16529, 1148 }, { 19530, 16530, -1 }, { 0, 16531, 1150 }, { 19530, 16532, -1 }, { 0, 16533, 1153 },
+    { 19532, 16534, -1 }, { 0, 16535, 1159 }, { 0, 16536, 1161 }, { 0, 16537, 1163 }, { 0, 16538, 1168 }, { 19533, 16539, -1 },
+    { 0, 16540, 1173 }, { 19532, 16541, 1174 }, { 0, 16542, 1176 }, { 19533, 16543, -1 }, { 0, 16544, 1178 }, { 19533, 16545, -1 },
+    { 0, 16546, 1182 }, { 19538, 16547, -1 }, { 0, 16548, 1185 }, { 19539, 16549, -1 }, { 0, 16550, 1189 }, { 0, 16551, 1192 },
+    { 19540, 16552, -1 }, { 0, 16553, 1217 }, { 19538, 16554, -1 }, { 19541, 16556, -1 }, { 0, 16557, 1230 }, { 19542, 16558, -1 },
+    { 0, 16559, 1235 }, { 0, 16560, 1237 }, { 0, 16561, 1244 }, { 0, 16562, 1246 }, { 0, 16563, 1256 }, { 0, 16564, 1264 },
+    { 0, 16565, 1270 }, { 19543, 16566, -1 }, { 0, 16567, 1280 }, { 0, 16568, 1281 }, { 0, 16569, 1292 }, { 0, 16570, 1293 },
+    { 0, 16571, 1303 }, { 0, 16572, 1308 }, { 0, 16573, 1309 }, { 0, 16574, 1313 }, { 0, 16575, 1314 }, { 19545, 16576, -1 },
+    { 0, 16577, 1319 }, { 19546, 16578, -1 }, { 19547, 16579, -1 }, { 19548, 16580, -1 }, { 19550, 16581, -1 }, { 19546, 16582, -1 },
+    { 0, 16583, 1331 }, { 19549, 16584, -1 }, { 19548, 16585, -1 }, { 0, 16586, 1342 }, { 0, 16587, 1348 }, { 0, 16588, 1349 },
+    { 19549, 16589, -1 }, { 0, 16590, 1358 }, { 19554, 16591, -1 }, { 0, 16592, 1385 }, { 19555, 16593, -1 }, { 19555, 16594, -1 },
+    { 0, 16595, 1390 }, { 0, 16596, 1391 }, { 0, 16597, 1393 }, { 0, 16598, 1394 }, { 0, 16599, 1397 }, { 19553, 16600, -1 },
+    { 0, 16601, 1404 }, { 19558, 16602, -1 }, { 19556, 16603, -1 }, { 19559, 16604, -1 }, { 0, 16609, 1412 }, { 0, 16605, 1413 },
+    { 0, 16606, 1414 }, { 0, 16607, 1416 }, { 19561, 16608, -1 }, { 19561, 16610, -1 }, { 0, 16611, 1423 }, { 0, 16612, 1424 },
+    { 0, 16613, 1428 }, { 0, 16614, 1429 }, { 0, 16615, 1430 }, { 0, 16616, 1432 }, { 0, 16637, 1433 }, { 19563, 16617, -1 },
+    { 0, 16618, 1437 }, { 0, 16619, 1438 }, { 19560, 16620, -1 }, { 0, 16621, 1449 }, { 19565, 16622, -1 }, { 19566, 16623, -1 },
+    { 0, 16624, 1453 }, { 0, 16625, 1458 }, { 19567, 16626, -1 }, { 19567, 16627, -1 }, { 19570, 16628, -1 }, { 19567, 16629, -1 },
+    { 0, 16630, 1489 }, { 19567, 16631, -1 }, { 0, 16632, 1497 }, { 0, 16633, 1500 }, { 0, 16634, 1504 }, { 19570, 16635, -1 },
+    { 19572, 16636, -1 }, { 0, 16638, 1508 }, { 0, 16639, 1510 }, { 19574, 16640, -1 }, { 19575, 16642, -1 }, { 0, 16641, 1515 },
+    { 0, 16647, 1516 }, { 19576, 16643, -1 }, { 0, 16644, 1531 }, { 0, 16645, 1536 }, { 19576, 16646, -1 }, { 0, 16648, 1552 },
+    { 19578, 16649, -1 }, { 0, 16650, 1556 }, { 19576, 16651, -1 }, { 0, 16604, 1411 }, { 0, 16652, 1561 }, { 0, 16653, 1563 },
+    { 19576, 16654, -1 }, { 19578, 16655, -1 }, { 0, 16656, 1592 }, { 0, 16657, 1596 }, { 19582, 16658, -1 }, { 0, 16659, 1633 },
+    { 19580, 16660, -1 }, { 0, 16661, 1641 }, { 19584, 16662, -1 }, { 0, 16663, 1647 }, { 19582, 16664, 1648 }, { 19586, 16665, -1 },
+    { 19586, 16666, -1 }, { 19588, 16667, 1673 }, { 0, 16668, 1676 }, { 0, 16669, 1677 }, { 19587, 16670, -1 }, { 19590, 16671, -1 },
+    { 19591, 16672, -1 }, { 0, 16673, 1682 }, { 19590, 16674, -1 }, { 0, 16675, 1685 }, { 0, 16676, 1688 }, { 0, 16681, 1689 },
+    { 19593, 16677, -1 }, { 19591, 16678, -1 }, { 0, 16679, 1692 }, { 19596, 16680, -1 }, { 0, 16682, 1695 }, { 19596, 16683, -1 },
+    { 0, 16684, 1697 }, { 19594, 16693, -1 }, { 19597, 16685, -1 }, { 0, 16686, 1700 }, { 0, 16732, 1701 }, { 0, 16687, 1702 },
+    { 0, 16688, 1706 }, { 19598, 16689, -1 }, { 0, 16690, 1715 }, { 0, 16691, 1723 }, { 19599, 16692, -1 }, { 19600, 16694, -1 },
+    { 19601, 16695, -1 }, { 19603, 16696, -1 }, { 0, 16697, 1740 }, { 0, 16699, 1742 }, { 0, 16733, 1743 }, { 0, 16698, 1744 },
+    { 0, 16700, 1745 }, { 0, 16701, 1747 }, { 0, 16702, 1753 }, { 0, 16703, 1756 }, { 19601, 16704, -1 }, { 0, 16705, 1759 },
+    { 19601, 16706, -1 }, { 0, 16707, 1761 }, { 19603, 16708, -1 }, { 0, 16709, 1769 }, { 0, 16710, 1770 }, { 19605, 16711, -1 },
+    { 0, 16712, 1786 }, { 19608, 16713, 1800 }, { 19609, 16714, -1 }, { 0, 16715, 1803 }, { 0, 16716, 1804 }, { 0, 16717, 1806 },
+    { 19606, 16718, -1 }, { 0, 16719, 1819 }, { 0, 16697, 1741 }, { 0, 16720, 1828 }, { 0, 16721, 1840 }, { 0, 16722, 1843 },
+    { 0, 16725, 1844 }, { 0, 16734, 1845 }, { 0, 16723, 1846 }, { 19610, 16724, -1 }, { 0, 16726, 1858 }, { 0, 16727, 1860 },
+    { 0, 16728, 1861 }, { 19612, 16729, -1 }, { 0, 16730, 1888 }, { 0, 16731, 1895 }, { 0, 16735, 1897 }, { 19613, 16736, -1 },
+    { 19614, 16737, -1 }, { 0, 16738, 1906 }, { 0, 16739, 1907 }, { 0, 16740, 1908 }, { 0, 16741, 1909 }, { 0, 16742, 1910 },
+    { 0, 16743, 1916 }, { 0, 16744, 1918 }, { 0, 16745, 1919 }, { 0, 16746, 1921 }, { 0, 16747, 1922 }, { 19612, 16748, 1923 },
+    { 19617, 16749, -1 }, { 0, 16750, 1930 }, { 19618, 16751, 1931 }, { 0, 16752, 1933 }, { 19618, 16753, -1 }, { 19617, 16754, -1 },
+    { 0, 16755, 1936 }, { 19621, 16756, 1937 }, { 19619, 16757, -1 }, { 0, 16758, 1942 }, { 19623, 16759, -1 }, { 0, 16760, 1945 },
+    { 0, 16761, 1946 }, { 0, 16784, 1947 }, { 0, 16794, 1948 }, { 0, 16762, 1949 }, { 19621, 16763, -1 }, { 19622, 16764, -1 },
+    { 19622, 16795, -1 }, { 0, 16765, 1953 }, { 19627, 16766, 1958 }, { 0, 16767, 1963 }, { 0, 16768, 1965 }, { 19628, 16769, -1 },
+    { 19625, 16770, -1 }, { 19627, 16771, -1 }, { 19632, 16772, -1 }, { 19632, 16773, -1 }, { 0, 16774, 1993 }, { 19633, 16775, -1 },
+    { 19633, 16776, -1 }, { 19634, 16777, -1 }, { 19634, 16778, -1 }, { 0, 16779, 2038 }, { 0, 16780, 2040 }, { 0, 16781, 2042 },
+    { 19636, 16782, -1 }, { 19638, 16783, -1 }, { 0, 16785, 2053 }, { 19637, 16786, -1 }, { 0, 16787, 2065 }, { 19637, 16788, -1 },
+    { 19642, 16789, -1 }, { 0, 16790, 2098 }, { 0, 16791, 2100 }, { 19638, 16792, -1 }, { 0, 16793, 2110 }, { 19640, 16796, -1 },
+    { 0, 16797, 2112 }, { 0, 16798, 2113 }, { 0, 16799, 2115 }, { 19640, 16800, -1 }, { 0, 16801, 2121 }, { 19644, 16802, -1 },
+    { 0, 16803, 2126 }, { 0, 16804, 2127 }, { 0, 16805, 2133 }, { 0, 16806, 2145 }, { 19646, 16807, -1 }, { 19643, 16808, -1 },
+    { 0, 16809, 2159 }, { 0, 16810, 2161 }, { 19645, 16811, 2162 }, { 0, 16812, 2164 }, { 0, 16813, 2166 }, { 0, 16814, 2167 },
+    { 0, 16815, 2168 }, { 0, 16830, 2169 }, { 0, 16866, 2170 }, { 0, 16816, 2171 }, { 0, 16817, 2172 }, { 0, 16818, 2179 },
+    { 0, 16819, 2180 }, { 0, 16820, 2185 }, { 19646, 16821, 2186 }, { 0, 16822, 2190 }, { 0, 16823, 2191 }, { 0, 16824, 2194 },
+    { 19650, 16825, -1 }, { 0, 16826, 2203 }, { 19649, 16827, -1 }, { 19652, 16828, -1 }, { 0, 16829, 2212 }, { 0, 16831, 2230 },
+    { 19655, 16832, -1 }, { 19655, 16833, -1 }, { 0, 16834, 2242 }, { 0, 16835, 2243 }, { 0, 16836, 2244 }, { 19656, 16837, -1 },
+    { 19656, 16838, -1 }, { 19656, 16839, -1 }, { 0, 16840, 2277 }, { 19657, 16841, -1 }, { 0, 16842, 2280 }, { 0, 16843, 2285 },
+    { 0, 16844, 2286 }, { 0, 16845, 2289 }, { 19656, 16846, 2291 }, { 19661, 16847, -1 }, { 0, 16848, 2302 }, { 19659, 16849, -1 },
+    { 0, 16850, 2315 }, { 0, 16851, 2317 }, { 0, 16852, 2318 }, { 0, 16853, 2319 }, { 0, 16854, 2322 }, { 0, 16855, 2331 },
+    { 0, 16856, 2339 }, { 0, 16857, 2340 }, { 0, 16858, 2359 }, { 19663, 16859, -1 }, { 0, 16860, 2361 }, { 0, 16861, 2363 },
+    { 0, 16862, 2366 }, { 0, 16863, 2378 }, { 19664, 16864, -1 }, { 0, 16865, 2388 }, { 0, 16867, 2390 }, { 0, 16868, 2392 },
+    { 0, 16869, 2395 }, { 0, 16870, 2396 }, { 0, 16871, 2398 }, { 0, 16872, 2399 }, { 0, 16873, 2404 }, { 19663, 16874, -1 },
+    { 0, 16875, 2426 }, { 19663, 16876, -1 }, { 19667, 16877, -1 }, { 0, 16878, 2437 }, { 0, 16879, 2438 }, { 0, 16909, 2439 },
+    { 0, 16880, 2448 }, { 19665, 16881, -1 }, { 0, 16882, 2451 }, { 19670, 16883, -1 }, { 0, 16884, 2454 }, { 0, 16885, 2459 },
+    { 19667, 16886, -1 }, { 0, 16887, 2468 }, { 19669, 16888, -1 }, { 0, 16889, 2474 }, { 0, 16890, 2478 }, { 0, 16891, 2481 },
+    { 0, 16892, 2482 }, { 0, 16893, 2485 }, { 0, 16894, 2490 }, { 0, 16895, 2496 }, { 0, 16896, 2504 }, { 0, 16897, 2509 },
+    { 0, 16898, 2511 }, { 0, 16899, 2513 }, { 19672, 16900, -1 }, { 0, 16901, 2523 }, { 0, 16902, 2525 }, { 0, 16903, 2526 },
+    { 19674, 16904, -1 }, { 19675, 16905, -1 }, { 0, 16906, 2538 }, { 19675, 16926, -1 }, { 0, 16945, 2540 }, { 0, 16952, 2541 },
+    { 19677, 16907, -1 }, { 0, 16908, 2543 }, { 0, 16917, 2544 }, { 0, 16910, 2545 }, { 19676, 16911, -1 }, { 0, 16912, 2551 },
+    { 19678, 16913, -1 }, { 0, 16914, 2558 }, { 0, 16915, 2565 }, { 0, 16916, 2568 }, { 19679, 16918, -1 }, { 0, 16919, 2575 },
+    { 0, 16920, 2582 }, { 0, 16921, 2589 }, { 0, 16922, 2590 }, { 0, 16923, 2597 }, { 0, 16930, 2598 }, { 19678, 16924, -1 },
+    { 0, 16925, 2613 }, { 19680, 16927, -1 }, { 0, 16928, 2619 }, { 0, 16929, 2621 }, { 19683, 16931, -1 }, { 0, 16932, 2625 },
+    { 19680, 16933, -1 }, { 0, 16934, 2633 }, { 0, 16935, 2634 }, { 19683, 16936, -1 }, { 19687, 16937, -1 }, { 0, 16938, 2648 },
+    { 19687, 16939, -1 }, { 0, 16940, 2653 }, { 0, 16941, 2655 }, { 19689, 16942, -1 }, { 19689, 16943, -1 }, { 19686, 16944, -1 },
+    { 0, 16946, 2713 }, { 19688, 16947, -1 }, { 19692, 16948, -1 }, { 19693, 16949, -1 }, { 0, 16950, 2723 }, { 0, 16953, 2726 },
+    { 0, 16954, 2732 }, { 0, 16955, 2733 }, { 0, 16956, 2736 }, { 0, 16958, 2740 }, { 0, 16957, 2737 }, { 0, 16959, 2742 },
+    { 0, 16953, 2727 }, { 0, 16963, 2743 }, { 0, 16964, 2745 }, { 0, 16968, 2746 }, { 0, 16969, 2748 }, { 0, 16970, 2749 },
+    { 0, 16973, 2753 }, { 0, 16976, 2754 }, { 0, 16958, 2741 }, { 0, 16963, 2744 }, { 0, 16977, 2755 }, { 0, 16957, 2738 },
+    { 0, 16968, 2747 }, { 0, 16978, 2756 }, { 0, 16971, 2750 }, { 0, 16953, 2728 }, { 0, 16971, 2751 }, { 0, 16982, 2757 },
+    { 0, 16985, 2758 }, { 0, 16955, 2734 }, { 0, 16957, 2739 }, { 0, 16953, 2729 }, { 0, 16986, 2761 }, { 0, 16994, 2763 },
+    { 0, 16996, 2769 }, { 0, 16994, 2764 }, { 0, 16995, 2766 }, { 0, 16994, 2765 }, { 0, 17003, 2771 }, { 0, 16953, 2730 },
+    { 0, 16986, 2762 }, { 0, 17004, 2772 }, { 0, 17005, 2775 }, { 0, 16955, 2735 }, { 0, 17006, 2776 }, { 0, 17007, 2777 },
+    { 0, 16971, 2752 }, { 0, 17013, 2778 }, { 0, 16953, 2731 }, { 0, 16985, 2759 }, { 0, 16995, 2767 }, { 0, 17015, 2779 },
+    { 0, 17019, 2781 }, { 0, 17020, 2782 }, { 0, 17015, 2780 }, { 0, 17008, 2783 }, { 0, 16995, 2768 }, { 0, 17011, 2784 },
+    { 0, 17014, 2785 }, { 0, 17023, 2786 }, { 0, 17027, 2787 }, { 0, 17028, 2788 }, { 0, 16985, 2760 }, { 0, 17029, 2789 },
+    { 0, 17030, 2790 }, { 0, 17031, 2791 }, { 0, 17033, 2792 }, { 0, 17036, 2793 }, { 0, 17053, 2794 }, { 0, 17054, 2795 },
+    { 0, 17055, 2796 }, { 0, 17056, 2798 }, { 0, 17057, 2800 }, { 0, 17004, 2773 }, { 0, 17059, 2801 }, { 0, 17062, 2802 },
+    { 0, 17063, 2803 }, { 0, 17068, 2804 }, { 0, 16965, 2805 }, { 0, 16972, 2806 }, { 0, 16984, 2807 }, { 0, 16987, 2808 },
+    { 0, 16989, 2809 }, { 0, 16990, 2810 }, { 0, 17000, 2811 }, { 0, 17022, 2814 }, { 0, 16996, 2770 }, { 0, 17001, 2812 },
+    { 0, 17056, 2799 }, { 0, 17026, 2815 }, { 0, 16980, 2817 }, { 0, 16988, 2818 }, { 0, 17004, 2774 }, { 0, 17055, 2797 },
+    { 0, 16991, 2819 }, { 0, 17001, 2813 }, { 0, 16992, 2820 }, { 0, 17017, 2821 }, { 0, 17032, 2822 }, { 0, 17042, 2823 },
+    { 0, 17037, 2826 }, { 0, 17043, 2824 }, { 0, 17044, 2827 }, { 0, 17058, 2828 }, { 0, 17061, 2829 }, { 0, 17065, 2830 },
+    { 0, 17066, 2831 }, { 0, 17072, 2832 }, { 0, 17075, 2833 }, { 0, 17080, 2834 }, { 0, 17095, 2835 }, { 0, 17026, 2816 },
+    { 0, 17043, 2825 }, { 0, 17096, 2836 }, { 19694, 16951, -1 }, { 19693, 16960, -1 }, { 0, 16961, 2842 }, { 19694, 16962, -1 },
+    { 19693, 16966, -1 }, { 19698, 16967, -1 }, { 0, 16974, 2868 }, { 19699, 16975, -1 }, { 19700, 16979, -1 }, { 19701, 16981, -1 },
+    { 19701, 16983, -1 }, { 19704, 16993, -1 }, { 19703, 16997, -1 }, { 19705, 16998, -1 }, { 19705, 16999, -1 }, { 0, 17002, 2882 },
+    { 0, 17009, 2883 }, { 0, 17010, 2884 }, { 19704, 17012, -1 }, { 19707, 17016, -1 }, { 19708, 17018, -1 }, { 19707, 17021, -1 },
+    { 0, 17024, 2915 }, { 19710, 17025, -1 }, { 19708, 17034, -1 }, { 19713, 17035, -1 }, { 0, 17038, 2959 }, { 19714, 17039, -1 },
+    { 19711, 17040, -1 }, { 19714, 17041, -1 }, { 19714, 17045, -1 }, { 0, 17046, 2978 }, { 0, 17047, 2979 }, { 0, 17048, 2980 },
+    { 0, 17049, 2981 }, { 0, 17050, 2983 }, { 0, 17051, 2986 }, { 0, 17052, 2987 }, { 0, 17060, 2994 }, { 0, 17064, 3007 },
+    { 19718, 17067, -1 }, { 0, 17069, 3010 }, { 0, 17070, 3013 }, { 0, 17071, 3015 }, { 0, 17073, 3018 }, { 0, 17074, 3025 },
+    { 19720, 17076, -1 }, { 0, 17077, 3038 }, { 0, 17078, 3045 }, { 0, 17079, 3047 }, { 19720, 17081, -1 }, { 19718, 17082, -1 },
+    { 0, 17083, 3072 }, { 19722, 17084, -1 }, { 19723, 17085, -1 }, { 19720, 17086, -1 }, { 19724, 17087, -1 }, { 0, 17088, 3099 },
+    { 19726, 17089, -1 }, { 0, 17090, 3105 }, { 0, 17091, 3106 }, { 19727, 17092, -1 }, { 0, 17093, 3112 }, { 0, 17094, 3137 },
+    { 0, 17097, 3144 }, { 0, 17098, 3157 }, { 0, 17099, 3169 }, { 0, 17100, 3170 }, { 0, 17101, 3171 }, { 0, 17102, 3173 },
+    { 19726, 17103, -1 }, { 0, 17104, 3189 }, { 0, 17105, 3191 }, { 0, 17106, 3192 }, { 19727, 17107, -1 }, { 19727, 17108, -1 },
+    { 0, 17109, 3203 }, { 19728, 17110, -1 }, { 19732, 17111, -1 }, { 0, 17112, 3206 }, { 0, 17113, 3223 }, { 19734, 17114, -1 },
+    { 19734, 17115, -1 }, { 0, 17116, 3250 }, { 0, 17117, 3256 }, { 0, 17118, 3260 }, { 19736, 17119, -1 }, { 0, 17120, 3266 },
+    { 19733, 17121, -1 }, { 0, 17122, 3277 }, { 19736, 17123, -1 }, { 0, 17126, 3279 }, { 0, 17127, 3280 }, { 0, 17139, 3281 },
+    { 0, 17169, 3282 }, { 0, 17124, 3283 }, { 0, 17128, 3284 }, { 0, 17147, 3285 }, { 0, 17125, 3286 }, { 0, 17129, 3287 },
+    { 0, 17132, 3288 }, { 0, 17137, 3289 }, { 0, 17130, 3290 }, { 19735, 17131, 3291 }, { 19737, 17133, -1 }, { 0, 17134, 3295 },
+    { 0, 17135, 3296 }, { 19740, 17136, -1 }, { 19741, 17138, -1 }, { 0, 17140, 3300 }, { 0, 17141, 3301 }, { 0, 17142, 3302 },
+    { 19741, 17143, -1 }, { 0, 17144, 3306 }, { 19743, 17145, -1 }, { 0, 17146, 3313 }, { 0, 17148, 3314 }, { 0, 17149, 3320 },
+    { 0, 17190, 3321 }, { 0, 17150, 3325 }, { 0, 17151, 3331 }, { 0, 17152, 3335 }, { 0, 17153, 3340 }, { 19744, 17154, -1 },
+    { 19741, 17155, -1 }, { 19742, 17166, -1 }, { 0, 17156, 3355 }, { 0, 17157, 3359 }, { 19748, 17158, -1 }, { 19748, 17159, -1 },
+    { 0, 17160, 3371 }, { 0, 17161, 3376 }, { 0, 17162, 3378 }, { 0, 17163, 3383 }, { 19748, 17164, -1 }, { 19747, 17165, -1 },
+    { 0, 17167, 3391 }, { 0, 17168, 3392 }, { 19750, 17170, -1 }, { 0, 17171, 3395 }, { 0, 17172, 3396 }, { 19753, 17173, -1 },
+    { 19753, 17174, -1 }, { 19756, 17175, -1 }, { 19754, 17176, -1 }, { 0, 17177, 3410 }, { 19754, 17178, -1 }, { 0, 17179, 3416 },
+    { 0, 17180, 3420 }, { 19758, 17181, -1 }, { 0, 17182, 3431 }, { 19759, 17183, -1 }, { 19757, 17184, -1 }, { 19761, 17185, -1 },
+    { 0, 17186, 3444 }, { 0, 17187, 3445 }, { 19760, 17188, -1 }, { 19763, 17189, -1 }, { 0, 17191, 3449 }, { 19764, 17192, 3453 },
+    { 19766, 17193, 3461 }, { 0, 17194, 3475 }, { 0, 17195, 3478 }, { 0, 17196, 3480 }, { 19770, 17197, -1 }, { 0, 17198, 3486 },
+    { 0, 17199, 3488 }, { 19770, 17200, -1 }, { 0, 17201, 3496 }, { 19769, 17202, -1 }, { 0, 17203, 3498 }, { 19772, 17204, -1 },
+    { 19770, 17205, -1 }, { 0, 17206, 3505 }, { 0, 17207, 3506 }, { 0, 17208, 3507 }, { 0, 17209, 3509 }, { 0, 17210, 3510 },
+    { 19772, 17211, -1 }, { 0, 17212, 3513 }, { 19775, 17213, -1 }, { 19773, 17214, -1 }, { 0, 17215, 3522 }, { 0, 17216, 3523 },
+    { 0, 17217, 3526 }, { 0, 17218, 3528 }, { 19778, 17219, -1 }, { 0, 17220, 3532 }, { 0, 17221, 3536 }, { 0, 17222, 3552 },
+    { 0, 17223, 3553 }, { 19776, 17224, 3554 }, { 19780, 17225, -1 }, { 0, 17226, 3565 }, { 0, 17227, 3567 }, { 0, 17228, 3568 },
+    { 0, 17229, 3569 }, { 0, 17230, 3570 }, { 19777, 17231, -1 }, { 19782, 17232, -1 }, { 0, 17233, 3578 }, { 0, 17234, 3581 },
+    { 0, 17235, 3587 }, { 19782, 17236, -1 }, { 0, 17237, 3591 }, { 0, 17238, 3596 }, { 0, 17239, 3607 }, { 0, 17240, 3611 },
+    { 0, 17241, 3615 }, { 0, 17242, 3625 }, { 0, 17243, 3627 }, { 0, 17244, 3628 }, { 0, 17245, 3630 }, { 0, 17246, 3645 },
+    { 0, 17247, 3650 }, { 0, 17248, 3652 }, { 19781, 17249, -1 }, { 0, 17250, 3665 }, { 0, 17251, 3674 }, { 0, 17252, 3684 },
+    { 19785, 17253, -1 }, { 0, 17254, 3687 }, { 0, 17255, 3690 }, { 0, 17256, 3706 }, { 0, 17257, 3720 }, { 0, 17258, 3722 },
+    { 0, 17259, 3730 }, { 0, 17260, 3736 }, { 0, 17261, 3745 }, { 19786, 17262, -1 }, { 0, 17263, 3761 }, { 19786, 17264, -1 },
+    { 19787, 17265, -1 }, { 19789, 17266, -1 }, { 19790, 17267, -1 }, { 0, 17268, 3785 }, { 19789, 17269, -1 }, { 19790, 17270, -1 },
+    { 19792, 17271, -1 }, { 19790, 17272, -1 }, { 19791, 17273, -1 }, { 19796, 17274, -1 }, { 19795, 17275, -1 }, { 0, 17276, 3831 },
+    { 19794, 17277, -1 }, { 0, 17278, 3836 }, { 19799, 17279, -1 }, { 0, 17280, 3838 }, { 19796, 17281, -1 }, { 0, 17282, 3847 },
+    { 0, 17283, 3851 }, { 19798, 17284, -1 }, { 0, 17285, 3858 }, { 19799, 17286, -1 }, { 0, 17310, 3860 }, { 0, 17287, 3863 },
+    { 19800, 17288, -1 }, { 19800, 17312, -1 }, { 0, 17289, 3866 }, { 19802, 17290, -1 }, { 19803, 17291, -1 }, { 19803, 17315, -1 },
+    { 19804, 17292, -1 }, { 0, 17293, 3884 }, { 19809, 17294, -1 }, { 0, 17295, 3888 }, { 0, 17296, 3889 }, { 0, 17297, 3902 },
+    { 0, 17298, 3913 }, { 0, 17299, 3914 }, { 19810, 17300, -1 }, { 19810, 17301, -1 }, { 0, 17302, 3934 }, { 19812, 17303, -1 },
+    { 0, 17304, 3950 }, { 19814, 17305, -1 }, { 0, 17306, 3966 }, { 19811, 17307, -1 }, { 19815, 17308, -1 }, { 0, 17309, 3990 },
+    { 0, 17311, 3991 }, { 0, 17313, 3992 }, { 0, 17314, 3993 }, { 0, 17316, 3994 }, { 0, 17317, 3995 }, { 0, 17318, 3996 },
+    { 0, 17319, 3997 }, { 0, 17320, 4020 }, { 19813, 17321, -1 }, { 0, 17322, 4024 }, { 0, 17323, 4029 }, { 19816, 17324, -1 },
+    { 0, 17325, 4031 }, { 0, 17326, 4033 }, { 19819, 17327, -1 }, { 0, 17328, 4038 }, { 19820, 17329, -1 }, { 19820, 17330, -1 },
+    { 19821, 17331, -1 }, { 19822, 17332, -1 }, { 0, 17333, 4078 }, { 19820, 17334, -1 }, { 19825, 17335, -1 }, { 19825, 17336, -1 },
+    { 19827, 17337, -1 }, { 0, 17338, 4108 }, { 19828, 17339, -1 }, { 19829, 17340, -1 }, { 19831, 17341, -1 }, { 19827, 17342, -1 },
+    { 0, 17343, 4155 }, { 19829, 17344, 4156 }, { 0, 17345, 4161 }, { 0, 17346, 4170 }, { 0, 17347, 4172 }, { 0, 17348, 4173 },
+    { 0, 17349, 4178 }, { 0, 17350, 4192 }, { 0, 17351, 4194 }, { 0, 17352, 4195 }, { 0, 17353, 4196 }, { 0, 17354, 4200 },
+    { 0, 17355, 4214 }, { 19833, 17356, -1 }, { 19834, 17357, -1 }, { 0, 17358, 4236 }, { 0, 17359, 4238 }, { 0, 17360, 4239 },
+    { 0, 17361, 4250 }, { 19833, 17362, -1 }, { 19836, 17363, -1 }, { 19834, 17364, -1 }, { 19835, 17365, -1 }, { 0, 17366, 4274 },
+    { 0, 17367, 4281 }, { 0, 17368, 4284 }, { 0, 17369, 4291 }, { 19836, 17370, 4292 }, { 0, 17371, 4294 }, { 19840, 17372, -1 },
+    { 0, 17373, 4299 }, { 19841, 17374, -1 }, { 0, 17375, 4320 }, { 0, 17376, 4321 }, { 19838, 17377, -1 }, { 19843, 17378, -1 },
+    { 19844, 17379, -1 }, { 0, 17380, 4339 }, { 0, 17381, 4341 }, { 0, 17382, 4342 }, { 0, 17383, 4357 }, { 0, 17384, 4358 },
+    { 0, 17385, 4359 }, { 0, 17386, 4360 }, { 0, 17387, 4362 }, { 0, 17388, 4364 }, { 0, 17389, 4366 }, { 19842, 17390, -1 },
+    { 19845, 17391, -1 }, { 19844, 17392, 4374 }, { 0, 17393, 4376 }, { 0, 17394, 4377 }, { 0, 17395, 4378 }, { 0, 17396, 4379 },
+    { 0, 17397, 4380 }, { 19844, 17398, -1 }, { 0, 17399, 4383 }, { 0, 17400, 4392 }, { 0, 17401, 4393 }, { 0, 17402, 4394 },
+    { 0, 17403, 4395 }, { 19847, 17404, -1 }, { 19851, 17405, -1 }, { 0, 17406, 4437 }, { 0, 17407, 4440 }, { 19849, 17408, -1 },
+    { 0, 17409, 4446 }, { 19852, 17410, -1 }, { 0, 17411, 4448 }, { 0, 17412, 4449 }, { 19854, 17413, -1 }, { 0, 17414, 4453 },
+    { 19854, 17415, 4454 }, { 0, 17416, 4457 }, { 0, 17417, 4458 }, { 0, 17418, 4459 }, { 0, 17419, 4460 }, { 0, 17420, 4461 },
+    { 0, 17421, 4462 }, { 0, 17422, 4464 }, { 19854, 17423, -1 }, { 0, 17424, 4468 }, { 19856, 17425, 4469 }, { 19855, 17426, -1 },
+    { 19856, 17427, -1 }, { 19860, 17428, -1 }, { 0, 17429, 4506 }, { 0, 17430, 4514 }, { 0, 17431, 4515 }, { 0, 17432, 4520 },
+    { 0, 17433, 4530 }, { 19857, 17434, 4532 }, { 0, 17435, 4540 }, { 0, 17436, 4542 }, { 19861, 17437, -1 }, { 19863, 17438, -1 },
+    { 0, 17439, 4596 }, { 0, 17478, 4597 }, { 0, 17485, 4598 }, { 0, 17440, 4599 }, { 0, 17441, 4600 }, { 0, 17447, 4601 },
+    { 0, 17442, 4602 }, { 0, 17462, 4603 }, { 0, 17443, 4604 }, { 19863, 17444, -1 }, { 0, 17445, 4614 }, { 0, 17446, 4615 },
+    { 19864, 17448, -1 }, { 19862, 17449, -1 }, { 19862, 17450, -1 }, { 0, 17451, 4632 }, { 19867, 17452, -1 }, { 19868, 17453, -1 },
+    { 19866, 17454, -1 }, { 0, 17455, 4649 }, { 19867, 17456, -1 }, { 19871, 17457, -1 }, { 0, 17458, 4662 }, { 19871, 17459, -1 },
+    { 19872, 17460, -1 }, { 0, 17461, 4675 }, { 19874, 17463, -1 }, { 19875, 17464, -1 }, { 0, 17465, 4703 }, { 0, 17466, 4704 },
+    { 0, 17467, 4707 }, { 0, 17468, 4730 }, { 19872, 17469, -1 }, { 19876, 17470, -1 }, { 0, 17471, 4748 }, { 0, 17473, 4749 },
+    { 0, 17472, 4750 }, { 19878, 17482, -1 }, { 0, 17474, 4752 }, { 0, 17475, 4753 }, { 0, 17476, 4754 }, { 19879, 17477, -1 },
+    { 0, 17479, 4758 }, { 0, 17480, 4776 }, { 19880, 17481, -1 }, { 0, 17483, 4779 }, { 0, 17484, 4783 }, { 19878, 17486, -1 },
+    { 19880, 17487, -1 }, { 19880, 17488, -1 }, { 19881, 17489, -1 }, { 0, 17490, 4818 }, { 0, 17491, 4841 }, { 19885, 17492, -1 },
+    { 0, 17493, 4851 }, { 0, 17494, 4863 }, { 0, 17495, 4864 }, { 19885, 17496, -1 }, { 0, 17497, 4884 }, { 0, 17498, 4911 },
+    { 19886, 17499, -1 }, { 0, 17500, 4920 }, { 0, 17501, 4951 }, { 0, 17502, 4952 }, { 0, 17503, 4978 }, { 0, 17504, 4995 },
+    { 0, 17505, 4996 }, { 19889, 17506, 4999 }, { 19887, 17507, -1 }, { 0, 17508, 5009 }, { 0, 17509, 5010 }, { 0, 17520, 5011 },
+    { 0, 17522, 5012 }, { 19887, 17510, -1 }, { 0, 17511, 5014 }, { 19892, 17512, -1 }, { 0, 17513, 5028 }, { 0, 17514, 5030 },
+    { 0, 17515, 5031 }, { 19893, 17516, -1 }, { 19892, 17517, -1 }, { 19895, 17518, -1 }, { 19893, 17519, -1 }, { 0, 17521, 5053 },
+    { 0, 17523, 5057 }, { 0, 17524, 5078 }, { 0, 17525, 5083 }, { 0, 17526, 5084 }, { 19896, 17527, -1 }, { 0, 17528, 5098 },
+    { 0, 17529, 5099 }, { 0, 17530, 5117 }, { 0, 17531, 5137 }, { 0, 17532, 5142 }, { 19896, 17533, -1 }, { 19898, 17534, -1 },
+    { 0, 17535, 5148 }, { 19896, 17536, -1 }, { 0, 17537, 5150 }, { 19900, 17538, -1 }, { 19902, 17539, -1 }, { 19901, 17540, -1 },
+    { 0, 17541, 5157 }, { 19904, 17542, -1 }, { 19906, 17543, -1 }, { 19908, 17546, -1 }, { 19909, 17544, -1 }, { 19906, 17545, -1 },
+    { 19909, 17547, -1 }, { 19909, 17548, -1 }, { 19908, 17549, -1 }, { 19913, 17550, -1 }, { 19911, 17551, -1 }, { 19914, 17552, -1 },
+    { 19916, 17553, 5183 }, { 0, 17554, 5193 }, { 0, 17555, 5200 }, { 0, 17556, 5202 }, { 19913, 17557, -1 }, { 0, 17558, 5208 },
+    { 19914, 17559, -1 }, { 19919, 17560, -1 }, { 0, 17561, 5234 }, { 0, 17562, 5237 }, { 0, 17563, 5238 }, { 19920, 17564, -1 },
+    { 0, 17565, 5247 }, { 0, 17566, 5250 }, { 0, 17567, 5252 }, { 0, 17568, 5263 }, { 0, 17569, 5271 }, { 19921, 17570, -1 },
+    { 19919, 17571, -1 }, { 0, 17572, 5303 }, { 0, 17573, 5304 }, { 19924, 17574, -1 }, { 0, 17575, 5323 }, { 0, 17576, 5324 },
+    { 0, 17577, 5327 }, { 0, 17578, 5337 }, { 0, 17579, 5338 }, { 19924, 17580, -1 }, { 0, 17581, 5347 }, { 19923, 17582, -1 },
+    { 0, 17583, 5349 }, { 19922, 17584, -1 }, { 0, 17585, 5357 }, { 0, 17586, 5377 }, { 0, 17587, 5391 }, { 19927, 17588, -1 },
+    { 19928, 17589, -1 }, { 19928, 17590, -1 }, { 19930, 17591, -1 }, { 0, 17592, 5419 }, { 19930, 17593, -1 }, { 19932, 17594, 5446 },
+    { 19932, 17595, -1 }, { 0, 17596, 5463 }, { 19932, 17597, -1 }, { 19935, 17598, -1 }, { 19933, 17648, -1 }, { 19937, 17599, -1 },
+    { 19936, 17600, -1 }, { 0, 17601, 5483 }, { 0, 17602, 5484 }, { 0, 17603, 5500 }, { 0, 17604, 5502 }, { 0, 17605, 5503 },
+    { 0, 17606, 5504 }, { 19936, 17607, -1 }, { 19939, 17608, -1 }, { 19940, 17609, -1 }, { 0, 17610, 5530 }, { 0, 17611, 5531 },
+    { 19940, 17612, -1 }, { 0, 17613, 5535 }, { 0, 17614, 5544 }, { 0, 17615, 5545 }, { 0, 17616, 5546 }, { 0, 17617, 5550 },
+    { 19941, 17618, -1 }, { 0, 17619, 5577 }, { 0, 17620, 5588 }, { 0, 17621, 5606 }, { 19941, 17622, -1 }, { 19945, 17623, -1 },
+    { 0, 17624, 5649 }, { 0, 17625, 5651 }, { 0, 17626, 5661 }, { 0, 17603, 5501 }, { 19944, 17627, -1 }, { 0, 17628, 5680 },
+    { 0, 17629, 5686 }, { 0, 17630, 5718 }, { 19947, 17631, -1 }, { 19948, 17632, -1 }, { 0, 17633, 5748 }, { 19949, 17634, -1 },
+    { 19950, 17635, -1 }, { 0, 17636, 5772 }, { 0, 17637, 5786 }, { 0, 17638, 5794 }, { 0, 17639, 5811 }, { 0, 17640, 5854 },
+    { 19951, 17641, -1 }, { 19949, 17642, -1 }, { 0, 17643, 5878 }, { 0, 17644, 5879 }, { 0, 17645, 5880 }, { 0, 17646, 5883 },
+    { 0, 17647, 5885 }, { 0, 17649, 5894 }, { 19954, 17650, -1 }, { 0, 17651, 5912 }, { 19951, 17652, -1 }, { 0, 17653, 5922 },
+    { 0, 17654, 5923 }, { 19955, 17655, -1 }, { 19952, 17656, -1 }, { 0, 17657, 5952 }, { 19957, 17658, -1 }, { 0, 17659, 6002 },
+    { 0, 17660, 6010 }, { 19959, 17661, -1 }, { 0, 17662, 6019 }, { 0, 17663, 6020 }, { 0, 17664, 6022 }, { 0, 17665, 6023 },
+    { 0, 17666, 6024 }, { 0, 17667, 6025 }, { 0, 17672, 6026 }, { 0, 17678, 6027 }, { 0, 17668, 6028 }, { 0, 17717, 6029 },
+    { 0, 17669, 6030 }, { 19956, 17670, 6032 }, { 0, 17674, 6034 }, { 0, 17673, 6035 }, { 19959, 17680, -1 }, { 0, 17683, 6037 },
+    { 0, 17696, 6038 }, { 0, 17714, 6039 }, { 0, 17726, 6040 }, { 0, 17671, 6041 }, { 0, 17694, 6042 }, { 0, 17675, 6043 },
+    { 0, 17676, 6044 }, { 0, 17677, 6045 }, { 0, 17695, 6046 }, { 0, 17698, 6047 }, { 0, 17703, 6048 }, { 0, 17679, 6052 },
+    { 19961, 17681, -1 }, { 0, 17682, 6059 }, { 19962, 17684, -1 }, { 0, 17685, 6072 }, { 0, 17686, 6073 }, { 19963, 17687, -1 },
+    { 0, 17688, 6082 }, { 0, 17689, 6087 }, { 0, 17690, 6089 }, { 19965, 17691, -1 }, { 0, 17692, 6097 }, { 0, 17693, 6100 },
+    { 19968, 17697, -1 }, { 19965, 17699, -1 }, { 19967, 17700, -1 }, { 0, 17704, 6113 }, { 0, 17701, 6114 }, { 0, 17702, 6115 },
+    { 19971, 17705, -1 }, { 0, 17706, 6138 }, { 19973, 17707, -1 }, { 19973, 17708, -1 }, { 19973, 17710, -1 }, { 19973, 17721, -1 },
+    { 19974, 17727, -1 }, { 0, 17709, 6167 }, { 0, 17711, 6172 }, { 0, 17712, 6174 }, { 19977, 17713, -1 }, { 0, 17715, 6177 },
+    { 19979, 17716, -1 }, { 0, 17718, 6220 }, { 0, 17719, 6223 }, { 19980, 17720, -1 }, { 19980, 17722, -1 }, { 0, 17723, 6234 },
+    { 0, 17724, 6236 }, { 0, 17725, 6238 }, { 19980, 17728, -1 }, { 0, 17729, 6244 }, { 19984, 17730, -1 }, { 19981, 17731, -1 },
+    { 19985, 17732, -1 }, { 0, 17733, 6275 }, { 19986, 17734, -1 }, { 0, 17735, 6282 }, { 19987, 17736, -1 }, { 0, 17737, 6288 },
+    { 0, 17738, 6293 }, { 0, 17739, 6296 }, { 0, 17740, 6297 }, { 0, 17741, 6299 }, { 0, 17742, 6300 }, { 0, 17743, 6302 },
+    { 0, 17752, 6303 }, { 0, 17744, 6304 }, { 0, 17745, 6305 }, { 19985, 17746, -1 }, { 19989, 17747, -1 }, { 19992, 17748, -1 },
+    { 19993, 17757, -1 }, { 19994, 17760, -1 }, { 19994, 17749, -1 }, { 0, 17750, 6353 }, { 0, 17751, 6354 }, { 0, 17753, 6359 },
+    { 19991, 17754, -1 }, { 0, 17755, 6370 }, { 0, 17756, 6374 }, { 0, 17758, 6399 }, { 0, 17820, 6400 }, { 0, 17759, 6401 },
+    { 0, 17761, 6402 }, { 0, 17774, 6403 }, { 0, 17762, 6404 }, { 0, 17791, 6405 }, { 0, 17763, 6410 }, { 19992, 17764, -1 },
+    { 19994, 17765, -1 }, { 19998, 17766, -1 }, { 19996, 17767, -1 }, { 0, 17768, 6606 }, { 0, 17769, 6630 }, { 20001, 17770, -1 },
+    { 0, 17803, 6632 }, { 20001, 17804, -1 }, { 0, 17771, 6634 }, { 0, 17772, 6636 }, { 0, 17773, 6642 }, { 19999, 17775, -1 },
+    { 20003, 17776, -1 }, { 0, 17777, 6660 }, { 0, 17778, 6670 }, { 0, 17779, 6703 }, { 0, 17780, 6708 }, { 0, 17781, 6709 },
+    { 0, 17782, 6713 }, { 20002, 17783, -1 }, { 0, 17784, 6725 }, { 0, 17785, 6737 }, { 0, 17786, 6748 }, { 0, 17787, 6749 },
+    { 20003, 17788, -1 }, { 20005, 17789, -1 }, { 0, 17790, 6767 }, { 20007, 17792, -1 }, { 0, 17793, 6770 }, { 0, 17794, 6771 },
+    { 0, 17795, 6776 }, { 0, 17796, 6777 }, { 20008, 17797, -1 }, { 20009, 17798, -1 }, { 0, 17799, 6795 }, { 0, 17800, 6796 },
+    { 0, 17801, 6797 }, { 0, 17802, 6799 }, { 0, 17806, 6800 }, { 0, 17819, 6801 }, { 0, 17805, 6802 }, { 0, 17811, 6803 },
+    { 0, 17807, 6804 }, { 0, 17839, 6805 }, { 0, 17808, 6806 }, { 0, 17809, 6810 }, { 0, 17810, 6813 }, { 0, 17812, 6817 },
+    { 0, 17813, 6820 }, { 0, 17814, 6821 }, { 0, 17815, 6823 }, { 0, 17816, 6826 }, { 0, 17817, 6831 }, { 20006, 17818, -1 },
+    { 0, 17821, 6846 }, { 0, 17822, 6850 }, { 20007, 17823, -1 }, { 0, 17824, 6854 }, { 0, 17825, 6865 }, { 0, 17826, 6866 },
+    { 0, 17827, 6870 }, { 20012, 17828, -1 }, { 0, 17829, 6893 }, { 0, 17830, 6911 }, { 20013, 17831, -1 }, { 20014, 17832, -1 },
+    { 20016, 17833, -1 }, { 20017, 17834, -1 }, { 0, 17835, 6933 }, { 0, 17836, 6935 }, { 20016, 17837, -1 }, { 20016, 17838, -1 },
+    { 20016, 17840, -1 }, { 20018, 17841, -1 }, { 0, 17842, 6953 }, { 0, 17843, 6974 }, { 0, 17844, 6993 }, { 20021, 17845, -1 },
+    { 20022, 17846, -1 }, { 0, 17847, 7014 }, { 20023, 17848, -1 }, { 20024, 17849, -1 }, { 0, 17850, 7071 }, { 0, 17851, 7076 },
+    { 0, 17852, 7077 }, { 20025, 17853, -1 }, { 20024, 17854, -1 }, { 0, 17855, 7161 }, { 0, 17856, 7165 }, { 20026, 17857, -1 },
+    { 20027, 17858, -1 }, { 0, 17859, 7170 }, { 20028, 17860, -1 }, { 0, 17861, 7224 }, { 0, 17862, 7242 }, { 0, 17863, 7243 },
+    { 0, 17864, 7246 }, { 0, 17865, 7248 }, { 0, 17867, 7249 }, { 20028, 17866, -1 }, { 20029, 17868, -1 }, { 0, 17869, 7253 },
+    { 0, 17870, 7254 }, { 0, 17871, 7255 }, { 0, 17872, 7257 }, { 0, 17873, 7259 }, { 20032, 17874, -1 }, { 0, 17875, 7262 },
+    { 0, 17876, 7263 }, { 0, 17877, 7272 }, { 0, 17878, 7276 }, { 20031, 17879, -1 }, { 20032, 17880, -1 }, { 20033, 17881, -1 },
+    { 20037, 17882, -1 }, { 0, 17883, 7299 }, { 0, 17884, 7301 }, { 20082, 17887, -1 }, { 20130, 17890, -1 }, { 20132, 17891, -1 },
+    { 20132, 17893, -1 }, { 20081, 17895, -1 }, { 20096, 17896, -1 }, { 20126, 17897, -1 }, { 20124, 17900, -1 }, { 20139, 17904, -1 },
+    { 20133, 17905, -1 }, { 20092, 17906, -1 }, { 20088, 17909, -1 }, { 20106, 17912, -1 }, { 20118, 17917, -1 }, { 20122, 17918, -1 },
+    { 20091, 17922, -1 }, { 20139, 17923, -1 }, { 20121, 17952, -1 }, { 20100, 17953, -1 }, { 20125, 17954, -1 }, { 20151, 17955, -1 },
+    { 20150, 17959, -1 }, { 20102, 17960, -1 }, { 20156, 17963, -1 }, { 20144, 17967, -1 }, { 20159, 17968, -1 }, { 20130, 17969, -1 },
+    { 20132, 17979, -1 }, { 20124, 17981, -1 }, { 20167, 17983, -1 }, { 20146, 17986, -1 }, { 20128, 17987, -1 }, { 20143, 17989, -1 },
+    { 20162, 18014, -1 }, { 20163, 17991, -1 }, { 20156, 17992, -1 }, { 20146, 17993, -1 }, { 20155, 17994, -1 }, { 20139, 17995, -1 },
+    { 20161, 17996, -1 }, { 20169, 17997, -1 }, { 20146, 18001, -1 }, { 20151, 18001, -1 }, { 20174, 18017, -1 }, { 20136, 18019, -1 },
+    { 20125, 18021, -1 }, { 20164, 18023, -1 }, { 20126, 18028, -1 }, { 20138, 18033, -1 }, { 20173, 18037, -1 }, { 20150, 18038, -1 },
+    { 20153, 18039, -1 }, { 20140, 18040, -1 }, { 20180, 18038, -1 }, { 20182, 18039, -1 }, { 20138, 18041, -1 }, { 20169, 18042, -1 },
+    { 20192, 18045, -1 }, { 20174, 18046, -1 }, { 20187, 18052, -1 }, { 20169, 18065, -1 }, { 20194, 18071, -1 }, { 20173, 18079, -1 },
+    { 20153, 18081, -1 }, { 20153, 18103, -1 }, { 20180, 18106, -1 }, { 20159, 18108, -1 }, { 20198, 18109, -1 }, { 20201, 18113, -1 },
+    { 20206, 18122, -1 }, { 20167, 18123, -1 }, { 20173, 18126, -1 }, { 20175, 18127, -1 }, { 20179, 18130, -1 }, { 20180, 18133, -1 },
+    { 20200, 18135, -1 }, { 20201, 18137, -1 }, { 20195, 18137, -1 }, { 20172, 18138, -1 }, { 20170, 18140, -1 }, { 20192, 18142, -1 },
+    { 20204, 18145, -1 }, { 20213, 18148, -1 }, { 20198, 18150, -1 }, { 20202, 18151, -1 }, { 20179, 18156, -1 }, { 20164, 18159, -1 },
+    { 20199, 18160, -1 }, { 20179, 18161, -1 }, { 20213, 18162, -1 }, { 20200, 18163, -1 }, { 20172, 18176, -1 }, { 20216, 18178, -1 },
+    { 20206, 18183, -1 }, { 20218, 18187, -1 }, { 20234, 18190, -1 }, { 20211, 18191, -1 }, { 20178, 18194, -1 }, { 20213, 18209, -1 },
+    { 20231, 18212, -1 }, { 20211, 18215, -1 }, { 20184, 18216, -1 }, { 20185, 18217, -1 }, { 20182, 18226, -1 }, { 20229, 18228, -1 },
+    { 20216, 18229, -1 }, { 20189, 18243, -1 }, { 20238, 18245, -1 }, { 20208, 18246, -1 }, { 20203, 18247, -1 }, { 20194, 18250, -1 },
+    { 20221, 18251, -1 }, { 20215, 18260, -1 }, { 20242, 18262, -1 }, { 20239, 18264, -1 }, { 20192, 18262, -1 }, { 20233, 18269, -1 },
+    { 20223, 18271, -1 }, { 20202, 18273, -1 }, { 20240, 18275, -1 }, { 20211, 18277, -1 }, { 20256, 18279, -1 }, { 20256, 18282, -1 },
+    { 20251, 18284, -1 }, { 20241, 18285, -1 }, { 20235, 18287, -1 }, { 20261, 18295, -1 }, { 20230, 18305, -1 }, { 20205, 18307, -1 },
+    { 20262, 18308, -1 }, { 20263, 18309, -1 }, { 20213, 18310, -1 }, { 20262, 18311, -1 }, { 20247, 18313, -1 }, { 20255, 18314, -1 },
+    { 20253, 18318, -1 }, { 20269, 18320, -1 }, { 20219, 18322, -1 }, { 20233, 18323, -1 }, { 20255, 18329, -1 }, { 20243, 18331, -1 },
+    { 20233, 18332, -1 }, { 20258, 18333, -1 }, { 20221, 18338, -1 }, { 20254, 18339, -1 }, { 20283, 18347, -1 }, { 20256, 18350, -1 },
+    { 20250, 18352, -1 }, { 20251, 18353, -1 }, { 20272, 18356, -1 }, { 20287, 18357, -1 }, { 20232, 18358, -1 }, { 20236, 18359, -1 },
+    { 20292, 18361, -1 }, { 20242, 18365, -1 }, { 20265, 18366, -1 }, { 20280, 18369, -1 }, { 20281, 18370, -1 }, { 20282, 18373, -1 },
+    { 20250, 18376, -1 }, { 20272, 18378, -1 }, { 20253, 18380, -1 }, { 20295, 18384, -1 }, { 20294, 18385, -1 }, { 20246, 18388, -1 },
+    { 20258, 18390, -1 }, { 20270, 18392, -1 }, { 20273, 18394, -1 }, { 20292, 18395, -1 }, { 20289, 18396, -1 }, { 20295, 18397, -1 },
+    { 20267, 18400, -1 }, { 20307, 18401, -1 }, { 20308, 18402, -1 }, { 20309, 18404, -1 }, { 20270, 18408, -1 }, { 20277, 18409, -1 },
+    { 20258, 18411, -1 }, { 20310, 18413, -1 }, { 20272, 18415, -1 }, { 20290, 18416, -1 }, { 20273, 18421, -1 }, { 20293, 18424, -1 },
+    { 20301, 18425, -1 }, { 20302, 18426, -1 }, { 20268, 18427, -1 }, { 20278, 18436, -1 }, { 20266, 18438, -1 }, { 20295, 18440, -1 },
+    { 20268, 18443, -1 }, { 20315, 18445, -1 }, { 20315, 18446, -1 }, { 20314, 18450, -1 }, { 20312, 18459, -1 }, { 20320, 18463, -1 },
+    { 20278, 18467, -1 }, { 20275, 18468, -1 }, { 20304, 18479, -1 }, { 20309, 18479, -1 }, { 20331, 18480, -1 }, { 20325, 18482, -1 },
+    { 20337, 18484, -1 }, { 20279, 18485, -1 }, { 20328, 18487, -1 }, { 20333, 18488, -1 }, { 20339, 18490, -1 }, { 20334, 18496, -1 },
+    { 20314, 18497, -1 }, { 20330, 18498, -1 }, { 20334, 18500, -1 }, { 20335, 18503, -1 }, { 20322, 18504, -1 }, { 20304, 18505, -1 },
+    { 20293, 18506, -1 }, { 20340, 18507, -1 }, { 20295, 18509, -1 }, { 20331, 18510, -1 }, { 20343, 18511, -1 }, { 20347, 18512, -1 },
+    { 20303, 18516, -1 }, { 20324, 18517, -1 }, { 20335, 18519, -1 }, { 20362, 18521, -1 }, { 20307, 18522, -1 }, { 20341, 18525, -1 },
+    { 20310, 18527, -1 }, { 20359, 18531, -1 }, { 20319, 18533, -1 }, { 20306, 18538, -1 }, { 20362, 18539, -1 }, { 20337, 18542, -1 },
+    { 20338, 18554, -1 }, { 20343, 18554, -1 }, { 20325, 18558, -1 }, { 20366, 18560, -1 }, { 20347, 18561, -1 }, { 20317, 18564, -1 },
+    { 20319, 18565, -1 }, { 20342, 18569, -1 }, { 20353, 18570, -1 }, { 20358, 18571, -1 }, { 20339, 18573, -1 }, { 20364, 18578, -1 },
+    { 20369, 18579, -1 }, { 20351, 18581, -1 }, { 20378, 18591, -1 }, { 20379, 18596, -1 }, { 20386, 18605, -1 }, { 20361, 18607, -1 },
+    { 20331, 18608, -1 }, { 20374, 18613, -1 }, { 20333, 18615, -1 }, { 20376, 18618, -1 }, { 20342, 18620, -1 }, { 20333, 18632, -1 },
+    { 20337, 18636, -1 }, { 20335, 18637, -1 }, { 20351, 18637, -1 }, { 20358, 18639, -1 }, { 20339, 18642, -1 }, { 20377, 18646, -1 },
+    { 20346, 18648, -1 }, { 20380, 18652, -1 }, { 20355, 18659, -1 }, { 20392, 18661, -1 }, { 20345, 18664, -1 }, { 20399, 18666, -1 },
+    { 20387, 18669, -1 }, { 20352, 18670, -1 }, { 20394, 18672, -1 }, { 20351, 18675, -1 }, { 20365, 18676, -1 }, { 20385, 18677, -1 },
+    { 20373, 18679, -1 }, { 20378, 18680, -1 }, { 20367, 18681, -1 }, { 20401, 18794, -1 }, { 20394, 18795, -1 }, { 20387, 18797, -1 },
+    { 20396, 18798, -1 }, { 20359, 18799, -1 }, { 20415, 18801, -1 }, { 20386, 18802, -1 }, { 20387, 18803, -1 }, { 20370, 18804, -1 },
+    { 20369, 18805, -1 }, { 20399, 18806, -1 }, { 20391, 18807, -1 }, { 20380, 18808, -1 }, { 20421, 18812, -1 }, { 20374, 18813, -1 },
+    { 20386, 18814, -1 }, { 20419, 18815, -1 }, { 20389, 18817, -1 }, { 20405, 18818, -1 }, { 20375, 18819, -1 }, { 20408, 18821, -1 },
+    { 20376, 18822, -1 }, { 20411, 18823, -1 }, { 20414, 18824, -1 }, { 20435, 18834, -1 }, { 20382, 18840, -1 }, { 20396, 18844, -1 },
+    { 20440, 18845, -1 }, { 20429, 18847, -1 }, { 20440, 18848, -1 }, { 20425, 18849, -1 }, { 20419, 18850, -1 }, { 20413, 18852, -1 },
+    { 20401, 18855, -1 }, { 20425, 18864, -1 }, { 20435, 18868, -1 }, { 20405, 18869, -1 }, { 20450, 18871, -1 }, { 20438, 18872, -1 },
+    { 20399, 18875, -1 }, { 20450, 18876, -1 }, { 20398, 18880, -1 }, { 20455, 18882, -1 }, { 20448, 18884, -1 }, { 20427, 18897, -1 },
+    { 20400, 18898, -1 }, { 20401, 18901, -1 }, { 20444, 18902, -1 }, { 20410, 18906, -1 }, { 20449, 18908, -1 }, { 20452, 18917, -1 },
+    { 20406, 18918, -1 }, { 20407, 18919, -1 }, { 20406, 18922, -1 }, { 20465, 18923, -1 }, { 20444, 18928, -1 }, { 20415, 18929, -1 },
+    { 20446, 18932, -1 }, { 20451, 18923, -1 }, { 20415, 18935, -1 }, { 20428, 18936, -1 }, { 20414, 18937, -1 }, { 20451, 18938, -1 },
+    { 20446, 18940, -1 }, { 20473, 18943, -1 }, { 20465, 18945, -1 }, { 20479, 18946, -1 }, { 20476, 18947, -1 }, { 20475, 18950, -1 },
+    { 20440, 18951, -1 }, { 20450, 18953, -1 }, { 20463, 18953, -1 }, { 20474, 18953, -1 }, { 20427, 18953, -1 }, { 20461, 18953, -1 },
+    { 20458, 18954, -1 }, { 20430, 18958, -1 }, { 20472, 18961, -1 }, { 20461, 18963, -1 }, { 20473, 18965, -1 }, { 20472, 18966, -1 },
+    { 20459, 18972, -1 }, { 20490, 18974, -1 }, { 20462, 18975, -1 }, { 20487, 18980, -1 }, { 20469, 18985, -1 }, { 20499, 18986, -1 },
+    { 20503, 18992, -1 }, { 20443, 18993, -1 }, { 20458, 18997, -1 }, { 20500, 19010, -1 }, { 20500, 19014, -1 }, { 20503, 19023, -1 },
+    { 20490, 19025, -1 }, { 20488, 19026, -1 }, { 20480, 19027, -1 }, { 20481, 19028, -1 }, { 20495, 19030, -1 }, { 20496, 19031, -1 },
+    { 20495, 19032, -1 }, { 20462, 19033, -1 }, { 20500, 19034, -1 }, { 20471, 19035, -1 }, { 20512, 19036, -1 }, { 20515, 19038, -1 },
+    { 20460, 19040, -1 }, { 20506, 19042, -1 }, { 20462, 19045, -1 }, { 20471, 19047, -1 }, { 20472, 19050, -1 }, { 20528, 19051, -1 },
+    { 20474, 19053, -1 }, { 20475, 19054, -1 }, { 20531, 19055, -1 }, { 20525, 19056, -1 }, { 20526, 19058, -1 }, { 20494, 19064, -1 },
+    { 20481, 19065, -1 }, { 20478, 19067, -1 }, { 20474, 19069, -1 }, { 20526, 19071, -1 }, { 20524, 19072, -1 }, { 20541, 19082, -1 },
+    { 20483, 19085, -1 }, { 20507, 19069, -1 }, { 20507, 19088, -1 }, { 20493, 19090, -1 }, { 20517, 19091, -1 }, { 20498, 19092, -1 },
+    { 20525, 19093, -1 }, { 20525, 19095, -1 }, { 20501, 19096, -1 }, { 20550, 19097, -1 }, { 20541, 19098, -1 }, { 20537, 19100, -1 },
+    { 20492, 19101, -1 }, { 20493, 19102, -1 }, { 20548, 19103, -1 }, { 20523, 19105, -1 }, { 20542, 19117, -1 }, { 20543, 19118, -1 },
+    { 20550, 19123, -1 }, { 20546, 19124, -1 }, { 20551, 19125, -1 }, { 20515, 19126, -1 }, { 20530, 19131, -1 }, { 20524, 19133, -1 },
+    { 20503, 19135, -1 }, { 20528, 19138, -1 }, { 20552, 19139, -1 }, { 20553, 19140, -1 }, { 20536, 19151, -1 }, { 20538, 19152, -1 },
+    { 20538, 19153, -1 }, { 20537, 19159, -1 }, { 20547, 19165, -1 }, { 20516, 19166, -1 }, { 20517, 19169, -1 }, { 20540, 19171, -1 },
+    { 20521, 19174, -1 }, { 20563, 19176, -1 }, { 20524, 19184, -1 }, { 20565, 19186, -1 }, { 20542, 19187, -1 }, { 20543, 19188, -1 },
+    { 20526, 19189, -1 }, { 20551, 19195, -1 }, { 20555, 19198, -1 }, { 20529, 19199, -1 }, { 20572, 19209, -1 }, { 20583, 19212, -1 },
+    { 20526, 19213, -1 }, { 20553, 19214, -1 }, { 20576, 19216, -1 }, { 20530, 19217, -1 }, { 20585, 19218, -1 }, { 20594, 19220, -1 },
+    { 20588, 19221, -1 }, { 20562, 19223, -1 }, { 20541, 19224, -1 }, { 20590, 19226, -1 }, { 20542, 19227, -1 }, { 20571, 19232, -1 },
+    { 20547, 19233, -1 }, { 20597, 19237, -1 }, { 20588, 19241, -1 }, { 20543, 19244, -1 }, { 20597, 19247, -1 }, { 20547, 19248, -1 },
+    { 20560, 19249, -1 }, { 20554, 19250, -1 }, { 20594, 19253, -1 }, { 20554, 19257, -1 }, { 20600, 19260, -1 }, { 20553, 19267, -1 },
+    { 20598, 19267, -1 }, { 20602, 19268, -1 }, { 20553, 19273, -1 }, { 20601, 19275, -1 }, { 20559, 19279, -1 }, { 20615, 19280, -1 },
+    { 20559, 19281, -1 }, { 20599, 19282, -1 }, { 20567, 19288, -1 }, { 20560, 19294, -1 }, { 20594, 19295, -1 }, { 20617, 19297, -1 },
+    { 20621, 19299, -1 }, { 20590, 19300, -1 }, { 20623, 19301, -1 }, { 20615, 19303, -1 }, { 20571, 19304, -1 }, { 20625, 19304, -1 },
+    { 20573, 19305, -1 }, { 20574, 19306, -1 }, { 20585, 19307, -1 }, { 20606, 19308, -1 }, { 20615, 19309, -1 }, { 20615, 19310, -1 },
+    { 20581, 19311, -1 }, { 20575, 19312, -1 }, { 20607, 19313, -1 }, { 20625, 19314, -1 }, { 20634, 19318, -1 }, { 20642, 19320, -1 },
+    { 20619, 19321, -1 }, { 20629, 19325, -1 }, { 20631, 19331, -1 }, { 20644, 19332, -1 }, { 20591, 19335, -1 }, { 20633, 19341, -1 },
+    { 20618, 19343, -1 }, { 20623, 19345, -1 }, { 20647, 19349, -1 }, { 20637, 19350, -1 }, { 20632, 19351, -1 }, { 20617, 19352, -1 },
+    { 20606, 19354, -1 }, { 20642, 19355, -1 }, { 20649, 19356, -1 }, { 20648, 19358, -1 }, { 20611, 19359, -1 }, { 20628, 19360, -1 },
+    { 20656, 19361, -1 }, { 20652, 19362, -1 }, { 20625, 19369, -1 }, { 20637, 19370, -1 }, { 20657, 19371, -1 }, { 20656, 19374, -1 },
+    { 20609, 19380, -1 }, { 20622, 19384, -1 }, { 20610, 19385, -1 }, { 20652, 19390, -1 }, { 20637, 19394, -1 }, { 20652, 19395, -1 },
+    { 20668, 19397, -1 }, { 20669, 19398, -1 }, { 20661, 19404, -1 }, { 20623, 19405, -1 }, { 20622, 19412, -1 }, { 20677, 19414, -1 },
+    { 20634, 19417, -1 }, { 20674, 19418, -1 }, { 20620, 19420, -1 }, { 20624, 19423, -1 }, { 20621, 19435, -1 }, { 20674, 19438, -1 },
+    { 20659, 19452, -1 }, { 20627, 19454, -1 }, { 20682, 19457, -1 }, { 20665, 19457, -1 }, { 20676, 19457, -1 }, { 20629, 19457, -1 },
+    { 20681, 19461, -1 }, { 20636, 19464, -1 }, { 20693, 19465, -1 }, { 20632, 19466, -1 }, { 20695, 19470, -1 }, { 20640, 19472, -1 },
+    { 20641, 19472, -1 }, { 20655, 19473, -1 }, { 20641, 19474, -1 }, { 20690, 19475, -1 }, { 20685, 19476, -1 }, { 20681, 19480, -1 },
+    { 20668, 19482, -1 }, { 20696, 19485, -1 }, { 20698, 19486, -1 }, { 20666, 19490, -1 }, { 20645, 19492, -1 }, { 20646, 19493, -1 },
+    { 20694, 19494, -1 }, { 20666, 19496, -1 }, { 20686, 19498, -1 }, { 20693, 19498, -1 }, { 20708, 19509, -1 }, { 20687, 19510, -1 },
+    { 20661, 19511, -1 }, { 20662, 19512, -1 }, { 20663, 19513, -1 }, { 20712, 19514, -1 }, { 20714, 19518, -1 }, { 20715, 19529, -1 },
+    { 20684, 19530, -1 }, { 20697, 19531, -1 }, { 20717, 19532, -1 }, { 20670, 19535, -1 }, { 20687, 19537, -1 }, { 20721, 19541, -1 },
+    { 20714, 19542, -1 }, { 20667, 19549, -1 }, { 20723, 19554, -1 }, { 20700, 19555, -1 }, { 20726, 19557, -1 }, { 20698, 19562, -1 },
+    { 20720, 19563, -1 }, { 20729, 19583, -1 }, { 20719, 19586, -1 }, { 20731, 19591, -1 }, { 20725, 19594, -1 }, { 20711, 19595, -1 },
+    { 20682, 19596, -1 }, { 20684, 19597, -1 }, { 20689, 19600, -1 }, { 20724, 19601, -1 }, { 20732, 19602, -1 }, { 20696, 19603, -1 },
+    { 20686, 19607, -1 }, { 20742, 19608, -1 }, { 20744, 19610, -1 }, { 20694, 19611, -1 }, { 20715, 19615, -1 }, { 20701, 19616, -1 },
+    { 20731, 19619, -1 }, { 20732, 19620, -1 }, { 20743, 19622, -1 }, { 20732, 19629, -1 }, { 20705, 19630, -1 }, { 20722, 19636, -1 },
+    { 20750, 19641, -1 }, { 20721, 19642, -1 }, { 20736, 19643, -1 }, { 20702, 19644, -1 }, { 20746, 19647, -1 }, { 20725, 19648, -1 },
+    { 20750, 19649, -1 }, { 20727, 19650, -1 }, { 20718, 19651, -1 }, { 20725, 19652, -1 }, { 20730, 19653, -1 }, { 20735, 19654, -1 },
+    { 20771, 19655, -1 }, { 20717, 19656, -1 }, { 20773, 19657, -1 }, { 20755, 19658, -1 }, { 20725, 19659, -1 }, { 20736, 19660, -1 },
+    { 20723, 19661, -1 }, { 20747, 19662, -1 }, { 20729, 19663, -1 }, { 20776, 19664, -1 }, { 20764, 19665, -1 }, { 20759, 19666, -1 },
+    { 20783, 19667, -1 }, { 20760, 19668, -1 }, { 20779, 19669, -1 }, { 20776, 19670, -1 }, { 20742, 19671, -1 }, { 20732, 19672, -1 },
+    { 20751, 19673, -1 }, { 20750, 19674, -1 }, { 20790, 19675, -1 }, { 20752, 19676, -1 }, { 20770, 19677, -1 }, { 20742, 19678, -1 },
+    { 20763, 19679, -1 }, { 20785, 19680, -1 }, { 20786, 19681, -1 }, { 20747, 19682, -1 }, { 20741, 19683, -1 }, { 20751, 19684, -1 },
+    { 20775, 19685, -1 }, { 20796, 19686, -1 }, { 20792, 19687, -1 }, { 20764, 19688, -1 }, { 20771, 19689, -1 }, { 20773, 19690, -1 },
+    { 20778, 19691, -1 }, { 20745, 19692, -1 }, { 20798, 19693, -1 }, { 20803, 19694, -1 }, { 20791, 19695, -1 }, { 20800, 19696, -1 },
+    { 20800, 19697, -1 }, { 20764, 19700, -1 }, { 20809, 19698, -1 }, { 20766, 19701, -1 }, { 20775, 19699, -1 }, { 20780, 19702, -1 },
+    { 20761, 19703, -1 }, { 20804, 19704, -1 }, { 20799, 19705, -1 }, { 20799, 19706, -1 }, { 20796, 19707, -1 }, { 20814, 19708, -1 },
+    { 20820, 19709, -1 }, { 20807, 19710, -1 }, { 20820, 19711, -1 }, { 20790, 19712, -1 }, { 20768, 19713, -1 }, { 20819, 19714, -1 },
+    { 20821, 19715, -1 }, { 20792, 19716, -1 }, { 20773, 19717, -1 }, { 20813, 19718, -1 }, { 20812, 19697, -1 }, { 20814, 19719, -1 },
+    { 20825, 19720, -1 }, { 20798, 19721, -1 }, { 20833, 19722, -1 }, { 20834, 19723, -1 }, { 20816, 19724, -1 }, { 20826, 19725, -1 },
+    { 20826, 19726, -1 }, { 20817, 19727, -1 }, { 20805, 19728, -1 }, { 20833, 19729, -1 }, { 20828, 19730, -1 }, { 20823, 19731, -1 },
+    { 20792, 19732, -1 }, { 20831, 19733, -1 }, { 20809, 19734, -1 }, { 20832, 19735, -1 }, { 20803, 19736, -1 }, { 20813, 19737, -1 },
+    { 20816, 19738, -1 }, { 20806, 19739, -1 }, { 20853, 19740, -1 }, { 20808, 19741, -1 }, { 20841, 19742, -1 }, { 20807, 19743, -1 },
+    { 20833, 19744, -1 }, { 20848, 19745, -1 }, { 20805, 19746, -1 }, { 20814, 19747, -1 }, { 20848, 19748, -1 }, { 20849, 19749, -1 },
+    { 20841, 19750, -1 }, { 20809, 19751, -1 }, { 20829, 19752, -1 }, { 20814, 19753, -1 }, { 20817, 19754, -1 }, { 20854, 19755, -1 },
+    { 20869, 19756, -1 }, { 20827, 19757, -1 }, { 20841, 19758, -1 }, { 20845, 19759, -1 }, { 20853, 19760, -1 }, { 20834, 19762, -1 },
+    { 20862, 19761, -1 }, { 20857, 19763, -1 }, { 20841, 19764, -1 }, { 20835, 19765, -1 }, { 20852, 19766, -1 }, { 20864, 19767, -1 },
+    { 20822, 19768, -1 }, { 20842, 19769, -1 }, { 20850, 19770, -1 }, { 20865, 19771, -1 }, { 20852, 19772, -1 }, { 20875, 19773, -1 },
+    { 20878, 19774, -1 }, { 20869, 19775, -1 }, { 20861, 19776, -1 }, { 20862, 19777, -1 }, { 20884, 19778, -1 }, { 20844, 19779, -1 },
+    { 20836, 19780, -1 }, { 20859, 19781, -1 }, { 20836, 19782, -1 }, { 20868, 19783, -1 }, { 20851, 19784, -1 }, { 20852, 19785, -1 },
+    { 20857, 19786, -1 }, { 20863, 19787, -1 }, { 20860, 19788, -1 }, { 20874, 19789, -1 }, { 20889, 19790, -1 }, { 20847, 19791, -1 },
+    { 20873, 19792, -1 }, { 20877, 19793, -1 }, { 20890, 19794, -1 }, { 20891, 19795, -1 }, { 20904, 19796, -1 }, { 20877, 19797, -1 },
+    { 20905, 19798, -1 }, { 20877, 19799, -1 }, { 20917, 19800, -1 }, { 20860, 19801, -1 }, { 20857, 19802, -1 }, { 20904, 19803, -1 },
+    { 20905, 19804, -1 }, { 20906, 19805, -1 }, { 20904, 19806, -1 }, { 20864, 19807, -1 }, { 20881, 19808, -1 }, { 20916, 19809, -1 },
+    { 20916, 19810, -1 }, { 20879, 19811, -1 }, { 20874, 19812, -1 }, { 20883, 19813, -1 }, { 20892, 19814, -1 }, { 20916, 19815, -1 },
+    { 20874, 19789, -1 }, { 20880, 19816, -1 }, { 20885, 19817, -1 }, { 20916, 19818, -1 }, { 20900, 19819, -1 }, { 20901, 19820, -1 },
+    { 20900, 19821, -1 }, { 20924, 19822, -1 }, { 20940, 19823, -1 }, { 20888, 19824, -1 }, { 20920, 19825, -1 }, { 20931, 19826, -1 },
+    { 20941, 19827, -1 }, { 20926, 19828, -1 }, { 20910, 19829, -1 }, { 20925, 19830, -1 }, { 20926, 19831, -1 }, { 20900, 19832, -1 },
+    { 20896, 19833, -1 }, { 20936, 19834, -1 }, { 20913, 19835, -1 }, { 20938, 19836, -1 }, { 20905, 19837, -1 }, { 20942, 19838, -1 },
+    { 20926, 19839, -1 }, { 20910, 19840, -1 }, { 20953, 19841, -1 }, { 20910, 19842, -1 }, { 20912, 19843, -1 }, { 20922, 19844, -1 },
+    { 20929, 19845, -1 }, { 20916, 19846, -1 }, { 20915, 19847, -1 }, { 20958, 19848, -1 }, { 20937, 19849, -1 }, { 20918, 19850, -1 },
+    { 20949, 19851, -1 }, { 20920, 19852, -1 }, { 20968, 19853, -1 }, { 20932, 19854, -1 }, { 20942, 19855, -1 }, { 20924, 19856, -1 },
+    { 20940, 19857, -1 }, { 20943, 19858, -1 }, { 20969, 19859, -1 }, { 20952, 19860, -1 }, { 20920, 19861, -1 }, { 20922, 19862, -1 },
+    { 20923, 19863, -1 }, { 20950, 19864, -1 }, { 20951, 19865, -1 }, { 20932, 19866, -1 }, { 20944, 19867, -1 }, { 20982, 19868, -1 },
+    { 20986, 19869, -1 }, { 20971, 19870, -1 }, { 20937, 19871, -1 }, { 20943, 19872, -1 }, { 20984, 19873, -1 }, { 20972, 19874, -1 },
+    { 20992, 19875, -1 }, { 20977, 19876, -1 }, { 20955, 19877, -1 }, { 20956, 19878, -1 }, { 20963, 19879, -1 }, { 20978, 19880, -1 },
+    { 20986, 19881, -1 }, { 20991, 19882, -1 }, { 20995, 19883, -1 }, { 20982, 19884, -1 }, { 20990, 19885, -1 }, { 20958, 19886, -1 },
+    { 20982, 19887, -1 }, { 21005, 19888, -1 }, { 20976, 19889, -1 }, { 21002, 19890, -1 }, { 20997, 19891, -1 }, { 21010, 19892, -1 },
+    { 21011, 19893, -1 }, { 20969, 19894, -1 }, { 21003, 19895, -1 }, { 20976, 19896, -1 }, { 21011, 19897, -1 }, { 21005, 19898, -1 },
+    { 21013, 19899, -1 }, { 20959, 19900, -1 }, { 21000, 19901, -1 }, { 21008, 19902, -1 }, { 21002, 19903, -1 }, { 20968, 19904, -1 },
+    { 20990, 19905, -1 }, { 21009, 19906, -1 }, { 21018, 19907, -1 }, { 21026, 19908, -1 }, { 20970, 19909, -1 }, { 20973, 19910, -1 },
+    { 20977, 19911, -1 }, { 20998, 19912, -1 }, { 21017, 19913, -1 }, { 20992, 19914, -1 }, { 21032, 19915, -1 }, { 20992, 19916, -1 },
+    { 21028, 19917, -1 }, { 21006, 19918, -1 }, { 20997, 19919, -1 }, { 21038, 19920, -1 }, { 21026, 19921, -1 }, { 21034, 19922, -1 },
+    { 21024, 19923, -1 }, { 20985, 19924, -1 }, { 20998, 19925, -1 }, { 20994, 19926, -1 }, { 21026, 19927, -1 }, { 21014, 19928, -1 },
+    { 21006, 19929, -1 }, { 21007, 19930, -1 }, { 21037, 19931, -1 }, { 21039, 19932, -1 }, { 21001, 19933, -1 }, { 21011, 19934, -1 },
+    { 21033, 19935, -1 }, { 21041, 19936, -1 }, { 20999, 19937, -1 }, { 21021, 19938, -1 }, { 21024, 19939, -1 }, { 21008, 19940, -1 },
+    { 21025, 19941, -1 }, { 21028, 19942, -1 }, { 21013, 19943, -1 }, { 20999, 19944, -1 }, { 21040, 19945, -1 }, { 21021, 19946, -1 },
+    { 21028, 19947, -1 }, { 21056, 19948, -1 }, { 21041, 19949, -1 }, { 21056, 19950, -1 }, { 21052, 19951, -1 }, { 21022, 19952, -1 },
+    { 21008, 19953, -1 }, { 21020, 19954, -1 }, { 21025, 19955, -1 }, { 21054, 19956, -1 }, { 21014, 19957, -1 }, { 21070, 19958, -1 },
+    { 21064, 19959, -1 }, { 21072, 19960, -1 }, { 21065, 19961, -1 }, { 21063, 19962, -1 }, { 21054, 19963, -1 }, { 21075, 19964, -1 },
+    { 21077, 19965, -1 }, { 21040, 19966, -1 }, { 21045, 19967, -1 }, { 21060, 19968, -1 }, { 21038, 19969, -1 }, { 21087, 19970, -1 },
+    { 21077, 19971, -1 }, { 21082, 19972, -1 }, { 21032, 19973, -1 }, { 21029, 19974, -1 }, { 21030, 19975, -1 }, { 21048, 19976, -1 },
+    { 21042, 19977, -1 }, { 21059, 19981, -1 }, { 21045, 19978, -1 }, { 21055, 19979, -1 }, { 21047, 19980, -1 }, { 21079, 19982, -1 },
+    { 21084, 19983, -1 }, { 21069, 19984, -1 }, { 21081, 19985, -1 }, { 21064, 19986, -1 }, { 21099, 19987, -1 }, { 21096, 19988, -1 },
+    { 21101, 19989, -1 }, { 21076, 19990, -1 }, { 21068, 19991, -1 }, { 21072, 19992, -1 }, { 21059, 19993, -1 }, { 21098, 19994, -1 },
+    { 21066, 19995, -1 }, { 21054, 19996, -1 }, { 21083, 19997, -1 }, { 21078, 19998, -1 }, { 21118, 19999, -1 }, { 21072, 20000, -1 },
+    { 21081, 20001, -1 }, { 21053, 19994, -1 }, { 21090, 20002, -1 }, { 21123, 20003, -1 }, { 21106, 20004, -1 }, { 21111, 20005, -1 },
+    { 21111, 20006, -1 }, { 21121, 20007, -1 }, { 21088, 20008, -1 }, { 21066, 20009, -1 }, { 21111, 20010, -1 }, { 21130, 20011, -1 },
+    { 21112, 20012, -1 }, { 21081, 20013, -1 }, { 21093, 20014, -1 }, { 21108, 20015, -1 }, { 21057, 19995, -1 }, { 21109, 20016, -1 },
+    { 21122, 20017, -1 }, { 21095, 20018, -1 }, { 21096, 20019, -1 }, { 21109, 20020, -1 }, { 21110, 20021, -1 }, { 21119, 20022, -1 },
+    { 21108, 20023, -1 }, { 21130, 20024, -1 }, { 21124, 20025, -1 }, { 21119, 20026, -1 }, { 21135, 20027, -1 }, { 21124, 20028, -1 },
+    { 21118, 20029, -1 }, { 21134, 20030, -1 }, { 21104, 20031, -1 }, { 21105, 20032, -1 }, { 21122, 20033, -1 }, { 21107, 20034, -1 },
+    { 21108, 20035, -1 }, { 21125, 20036, -1 }, { 21140, 20037, -1 }, { 21158, 20038, -1 }, { 21135, 20039, -1 }, { 21148, 20040, -1 },
+    { 21141, 20041, -1 }, { 21139, 20042, -1 }, { 21110, 20047, -1 }, { 21131, 20043, -1 }, { 21151, 20044, -1 }, { 21145, 20045, -1 },
+    { 21148, 20046, -1 }, { 21164, 20048, -1 }, { 21144, 20049, -1 }, { 21139, 20050, -1 }, { 21119, 20051, -1 }, { 21115, 20052, -1 },
+    { 21123, 20053, -1 }, { 21116, 20054, -1 }, { 21175, 20055, -1 }, { 21143, 20056, -1 }, { 21160, 20057, -1 }, { 21159, 20058, -1 },
+    { 21128, 20059, -1 }, { 21168, 20060, -1 }, { 21141, 20061, -1 }, { 21165, 20062, -1 }, { 21166, 20063, -1 }, { 21177, 20064, -1 },
+    { 21179, 20065, -1 }, { 21137, 20066, -1 }, { 21142, 20067, -1 }, { 21148, 20068, -1 }, { 21188, 20069, -1 }, { 21186, 20070, -1 },
+    { 21171, 20071, -1 }, { 21175, 20072, -1 }, { 21176, 20073, -1 }, { 21154, 20074, -1 }, { 21135, 20075, -1 }, { 21156, 20076, -1 },
+    { 21183, 20077, -1 }, { 21152, 20078, -1 }, { 21188, 20079, -1 }, { 21166, 20080, -1 }, { 21170, 20081, -1 }, { 21185, 20082, -1 },
+    { 21153, 20083, -1 }, { 21204, 20084, -1 }, { 21155, 20085, -1 }, { 21195, 20086, -1 }, { 21196, 20087, -1 }, { 21200, 20088, -1 },
+    { 21169, 20089, -1 }, { 21192, 20090, -1 }, { 21202, 20091, -1 }, { 21195, 20092, -1 }, { 21202, 20093, -1 }, { 21198, 20094, -1 },
+    { 21178, 20095, -1 }, { 21168, 20096, -1 }, { 21162, 20097, -1 }, { 21205, 20098, -1 }, { 21168, 20099, -1 }, { 21220, 20100, -1 },
+    { 21220, 20101, -1 }, { 21166, 20102, -1 }, { 21223, 20103, -1 }, { 21174, 20104, -1 }, { 21191, 20105, -1 }, { 21224, 20106, -1 },
+    { 21187, 20107, -1 }, { 21211, 20108, -1 }, { 21180, 20109, -1 }, { 21217, 20110, -1 }, { 21180, 20111, -1 }, { 21180, 20112, -1 },
+    { 21182, 20113, -1 }, { 21217, 20114, -1 }, { 21179, 20115, -1 }, { 21181, 20116, -1 }, { 21202, 20117, -1 }, { 21188, 20118, -1 },
+    { 21236, 20119, -1 }, { 21215, 20120, -1 }, { 21224, 20121, -1 }, { 21204, 20122, -1 }, { 21235, 20123, -1 }, { 21242, 20124, -1 },
+    { 21235, 20125, -1 }, { 21244, 20126, -1 }, { 21237, 20127, -1 }, { 21211, 20128, -1 }, { 21237, 20129, -1 }, { 21187, 20130, -1 },
+    { 21210, 20131, -1 }, { 21214, 20132, -1 }, { 21204, 20133, -1 }, { 21196, 20134, -1 }, { 21211, 20135, -1 }, { 21199, 20136, -1 },
+    { 21200, 20137, -1 }, { 21258, 20138, -1 }, { 21217, 20139, -1 }, { 21230, 20140, -1 }, { 21199, 20141, -1 }, { 21258, 20142, -1 },
+    { 21236, 20143, -1 }, { 21205, 20144, -1 }, { 21216, 20145, -1 }, { 21260, 20146, -1 }, { 21259, 20147, -1 }, { 21217, 20148, -1 },
+    { 21246, 20149, -1 }, { 21212, 20150, -1 }, { 21240, 20151, -1 }, { 21256, 20152, -1 }, { 21257, 20153, -1 }, { 21238, 20154, -1 },
+    { 21236, 20155, -1 }, { 21214, 20156, -1 }, { 21195, 20135, -1 }, { 21268, 20157, -1 }, { 21256, 20158, -1 }, { 21258, 20159, -1 },
+    { 21224, 20160, -1 }, { 21232, 20161, -1 }, { 21272, 20162, -1 }, { 21282, 20163, -1 }, { 21236, 20164, -1 }, { 21225, 20165, -1 },
+    { 21255, 20166, -1 }, { 21286, 20167, -1 }, { 21271, 20168, -1 }, { 21238, 20169, -1 }, { 21272, 20170, -1 }, { 21290, 20171, -1 },
+    { 21278, 20172, -1 }, { 21265, 20173, -1 }, { 21274, 20174, -1 }, { 21250, 20175, -1 }, { 21249, 20176, -1 }, { 21292, 20177, -1 },
+    { 21271, 20178, -1 }, { 21272, 20179, -1 }, { 21266, 20180, -1 }, { 21251, 20181, -1 }, { 21286, 20182, -1 }, { 21268, 20183, -1 },
+    { 21243, 20184, -1 }, { 21294, 20185, -1 }, { 21296, 20186, -1 }, { 21301, 20187, -1 }, { 21302, 20188, -1 }, { 21266, 20189, -1 },
+    { 21284, 20190, -1 }, { 21310, 20191, -1 }, { 21262, 20192, -1 }, { 21300, 20193, -1 }, { 21267, 20194, -1 }, { 21255, 20195, -1 },
+    { 21286, 20196, -1 }, { 21263, 20197, -1 }, { 21286, 20198, -1 }, { 21314, 20199, -1 }, { 21268, 20200, -1 }, { 21307, 20201, -1 },
+    { 21273, 20202, -1 }, { 21291, 20203, -1 }, { 21318, 20204, -1 }, { 21314, 20205, -1 }, { 21279, 20206, -1 }, { 21304, 20207, -1 },
+    { 21289, 20208, -1 }, { 21281, 20209, -1 }, { 21308, 20210, -1 }, { 21310, 20211, -1 }, { 21311, 20212, -1 }, { 21305, 20213, -1 },
+    { 21328, 20214, -1 }, { 21299, 20215, -1 }, { 21258, 20194, -1 }, { 21277, 20216, -1 }, { 21327, 20217, -1 }, { 21328, 20218, -1 },
+    { 21304, 20219, -1 }, { 21329, 20220, -1 }, { 21330, 20221, -1 }, { 21331, 20222, -1 }, { 21320, 20223, -1 }, { 21334, 20224, -1 },
+    { 21330, 20225, -1 }, { 21330, 20226, -1 }, { 21304, 20227, -1 }, { 21337, 20228, -1 }, { 21292, 20229, -1 }, { 21328, 20230, -1 },
+    { 21301, 20231, -1 }, { 21337, 20232, -1 }, { 21296, 20233, -1 }, { 21314, 20234, -1 }, { 21346, 20235, -1 }, { 21326, 20236, -1 },
+    { 21318, 20237, -1 }, { 21343, 20238, -1 }, { 21349, 20239, -1 }, { 21331, 20240, -1 }, { 21357, 20241, -1 }, { 21358, 20242, -1 },
+    { 21329, 20243, -1 }, { 21360, 20244, -1 }, { 21350, 20245, -1 }, { 21356, 20246, -1 }, { 21320, 20247, -1 }, { 21337, 20248, -1 },
+    { 21340, 20249, -1 }, { 21323, 20250, -1 }, { 21323, 20251, -1 }, { 21363, 20252, -1 }, { 21372, 20253, -1 }, { 21335, 20254, -1 },
+    { 21318, 20255, -1 }, { 21355, 20256, -1 }, { 21356, 20257, -1 }, { 21363, 20258, -1 }, { 21343, 20259, -1 }, { 21350, 20260, -1 },
+    { 21342, 20261, -1 }, { 21357, 20262, -1 }, { 21385, 20263, -1 }, { 21325, 20264, -1 }, { 21351, 20265, -1 }, { 0, 20266, 5 },
+    { 0, 20267, 12 }, { 0, 20268, 13 }, { 0, 20269, 15 }, { 0, 20270, 17 }, { 0, 20271, 18 }, { 0, 20272, 19 },
+    { 0, 20273, 23 }, { 0, 20274, 27 }, { 0, 20275, 30 }, { 21285, 20276, -1 }, { 0, 20277, 34 }, { 0, 20278, 40 },
+    { 0, 20279, 51 }, { 0, 20280, 53 }, { 0, 20281, 62 }, { 0, 20282, 65 }, { 0, 20283, 100 }, { 0, 20284, 101 },
+    { 0, 20285, 102 }, { 0, 20286, 103 }, { 0, 20287, 110 }, { 0, 20288, 111 }, { 0, 20289, 115 }, { 0, 20290, 131 },
+    { 0, 20291, 132 }, { 0, 20292, 135 }, { 0, 20293, 173 }, { 0, 20294, 179 }, { 0, 20295, 186 }, { 0, 20296, 198 },
+    { 0, 20297, 199 }, { 0, 20298, 205 }, { 0, 20299, 207 }, { 0, 20300, 208 }, { 0, 20301, 209 }, { 0, 20302, 210 },
+    { 0, 20303, 211 }, { 0, 20304, 212 }, { 0, 20305, 213 }, { 0, 20306, 214 }, { 21284, 20307, 221 }, { 0, 20308, 223 },
+    { 0, 20309, 245 }, { 0, 20310, 250 }, { 0, 20311, 258 }, { 21288, 20312, -1 }, { 0, 20313, 281 }, { 0, 20314, 301 },
+    { 0, 20315, 308 }, { 0, 20316, 310 }, { 0, 20338, 311 }, { 0, 20317, 312 }, { 0, 20318, 313 }, { 0, 20319, 314 },
+    { 0, 20320, 316 }, { 0, 20321, 317 }, { 0, 20322, 319 }, { 0, 20323, 325 }, { 0, 20324, 326 }, { 0, 20325, 333 },
+    { 21290, 20326, -1 }, { 0, 20327, 353 }, { 0, 20328, 363 }, { 0, 20329, 365 }, { 21288, 20330, -1 }, { 0, 20331, 400 },
+    { 0, 20332, 405 }, { 0, 20333, 406 }, { 0, 20334, 417 }, { 0, 20335, 454 }, { 0, 20336, 465 }, { 0, 20337, 472 },
+    { 0, 20339, 473 }, { 0, 20340, 480 }, { 0, 20341, 489 }, { 21289, 20342, -1 }, { 21293, 20343, 494 }, { 21294, 20344, -1 },
+    { 0, 20345, 498 }, { 0, 20346, 501 }, { 21295, 20347, -1 }, { 0, 20348, 642 }, { 0, 20349, 654 }, { 0, 20350, 669 },
+    { 0, 20351, 678 }, { 0, 20352, 695 }, { 0, 20353, 707 }, { 0, 20354, 720 }, { 0, 20355, 721 }, { 0, 20356, 726 },
+    { 21296, 20357, -1 }, { 0, 20358, 772 }, { 0, 20359, 777 }, { 0, 20360, 800 }, { 0, 20361, 812 }, { 0, 20362, 825 },
+    { 0, 20363, 837 }, { 0, 20364, 843 }, { 0, 20365, 937 }, { 0, 20366, 942 }, { 0, 20367, 973 }, { 0, 20368, 976 },
+    { 0, 20369, 977 }, { 0, 20370, 996 }, { 0, 20371, 1000 }, { 21294, 20372, -1 }, { 0, 20373, 1092 }, { 0, 20374, 1097 },
+    { 0, 20375, 1116 }, { 0, 20376, 1117 }, { 0, 20377, 1126 }, { 0, 20378, 1127 }, { 0, 20379, 1149 }, { 0, 20380, 1151 },
+    { 0, 20381, 1152 }, { 0, 20382, 1155 }, { 0, 20383, 1171 }, { 0, 20384, 1175 }, { 0, 20385, 1177 }, { 0, 20386, 1179 },
+    { 0, 20387, 1183 }, { 0, 20388, 1187 }, { 0, 20389, 1216 }, { 0, 20390, 1219 }, { 0, 20391, 1222 }, { 0, 20392, 1232 },
+    { 0, 20393, 1274 }, { 0, 20394, 1317 }, { 0, 20395, 1320 }, { 0, 20396, 1323 }, { 0, 20397, 1324 }, { 21297, 20398, -1 },
+    { 0, 20399, 1328 }, { 0, 20400, 1336 }, { 0, 20401, 1341 }, { 0, 20402, 1351 }, { 0, 20403, 1364 }, { 0, 20404, 1386 },
+    { 0, 20405, 1387 }, { 21299, 20406, -1 }, { 0, 20407, 1405 }, { 0, 20408, 1407 }, { 0, 20409, 1409 }, { 0, 20436, 1410 },
+    { 0, 20410, 1417 }, { 0, 20411, 1419 }, { 0, 20412, 1434 }, { 0, 20413, 1448 }, { 0, 20414, 1450 }, { 0, 20415, 1451 },
+    { 0, 20416, 1461 }, { 0, 20417, 1486 }, { 0, 20418, 1487 }, { 0, 20419, 1488 }, { 0, 20420, 1493 }, { 21300, 20421, -1 },
+    { 0, 20422, 1506 }, { 0, 20423, 1511 }, { 0, 20424, 1512 }, { 0, 20425, 1528 }, { 0, 20426, 1537 }, { 0, 20427, 1554 },
+    { 0, 20428, 1557 }, { 0, 20429, 1567 }, { 0, 20430, 1572 }, { 0, 20431, 1631 }, { 0, 20432, 1634 }, { 0, 20433, 1645 },
+    { 0, 20434, 1649 }, { 0, 20435, 1664 }, { 0, 20437, 1672 }, { 0, 20438, 1674 }, { 0, 20439, 1679 }, { 0, 20440, 1680 },
+    { 0, 20441, 1681 }, { 0, 20442, 1683 }, { 0, 20443, 1690 }, { 0, 20444, 1691 }, { 0, 20445, 1693 }, { 0, 20446, 1696 },
+    { 0, 20447, 1698 }, { 0, 20448, 1699 }, { 0, 20449, 1710 }, { 0, 20450, 1727 }, { 0, 20451, 1728 }, { 0, 20452, 1729 },
+    { 0, 20453, 1737 }, { 21300, 20454, -1 }, { 0, 20455, 1760 }, { 0, 20456, 1762 }, { 0, 20457, 1777 }, { 0, 20458, 1801 },
+    { 0, 20459, 1802 }, { 0, 20460, 1816 }, { 0, 20461, 1851 }, { 21299, 20462, -1 }, { 0, 20463, 1900 }, { 0, 20464, 1904 },
+    { 21299, 20465, 1924 }, { 0, 20466, 1926 }, { 0, 20467, 1929 }, { 0, 20468, 1932 }, { 0, 20469, 1934 }, { 0, 20470, 1935 },
+    { 0, 20471, 1938 }, { 0, 20472, 1940 }, { 0, 20473, 1943 }, { 0, 20474, 1950 }, { 0, 20475, 1951 }, { 0, 20476, 1952 },
+    { 0, 20477, 1959 }, { 0, 20478, 1966 }, { 0, 20479, 1976 }, { 0, 20480, 1979 }, { 0, 20481, 1986 }, { 0, 20482, 1991 },
+    { 0, 20483, 1997 }, { 0, 20484, 1999 }, { 0, 20485, 2033 }, { 0, 20486, 2036 }, { 0, 20487, 2043 }, { 0, 20488, 2048 },
+    { 21301, 20489, -1 }, { 21303, 20490, -1 }, { 0, 20491, 2088 }, { 0, 20492, 2101 }, { 0, 20493, 2111 }, { 0, 20494, 2116 },
+    { 0, 20495, 2122 }, { 0, 20496, 2153 }, { 0, 20497, 2157 }, { 0, 20498, 2163 }, { 21302, 20499, 2187 }, { 0, 20500, 2189 },
+    { 0, 20501, 2202 }, { 0, 20502, 2206 }, { 0, 20503, 2211 }, { 0, 20504, 2234 }, { 0, 20505, 2239 }, { 0, 20506, 2245 },
+    { 0, 20507, 2248 }, { 0, 20508, 2275 }, { 0, 20509, 2278 }, { 0, 20510, 2292 }, { 21307, 20511, 2296 }, { 0, 20512, 2305 },
+    { 0, 20513, 2360 }, { 0, 20514, 2381 }, { 0, 20515, 2409 }, { 0, 20516, 2430 }, { 0, 20517, 2436 }, { 21304, 20518, -1 },
+    { 0, 20519, 2452 }, { 21305, 20520, -1 }, { 0, 20521, 2472 }, { 0, 20522, 2522 }, { 0, 20523, 2531 }, { 0, 20524, 2532 },
+    { 0, 20525, 2533 }, { 21310, 20526, -1 }, { 0, 20527, 2542 }, { 0, 20528, 2546 }, { 0, 20529, 2553 }, { 0, 20530, 2571 },
+    { 0, 20531, 2603 }, { 0, 20532, 2614 }, { 21311, 20533, -1 }, { 0, 20534, 2627 }, { 0, 20535, 2637 }, { 0, 20536, 2647 },
+    { 0, 20537, 2651 }, { 0, 20538, 2656 }, { 0, 20539, 2668 }, { 0, 20540, 2704 }, { 0, 20541, 2715 }, { 0, 20542, 2717 },
+    { 0, 20543, 2718 }, { 0, 20544, 2837 }, { 0, 20545, 2839 }, { 0, 20546, 2843 }, { 0, 20547, 2852 }, { 0, 20548, 2857 },
+    { 0, 20549, 2869 }, { 0, 20550, 2870 }, { 0, 20551, 2871 }, { 0, 20552, 2873 }, { 0, 20553, 2874 }, { 0, 20554, 2875 },
+    { 0, 20555, 2878 }, { 0, 20556, 2879 }, { 0, 20557, 2889 }, { 0, 20558, 2891 }, { 0, 20559, 2899 }, { 0, 20560, 2907 },
+    { 0, 20561, 2932 }, { 0, 20562, 2940 }, { 0, 20563, 2947 }, { 0, 20564, 2962 }, { 0, 20565, 2968 }, { 21309, 20566, -1 },
+    { 0, 20567, 2973 }, { 0, 20568, 3009 }, { 0, 20569, 3027 }, { 0, 20570, 3057 }, { 0, 20571, 3062 }, { 0, 20572, 3091 },
+    { 0, 20573, 3092 }, { 21313, 20574, -1 }, { 0, 20575, 3094 }, { 0, 20576, 3103 }, { 21314, 20577, -1 }, { 0, 20578, 3183 },
+    { 0, 20579, 3194 }, { 0, 20580, 3196 }, { 0, 20581, 3204 }, { 21316, 20582, -1 }, { 0, 20583, 3233 }, { 0, 20584, 3242 },
+    { 0, 20585, 3265 }, { 0, 20586, 3270 }, { 0, 20587, 3278 }, { 0, 20588, 3292 }, { 0, 20589, 3293 }, { 0, 20590, 3297 },
+    { 0, 20591, 3298 }, { 0, 20592, 3303 }, { 0, 20593, 3310 }, { 0, 20594, 3346 }, { 0, 20595, 3352 }, { 0, 20596, 3353 },
+    { 0, 20597, 3361 }, { 0, 20598, 3362 }, { 0, 20599, 3363 }, { 0, 20600, 3386 }, { 0, 20601, 3389 }, { 0, 20602, 3394 },
+    { 0, 20603, 3398 }, { 0, 20604, 3405 }, { 0, 20605, 3407 }, { 0, 20606, 3408 }, { 0, 20607, 3411 }, { 0, 20608, 3424 },
+    { 0, 20609, 3436 }, { 0, 20610, 3438 }, { 0, 20611, 3439 }, { 21313, 20612, -1 }, { 0, 20613, 3448 }, { 0, 20614, 3454 },
+    { 0, 20615, 3455 }, { 0, 20623, 3456 }, { 0, 20616, 3457 }, { 0, 20638, 3458 }, { 0, 20617, 3459 }, { 0, 20618, 3460 },
+    { 0, 20619, 3462 }, { 0, 20620, 3483 }, { 0, 20621, 3491 }, { 0, 20622, 3497 }, { 21314, 20624, -1 }, { 21318, 20625, -1 },
+    { 0, 20626, 3511 }, { 0, 20627, 3515 }, { 0, 20628, 3517 }, { 21319, 20629, 3529 }, { 0, 20630, 3555 }, { 0, 20631, 3558 },
+    { 0, 20632, 3571 }, { 0, 20633, 3572 }, { 0, 20634, 3588 }, { 0, 20635, 3659 }, { 21320, 20636, -1 }, { 0, 20637, 3758 },
+    { 0, 20639, 3762 }, { 0, 20640, 3776 }, { 0, 20641, 3777 }, { 0, 20642, 3780 }, { 0, 20643, 3788 }, { 0, 20644, 3789 },
+    { 0, 20645, 3803 }, { 0, 20646, 3806 }, { 0, 20647, 3808 }, { 0, 20648, 3814 }, { 0, 20649, 3824 }, { 21321, 20650, -1 },
+    { 0, 20651, 3837 }, { 0, 20652, 3846 }, { 0, 20653, 3857 }, { 0, 20654, 3859 }, { 0, 20655, 3864 }, { 0, 20656, 3865 },
+    { 0, 20657, 3867 }, { 0, 20658, 3872 }, { 0, 20659, 3873 }, { 0, 20660, 3880 }, { 0, 20661, 3887 }, { 0, 20662, 3921 },
+    { 0, 20663, 3931 }, { 0, 20664, 3948 }, { 0, 20665, 3956 }, { 0, 20666, 3957 }, { 0, 20667, 3979 }, { 0, 20668, 3987 },
+    { 21323, 20669, -1 }, { 0, 20670, 4030 }, { 21319, 20671, -1 }, { 0, 20672, 4041 }, { 0, 20673, 4054 }, { 0, 20674, 4073 },
+    { 0, 20675, 4075 }, { 0, 20676, 4079 }, { 0, 20677, 4083 }, { 0, 20678, 4089 }, { 0, 20679, 4092 }, { 0, 20680, 4128 },
+    { 0, 20681, 4129 }, { 21324, 20682, -1 }, { 0, 20683, 4154 }, { 0, 20684, 4157 }, { 0, 20685, 4234 }, { 0, 20686, 4235 },
+    { 0, 20687, 4251 }, { 0, 20688, 4266 }, { 21325, 20689, -1 }, { 0, 20690, 4272 }, { 0, 20691, 4293 }, { 0, 20692, 4296 },
+    { 0, 20693, 4300 }, { 0, 20694, 4330 }, { 0, 20695, 4337 }, { 0, 20696, 4338 }, { 0, 20697, 4372 }, { 0, 20698, 4373 },
+    { 0, 20699, 4375 }, { 0, 20700, 4382 }, { 0, 20701, 4434 }, { 0, 20702, 4436 }, { 0, 20703, 4441 }, { 0, 20704, 4447 },
+    { 0, 20705, 4451 }, { 0, 20706, 4455 }, { 0, 20707, 4466 }, { 0, 20708, 4470 }, { 0, 20709, 4476 }, { 0, 20710, 4477 },
+    { 21326, 20711, -1 }, { 0, 20712, 4533 }, { 0, 20713, 4581 }, { 0, 20714, 4590 }, { 0, 20715, 4609 }, { 21326, 20716, -1 },
+    { 0, 20717, 4621 }, { 0, 20718, 4625 }, { 21324, 20719, -1 }, { 21329, 20720, -1 }, { 0, 20721, 4646 }, { 0, 20722, 4653 },
+    { 0, 20723, 4658 }, { 0, 20724, 4668 }, { 0, 20725, 4674 }, { 0, 20726, 4680 }, { 0, 20727, 4683 }, { 0, 20728, 4736 },
+    { 0, 20729, 4746 }, { 0, 20730, 4751 }, { 0, 20731, 4757 }, { 0, 20732, 4777 }, { 0, 20733, 4786 }, { 0, 20734, 4790 },
+    { 0, 20735, 4803 }, { 0, 20736, 4804 }, { 0, 20737, 4850 }, { 0, 20738, 4871 }, { 0, 20739, 4915 }, { 0, 20740, 5000 },
+    { 0, 20741, 5001 }, { 0, 20742, 5004 }, { 0, 20743, 5013 }, { 0, 20744, 5015 }, { 0, 20745, 5033 }, { 0, 20746, 5038 },
+    { 0, 20747, 5042 }, { 0, 20748, 5049 }, { 0, 20749, 5087 }, { 0, 20750, 5144 }, { 0, 20751, 5146 }, { 0, 20752, 5149 },
+    { 0, 20753, 5151 }, { 0, 20754, 5152 }, { 0, 20755, 5156 }, { 0, 20756, 5163 }, { 0, 20757, 5165 }, { 0, 20758, 5166 },
+    { 0, 20780, 5167 }, { 0, 20759, 5168 }, { 0, 20760, 5169 }, { 0, 20761, 5172 }, { 0, 20762, 5173 }, { 0, 20763, 5174 },
+    { 0, 20764, 5176 }, { 0, 20765, 5178 }, { 0, 20766, 5179 }, { 0, 20767, 5181 }, { 0, 20768, 5184 }, { 0, 20769, 5206 },
+    { 0, 20770, 5210 }, { 0, 20771, 5212 }, { 0, 20772, 5244 }, { 0, 20773, 5280 }, { 0, 20774, 5282 }, { 0, 20775, 5314 },
+    { 0, 20776, 5339 }, { 0, 20777, 5348 }, { 0, 20778, 5355 }, { 0, 20779, 5392 }, { 0, 20781, 5405 }, { 0, 20782, 5414 },
+    { 0, 20783, 5417 }, { 0, 20784, 5434 }, { 0, 20785, 5447 }, { 0, 20786, 5449 }, { 0, 20787, 5477 }, { 0, 20788, 5478 },
+    { 0, 20789, 5479 }, { 0, 20790, 5480 }, { 0, 20791, 5481 }, { 0, 20792, 5510 }, { 0, 20793, 5511 }, { 0, 20794, 5512 },
+    { 0, 20795, 5534 }, { 0, 20796, 5574 }, { 0, 20797, 5628 }, { 0, 20798, 5639 }, { 0, 20799, 5665 }, { 0, 20800, 5732 },
+    { 0, 20801, 5745 }, { 0, 20802, 5767 }, { 0, 20803, 5768 }, { 0, 20804, 5855 }, { 0, 20805, 5876 }, { 0, 20806, 5896 },
+    { 0, 20807, 5918 }, { 21329, 20808, -1 }, { 0, 20809, 5935 }, { 0, 20810, 5996 }, { 0, 20811, 6013 }, { 0, 20812, 6033 },
+    { 0, 20813, 6036 }, { 0, 20814, 6058 }, { 0, 20815, 6063 }, { 0, 20816, 6075 }, { 0, 20817, 6076 }, { 0, 20818, 6077 },
+    { 0, 20840, 6078 }, { 0, 20819, 6079 }, { 0, 20820, 6091 }, { 0, 20821, 6106 }, { 0, 20822, 6107 }, { 0, 20823, 6112 },
+    { 0, 20824, 6127 }, { 0, 20825, 6152 }, { 0, 20826, 6153 }, { 0, 20827, 6154 }, { 0, 20828, 6155 }, { 0, 20829, 6156 },
+    { 0, 20830, 6157 }, { 0, 20831, 6176 }, { 0, 20832, 6180 }, { 0, 20833, 6229 }, { 0, 20834, 6233 }, { 0, 20835, 6239 },
+    { 0, 20836, 6265 }, { 0, 20837, 6268 }, { 0, 20838, 6273 }, { 0, 20839, 6277 }, { 0, 20841, 6283 }, { 0, 20842, 6284 },
+    { 0, 20843, 6306 }, { 0, 20844, 6315 }, { 21327, 20845, -1 }, { 21328, 20846, -1 }, { 21333, 20847, -1 }, { 21334, 20848, -1 },
+    { 0, 20849, 6362 }, { 21334, 20850, -1 }, { 0, 20851, 6429 }, { 0, 20852, 6562 }, { 0, 20853, 6572 }, { 0, 20854, 6631 },
+    { 0, 20855, 6633 }, { 0, 20856, 6651 }, { 0, 20857, 6657 }, { 21333, 20858, -1 }, { 0, 20859, 6761 }, { 0, 20860, 6763 },
+    { 0, 20861, 6768 }, { 0, 20862, 6784 }, { 0, 20863, 6791 }, { 0, 20864, 6839 }, { 0, 20865, 6852 }, { 0, 20866, 6890 },
+    { 21337, 20867, 6916 }, { 0, 20868, 6921 }, { 0, 20869, 6922 }, { 0, 20870, 6931 }, { 0, 20871, 6937 }, { 21338, 20872, -1 },
+    { 0, 20873, 6948 }, { 0, 20874, 6951 }, { 0, 20875, 7007 }, { 0, 20876, 7010 }, { 21338, 20877, -1 }, { 0, 20878, 7016 },
+    { 0, 20879, 7088 }, { 0, 20880, 7089 }, { 0, 20881, 7166 }, { 0, 20882, 7168 }, { 21336, 20883, -1 }, { 0, 20884, 7250 },
+    { 0, 20885, 7251 }, { 21341, 20886, -1 }, { 0, 20887, 7278 }, { 0, 20888, 7281 }, { 0, 20889, 7283 }, { 0, 20890, 7298 },
+    { 21434, 20901, -1 }, { 21415, 20932, -1 }, { 21415, 20937, -1 }, { 21441, 20952, -1 }, { 21433, 20956, -1 }, { 21415, 20967, -1 },
+    { 21434, 20968, -1 }, { 21436, 20969, -1 }, { 21415, 20972, -1 }, { 21438, 20982, -1 }, { 21445, 20997, -1 }, { 21426, 21023, -1 },
+    { 21442, 21031, -1 }, { 21429, 21047, -1 }, { 21434, 21079, -1 }, { 21425, 21087, -1 }, { 21430, 21090, -1 }, { 21398, 21114, -1 },
+    { 21435, 21115, -1 }, { 21433, 21124, -1 }, { 21448, 21136, -1 }, { 21459, 21143, -1 }, { 21460, 21145, -1 }, { 21406, 21151, -1 },
+    { 21405, 21158, -1 }, { 21443, 21191, -1 }, { 21453, 21199, -1 }, { 21408, 21202, -1 }, { 21414, 21207, -1 }, { 21425, 21237, -1 },
+    { 21461, 21250, -1 }, { 21427, 21251, -1 }, { 21460, 21255, -1 }, { 21462, 21262, -1 }, { 21463, 21275, -1 }, { 21421, 21294, -1 },
+    { 21461, 21296, -1 }, { 21435, 21307, -1 }, { 21436, 21314, -1 }, { 21464, 21336, -1 }, { 21455, 21341, -1 }, { 21449, 21344, -1 },
+    { 21471, 21345, -1 }, { 21464, 21433, -1 }, { 21431, 21470, -1 }, { 21432, 21471, -1 }, { 21470, 21472, -1 }, { 21471, 21473, -1 },
+    { 21463, 21475, -1 }, { 21484, 21483, -1 }, { 21478, 21492, -1 }, { 21457, 21497, -1 }, { 21467, 21502, -1 }, { 21454, 21508, -1 },
+    { 21436, 21511, -1 }, { 21457, 21516, -1 }, { 21465, 21517, -1 }, { 21458, 21518, -1 }, { 21490, 21519, -1 }, { 21453, 21520, -1 },
+    { 21463, 21521, -1 }, { 21454, 21522, -1 }, { 21499, 21523, -1 }, { 21464, 21524, -1 }, { 21501, 21525, -1 }, { 21477, 21526, -1 },
+    { 21465, 21527, -1 }, { 21482, 21528, -1 }, { 21477, 21529, -1 }, { 21475, 21530, -1 }, { 21473, 21531, -1 }, { 21480, 21532, -1 },
+    { 21480, 21533, -1 }, { 21512, 21534, -1 }, { 21483, 21535, -1 }, { 21468, 21536, -1 }, { 21501, 21537, -1 }, { 21502, 21538, -1 },
+    { 21506, 21539, -1 }, { 21506, 21540, -1 }, { 21480, 21541, -1 }, { 21493, 21542, -1 }, { 21470, 21543, -1 }, { 21488, 21544, -1 },
+    { 21482, 21545, -1 }, { 21525, 21546, -1 }, { 21471, 21547, -1 }, { 21480, 21548, -1 }, { 21525, 21549, -1 }, { 21473, 21550, -1 },
+    { 21522, 21551, -1 }, { 21503, 21552, -1 }, { 21519, 21553, -1 }, { 21520, 21554, -1 }, { 21481, 21555, -1 }, { 21507, 21556, -1 },
+    { 21525, 21557, -1 }, { 21534, 21558, -1 }, { 21494, 21559, -1 }, { 21507, 21560, -1 }, { 21508, 21561, -1 }, { 21531, 21562, -1 },
+    { 21528, 21563, -1 }, { 21499, 21564, -1 }, { 21490, 21565, -1 }, { 21498, 21566, -1 }, { 21498, 21567, -1 }, { 21519, 21568, -1 },
+    { 21511, 21569, -1 }, { 21531, 21570, -1 }, { 0, 21571, 31 }, { 0, 21572, 222 }, { 0, 21573, 272 }, { 0, 21574, 347 },
+    { 0, 21575, 393 }, { 0, 21576, 492 }, { 0, 21577, 495 }, { 21452, 21578, 496 }, { 21453, 21579, -1 }, { 21454, 21580, 727 },
+    { 0, 21581, 1002 }, { 0, 21582, 1326 }, { 0, 21583, 1401 }, { 0, 21584, 1505 }, { 0, 21585, 1758 }, { 0, 21586, 1871 },
+    { 0, 21587, 1925 }, { 0, 21588, 2057 }, { 21452, 21589, -1 }, { 0, 21590, 2188 }, { 0, 21591, 2297 }, { 0, 21592, 2449 },
+    { 0, 21593, 2464 }, { 0, 21594, 2539 }, { 0, 21595, 2622 }, { 0, 21596, 2972 }, { 21456, 21597, -1 }, { 21453, 21598, -1 },
+    { 0, 21599, 3205 }, { 0, 21600, 3446 }, { 0, 21601, 3499 }, { 0, 21602, 3503 }, { 0, 21603, 3530 }, { 0, 21604, 3685 },
+    { 0, 21605, 3832 }, { 21458, 21606, -1 }, { 0, 21607, 4037 }, { 0, 21608, 4135 }, { 0, 21609, 4269 }, { 0, 21610, 4487 },
+    { 0, 21611, 4617 }, { 0, 21612, 4636 }, { 21459, 21613, 4641 }, { 21460, 21614, -1 }, { 0, 21615, 6349 }, { 0, 21616, 6350 },
+    { 0, 21617, 6351 }, { 0, 21618, 6352 }, { 21461, 21619, -1 }, { 0, 21620, 6715 }, { 0, 21621, 6917 }, { 21460, 21622, -1 },
+    { 0, 21623, 7015 }, { 21463, 21624, -1 }, { 0, 21625, 7261 }, { 21550, 21633, -1 }, { 21521, 21634, -1 }, { 21552, 21635, -1 },
+    { 21506, 21644, -1 }, { 21564, 21652, -1 }, { 21552, 21653, -1 }, { 21543, 21661, -1 }, { 21557, 21668, -1 }, { 21568, 21669, -1 },
+    { 21518, 21674, -1 }, { 21538, 21677, -1 }, { 21540, 21679, -1 }, { 21527, 21681, -1 }, { 21562, 21682, -1 }, { 21529, 21683, -1 },
+    { 21545, 21684, -1 }, { 21535, 21685, -1 }, { 21551, 21686, -1 }, { 21535, 21687, -1 }, { 21534, 21688, -1 }, { 21574, 21689, -1 },
+    { 21578, 21690, -1 }, { 21557, 21691, -1 }, { 21536, 21692, -1 }, { 0, 21693, 497 }, { 0, 21694, 521 }, { 0, 21695, 728 },
+    { 0, 21696, 2068 }, { 0, 21697, 3093 }, { 0, 21698, 3109 }, { 0, 21699, 4023 }, { 0, 21700, 4642 }, { 0, 21701, 5925 },
+    { 0, 21702, 6419 }, { 0, 21703, 6945 }, { 0, 21704, 7171 },
+};